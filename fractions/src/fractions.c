@@ -52,13 +52,43 @@ static uint32_t gcd(uint32_t u, uint32_t v) {
   int32_t shift = __builtin_ctz(u | v);
   u >>= __builtin_ctz(u);
 
-  uint32_t m;
   do {
     v >>= __builtin_ctz(v);
-    v -= u;
-    m = (int32_t)v >> 31;
-    u += v & m;
-    v = (v + m) ^ m;
+
+    uint32_t m = (u < v) ? u : v;
+    v = (u < v) ? (v - u) : (u - v);
+    u = m;
+  } while (v != 0);
+
+  return (u << shift);
+}
+
+/**
+ * @brief Binary greatest common divisor of two unsigned 64 bits numbers,
+ * used by the sums that keep their partial results on 64 bits.
+ * 
+ * @param u first unsigned number
+ * @param v second unsigned number
+ * @return uint64_t the gcd of the numbers
+ */
+static uint64_t gcd64(uint64_t u, uint64_t v) {
+  if (u == 0) {
+    return v;
+  }
+
+  if (v == 0) {
+    return u;
+  }
+
+  int32_t shift = __builtin_ctzll(u | v);
+  u >>= __builtin_ctzll(u);
+
+  do {
+    v >>= __builtin_ctzll(v);
+
+    uint64_t m = (u < v) ? u : v;
+    v = (u < v) ? (v - u) : (u - v);
+    u = m;
   } while (v != 0);
 
   return (u << shift);
@@ -127,44 +157,319 @@ fbool_t is_fid(frac_t f) { return (f.x == 1) && (f.y == 1) && (f.s == plus);}
 
 
 /**
- * @brief Takes a fraction and computes the string representation.
+ * @brief The numbers from 00 to 99 written with two digits, so that the
+ * formatting writes two digits for every division.
  * 
- * @param f fraction structure.
- * @return const char* the string representation of the fraction.
  */
-const char* frac_out(frac_t f) {
-  if (is_fnan(f)) {
-    return "nans";
+static const char fdigits[201] =
+  "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+  "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+/**
+ * @brief Writes the decimal digits of an unsigned number, two at a time.
+ * MUST not be used outside this file.
+ * 
+ * @param v unsigned number.
+ * @param out destination, needs room for 20 characters.
+ * @return size_t the number of digits written.
+ */
+static size_t fformat_uint(uint64_t v, char *out) {
+  char temp[20];
+  size_t pos = sizeof(temp);
+
+  while (v >= 100) {
+    size_t digit = (size_t)(v % 100) * 2;
+    v /= 100;
+
+    temp[--pos] = fdigits[digit + 1];
+    temp[--pos] = fdigits[digit];
   }
 
-  if (is_fpinf(f)) {
-    return "inf";
+  if (v >= 10) {
+    temp[--pos] = fdigits[v * 2 + 1];
+    temp[--pos] = fdigits[v * 2];
+  } else {
+    temp[--pos] = (char)('0' + v);
+  }
+
+  memcpy(out, temp + pos, sizeof(temp) - pos);
+
+  return sizeof(temp) - pos;
+}
+
+/**
+ * @brief Writes the representation of a fraction of any width, the text is
+ * the one of `frac_out`. MUST not be used outside this file.
+ * 
+ * @param x numerator.
+ * @param y denominator.
+ * @param s sign.
+ * @param nan ftrue if the fraction is nan.
+ * @param buf destination buffer.
+ * @param len size of the buffer.
+ * @return size_t the number of characters written without the null
+ * terminator, or 0 if the buffer is too small.
+ */
+static size_t fformat(uint64_t x, uint64_t y, sign_t s, fbool_t nan, char *buf, size_t len) {
+  char temp[FRAC64_FORMAT_SIZE];
+  size_t size = 0;
+
+  if (nan) {
+    memcpy(temp, "nans", 4);
+    size = 4;
+  } else if (x == 0 && y != 0) {
+    temp[size++] = '0';
+  } else {
+    if (s == mins) {
+      temp[size++] = '-';
+    }
+
+    if (y == 0) {
+      memcpy(temp + size, "inf", 3);
+      size += 3;
+    } else {
+      size += fformat_uint(x, temp + size);
+
+      if (y != 1) {
+        temp[size++] = '/';
+        size += fformat_uint(y, temp + size);
+      }
+    }
   }
 
-  if (is_fminf(f)) {
-    return "-inf";
+  if (size >= len) {
+    if (len != 0) {
+      buf[0] = '\0';
+    }
+
+    return 0;
   }
 
-  if (is_fzero(f)) {
-    return "0";
+  memcpy(buf, temp, size);
+  buf[size] = '\0';
+
+  return size;
+}
+
+/**
+ * @brief Reads the decimal digits of an unsigned number.
+ * MUST not be used outside this file.
+ * 
+ * @param str string to read.
+ * @param len number of characters that can be read.
+ * @param max the greatest accepted number.
+ * @param v pointer where to store the number.
+ * @return size_t the number of digits read, 0 if there is no digit or the
+ * number is greater than `max`.
+ */
+static size_t fparse_uint(const char *str, size_t len, uint64_t max, uint64_t *v) {
+  uint64_t value = 0;
+  size_t pos = 0;
+
+  while ((pos < len) && ((unsigned char)(str[pos] - '0') < 10)) {
+    uint64_t digit = (uint64_t)(str[pos] - '0');
+
+    if (value > (max - digit) / 10) {
+      return 0;
+    }
+
+    value = value * 10 + digit;
+    ++pos;
+  }
+
+  *v = value;
+
+  return pos;
+}
+
+/**
+ * @brief Reads a fraction of any width written as `frac_out` does, the
+ * numerator and denominator are not reduced. MUST not be used outside this file.
+ * 
+ * @param str string to read.
+ * @param len number of characters that can be read.
+ * @param max the greatest accepted numerator and denominator.
+ * @param x pointer where to store the numerator.
+ * @param y pointer where to store the denominator.
+ * @param s pointer where to store the sign, `nans` for nan.
+ * @return size_t the number of characters read, 0 if the text is not a fraction.
+ */
+static size_t fparse(const char *str, size_t len, uint64_t max, uint64_t *x, uint64_t *y, sign_t *s) {
+  size_t pos = 0;
+
+  if ((len >= 3) && (memcmp(str, "nan", 3) == 0)) {
+    *s = nans;
+    return ((len >= 4) && (str[3] == 's')) ? 4 : 3;
+  }
+
+  *s = plus;
+  if ((len != 0) && ((str[0] == '-') || (str[0] == '+'))) {
+    *s = (str[0] == '-') ? mins : plus;
+    ++pos;
   }
 
-  static char buffer[25];
-  int offset = 0;
+  if ((len - pos >= 3) && (memcmp(str + pos, "inf", 3) == 0)) {
+    *x = 1;
+    *y = 0;
+    return pos + 3;
+  }
+
+  size_t digits = fparse_uint(str + pos, len - pos, max, x);
 
-  if (f.s == mins) {
-    offset = snprintf(buffer, 25, "-");
+  if (digits == 0) {
+    return 0;
   }
 
-  offset += snprintf(buffer + offset, 25, "%u", f.x);
+  pos += digits;
+  *y = 1;
+
+  if ((pos < len) && (str[pos] == '/')) {
+    digits = fparse_uint(str + pos + 1, len - pos - 1, max, y);
+
+    if (digits == 0) {
+      return 0;
+    }
 
-  if (f.y != 1) {
-    snprintf(buffer + offset, 25, "/%u", f.y);
+    pos += digits + 1;
   }
 
+  return pos;
+}
+
+/**
+ * @brief Takes a fraction and computes the string representation.
+ * 
+ * @param f fraction structure.
+ * @return const char* the string representation of the fraction.
+ */
+const char* frac_out(frac_t f) {
+  static char buffer[FRAC_FORMAT_SIZE];
+
+  frac_format(f, buffer, sizeof(buffer));
+
   return buffer;
 }
 
+/**
+ * @brief Writes the string representation of a fraction, the same text as
+ * `frac_out`, into a buffer owned by the caller, so it can be used from many
+ * threads at once.
+ * 
+ * @param f fraction structure.
+ * @param buf destination buffer.
+ * @param len size of the buffer, `FRAC_FORMAT_SIZE` is enough for every fraction.
+ * @return size_t the number of characters written without the null
+ * terminator, or 0 if the buffer is too small.
+ */
+size_t frac_format(frac_t f, char *buf, size_t len) {
+  return fformat(f.x, f.y, f.s, is_fnan(f), buf, len);
+}
+
+/**
+ * @brief Reads a fraction written as `frac_out` does ("-7/4", "3", "0",
+ * "inf", "-inf", "nans" or "nan"), the fraction is reduced with `fxy`,
+ * so "6/24" is read as 1/4 and "1/0" as infinity. The reading stops at
+ * the first character that is not part of the fraction.
+ * 
+ * @param str string to read, it does not have to be null terminated.
+ * @param len number of characters that can be read.
+ * @param f pointer where to store the fraction.
+ * @return size_t the number of characters read, 0 if the text does not start
+ * with a fraction or the numbers do not fit on 32 bits.
+ */
+size_t frac_parse(const char *str, size_t len, frac_t *f) {
+  uint64_t x = 0, y = 0;
+  sign_t s = plus;
+  size_t read = fparse(str, len, UINT32_MAX, &x, &y, &s);
+
+  if (read != 0) {
+    *f = (s == nans) ? nan_frac : fxy((uint32_t)x, (uint32_t)y, s);
+  }
+
+  return read;
+}
+
+/**
+ * @brief Writes the representations of an array of fractions separated by
+ * a character, as a line of a CSV file.
+ * 
+ * @param f array of fractions.
+ * @param n number of fractions.
+ * @param sep separator written between two fractions.
+ * @param buf destination buffer.
+ * @param len size of the buffer.
+ * @return size_t the number of characters written without the null
+ * terminator, or 0 if the buffer is too small.
+ */
+size_t frac_format_n(const frac_t *f, size_t n, char sep, char *buf, size_t len) {
+  size_t size = 0;
+
+  if (len != 0) {
+    buf[0] = '\0';
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    if (i != 0) {
+      if (size + 1 >= len) {
+        buf[0] = '\0';
+        return 0;
+      }
+
+      buf[size++] = sep;
+    }
+
+    size_t written = frac_format(f[i], buf + size, len - size);
+
+    if (written == 0) {
+      buf[0] = '\0';
+      return 0;
+    }
+
+    size += written;
+  }
+
+  return size;
+}
+
+/**
+ * @brief Reads at most `n` fractions separated by a character, as a line
+ * of a CSV file. The reading stops at the first character that is neither
+ * part of a fraction nor a separator, or at the first malformed fraction.
+ * 
+ * @param str string to read, it does not have to be null terminated.
+ * @param len number of characters that can be read.
+ * @param sep separator between two fractions.
+ * @param f destination array with room for `n` fractions.
+ * @param n greatest number of fractions to read.
+ * @param end pointer where to store the number of characters read, may be NULL.
+ * @return size_t the number of fractions read.
+ */
+size_t frac_parse_n(const char *str, size_t len, char sep, frac_t *f, size_t n, size_t *end) {
+  size_t count = 0, pos = 0;
+
+  while (count < n) {
+    size_t read = frac_parse(str + pos, len - pos, &f[count]);
+
+    if (read == 0) {
+      break;
+    }
+
+    pos += read;
+    ++count;
+
+    if ((count == n) || (pos >= len) || (str[pos] != sep)) {
+      break;
+    }
+
+    ++pos;
+  }
+
+  if (end != NULL) {
+    *end = pos;
+  }
+
+  return count;
+}
 
 /**
  * @brief Evaluates the fraction structure to a double value.
@@ -327,6 +632,103 @@ frac_t fdconst(frac_t f1, int32_t c) {
   }
 }
 
+/**
+ * @brief Adds two finite fractions, the cross products are computed on
+ * 64 bits and the sum is reduced with the gcd of the denominators only,
+ * as both fractions are irreductible. Shared by `fadd` and `fadd_n`.
+ * MUST not be used outside this file.
+ * 
+ * @param f1 first finite fraction.
+ * @param f2 second finite fraction.
+ * @return frac_t the irreductible sum, or nan if it does not fit in a fraction.
+ */
+static inline frac_t fadd_finite(frac_t f1, frac_t f2) {
+  uint32_t common = gcd(f1.y, f2.y);
+  uint32_t amplify_f1 = f2.y;
+  uint32_t amplify_f2 = f1.y;
+
+  if (common != 1) {
+    amplify_f1 /= common;
+    amplify_f2 /= common;
+  }
+
+  uint64_t x1 = (uint64_t)f1.x * amplify_f1;
+  uint64_t x2 = (uint64_t)f2.x * amplify_f2;
+  uint64_t x = 0;
+
+  sign_t s = f1.s;
+  if (f1.s == f2.s) {
+    x = x1 + x2;
+
+    if (x < x1) {
+      return nan_frac;
+    }
+  } else if (x1 >= x2) {
+    x = x1 - x2;
+  } else {
+    x = x2 - x1;
+    s = f2.s;
+  }
+
+  if (x == 0) {
+    return zero_frac;
+  }
+
+  uint64_t y = (uint64_t)amplify_f2 * f2.y;
+
+  if (common != 1) {
+    uint32_t simplify = gcd((uint32_t)(x % common), common);
+
+    if (simplify != 1) {
+      x /= simplify;
+      y = (uint64_t)amplify_f2 * (f2.y / simplify);
+    }
+  }
+
+  if ((x > UINT32_MAX) || (y > UINT32_MAX)) {
+    return nan_frac;
+  }
+
+  return (frac_t){(uint32_t)x, (uint32_t)y, s};
+}
+
+/**
+ * @brief Multiplies two finite fractions, the numerators and denominators
+ * are simplified crosswise before the 64 bits products. Shared by `fmul`,
+ * `fdiv` and `fmul_n`. MUST not be used outside this file.
+ * 
+ * @param f1 first finite fraction.
+ * @param f2 second finite fraction.
+ * @return frac_t the irreductible product, or nan if it does not fit in a fraction.
+ */
+static inline frac_t fmul_finite(frac_t f1, frac_t f2) {
+  uint32_t g1 = gcd(f1.x, f2.y);
+  uint32_t g2 = gcd(f2.x, f1.y);
+
+  if (g1 != 1) {
+    f1.x /= g1;
+    f2.y /= g1;
+  }
+
+  if (g2 != 1) {
+    f2.x /= g2;
+    f1.y /= g2;
+  }
+
+  uint64_t x = (uint64_t)f1.x * f2.x;
+  uint64_t y = (uint64_t)f1.y * f2.y;
+
+  if (x == 0) {
+    return zero_frac;
+  }
+
+  if ((x > UINT32_MAX) || (y > UINT32_MAX)) {
+    return nan_frac;
+  }
+
+  return (frac_t){(uint32_t)x, (uint32_t)y, (f1.s == f2.s) ? plus : mins};
+}
+
 /**
  * @brief Function that handles the rules of adding between a number
  * and infinity, the number may also be infinity. MUST not be used outside
@@ -373,44 +775,7 @@ frac_t fadd(frac_t f1, frac_t f2) {
     return f1;
   }
 
-  uint32_t common = gcd(f1.y, f2.y);
-  uint32_t amplify_f1 = f2.y / common;
-  uint32_t amplify_f2 = f1.y / common;
-
-  f1.x *= amplify_f1;
-  f2.x *= amplify_f2;
-
-  frac_t f;
-  f.y = f1.y * amplify_f1;
-  if (f1.s == mins && f2.s == mins) {
-    f.x = f1.x + f2.x;
-    f.s = mins;
-  } else if (f1.s == mins) {
-    if (f1.x > f2.x) {
-      f.x = f1.x - f2.x;
-      f.s = mins;
-    } else {
-      f.x = f2.x - f1.x;
-      f.s = plus;
-    }
-  } else if (f2.s == mins) {
-    if (f1.x >= f2.x) {
-      f.x = f1.x - f2.x;
-      f.s = plus;
-    } else {
-      f.x = f2.x - f1.x;
-      f.s = mins;
-    }
-  } else {
-    f.x = f1.x + f2.x;
-    f.s = plus;
-  }
-
-  if (f.x == 0) {
-    f = zero_frac;
-  }
-
-  return f;
+  return fadd_finite(f1, f2);
 }
 
 /**
@@ -488,20 +853,7 @@ frac_t fmul(frac_t f1, frac_t f2) {
     return f1;
   }
 
-  uint32_t g1 = gcd(f1.x, f2.y);
-  uint32_t g2 = gcd(f2.x, f1.y);
-
-  frac_t f;
-  f.x = (f1.x / g1) * (f2.x / g2);
-  f.y = (f1.y / g2) * (f2.y / g1);
-  
-  if ((f1.s == mins && f2.s == mins) || (f1.s == plus && f2.s == plus)) {
-    f.s = plus;
-  } else {
-    f.s = mins;
-  }
-
-  return f;
+  return fmul_finite(f1, f2);
 }
 
 /**
@@ -571,20 +923,7 @@ frac_t fdiv(frac_t f1, frac_t f2) {
     return f1;
   }
 
-  uint32_t g1 = gcd(f1.x, f2.y);
-  uint32_t g2 = gcd(f2.x, f1.y);
-
-  frac_t f;
-  f.x = (f1.x / g1) * (f2.x / g2);
-  f.y = (f1.y / g2) * (f2.y / g1);
-  
-  if ((f1.s == mins && f2.s == mins) || (f1.s == plus && f2.s == plus)) {
-    f.s = plus;
-  } else {
-    f.s = mins;
-  }
-
-  return f;
+  return fmul_finite(f1, f2);
 }
 
 
@@ -670,17 +1009,16 @@ void fdivp(frac_t *f1, frac_t f2) {
 
 
 /**
- * @brief Checks if two fractions are equal. Because all the fractions
- * are represented as ireductible fractions, the function checks if the
- * numerators, denominators and signs are equal. The `nans` and `infinities`
- * fraction will always generate the `funknown` answer for indeterminate states.
- * f1 == f2
+ * @brief Compares two fractions, with one 64 bits cross product for
+ * finite fractions and no `gcd`. The `nans` and the equal `infinities`
+ * are not comparable. MUST not be used outside this file.
  * 
  * @param f1 first fraction.
  * @param f2 second fraction.
- * @return fbool_t ftrue if the fractions are equal, ffalse otherwise.
+ * @param cmp pointer where to store -1, 0 or 1 as f1 <, ==, > f2.
+ * @return fbool_t ftrue if the fractions are comparable, funknown otherwise.
  */
-fbool_t feq(frac_t f1, frac_t f2) {
+static inline fbool_t fcmp(frac_t f1, frac_t f2, int32_t *cmp) {
   if (is_fnan(f1) || is_fnan(f2)) {
     return funknown;
   }
@@ -688,19 +1026,50 @@ fbool_t feq(frac_t f1, frac_t f2) {
   if (is_finf(f1) || is_finf(f2)) {
     if ((is_fpinf(f1) && is_fpinf(f2)) || (is_fminf(f1) && is_fminf(f2))) {
       return funknown;
-    } else {
-      return ffalse;
     }
+
+    *cmp = (is_fpinf(f1) || is_fminf(f2)) ? 1 : -1;
+    return ftrue;
+  }
+
+  if ((f1.s != f2.s) && ((f1.x | f2.x) != 0)) {
+    *cmp = (f1.s == plus) ? 1 : -1;
+    return ftrue;
+  }
+
+  uint64_t x1 = (uint64_t)f1.x * f2.y;
+  uint64_t x2 = (uint64_t)f2.x * f1.y;
+
+  *cmp = (x1 > x2) - (x1 < x2);
+
+  if (f1.s == mins) {
+    *cmp = -*cmp;
   }
 
-  return (f1.s == f2.s) && (f1.x == f2.x) && (f1.y == f2.y);
+  return ftrue;
 }
 
+/**
+ * @brief Checks if two fractions are equal. The `nans` and `infinities`
+ * fraction will always generate the `funknown` answer for indeterminate states.
+ * f1 == f2
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return fbool_t ftrue if the fractions are equal, ffalse otherwise.
+ */
+fbool_t feq(frac_t f1, frac_t f2) {
+  int32_t cmp = 0;
+
+  if (fcmp(f1, f2, &cmp) == funknown) {
+    return funknown;
+  }
+
+  return cmp == 0;
+}
 
 /**
- * @brief Checks if two fractions are not equal. Because all the fractions
- * are represented as ireductible fractions, the function checks if the
- * numerators, denominators or signs are not equal. The `nans` and `infinities`
+ * @brief Checks if two fractions are not equal. The `nans` and `infinities`
  * fraction will always generate the `funknown` answer for indeterminate states.
  * f1 != f2
  * 
@@ -709,19 +1078,13 @@ fbool_t feq(frac_t f1, frac_t f2) {
  * @return fbool_t ftrue if the fractions are not equal, ffalse otherwise.
  */
 fbool_t fneq(frac_t f1, frac_t f2) {
-  if (is_fnan(f1) || is_fnan(f2)) {
-    return funknown;
-  }
+  int32_t cmp = 0;
 
-  if (is_finf(f1) || is_finf(f2)) {
-    if ((is_fpinf(f1) && is_fpinf(f2)) || (is_fminf(f1) && is_fminf(f2))) {
-      return funknown;
-    } else {
-      return ftrue;
-    }
+  if (fcmp(f1, f2, &cmp) == funknown) {
+    return funknown;
   }
 
-  return (f1.s != f2.s) || (f1.x != f2.x) || (f1.y != f2.y);
+  return cmp != 0;
 }
 
 /**
@@ -735,35 +1098,13 @@ fbool_t fneq(frac_t f1, frac_t f2) {
  * @return fbool_t ftrue if the first fraction is greater than second, ffalse otherwise.
  */
 fbool_t fgt(frac_t f1, frac_t f2) {
-  if (is_fnan(f1) || is_fnan(f2)) {
+  int32_t cmp = 0;
+
+  if (fcmp(f1, f2, &cmp) == funknown) {
     return funknown;
   }
 
-  if (is_finf(f1) || is_finf(f2)) {
-    if ((is_fpinf(f1) && is_fpinf(f2)) || (is_fminf(f1) && is_fminf(f2))) {
-      return funknown;
-    } else if (is_fpinf(f1) || is_fminf(f2)) {
-      return ftrue;
-    } else {
-      return ffalse;
-    }
-  }
-
-  if (f1.s == plus && f2.s == mins) {
-    return ftrue;
-  } else if (f1.s == mins && f2.s == plus) {
-    return ffalse;
-  } else {
-    uint32_t common = gcd(f1.y, f2.y);
-    uint32_t x1 = f1.x * (f2.y / common);
-    uint32_t x2 = f2.x * (f1.y / common);
-
-    if (f1.s == plus && f2.s == plus) {
-      return x1 > x2;
-    } else {
-      return x1 < x2;
-    }
-  } 
+  return cmp > 0;
 }
 
 /**
@@ -777,35 +1118,13 @@ fbool_t fgt(frac_t f1, frac_t f2) {
  * @return fbool_t ftrue if the first fraction is less than second, ffalse otherwise.
  */
 fbool_t flt(frac_t f1, frac_t f2) {
-  if (is_fnan(f1) || is_fnan(f2)) {
-    return funknown;
-  }
+  int32_t cmp = 0;
 
-  if (is_finf(f1) || is_finf(f2)) {
-    if ((is_fpinf(f1) && is_fpinf(f2)) || (is_fminf(f1) && is_fminf(f2))) {
-      return funknown;
-    } else if (is_fpinf(f1) || is_fminf(f2)) {
-      return ffalse;
-    } else {
-      return ftrue;
-    }
+  if (fcmp(f1, f2, &cmp) == funknown) {
+    return funknown;
   }
 
-  if (f1.s == plus && f2.s == mins) {
-    return ffalse;
-  } else if (f1.s == mins && f2.s == plus) {
-    return ftrue;
-  } else {
-    uint32_t common = gcd(f1.y, f2.y);
-    uint32_t x1 = f1.x * (f2.y / common);
-    uint32_t x2 = f2.x * (f1.y / common);
-
-    if (f1.s == plus && f2.s == plus) {
-      return x1 < x2;
-    } else {
-      return x1 > x2;
-    }
-  } 
+  return cmp < 0;
 }
 
 /**
@@ -820,35 +1139,13 @@ fbool_t flt(frac_t f1, frac_t f2) {
  * ffalse otherwise.
  */
 fbool_t fgte(frac_t f1, frac_t f2) {
-  if (is_fnan(f1) || is_fnan(f2)) {
-    return funknown;
-  }
+  int32_t cmp = 0;
 
-  if (is_finf(f1) || is_finf(f2)) {
-    if ((is_fpinf(f1) && is_fpinf(f2)) || (is_fminf(f1) && is_fminf(f2))) {
-      return funknown;
-    } else if (is_fpinf(f1) || is_fminf(f2)) {
-      return ftrue;
-    } else {
-      return ffalse;
-    }
+  if (fcmp(f1, f2, &cmp) == funknown) {
+    return funknown;
   }
 
-  if (f1.s == plus && f2.s == mins) {
-    return ftrue;
-  } else if (f1.s == mins && f2.s == plus) {
-    return ffalse;
-  } else {
-    uint32_t common = gcd(f1.y, f2.y);
-    uint32_t x1 = f1.x * (f2.y / common);
-    uint32_t x2 = f2.x * (f1.y / common);
-
-    if (f1.s == plus && f2.s == plus) {
-      return x1 >= x2;
-    } else {
-      return x1 <= x2;
-    }
-  }  
+  return cmp >= 0;
 }
 
 /**
@@ -863,33 +1160,1929 @@ fbool_t fgte(frac_t f1, frac_t f2) {
  * ffalse otherwise.
  */
 fbool_t flte(frac_t f1, frac_t f2) {
-  if (is_fnan(f1) || is_fnan(f2)) {
+  int32_t cmp = 0;
+
+  if (fcmp(f1, f2, &cmp) == funknown) {
     return funknown;
   }
 
-  if (is_finf(f1) || is_finf(f2)) {
-    if ((is_fpinf(f1) && is_fpinf(f2)) || (is_fminf(f1) && is_fminf(f2))) {
-      return funknown;
-    } else if (is_fpinf(f1) || is_fminf(f2)) {
+  return cmp <= 0;
+}
+
+/**
+ * @brief Compares two fractions with a total order, so that the fractions
+ * can be sorted or used as keys of the library's trees. The order is
+ * -inf < finite fractions < inf < nan, the infinities of the same sign are
+ * equal and all the nans are equal. The signature is the one of `compare_func`.
+ * 
+ * @param data1 pointer to the first fraction.
+ * @param data2 pointer to the second fraction.
+ * @return int32_t -1, 0 or 1 as the first fraction is less than, equal to
+ * or greater than the second.
+ */
+int32_t compare_frac(const void * const data1, const void * const data2) {
+  frac_t f1 = *(const frac_t *)data1;
+  frac_t f2 = *(const frac_t *)data2;
+  int32_t cmp = 0;
+
+  if (fcmp(f1, f2, &cmp) == funknown) {
+    return (int32_t)is_fnan(f1) - (int32_t)is_fnan(f2);
+  }
+
+  return cmp;
+}
+
+/**
+ * @brief Number of fractions processed at once by the array kernels,
+ * small enough for the scratch arrays of a block to live on the stack.
+ * 
+ */
+#define FRAC_BLOCK 256
+
+/**
+ * @brief Checks without branches if a fraction is a nan or an infinity,
+ * so that the loops calling it can be vectorized. MUST not be used
+ * outside this file.
+ * 
+ * @param x numerator.
+ * @param y denominator.
+ * @param s sign.
+ * @return uint32_t 1 if the fraction is a nan or an infinity, 0 otherwise.
+ */
+static inline uint32_t is_special(uint32_t x, uint32_t y, sign_t s) {
+  return (y == 0) | ((x == UINT32_MAX) & (y == UINT32_MAX)) | (s == nans);
+}
+
+/**
+ * @brief Reads the i-th fraction of a structure of arrays for the finite
+ * path of the kernels, the zero denominators of the infinities are replaced
+ * with one, so the path never divides by zero. The result for those
+ * fractions is overwritten by the special pass. MUST not be used
+ * outside this file.
+ * 
+ * @param f structure of arrays.
+ * @param i index of the fraction.
+ * @return frac_t the fraction with a non zero denominator.
+ */
+static inline frac_t frac_soa_finite(frac_soa_t f, size_t i) {
+  return (frac_t){f.x[i], f.y[i] + (f.y[i] == 0), f.s[i]};
+}
+
+/**
+ * @brief Adds an irreductible fraction with 64 bits numerator and denominator
+ * to a reduced finite accumulator, the sum is reduced with the gcd of the
+ * denominators only, as in `fadd_finite`. MUST not be used outside this file.
+ * 
+ * @param acc pointer to the reduced accumulator.
+ * @param x numerator of the term.
+ * @param y denominator of the term, must not be zero.
+ * @param s sign of the term.
+ * @return fbool_t ftrue if the sum was updated, ffalse if it does not fit on 64 bits.
+ */
+static fbool_t frac_acc_add_reduced(frac_acc_t *acc, uint64_t x, uint64_t y, sign_t s) {
+  uint64_t common = gcd64(acc->y, y);
+  uint64_t amplify_term = acc->y / common;
+  uint64_t x1 = 0, x2 = 0, t = 0;
+
+  if (__builtin_mul_overflow(acc->x, y / common, &x1) ||
+      __builtin_mul_overflow(x, amplify_term, &x2)) {
+    return ffalse;
+  }
+
+  sign_t t_s = acc->s;
+  if (acc->s == s) {
+    if (__builtin_add_overflow(x1, x2, &t)) {
       return ffalse;
-    } else {
-      return ftrue;
     }
+  } else if (x1 >= x2) {
+    t = x1 - x2;
+  } else {
+    t = x2 - x1;
+    t_s = s;
   }
 
-  if (f1.s == plus && f2.s == mins) {
-    return ffalse;
-  } else if (f1.s == mins && f2.s == plus) {
+  if (t == 0) {
+    *acc = (frac_acc_t){0, 1, plus};
     return ftrue;
-  } else {
-    uint32_t common = gcd(f1.y, f2.y);
-    uint32_t x1 = f1.x * (f2.y / common);
-    uint32_t x2 = f2.x * (f1.y / common);
+  }
+
+  uint64_t simplify = gcd64(t % common, common);
+  uint64_t t_y = 0;
+
+  if (__builtin_mul_overflow(amplify_term, y / simplify, &t_y)) {
+    return ffalse;
+  }
+
+  *acc = (frac_acc_t){t / simplify, t_y, t_s};
+
+  return ftrue;
+}
+
+/**
+ * @brief Reduces the numerator and the denominator of a finite accumulator.
+ * MUST not be used outside this file.
+ * 
+ * @param acc pointer to the finite accumulator.
+ */
+static void frac_acc_reduce(frac_acc_t *acc) {
+  uint64_t simplify = gcd64(acc->x, acc->y);
+
+  if (simplify > 1) {
+    acc->x /= simplify;
+    acc->y /= simplify;
+  }
+}
+
+/**
+ * @brief Adds a finite fraction with 64 bits numerator and denominator to
+ * a finite accumulator without reducing the sum. Equal denominators are
+ * added without multiplying them. Only when the lazy sum overflows, the
+ * accumulator and the term are reduced and added with `frac_acc_add_reduced`,
+ * if the sum does not fit on 64 bits even then, the accumulator becomes nan.
+ * MUST not be used outside this file.
+ * 
+ * @param acc pointer to the finite accumulator.
+ * @param x numerator of the term.
+ * @param y denominator of the term, must not be zero.
+ * @param s sign of the term.
+ */
+static inline void frac_acc_add_finite(frac_acc_t *acc, uint64_t x, uint64_t y, sign_t s) {
+  if (x == 0) {
+    return;
+  }
+
+  if (acc->x == 0) {
+    *acc = (frac_acc_t){x, y, s};
+    return;
+  }
+
+  uint64_t x1 = acc->x, x2 = x, t_y = y, t = 0;
+  int overflow = 0;
+
+  if (acc->y != y) {
+    overflow = __builtin_mul_overflow(acc->x, y, &x1) |
+               __builtin_mul_overflow(x, acc->y, &x2) |
+               __builtin_mul_overflow(acc->y, y, &t_y);
+  }
+
+  if (!overflow) {
+    sign_t t_s = acc->s;
 
-    if (f1.s == plus && f2.s == plus) {
-      return x1 <= x2;
+    if (acc->s == s) {
+      overflow = __builtin_add_overflow(x1, x2, &t);
+    } else if (x1 >= x2) {
+      t = x1 - x2;
     } else {
-      return x1 >= x2;
+      t = x2 - x1;
+      t_s = s;
+    }
+
+    if (!overflow) {
+      *acc = (t == 0) ? (frac_acc_t){0, 1, plus} : (frac_acc_t){t, t_y, t_s};
+      return;
+    }
+  }
+
+  uint64_t simplify = gcd64(x, y);
+
+  frac_acc_reduce(acc);
+  if (!frac_acc_add_reduced(acc, x / simplify, y / simplify, s)) {
+    *acc = (frac_acc_t){UINT64_MAX, UINT64_MAX, nans};
+  }
+}
+
+/**
+ * @brief Checks wheter an accumulator holds a nan or an infinity.
+ * MUST not be used outside this file.
+ * 
+ * @param acc pointer to the accumulator.
+ * @return fbool_t ftrue if the accumulator is nan or infinity, ffalse otherwise.
+ */
+static inline fbool_t is_acc_special(const frac_acc_t *acc) {
+  return (acc->y == 0) || (acc->s == nans);
+}
+
+/**
+ * @brief Converts an accumulator to a fraction that behaves the same in
+ * `fadd` and `fmul` when the other operand is a nan or an infinity, a finite
+ * accumulator is replaced by a zero or a one with its sign.
+ * MUST not be used outside this file.
+ * 
+ * @param acc pointer to the accumulator.
+ * @return frac_t the fraction standing for the accumulator.
+ */
+static inline frac_t frac_acc_proxy(const frac_acc_t *acc) {
+  if (acc->s == nans) {
+    return nan_frac;
+  }
+
+  if (acc->y == 0) {
+    return (frac_t){1, 0, acc->s};
+  }
+
+  return (frac_t){acc->x != 0, 1, acc->s};
+}
+
+/**
+ * @brief Stores the result of an operation with a nan or an infinity
+ * into an accumulator. MUST not be used outside this file.
+ * 
+ * @param acc pointer to the accumulator.
+ * @param f nan or infinity fraction.
+ */
+static inline void frac_acc_set_special(frac_acc_t *acc, frac_t f) {
+  if (is_fnan(f)) {
+    *acc = (frac_acc_t){UINT64_MAX, UINT64_MAX, nans};
+  } else {
+    *acc = (frac_acc_t){1, 0, f.s};
+  }
+}
+
+/**
+ * @brief Sets the accumulator to the zero fraction.
+ * 
+ * @param acc pointer to the accumulator.
+ */
+void frac_acc_init(frac_acc_t *acc) {
+  *acc = (frac_acc_t){0, 1, plus};
+}
+
+/**
+ * @brief Adds a fraction to the accumulator, the sum is reduced only when
+ * it would overflow the 64 bits numerator or denominator.
+ * acc += f.
+ * 
+ * @param acc pointer to the accumulator.
+ * @param f fraction to add.
+ */
+void frac_acc_add(frac_acc_t *acc, frac_t f) {
+  if (is_acc_special(acc) || is_fnan(f) || is_finf(f)) {
+    frac_acc_set_special(acc, fadd(frac_acc_proxy(acc), f));
+    return;
+  }
+
+  frac_acc_add_finite(acc, f.x, f.y, f.s);
+}
+
+/**
+ * @brief Subtracts a fraction from the accumulator, the difference is reduced
+ * only when it would overflow the 64 bits numerator or denominator.
+ * acc -= f.
+ * 
+ * @param acc pointer to the accumulator.
+ * @param f fraction to subtract.
+ */
+void frac_acc_sub(frac_acc_t *acc, frac_t f) {
+  if (!is_fnan(f)) {
+    f.s = (f.s + 1) % 2;
+  }
+
+  frac_acc_add(acc, f);
+}
+
+/**
+ * @brief Multiplies the accumulator with a fraction, the product is reduced
+ * only when it would overflow the 64 bits numerator or denominator.
+ * acc *= f.
+ * 
+ * @param acc pointer to the accumulator.
+ * @param f fraction to multiply with.
+ */
+void frac_acc_mul(frac_acc_t *acc, frac_t f) {
+  if (is_acc_special(acc) || is_fnan(f) || is_finf(f)) {
+    frac_acc_set_special(acc, fmul(frac_acc_proxy(acc), f));
+    return;
+  }
+
+  if ((acc->x == 0) || (f.x == 0)) {
+    frac_acc_init(acc);
+    return;
+  }
+
+  sign_t s = (acc->s == f.s) ? plus : mins;
+  uint64_t x = 0, y = 0;
+
+  if (!__builtin_mul_overflow(acc->x, f.x, &x) && !__builtin_mul_overflow(acc->y, f.y, &y)) {
+    *acc = (frac_acc_t){x, y, s};
+    return;
+  }
+
+  frac_acc_reduce(acc);
+
+  uint64_t g1 = gcd64(acc->x, f.y);
+  uint64_t g2 = gcd64(f.x, acc->y);
+
+  if (__builtin_mul_overflow(acc->x / g1, f.x / g2, &x) ||
+      __builtin_mul_overflow(acc->y / g2, f.y / g1, &y)) {
+    *acc = (frac_acc_t){UINT64_MAX, UINT64_MAX, nans};
+    return;
+  }
+
+  *acc = (frac_acc_t){x, y, s};
+}
+
+/**
+ * @brief Reads the value of the accumulator as an irreductible fraction,
+ * the accumulator is reduced in place, so it can still be used afterwards.
+ * 
+ * @param acc pointer to the accumulator.
+ * @return frac_t the value of the accumulator, or nan if it does not fit
+ * in a fraction.
+ */
+frac_t frac_acc_get(frac_acc_t *acc) {
+  if (is_acc_special(acc)) {
+    return frac_acc_proxy(acc);
+  }
+
+  frac_acc_reduce(acc);
+
+  if ((acc->x > UINT32_MAX) || (acc->y > UINT32_MAX)) {
+    return nan_frac;
+  }
+
+  if (acc->x == 0) {
+    return zero_frac;
+  }
+
+  return (frac_t){(uint32_t)acc->x, (uint32_t)acc->y, acc->s};
+}
+
+/**
+ * @brief Copies an array of fractions into a structure of arrays.
+ * r = f[0 .. n - 1].
+ * 
+ * @param r destination structure of arrays, with room for `n` fractions.
+ * @param f source array of fractions.
+ * @param n number of fractions to copy.
+ */
+void frac_soa_load(frac_soa_t r, const frac_t *f, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    r.x[i] = f[i].x;
+    r.y[i] = f[i].y;
+    r.s[i] = f[i].s;
+  }
+}
+
+/**
+ * @brief Copies a structure of arrays back into an array of fractions.
+ * f[0 .. n - 1] = a.
+ * 
+ * @param f destination array of fractions, with room for `n` fractions.
+ * @param a source structure of arrays.
+ * @param n number of fractions to copy.
+ */
+void frac_soa_store(frac_t *f, frac_soa_t a, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    f[i] = (frac_t){a.x[i], a.y[i], a.s[i]};
+  }
+}
+
+/**
+ * @brief Computes an element by element operation over arrays of fractions,
+ * in blocks of `FRAC_BLOCK` fractions. The first pass marks the nans and
+ * infinities, the second one runs the finite operator over every fraction,
+ * the third one recomputes only the marked fractions with the scalar operator.
+ * The results of a block are kept on the stack until the end, so `r` may
+ * alias `f1` or `f2`. MUST not be used outside this file.
+ * 
+ * @param r destination structure of arrays.
+ * @param f1 first structure of arrays.
+ * @param f2 second structure of arrays.
+ * @param n number of fractions in every array.
+ * @param finite_op operator for two finite fractions.
+ * @param scalar_op operator handling nans and infinities.
+ */
+static inline __attribute__((always_inline)) void frac_block_op(frac_soa_t r, frac_soa_t f1, frac_soa_t f2, size_t n,
+                                 frac_t (*finite_op)(frac_t, frac_t),
+                                 frac_t (*scalar_op)(frac_t, frac_t)) {
+  uint32_t rx[FRAC_BLOCK], ry[FRAC_BLOCK];
+  sign_t rs[FRAC_BLOCK];
+  uint32_t special[FRAC_BLOCK];
+
+  for (size_t start = 0; start < n; start += FRAC_BLOCK) {
+    size_t len = (n - start < FRAC_BLOCK) ? (n - start) : FRAC_BLOCK;
+    frac_soa_t a = {f1.x + start, f1.y + start, f1.s + start};
+    frac_soa_t b = {f2.x + start, f2.y + start, f2.s + start};
+    uint32_t specials = 0;
+
+    for (size_t i = 0; i < len; ++i) {
+      special[i] = is_special(a.x[i], a.y[i], a.s[i]) | is_special(b.x[i], b.y[i], b.s[i]);
+      specials |= special[i];
+    }
+
+    for (size_t i = 0; i < len; ++i) {
+      frac_t f = finite_op(frac_soa_finite(a, i), frac_soa_finite(b, i));
+
+      rx[i] = f.x;
+      ry[i] = f.y;
+      rs[i] = f.s;
+    }
+
+    if (specials != 0) {
+      for (size_t i = 0; i < len; ++i) {
+        if (special[i]) {
+          frac_t f = scalar_op((frac_t){a.x[i], a.y[i], a.s[i]}, (frac_t){b.x[i], b.y[i], b.s[i]});
+
+          rx[i] = f.x;
+          ry[i] = f.y;
+          rs[i] = f.s;
+        }
+      }
     }
-  } 
+
+    memcpy(r.x + start, rx, len * sizeof(*rx));
+    memcpy(r.y + start, ry, len * sizeof(*ry));
+    memcpy(r.s + start, rs, len * sizeof(*rs));
+  }
+}
+
+/**
+ * @brief Adds two arrays of fractions element by element, every result is
+ * the same as the one returned by `fadd`. r[i] = f1[i] + f2[i].
+ * The finite fractions skip the checks for nans and infinities, which
+ * are fixed in a separate pass. `r` may be the same as `f1` or `f2`.
+ * 
+ * @param r destination structure of arrays.
+ * @param f1 first structure of arrays.
+ * @param f2 second structure of arrays.
+ * @param n number of fractions in every array.
+ */
+void fadd_n(frac_soa_t r, frac_soa_t f1, frac_soa_t f2, size_t n) {
+  frac_block_op(r, f1, f2, n, &fadd_finite, &fadd);
+}
+
+/**
+ * @brief Multiplies two arrays of fractions element by element, every result
+ * is the same as the one returned by `fmul`. r[i] = f1[i] * f2[i].
+ * The finite fractions skip the checks for nans and infinities, which
+ * are fixed in a separate pass. `r` may be the same as `f1` or `f2`.
+ * 
+ * @param r destination structure of arrays.
+ * @param f1 first structure of arrays.
+ * @param f2 second structure of arrays.
+ * @param n number of fractions in every array.
+ */
+void fmul_n(frac_soa_t r, frac_soa_t f1, frac_soa_t f2, size_t n) {
+  frac_block_op(r, f1, f2, n, &fmul_finite, &fmul);
+}
+
+/**
+ * @brief Computes the exact sum of an array of fractions with an accumulator,
+ * the partial sums are kept on 64 bits, so only the final result has to fit
+ * in a fraction.
+ * f = f[0] + f[1] + ... + f[n - 1].
+ * 
+ * @param f structure of arrays to sum.
+ * @param n number of fractions.
+ * @return frac_t the irreductible sum, an infinity if the array contains
+ * infinities of only one sign, nan if it contains a nan, both infinities or
+ * the sum does not fit in a fraction.
+ */
+frac_t fsum(frac_soa_t f, size_t n) {
+  size_t nan_count = 0, pinf_count = 0, minf_count = 0;
+
+  for (size_t i = 0; i < n; ++i) {
+    uint32_t inf = (f.y[i] == 0);
+
+    nan_count += ((f.x[i] == UINT32_MAX) & (f.y[i] == UINT32_MAX)) | (f.s[i] == nans);
+    pinf_count += inf & (f.s[i] == plus);
+    minf_count += inf & (f.s[i] == mins);
+  }
+
+  if ((nan_count != 0) || ((pinf_count != 0) && (minf_count != 0))) {
+    return nan_frac;
+  } else if (pinf_count != 0) {
+    return pinf_frac;
+  } else if (minf_count != 0) {
+    return minf_frac;
+  }
+
+  frac_acc_t acc;
+  frac_acc_init(&acc);
+
+  for (size_t i = 0; (i < n) && (acc.s != nans); ++i) {
+    frac_acc_add_finite(&acc, f.x[i], f.y[i], f.s[i]);
+  }
+
+  return frac_acc_get(&acc);
 }
+
+/**
+ * @brief Computes the exact dot product of two arrays of fractions with an
+ * accumulator, the partial sums are kept on 64 bits, so only the final result
+ * has to fit in a fraction. f = f1[0] * f2[0] + ... + f1[n - 1] * f2[n - 1].
+ * 
+ * @param f1 first structure of arrays.
+ * @param f2 second structure of arrays.
+ * @param n number of fractions in every array.
+ * @return frac_t the irreductible dot product, following the rules of `fmul`
+ * and `fadd` for nans and infinities, or nan if the result does not fit in
+ * a fraction.
+ */
+frac_t fdot(frac_soa_t f1, frac_soa_t f2, size_t n) {
+  uint32_t specials = 0;
+
+  for (size_t i = 0; i < n; ++i) {
+    specials |= is_special(f1.x[i], f1.y[i], f1.s[i]) |
+                is_special(f2.x[i], f2.y[i], f2.s[i]);
+  }
+
+  if (specials != 0) {
+    fbool_t has_pinf = ffalse, has_minf = ffalse;
+
+    for (size_t i = 0; i < n; ++i) {
+      if (is_special(f1.x[i], f1.y[i], f1.s[i]) | is_special(f2.x[i], f2.y[i], f2.s[i])) {
+        frac_t f = fmul((frac_t){f1.x[i], f1.y[i], f1.s[i]}, (frac_t){f2.x[i], f2.y[i], f2.s[i]});
+
+        if (is_fnan(f)) {
+          return nan_frac;
+        }
+
+        has_pinf |= is_fpinf(f);
+        has_minf |= is_fminf(f);
+      }
+    }
+
+    if (has_pinf && has_minf) {
+      return nan_frac;
+    }
+
+    return has_pinf ? pinf_frac : minf_frac;
+  }
+
+  frac_acc_t acc;
+  frac_acc_init(&acc);
+
+  for (size_t i = 0; (i < n) && (acc.s != nans); ++i) {
+    uint64_t x = (uint64_t)f1.x[i] * f2.x[i];
+    uint64_t y = (uint64_t)f1.y[i] * f2.y[i];
+
+    frac_acc_add_finite(&acc, x, y, (f1.s[i] == f2.s[i]) ? plus : mins);
+  }
+
+  return frac_acc_get(&acc);
+}
+
+
+#if defined(__SIZEOF_INT128__)
+
+/**
+ * @brief Unsigned 128 bits integer used for the products of the 64 bits
+ * fractions, `__extension__` keeps -Wpedantic quiet about the type.
+ * 
+ */
+__extension__ typedef unsigned __int128 uint128_t;
+
+/**
+ * @brief Converts a fraction to a 64 bits fraction, the conversion is exact.
+ * 
+ * @param f fraction structure.
+ * @return frac64_t the same fraction on 64 bits.
+ */
+frac64_t fwiden(frac_t f) {
+  if (is_fnan(f)) {
+    return nan_frac64;
+  }
+
+  return (frac64_t){f.x, f.y, f.s};
+}
+
+/**
+ * @brief Converts a 64 bits fraction to a fraction.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return frac_t the same fraction, or nan if it does not fit on 32 bits.
+ */
+frac_t fnarrow(frac64_t f) {
+  if (is_fnan64(f) || (f.x > UINT32_MAX) || (f.y > UINT32_MAX)) {
+    return nan_frac;
+  }
+
+  return (frac_t){(uint32_t)f.x, (uint32_t)f.y, f.s};
+}
+
+/**
+ * @brief Checks wheter a 64 bits fraction is not a number or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if fraction is not a number, ffalse otherwise.
+ */
+fbool_t is_fnan64(frac64_t f) {return ((f.x == UINT64_MAX) && (f.y == UINT64_MAX)) || (f.s == nans);}
+
+/**
+ * @brief Checks wheter a 64 bits fraction is infinity fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is infinity fraction, ffalse otherwise.
+ */
+fbool_t is_finf64(frac64_t f) {return f.y == 0;}
+
+/**
+ * @brief Checks wheter a 64 bits fraction is positive infinity fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is positive infinity fraction, ffalse otherwise.
+ */
+fbool_t is_fpinf64(frac64_t f) {return ((f.y == 0) && (f.s == plus));}
+
+/**
+ * @brief Checks wheter a 64 bits fraction is negative infinity fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is negative infinity fraction, ffalse otherwise.
+ */
+fbool_t is_fminf64(frac64_t f) {return ((f.y == 0) && (f.s == mins));}
+
+/**
+ * @brief Checks if the 64 bits fraction is positive or negative.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if fraction is positive, ffalse otherwise.
+ */
+fbool_t is_fpositive64(frac64_t f) { return f.s == plus; }
+
+/**
+ * @brief Checks wheter a 64 bits fraction is a zero fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is a zero fraction, ffalse otherwise.
+ */
+fbool_t is_fzero64(frac64_t f) { return (f.x == 0); }
+
+/**
+ * @brief Checks wheter a 64 bits fraction is an identity fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is an identity fraction, ffalse otherwise.
+ */
+fbool_t is_fid64(frac64_t f) { return (f.x == 1) && (f.y == 1) && (f.s == plus);}
+
+/**
+ * @brief Takes a 64 bits fraction and computes the string representation.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return const char* the string representation of the fraction.
+ */
+const char* frac64_out(frac64_t f) {
+  static char buffer[FRAC64_FORMAT_SIZE];
+
+  frac64_format(f, buffer, sizeof(buffer));
+
+  return buffer;
+}
+
+/**
+ * @brief Writes the string representation of a 64 bits fraction into a
+ * buffer owned by the caller, as `frac_format`.
+ * 
+ * @param f 64 bits fraction structure.
+ * @param buf destination buffer.
+ * @param len size of the buffer, `FRAC64_FORMAT_SIZE` is enough for every fraction.
+ * @return size_t the number of characters written without the null
+ * terminator, or 0 if the buffer is too small.
+ */
+size_t frac64_format(frac64_t f, char *buf, size_t len) {
+  return fformat(f.x, f.y, f.s, is_fnan64(f), buf, len);
+}
+
+/**
+ * @brief Reads a 64 bits fraction, as `frac_parse`.
+ * 
+ * @param str string to read, it does not have to be null terminated.
+ * @param len number of characters that can be read.
+ * @param f pointer where to store the fraction.
+ * @return size_t the number of characters read, 0 if the text does not start
+ * with a fraction or the numbers do not fit on 64 bits.
+ */
+size_t frac64_parse(const char *str, size_t len, frac64_t *f) {
+  uint64_t x = 0, y = 0;
+  sign_t s = plus;
+  size_t read = fparse(str, len, UINT64_MAX, &x, &y, &s);
+
+  if (read != 0) {
+    *f = (s == nans) ? nan_frac64 : fxy64(x, y, s);
+  }
+
+  return read;
+}
+
+/**
+ * @brief Evaluates the 64 bits fraction structure to a double value.
+ * 
+ * @param f 64 bits fraction structure to valuate.
+ * @return double the real value of the fraction.
+ */
+double feval64(frac64_t f) {
+  if (is_fnan64(f) || is_fminf64(f)) {
+    return DBL_MIN;
+  }
+
+  if (is_fpinf64(f)) {
+    return DBL_MAX;
+  }
+
+  if (is_fzero64(f)) {
+    return 0.0f;
+  }
+
+  return 1.0 * eval_sign(f.s) * f.x / f.y;
+}
+
+/**
+ * @brief 64 bits fraction constructor, follows the same rules as `fxy`.
+ * 
+ * @param x numerator.
+ * @param y denominator.
+ * @param s sign.
+ * @return frac64_t the irreductible 64 bits fraction.
+ */
+frac64_t fxy64(uint64_t x, uint64_t y, sign_t s) {
+  if (s == nans) {
+    return nan_frac64;
+  }
+
+  if (y == 0) {
+    if (s == plus) {
+      return pinf_frac64;
+    }
+
+    return minf_frac64;
+  }
+
+  if (x == 0) {
+    return zero_frac64;
+  }
+
+  uint64_t simplify = gcd64(x, y);
+
+  return (frac64_t){(x / simplify), (y / simplify), s};
+}
+
+/**
+ * @brief Builds a 64 bits fraction from 128 bits numerator and denominator
+ * that are already irreductible. MUST not be used outside this file.
+ * 
+ * @param x numerator.
+ * @param y denominator.
+ * @param s sign.
+ * @return frac64_t the fraction, or nan if it does not fit on 64 bits.
+ */
+static inline frac64_t fnarrow128(uint128_t x, uint128_t y, sign_t s) {
+  if ((x > UINT64_MAX) || (y > UINT64_MAX)) {
+    return nan_frac64;
+  }
+
+  if (x == 0) {
+    return zero_frac64;
+  }
+
+  return (frac64_t){(uint64_t)x, (uint64_t)y, s};
+}
+
+/**
+ * @brief Multiplies the 64 bits fraction with a constant, as `fmconst`.
+ * f = c * f1.
+ * 
+ * @param f1 first fraction.
+ * @param c constant value.
+ * @return frac64_t the product, or nan in case of errors or overflow.
+ */
+frac64_t fmconst64(frac64_t f1, int64_t c) {
+  if (is_fnan64(f1)) {
+    return nan_frac64;
+  }
+
+  if (is_fzero64(f1)) {
+    return zero_frac64;
+  }
+
+  sign_t s = (c < 0) ? (sign_t)((f1.s + 1) % 2) : f1.s;
+  uint64_t uc = (c < 0) ? -(uint64_t)c : (uint64_t)c;
+
+  if (uc == 0) {
+    if (is_finf64(f1)) {
+      return nan_frac64;
+    }
+
+    return zero_frac64;
+  }
+
+  if (is_finf64(f1)) {
+    return (frac64_t){f1.x, f1.y, s};
+  }
+
+  uint64_t simplify = gcd64(uc, f1.y);
+
+  return fnarrow128((uint128_t)(uc / simplify) * f1.x, f1.y / simplify, s);
+}
+
+/**
+ * @brief Divides the 64 bits fraction with a constant, as `fdconst`.
+ * f = f1 / c.
+ * 
+ * @param f1 first fraction.
+ * @param c constant value.
+ * @return frac64_t the division, or nan in case of errors or overflow.
+ */
+frac64_t fdconst64(frac64_t f1, int64_t c) {
+  if (is_fnan64(f1)) {
+    return nan_frac64;
+  }
+
+  sign_t s = (c < 0) ? (sign_t)((f1.s + 1) % 2) : f1.s;
+  uint64_t uc = (c < 0) ? -(uint64_t)c : (uint64_t)c;
+
+  if (uc == 0) {
+    if (is_fzero64(f1)) {
+      return nan_frac64;
+    } else if (is_fpositive64(f1)) {
+      return pinf_frac64;
+    } else {
+      return minf_frac64;
+    }
+  }
+
+  if (is_fzero64(f1)) {
+    return zero_frac64;
+  }
+
+  if (is_finf64(f1)) {
+    return (frac64_t){f1.x, f1.y, s};
+  }
+
+  uint64_t simplify = gcd64(uc, f1.x);
+
+  return fnarrow128(f1.x / simplify, (uint128_t)(uc / simplify) * f1.y, s);
+}
+
+/**
+ * @brief Adds two finite 64 bits fractions with 128 bits cross products,
+ * as `fadd_finite`. MUST not be used outside this file.
+ * 
+ * @param f1 first finite fraction.
+ * @param f2 second finite fraction.
+ * @return frac64_t the irreductible sum, or nan if it does not fit on 64 bits.
+ */
+static inline frac64_t fadd64_finite(frac64_t f1, frac64_t f2) {
+  uint64_t common = gcd64(f1.y, f2.y);
+  uint64_t amplify_f1 = f2.y;
+  uint64_t amplify_f2 = f1.y;
+
+  if (common != 1) {
+    amplify_f1 /= common;
+    amplify_f2 /= common;
+  }
+
+  uint128_t x1 = (uint128_t)f1.x * amplify_f1;
+  uint128_t x2 = (uint128_t)f2.x * amplify_f2;
+  uint128_t x = 0;
+
+  sign_t s = f1.s;
+  if (f1.s == f2.s) {
+    x = x1 + x2;
+
+    if (x < x1) {
+      return nan_frac64;
+    }
+  } else if (x1 >= x2) {
+    x = x1 - x2;
+  } else {
+    x = x2 - x1;
+    s = f2.s;
+  }
+
+  if (x == 0) {
+    return zero_frac64;
+  }
+
+  uint128_t y = (uint128_t)amplify_f2 * f2.y;
+
+  if (common != 1) {
+    uint64_t simplify = gcd64((uint64_t)(x % common), common);
+
+    if (simplify != 1) {
+      x /= simplify;
+      y = (uint128_t)amplify_f2 * (f2.y / simplify);
+    }
+  }
+
+  return fnarrow128(x, y, s);
+}
+
+/**
+ * @brief Multiplies two finite 64 bits fractions with 128 bits products,
+ * as `fmul_finite`. MUST not be used outside this file.
+ * 
+ * @param f1 first finite fraction.
+ * @param f2 second finite fraction.
+ * @return frac64_t the irreductible product, or nan if it does not fit on 64 bits.
+ */
+static inline frac64_t fmul64_finite(frac64_t f1, frac64_t f2) {
+  uint64_t g1 = gcd64(f1.x, f2.y);
+  uint64_t g2 = gcd64(f2.x, f1.y);
+
+  if (g1 != 1) {
+    f1.x /= g1;
+    f2.y /= g1;
+  }
+
+  if (g2 != 1) {
+    f2.x /= g2;
+    f1.y /= g2;
+  }
+
+  return fnarrow128((uint128_t)f1.x * f2.x, (uint128_t)f1.y * f2.y,
+                    (f1.s == f2.s) ? plus : mins);
+}
+
+/**
+ * @brief Adds two 64 bits fractions, as `fadd`. f = f1 + f2.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return frac64_t the irreductible sum, or nan if it does not fit on 64 bits.
+ */
+frac64_t fadd64(frac64_t f1, frac64_t f2) {
+  if (is_fnan64(f1) || is_fnan64(f2)) {
+    return nan_frac64;
+  }
+
+  if (is_finf64(f1) || is_finf64(f2)) {
+    if ((is_fpinf64(f1) && is_fminf64(f2)) || (is_fminf64(f1) && is_fpinf64(f2))) {
+      return nan_frac64;
+    } else if (is_fpinf64(f1) || is_fpinf64(f2)) {
+      return pinf_frac64;
+    } else {
+      return minf_frac64;
+    }
+  }
+
+  if (is_fzero64(f1)) {
+    return f2;
+  }
+
+  if (is_fzero64(f2)) {
+    return f1;
+  }
+
+  return fadd64_finite(f1, f2);
+}
+
+/**
+ * @brief Subtracts two 64 bits fractions, as `fsub`. f = f1 - f2.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return frac64_t the irreductible difference, or nan if it does not fit on 64 bits.
+ */
+frac64_t fsub64(frac64_t f1, frac64_t f2) {
+  if (is_fnan64(f1) || is_fnan64(f2)) {
+    return nan_frac64;
+  }
+
+  f2.s = (f2.s + 1) % 2;
+
+  return fadd64(f1, f2);
+}
+
+/**
+ * @brief Multiplies two 64 bits fractions, as `fmul`. f = f1 * f2.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return frac64_t the irreductible product, or nan if it does not fit on 64 bits.
+ */
+frac64_t fmul64(frac64_t f1, frac64_t f2) {
+  if (is_fnan64(f1) || is_fnan64(f2)) {
+    return nan_frac64;
+  }
+
+  if (is_finf64(f1) || is_finf64(f2)) {
+    if (is_fzero64(f1) || is_fzero64(f2)) {
+      return nan_frac64;
+    }
+
+    return (f1.s == f2.s) ? pinf_frac64 : minf_frac64;
+  }
+
+  if (is_fzero64(f1) || is_fzero64(f2)) {
+    return zero_frac64;
+  }
+
+  if (is_fid64(f1)) {
+    return f2;
+  }
+
+  if (is_fid64(f2)) {
+    return f1;
+  }
+
+  return fmul64_finite(f1, f2);
+}
+
+/**
+ * @brief Divides two 64 bits fractions, as `fdiv`. f = f1 / f2.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return frac64_t the irreductible division, or nan if it does not fit on 64 bits.
+ */
+frac64_t fdiv64(frac64_t f1, frac64_t f2) {
+  if (is_fnan64(f1) || is_fnan64(f2)) {
+    return nan_frac64;
+  }
+
+  if (is_finf64(f1) && is_finf64(f2)) {
+    return nan_frac64;
+  } else if (is_finf64(f1)) {
+    return (frac64_t){f1.x, f1.y, is_fpositive64(f2) ? f1.s : (sign_t)((f1.s + 1) % 2)};
+  } else if (is_finf64(f2)) {
+    return zero_frac64;
+  }
+
+  if (is_fzero64(f1) && is_fzero64(f2)) {
+    return nan_frac64;
+  } else if (is_fzero64(f2)) {
+    if (is_fpositive64(f1)) {
+      return pinf_frac64;
+    }
+
+    return minf_frac64;
+  } else if (is_fzero64(f1)) {
+    return zero_frac64;
+  }
+
+  uint64_t temp = f2.x;
+  f2.x = f2.y;
+  f2.y = temp;
+
+  if (is_fid64(f1)) {
+    return f2;
+  }
+
+  if (is_fid64(f2)) {
+    return f1;
+  }
+
+  return fmul64_finite(f1, f2);
+}
+
+/**
+ * @brief Multiplies the 64 bits fraction with a constant in place. f1 *= c.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param c constant value.
+ */
+void fmconstp64(frac64_t *f1, int64_t c) {
+  *f1 = fmconst64(*f1, c);
+}
+
+/**
+ * @brief Divides the 64 bits fraction with a constant in place. f1 /= c.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param c constant value.
+ */
+void fdconstp64(frac64_t *f1, int64_t c) {
+  *f1 = fdconst64(*f1, c);
+}
+
+/**
+ * @brief Adds two 64 bits fractions in place. f1 += f2.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param f2 second fraction.
+ */
+void faddp64(frac64_t *f1, frac64_t f2) {
+  *f1 = fadd64(*f1, f2);
+}
+
+/**
+ * @brief Subtracts two 64 bits fractions in place. f1 -= f2.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param f2 second fraction.
+ */
+void fsubp64(frac64_t *f1, frac64_t f2) {
+  *f1 = fsub64(*f1, f2);
+}
+
+/**
+ * @brief Multiplies two 64 bits fractions in place. f1 *= f2.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param f2 second fraction.
+ */
+void fmulp64(frac64_t *f1, frac64_t f2) {
+  *f1 = fmul64(*f1, f2);
+}
+
+/**
+ * @brief Divides two 64 bits fractions in place. f1 /= f2.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param f2 second fraction.
+ */
+void fdivp64(frac64_t *f1, frac64_t f2) {
+  *f1 = fdiv64(*f1, f2);
+}
+
+/**
+ * @brief Compares two 64 bits fractions, with one 128 bits cross product
+ * for finite fractions. The `nan` and the equal `infinities` are not
+ * comparable. MUST not be used outside this file.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @param cmp pointer where to store -1, 0 or 1 as f1 <, ==, > f2.
+ * @return fbool_t ftrue if the fractions are comparable, funknown otherwise.
+ */
+static fbool_t fcmp64(frac64_t f1, frac64_t f2, int32_t *cmp) {
+  if (is_fnan64(f1) || is_fnan64(f2)) {
+    return funknown;
+  }
+
+  if (is_finf64(f1) || is_finf64(f2)) {
+    if ((is_fpinf64(f1) && is_fpinf64(f2)) || (is_fminf64(f1) && is_fminf64(f2))) {
+      return funknown;
+    }
+
+    *cmp = (is_fpinf64(f1) || is_fminf64(f2)) ? 1 : -1;
+    return ftrue;
+  }
+
+  if ((f1.s != f2.s) && ((f1.x | f2.x) != 0)) {
+    *cmp = (f1.s == plus) ? 1 : -1;
+    return ftrue;
+  }
+
+  uint128_t x1 = (uint128_t)f1.x * f2.y;
+  uint128_t x2 = (uint128_t)f2.x * f1.y;
+
+  *cmp = (x1 > x2) - (x1 < x2);
+
+  if (f1.s == mins) {
+    *cmp = -*cmp;
+  }
+
+  return ftrue;
+}
+
+/**
+ * @brief Compares two 64 bits fractions with a total order, as `compare_frac`.
+ * 
+ * @param data1 pointer to the first fraction.
+ * @param data2 pointer to the second fraction.
+ * @return int32_t -1, 0 or 1 as the first fraction is less than, equal to
+ * or greater than the second.
+ */
+int32_t compare_frac64(const void * const data1, const void * const data2) {
+  frac64_t f1 = *(const frac64_t *)data1;
+  frac64_t f2 = *(const frac64_t *)data2;
+  int32_t cmp = 0;
+
+  if (fcmp64(f1, f2, &cmp) == funknown) {
+    return (int32_t)is_fnan64(f1) - (int32_t)is_fnan64(f2);
+  }
+
+  return cmp;
+}
+
+/**
+ * @brief Checks if two 64 bits fractions are equal, as `feq`. f1 == f2
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return fbool_t ftrue if the fractions are equal, ffalse otherwise,
+ * funknown for indeterminate states.
+ */
+fbool_t feq64(frac64_t f1, frac64_t f2) {
+  int32_t cmp = 0;
+
+  if (fcmp64(f1, f2, &cmp) == funknown) {
+    return funknown;
+  }
+
+  return cmp == 0;
+}
+
+/**
+ * @brief Checks if two 64 bits fractions are not equal, as `fneq`. f1 != f2
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return fbool_t ftrue if the fractions are not equal, ffalse otherwise,
+ * funknown for indeterminate states.
+ */
+fbool_t fneq64(frac64_t f1, frac64_t f2) {
+  int32_t cmp = 0;
+
+  if (fcmp64(f1, f2, &cmp) == funknown) {
+    return funknown;
+  }
+
+  return cmp != 0;
+}
+
+/**
+ * @brief Compares two 64 bits fractions with the "greater than" operation,
+ * as `fgt`. f1 > f2
+ * 
+ * @param f1 first fraction
+ * @param f2 second fraction
+ * @return fbool_t ftrue if the first fraction is greater than second,
+ * ffalse otherwise, funknown for indeterminate states.
+ */
+fbool_t fgt64(frac64_t f1, frac64_t f2) {
+  int32_t cmp = 0;
+
+  if (fcmp64(f1, f2, &cmp) == funknown) {
+    return funknown;
+  }
+
+  return cmp > 0;
+}
+
+/**
+ * @brief Compares two 64 bits fractions with the "less than" operation,
+ * as `flt`. f1 < f2
+ * 
+ * @param f1 first fraction
+ * @param f2 second fraction
+ * @return fbool_t ftrue if the first fraction is less than second,
+ * ffalse otherwise, funknown for indeterminate states.
+ */
+fbool_t flt64(frac64_t f1, frac64_t f2) {
+  int32_t cmp = 0;
+
+  if (fcmp64(f1, f2, &cmp) == funknown) {
+    return funknown;
+  }
+
+  return cmp < 0;
+}
+
+/**
+ * @brief Compares two 64 bits fractions with the "greater than or equal to"
+ * operation, as `fgte`. f1 >= f2
+ * 
+ * @param f1 first fraction
+ * @param f2 second fraction
+ * @return fbool_t ftrue if the first fraction is greater than or equal to
+ * second, ffalse otherwise, funknown for indeterminate states.
+ */
+fbool_t fgte64(frac64_t f1, frac64_t f2) {
+  int32_t cmp = 0;
+
+  if (fcmp64(f1, f2, &cmp) == funknown) {
+    return funknown;
+  }
+
+  return cmp >= 0;
+}
+
+/**
+ * @brief Compares two 64 bits fractions with the "less than or equal to"
+ * operation, as `flte`. f1 <= f2
+ * 
+ * @param f1 first fraction
+ * @param f2 second fraction
+ * @return fbool_t ftrue if the first fraction is less than or equal to
+ * second, ffalse otherwise, funknown for indeterminate states.
+ */
+fbool_t flte64(frac64_t f1, frac64_t f2) {
+  int32_t cmp = 0;
+
+  if (fcmp64(f1, f2, &cmp) == funknown) {
+    return funknown;
+  }
+
+  return cmp <= 0;
+}
+
+#endif /* __SIZEOF_INT128__ */
+
+#if defined(__SIZEOF_INT128__)
+
+/**
+ * @brief Signed 128 bits integer used by the matrix elimination.
+ * 
+ */
+__extension__ typedef __int128 int128_t;
+
+/**
+ * @brief Allocates a matrix without filling it, the structure and the three
+ * arrays live in one block. MUST not be used outside this file.
+ * 
+ * @param rows number of rows.
+ * @param cols number of columns.
+ * @return frac_mat_t* the new matrix, or NULL if the sizes are zero, too big
+ * or the allocation failed.
+ */
+static frac_mat_t* frac_mat_alloc(size_t rows, size_t cols) {
+  const size_t fsize = 2 * sizeof(uint32_t) + sizeof(sign_t);
+
+  if ((rows == 0) || (cols == 0) || (rows > SIZE_MAX / cols) ||
+      (rows * cols > (SIZE_MAX - sizeof(frac_mat_t)) / fsize)) {
+    return NULL;
+  }
+
+  size_t count = rows * cols;
+  frac_mat_t *m = malloc(sizeof(*m) + count * fsize);
+
+  if (m == NULL) {
+    return NULL;
+  }
+
+  m->rows = rows;
+  m->cols = cols;
+  m->data.x = (uint32_t *)(m + 1);
+  m->data.y = m->data.x + count;
+  m->data.s = (sign_t *)(m->data.y + count);
+
+  return m;
+}
+
+/**
+ * @brief Gets the structure of arrays view over a row of a matrix.
+ * MUST not be used outside this file.
+ * 
+ * @param m matrix of fractions.
+ * @param i row index.
+ * @return frac_soa_t the `m->cols` fractions of the row.
+ */
+static inline frac_soa_t frac_mat_row(const frac_mat_t *m, size_t i) {
+  size_t offset = i * m->cols;
+
+  return (frac_soa_t){ m->data.x + offset, m->data.y + offset, m->data.s + offset };
+}
+
+/**
+ * @brief Allocates a matrix of fractions filled with zero fractions.
+ * 
+ * @param rows number of rows, greater than zero.
+ * @param cols number of columns, greater than zero.
+ * @return frac_mat_t* the new matrix, or NULL if the sizes are zero or
+ * the allocation failed.
+ */
+frac_mat_t* frac_mat_create(size_t rows, size_t cols) {
+  frac_mat_t *m = frac_mat_alloc(rows, cols);
+
+  if (m == NULL) {
+    return NULL;
+  }
+
+  for (size_t i = 0; i < rows * cols; ++i) {
+    m->data.x[i] = 0;
+    m->data.y[i] = 1;
+    m->data.s[i] = plus;
+  }
+
+  return m;
+}
+
+/**
+ * @brief Allocates a square identity matrix of fractions.
+ * 
+ * @param n number of rows and columns, greater than zero.
+ * @return frac_mat_t* the new matrix, or NULL if the size is zero or
+ * the allocation failed.
+ */
+frac_mat_t* frac_mat_identity(size_t n) {
+  frac_mat_t *m = frac_mat_create(n, n);
+
+  if (m == NULL) {
+    return NULL;
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    m->data.x[i * n + i] = 1;
+  }
+
+  return m;
+}
+
+/**
+ * @brief Frees a matrix allocated by the matrix functions.
+ * 
+ * @param m matrix to free, may be NULL.
+ */
+void frac_mat_free(frac_mat_t *m) {
+  free(m);
+}
+
+/**
+ * @brief Reads a fraction of a matrix, the indexes are not checked.
+ * 
+ * @param m matrix of fractions.
+ * @param i row index.
+ * @param j column index.
+ * @return frac_t the fraction at row i and column j.
+ */
+frac_t frac_mat_get(const frac_mat_t *m, size_t i, size_t j) {
+  size_t index = i * m->cols + j;
+
+  return (frac_t){ m->data.x[index], m->data.y[index], m->data.s[index] };
+}
+
+/**
+ * @brief Writes a fraction of a matrix, the indexes are not checked.
+ * 
+ * @param m matrix of fractions.
+ * @param i row index.
+ * @param j column index.
+ * @param f fraction to write.
+ */
+void frac_mat_set(frac_mat_t *m, size_t i, size_t j, frac_t f) {
+  size_t index = i * m->cols + j;
+
+  m->data.x[index] = f.x;
+  m->data.y[index] = f.y;
+  m->data.s[index] = f.s;
+}
+
+/**
+ * @brief Multiplies a matrix by a vector with one `fdot` for every row.
+ * r = m * v.
+ * 
+ * @param m matrix of fractions.
+ * @param v vector with `m->cols` fractions.
+ * @param r destination vector with room for `m->rows` fractions.
+ * @return fbool_t ftrue if the product was computed, ffalse if an
+ * allocation failed.
+ */
+fbool_t frac_mat_mulv(const frac_mat_t *m, const frac_t *v, frac_t *r) {
+  if ((m == NULL) || (v == NULL) || (r == NULL)) {
+    return ffalse;
+  }
+
+  frac_mat_t *vector = frac_mat_alloc(1, m->cols);
+
+  if (vector == NULL) {
+    return ffalse;
+  }
+
+  frac_soa_load(vector->data, v, m->cols);
+
+  for (size_t i = 0; i < m->rows; ++i) {
+    r[i] = fdot(frac_mat_row(m, i), vector->data, m->cols);
+  }
+
+  frac_mat_free(vector);
+
+  return ftrue;
+}
+
+/**
+ * @brief Multiplies two matrices, the second one is transposed once so that
+ * every element of the result is one `fdot` over two contiguous rows.
+ * r = m1 * m2.
+ * 
+ * @param m1 first matrix.
+ * @param m2 second matrix, with `m1->cols` rows.
+ * @return frac_mat_t* the new product matrix, or NULL if the sizes do not
+ * match or an allocation failed.
+ */
+frac_mat_t* frac_mat_mul(const frac_mat_t *m1, const frac_mat_t *m2) {
+  if ((m1 == NULL) || (m2 == NULL) || (m1->cols != m2->rows)) {
+    return NULL;
+  }
+
+  frac_mat_t *transposed = frac_mat_alloc(m2->cols, m2->rows);
+  frac_mat_t *r = frac_mat_alloc(m1->rows, m2->cols);
+
+  if ((transposed == NULL) || (r == NULL)) {
+    frac_mat_free(transposed);
+    frac_mat_free(r);
+    return NULL;
+  }
+
+  for (size_t i = 0; i < m2->rows; ++i) {
+    for (size_t j = 0; j < m2->cols; ++j) {
+      frac_mat_set(transposed, j, i, frac_mat_get(m2, i, j));
+    }
+  }
+
+  for (size_t i = 0; i < m1->rows; ++i) {
+    frac_soa_t row = frac_mat_row(m1, i);
+
+    for (size_t j = 0; j < m2->cols; ++j) {
+      frac_mat_set(r, i, j, fdot(row, frac_mat_row(transposed, j), m1->cols));
+    }
+  }
+
+  frac_mat_free(transposed);
+
+  return r;
+}
+
+/**
+ * @brief Converts a finite fraction to an integer scaled by a multiple of
+ * its denominator. MUST not be used outside this file.
+ * 
+ * @param x numerator.
+ * @param y denominator, divides `scale`.
+ * @param s sign.
+ * @param scale multiple of the denominator.
+ * @param v pointer where to store x * scale / y with the sign.
+ * @return fbool_t ftrue if the integer fits on 64 bits, ffalse otherwise.
+ */
+static inline fbool_t fmat_scaled(uint32_t x, uint32_t y, sign_t s, uint64_t scale, int64_t *v) {
+  uint128_t value = (uint128_t)x * (scale / y);
+
+  if (value > INT64_MAX) {
+    return ffalse;
+  }
+
+  *v = (s == mins) ? -(int64_t)value : (int64_t)value;
+
+  return ftrue;
+}
+
+/**
+ * @brief Computes the least common multiple of a scale and a denominator.
+ * MUST not be used outside this file.
+ * 
+ * @param scale pointer to the current scale, updated with the lcm.
+ * @param y denominator.
+ * @return fbool_t ftrue if the lcm fits on 63 bits, ffalse otherwise.
+ */
+static inline fbool_t fmat_lcm(uint64_t *scale, uint32_t y) {
+  if ((y == 1) || (y == *scale)) {
+    return ftrue;
+  }
+
+  uint128_t lcm = (uint128_t)(*scale / gcd64(*scale, y)) * y;
+
+  if (lcm > INT64_MAX) {
+    return ffalse;
+  }
+
+  *scale = (uint64_t)lcm;
+
+  return ftrue;
+}
+
+/**
+ * @brief Computes the inverse of an odd number modulo 2^64 with the Newton
+ * iteration, every step doubles the number of correct low bits.
+ * MUST not be used outside this file.
+ * 
+ * @param d odd number.
+ * @return uint64_t the number x such that d * x = 1 modulo 2^64.
+ */
+static inline uint64_t finverse64(uint64_t d) {
+  uint64_t x = d;
+
+  for (int i = 0; i < 5; ++i) {
+    x *= 2 - d * x;
+  }
+
+  return x;
+}
+
+/**
+ * @brief Copies a square matrix (and optionally a right hand side column)
+ * into a matrix of integers, every row is multiplied by the lcm of its
+ * denominators. MUST not be used outside this file.
+ * 
+ * @param m square matrix of fractions.
+ * @param b right hand side column, or NULL if there is none.
+ * @param w destination integers, with `wcols` integers per row.
+ * @param wcols number of integers per row.
+ * @param scales destination of the lcm of every row.
+ * @return fbool_t ftrue if the matrix was copied, funknown if it contains
+ * nans or infinities or an integer does not fit on 64 bits.
+ */
+static fbool_t fmat_load(const frac_mat_t *m, const frac_t *b, int64_t *w, size_t wcols, uint64_t *scales) {
+  size_t n = m->rows;
+
+  for (size_t i = 0; i < n; ++i) {
+    frac_soa_t row = frac_mat_row(m, i);
+    int64_t *wrow = w + i * wcols;
+    uint64_t scale = 1;
+
+    if ((b != NULL) && (is_special(b[i].x, b[i].y, b[i].s) || !fmat_lcm(&scale, b[i].y))) {
+      return funknown;
+    }
+
+    for (size_t j = 0; j < n; ++j) {
+      if (is_special(row.x[j], row.y[j], row.s[j]) || !fmat_lcm(&scale, row.y[j])) {
+        return funknown;
+      }
+    }
+
+    for (size_t j = 0; j < n; ++j) {
+      if (!fmat_scaled(row.x[j], row.y[j], row.s[j], scale, &wrow[j])) {
+        return funknown;
+      }
+    }
+
+    if ((b != NULL) && !fmat_scaled(b[i].x, b[i].y, b[i].s, scale, &wrow[n])) {
+      return funknown;
+    }
+
+    scales[i] = scale;
+  }
+
+  return ftrue;
+}
+
+/**
+ * @brief Runs the fraction free (Bareiss) elimination on a matrix of
+ * integers, every step is (pivot * a[i][j] - a[i][k] * a[k][j]) / previous
+ * pivot, the division is exact, so the integers stay minors of the matrix
+ * and the division is a multiplication by the inverse of the previous pivot
+ * modulo 2^64. When the dividend does not fit on 64 bits, the quotient is
+ * checked by multiplying it back.
+ * The forward elimination leaves the determinant in the last pivot, the
+ * Gauss-Jordan one also eliminates above the pivots and leaves the
+ * determinant times the solution in the columns after the first `n`.
+ * MUST not be used outside this file.
+ * 
+ * @param w matrix of integers, `n` rows of `wcols` integers.
+ * @param n number of rows, the first `n` columns are the square matrix.
+ * @param wcols number of integers per row.
+ * @param jordan ftrue to eliminate above the pivots too.
+ * @param pivot pointer where to store the last pivot, the determinant of
+ * the matrix with the rows swapped by the elimination.
+ * @param s pointer where to store `mins` if the rows were swapped an odd
+ * number of times, `plus` otherwise.
+ * @return fbool_t ftrue if the matrix is regular, ffalse if it is singular,
+ * funknown if an integer does not fit on 64 bits.
+ */
+static fbool_t fmat_bareiss(int64_t *w, size_t n, size_t wcols, fbool_t jordan, int64_t *pivot, sign_t *s) {
+  int64_t previous = 1;
+  *s = plus;
+
+  for (size_t k = 0; k < n; ++k) {
+    size_t row = k;
+
+    while ((row < n) && (w[row * wcols + k] == 0)) {
+      ++row;
+    }
+
+    if (row == n) {
+      return ffalse;
+    }
+
+    if (row != k) {
+      for (size_t j = k; j < wcols; ++j) {
+        int64_t temp = w[row * wcols + j];
+        w[row * wcols + j] = w[k * wcols + j];
+        w[k * wcols + j] = temp;
+      }
+
+      *s = (*s == plus) ? mins : plus;
+    }
+
+    const int64_t *row_k = w + k * wcols;
+    int64_t pk = row_k[k];
+    int shift = __builtin_ctzll((uint64_t)previous);
+    uint64_t inverse = finverse64((uint64_t)(previous >> shift));
+
+    for (size_t i = (jordan ? 0 : k + 1); i < n; ++i) {
+      if (i == k) {
+        continue;
+      }
+
+      int64_t *row_i = w + i * wcols;
+      int64_t ik = row_i[k];
+
+      if ((ik == 0) && (pk == previous)) {
+        continue;
+      }
+
+      for (size_t j = k + 1; j < wcols; ++j) {
+        int128_t value = (int128_t)pk * row_i[j] - (int128_t)ik * row_k[j];
+        int64_t quotient = (int64_t)((uint64_t)(value >> shift) * inverse);
+
+        if (((value < -(int128_t)INT64_MAX) || (value > INT64_MAX)) &&
+            ((quotient == INT64_MIN) || ((int128_t)quotient * previous != value))) {
+          return funknown;
+        }
+
+        row_i[j] = quotient;
+      }
+
+      row_i[k] = 0;
+    }
+
+    previous = pk;
+  }
+
+  *pivot = previous;
+
+  return ftrue;
+}
+
+/**
+ * @brief Runs the fraction free back substitution after the forward
+ * elimination, the column after the first `n` becomes the determinant times
+ * the solution, which are integers by the Cramer's rule, so every division
+ * is exact. MUST not be used outside this file.
+ * 
+ * @param w matrix of integers after `fmat_bareiss`, `n` rows of `wcols`
+ * integers.
+ * @param n number of rows, the first `n` columns are the square matrix.
+ * @param wcols number of integers per row, greater than `n`.
+ * @param det the last pivot of the elimination.
+ * @return fbool_t ftrue if the integers fit on 64 bits, funknown otherwise.
+ */
+static fbool_t fmat_back_substitute(int64_t *w, size_t n, size_t wcols, int64_t det) {
+  for (size_t i = n; i-- > 0;) {
+    int64_t *row = w + i * wcols;
+    int128_t value = (int128_t)det * row[n];
+
+    for (size_t j = i + 1; j < n; ++j) {
+      if (__builtin_sub_overflow(value, (int128_t)row[j] * w[j * wcols + n], &value)) {
+        return funknown;
+      }
+    }
+
+    value /= row[i];
+
+    if ((value < -(int128_t)INT64_MAX) || (value > INT64_MAX)) {
+      return funknown;
+    }
+
+    row[n] = (int64_t)value;
+  }
+
+  return ftrue;
+}
+
+/**
+ * @brief Converts the quotient of two integers to a fraction.
+ * MUST not be used outside this file.
+ * 
+ * @param a numerator.
+ * @param d denominator, not zero.
+ * @return frac_t the irreductible fraction, or nan if it does not fit.
+ */
+static inline frac_t fmat_quotient(int64_t a, int64_t d) {
+  uint64_t x = (a < 0) ? 0 - (uint64_t)a : (uint64_t)a;
+  uint64_t y = (d < 0) ? 0 - (uint64_t)d : (uint64_t)d;
+
+  return fnarrow(fxy64(x, y, ((a < 0) != (d < 0)) ? mins : plus));
+}
+
+/**
+ * @brief Computes the determinant of a square matrix with the fraction free
+ * (Bareiss) elimination. Every row is scaled to integers by the lcm of its
+ * denominators and the elimination works on 64 bits integers with 128 bits
+ * intermediates and exact divisions, so no gcd is computed before the final
+ * division by the scales.
+ * 
+ * @param m square matrix of finite fractions.
+ * @return frac_t the irreductible determinant, or nan if the matrix is not
+ * square, contains nans or infinities or an intermediate does not fit on
+ * 64 bits.
+ */
+frac_t frac_mat_det(const frac_mat_t *m) {
+  if ((m == NULL) || (m->rows != m->cols)) {
+    return nan_frac;
+  }
+
+  size_t n = m->rows;
+  int64_t *w = malloc(n * n * sizeof(*w) + n * sizeof(uint64_t));
+
+  if (w == NULL) {
+    return nan_frac;
+  }
+
+  uint64_t *scales = (uint64_t *)(w + n * n);
+  int64_t det = 0;
+  sign_t s = plus;
+  frac_t r = nan_frac;
+  fbool_t status = fmat_load(m, NULL, w, n, scales);
+
+  if (status == ftrue) {
+    status = fmat_bareiss(w, n, n, ffalse, &det, &s);
+  }
+
+  if (status == ffalse) {
+    r = zero_frac;
+  } else if (status == ftrue) {
+    frac64_t d = fxy64((det < 0) ? 0 - (uint64_t)det : (uint64_t)det, 1, ((det < 0) != (s == mins)) ? mins : plus);
+
+    for (size_t i = 0; i < n; ++i) {
+      d = fdiv64(d, fxy64(scales[i], 1, plus));
+    }
+
+    r = fnarrow(d);
+  }
+
+  free(w);
+
+  return r;
+}
+
+/**
+ * @brief Computes the inverse of a square matrix with the fraction free
+ * Gauss-Jordan (Bareiss) elimination of the scaled matrix next to the
+ * identity. An element that does not fit in a fraction is nan.
+ * 
+ * @param m square matrix of finite fractions.
+ * @return frac_mat_t* the new inverse matrix, or NULL if the matrix is not
+ * square, is singular, contains nans or infinities, an intermediate does
+ * not fit on 64 bits or an allocation failed.
+ */
+frac_mat_t* frac_mat_inverse(const frac_mat_t *m) {
+  if ((m == NULL) || (m->rows != m->cols)) {
+    return NULL;
+  }
+
+  size_t n = m->rows;
+  size_t wcols = 2 * n;
+  int64_t *w = malloc(n * wcols * sizeof(*w) + n * sizeof(uint64_t));
+
+  if (w == NULL) {
+    return NULL;
+  }
+
+  uint64_t *scales = (uint64_t *)(w + n * wcols);
+  int64_t det = 0;
+  sign_t s = plus;
+  frac_mat_t *r = NULL;
+  fbool_t status = fmat_load(m, NULL, w, wcols, scales);
+
+  if (status == ftrue) {
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        w[i * wcols + n + j] = (i == j) ? (int64_t)scales[i] : 0;
+      }
+    }
+
+    status = fmat_bareiss(w, n, wcols, ftrue, &det, &s);
+  }
+
+  if ((status == ftrue) && ((r = frac_mat_alloc(n, n)) != NULL)) {
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        frac_mat_set(r, i, j, fmat_quotient(w[i * wcols + n + j], det));
+      }
+    }
+  }
+
+  free(w);
+
+  return r;
+}
+
+/**
+ * @brief Solves the linear system m * x = b with the fraction free
+ * (Bareiss) elimination of the scaled matrix next to `b` and a fraction
+ * free back substitution, the back substitution computes the determinant
+ * times the solution, so it is divided by the determinant only at the end.
+ * 
+ * @param m square matrix of finite fractions.
+ * @param b vector with `m->rows` finite fractions.
+ * @param x destination vector with room for `m->cols` fractions.
+ * @return fbool_t ftrue if the system has a unique solution and every
+ * element fits in a fraction, ffalse if the matrix is singular or is not
+ * square, funknown if the system contains nans or infinities, an
+ * intermediate does not fit on 64 bits or an allocation failed.
+ */
+fbool_t frac_mat_solve(const frac_mat_t *m, const frac_t *b, frac_t *x) {
+  if ((m == NULL) || (b == NULL) || (x == NULL) || (m->rows != m->cols)) {
+    return ffalse;
+  }
+
+  size_t n = m->rows;
+  size_t wcols = n + 1;
+  int64_t *w = malloc(n * wcols * sizeof(*w) + n * sizeof(uint64_t));
+
+  if (w == NULL) {
+    return funknown;
+  }
+
+  uint64_t *scales = (uint64_t *)(w + n * wcols);
+  int64_t det = 0;
+  sign_t s = plus;
+  fbool_t status = fmat_load(m, b, w, wcols, scales);
+
+  if (status == ftrue) {
+    status = fmat_bareiss(w, n, wcols, ffalse, &det, &s);
+  }
+
+  if (status == ftrue) {
+    status = fmat_back_substitute(w, n, wcols, det);
+  }
+
+  if (status == ftrue) {
+    for (size_t i = 0; i < n; ++i) {
+      x[i] = fmat_quotient(w[i * wcols + n], det);
+
+      if (is_fnan(x[i])) {
+        status = funknown;
+      }
+    }
+  }
+
+  free(w);
+
+  return status;
+}
+
+#endif /* __SIZEOF_INT128__ */
@@ -69,6 +69,33 @@ typedef struct frac_s {
   sign_t    s;
 } frac_t;
 
+/**
+ * @brief Structure of arrays view over a collection of fractions, used by the
+ * array kernels (`fadd_n`, `fmul_n`, `fsum`, `fdot`). The i-th fraction is
+ * (x[i], y[i], s[i]), keeping the numerators, denominators and signs in three
+ * contiguous arrays lets the compiler vectorize the passes over them.
+ * The arrays are owned by the caller.
+ * 
+ */
+typedef struct frac_soa_s {
+  uint32_t  *x;
+  uint32_t  *y;
+  sign_t    *s;
+} frac_soa_t;
+
+/**
+ * @brief Accumulator for long sums and products of fractions. The numerator
+ * and denominator are kept on 64 bits and are not reduced after every
+ * operation, a gcd is computed only when the next operation would overflow
+ * and when the value is read with `frac_acc_get`. Nans and infinities follow
+ * the same rules as for `fadd` and `fmul`.
+ * 
+ */
+typedef struct frac_acc_s {
+  uint64_t  x;
+  uint64_t  y;
+  sign_t    s;
+} frac_acc_t;
 
 /**
  * @brief Basic fractions, the plus and minus infinity fraction which represent
@@ -83,6 +110,14 @@ typedef struct frac_s {
 #define     zero_frac     (frac_t) { 0, 1, plus }
 #define     id_frac       (frac_t) { 1, 1, plus }
 
+/**
+ * @brief Buffer sizes that fit the text of every fraction and of every
+ * 64 bits fraction, including the null terminator.
+ * 
+ */
+#define     FRAC_FORMAT_SIZE      24
+#define     FRAC64_FORMAT_SIZE    43
+
 
 /**
  * @brief Takes a fraction and computes the string representation.
@@ -92,6 +127,62 @@ typedef struct frac_s {
  */
 const char* frac_out(frac_t f);
 
+/**
+ * @brief Writes the string representation of a fraction, the same text as
+ * `frac_out`, into a buffer owned by the caller, so it can be used from many
+ * threads at once.
+ * 
+ * @param f fraction structure.
+ * @param buf destination buffer.
+ * @param len size of the buffer, `FRAC_FORMAT_SIZE` is enough for every fraction.
+ * @return size_t the number of characters written without the null
+ * terminator, or 0 if the buffer is too small.
+ */
+size_t      frac_format   (frac_t f, char *buf, size_t len);
+
+/**
+ * @brief Reads a fraction written as `frac_out` does ("-7/4", "3", "0",
+ * "inf", "-inf", "nans" or "nan"), the fraction is reduced with `fxy`,
+ * so "6/24" is read as 1/4 and "1/0" as infinity. The reading stops at
+ * the first character that is not part of the fraction.
+ * 
+ * @param str string to read, it does not have to be null terminated.
+ * @param len number of characters that can be read.
+ * @param f pointer where to store the fraction.
+ * @return size_t the number of characters read, 0 if the text does not start
+ * with a fraction or the numbers do not fit on 32 bits.
+ */
+size_t      frac_parse    (const char *str, size_t len, frac_t *f);
+
+/**
+ * @brief Writes the representations of an array of fractions separated by
+ * a character, as a line of a CSV file.
+ * 
+ * @param f array of fractions.
+ * @param n number of fractions.
+ * @param sep separator written between two fractions.
+ * @param buf destination buffer.
+ * @param len size of the buffer.
+ * @return size_t the number of characters written without the null
+ * terminator, or 0 if the buffer is too small.
+ */
+size_t      frac_format_n (const frac_t *f, size_t n, char sep, char *buf, size_t len);
+
+/**
+ * @brief Reads at most `n` fractions separated by a character, as a line
+ * of a CSV file. The reading stops at the first character that is neither
+ * part of a fraction nor a separator, or at the first malformed fraction.
+ * 
+ * @param str string to read, it does not have to be null terminated.
+ * @param len number of characters that can be read.
+ * @param sep separator between two fractions.
+ * @param f destination array with room for `n` fractions.
+ * @param n greatest number of fractions to read.
+ * @param end pointer where to store the number of characters read, may be NULL.
+ * @return size_t the number of fractions read.
+ */
+size_t      frac_parse_n  (const char *str, size_t len, char sep, frac_t *f, size_t n, size_t *end);
+
 
 /**
  * @brief Checks wheter a fraction is not a number or not.
@@ -395,4 +486,602 @@ fbool_t     fgte          (frac_t f1, frac_t f2);
  */
 fbool_t     flte          (frac_t f1, frac_t f2);
 
+/**
+ * @brief Compares two fractions with a total order, so that the fractions
+ * can be sorted or used as keys of the library's trees. The order is
+ * -inf < finite fractions < inf < nan, the infinities of the same sign are
+ * equal and all the nans are equal. The signature is the one of `compare_func`.
+ * 
+ * @param data1 pointer to the first fraction.
+ * @param data2 pointer to the second fraction.
+ * @return int32_t -1, 0 or 1 as the first fraction is less than, equal to
+ * or greater than the second.
+ */
+int32_t     compare_frac  (const void * const data1, const void * const data2);
+
+
+/**
+ * @brief Copies an array of fractions into a structure of arrays.
+ * r = f[0 .. n - 1].
+ * 
+ * @param r destination structure of arrays, with room for `n` fractions.
+ * @param f source array of fractions.
+ * @param n number of fractions to copy.
+ */
+void        frac_soa_load (frac_soa_t r, const frac_t *f, size_t n);
+
+/**
+ * @brief Copies a structure of arrays back into an array of fractions.
+ * f[0 .. n - 1] = a.
+ * 
+ * @param f destination array of fractions, with room for `n` fractions.
+ * @param a source structure of arrays.
+ * @param n number of fractions to copy.
+ */
+void        frac_soa_store(frac_t *f, frac_soa_t a, size_t n);
+
+/**
+ * @brief Adds two arrays of fractions element by element, every result is
+ * the same as the one returned by `fadd`. r[i] = f1[i] + f2[i].
+ * The finite fractions skip the checks for nans and infinities, which
+ * are fixed in a separate pass. `r` may be the same as `f1` or `f2`.
+ * 
+ * @param r destination structure of arrays.
+ * @param f1 first structure of arrays.
+ * @param f2 second structure of arrays.
+ * @param n number of fractions in every array.
+ */
+void        fadd_n        (frac_soa_t r, frac_soa_t f1, frac_soa_t f2, size_t n);
+
+/**
+ * @brief Multiplies two arrays of fractions element by element, every result
+ * is the same as the one returned by `fmul`. r[i] = f1[i] * f2[i].
+ * The finite fractions skip the checks for nans and infinities, which
+ * are fixed in a separate pass. `r` may be the same as `f1` or `f2`.
+ * 
+ * @param r destination structure of arrays.
+ * @param f1 first structure of arrays.
+ * @param f2 second structure of arrays.
+ * @param n number of fractions in every array.
+ */
+void        fmul_n        (frac_soa_t r, frac_soa_t f1, frac_soa_t f2, size_t n);
+
+/**
+ * @brief Computes the exact sum of an array of fractions with an accumulator,
+ * the partial sums are kept on 64 bits, so only the final result has to fit
+ * in a fraction.
+ * f = f[0] + f[1] + ... + f[n - 1].
+ * 
+ * @param f structure of arrays to sum.
+ * @param n number of fractions.
+ * @return frac_t the irreductible sum, an infinity if the array contains
+ * infinities of only one sign, nan if it contains a nan, both infinities or
+ * the sum does not fit in a fraction.
+ */
+frac_t      fsum          (frac_soa_t f, size_t n);
+
+/**
+ * @brief Computes the exact dot product of two arrays of fractions with an
+ * accumulator, the partial sums are kept on 64 bits, so only the final result
+ * has to fit in a fraction. f = f1[0] * f2[0] + ... + f1[n - 1] * f2[n - 1].
+ * 
+ * @param f1 first structure of arrays.
+ * @param f2 second structure of arrays.
+ * @param n number of fractions in every array.
+ * @return frac_t the irreductible dot product, following the rules of `fmul`
+ * and `fadd` for nans and infinities, or nan if the result does not fit in
+ * a fraction.
+ */
+frac_t      fdot          (frac_soa_t f1, frac_soa_t f2, size_t n);
+
+
+/**
+ * @brief Sets the accumulator to the zero fraction.
+ * 
+ * @param acc pointer to the accumulator.
+ */
+void        frac_acc_init (frac_acc_t *acc);
+
+/**
+ * @brief Adds a fraction to the accumulator, the sum is reduced only when
+ * it would overflow the 64 bits numerator or denominator.
+ * acc += f.
+ * 
+ * @param acc pointer to the accumulator.
+ * @param f fraction to add.
+ */
+void        frac_acc_add  (frac_acc_t *acc, frac_t f);
+
+/**
+ * @brief Subtracts a fraction from the accumulator, the difference is reduced
+ * only when it would overflow the 64 bits numerator or denominator.
+ * acc -= f.
+ * 
+ * @param acc pointer to the accumulator.
+ * @param f fraction to subtract.
+ */
+void        frac_acc_sub  (frac_acc_t *acc, frac_t f);
+
+/**
+ * @brief Multiplies the accumulator with a fraction, the product is reduced
+ * only when it would overflow the 64 bits numerator or denominator.
+ * acc *= f.
+ * 
+ * @param acc pointer to the accumulator.
+ * @param f fraction to multiply with.
+ */
+void        frac_acc_mul  (frac_acc_t *acc, frac_t f);
+
+/**
+ * @brief Reads the value of the accumulator as an irreductible fraction,
+ * the accumulator is reduced in place, so it can still be used afterwards.
+ * 
+ * @param acc pointer to the accumulator.
+ * @return frac_t the value of the accumulator, or nan if it does not fit
+ * in a fraction.
+ */
+frac_t      frac_acc_get  (frac_acc_t *acc);
+
+/**
+ * @brief The 64 bits fractions are available when the compiler has 128 bits
+ * integers, which are used for every intermediate product, so that the
+ * operations do not overflow before the final result is known.
+ * 
+ */
+#if defined(__SIZEOF_INT128__)
+
+/**
+ * @brief Structure to represent a fraction with 64 bits numerator and
+ * denominator, encoded the same way as `frac_t`. Every `frac_t` function
+ * has a 64 bits version named with the `64` suffix.
+ * 
+ */
+typedef struct frac64_s {
+  uint64_t  x;
+  uint64_t  y;
+  sign_t    s;
+} frac64_t;
+
+/**
+ * @brief Basic 64 bits fractions, encoded as the 32 bits ones.
+ * 
+ */
+#define     nan_frac64    (frac64_t) { UINT64_MAX, UINT64_MAX, nans }
+#define     pinf_frac64   (frac64_t) { 1, 0, plus }
+#define     minf_frac64   (frac64_t) { 1, 0, mins }
+#define     zero_frac64   (frac64_t) { 0, 1, plus }
+#define     id_frac64     (frac64_t) { 1, 1, plus }
+
+/**
+ * @brief Converts a fraction to a 64 bits fraction, the conversion is exact.
+ * 
+ * @param f fraction structure.
+ * @return frac64_t the same fraction on 64 bits.
+ */
+frac64_t    fwiden        (frac_t f);
+
+/**
+ * @brief Converts a 64 bits fraction to a fraction.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return frac_t the same fraction, or nan if it does not fit on 32 bits.
+ */
+frac_t      fnarrow       (frac64_t f);
+
+/**
+ * @brief Takes a 64 bits fraction and computes the string representation.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return const char* the string representation of the fraction.
+ */
+const char* frac64_out(frac64_t f);
+
+/**
+ * @brief Writes the string representation of a 64 bits fraction into a
+ * buffer owned by the caller, as `frac_format`.
+ * 
+ * @param f 64 bits fraction structure.
+ * @param buf destination buffer.
+ * @param len size of the buffer, `FRAC64_FORMAT_SIZE` is enough for every fraction.
+ * @return size_t the number of characters written without the null
+ * terminator, or 0 if the buffer is too small.
+ */
+size_t      frac64_format (frac64_t f, char *buf, size_t len);
+
+/**
+ * @brief Reads a 64 bits fraction, as `frac_parse`.
+ * 
+ * @param str string to read, it does not have to be null terminated.
+ * @param len number of characters that can be read.
+ * @param f pointer where to store the fraction.
+ * @return size_t the number of characters read, 0 if the text does not start
+ * with a fraction or the numbers do not fit on 64 bits.
+ */
+size_t      frac64_parse  (const char *str, size_t len, frac64_t *f);
+
+/**
+ * @brief Checks wheter a 64 bits fraction is not a number or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if fraction is not a number, ffalse otherwise.
+ */
+fbool_t     is_fnan64     (frac64_t f);
+
+/**
+ * @brief Checks wheter a 64 bits fraction is infinity fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is infinity fraction, ffalse otherwise.
+ */
+fbool_t     is_finf64     (frac64_t f);
+
+/**
+ * @brief Checks wheter a 64 bits fraction is positive infinity fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is positive infinity fraction, ffalse otherwise.
+ */
+fbool_t     is_fpinf64    (frac64_t f);
+
+/**
+ * @brief Checks wheter a 64 bits fraction is negative infinity fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is negative infinity fraction, ffalse otherwise.
+ */
+fbool_t     is_fminf64    (frac64_t f);
+
+/**
+ * @brief Checks if the 64 bits fraction is positive or negative.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if fraction is positive, ffalse otherwise.
+ */
+fbool_t     is_fpositive64(frac64_t f);
+
+/**
+ * @brief Checks wheter a 64 bits fraction is a zero fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is a zero fraction, ffalse otherwise.
+ */
+fbool_t     is_fzero64    (frac64_t f);
+
+/**
+ * @brief Checks wheter a 64 bits fraction is an identity fraction or not.
+ * 
+ * @param f 64 bits fraction structure.
+ * @return fbool_t ftrue if the fraction is an identity fraction, ffalse otherwise.
+ */
+fbool_t     is_fid64      (frac64_t f);
+
+/**
+ * @brief Evaluates the 64 bits fraction structure to a double value.
+ * 
+ * @param f 64 bits fraction structure to valuate.
+ * @return double the real value of the fraction.
+ */
+double      feval64       (frac64_t f);
+
+/**
+ * @brief 64 bits fraction constructor, follows the same rules as `fxy`.
+ * 
+ * @param x numerator.
+ * @param y denominator.
+ * @param s sign.
+ * @return frac64_t the irreductible 64 bits fraction.
+ */
+frac64_t    fxy64         (uint64_t x, uint64_t y, sign_t s);
+
+/**
+ * @brief Multiplies the 64 bits fraction with a constant, as `fmconst`.
+ * f = c * f1.
+ * 
+ * @param f1 first fraction.
+ * @param c constant value.
+ * @return frac64_t the product, or nan in case of errors or overflow.
+ */
+frac64_t    fmconst64     (frac64_t f1, int64_t c);
+
+/**
+ * @brief Divides the 64 bits fraction with a constant, as `fdconst`.
+ * f = f1 / c.
+ * 
+ * @param f1 first fraction.
+ * @param c constant value.
+ * @return frac64_t the division, or nan in case of errors or overflow.
+ */
+frac64_t    fdconst64     (frac64_t f1, int64_t c);
+
+/**
+ * @brief Adds two 64 bits fractions, as `fadd`. f = f1 + f2.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return frac64_t the irreductible sum, or nan if it does not fit on 64 bits.
+ */
+frac64_t    fadd64        (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Subtracts two 64 bits fractions, as `fsub`. f = f1 - f2.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return frac64_t the irreductible difference, or nan if it does not fit on 64 bits.
+ */
+frac64_t    fsub64        (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Multiplies two 64 bits fractions, as `fmul`. f = f1 * f2.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return frac64_t the irreductible product, or nan if it does not fit on 64 bits.
+ */
+frac64_t    fmul64        (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Divides two 64 bits fractions, as `fdiv`. f = f1 / f2.
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return frac64_t the irreductible division, or nan if it does not fit on 64 bits.
+ */
+frac64_t    fdiv64        (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Multiplies the 64 bits fraction with a constant in place. f1 *= c.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param c constant value.
+ */
+void        fmconstp64    (frac64_t *f1, int64_t c);
+
+/**
+ * @brief Divides the 64 bits fraction with a constant in place. f1 /= c.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param c constant value.
+ */
+void        fdconstp64    (frac64_t *f1, int64_t c);
+
+/**
+ * @brief Adds two 64 bits fractions in place. f1 += f2.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param f2 second fraction.
+ */
+void        faddp64       (frac64_t *f1, frac64_t f2);
+
+/**
+ * @brief Subtracts two 64 bits fractions in place. f1 -= f2.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param f2 second fraction.
+ */
+void        fsubp64       (frac64_t *f1, frac64_t f2);
+
+/**
+ * @brief Multiplies two 64 bits fractions in place. f1 *= f2.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param f2 second fraction.
+ */
+void        fmulp64       (frac64_t *f1, frac64_t f2);
+
+/**
+ * @brief Divides two 64 bits fractions in place. f1 /= f2.
+ * 
+ * @param f1 pointer to first fraction.
+ * @param f2 second fraction.
+ */
+void        fdivp64       (frac64_t *f1, frac64_t f2);
+
+/**
+ * @brief Compares two 64 bits fractions with a total order, as `compare_frac`.
+ * 
+ * @param data1 pointer to the first fraction.
+ * @param data2 pointer to the second fraction.
+ * @return int32_t -1, 0 or 1 as the first fraction is less than, equal to
+ * or greater than the second.
+ */
+int32_t     compare_frac64(const void * const data1, const void * const data2);
+
+/**
+ * @brief Checks if two 64 bits fractions are equal, as `feq`. f1 == f2
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return fbool_t ftrue if the fractions are equal, ffalse otherwise,
+ * funknown for indeterminate states.
+ */
+fbool_t     feq64         (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Checks if two 64 bits fractions are not equal, as `fneq`. f1 != f2
+ * 
+ * @param f1 first fraction.
+ * @param f2 second fraction.
+ * @return fbool_t ftrue if the fractions are not equal, ffalse otherwise,
+ * funknown for indeterminate states.
+ */
+fbool_t     fneq64        (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Compares two 64 bits fractions with the "greater than" operation,
+ * as `fgt`. f1 > f2
+ * 
+ * @param f1 first fraction
+ * @param f2 second fraction
+ * @return fbool_t ftrue if the first fraction is greater than second,
+ * ffalse otherwise, funknown for indeterminate states.
+ */
+fbool_t     fgt64         (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Compares two 64 bits fractions with the "less than" operation,
+ * as `flt`. f1 < f2
+ * 
+ * @param f1 first fraction
+ * @param f2 second fraction
+ * @return fbool_t ftrue if the first fraction is less than second,
+ * ffalse otherwise, funknown for indeterminate states.
+ */
+fbool_t     flt64         (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Compares two 64 bits fractions with the "greater than or equal to"
+ * operation, as `fgte`. f1 >= f2
+ * 
+ * @param f1 first fraction
+ * @param f2 second fraction
+ * @return fbool_t ftrue if the first fraction is greater than or equal to
+ * second, ffalse otherwise, funknown for indeterminate states.
+ */
+fbool_t     fgte64        (frac64_t f1, frac64_t f2);
+
+/**
+ * @brief Compares two 64 bits fractions with the "less than or equal to"
+ * operation, as `flte`. f1 <= f2
+ * 
+ * @param f1 first fraction
+ * @param f2 second fraction
+ * @return fbool_t ftrue if the first fraction is less than or equal to
+ * second, ffalse otherwise, funknown for indeterminate states.
+ */
+fbool_t     flte64        (frac64_t f1, frac64_t f2);
+
+#endif /* __SIZEOF_INT128__ */
+
+
+#if defined(__SIZEOF_INT128__)
+
+/**
+ * @brief Matrix of fractions stored row by row as a structure of arrays,
+ * the fraction at row i and column j is at index i * cols + j of the
+ * arrays, so that a row is a contiguous `frac_soa_t` that can be given to
+ * the array kernels. The structure and its arrays are allocated at once
+ * by `frac_mat_create` and freed by `frac_mat_free`.
+ * 
+ */
+typedef struct frac_mat_s {
+  size_t      rows;
+  size_t      cols;
+  frac_soa_t  data;
+} frac_mat_t;
+
+/**
+ * @brief Allocates a matrix of fractions filled with zero fractions.
+ * 
+ * @param rows number of rows, greater than zero.
+ * @param cols number of columns, greater than zero.
+ * @return frac_mat_t* the new matrix, or NULL if the sizes are zero or
+ * the allocation failed.
+ */
+frac_mat_t* frac_mat_create   (size_t rows, size_t cols);
+
+/**
+ * @brief Allocates a square identity matrix of fractions.
+ * 
+ * @param n number of rows and columns, greater than zero.
+ * @return frac_mat_t* the new matrix, or NULL if the size is zero or
+ * the allocation failed.
+ */
+frac_mat_t* frac_mat_identity (size_t n);
+
+/**
+ * @brief Frees a matrix allocated by the matrix functions.
+ * 
+ * @param m matrix to free, may be NULL.
+ */
+void        frac_mat_free     (frac_mat_t *m);
+
+/**
+ * @brief Reads a fraction of a matrix, the indexes are not checked.
+ * 
+ * @param m matrix of fractions.
+ * @param i row index.
+ * @param j column index.
+ * @return frac_t the fraction at row i and column j.
+ */
+frac_t      frac_mat_get      (const frac_mat_t *m, size_t i, size_t j);
+
+/**
+ * @brief Writes a fraction of a matrix, the indexes are not checked.
+ * 
+ * @param m matrix of fractions.
+ * @param i row index.
+ * @param j column index.
+ * @param f fraction to write.
+ */
+void        frac_mat_set      (frac_mat_t *m, size_t i, size_t j, frac_t f);
+
+/**
+ * @brief Multiplies a matrix by a vector with one `fdot` for every row.
+ * r = m * v.
+ * 
+ * @param m matrix of fractions.
+ * @param v vector with `m->cols` fractions.
+ * @param r destination vector with room for `m->rows` fractions.
+ * @return fbool_t ftrue if the product was computed, ffalse if an
+ * allocation failed.
+ */
+fbool_t     frac_mat_mulv     (const frac_mat_t *m, const frac_t *v, frac_t *r);
+
+/**
+ * @brief Multiplies two matrices, the second one is transposed once so that
+ * every element of the result is one `fdot` over two contiguous rows.
+ * r = m1 * m2.
+ * 
+ * @param m1 first matrix.
+ * @param m2 second matrix, with `m1->cols` rows.
+ * @return frac_mat_t* the new product matrix, or NULL if the sizes do not
+ * match or an allocation failed.
+ */
+frac_mat_t* frac_mat_mul      (const frac_mat_t *m1, const frac_mat_t *m2);
+
+/**
+ * @brief Computes the determinant of a square matrix with the fraction free
+ * (Bareiss) elimination. Every row is scaled to integers by the lcm of its
+ * denominators and the elimination works on 64 bits integers with 128 bits
+ * intermediates and exact divisions, so no gcd is computed before the final
+ * division by the scales.
+ * 
+ * @param m square matrix of finite fractions.
+ * @return frac_t the irreductible determinant, or nan if the matrix is not
+ * square, contains nans or infinities or an intermediate does not fit on
+ * 64 bits.
+ */
+frac_t      frac_mat_det      (const frac_mat_t *m);
+
+/**
+ * @brief Computes the inverse of a square matrix with the fraction free
+ * Gauss-Jordan (Bareiss) elimination of the scaled matrix next to the
+ * identity. An element that does not fit in a fraction is nan.
+ * 
+ * @param m square matrix of finite fractions.
+ * @return frac_mat_t* the new inverse matrix, or NULL if the matrix is not
+ * square, is singular, contains nans or infinities, an intermediate does
+ * not fit on 64 bits or an allocation failed.
+ */
+frac_mat_t* frac_mat_inverse  (const frac_mat_t *m);
+
+/**
+ * @brief Solves the linear system m * x = b with the fraction free
+ * (Bareiss) elimination of the scaled matrix next to `b` and a fraction
+ * free back substitution, the back substitution computes the determinant
+ * times the solution, so it is divided by the determinant only at the end.
+ * 
+ * @param m square matrix of finite fractions.
+ * @param b vector with `m->rows` finite fractions.
+ * @param x destination vector with room for `m->cols` fractions.
+ * @return fbool_t ftrue if the system has a unique solution and every
+ * element fits in a fraction, ffalse if the matrix is singular or is not
+ * square, funknown if the system contains nans or infinities, an
+ * intermediate does not fit on 64 bits or an allocation failed.
+ */
+fbool_t     frac_mat_solve    (const frac_mat_t *m, const frac_t *b, frac_t *x);
+
+#endif /* __SIZEOF_INT128__ */
+
 #endif /* C_LANGUAGE_DATA_STRUCTURE_PROJECT_FRACTIONS_H_ */
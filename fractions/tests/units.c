@@ -24,6 +24,7 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 #include "../src/fractions.h"
 
@@ -275,6 +276,8 @@ void test_fadd(void) {
   assert_frac("(a+b)+c = a+(b+c)", cnd(fadd(fadd(a, b), c), fadd(a, fadd(b, c))));
   assert_frac("1/3 + 7/4 = 25/12", cnd(fadd(a, c), fxy(25, 12, plus)));
   assert_frac("-1/3 + 1/2 = 1/6", cnd(fadd(_a, b), fxy(1, 6, plus)));
+  assert_frac("1/6 + 1/3 = 1/2", cnd(fadd(fxy(1, 6, plus), a), b));
+  assert_frac("overflow = nan", is_fnan(fadd(fxy(1, 65537, plus), fxy(1, 65539, plus))));
 
   print_footer();
 }
@@ -368,6 +371,7 @@ void test_fmul(void) {
   assert_frac("a * a = a^2", cnd(fmul(a, a), fxy(16, 9, plus)));
   assert_frac("(a*b)*c = a*(b*c)", cnd(fmul(fmul(a, b), c), fmul(a, fmul(b, c))));
   assert_frac("(4/3)*(7/4)*(1/2) = 7/6", cnd(fmul(fmul(a, c), b), fxy(7, 6, plus)));
+  assert_frac("overflow = nan", is_fnan(fmul(fxy(65537, 1, plus), fxy(65539, 1, plus))));
 
   print_footer();
 }
@@ -618,6 +622,488 @@ void test_flte(void) {
   print_footer();
 }
 
+/**
+ * @brief Test `compare_frac` method and the comparisons of wide fractions.
+ * 
+ */
+void test_compare_frac(void) {
+  print_header("compare_frac");
+
+  frac_t a = fxy(1, 3, plus);
+  frac_t b = fxy(4, 7, plus);
+  frac_t w1 = fxy(4000000000U, 4000000001U, plus);
+  frac_t w2 = fxy(3999999999U, 4000000000U, plus);
+  frac_t sorted[7] = {
+    minf_frac, fxy(4, 7, mins), zero_frac, fxy(1, 3, plus), id_frac, pinf_frac, nan_frac
+  };
+  frac_t mixed[7] = {
+    id_frac, nan_frac, zero_frac, pinf_frac, fxy(4, 7, mins), fxy(1, 3, plus), minf_frac
+  };
+
+  assert_frac("wide w1 > w2", fgt(w1, w2) == ftrue);
+  assert_frac("wide w2 < w1", flt(w2, w1) == ftrue);
+  assert_frac("wide w1 != w2", fneq(w1, w2) == ftrue);
+  assert_frac("-0 == 0", feq(fxy(0, 5, mins), zero_frac) == ftrue);
+  assert_frac("-0 >= 0", fgte((frac_t) { 0, 1, mins }, zero_frac) == ftrue);
+  assert_frac("cmp a < b", compare_frac(&a, &b) < 0);
+  assert_frac("cmp b > a", compare_frac(&b, &a) > 0);
+  assert_frac("cmp a == a", compare_frac(&a, &a) == 0);
+  assert_frac("cmp inf == inf", compare_frac(&sorted[5], &sorted[5]) == 0);
+  assert_frac("cmp inf < nan", compare_frac(&sorted[5], &sorted[6]) < 0);
+  assert_frac("cmp nan == nan", compare_frac(&sorted[6], &sorted[6]) == 0);
+  assert_frac("cmp -inf < -4/7", compare_frac(&sorted[0], &sorted[1]) < 0);
+
+  qsort(mixed, 7, sizeof(frac_t), compare_frac);
+
+  fbool_t is_sorted = ftrue;
+  for (size_t i = 0; i < 7; ++i) {
+    if (!cnd(mixed[i], sorted[i])) {
+      is_sorted = ffalse;
+    }
+  }
+
+  assert_frac("qsort", is_sorted);
+
+  print_footer();
+}
+
+/**
+ * @brief Fractions used by the tests of the array kernels, every pair
+ * of the two arrays is one of the interesting cases of the scalar operators.
+ * 
+ */
+#define KERNEL_CASES 12
+
+static frac_t kernel_f1[KERNEL_CASES];
+static frac_t kernel_f2[KERNEL_CASES];
+
+/**
+ * @brief Fills the kernel test cases.
+ * 
+ */
+void init_kernel_cases(void) {
+  frac_t f1[KERNEL_CASES] = {
+    fxy(1, 3, plus), fxy(1, 3, mins), fxy(7, 4, plus), fxy(1, 6, plus),
+    zero_frac, nan_frac, pinf_frac, minf_frac,
+    pinf_frac, fxy(4, 3, mins), fxy(1, 65537, plus), id_frac
+  };
+
+  frac_t f2[KERNEL_CASES] = {
+    fxy(1, 2, plus), fxy(1, 3, plus), fxy(1, 3, mins), fxy(1, 3, plus),
+    fxy(5, 9, mins), fxy(1, 2, plus), minf_frac, fxy(2, 5, plus),
+    zero_frac, fxy(3, 4, mins), fxy(1, 65539, plus), fxy(9, 10, mins)
+  };
+
+  memcpy(kernel_f1, f1, sizeof(f1));
+  memcpy(kernel_f2, f2, sizeof(f2));
+}
+
+/**
+ * @brief Test `fadd_n` method.
+ * 
+ */
+void test_fadd_n(void) {
+  print_header("fadd_n");
+
+  uint32_t x1[KERNEL_CASES], y1[KERNEL_CASES], x2[KERNEL_CASES], y2[KERNEL_CASES];
+  sign_t s1[KERNEL_CASES], s2[KERNEL_CASES];
+  frac_soa_t a = {x1, y1, s1};
+  frac_soa_t b = {x2, y2, s2};
+  frac_t r[KERNEL_CASES];
+
+  frac_soa_load(a, kernel_f1, KERNEL_CASES);
+  frac_soa_load(b, kernel_f2, KERNEL_CASES);
+
+  fadd_n(a, a, b, KERNEL_CASES);
+  frac_soa_store(r, a, KERNEL_CASES);
+
+  fbool_t same = ftrue;
+  for (size_t i = 0; i < KERNEL_CASES; ++i) {
+    frac_t f = fadd(kernel_f1[i], kernel_f2[i]);
+    same &= (is_fnan(f) && is_fnan(r[i])) || cnd(f, r[i]);
+  }
+
+  assert_frac("fadd_n = fadd in place", same);
+  assert_frac("1/6 + 1/3 = 1/2", cnd(r[3], fxy(1, 2, plus)));
+  assert_frac("inf + (-inf) = nan", is_fnan(r[6]));
+  assert_frac("overflow = nan", is_fnan(r[10]));
+
+  print_footer();
+}
+
+/**
+ * @brief Test `fmul_n` method.
+ * 
+ */
+void test_fmul_n(void) {
+  print_header("fmul_n");
+
+  uint32_t x1[KERNEL_CASES], y1[KERNEL_CASES], x2[KERNEL_CASES], y2[KERNEL_CASES];
+  uint32_t x3[KERNEL_CASES], y3[KERNEL_CASES];
+  sign_t s1[KERNEL_CASES], s2[KERNEL_CASES], s3[KERNEL_CASES];
+  frac_soa_t a = {x1, y1, s1};
+  frac_soa_t b = {x2, y2, s2};
+  frac_soa_t c = {x3, y3, s3};
+  frac_t r[KERNEL_CASES];
+
+  frac_soa_load(a, kernel_f1, KERNEL_CASES);
+  frac_soa_load(b, kernel_f2, KERNEL_CASES);
+
+  fmul_n(c, a, b, KERNEL_CASES);
+  frac_soa_store(r, c, KERNEL_CASES);
+
+  fbool_t same = ftrue;
+  for (size_t i = 0; i < KERNEL_CASES; ++i) {
+    frac_t f = fmul(kernel_f1[i], kernel_f2[i]);
+    same &= (is_fnan(f) && is_fnan(r[i])) || cnd(f, r[i]);
+  }
+
+  assert_frac("fmul_n = fmul", same);
+  assert_frac("(-4/3) * (-3/4) = id", is_fid(r[9]));
+  assert_frac("inf * zero = nan", is_fnan(r[8]));
+
+  print_footer();
+}
+
+/**
+ * @brief Test `fsum` method.
+ * 
+ */
+void test_fsum(void) {
+  print_header("fsum");
+
+  uint32_t x[KERNEL_CASES], y[KERNEL_CASES];
+  sign_t s[KERNEL_CASES];
+  frac_soa_t a = {x, y, s};
+
+  frac_soa_load(a, kernel_f1, KERNEL_CASES);
+
+  assert_frac("empty sum = zero", cnd(fsum(a, 0), zero_frac));
+  assert_frac("1/3 - 1/3 = zero", cnd(fsum(a, 2), zero_frac));
+  assert_frac("1/3 - 1/3 + 7/4 + 1/6 = 23/12", cnd(fsum(a, 4), fxy(23, 12, plus)));
+  assert_frac("sum with nan = nan", is_fnan(fsum(a, 6)));
+
+  a.x += 6; a.y += 6; a.s += 6;
+  assert_frac("inf + (-inf) = nan", is_fnan(fsum(a, 2)));
+
+  a.x += 1; a.y += 1; a.s += 1;
+  assert_frac("-inf + inf = nan", is_fnan(fsum(a, 2)));
+
+  a.x += 1; a.y += 1; a.s += 1;
+  assert_frac("inf + a = inf", is_fpinf(fsum(a, 4)));
+
+  uint32_t wx[3] = {1, 1, 1};
+  uint32_t wy[3] = {65537, 65539, 65537};
+  sign_t ws[3] = {plus, plus, mins};
+  frac_soa_t w = {wx, wy, ws};
+
+  assert_frac("wide partial sum = 1/65539", cnd(fsum(w, 3), fxy(1, 65539, plus)));
+  assert_frac("wide sum = nan", is_fnan(fsum(w, 2)));
+
+  print_footer();
+}
+
+/**
+ * @brief Test `fdot` method.
+ * 
+ */
+void test_fdot(void) {
+  print_header("fdot");
+
+  uint32_t x1[KERNEL_CASES], y1[KERNEL_CASES], x2[KERNEL_CASES], y2[KERNEL_CASES];
+  sign_t s1[KERNEL_CASES], s2[KERNEL_CASES];
+  frac_soa_t a = {x1, y1, s1};
+  frac_soa_t b = {x2, y2, s2};
+
+  frac_soa_load(a, kernel_f1, KERNEL_CASES);
+  frac_soa_load(b, kernel_f2, KERNEL_CASES);
+
+  frac_t dot = zero_frac;
+  for (size_t i = 0; i < 5; ++i) {
+    dot = fadd(dot, fmul(kernel_f1[i], kernel_f2[i]));
+  }
+
+  assert_frac("empty dot = zero", cnd(fdot(a, b, 0), zero_frac));
+  assert_frac("fdot = sum of fmul", cnd(fdot(a, b, 5), dot));
+  assert_frac("dot with nan = nan", is_fnan(fdot(a, b, 6)));
+
+  a.x += 6; a.y += 6; a.s += 6;
+  b.x += 6; b.y += 6; b.s += 6;
+  assert_frac("inf * (-inf) = -inf", is_fminf(fdot(a, b, 1)));
+  assert_frac("-inf * a + inf * zero = nan", is_fnan(fdot(a, b, 3)));
+
+  uint32_t wx1[4] = {4, 1, 1, 1}, wy1[4] = {3, 65537, 65537, 1};
+  uint32_t wx2[4] = {3, 1, 1, 9}, wy2[4] = {4, 65539, 65539, 10};
+  sign_t ws1[4] = {mins, plus, mins, plus};
+  sign_t ws2[4] = {mins, plus, plus, mins};
+  frac_soa_t w1 = {wx1, wy1, ws1};
+  frac_soa_t w2 = {wx2, wy2, ws2};
+
+  assert_frac("wide partial dot = 1/10", cnd(fdot(w1, w2, 4), fxy(1, 10, plus)));
+  assert_frac("wide dot = nan", is_fnan(fdot(w1, w2, 2)));
+
+  print_footer();
+}
+
+/**
+ * @brief Test `frac_acc_t` methods.
+ * 
+ */
+void test_frac_acc(void) {
+  print_header("frac_acc");
+
+  frac_acc_t acc;
+  frac_acc_init(&acc);
+
+  assert_frac("empty acc = zero", cnd(frac_acc_get(&acc), zero_frac));
+
+  for (uint32_t i = 1; i <= 20; ++i) {
+    frac_acc_add(&acc, fxy(1, i * (i + 1), plus));
+  }
+
+  assert_frac("sum of 1/i(i+1) = 20/21", cnd(frac_acc_get(&acc), fxy(20, 21, plus)));
+
+  frac_acc_sub(&acc, fxy(20, 21, plus));
+  assert_frac("acc - acc = zero", cnd(frac_acc_get(&acc), zero_frac));
+
+  frac_acc_add(&acc, fxy(3, 4, mins));
+  frac_acc_mul(&acc, fxy(2, 3, mins));
+  assert_frac("(-3/4) * (-2/3) = 1/2", cnd(frac_acc_get(&acc), fxy(1, 2, plus)));
+
+  for (size_t i = 0; i < 40; ++i) {
+    frac_acc_mul(&acc, fxy(65537, 65539, plus));
+    frac_acc_mul(&acc, fxy(65539, 65537, plus));
+  }
+
+  assert_frac("wide product kept as 1/2", cnd(frac_acc_get(&acc), fxy(1, 2, plus)));
+
+  frac_acc_add(&acc, fxy(1, 65537, plus));
+  frac_acc_add(&acc, fxy(1, 65539, plus));
+  assert_frac("result overflow = nan", is_fnan(frac_acc_get(&acc)));
+
+  frac_acc_init(&acc);
+  frac_acc_add(&acc, fxy(1, 3, plus));
+  frac_acc_mul(&acc, minf_frac);
+  assert_frac("a * (-inf) = -inf", is_fminf(frac_acc_get(&acc)));
+
+  frac_acc_add(&acc, fxy(7, 4, plus));
+  assert_frac("-inf + a = -inf", is_fminf(frac_acc_get(&acc)));
+
+  frac_acc_mul(&acc, zero_frac);
+  assert_frac("-inf * zero = nan", is_fnan(frac_acc_get(&acc)));
+
+  frac_acc_init(&acc);
+  frac_acc_add(&acc, pinf_frac);
+  frac_acc_sub(&acc, pinf_frac);
+  assert_frac("inf - inf = nan", is_fnan(frac_acc_get(&acc)));
+
+  print_footer();
+}
+
+/**
+ * @brief Test the reentrant formatting of fractions.
+ * 
+ */
+void test_frac_format(void) {
+  print_header("frac_format");
+
+  char buf[FRAC_FORMAT_SIZE];
+  char line[64];
+  frac_t line_fracs[4] = { fxy(1, 2, plus), fxy(7, 4, mins), zero_frac, pinf_frac };
+
+  assert_frac("format -7/4", frac_format(fxy(7, 4, mins), buf, sizeof(buf)) == 4 && !strcmp(buf, "-7/4"));
+  assert_frac("format 3", frac_format(fxy(3, 1, plus), buf, sizeof(buf)) == 1 && !strcmp(buf, "3"));
+  assert_frac("format -zero", frac_format(fxy(0, 5, mins), buf, sizeof(buf)) == 1 && !strcmp(buf, "0"));
+  assert_frac("format nan", frac_format(nan_frac, buf, sizeof(buf)) == 4 && !strcmp(buf, "nans"));
+  assert_frac("format -inf", frac_format(minf_frac, buf, sizeof(buf)) == 4 && !strcmp(buf, "-inf"));
+  assert_frac("format widest", frac_format(fxy(4294967295U, 4294967294U, mins), buf, sizeof(buf)) == 22 &&
+                               !strcmp(buf, "-4294967295/4294967294"));
+  assert_frac("format 100/99", frac_format(fxy(100, 99, plus), buf, sizeof(buf)) == 6 && !strcmp(buf, "100/99"));
+  assert_frac("format too small", frac_format(fxy(100, 99, plus), buf, 6) == 0 && buf[0] == '\0');
+  assert_frac("format = frac_out", !strcmp(frac_out(fxy(12, 10, mins)), "-6/5"));
+  assert_frac("format line", frac_format_n(line_fracs, 4, ',', line, sizeof(line)) == 14 &&
+                             !strcmp(line, "1/2,-7/4,0,inf"));
+  assert_frac("format line too small", frac_format_n(line_fracs, 4, ',', line, 12) == 0 && line[0] == '\0');
+  assert_frac("format empty line", frac_format_n(line_fracs, 0, ',', line, sizeof(line)) == 0 && line[0] == '\0');
+
+  print_footer();
+}
+
+/**
+ * @brief Test the parsing of fractions.
+ * 
+ */
+void test_frac_parse(void) {
+  print_header("frac_parse");
+
+  frac_t f = id_frac;
+  frac_t line_fracs[4];
+  size_t end = 0;
+  const char *line = "1/2,-7/4,0,inf\n3";
+
+  assert_frac("parse -7/4", frac_parse("-7/4", 4, &f) == 4 && cnd(f, fxy(7, 4, mins)));
+  assert_frac("parse +6/24", frac_parse("+6/24", 5, &f) == 5 && cnd(f, fxy(1, 4, plus)));
+  assert_frac("parse 3", frac_parse("3", 1, &f) == 1 && cnd(f, fxy(3, 1, plus)));
+  assert_frac("parse -0", frac_parse("-0", 2, &f) == 2 && cnd(f, zero_frac));
+  assert_frac("parse nans", frac_parse("nans", 4, &f) == 4 && is_fnan(f));
+  assert_frac("parse -inf", frac_parse("-inf", 4, &f) == 4 && is_fminf(f));
+  assert_frac("parse 1/0", frac_parse("1/0", 3, &f) == 3 && is_fpinf(f));
+  assert_frac("parse max", frac_parse("4294967295/2", 12, &f) == 12 && cnd(f, fxy(4294967295U, 2, plus)));
+  assert_frac("parse stops", frac_parse("5/3x", 4, &f) == 3 && cnd(f, fxy(5, 3, plus)));
+  assert_frac("parse length", frac_parse("5/37", 3, &f) == 3 && cnd(f, fxy(5, 3, plus)));
+
+  f = id_frac;
+  assert_frac("parse overflow", frac_parse("4294967296", 10, &f) == 0 && is_fid(f));
+  assert_frac("parse no denominator", frac_parse("5/", 2, &f) == 0 && is_fid(f));
+  assert_frac("parse sign only", frac_parse("-", 1, &f) == 0 && is_fid(f));
+  assert_frac("parse empty", frac_parse("", 0, &f) == 0 && is_fid(f));
+
+  assert_frac("parse line", frac_parse_n(line, strlen(line), ',', line_fracs, 4, &end) == 4 && end == 14 &&
+                            cnd(line_fracs[0], fxy(1, 2, plus)) && cnd(line_fracs[1], fxy(7, 4, mins)) &&
+                            is_fzero(line_fracs[2]) && is_fpinf(line_fracs[3]));
+  assert_frac("parse partial line", frac_parse_n("1,2,x", 5, ',', line_fracs, 4, &end) == 2 && end == 4);
+  assert_frac("parse line limit", frac_parse_n("1,2,3", 5, ',', line_fracs, 2, NULL) == 2);
+
+  print_footer();
+}
+
+/**
+ * @brief Checks a raw equality of a 64 bits fraction to another.
+ * 
+ */
+#define cnd64(f1, f2) (f1.x == f2.x && f1.y == f2.y && f1.s == f2.s)
+
+/**
+ * @brief Test the 64 bits fractions methods.
+ * 
+ */
+void test_frac64(void) {
+  print_header("frac64");
+
+  frac64_t a = fxy64(1, 3, plus);
+  frac64_t _a = fxy64(1, 3, mins);
+  frac64_t b = fxy64(1, 2, plus);
+  frac64_t big = fxy64(4294967311ULL, 3, plus);
+  frac64_t big_inv = fxy64(3, 4294967311ULL, plus);
+
+  assert_frac("6/24 = 1/4", cnd64(fxy64(6, 24, plus), fxy64(1, 4, plus)));
+  assert_frac("widen narrow = id", cnd(fnarrow(fwiden(fxy(7, 4, mins))), fxy(7, 4, mins)));
+  assert_frac("narrow(big) = nan", is_fnan(fnarrow(big)));
+  assert_frac("nan + a = nan", is_fnan64(fadd64(nan_frac64, a)));
+  assert_frac("inf + (-inf) = nan", is_fnan64(fadd64(pinf_frac64, minf_frac64)));
+  assert_frac("a + (-inf) = -inf", is_fminf64(fadd64(a, minf_frac64)));
+  assert_frac("-1/3 + 1/2 = 1/6", cnd64(fadd64(_a, b), fxy64(1, 6, plus)));
+  assert_frac("a - a = zero", cnd64(fsub64(a, a), zero_frac64));
+  assert_frac("1/65537 + 1/65539 fits", cnd64(fadd64(fxy64(1, 65537, plus), fxy64(1, 65539, plus)),
+                                             fxy64(131076, 4295229443ULL, plus)));
+  assert_frac("big * big_inv = id", is_fid64(fmul64(big, big_inv)));
+  assert_frac("big * big = nan", is_fnan64(fmul64(big, big)));
+  assert_frac("zero * inf = nan", is_fnan64(fmul64(zero_frac64, pinf_frac64)));
+  assert_frac("(-a) * (-inf) = inf", is_fpinf64(fmul64(_a, minf_frac64)));
+  assert_frac("a / big_inv = big / 3", cnd64(fdiv64(a, big_inv), fxy64(4294967311ULL, 9, plus)));
+  assert_frac("a / zero = inf", is_fpinf64(fdiv64(a, zero_frac64)));
+  assert_frac("-2 * a = -2/3", cnd64(fmconst64(a, -2), fxy64(2, 3, mins)));
+  assert_frac("a / -2 = -1/6", cnd64(fdconst64(a, -2), fxy64(1, 6, mins)));
+  assert_frac("big > a", fgt64(big, a) == ftrue);
+  assert_frac("big_inv < a", flt64(big_inv, a) == ftrue);
+  assert_frac("-a < big_inv", flt64(_a, big_inv) == ftrue);
+  assert_frac("a >= a", fgte64(a, a) == ftrue);
+  assert_frac("a <= -a", flte64(a, _a) == ffalse);
+  assert_frac("a == a", feq64(a, a) == ftrue);
+  assert_frac("a != b", fneq64(a, b) == ftrue);
+  assert_frac("inf == inf", feq64(pinf_frac64, pinf_frac64) == funknown);
+  assert_frac("-inf < big", flt64(minf_frac64, big) == ftrue);
+  assert_frac("nan > a", fgt64(nan_frac64, a) == funknown);
+  assert_frac("cmp big > a", compare_frac64(&big, &a) > 0);
+
+  char buf[FRAC64_FORMAT_SIZE];
+  frac64_t parsed = id_frac64;
+
+  assert_frac("format widest", frac64_format(fxy64(UINT64_MAX, UINT64_MAX - 1, mins), buf, sizeof(buf)) == 42 &&
+                               !strcmp(buf, "-18446744073709551615/18446744073709551614"));
+  assert_frac("format = frac64_out", !strcmp(frac64_out(big), "4294967311/3"));
+  assert_frac("parse big", frac64_parse("4294967311/3", 12, &parsed) == 12 && cnd64(parsed, big));
+  assert_frac("parse 64 overflow", frac64_parse("18446744073709551616", 20, &parsed) == 0 && cnd64(parsed, big));
+
+  print_footer();
+}
+
+/**
+ * @brief Test the matrices of fractions.
+ * 
+ */
+void test_frac_mat(void) {
+  print_header("frac_mat");
+
+  frac_mat_t *a = frac_mat_create(2, 2);
+  frac_mat_t *h = frac_mat_create(2, 2);
+  frac_mat_t *p = frac_mat_create(2, 2);
+  frac_mat_t *singular = frac_mat_create(3, 3);
+  frac_mat_t *id = frac_mat_identity(3);
+  frac_t b[2] = { fxy(3, 1, plus), fxy(5, 1, plus) };
+  frac_t x[3] = { zero_frac, zero_frac, zero_frac };
+  frac_t r[3];
+
+  frac_mat_set(a, 0, 0, fxy(2, 1, plus));
+  frac_mat_set(a, 0, 1, id_frac);
+  frac_mat_set(a, 1, 0, id_frac);
+  frac_mat_set(a, 1, 1, fxy(3, 1, plus));
+
+  frac_mat_set(h, 0, 0, fxy(1, 2, plus));
+  frac_mat_set(h, 0, 1, fxy(1, 3, plus));
+  frac_mat_set(h, 1, 0, fxy(1, 4, plus));
+  frac_mat_set(h, 1, 1, fxy(1, 5, plus));
+
+  frac_mat_set(p, 0, 1, id_frac);
+  frac_mat_set(p, 1, 0, id_frac);
+
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      frac_mat_set(singular, i, j, fxy((uint32_t)(i + j), 1, plus));
+    }
+  }
+
+  frac_mat_t *a_inv = frac_mat_inverse(a);
+  frac_mat_t *a_id = frac_mat_mul(a, a_inv);
+
+  assert_frac("create zero", cnd(frac_mat_get(p, 0, 0), zero_frac) && cnd(frac_mat_get(p, 1, 1), zero_frac));
+  assert_frac("det a = 5", cnd(frac_mat_det(a), fxy(5, 1, plus)));
+  assert_frac("det h = 1/60", cnd(frac_mat_det(h), fxy(1, 60, plus)));
+  assert_frac("det swap = -1", cnd(frac_mat_det(p), fxy(1, 1, mins)));
+  assert_frac("det id = 1", is_fid(frac_mat_det(id)));
+  assert_frac("det singular = 0", is_fzero(frac_mat_det(singular)));
+  assert_frac("det not square", is_fnan(frac_mat_det(NULL)));
+  assert_frac("solve a", frac_mat_solve(a, b, x) == ftrue &&
+                         cnd(x[0], fxy(4, 5, plus)) && cnd(x[1], fxy(7, 5, plus)));
+  assert_frac("mulv a x = b", frac_mat_mulv(a, x, r) == ftrue && cnd(r[0], b[0]) && cnd(r[1], b[1]));
+  assert_frac("solve swap", frac_mat_solve(p, b, x) == ftrue && cnd(x[0], b[1]) && cnd(x[1], b[0]));
+  assert_frac("solve singular", frac_mat_solve(singular, x, r) == ffalse);
+  assert_frac("inverse a", a_inv != NULL &&
+                           cnd(frac_mat_get(a_inv, 0, 0), fxy(3, 5, plus)) &&
+                           cnd(frac_mat_get(a_inv, 0, 1), fxy(1, 5, mins)) &&
+                           cnd(frac_mat_get(a_inv, 1, 0), fxy(1, 5, mins)) &&
+                           cnd(frac_mat_get(a_inv, 1, 1), fxy(2, 5, plus)));
+  assert_frac("a * inverse a = id", a_id != NULL &&
+                                    is_fid(frac_mat_get(a_id, 0, 0)) && is_fzero(frac_mat_get(a_id, 0, 1)) &&
+                                    is_fzero(frac_mat_get(a_id, 1, 0)) && is_fid(frac_mat_get(a_id, 1, 1)));
+  assert_frac("inverse singular", frac_mat_inverse(singular) == NULL);
+  assert_frac("mul sizes", frac_mat_mul(a, id) == NULL);
+
+  frac_mat_set(h, 1, 1, nan_frac);
+  assert_frac("det nan", is_fnan(frac_mat_det(h)));
+  assert_frac("solve nan", frac_mat_solve(h, b, x) == funknown);
+
+  frac_mat_free(a_id);
+  frac_mat_free(a_inv);
+  frac_mat_free(id);
+  frac_mat_free(singular);
+  frac_mat_free(p);
+  frac_mat_free(h);
+  frac_mat_free(a);
+
+  print_footer();
+}
+
 /**
  * @brief Main function that calls every test function appart.
  *
@@ -644,6 +1130,22 @@ int main(void) {
   test_flt();
   test_fgte();
   test_flte();
+  test_compare_frac();
+
+  init_kernel_cases();
+  test_fadd_n();
+  test_fmul_n();
+  test_fsum();
+  test_fdot();
+
+  test_frac_acc();
+
+  test_frac_format();
+  test_frac_parse();
+
+  test_frac64();
+
+  test_frac_mat();
 
   return 0;
 }
\ No newline at end of file
@@ -45,8 +45,13 @@
  * data memory, if data is not stored as a pointer (T <=> *M), then the free
  * function must be `NULL`. If data represents a structure which contains
  * pointers allocated, then the free function must free those fields.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
  */
-#define MAVL(ID, T)                                                            \
+#define MAVL_WITH_ALLOC(ID, T, ALLOC)                                          \
+  M_ALLOC(ID, mavl, ALLOC)                                                     \
+                                                                               \
   CMP_FUNC(ID, T)                                                              \
   FREE_FUNC(ID, T)                                                             \
                                                                                \
@@ -57,6 +62,7 @@
     struct ID##_mavl_node_s *right;                                            \
     uint32_t count;                                                            \
     uint32_t height;                                                           \
+    size_t weight;                                                             \
   } ID##_mavl_node_ptr_t, *ID##_mavl_node_t;                                   \
                                                                                \
   typedef struct ID##_mavl_s {                                                 \
@@ -65,6 +71,10 @@
     ID##_compare_func cmp;                                                     \
     ID##_free_func frd;                                                        \
     size_t size;                                                               \
+    mbool_t order_stats;                                                       \
+    ID##_mavl_node_t node_cache;                                               \
+    size_t cached_nodes;                                                       \
+    size_t node_cache_cap;                                                     \
   } ID##_mavl_ptr_t, *ID##_mavl_t;                                             \
                                                                                \
   ID##_mavl_t ID##_mavl(ID##_compare_func cmp, ID##_free_func frd) {           \
@@ -72,7 +82,7 @@
       return NULL;                                                             \
     }                                                                          \
                                                                                \
-    ID##_mavl_t self = malloc(sizeof *self);                                   \
+    ID##_mavl_t self = ID##_internal_mavl_malloc(sizeof *self);                \
                                                                                \
     if (self == NULL) {                                                        \
       return NULL;                                                             \
@@ -81,39 +91,63 @@
     self->cmp = cmp;                                                           \
     self->frd = frd;                                                           \
                                                                                \
-    self->nil = malloc(sizeof *self->nil);                                     \
+    self->nil = ID##_internal_mavl_malloc(sizeof *self->nil);                  \
                                                                                \
     if (self->nil == NULL) {                                                   \
-      free(self);                                                              \
+      ID##_internal_mavl_free(self);                                           \
       return NULL;                                                             \
     }                                                                          \
                                                                                \
     self->nil->height = 0;                                                     \
     self->nil->count = 1;                                                      \
+    self->nil->weight = 0;                                                     \
     self->nil->left = self->nil->right = self->nil->parent = self->nil;        \
                                                                                \
     self->root = self->nil;                                                    \
     self->size = 0;                                                            \
+    self->order_stats = mfalse;                                                \
+    self->node_cache = NULL;                                                   \
+    self->cached_nodes = 0;                                                    \
+    self->node_cache_cap = 0;                                                  \
                                                                                \
     return self;                                                               \
   }                                                                            \
                                                                                \
-  ID##_mavl_node_t ID##_internal_mavl_node(const ID##_mavl_ptr_t *const self,  \
+  ID##_mavl_node_t ID##_internal_mavl_node(ID##_mavl_t const self,             \
                                            T *const data) {                    \
-    ID##_mavl_node_t self_node = malloc(sizeof *self_node);                    \
+    ID##_mavl_node_t self_node = self->node_cache;                             \
                                                                                \
-    if (self_node == NULL) {                                                   \
-      return self->nil;                                                        \
+    if (self_node != NULL) {                                                   \
+      self->node_cache = self_node->right;                                     \
+      --(self->cached_nodes);                                                  \
+    } else {                                                                   \
+      self_node = ID##_internal_mavl_malloc(sizeof *self_node);                \
+                                                                               \
+      if (self_node == NULL) {                                                 \
+        return self->nil;                                                      \
+      }                                                                        \
     }                                                                          \
                                                                                \
     self_node->left = self_node->right = self_node->parent = self->nil;        \
     self_node->count = 1;                                                      \
+    self_node->weight = 1;                                                     \
     self_node->height = 1;                                                     \
     self_node->data = *data;                                                   \
                                                                                \
     return self_node;                                                          \
   }                                                                            \
                                                                                \
+  void ID##_internal_mavl_node_release(ID##_mavl_t const self,                 \
+                                      ID##_mavl_node_t const self_node) {      \
+    if (self->cached_nodes < self->node_cache_cap) {                           \
+      self_node->right = self->node_cache;                                     \
+      self->node_cache = self_node;                                            \
+      ++(self->cached_nodes);                                                  \
+    } else {                                                                   \
+      ID##_internal_mavl_free(self_node);                                      \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
   void ID##_internal_mavl_free_help(const ID##_mavl_ptr_t *const self,         \
                                     ID##_mavl_node_t *self_node) {             \
     if (*self_node == self->nil) {                                             \
@@ -127,15 +161,22 @@
       self->frd(&(*self_node)->data);                                          \
     }                                                                          \
                                                                                \
-    free(*self_node);                                                          \
+    ID##_internal_mavl_free(*self_node);                                       \
     *self_node = self->nil;                                                    \
   }                                                                            \
                                                                                \
   merr_t ID##_mavl_free(ID##_mavl_t *self) {                                   \
     if ((self != NULL) && (*self != NULL)) {                                   \
       ID##_internal_mavl_free_help(*self, &(*self)->root);                     \
-      free((*self)->nil);                                                      \
-      free(*self);                                                             \
+                                                                               \
+      while ((*self)->node_cache != NULL) {                                    \
+        ID##_mavl_node_t next_node = (*self)->node_cache->right;               \
+        ID##_internal_mavl_free((*self)->node_cache);                          \
+        (*self)->node_cache = next_node;                                       \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mavl_free((*self)->nil);                                   \
+      ID##_internal_mavl_free(*self);                                          \
       *self = NULL;                                                            \
                                                                                \
       return M_OK;                                                             \
@@ -150,6 +191,11 @@
       self_node->height =                                                      \
           MAVL_MAX_VALUES(self_node->left->height, self_node->right->height) + \
           1;                                                                   \
+                                                                               \
+      if (self->order_stats == mtrue) {                                        \
+        self_node->weight = self_node->left->weight +                          \
+                            self_node->right->weight + self_node->count;       \
+      }                                                                        \
     }                                                                          \
   }                                                                            \
                                                                                \
@@ -223,6 +269,12 @@
     ID##_internal_mavl_upheight(self, temp);                                   \
   }
 
+/**
+ * @brief Defines the `mavl` structure with the standard library
+ * allocator, see `MAVL_WITH_ALLOC`.
+ */
+#define MAVL(ID, T) MAVL_WITH_ALLOC(ID, T, m_stdlib)
+
 /**
  * @brief Checks whether a binary
  * searc tree object is empty or not.
@@ -540,6 +592,14 @@
         iterator = iterator->right;                                            \
       } else {                                                                 \
         ++(iterator->count);                                                   \
+                                                                               \
+        if (self->order_stats == mtrue) {                                      \
+          for (ID##_mavl_node_t node = iterator; node != self->nil;            \
+               node = node->parent) {                                          \
+            ++(node->weight);                                                  \
+          }                                                                    \
+        }                                                                      \
+                                                                               \
         return M_OK;                                                           \
       }                                                                        \
     }                                                                          \
@@ -728,7 +788,7 @@
       self->frd(&self_node->data);                                             \
     }                                                                          \
                                                                                \
-    free(self_node);                                                           \
+    ID##_internal_mavl_node_release(self, self_node);                          \
                                                                                \
     --(self->size);                                                            \
                                                                                \
@@ -857,6 +917,241 @@
     return M_OK;                                                               \
   }
 
+/**
+ * @brief Builds the tree from an array sorted in ascending order (according to
+ * the compare function) in O(N) time, instead of N pushes. The nodes are linked
+ * into a perfectly balanced tree, every height is set while linking. Equal
+ * neighbour elements are merged into one node, as the push method does. The
+ * tree must be empty.
+ */
+#define MAVL_BUILD_SORTED(ID, T)                                               \
+  ID##_mavl_node_t ID##_internal_mavl_build_sorted(                            \
+      const ID##_mavl_ptr_t *const self, ID##_mavl_node_t *const chain,        \
+      size_t number_of_nodes) {                                                \
+    if (number_of_nodes == 0) {                                                \
+      return self->nil;                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mavl_node_t left_node = ID##_internal_mavl_build_sorted(              \
+        self, chain, number_of_nodes / 2);                                     \
+                                                                               \
+    ID##_mavl_node_t root = *chain;                                            \
+    *chain = root->right;                                                      \
+                                                                               \
+    ID##_mavl_node_t right_node = ID##_internal_mavl_build_sorted(             \
+        self, chain, number_of_nodes - number_of_nodes / 2 - 1);               \
+                                                                               \
+    root->left = left_node;                                                    \
+    root->right = right_node;                                                  \
+    root->parent = self->nil;                                                  \
+                                                                               \
+    if (left_node != self->nil) {                                              \
+      left_node->parent = root;                                                \
+    }                                                                          \
+                                                                               \
+    if (right_node != self->nil) {                                             \
+      right_node->parent = root;                                               \
+    }                                                                          \
+                                                                               \
+    root->weight = left_node->weight + right_node->weight + root->count;       \
+    root->height =                                                             \
+        MAVL_MAX_VALUES(left_node->height, right_node->height) + 1;            \
+                                                                               \
+    return root;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mavl_build_sorted(const ID##_mavl_t self, const T *const arr,    \
+                               size_t number_of_elem) {                        \
+    if ((self == NULL) || ((arr == NULL) && (number_of_elem != 0))) {          \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size != 0) {                                                     \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    size_t number_of_nodes = 0;                                                \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      int32_t cmp = (iter == 0) ? -1 : self->cmp(&arr[iter - 1], &arr[iter]);  \
+                                                                               \
+      if (cmp > 0) {                                                           \
+        return M_INVALID_INPUT;                                                \
+      }                                                                        \
+                                                                               \
+      if (cmp < 0) {                                                           \
+        ++number_of_nodes;                                                     \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mavl_node_t chain = self->nil;                                        \
+    ID##_mavl_node_t last_node = self->nil;                                    \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      if ((last_node != self->nil) &&                                          \
+          (self->cmp(&last_node->data, &arr[iter]) == 0)) {                    \
+        ++(last_node->count);                                                  \
+        continue;                                                              \
+      }                                                                        \
+                                                                               \
+      T data = arr[iter];                                                      \
+      ID##_mavl_node_t self_node = ID##_internal_mavl_node(self, &data);       \
+                                                                               \
+      if (self_node == self->nil) {                                            \
+        while (chain != self->nil) {                                           \
+          ID##_mavl_node_t next_node = chain->right;                           \
+          ID##_internal_mavl_free(chain);                                      \
+          chain = next_node;                                                   \
+        }                                                                      \
+                                                                               \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+                                                                               \
+      if (last_node == self->nil) {                                            \
+        chain = self_node;                                                     \
+      } else {                                                                 \
+        last_node->right = self_node;                                          \
+      }                                                                        \
+                                                                               \
+      last_node = self_node;                                                   \
+    }                                                                          \
+                                                                               \
+    self->root =                                                               \
+        ID##_internal_mavl_build_sorted(self, &chain, number_of_nodes);        \
+    self->size = number_of_nodes;                                              \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Makes every node keep the number of elements of its subtree (equal
+ * elements are counted separately), so that the k-th smallest element and the
+ * rank of a data are found in O(logN) time. The weights are kept up to date by
+ * every push, pop and rotation.
+ */
+#define MAVL_ORDER_STATS(ID, T)                                                \
+  size_t ID##_internal_mavl_order_stats(const ID##_mavl_ptr_t *const self,     \
+                                       ID##_mavl_node_t const self_node) {     \
+    if (self_node == self->nil) {                                              \
+      return 0;                                                                \
+    }                                                                          \
+                                                                               \
+    size_t left_weight = ID##_internal_mavl_order_stats(self, self_node->left);\
+    size_t right_weight =                                                      \
+        ID##_internal_mavl_order_stats(self, self_node->right);                \
+                                                                               \
+    self_node->weight = left_weight + right_weight + self_node->count;         \
+                                                                               \
+    return self_node->weight;                                                  \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mavl_use_order_stats(ID##_mavl_t const self) {                   \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->order_stats == mfalse) {                                         \
+      ID##_internal_mavl_order_stats(self, self->root);                        \
+      self->order_stats = mtrue;                                               \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  size_t ID##_mavl_total_count(const ID##_mavl_ptr_t *const self) {            \
+    if ((self == NULL) || (self->order_stats == mfalse)) {                     \
+      return 0;                                                                \
+    }                                                                          \
+                                                                               \
+    return self->root->weight;                                                 \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mavl_select(const ID##_mavl_ptr_t *const self, size_t k,         \
+                         T *const acc) {                                       \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->order_stats == mfalse) {                                         \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    ID##_mavl_node_t iterator = self->root;                                    \
+                                                                               \
+    while (iterator != self->nil) {                                            \
+      if (k < iterator->left->weight) {                                        \
+        iterator = iterator->left;                                             \
+      } else if (k < iterator->left->weight + iterator->count) {               \
+        *acc = iterator->data;                                                 \
+        return M_OK;                                                           \
+      } else {                                                                 \
+        k -= iterator->left->weight + iterator->count;                         \
+        iterator = iterator->right;                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_IDX_OVERFLOW;                                                     \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mavl_rank(const ID##_mavl_ptr_t *const self, T data,             \
+                       size_t *const acc) {                                    \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->order_stats == mfalse) {                                         \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    ID##_mavl_node_t iterator = self->root;                                    \
+    size_t rank = 0;                                                           \
+                                                                               \
+    while (iterator != self->nil) {                                            \
+      int32_t cmp = self->cmp(&iterator->data, &data);                         \
+                                                                               \
+      if (cmp > 0) {                                                           \
+        iterator = iterator->left;                                             \
+      } else {                                                                 \
+        rank += iterator->left->weight;                                        \
+                                                                               \
+        if (cmp == 0) {                                                        \
+          break;                                                               \
+        }                                                                      \
+                                                                               \
+        rank += iterator->count;                                               \
+        iterator = iterator->right;                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    *acc = rank;                                                               \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Keeps up to `capacity` nodes of the popped elements in a free list of
+ * the object and reuses them for the next pushes, so a steady stream of pushes
+ * and pops does not call the allocator. The cache is off (`capacity` 0) for a
+ * new object, a smaller capacity frees the nodes above it.
+ */
+#define MAVL_NODE_CACHE(ID, T)                                                 \
+  merr_t ID##_mavl_node_cache(ID##_mavl_t const self, size_t capacity) {       \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    self->node_cache_cap = capacity;                                           \
+                                                                               \
+    while (self->cached_nodes > capacity) {                                    \
+      ID##_mavl_node_t next_node = self->node_cache->right;                    \
+      ID##_internal_mavl_free(self->node_cache);                               \
+      self->node_cache = next_node;                                            \
+      --(self->cached_nodes);                                                  \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 /**
  * @brief Adds the all API for the `mavl_t` structure (binary search tree). You
  * will not be always need to use all the API, in this case you must be sure
@@ -867,8 +1162,8 @@
  * different ids for the same type. The ID protocol is used when different files
  * want to have the same two typed structures in order to avoid name collisions.
  */
-#define MAVL_ALL(ID, T)                                                        \
-  MAVL(ID, T)                                                                  \
+#define MAVL_ALL_WITH_ALLOC(ID, T, ALLOC)                                      \
+  MAVL_WITH_ALLOC(ID, T, ALLOC)                                                \
   MAVL_EMPTY(ID, T)                                                            \
   MAVL_SIZE(ID, T)                                                             \
   MAVL_ROOT(ID, T)                                                             \
@@ -883,6 +1178,15 @@
   MAVL_POP(ID, T)                                                              \
   MAVL_TRAVERSE_INORDER(ID, T)                                                 \
   MAVL_TRAVERSE_PREORDER(ID, T)                                                \
-  MAVL_TRAVERSE_POSTORDER(ID, T)
+  MAVL_TRAVERSE_POSTORDER(ID, T)                                               \
+  MAVL_BUILD_SORTED(ID, T)                                                     \
+  MAVL_ORDER_STATS(ID, T)                                                      \
+  MAVL_NODE_CACHE(ID, T)
+
+/**
+ * @brief Adds the all API for the `mavl` structure with the standard
+ * library allocator, see `MAVL_ALL_WITH_ALLOC`.
+ */
+#define MAVL_ALL(ID, T) MAVL_ALL_WITH_ALLOC(ID, T, m_stdlib)
 
 #endif /* MACROS_GENERIC_AVL_BINARY_SEARCH_TREE_UTILS_H_ */
@@ -0,0 +1,1040 @@
+/**
+ * @file m_bptree.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2023-06-12
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of c-language-data-structures.
+ *
+ * c-language-data-structures is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * c-language-data-structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with c-language-data-structures.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MACROS_GENERICS_BPLUS_TREE_UTILS_H_
+#define MACROS_GENERICS_BPLUS_TREE_UTILS_H_
+
+#include "./m_config.h"
+
+/**
+ * @brief Utility file containing macros that generate functions for generic
+ * B+ tree. The elements are kept sorted in the leaves, which are linked for
+ * range scans, and the inner nodes keep copies of the smallest element of
+ * their subtrees. The number of elements of a node is chosen so that a node
+ * fits in MBPTREE_NODE_SIZE bytes (a few cache lines), it can be changed by
+ * defining MBPTREE_NODE_SIZE before including the file.
+ *
+ * @param ID the id of the structure in order to reduce name collisions.
+ * @param T the type of the data stored inside the structure.
+ */
+
+#ifndef MBPTREE_NODE_SIZE
+#define MBPTREE_NODE_SIZE 512
+#endif /* MBPTREE_NODE_SIZE */
+
+#define MBPTREE_MIN_KEYS 4
+#define MBPTREE_MAX_HEIGHT 64
+
+/**
+ * @brief Generates the `mbptree_t` structure depending on the name and type.
+ * Also generates basic function for creation and freeing memory for the
+ * structure. This structure require a method for comparing data and for freeing
+ * data memory, if data is not stored as a pointer (T <=> *M), then the free
+ * function must be `NULL`. If data represents a structure which contains
+ * pointers allocated, then the free function must free those fields.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
+ */
+#define MBPTREE_WITH_ALLOC(ID, T, ALLOC)                                       \
+  M_ALLOC(ID, mbptree, ALLOC)                                                  \
+                                                                               \
+  CMP_FUNC(ID, T)                                                              \
+  FREE_FUNC(ID, T)                                                             \
+                                                                               \
+  enum {                                                                       \
+    ID##_MBPTREE_LEAF_KEYS =                                                   \
+        ((MBPTREE_NODE_SIZE - 3 * sizeof(void *)) / sizeof(T) >                \
+         MBPTREE_MIN_KEYS)                                                     \
+            ? (MBPTREE_NODE_SIZE - 3 * sizeof(void *)) / sizeof(T)             \
+            : MBPTREE_MIN_KEYS,                                                \
+    ID##_MBPTREE_INNER_KEYS =                                                  \
+        ((MBPTREE_NODE_SIZE - 4 * sizeof(void *)) /                            \
+             (sizeof(T) + sizeof(void *)) >                                    \
+         MBPTREE_MIN_KEYS)                                                     \
+            ? (MBPTREE_NODE_SIZE - 4 * sizeof(void *)) /                       \
+                  (sizeof(T) + sizeof(void *))                                 \
+            : MBPTREE_MIN_KEYS                                                 \
+  };                                                                           \
+                                                                               \
+  typedef struct ID##_mbptree_node_s {                                         \
+    struct ID##_mbptree_node_s *next;                                          \
+    struct ID##_mbptree_node_s *prev;                                          \
+    uint32_t count;                                                            \
+    mbool_t is_leaf;                                                           \
+    union {                                                                    \
+      T leaf_keys[ID##_MBPTREE_LEAF_KEYS];                                     \
+      struct {                                                                 \
+        T keys[ID##_MBPTREE_INNER_KEYS];                                       \
+        struct ID##_mbptree_node_s *children[ID##_MBPTREE_INNER_KEYS + 1];     \
+      } inner;                                                                 \
+    } u;                                                                       \
+  } ID##_mbptree_node_ptr_t, *ID##_mbptree_node_t;                             \
+                                                                               \
+  typedef struct ID##_mbptree_s {                                              \
+    ID##_mbptree_node_t root;                                                  \
+    ID##_mbptree_node_t head;                                                  \
+    ID##_mbptree_node_t tail;                                                  \
+    ID##_compare_func cmp;                                                     \
+    ID##_free_func frd;                                                        \
+    size_t size;                                                               \
+    size_t height;                                                             \
+  } ID##_mbptree_ptr_t, *ID##_mbptree_t;                                       \
+                                                                               \
+  ID##_mbptree_t ID##_mbptree(ID##_compare_func cmp, ID##_free_func frd) {     \
+    if (NULL == cmp) {                                                         \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_t self = ID##_internal_mbptree_malloc(sizeof *self);          \
+                                                                               \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->cmp = cmp;                                                           \
+    self->frd = frd;                                                           \
+                                                                               \
+    self->root = self->head = self->tail = NULL;                               \
+    self->size = 0;                                                            \
+    self->height = 0;                                                          \
+                                                                               \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
+  ID##_mbptree_node_t ID##_internal_mbptree_node(mbool_t is_leaf) {            \
+    ID##_mbptree_node_t self_node =                                            \
+        ID##_internal_mbptree_malloc(sizeof *self_node);                       \
+                                                                               \
+    if (self_node != NULL) {                                                   \
+      self_node->next = self_node->prev = NULL;                                \
+      self_node->count = 0;                                                    \
+      self_node->is_leaf = is_leaf;                                            \
+    }                                                                          \
+                                                                               \
+    return self_node;                                                          \
+  }                                                                            \
+                                                                               \
+  T *ID##_internal_mbptree_keys(ID##_mbptree_node_ptr_t *const self_node) {    \
+    if (self_node->is_leaf == mtrue) {                                         \
+      return self_node->u.leaf_keys;                                           \
+    }                                                                          \
+                                                                               \
+    return self_node->u.inner.keys;                                            \
+  }                                                                            \
+                                                                               \
+  size_t ID##_internal_mbptree_bound(const ID##_mbptree_ptr_t *const self,     \
+                                     ID##_mbptree_node_ptr_t *const self_node, \
+                                     const T *const data, mbool_t strict) {    \
+    const T *const keys = ID##_internal_mbptree_keys(self_node);               \
+    size_t left = 0;                                                           \
+    size_t right = self_node->count;                                           \
+                                                                               \
+    while (left < right) {                                                     \
+      size_t middle = left + (right - left) / 2;                               \
+      int32_t cmp = self->cmp(&keys[middle], data);                            \
+                                                                               \
+      if ((cmp < 0) || ((cmp == 0) && (strict == mtrue))) {                    \
+        left = middle + 1;                                                     \
+      } else {                                                                 \
+        right = middle;                                                        \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return left;                                                               \
+  }                                                                            \
+                                                                               \
+  ID##_mbptree_node_t ID##_internal_mbptree_find_leaf(                         \
+      const ID##_mbptree_ptr_t *const self, const T *const data,               \
+      ID##_mbptree_node_t *const path, size_t *const child_index) {            \
+    ID##_mbptree_node_t self_node = self->root;                                \
+    size_t depth = 0;                                                          \
+                                                                               \
+    while (self_node->is_leaf == mfalse) {                                     \
+      size_t index =                                                           \
+          ID##_internal_mbptree_bound(self, self_node, data, mtrue);           \
+                                                                               \
+      if (path != NULL) {                                                      \
+        path[depth] = self_node;                                               \
+        child_index[depth] = index;                                            \
+      }                                                                        \
+                                                                               \
+      ++depth;                                                                 \
+      self_node = self_node->u.inner.children[index];                          \
+    }                                                                          \
+                                                                               \
+    return self_node;                                                          \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mbptree_free_help(const ID##_mbptree_ptr_t *const self,   \
+                                       ID##_mbptree_node_t self_node) {        \
+    if (self_node->is_leaf == mfalse) {                                        \
+      for (size_t iter = 0; iter <= self_node->count; ++iter) {                \
+        ID##_internal_mbptree_free_help(self,                                  \
+                                        self_node->u.inner.children[iter]);    \
+      }                                                                        \
+    } else if (self->frd != NULL) {                                            \
+      for (size_t iter = 0; iter < self_node->count; ++iter) {                 \
+        self->frd(&self_node->u.leaf_keys[iter]);                              \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mbptree_free(self_node);                                     \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbptree_free(ID##_mbptree_t *self) {                             \
+    if ((self != NULL) && (*self != NULL)) {                                   \
+      if ((*self)->root != NULL) {                                             \
+        ID##_internal_mbptree_free_help(*self, (*self)->root);                 \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mbptree_free(*self);                                       \
+      *self = NULL;                                                            \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    return M_FREE_NULL;                                                        \
+  }
+
+/**
+ * @brief Defines the `mbptree` structure with the standard library
+ * allocator, see `MBPTREE_WITH_ALLOC`.
+ */
+#define MBPTREE(ID, T) MBPTREE_WITH_ALLOC(ID, T, m_stdlib)
+
+/**
+ * @brief Checks whether a B+ tree object is empty or not.
+ */
+#define MBPTREE_EMPTY(ID, T)                                                   \
+  mbool_t ID##_mbptree_empty(const ID##_mbptree_ptr_t *const self) {           \
+    if ((self == NULL) || (self->root == NULL) || (self->size == 0)) {         \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }
+
+/**
+ * @brief Fetches the number of elements of the B+ tree.
+ */
+#define MBPTREE_SIZE(ID, T)                                                    \
+  size_t ID##_mbptree_size(const ID##_mbptree_ptr_t *const self) {             \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->size;                                                         \
+  }
+
+/**
+ * @brief Finds a data inside the B+ tree, one node is read for every level of
+ * the tree and the elements of a node are searched by binary search. The
+ * accumulator is optional, as for the mrbk_find method.
+ */
+#define MBPTREE_FIND(ID, T)                                                    \
+  merr_t ID##_mbptree_find(const ID##_mbptree_ptr_t *const self, T data,       \
+                           T *const acc) {                                     \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->root == NULL) {                                                  \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_node_t leaf =                                                 \
+        ID##_internal_mbptree_find_leaf(self, &data, NULL, NULL);              \
+    size_t position = ID##_internal_mbptree_bound(self, leaf, &data, mfalse);  \
+                                                                               \
+    if ((position == leaf->count) ||                                           \
+        (self->cmp(&leaf->u.leaf_keys[position], &data) != 0)) {               \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    if (acc != NULL) {                                                         \
+      *acc = leaf->u.leaf_keys[position];                                      \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Fetches the smallest data of the B+ tree in O(1), from the first
+ * leaf.
+ */
+#define MBPTREE_MIN(ID, T)                                                     \
+  merr_t ID##_mbptree_min(const ID##_mbptree_ptr_t *const self,                \
+                          T *const acc) {                                      \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->head == NULL) {                                                  \
+      return M_EMPTY_STRUCTURE;                                                \
+    }                                                                          \
+                                                                               \
+    *acc = self->head->u.leaf_keys[0];                                         \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Fetches the greatest data of the B+ tree in O(1), from the last
+ * leaf.
+ */
+#define MBPTREE_MAX(ID, T)                                                     \
+  merr_t ID##_mbptree_max(const ID##_mbptree_ptr_t *const self,                \
+                          T *const acc) {                                      \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->tail == NULL) {                                                  \
+      return M_EMPTY_STRUCTURE;                                                \
+    }                                                                          \
+                                                                               \
+    *acc = self->tail->u.leaf_keys[self->tail->count - 1];                     \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Inserts a data into the B+ tree. A full leaf is split in two halves
+ * and the smallest element of the new half goes into the parent, which may
+ * split in turn up to the root. All the nodes needed by the splits are
+ * allocated before the tree is changed. A data equal to a stored one is not
+ * stored again.
+ */
+#define MBPTREE_PUSH(ID, T)                                                    \
+  void ID##_internal_mbptree_inner_insert(ID##_mbptree_node_t const self_node, \
+                                          size_t key_index, const T *const key,\
+                                          ID##_mbptree_node_t const child) {   \
+    T *const keys = self_node->u.inner.keys;                                   \
+    ID##_mbptree_node_t *const children = self_node->u.inner.children;         \
+                                                                               \
+    memmove(&keys[key_index + 1], &keys[key_index],                            \
+            (self_node->count - key_index) * sizeof(T));                       \
+    keys[key_index] = *key;                                                    \
+                                                                               \
+    memmove(&children[key_index + 2], &children[key_index + 1],                \
+            (self_node->count - key_index) * sizeof(*children));               \
+    children[key_index + 1] = child;                                           \
+                                                                               \
+    ++(self_node->count);                                                      \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbptree_push(ID##_mbptree_t const self, T data) {                \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->root == NULL) {                                                  \
+      self->root = ID##_internal_mbptree_node(mtrue);                          \
+                                                                               \
+      if (self->root == NULL) {                                                \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+                                                                               \
+      self->head = self->tail = self->root;                                    \
+      self->height = 1;                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_node_t path[MBPTREE_MAX_HEIGHT];                              \
+    size_t child_index[MBPTREE_MAX_HEIGHT];                                    \
+    size_t depth = self->height - 1;                                           \
+                                                                               \
+    ID##_mbptree_node_t leaf =                                                 \
+        ID##_internal_mbptree_find_leaf(self, &data, path, child_index);       \
+    size_t position = ID##_internal_mbptree_bound(self, leaf, &data, mfalse);  \
+                                                                               \
+    if ((position < leaf->count) &&                                            \
+        (self->cmp(&leaf->u.leaf_keys[position], &data) == 0)) {               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    if (leaf->count < ID##_MBPTREE_LEAF_KEYS) {                                \
+      memmove(&leaf->u.leaf_keys[position + 1], &leaf->u.leaf_keys[position],  \
+              (leaf->count - position) * sizeof(T));                           \
+      leaf->u.leaf_keys[position] = data;                                      \
+                                                                               \
+      ++(leaf->count);                                                         \
+      ++(self->size);                                                          \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t number_of_splits = 0;                                               \
+                                                                               \
+    while ((number_of_splits < depth) &&                                       \
+           (path[depth - 1 - number_of_splits]->count ==                       \
+            ID##_MBPTREE_INNER_KEYS)) {                                        \
+      ++number_of_splits;                                                      \
+    }                                                                          \
+                                                                               \
+    size_t number_of_nodes =                                                   \
+        number_of_splits + 1 + ((number_of_splits == depth) ? 1 : 0);          \
+                                                                               \
+    ID##_mbptree_node_t new_nodes[MBPTREE_MAX_HEIGHT + 1];                     \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_nodes; ++iter) {                    \
+      new_nodes[iter] =                                                        \
+          ID##_internal_mbptree_node((iter == 0) ? mtrue : mfalse);            \
+                                                                               \
+      if (new_nodes[iter] == NULL) {                                           \
+        while (iter > 0) {                                                     \
+          ID##_internal_mbptree_free(new_nodes[--iter]);                       \
+        }                                                                      \
+                                                                               \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_node_t new_leaf = new_nodes[0];                               \
+    const size_t left_count = (ID##_MBPTREE_LEAF_KEYS + 1) / 2;                \
+                                                                               \
+    memcpy(new_leaf->u.leaf_keys, &leaf->u.leaf_keys[left_count],              \
+           (leaf->count - left_count) * sizeof(T));                            \
+    new_leaf->count = (uint32_t)(leaf->count - left_count);                    \
+    leaf->count = (uint32_t)left_count;                                        \
+                                                                               \
+    ID##_mbptree_node_t insert_leaf = leaf;                                    \
+                                                                               \
+    if (position > left_count) {                                               \
+      insert_leaf = new_leaf;                                                  \
+      position -= left_count;                                                  \
+    }                                                                          \
+                                                                               \
+    memmove(&insert_leaf->u.leaf_keys[position + 1],                           \
+            &insert_leaf->u.leaf_keys[position],                               \
+            (insert_leaf->count - position) * sizeof(T));                      \
+    insert_leaf->u.leaf_keys[position] = data;                                 \
+    ++(insert_leaf->count);                                                    \
+                                                                               \
+    new_leaf->next = leaf->next;                                               \
+    new_leaf->prev = leaf;                                                     \
+                                                                               \
+    if (leaf->next != NULL) {                                                  \
+      leaf->next->prev = new_leaf;                                             \
+    } else {                                                                   \
+      self->tail = new_leaf;                                                   \
+    }                                                                          \
+                                                                               \
+    leaf->next = new_leaf;                                                     \
+                                                                               \
+    T separator = new_leaf->u.leaf_keys[0];                                    \
+    ID##_mbptree_node_t right_node = new_leaf;                                 \
+                                                                               \
+    for (size_t iter = 1; iter <= number_of_splits; ++iter) {                  \
+      ID##_mbptree_node_t self_node = path[--depth];                           \
+      ID##_mbptree_node_t new_node = new_nodes[iter];                          \
+      const size_t middle = ID##_MBPTREE_INNER_KEYS / 2;                       \
+      const size_t key_index = child_index[depth];                             \
+      const T up_key = self_node->u.inner.keys[middle];                        \
+                                                                               \
+      memcpy(new_node->u.inner.keys, &self_node->u.inner.keys[middle + 1],     \
+             (self_node->count - middle - 1) * sizeof(T));                     \
+      memcpy(new_node->u.inner.children,                                       \
+             &self_node->u.inner.children[middle + 1],                         \
+             (self_node->count - middle) * sizeof(ID##_mbptree_node_t));       \
+      new_node->count = (uint32_t)(self_node->count - middle - 1);             \
+      self_node->count = (uint32_t)middle;                                     \
+                                                                               \
+      if (key_index <= middle) {                                               \
+        ID##_internal_mbptree_inner_insert(self_node, key_index, &separator,   \
+                                           right_node);                        \
+      } else {                                                                 \
+        ID##_internal_mbptree_inner_insert(new_node, key_index - middle - 1,   \
+                                           &separator, right_node);            \
+      }                                                                        \
+                                                                               \
+      separator = up_key;                                                      \
+      right_node = new_node;                                                   \
+    }                                                                          \
+                                                                               \
+    if (depth == 0) {                                                          \
+      ID##_mbptree_node_t new_root = new_nodes[number_of_nodes - 1];           \
+                                                                               \
+      new_root->u.inner.keys[0] = separator;                                   \
+      new_root->u.inner.children[0] = self->root;                              \
+      new_root->u.inner.children[1] = right_node;                              \
+      new_root->count = 1;                                                     \
+                                                                               \
+      self->root = new_root;                                                   \
+      ++(self->height);                                                        \
+    } else {                                                                   \
+      ID##_internal_mbptree_inner_insert(path[depth - 1],                      \
+                                         child_index[depth - 1], &separator,   \
+                                         right_node);                          \
+    }                                                                          \
+                                                                               \
+    ++(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Removes a data from the B+ tree. The separator that copied the data
+ * is replaced by the next element of the leaf, and a node left less than half
+ * full borrows an element from a sibling or is merged with it, up to the root.
+ */
+#define MBPTREE_POP(ID, T)                                                     \
+  void ID##_internal_mbptree_inner_remove(ID##_mbptree_node_t const self_node, \
+                                          size_t key_index) {                  \
+    T *const keys = self_node->u.inner.keys;                                   \
+    ID##_mbptree_node_t *const children = self_node->u.inner.children;         \
+                                                                               \
+    memmove(&keys[key_index], &keys[key_index + 1],                            \
+            (self_node->count - key_index - 1) * sizeof(T));                   \
+    memmove(&children[key_index + 1], &children[key_index + 2],                \
+            (self_node->count - key_index - 1) * sizeof(*children));           \
+                                                                               \
+    --(self_node->count);                                                      \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mbptree_rebalance(ID##_mbptree_t const self,              \
+                                       ID##_mbptree_node_t const parent,       \
+                                       size_t index) {                         \
+    ID##_mbptree_node_t *const parent_children = parent->u.inner.children;     \
+    T *const parent_keys = parent->u.inner.keys;                               \
+    ID##_mbptree_node_t self_node = parent_children[index];                    \
+    ID##_mbptree_node_t left =                                                 \
+        (index != 0) ? parent_children[index - 1] : NULL;                      \
+    ID##_mbptree_node_t right =                                                \
+        (index < parent->count) ? parent_children[index + 1] : NULL;           \
+                                                                               \
+    if (self_node->is_leaf == mtrue) {                                         \
+      const size_t min_keys = ID##_MBPTREE_LEAF_KEYS / 2;                      \
+      T *const keys = self_node->u.leaf_keys;                                  \
+                                                                               \
+      if ((left != NULL) && (left->count > min_keys)) {                        \
+        memmove(&keys[1], &keys[0], self_node->count * sizeof(T));             \
+        keys[0] = left->u.leaf_keys[left->count - 1];                          \
+                                                                               \
+        --(left->count);                                                       \
+        ++(self_node->count);                                                  \
+                                                                               \
+        parent_keys[index - 1] = keys[0];                                      \
+      } else if ((right != NULL) && (right->count > min_keys)) {               \
+        keys[self_node->count] = right->u.leaf_keys[0];                        \
+        memmove(&right->u.leaf_keys[0], &right->u.leaf_keys[1],                \
+                (right->count - 1) * sizeof(T));                               \
+                                                                               \
+        --(right->count);                                                      \
+        ++(self_node->count);                                                  \
+                                                                               \
+        parent_keys[index] = right->u.leaf_keys[0];                            \
+      } else {                                                                 \
+        ID##_mbptree_node_t merge_left = (left != NULL) ? left : self_node;    \
+        ID##_mbptree_node_t merge_right = (left != NULL) ? self_node : right;  \
+                                                                               \
+        memcpy(&merge_left->u.leaf_keys[merge_left->count],                    \
+               merge_right->u.leaf_keys, merge_right->count * sizeof(T));      \
+        merge_left->count += merge_right->count;                               \
+                                                                               \
+        merge_left->next = merge_right->next;                                  \
+                                                                               \
+        if (merge_right->next != NULL) {                                       \
+          merge_right->next->prev = merge_left;                                \
+        } else {                                                               \
+          self->tail = merge_left;                                             \
+        }                                                                      \
+                                                                               \
+        ID##_internal_mbptree_inner_remove(parent,                             \
+                                           (left != NULL) ? index - 1 : index);\
+        ID##_internal_mbptree_free(merge_right);                               \
+      }                                                                        \
+    } else {                                                                   \
+      const size_t min_keys = (ID##_MBPTREE_INNER_KEYS - 1) / 2;               \
+      T *const keys = self_node->u.inner.keys;                                 \
+      ID##_mbptree_node_t *const children = self_node->u.inner.children;       \
+                                                                               \
+      if ((left != NULL) && (left->count > min_keys)) {                        \
+        memmove(&keys[1], &keys[0], self_node->count * sizeof(T));             \
+        memmove(&children[1], &children[0],                                    \
+                (self_node->count + 1) * sizeof(*children));                   \
+                                                                               \
+        keys[0] = parent_keys[index - 1];                                      \
+        children[0] = left->u.inner.children[left->count];                     \
+        parent_keys[index - 1] = left->u.inner.keys[left->count - 1];          \
+                                                                               \
+        --(left->count);                                                       \
+        ++(self_node->count);                                                  \
+      } else if ((right != NULL) && (right->count > min_keys)) {               \
+        keys[self_node->count] = parent_keys[index];                           \
+        children[self_node->count + 1] = right->u.inner.children[0];           \
+        parent_keys[index] = right->u.inner.keys[0];                           \
+                                                                               \
+        memmove(&right->u.inner.keys[0], &right->u.inner.keys[1],              \
+                (right->count - 1) * sizeof(T));                               \
+        memmove(&right->u.inner.children[0], &right->u.inner.children[1],      \
+                right->count * sizeof(*children));                             \
+                                                                               \
+        --(right->count);                                                      \
+        ++(self_node->count);                                                  \
+      } else {                                                                 \
+        ID##_mbptree_node_t merge_left = (left != NULL) ? left : self_node;    \
+        ID##_mbptree_node_t merge_right = (left != NULL) ? self_node : right;  \
+        const size_t key_index = (left != NULL) ? index - 1 : index;           \
+                                                                               \
+        merge_left->u.inner.keys[merge_left->count] = parent_keys[key_index];  \
+        memcpy(&merge_left->u.inner.keys[merge_left->count + 1],               \
+               merge_right->u.inner.keys, merge_right->count * sizeof(T));     \
+        memcpy(&merge_left->u.inner.children[merge_left->count + 1],           \
+               merge_right->u.inner.children,                                  \
+               (merge_right->count + 1) * sizeof(*children));                  \
+        merge_left->count += merge_right->count + 1;                           \
+                                                                               \
+        ID##_internal_mbptree_inner_remove(parent, key_index);                 \
+        ID##_internal_mbptree_free(merge_right);                               \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbptree_pop(ID##_mbptree_t const self, T data) {                 \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->root == NULL) {                                                  \
+      return M_POP_FROM_EMPTY;                                                 \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_node_t path[MBPTREE_MAX_HEIGHT];                              \
+    size_t child_index[MBPTREE_MAX_HEIGHT];                                    \
+    size_t depth = self->height - 1;                                           \
+                                                                               \
+    ID##_mbptree_node_t leaf =                                                 \
+        ID##_internal_mbptree_find_leaf(self, &data, path, child_index);       \
+    size_t position = ID##_internal_mbptree_bound(self, leaf, &data, mfalse);  \
+                                                                               \
+    if ((position == leaf->count) ||                                           \
+        (self->cmp(&leaf->u.leaf_keys[position], &data) != 0)) {               \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    if (self->frd != NULL) {                                                   \
+      self->frd(&leaf->u.leaf_keys[position]);                                 \
+    }                                                                          \
+                                                                               \
+    memmove(&leaf->u.leaf_keys[position], &leaf->u.leaf_keys[position + 1],    \
+            (leaf->count - position - 1) * sizeof(T));                         \
+                                                                               \
+    --(leaf->count);                                                           \
+    --(self->size);                                                            \
+                                                                               \
+    if (leaf->count == 0) {                                                    \
+      ID##_internal_mbptree_free(leaf);                                        \
+                                                                               \
+      self->root = self->head = self->tail = NULL;                             \
+      self->height = 0;                                                        \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    if (position == 0) {                                                       \
+      for (size_t iter = depth; iter > 0; --iter) {                            \
+        if (child_index[iter - 1] != 0) {                                      \
+          path[iter - 1]->u.inner.keys[child_index[iter - 1] - 1] =            \
+              leaf->u.leaf_keys[0];                                            \
+          break;                                                               \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_node_t self_node = leaf;                                      \
+                                                                               \
+    while (depth > 0) {                                                        \
+      const size_t min_keys = (self_node->is_leaf == mtrue)                    \
+                                  ? ID##_MBPTREE_LEAF_KEYS / 2                 \
+                                  : (ID##_MBPTREE_INNER_KEYS - 1) / 2;         \
+                                                                               \
+      if (self_node->count >= min_keys) {                                      \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      --depth;                                                                 \
+      ID##_internal_mbptree_rebalance(self, path[depth], child_index[depth]);  \
+      self_node = path[depth];                                                 \
+    }                                                                          \
+                                                                               \
+    if ((self->root->is_leaf == mfalse) && (self->root->count == 0)) {         \
+      ID##_mbptree_node_t old_root = self->root;                               \
+                                                                               \
+      self->root = old_root->u.inner.children[0];                              \
+      --(self->height);                                                        \
+                                                                               \
+      ID##_internal_mbptree_free(old_root);                                    \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Fetches the first data of the B+ tree that is not smaller than data
+ * (strict is mfalse) or that is greater than data (strict is mtrue), together
+ * with its leaf and its position in the leaf.
+ */
+#define MBPTREE_SEEK(ID, T)                                                    \
+  ID##_mbptree_node_t ID##_internal_mbptree_seek(                              \
+      const ID##_mbptree_ptr_t *const self, const T *const data,               \
+      mbool_t strict, size_t *const position) {                                \
+    ID##_mbptree_node_t leaf =                                                 \
+        ID##_internal_mbptree_find_leaf(self, data, NULL, NULL);               \
+                                                                               \
+    *position = ID##_internal_mbptree_bound(self, leaf, data, strict);         \
+                                                                               \
+    if (*position == leaf->count) {                                            \
+      *position = 0;                                                           \
+      return leaf->next;                                                       \
+    }                                                                          \
+                                                                               \
+    return leaf;                                                               \
+  }
+
+/**
+ * @brief Fetches the first data of the B+ tree that is not smaller than data.
+ * If all the elements are smaller the method returns `M_NOT_FOUND`.
+ */
+#define MBPTREE_LOWER_BOUND(ID, T)                                             \
+  merr_t ID##_mbptree_lower_bound(const ID##_mbptree_ptr_t *const self, T data,\
+                                  T *const acc) {                              \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->root == NULL) {                                                  \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    size_t position = 0;                                                       \
+    ID##_mbptree_node_t leaf =                                                 \
+        ID##_internal_mbptree_seek(self, &data, mfalse, &position);            \
+                                                                               \
+    if (leaf == NULL) {                                                        \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    *acc = leaf->u.leaf_keys[position];                                        \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Fetches the first data of the B+ tree that is greater than data.
+ * If no element is greater the method returns `M_NOT_FOUND`.
+ */
+#define MBPTREE_UPPER_BOUND(ID, T)                                             \
+  merr_t ID##_mbptree_upper_bound(const ID##_mbptree_ptr_t *const self, T data,\
+                                  T *const acc) {                              \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->root == NULL) {                                                  \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    size_t position = 0;                                                       \
+    ID##_mbptree_node_t leaf =                                                 \
+        ID##_internal_mbptree_seek(self, &data, mtrue, &position);             \
+                                                                               \
+    if (leaf == NULL) {                                                        \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    *acc = leaf->u.leaf_keys[position];                                        \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Calls the action on every data of the half-open interval [lo, hi) in
+ * ascending order. The first data is searched once, then the scan walks the
+ * linked leaves, so it takes O(logN + K) time.
+ */
+#define MBPTREE_RANGE(ID, T)                                                   \
+  ACTION_FUNC(ID, T)                                                           \
+                                                                               \
+  merr_t ID##_mbptree_range(const ID##_mbptree_ptr_t *const self, T lo, T hi,  \
+                            ID##_action_func action) {                         \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->root == NULL) {                                                  \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t position = 0;                                                       \
+    ID##_mbptree_node_t leaf =                                                 \
+        ID##_internal_mbptree_seek(self, &lo, mfalse, &position);              \
+                                                                               \
+    for (; leaf != NULL; leaf = leaf->next, position = 0) {                    \
+      for (; position < leaf->count; ++position) {                             \
+        if (self->cmp(&leaf->u.leaf_keys[position], &hi) >= 0) {               \
+          return M_OK;                                                         \
+        }                                                                      \
+                                                                               \
+        action(&leaf->u.leaf_keys[position]);                                  \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Traversing the B+ tree in ascending order, walking the linked leaves.
+ */
+#define MBPTREE_TRAVERSE_INORDER(ID, T)                                        \
+  ACTION_FUNC(ID, T)                                                           \
+                                                                               \
+  merr_t ID##_mbptree_traverse_inorder(const ID##_mbptree_ptr_t *const self,   \
+                                       ID##_action_func action) {              \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->root == NULL) {                                                  \
+      printf("(Nil)\n");                                                       \
+    } else {                                                                   \
+      printf("[");                                                             \
+                                                                               \
+      for (ID##_mbptree_node_t leaf = self->head; leaf != NULL;                \
+           leaf = leaf->next) {                                                \
+        for (size_t iter = 0; iter < leaf->count; ++iter) {                    \
+          action(&leaf->u.leaf_keys[iter]);                                    \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      printf(" ]");                                                            \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Builds the B+ tree from an array sorted in ascending order (according
+ * to the compare function) in O(N) time, instead of N pushes. The elements fill
+ * the leaves one after another (equal neighbour elements are stored once) and
+ * every level of inner nodes is built over the previous one. All the nodes are
+ * allocated before the tree is built. The tree must be empty.
+ */
+#define MBPTREE_BUILD_SORTED(ID, T)                                            \
+  void ID##_internal_mbptree_free_chain(ID##_mbptree_node_t chain) {           \
+    while (chain != NULL) {                                                    \
+      ID##_mbptree_node_t next_node = chain->next;                             \
+      ID##_internal_mbptree_free(chain);                                       \
+      chain = next_node;                                                       \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbptree_build_sorted(const ID##_mbptree_t self,                  \
+                                   const T *const arr, size_t number_of_elem) {\
+    if ((self == NULL) || ((arr == NULL) && (number_of_elem != 0))) {          \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size != 0) {                                                     \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    size_t number_of_keys = 0;                                                 \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      int32_t cmp = (iter == 0) ? -1 : self->cmp(&arr[iter - 1], &arr[iter]);  \
+                                                                               \
+      if (cmp > 0) {                                                           \
+        return M_INVALID_INPUT;                                                \
+      }                                                                        \
+                                                                               \
+      if (cmp < 0) {                                                           \
+        ++number_of_keys;                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    if (number_of_keys == 0) {                                                 \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t number_of_leaves =                                                  \
+        (number_of_keys + ID##_MBPTREE_LEAF_KEYS - 1) / ID##_MBPTREE_LEAF_KEYS;\
+    size_t number_of_inner = 0;                                                \
+                                                                               \
+    for (size_t level_nodes = number_of_leaves; level_nodes > 1;) {            \
+      level_nodes = (level_nodes + ID##_MBPTREE_INNER_KEYS) /                  \
+                    (ID##_MBPTREE_INNER_KEYS + 1);                             \
+      number_of_inner += level_nodes;                                          \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_node_t leaves = NULL;                                         \
+    ID##_mbptree_node_t inner = NULL;                                          \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_leaves + number_of_inner; ++iter) { \
+      ID##_mbptree_node_t new_node = ID##_internal_mbptree_node(               \
+          (iter < number_of_leaves) ? mtrue : mfalse);                         \
+                                                                               \
+      if (new_node == NULL) {                                                  \
+        ID##_internal_mbptree_free_chain(leaves);                              \
+        ID##_internal_mbptree_free_chain(inner);                               \
+                                                                               \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+                                                                               \
+      if (iter < number_of_leaves) {                                           \
+        new_node->next = leaves;                                               \
+        leaves = new_node;                                                     \
+      } else {                                                                 \
+        new_node->next = inner;                                                \
+        inner = new_node;                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_node_t leaf = leaves;                                         \
+    size_t elem_index = 0;                                                     \
+                                                                               \
+    self->head = leaves;                                                       \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_leaves; ++iter) {                   \
+      size_t leaf_keys = number_of_keys / number_of_leaves +                   \
+                         ((iter < number_of_keys % number_of_leaves) ? 1 : 0); \
+                                                                               \
+      while (leaf->count < leaf_keys) {                                        \
+        while ((elem_index != 0) &&                                            \
+               (self->cmp(&arr[elem_index - 1], &arr[elem_index]) == 0)) {     \
+          ++elem_index;                                                        \
+        }                                                                      \
+                                                                               \
+        leaf->u.leaf_keys[leaf->count] = arr[elem_index];                      \
+                                                                               \
+        ++(leaf->count);                                                       \
+        ++elem_index;                                                          \
+      }                                                                        \
+                                                                               \
+      if (leaf->next != NULL) {                                                \
+        leaf->next->prev = leaf;                                               \
+      } else {                                                                 \
+        self->tail = leaf;                                                     \
+      }                                                                        \
+                                                                               \
+      leaf = leaf->next;                                                       \
+    }                                                                          \
+                                                                               \
+    ID##_mbptree_node_t level = leaves;                                        \
+    size_t level_nodes = number_of_leaves;                                     \
+                                                                               \
+    self->height = 1;                                                          \
+                                                                               \
+    while (level_nodes > 1) {                                                  \
+      size_t parent_nodes = (level_nodes + ID##_MBPTREE_INNER_KEYS) /          \
+                            (ID##_MBPTREE_INNER_KEYS + 1);                     \
+      ID##_mbptree_node_t parent_level = inner;                                \
+      ID##_mbptree_node_t child = level;                                       \
+                                                                               \
+      for (size_t iter = 0; iter < parent_nodes; ++iter) {                     \
+        ID##_mbptree_node_t parent = inner;                                    \
+        size_t parent_children =                                               \
+            level_nodes / parent_nodes +                                       \
+            ((iter < level_nodes % parent_nodes) ? 1 : 0);                     \
+                                                                               \
+        inner = inner->next;                                                   \
+                                                                               \
+        for (size_t child_iter = 0; child_iter < parent_children;              \
+             ++child_iter) {                                                   \
+          ID##_mbptree_node_t next_child = child->next;                        \
+                                                                               \
+          if (child_iter != 0) {                                               \
+            ID##_mbptree_node_t min_node = child;                              \
+                                                                               \
+            while (min_node->is_leaf == mfalse) {                              \
+              min_node = min_node->u.inner.children[0];                        \
+            }                                                                  \
+                                                                               \
+            parent->u.inner.keys[child_iter - 1] = min_node->u.leaf_keys[0];   \
+          }                                                                    \
+                                                                               \
+          parent->u.inner.children[child_iter] = child;                        \
+                                                                               \
+          if (child->is_leaf == mfalse) {                                      \
+            child->next = NULL;                                                \
+          }                                                                    \
+                                                                               \
+          child = next_child;                                                  \
+        }                                                                      \
+                                                                               \
+        parent->count = (uint32_t)(parent_children - 1);                       \
+        parent->next = (iter + 1 < parent_nodes) ? inner : NULL;               \
+      }                                                                        \
+                                                                               \
+      level = parent_level;                                                    \
+      level_nodes = parent_nodes;                                              \
+      ++(self->height);                                                        \
+    }                                                                          \
+                                                                               \
+    self->root = level;                                                        \
+    self->size = number_of_keys;                                               \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief This macro generates all the functions below for a specific type.
+ * It is not recommended to use `MBPTREE_ALL`, the code duplicated when calling
+ * `MBPTREE_ALL` for different ids or different types, it is encoureged to not
+ * to use `MBPTREE_ALL` or not to declare different ids for the same type. The
+ * ID protocol is used when different files want to have the same two typed
+ * structures in order to avoid name collisions.
+ */
+#define MBPTREE_ALL_WITH_ALLOC(ID, T, ALLOC)                                   \
+  MBPTREE_WITH_ALLOC(ID, T, ALLOC)                                             \
+  MBPTREE_EMPTY(ID, T)                                                         \
+  MBPTREE_SIZE(ID, T)                                                          \
+  MBPTREE_FIND(ID, T)                                                          \
+  MBPTREE_MIN(ID, T)                                                           \
+  MBPTREE_MAX(ID, T)                                                           \
+  MBPTREE_PUSH(ID, T)                                                          \
+  MBPTREE_POP(ID, T)                                                           \
+  MBPTREE_SEEK(ID, T)                                                          \
+  MBPTREE_LOWER_BOUND(ID, T)                                                   \
+  MBPTREE_UPPER_BOUND(ID, T)                                                   \
+  MBPTREE_RANGE(ID, T)                                                         \
+  MBPTREE_TRAVERSE_INORDER(ID, T)                                              \
+  MBPTREE_BUILD_SORTED(ID, T)
+
+/**
+ * @brief Adds the all API for the `mbptree` structure with the standard
+ * library allocator, see `MBPTREE_ALL_WITH_ALLOC`.
+ */
+#define MBPTREE_ALL(ID, T) MBPTREE_ALL_WITH_ALLOC(ID, T, m_stdlib)
+
+#endif /* MACROS_GENERICS_BPLUS_TREE_UTILS_H_ */
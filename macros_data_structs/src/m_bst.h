@@ -43,8 +43,13 @@
  * data memory, if data is not stored as a pointer (T <=> *M), then the free
  * function must be `NULL`. If data represents a structure which contains
  * pointers allocated, then the free function must free those fields.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
  */
-#define MBST(ID, T)                                                            \
+#define MBST_WITH_ALLOC(ID, T, ALLOC)                                          \
+  M_ALLOC(ID, mbst, ALLOC)                                                     \
+                                                                               \
   CMP_FUNC(ID, T)                                                              \
   FREE_FUNC(ID, T)                                                             \
                                                                                \
@@ -69,7 +74,7 @@
       return NULL;                                                             \
     }                                                                          \
                                                                                \
-    ID##_mbst_t self = malloc(sizeof *self);                                   \
+    ID##_mbst_t self = ID##_internal_mbst_malloc(sizeof *self);                \
                                                                                \
     if (self == NULL) {                                                        \
       return NULL;                                                             \
@@ -78,10 +83,10 @@
     self->cmp = cmp;                                                           \
     self->frd = frd;                                                           \
                                                                                \
-    self->nil = malloc(sizeof *self->nil);                                     \
+    self->nil = ID##_internal_mbst_malloc(sizeof *self->nil);                  \
                                                                                \
     if (self->nil == NULL) {                                                   \
-      free(self);                                                              \
+      ID##_internal_mbst_free(self);                                           \
       return NULL;                                                             \
     }                                                                          \
                                                                                \
@@ -96,7 +101,7 @@
                                                                                \
   ID##_mbst_node_t ID##_internal_mbst_node(const ID##_mbst_ptr_t *const self,  \
                                            T *const data) {                    \
-    ID##_mbst_node_t self_node = malloc(sizeof *self_node);                    \
+    ID##_mbst_node_t self_node = ID##_internal_mbst_malloc(sizeof *self_node); \
                                                                                \
     if (self_node == NULL) {                                                   \
       return self->nil;                                                        \
@@ -122,15 +127,15 @@
       self->frd(&(*self_node)->data);                                          \
     }                                                                          \
                                                                                \
-    free(*self_node);                                                          \
+    ID##_internal_mbst_free(*self_node);                                       \
     *self_node = self->nil;                                                    \
   }                                                                            \
                                                                                \
   merr_t ID##_mbst_free(ID##_mbst_t *self) {                                   \
     if ((self != NULL) && (*self != NULL)) {                                   \
       ID##_internal_mbst_free_help(*self, &(*self)->root);                     \
-      free((*self)->nil);                                                      \
-      free(*self);                                                             \
+      ID##_internal_mbst_free((*self)->nil);                                   \
+      ID##_internal_mbst_free(*self);                                          \
       *self = NULL;                                                            \
                                                                                \
       return M_OK;                                                             \
@@ -139,6 +144,12 @@
     return M_FREE_NULL;                                                        \
   }
 
+/**
+ * @brief Defines the `mbst` structure with the standard library
+ * allocator, see `MBST_WITH_ALLOC`.
+ */
+#define MBST(ID, T) MBST_WITH_ALLOC(ID, T, m_stdlib)
+
 /**
  * @brief Checks whether a binary
  * searc tree object is empty or not.
@@ -578,7 +589,7 @@
       self->frd(&self_node->data);                                             \
     }                                                                          \
                                                                                \
-    free(self_node);                                                           \
+    ID##_internal_mbst_free(self_node);                                        \
                                                                                \
     --(self->size);                                                            \
                                                                                \
@@ -703,6 +714,107 @@
     return M_OK;                                                               \
   }
 
+/**
+ * @brief Builds the tree from an array sorted in ascending order (according to
+ * the compare function) in O(N) time, instead of N pushes. The nodes are linked
+ * into a perfectly balanced tree. Equal neighbour elements are merged into one
+ * node, as the push method does. The tree must be empty.
+ */
+#define MBST_BUILD_SORTED(ID, T)                                               \
+  ID##_mbst_node_t ID##_internal_mbst_build_sorted(                            \
+      const ID##_mbst_ptr_t *const self, ID##_mbst_node_t *const chain,        \
+      size_t number_of_nodes) {                                                \
+    if (number_of_nodes == 0) {                                                \
+      return self->nil;                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mbst_node_t left_node = ID##_internal_mbst_build_sorted(              \
+        self, chain, number_of_nodes / 2);                                     \
+                                                                               \
+    ID##_mbst_node_t root = *chain;                                            \
+    *chain = root->right;                                                      \
+                                                                               \
+    ID##_mbst_node_t right_node = ID##_internal_mbst_build_sorted(             \
+        self, chain, number_of_nodes - number_of_nodes / 2 - 1);               \
+                                                                               \
+    root->left = left_node;                                                    \
+    root->right = right_node;                                                  \
+    root->parent = self->nil;                                                  \
+                                                                               \
+    if (left_node != self->nil) {                                              \
+      left_node->parent = root;                                                \
+    }                                                                          \
+                                                                               \
+    if (right_node != self->nil) {                                             \
+      right_node->parent = root;                                               \
+    }                                                                          \
+                                                                               \
+    return root;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbst_build_sorted(const ID##_mbst_t self, const T *const arr,    \
+                               size_t number_of_elem) {                        \
+    if ((self == NULL) || ((arr == NULL) && (number_of_elem != 0))) {          \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size != 0) {                                                     \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    size_t number_of_nodes = 0;                                                \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      int32_t cmp = (iter == 0) ? -1 : self->cmp(&arr[iter - 1], &arr[iter]);  \
+                                                                               \
+      if (cmp > 0) {                                                           \
+        return M_INVALID_INPUT;                                                \
+      }                                                                        \
+                                                                               \
+      if (cmp < 0) {                                                           \
+        ++number_of_nodes;                                                     \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mbst_node_t chain = self->nil;                                        \
+    ID##_mbst_node_t last_node = self->nil;                                    \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      if ((last_node != self->nil) &&                                          \
+          (self->cmp(&last_node->data, &arr[iter]) == 0)) {                    \
+        ++(last_node->count);                                                  \
+        continue;                                                              \
+      }                                                                        \
+                                                                               \
+      T data = arr[iter];                                                      \
+      ID##_mbst_node_t self_node = ID##_internal_mbst_node(self, &data);       \
+                                                                               \
+      if (self_node == self->nil) {                                            \
+        while (chain != self->nil) {                                           \
+          ID##_mbst_node_t next_node = chain->right;                           \
+          ID##_internal_mbst_free(chain);                                      \
+          chain = next_node;                                                   \
+        }                                                                      \
+                                                                               \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+                                                                               \
+      if (last_node == self->nil) {                                            \
+        chain = self_node;                                                     \
+      } else {                                                                 \
+        last_node->right = self_node;                                          \
+      }                                                                        \
+                                                                               \
+      last_node = self_node;                                                   \
+    }                                                                          \
+                                                                               \
+    self->root =                                                               \
+        ID##_internal_mbst_build_sorted(self, &chain, number_of_nodes);        \
+    self->size = number_of_nodes;                                              \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 /**
  * @brief Adds the all API for the `mbst_t` structure (binary search tree). You
  * will not be always need to use all the API, in this case you must be sure
@@ -713,8 +825,8 @@
  * different ids for the same type. The ID protocol is used when different files
  * want to have the same two typed structures in order to avoid name collisions.
  */
-#define MBST_ALL(ID, T)                                                        \
-  MBST(ID, T)                                                                  \
+#define MBST_ALL_WITH_ALLOC(ID, T, ALLOC)                                      \
+  MBST_WITH_ALLOC(ID, T, ALLOC)                                                \
   MBST_EMPTY(ID, T)                                                            \
   MBST_SIZE(ID, T)                                                             \
   MBST_ROOT(ID, T)                                                             \
@@ -729,6 +841,13 @@
   MBST_POP(ID, T)                                                              \
   MBST_TRAVERSE_INORDER(ID, T)                                                 \
   MBST_TRAVERSE_PREORDER(ID, T)                                                \
-  MBST_TRAVERSE_POSTORDER(ID, T)
+  MBST_TRAVERSE_POSTORDER(ID, T)                                               \
+  MBST_BUILD_SORTED(ID, T)
+
+/**
+ * @brief Adds the all API for the `mbst` structure with the standard
+ * library allocator, see `MBST_ALL_WITH_ALLOC`.
+ */
+#define MBST_ALL(ID, T) MBST_ALL_WITH_ALLOC(ID, T, m_stdlib)
 
 #endif /* MACROS_GENERIC_BINARY_SEARCH_TREE_UTILS_H_ */
@@ -26,6 +26,7 @@
 #ifndef MACROS_GENERICS_CONFIG_H_
 #define MACROS_GENERICS_CONFIG_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -64,6 +65,49 @@ typedef enum merr_s {
 
 #define ACTION_FUNC(ID, T) typedef void (*ID##_action_func)(const T *const);
 
+/**
+ * @brief Allocator hooks of the standard library, used by every structure
+ * defined without `_WITH_ALLOC`. An allocator is a prefix `ALLOC` for which
+ * `ALLOC##_malloc(size)`, `ALLOC##_realloc(ptr, size)` and `ALLOC##_free(ptr)`
+ * are functions or function-like macros with the contracts of `malloc`,
+ * `realloc` and `free` (`ALLOC##_free(NULL)` must be a no-op).
+ */
+#define m_stdlib_malloc(size) malloc(size)
+#define m_stdlib_realloc(ptr, size) realloc(ptr, size)
+#define m_stdlib_free(ptr) free(ptr)
+
+/**
+ * @brief Defines the allocation functions of the `NAME` structure with the `ID`
+ * name on top of the `ALLOC` hooks. The hooks are pasted at expansion, so every
+ * instantiation calls its own allocator directly, without any function pointer.
+ * A bump arena (whose free does nothing and is released at once) or a pool of
+ * fixed size nodes can be plugged in this way for a single instantiation.
+ */
+#define M_ALLOC(ID, NAME, ALLOC)                                               \
+  void *ID##_internal_##NAME##_malloc(size_t size) {                           \
+    return ALLOC##_malloc(size);                                               \
+  }                                                                            \
+                                                                               \
+  void *ID##_internal_##NAME##_calloc(size_t count, size_t size) {             \
+    if ((size != 0) && (count > SIZE_MAX / size)) {                            \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    void *ptr = ALLOC##_malloc(count * size);                                  \
+                                                                               \
+    if (ptr != NULL) {                                                         \
+      memset(ptr, 0, count * size);                                            \
+    }                                                                          \
+                                                                               \
+    return ptr;                                                                \
+  }                                                                            \
+                                                                               \
+  void *ID##_internal_##NAME##_realloc(void *ptr, size_t size) {               \
+    return ALLOC##_realloc(ptr, size);                                         \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_##NAME##_free(void *ptr) { ALLOC##_free(ptr); }
+
 #define MERROR(error)                                                          \
   do {                                                                         \
     switch (error) {                                                           \
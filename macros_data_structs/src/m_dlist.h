@@ -36,6 +36,16 @@
  * @param T the type of the data stored inside the structure.
  */
 
+/**
+ * @brief Link of an object stored in an intrusive double linked list, see
+ * `MDLIST_INTRUSIVE`. The link is a field of the object, a zeroed link (or
+ * the link of a removed object) marks the object as unlinked.
+ */
+typedef struct mdlist_link_s {
+  struct mdlist_link_s *next;
+  struct mdlist_link_s *prev;
+} mdlist_link_t;
+
 /**
  * @brief Generates the `mdlist_t` structure depending on the name and type.
  * Also generates basic function for creation and freeing memory for the
@@ -43,8 +53,13 @@
  * data memory, if data is not stored as a pointer (T <=> *M), then the free
  * function must be `NULL`. If data represents a structure which contains
  * pointers allocated, then the free function must free those fields.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
  */
-#define MDLIST(ID, T)                                                          \
+#define MDLIST_WITH_ALLOC(ID, T, ALLOC)                                        \
+  M_ALLOC(ID, mdlist, ALLOC)                                                   \
+                                                                               \
   CMP_FUNC(ID, T)                                                              \
   FREE_FUNC(ID, T)                                                             \
                                                                                \
@@ -60,6 +75,8 @@
     ID##_compare_func cmp;                                                     \
     ID##_free_func frd;                                                        \
     size_t size;                                                               \
+    ID##_mdlist_node_t slab;                                                   \
+    size_t slab_size;                                                          \
   } ID##_mdlist_ptr_t, *ID##_mdlist_t;                                         \
                                                                                \
   ID##_mdlist_t ID##_mdlist(ID##_compare_func cmp, ID##_free_func frd) {       \
@@ -67,7 +84,7 @@
       return NULL;                                                             \
     }                                                                          \
                                                                                \
-    ID##_mdlist_t self = malloc(sizeof *self);                                 \
+    ID##_mdlist_t self = ID##_internal_mdlist_malloc(sizeof *self);            \
                                                                                \
     if (self == NULL) {                                                        \
       return NULL;                                                             \
@@ -78,12 +95,15 @@
                                                                                \
     self->head = self->tail = NULL;                                            \
     self->size = 0;                                                            \
+    self->slab = NULL;                                                         \
+    self->slab_size = 0;                                                       \
                                                                                \
     return self;                                                               \
   }                                                                            \
                                                                                \
   ID##_mdlist_node_t ID##_internal_mdlist_node(T *const data) {                \
-    ID##_mdlist_node_t self_node = malloc(sizeof *self_node);                  \
+    ID##_mdlist_node_t self_node =                                             \
+        ID##_internal_mdlist_malloc(sizeof *self_node);                        \
                                                                                \
     if (self_node == NULL) {                                                   \
       return NULL;                                                             \
@@ -95,6 +115,15 @@
     return self_node;                                                          \
   }                                                                            \
                                                                                \
+  void ID##_internal_mdlist_node_free(const ID##_mdlist_ptr_t *const self,     \
+                                      ID##_mdlist_node_t self_node) {          \
+    if ((self->slab == NULL) ||                                                \
+        ((uintptr_t)self_node < (uintptr_t)self->slab) ||                      \
+        ((uintptr_t)self_node >= (uintptr_t)(self->slab + self->slab_size))) { \
+      ID##_internal_mdlist_free(self_node);                                    \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
   merr_t ID##_mdlist_free(ID##_mdlist_t *self) {                               \
     if ((self != NULL) && (*self != NULL)) {                                   \
       while ((*self)->head != NULL) {                                          \
@@ -105,10 +134,11 @@
           (*self)->frd(&iterator->data);                                       \
         }                                                                      \
                                                                                \
-        free(iterator);                                                        \
+        ID##_internal_mdlist_node_free(*self, iterator);                       \
       }                                                                        \
                                                                                \
-      free(*self);                                                             \
+      ID##_internal_mdlist_free((*self)->slab);                                \
+      ID##_internal_mdlist_free(*self);                                        \
       *self = NULL;                                                            \
                                                                                \
       return M_OK;                                                             \
@@ -117,6 +147,12 @@
     return M_FREE_NULL;                                                        \
   }
 
+/**
+ * @brief Defines the `mdlist` structure with the standard library
+ * allocator, see `MDLIST_WITH_ALLOC`.
+ */
+#define MDLIST(ID, T) MDLIST_WITH_ALLOC(ID, T, m_stdlib)
+
 /**
  * @brief Function to check if a doubly linked list object is empty or not. The
  * function tests if head of list is `NULL` in that case function will return
@@ -575,7 +611,7 @@
       self->frd(&iterator->data);                                              \
     }                                                                          \
                                                                                \
-    free(iterator);                                                            \
+    ID##_internal_mdlist_node_free(self, iterator);                            \
                                                                                \
     --(self->size);                                                            \
                                                                                \
@@ -624,7 +660,7 @@
       self->frd(&iterator->data);                                              \
     }                                                                          \
                                                                                \
-    free(iterator);                                                            \
+    ID##_internal_mdlist_node_free(self, iterator);                            \
                                                                                \
     --(self->size);                                                            \
                                                                                \
@@ -692,7 +728,7 @@
         self->frd(&self_node->data);                                           \
       }                                                                        \
                                                                                \
-      free(self_node);                                                         \
+      ID##_internal_mdlist_node_free(self, self_node);                         \
     }                                                                          \
                                                                                \
     return M_OK;                                                               \
@@ -807,6 +843,166 @@
     return map_list;                                                           \
   }
 
+/**
+ * @brief Sorts the double linked list by relinking its nodes with a bottom-up
+ * merge sort: runs of doubling sizes are merged in place, so no node is
+ * allocated and no data is copied. The sort is stable (on equal data the node
+ * that was first stays first) and takes O(NlogN) time. CMP is the name of the
+ * compare function (or function like macro) of two elements,
+ * `int32_t CMP(const T *const, const T *const)`, it is known at compile time so
+ * it is inlined in the merges (it may differ from the compare function of the
+ * list). `MDLIST_ALL` does not define this method, because of CMP.
+ */
+#define MDLIST_SORT(ID, T, CMP)                                                \
+  ID##_mdlist_node_t ID##_internal_mdlist_sort_cut(ID##_mdlist_node_t run,     \
+                                                   size_t run_size) {          \
+    while ((run != NULL) && (run_size > 1)) {                                  \
+      run = run->next;                                                         \
+      --run_size;                                                              \
+    }                                                                          \
+                                                                               \
+    if (run == NULL) {                                                         \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    ID##_mdlist_node_t rest = run->next;                                       \
+    run->next = NULL;                                                          \
+                                                                               \
+    return rest;                                                               \
+  }                                                                            \
+                                                                               \
+  ID##_mdlist_node_t *ID##_internal_mdlist_sort_merge(                         \
+      ID##_mdlist_node_t left, ID##_mdlist_node_t right,                       \
+      ID##_mdlist_node_t *link) {                                              \
+    while ((left != NULL) && (right != NULL)) {                                \
+      if (CMP(&right->data, &left->data) < 0) {                                \
+        *link = right;                                                         \
+        right = right->next;                                                   \
+      } else {                                                                 \
+        *link = left;                                                          \
+        left = left->next;                                                     \
+      }                                                                        \
+                                                                               \
+      link = &(*link)->next;                                                   \
+    }                                                                          \
+                                                                               \
+    *link = (left != NULL) ? left : right;                                     \
+                                                                               \
+    while (*link != NULL) {                                                    \
+      link = &(*link)->next;                                                   \
+    }                                                                          \
+                                                                               \
+    return link;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mdlist_sort(const ID##_mdlist_t self) {                          \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    for (size_t run_size = 1; run_size < self->size; run_size <<= 1) {         \
+      ID##_mdlist_node_t rest = self->head;                                    \
+      ID##_mdlist_node_t *link = &self->head;                                  \
+                                                                               \
+      while (rest != NULL) {                                                   \
+        ID##_mdlist_node_t left = rest;                                        \
+        ID##_mdlist_node_t right =                                             \
+            ID##_internal_mdlist_sort_cut(left, run_size);                     \
+                                                                               \
+        rest = ID##_internal_mdlist_sort_cut(right, run_size);                 \
+        link = ID##_internal_mdlist_sort_merge(left, right, link);             \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    self->tail = self->head;                                                   \
+                                                                               \
+    while ((self->tail != NULL) && (self->tail->next != NULL)) {               \
+      self->tail = self->tail->next;                                           \
+    }                                                                          \
+                                                                               \
+    ID##_mdlist_node_t prev = NULL;                                            \
+                                                                               \
+    for (ID##_mdlist_node_t iterator = self->head; iterator != NULL;           \
+         iterator = iterator->next) {                                          \
+      iterator->prev = prev;                                                   \
+      prev = iterator;                                                         \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Creates a doubly linked list from an array of `number_of_elem`
+ * elements (in the same order). All the nodes are allocated in one block and
+ * linked in a single pass instead of one allocation per element. The block is
+ * freed with the list, so its nodes are not freed one by one when they are
+ * removed.
+ */
+#define MDLIST_FROM_ARRAY(ID, T)                                               \
+  ID##_mdlist_t ID##_mdlist_from_array(ID##_compare_func cmp,                  \
+                                       ID##_free_func frd, const T *const arr, \
+                                       size_t number_of_elem) {                \
+    if ((arr == NULL) && (number_of_elem != 0)) {                              \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    ID##_mdlist_t self = ID##_mdlist(cmp, frd);                                \
+                                                                               \
+    if ((self == NULL) || (number_of_elem == 0)) {                             \
+      return self;                                                             \
+    }                                                                          \
+                                                                               \
+    if (number_of_elem > SIZE_MAX / sizeof(ID##_mdlist_node_ptr_t)) {          \
+      ID##_internal_mdlist_free(self);                                         \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->slab = ID##_internal_mdlist_malloc(number_of_elem *                  \
+                                             sizeof(ID##_mdlist_node_ptr_t));  \
+                                                                               \
+    if (self->slab == NULL) {                                                  \
+      ID##_internal_mdlist_free(self);                                         \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->slab_size = number_of_elem;                                          \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      self->slab[iter].data = arr[iter];                                       \
+      self->slab[iter].prev = (iter == 0) ? NULL : &self->slab[iter - 1];      \
+      self->slab[iter].next = &self->slab[iter + 1];                           \
+    }                                                                          \
+                                                                               \
+    self->slab[number_of_elem - 1].next = NULL;                                \
+                                                                               \
+    self->head = &self->slab[0];                                               \
+    self->tail = &self->slab[number_of_elem - 1];                              \
+    self->size = number_of_elem;                                               \
+                                                                               \
+    return self;                                                               \
+  }
+
+/**
+ * @brief Copies the elements of the doubly linked list, in order, into an
+ * array. At most `number_of_elem` elements are copied.
+ */
+#define MDLIST_TO_ARRAY(ID, T)                                                 \
+  merr_t ID##_mdlist_to_array(const ID##_mdlist_ptr_t *const self,             \
+                              T *const arr, size_t number_of_elem) {           \
+    if ((self == NULL) || ((arr == NULL) && (number_of_elem != 0))) {          \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t iter = 0;                                                           \
+                                                                               \
+    for (ID##_mdlist_node_t node = self->head;                                 \
+         (node != NULL) && (iter < number_of_elem); node = node->next) {       \
+      arr[iter++] = node->data;                                                \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 /**
  * @brief Adds the all API for the `mdlist_t` structure (linked list). You will
  * not be always need to use all the API, in this case you must be sure that you
@@ -818,8 +1014,8 @@
  * when different files want to have the same two typed structures in order to
  * avoid name collisions.
  */
-#define MDLIST_ALL(ID, T)                                                      \
-  MDLIST(ID, T)                                                                \
+#define MDLIST_ALL_WITH_ALLOC(ID, T, ALLOC)                                    \
+  MDLIST_WITH_ALLOC(ID, T, ALLOC)                                              \
   MDLIST_EMPTY(ID, T)                                                          \
   MDLIST_SIZE(ID, T)                                                           \
   MDLIST_HEAD(ID, T)                                                           \
@@ -840,6 +1036,245 @@
   MDLIST_ERASE(ID, T)                                                          \
   MDLIST_FILTER(ID, T)                                                         \
   MDLIST_TRAVERSE(ID, T)                                                       \
+  MDLIST_FROM_ARRAY(ID, T)                                                     \
+  MDLIST_TO_ARRAY(ID, T)                                                       \
   MDLIST_MAP(ID, T, ID, T)
 
+/**
+ * @brief Adds the all API for the `mdlist` structure with the standard
+ * library allocator, see `MDLIST_ALL_WITH_ALLOC`.
+ */
+#define MDLIST_ALL(ID, T) MDLIST_ALL_WITH_ALLOC(ID, T, m_stdlib)
+
+/**
+ * @brief Generates an intrusive double linked list (`midlist_t`) of `T` objects
+ * linked through their `LINK` field of type `mdlist_link_t`. The list never
+ * allocates and never copies the objects, and any linked object is removed or
+ * moved in O(1), which makes it the recency list of an LRU cache while the same
+ * objects sit in an index. The `midlist_ptr_t` head is owned by the caller, it
+ * holds the sentinel link of the circular list, so it must be set with
+ * `midlist_init` and must not be copied or moved afterwards.
+ */
+#define MDLIST_INTRUSIVE(ID, T, LINK)                                          \
+  ACTION_FUNC(ID, T)                                                           \
+                                                                               \
+  typedef struct ID##_midlist_s {                                              \
+    mdlist_link_t root;                                                        \
+    size_t size;                                                               \
+  } ID##_midlist_ptr_t, *ID##_midlist_t;                                       \
+                                                                               \
+  T *ID##_internal_midlist_entry(const ID##_midlist_ptr_t *const self,         \
+                                 mdlist_link_t *const link) {                  \
+    if (link == &self->root) {                                                 \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return (T *)((char *)link - offsetof(T, LINK));                            \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_midlist_link(ID##_midlist_t const self,                   \
+                                  mdlist_link_t *const prev,                   \
+                                  mdlist_link_t *const link) {                 \
+    link->prev = prev;                                                         \
+    link->next = prev->next;                                                   \
+    prev->next->prev = link;                                                   \
+    prev->next = link;                                                         \
+                                                                               \
+    ++(self->size);                                                            \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_midlist_unlink(ID##_midlist_t const self,                 \
+                                    mdlist_link_t *const link) {               \
+    link->prev->next = link->next;                                             \
+    link->next->prev = link->prev;                                             \
+    link->next = link->prev = NULL;                                            \
+                                                                               \
+    --(self->size);                                                            \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_midlist_init(ID##_midlist_t const self) {                        \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    self->root.next = self->root.prev = &self->root;                           \
+    self->size = 0;                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  mbool_t ID##_midlist_empty(const ID##_midlist_ptr_t *const self) {           \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }                                                                            \
+                                                                               \
+  size_t ID##_midlist_size(const ID##_midlist_ptr_t *const self) {             \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->size;                                                         \
+  }                                                                            \
+                                                                               \
+  T *ID##_midlist_head(const ID##_midlist_ptr_t *const self) {                 \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_midlist_entry(self, self->root.next);                 \
+  }                                                                            \
+                                                                               \
+  T *ID##_midlist_tail(const ID##_midlist_ptr_t *const self) {                 \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_midlist_entry(self, self->root.prev);                 \
+  }                                                                            \
+                                                                               \
+  T *ID##_midlist_next(const ID##_midlist_ptr_t *const self, T *const obj) {   \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_midlist_entry(self, obj->LINK.next);                  \
+  }                                                                            \
+                                                                               \
+  T *ID##_midlist_prev(const ID##_midlist_ptr_t *const self, T *const obj) {   \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_midlist_entry(self, obj->LINK.prev);                  \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_midlist_push(ID##_midlist_t const self, T *const obj) {          \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    ID##_internal_midlist_link(self, self->root.prev, &obj->LINK);             \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_midlist_push_front(ID##_midlist_t const self, T *const obj) {    \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    ID##_internal_midlist_link(self, &self->root, &obj->LINK);                 \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  T *ID##_midlist_pop(ID##_midlist_t const self) {                             \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    mdlist_link_t *link = self->root.next;                                     \
+                                                                               \
+    ID##_internal_midlist_unlink(self, link);                                  \
+                                                                               \
+    return ID##_internal_midlist_entry(self, link);                            \
+  }                                                                            \
+                                                                               \
+  T *ID##_midlist_pop_back(ID##_midlist_t const self) {                        \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    mdlist_link_t *link = self->root.prev;                                     \
+                                                                               \
+    ID##_internal_midlist_unlink(self, link);                                  \
+                                                                               \
+    return ID##_internal_midlist_entry(self, link);                            \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_midlist_remove(ID##_midlist_t const self, T *const obj) {        \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (obj->LINK.next == NULL) {                                              \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    ID##_internal_midlist_unlink(self, &obj->LINK);                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_midlist_move_front(ID##_midlist_t const self, T *const obj) {    \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (obj->LINK.next == NULL) {                                              \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    ID##_internal_midlist_unlink(self, &obj->LINK);                            \
+    ID##_internal_midlist_link(self, &self->root, &obj->LINK);                 \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_midlist_move_back(ID##_midlist_t const self, T *const obj) {     \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (obj->LINK.next == NULL) {                                              \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    ID##_internal_midlist_unlink(self, &obj->LINK);                            \
+    ID##_internal_midlist_link(self, self->root.prev, &obj->LINK);             \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_midlist_clear(ID##_midlist_t const self) {                       \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    while (self->size != 0) {                                                  \
+      ID##_internal_midlist_unlink(self, self->root.next);                     \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_midlist_traverse(const ID##_midlist_ptr_t *const self,           \
+                               ID##_action_func action) {                      \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      printf("[ ]\n");                                                         \
+    } else {                                                                   \
+      printf("[");                                                             \
+                                                                               \
+      for (mdlist_link_t *iterator = self->root.next;                          \
+           iterator != &self->root; iterator = iterator->next) {               \
+        action(ID##_internal_midlist_entry(self, iterator));                   \
+      }                                                                        \
+                                                                               \
+      printf(" ]");                                                            \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 #endif /* MACROS_GENERIC_DLIST_UTILS_H_ */
@@ -0,0 +1,900 @@
+/**
+ * @file m_graph.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2023-06-12
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of c-language-data-structures.
+ *
+ * c-language-data-structures is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * c-language-data-structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with c-language-data-structures.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MACROS_GENERICS_GRAPH_UTILS_H_
+#define MACROS_GENERICS_GRAPH_UTILS_H_
+
+#include "./m_config.h"
+
+/**
+ * @brief Utility file containing macros that generate functions for a generic
+ * weighted graph stored as adjacency arrays.
+ *
+ * @param ID the id of the structure in order to reduce name collisions.
+ * @param VT the type of the payload stored in every vertex.
+ * @param WT the type of the weights of the edges, an arithmetic type, the
+ * weights are added with `+` and compared with `<` in the generated functions.
+ */
+
+/**
+ * @brief Least number of vertices (edges) of the arrays after the first
+ * growth.
+ */
+#define MGRAPH_MIN_CAPACITY 16
+
+/**
+ * @brief Generates the `mgraph_t` structure depending on the name and types.
+ * Also generates basic function for creation and freeing memory for the
+ * structure. This structure require a method for freeing the payloads of the
+ * vertices, if the payload is not stored as a pointer (T <=> *M), then the
+ * free function must be `NULL`.
+ *
+ * The vertices are numbered from 0 in the order in which they are added. The
+ * edges are appended to an edge list, before the first query the edge list is
+ * turned into compressed sparse rows (CSR): the neighbours of all the vertices
+ * are stored in one array of targets and one array of weights, the neighbours
+ * of vertex v are at positions [offsets[v], offsets[v + 1]), in the order in
+ * which the edges were added. A query reads the neighbours of a vertex from
+ * consecutive memory. Adding an edge or a vertex after a query makes the next
+ * query rebuild the rows in O(V + E) time. An undirected graph keeps every
+ * edge once in the edge list and twice in the rows.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
+ */
+#define MGRAPH_WITH_ALLOC(ID, VT, WT, ALLOC)                                   \
+  M_ALLOC(ID, mgraph, ALLOC)                                                   \
+                                                                               \
+  FREE_FUNC(ID, VT)                                                            \
+                                                                               \
+  typedef struct ID##_mgraph_s {                                               \
+    VT *payloads;                                                              \
+    size_t *edge_src;                                                          \
+    size_t *edge_dst;                                                          \
+    WT *edge_weights;                                                          \
+    size_t *offsets;                                                           \
+    size_t *targets;                                                           \
+    WT *weights;                                                               \
+    ID##_free_func frd;                                                        \
+    size_t vertices;                                                           \
+    size_t vertices_capacity;                                                  \
+    size_t edges;                                                              \
+    size_t edges_capacity;                                                     \
+    mbool_t directed;                                                          \
+    mbool_t built;                                                             \
+  } ID##_mgraph_ptr_t, *ID##_mgraph_t;                                         \
+                                                                               \
+  ID##_mgraph_t ID##_mgraph(mbool_t directed, ID##_free_func frd) {            \
+    ID##_mgraph_t self = ID##_internal_mgraph_malloc(sizeof *self);            \
+                                                                               \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->frd = frd;                                                           \
+    self->directed = directed;                                                 \
+                                                                               \
+    self->payloads = NULL;                                                     \
+    self->edge_src = NULL;                                                     \
+    self->edge_dst = NULL;                                                     \
+    self->edge_weights = NULL;                                                 \
+    self->offsets = NULL;                                                      \
+    self->targets = NULL;                                                      \
+    self->weights = NULL;                                                      \
+                                                                               \
+    self->vertices = 0;                                                        \
+    self->vertices_capacity = 0;                                               \
+    self->edges = 0;                                                           \
+    self->edges_capacity = 0;                                                  \
+    self->built = mfalse;                                                      \
+                                                                               \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mgraph_free_rows(const ID##_mgraph_t self) {              \
+    ID##_internal_mgraph_free(self->offsets);                                  \
+    ID##_internal_mgraph_free(self->targets);                                  \
+    ID##_internal_mgraph_free(self->weights);                                  \
+                                                                               \
+    self->offsets = NULL;                                                      \
+    self->targets = NULL;                                                      \
+    self->weights = NULL;                                                      \
+    self->built = mfalse;                                                      \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mgraph_free(ID##_mgraph_t *self) {                               \
+    if ((self != NULL) && (*self != NULL)) {                                   \
+      if ((*self)->frd != NULL) {                                              \
+        for (size_t iter = 0; iter < (*self)->vertices; ++iter) {              \
+          (*self)->frd(&(*self)->payloads[iter]);                              \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mgraph_free_rows(*self);                                   \
+                                                                               \
+      ID##_internal_mgraph_free((*self)->payloads);                            \
+      ID##_internal_mgraph_free((*self)->edge_src);                            \
+      ID##_internal_mgraph_free((*self)->edge_dst);                            \
+      ID##_internal_mgraph_free((*self)->edge_weights);                        \
+      ID##_internal_mgraph_free(*self);                                        \
+      *self = NULL;                                                            \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    return M_FREE_NULL;                                                        \
+  }                                                                            \
+                                                                               \
+  size_t ID##_internal_mgraph_capacity(size_t capacity, size_t size) {         \
+    if (capacity == 0) {                                                       \
+      capacity = MGRAPH_MIN_CAPACITY;                                          \
+    }                                                                          \
+                                                                               \
+    while (capacity < size) {                                                  \
+      if (capacity > SIZE_MAX / 2) {                                           \
+        return size;                                                           \
+      }                                                                        \
+                                                                               \
+      capacity *= 2;                                                           \
+    }                                                                          \
+                                                                               \
+    return capacity;                                                           \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mgraph_grow_vertices(const ID##_mgraph_t self,          \
+                                            size_t size) {                     \
+    if (size <= self->vertices_capacity) {                                     \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t capacity =                                                          \
+        ID##_internal_mgraph_capacity(self->vertices_capacity, size);          \
+                                                                               \
+    if (capacity > SIZE_MAX / sizeof(VT)) {                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    VT *payloads = ID##_internal_mgraph_realloc(self->payloads,                \
+                                                capacity * sizeof *payloads);  \
+                                                                               \
+    if (payloads == NULL) {                                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->payloads = payloads;                                                 \
+    self->vertices_capacity = capacity;                                        \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mgraph_grow_edges(const ID##_mgraph_t self,             \
+                                         size_t size) {                        \
+    if (size <= self->edges_capacity) {                                        \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t capacity =                                                          \
+        ID##_internal_mgraph_capacity(self->edges_capacity, size);             \
+                                                                               \
+    if (capacity > SIZE_MAX / sizeof(size_t) / 2) {                            \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    size_t *edge_src =                                                         \
+        ID##_internal_mgraph_realloc(self->edge_src,                           \
+                                     capacity * sizeof *edge_src);             \
+                                                                               \
+    if (edge_src == NULL) {                                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->edge_src = edge_src;                                                 \
+                                                                               \
+    size_t *edge_dst =                                                         \
+        ID##_internal_mgraph_realloc(self->edge_dst,                           \
+                                     capacity * sizeof *edge_dst);             \
+                                                                               \
+    if (edge_dst == NULL) {                                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->edge_dst = edge_dst;                                                 \
+                                                                               \
+    WT *edge_weights =                                                         \
+        ID##_internal_mgraph_realloc(self->edge_weights,                       \
+                                     capacity * sizeof *edge_weights);         \
+                                                                               \
+    if (edge_weights == NULL) {                                                \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->edge_weights = edge_weights;                                         \
+    self->edges_capacity = capacity;                                           \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mgraph_build(const ID##_mgraph_t self) {                \
+    if (self->built == mtrue) {                                                \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t rows = (self->directed == mtrue) ? self->edges : 2 * self->edges;   \
+                                                                               \
+    size_t *offsets =                                                          \
+        ID##_internal_mgraph_calloc(self->vertices + 1, sizeof *offsets);      \
+    size_t *targets =                                                          \
+        ID##_internal_mgraph_malloc((rows + 1) * sizeof *targets);             \
+    WT *weights = ID##_internal_mgraph_malloc((rows + 1) * sizeof *weights);   \
+                                                                               \
+    if ((offsets == NULL) || (targets == NULL) || (weights == NULL)) {         \
+      ID##_internal_mgraph_free(offsets);                                      \
+      ID##_internal_mgraph_free(targets);                                      \
+      ID##_internal_mgraph_free(weights);                                      \
+                                                                               \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < self->edges; ++iter) {                        \
+      ++offsets[self->edge_src[iter] + 1];                                     \
+                                                                               \
+      if ((self->directed == mfalse) &&                                        \
+          (self->edge_src[iter] != self->edge_dst[iter])) {                    \
+        ++offsets[self->edge_dst[iter] + 1];                                   \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < self->vertices; ++iter) {                     \
+      offsets[iter + 1] += offsets[iter];                                      \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < self->edges; ++iter) {                        \
+      size_t src = self->edge_src[iter];                                       \
+      size_t dst = self->edge_dst[iter];                                       \
+                                                                               \
+      targets[offsets[src]] = dst;                                             \
+      weights[offsets[src]++] = self->edge_weights[iter];                      \
+                                                                               \
+      if ((self->directed == mfalse) && (src != dst)) {                        \
+        targets[offsets[dst]] = src;                                           \
+        weights[offsets[dst]++] = self->edge_weights[iter];                    \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = self->vertices; iter > 0; --iter) {                     \
+      offsets[iter] = offsets[iter - 1];                                       \
+    }                                                                          \
+                                                                               \
+    offsets[0] = 0;                                                            \
+                                                                               \
+    ID##_internal_mgraph_free_rows(self);                                      \
+                                                                               \
+    self->offsets = offsets;                                                   \
+    self->targets = targets;                                                   \
+    self->weights = weights;                                                   \
+    self->built = mtrue;                                                       \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Defines the `mgraph` structure with the standard library
+ * allocator, see `MGRAPH_WITH_ALLOC`.
+ */
+#define MGRAPH(ID, VT, WT) MGRAPH_WITH_ALLOC(ID, VT, WT, m_stdlib)
+
+/**
+ * @brief Function to check if a graph object has no vertices. A `NULL` graph
+ * is also considered as an empty graph.
+ */
+#define MGRAPH_EMPTY(ID, VT, WT)                                               \
+  mbool_t ID##_mgraph_empty(const ID##_mgraph_ptr_t *const self) {             \
+    if ((self == NULL) || (self->vertices == 0)) {                             \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }
+
+/**
+ * @brief Get the number of vertices (`mgraph_order`) and the number of edges
+ * (`mgraph_size`, an undirected edge is counted once) of the graph. If graph
+ * is not allocated then functions will return SIZE_MAX value.
+ */
+#define MGRAPH_SIZE(ID, VT, WT)                                                \
+  size_t ID##_mgraph_order(const ID##_mgraph_ptr_t *const self) {              \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->vertices;                                                     \
+  }                                                                            \
+                                                                               \
+  size_t ID##_mgraph_size(const ID##_mgraph_ptr_t *const self) {               \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->edges;                                                        \
+  }
+
+/**
+ * @brief Preallocates the arrays of the graph for at least `vertices`
+ * vertices and `edges` edges.
+ */
+#define MGRAPH_RESERVE(ID, VT, WT)                                             \
+  merr_t ID##_mgraph_reserve(const ID##_mgraph_t self, size_t vertices,        \
+                             size_t edges) {                                   \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mgraph_grow_vertices(self, vertices);           \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mgraph_grow_edges(self, edges);                       \
+  }
+
+/**
+ * @brief Adds a new vertex with its payload, the index of the vertex is stored
+ * in the accumulator (it may be `NULL`), the vertices are numbered from 0 in
+ * the order in which they are added.
+ */
+#define MGRAPH_ADD_VERTEX(ID, VT, WT)                                          \
+  merr_t ID##_mgraph_add_vertex(const ID##_mgraph_t self, VT payload,          \
+                                size_t *const acc) {                           \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mgraph_grow_vertices(self, self->vertices + 1); \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    self->payloads[self->vertices] = payload;                                  \
+                                                                               \
+    if (acc != NULL) {                                                         \
+      *acc = self->vertices;                                                   \
+    }                                                                          \
+                                                                               \
+    ++(self->vertices);                                                        \
+    self->built = mfalse;                                                      \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Adds an edge from the `src` vertex to the `dst` vertex with a weight,
+ * for an undirected graph the edge goes both ways. Parallel edges and self
+ * loops are allowed.
+ */
+#define MGRAPH_ADD_EDGE(ID, VT, WT)                                            \
+  merr_t ID##_mgraph_add_edge(const ID##_mgraph_t self, size_t src,            \
+                              size_t dst, WT weight) {                         \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if ((src >= self->vertices) || (dst >= self->vertices)) {                  \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mgraph_grow_edges(self, self->edges + 1);       \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    self->edge_src[self->edges] = src;                                         \
+    self->edge_dst[self->edges] = dst;                                         \
+    self->edge_weights[self->edges] = weight;                                  \
+                                                                               \
+    ++(self->edges);                                                           \
+    self->built = mfalse;                                                      \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Gets the payload of a vertex in an accumulator (`mgraph_vertex`) or
+ * the address of the payload inside the graph (`mgraph_vertex_ptr`), which is
+ * valid until the next added vertex.
+ */
+#define MGRAPH_VERTEX(ID, VT, WT)                                              \
+  merr_t ID##_mgraph_vertex(const ID##_mgraph_ptr_t *const self,               \
+                            size_t vertex, VT *const acc) {                    \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (vertex >= self->vertices) {                                            \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    *acc = self->payloads[vertex];                                             \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  VT *ID##_mgraph_vertex_ptr(const ID##_mgraph_ptr_t *const self,              \
+                             size_t vertex) {                                  \
+    if ((self == NULL) || (vertex >= self->vertices)) {                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return &self->payloads[vertex];                                            \
+  }
+
+/**
+ * @brief Gets the neighbours of a vertex: `targets` and `weights` receive the
+ * addresses of the neighbours and of the weights of the edges inside the rows
+ * of the graph (any of them may be `NULL`) and `count` receives their number.
+ * The addresses are valid until the graph is changed.
+ */
+#define MGRAPH_NEIGHBOURS(ID, VT, WT)                                          \
+  merr_t ID##_mgraph_neighbours(const ID##_mgraph_t self, size_t vertex,       \
+                                const size_t **const targets,                  \
+                                const WT **const weights,                      \
+                                size_t *const count) {                         \
+    if ((self == NULL) || (count == NULL)) {                                   \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (vertex >= self->vertices) {                                            \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mgraph_build(self);                             \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    if (targets != NULL) {                                                     \
+      *targets = &self->targets[self->offsets[vertex]];                        \
+    }                                                                          \
+                                                                               \
+    if (weights != NULL) {                                                     \
+      *weights = &self->weights[self->offsets[vertex]];                        \
+    }                                                                          \
+                                                                               \
+    *count = self->offsets[vertex + 1] - self->offsets[vertex];                \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Breadth first search from the `source` vertex. `order` (it may be
+ * `NULL`) receives the reached vertices in the order of their visit, `parent`
+ * (it may be `NULL`) receives for every vertex the vertex from which it was
+ * reached (the source is its own parent, SIZE_MAX for an unreached vertex) and
+ * `visited` receives the number of reached vertices. Both arrays must have
+ * `mgraph_order` elements. Takes O(V + E) time.
+ */
+#define MGRAPH_BFS(ID, VT, WT)                                                 \
+  merr_t ID##_mgraph_bfs(const ID##_mgraph_t self, size_t source,              \
+                         size_t *const order, size_t *const parent,            \
+                         size_t *const visited) {                              \
+    if ((self == NULL) || (visited == NULL)) {                                 \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (source >= self->vertices) {                                            \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mgraph_build(self);                             \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    size_t *queue =                                                            \
+        (order != NULL)                                                        \
+            ? order                                                            \
+            : ID##_internal_mgraph_malloc(self->vertices * sizeof *queue);     \
+    size_t *from =                                                             \
+        (parent != NULL)                                                       \
+            ? parent                                                           \
+            : ID##_internal_mgraph_malloc(self->vertices * sizeof *from);      \
+                                                                               \
+    if ((queue == NULL) || (from == NULL)) {                                   \
+      if (queue != order) {                                                    \
+        ID##_internal_mgraph_free(queue);                                      \
+      }                                                                        \
+                                                                               \
+      if (from != parent) {                                                    \
+        ID##_internal_mgraph_free(from);                                       \
+      }                                                                        \
+                                                                               \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < self->vertices; ++iter) {                     \
+      from[iter] = SIZE_MAX;                                                   \
+    }                                                                          \
+                                                                               \
+    size_t head = 0;                                                           \
+    size_t tail = 0;                                                           \
+                                                                               \
+    from[source] = source;                                                     \
+    queue[tail++] = source;                                                    \
+                                                                               \
+    while (head < tail) {                                                      \
+      size_t vertex = queue[head++];                                           \
+                                                                               \
+      for (size_t edge = self->offsets[vertex];                                \
+           edge < self->offsets[vertex + 1]; ++edge) {                         \
+        size_t next = self->targets[edge];                                     \
+                                                                               \
+        if (from[next] == SIZE_MAX) {                                          \
+          from[next] = vertex;                                                 \
+          queue[tail++] = next;                                                \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    *visited = tail;                                                           \
+                                                                               \
+    if (queue != order) {                                                      \
+      ID##_internal_mgraph_free(queue);                                        \
+    }                                                                          \
+                                                                               \
+    if (from != parent) {                                                      \
+      ID##_internal_mgraph_free(from);                                         \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Depth first search from the `source` vertex, the neighbours are
+ * visited in the order of their edges. The arguments have the same meaning as
+ * for `mgraph_bfs`, `order` receives the vertices in preorder. The search uses
+ * an explicit stack, so deep graphs do not overflow the call stack. Takes
+ * O(V + E) time.
+ */
+#define MGRAPH_DFS(ID, VT, WT)                                                 \
+  merr_t ID##_mgraph_dfs(const ID##_mgraph_t self, size_t source,              \
+                         size_t *const order, size_t *const parent,            \
+                         size_t *const visited) {                              \
+    if ((self == NULL) || (visited == NULL)) {                                 \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (source >= self->vertices) {                                            \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mgraph_build(self);                             \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    size_t *stack =                                                            \
+        ID##_internal_mgraph_malloc(self->vertices * sizeof *stack);           \
+    size_t *next_edge =                                                        \
+        ID##_internal_mgraph_malloc(self->vertices * sizeof *next_edge);       \
+    size_t *from =                                                             \
+        (parent != NULL)                                                       \
+            ? parent                                                           \
+            : ID##_internal_mgraph_malloc(self->vertices * sizeof *from);      \
+                                                                               \
+    if ((stack == NULL) || (next_edge == NULL) || (from == NULL)) {            \
+      ID##_internal_mgraph_free(stack);                                        \
+      ID##_internal_mgraph_free(next_edge);                                    \
+                                                                               \
+      if (from != parent) {                                                    \
+        ID##_internal_mgraph_free(from);                                       \
+      }                                                                        \
+                                                                               \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < self->vertices; ++iter) {                     \
+      from[iter] = SIZE_MAX;                                                   \
+    }                                                                          \
+                                                                               \
+    size_t top = 0;                                                            \
+    size_t count = 0;                                                          \
+                                                                               \
+    from[source] = source;                                                     \
+    next_edge[source] = self->offsets[source];                                 \
+    stack[top++] = source;                                                     \
+                                                                               \
+    if (order != NULL) {                                                       \
+      order[count] = source;                                                   \
+    }                                                                          \
+                                                                               \
+    ++count;                                                                   \
+                                                                               \
+    while (top > 0) {                                                          \
+      size_t vertex = stack[top - 1];                                          \
+                                                                               \
+      if (next_edge[vertex] == self->offsets[vertex + 1]) {                    \
+        --top;                                                                 \
+        continue;                                                              \
+      }                                                                        \
+                                                                               \
+      size_t next = self->targets[next_edge[vertex]++];                        \
+                                                                               \
+      if (from[next] == SIZE_MAX) {                                            \
+        from[next] = vertex;                                                   \
+        next_edge[next] = self->offsets[next];                                 \
+        stack[top++] = next;                                                   \
+                                                                               \
+        if (order != NULL) {                                                   \
+          order[count] = next;                                                 \
+        }                                                                      \
+                                                                               \
+        ++count;                                                               \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    *visited = count;                                                          \
+                                                                               \
+    ID##_internal_mgraph_free(stack);                                          \
+    ID##_internal_mgraph_free(next_edge);                                      \
+                                                                               \
+    if (from != parent) {                                                      \
+      ID##_internal_mgraph_free(from);                                         \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Dijkstra's shortest paths from the `source` vertex. `dist` receives
+ * the length of the shortest path to every reached vertex and `parent` the
+ * previous vertex on it (the source is its own parent, SIZE_MAX for an
+ * unreached vertex, whose distance is left zero). Both arrays must have
+ * `mgraph_order` elements. The vertices wait in an indexed binary heap of
+ * their distances (every vertex knows its position in the heap, so a shorter
+ * distance moves the vertex up in place), the heap and the relaxations are
+ * generated for WT, so the additions and the comparisons are inlined. The
+ * weights must not be negative. Takes O((V + E)logV) time.
+ */
+#define MGRAPH_DIJKSTRA(ID, VT, WT)                                            \
+  void ID##_internal_mgraph_heap_up(size_t *const heap, size_t *const pos,     \
+                                    const WT *const dist, size_t idx) {        \
+    size_t vertex = heap[idx];                                                 \
+                                                                               \
+    while (idx > 0) {                                                          \
+      size_t up = (idx - 1) / 2;                                               \
+                                                                               \
+      if (!(dist[vertex] < dist[heap[up]])) {                                  \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      heap[idx] = heap[up];                                                    \
+      pos[heap[idx]] = idx;                                                    \
+      idx = up;                                                                \
+    }                                                                          \
+                                                                               \
+    heap[idx] = vertex;                                                        \
+    pos[vertex] = idx;                                                         \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mgraph_heap_down(size_t *const heap, size_t *const pos,   \
+                                      const WT *const dist, size_t size) {     \
+    size_t idx = 0;                                                            \
+    size_t vertex = heap[0];                                                   \
+                                                                               \
+    for (;;) {                                                                 \
+      size_t child = 2 * idx + 1;                                              \
+                                                                               \
+      if (child >= size) {                                                     \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      if ((child + 1 < size) && (dist[heap[child + 1]] < dist[heap[child]])) { \
+        ++child;                                                               \
+      }                                                                        \
+                                                                               \
+      if (!(dist[heap[child]] < dist[vertex])) {                               \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      heap[idx] = heap[child];                                                 \
+      pos[heap[idx]] = idx;                                                    \
+      idx = child;                                                             \
+    }                                                                          \
+                                                                               \
+    heap[idx] = vertex;                                                        \
+    pos[vertex] = idx;                                                         \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mgraph_dijkstra(const ID##_mgraph_t self, size_t source,         \
+                              WT *const dist, size_t *const parent) {          \
+    if ((self == NULL) || (dist == NULL) || (parent == NULL)) {                \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (source >= self->vertices) {                                            \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mgraph_build(self);                             \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    size_t *heap = ID##_internal_mgraph_malloc(self->vertices * sizeof *heap); \
+    size_t *pos = ID##_internal_mgraph_malloc(self->vertices * sizeof *pos);   \
+                                                                               \
+    if ((heap == NULL) || (pos == NULL)) {                                     \
+      ID##_internal_mgraph_free(heap);                                         \
+      ID##_internal_mgraph_free(pos);                                          \
+                                                                               \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < self->vertices; ++iter) {                     \
+      parent[iter] = SIZE_MAX;                                                 \
+      pos[iter] = SIZE_MAX;                                                    \
+      dist[iter] = (WT)0;                                                      \
+    }                                                                          \
+                                                                               \
+    size_t size = 0;                                                           \
+                                                                               \
+    parent[source] = source;                                                   \
+    heap[size++] = source;                                                     \
+    pos[source] = 0;                                                           \
+                                                                               \
+    while (size > 0) {                                                         \
+      size_t vertex = heap[0];                                                 \
+                                                                               \
+      heap[0] = heap[--size];                                                  \
+      pos[vertex] = SIZE_MAX - 1;                                              \
+                                                                               \
+      if (size > 0) {                                                          \
+        ID##_internal_mgraph_heap_down(heap, pos, dist, size);                 \
+      }                                                                        \
+                                                                               \
+      for (size_t edge = self->offsets[vertex];                                \
+           edge < self->offsets[vertex + 1]; ++edge) {                         \
+        size_t next = self->targets[edge];                                     \
+        WT next_dist = dist[vertex] + self->weights[edge];                     \
+                                                                               \
+        if (pos[next] == SIZE_MAX) {                                           \
+          parent[next] = vertex;                                               \
+          dist[next] = next_dist;                                              \
+          heap[size] = next;                                                   \
+          ID##_internal_mgraph_heap_up(heap, pos, dist, size++);               \
+        } else if ((pos[next] < size) && (next_dist < dist[next])) {           \
+          parent[next] = vertex;                                               \
+          dist[next] = next_dist;                                              \
+          ID##_internal_mgraph_heap_up(heap, pos, dist, pos[next]);            \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mgraph_free(heap);                                           \
+    ID##_internal_mgraph_free(pos);                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Topological sort of a directed graph (Kahn's algorithm), `order`
+ * receives all the vertices so that every edge goes from an earlier vertex to
+ * a later one, it must have `mgraph_order` elements. Returns M_INVALID_INPUT
+ * for an undirected graph or for a graph with a cycle. Takes O(V + E) time.
+ */
+#define MGRAPH_TOPO_SORT(ID, VT, WT)                                           \
+  merr_t ID##_mgraph_topo_sort(const ID##_mgraph_t self,                       \
+                               size_t *const order) {                          \
+    if ((self == NULL) || (order == NULL)) {                                   \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->directed == mfalse) {                                            \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mgraph_build(self);                             \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    size_t *in_degree =                                                        \
+        ID##_internal_mgraph_calloc(self->vertices + 1, sizeof *in_degree);    \
+                                                                               \
+    if (in_degree == NULL) {                                                   \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < self->edges; ++iter) {                        \
+      ++in_degree[self->edge_dst[iter]];                                       \
+    }                                                                          \
+                                                                               \
+    size_t head = 0;                                                           \
+    size_t tail = 0;                                                           \
+                                                                               \
+    for (size_t iter = 0; iter < self->vertices; ++iter) {                     \
+      if (in_degree[iter] == 0) {                                              \
+        order[tail++] = iter;                                                  \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    while (head < tail) {                                                      \
+      size_t vertex = order[head++];                                           \
+                                                                               \
+      for (size_t edge = self->offsets[vertex];                                \
+           edge < self->offsets[vertex + 1]; ++edge) {                         \
+        if (--in_degree[self->targets[edge]] == 0) {                           \
+          order[tail++] = self->targets[edge];                                 \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mgraph_free(in_degree);                                      \
+                                                                               \
+    if (tail != self->vertices) {                                              \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Adds the all API for the `mgraph_t` structure. You will not be always
+ * need to use all the API, in this case you must be sure that you call
+ * `MGRAPH` for definition of the graph, any other macro definitions are to
+ * bring new functionalities. The code length may be reduced a lot if you do
+ * not call `MGRAPH_ALL`, the code duplicated when calling `MGRAPH_ALL` for
+ * different ids or different types. The ID protocol is used when different
+ * files want to have the same two typed structures in order to avoid name
+ * collisions.
+ */
+#define MGRAPH_ALL_WITH_ALLOC(ID, VT, WT, ALLOC)                               \
+  MGRAPH_WITH_ALLOC(ID, VT, WT, ALLOC)                                         \
+  MGRAPH_EMPTY(ID, VT, WT)                                                     \
+  MGRAPH_SIZE(ID, VT, WT)                                                      \
+  MGRAPH_RESERVE(ID, VT, WT)                                                   \
+  MGRAPH_ADD_VERTEX(ID, VT, WT)                                                \
+  MGRAPH_ADD_EDGE(ID, VT, WT)                                                  \
+  MGRAPH_VERTEX(ID, VT, WT)                                                    \
+  MGRAPH_NEIGHBOURS(ID, VT, WT)                                                \
+  MGRAPH_BFS(ID, VT, WT)                                                       \
+  MGRAPH_DFS(ID, VT, WT)                                                       \
+  MGRAPH_DIJKSTRA(ID, VT, WT)                                                  \
+  MGRAPH_TOPO_SORT(ID, VT, WT)
+
+/**
+ * @brief Adds the all API for the `mgraph` structure with the standard
+ * library allocator, see `MGRAPH_ALL_WITH_ALLOC`.
+ */
+#define MGRAPH_ALL(ID, VT, WT) MGRAPH_ALL_WITH_ALLOC(ID, VT, WT, m_stdlib)
+
+#endif /* MACROS_GENERICS_GRAPH_UTILS_H_ */
@@ -0,0 +1,539 @@
+/**
+ * @file m_hash.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2023-06-12
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of c-language-data-structures.
+ *
+ * c-language-data-structures is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * c-language-data-structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with c-language-data-structures.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MACROS_GENERICS_HASH_MAP_UTILS_H_
+#define MACROS_GENERICS_HASH_MAP_UTILS_H_
+
+#include "./m_config.h"
+
+/**
+ * @brief Utility file containing macros that generate functions for a generic
+ * hash map with open addressing.
+ *
+ * @param ID the id of the structure in order to reduce name collisions.
+ * @param K the type of the keys stored inside the structure.
+ * @param V the type of the values stored inside the structure.
+ * @param HASH the name of the hash function (or function like macro) of a key,
+ * `size_t HASH(const K *const)`, it is known at compile time, so it is inlined
+ * in the probe loops.
+ * @param EQ the name of the equality function (or function like macro) of two
+ * keys, `mbool_t EQ(const K *const, const K *const)`, nonzero for equal keys,
+ * it is also inlined.
+ */
+
+/**
+ * @brief Least number of slots of the table after the first insertion, the
+ * number of slots is always a power of two.
+ */
+#define MHASH_MIN_CAPACITY 16
+
+/**
+ * @brief Multiplier of the Fibonacci hashing, the hash of a key is multiplied
+ * by it and the top bits of the product pick the slot, so a weak hash (the
+ * identity of an integer) still spreads the keys over the whole table.
+ */
+#define MHASH_GOLDEN_RATIO 0x9E3779B97F4A7C15ULL
+
+/**
+ * @brief Hash and equality of integer keys (any integer type, enums or
+ * pointers compared by address), to be given as HASH and EQ.
+ */
+#define MHASH_HASH_INTEGER(key) ((size_t)*(key))
+#define MHASH_EQUAL_INTEGER(fst, snd) (*(fst) == *(snd))
+
+/**
+ * @brief Generates the `mhash_t` structure depending on the name and the types
+ * of the keys and values. Also generates basic function for creation and
+ * freeing memory for the structure and the internal probing functions. The
+ * structure require two methods for freeing the memory of the keys and of the
+ * values, if they are not stored as pointers (T <=> *M), then the free
+ * functions must be `NULL`.
+ *
+ * The entries (key and value) are stored inline in one array of power of two
+ * slots, a second array keeps one control byte per slot: 0 for an empty slot
+ * or 7 bits of the hash of the key (with the high bit set) for a full one, so
+ * the equality function is called almost just for the searched key. A key is
+ * stored in the first free slot after its home slot (linear probing), the
+ * table doubles when it becomes three quarters full, and an erased entry is
+ * filled by shifting back the next entries of its run, so the table never
+ * keeps tombstones.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
+ */
+#define MHASH_WITH_ALLOC(ID, K, V, HASH, EQ, ALLOC)                            \
+  M_ALLOC(ID, mhash, ALLOC)                                                    \
+                                                                               \
+  FREE_FUNC(ID##_key, K)                                                       \
+  FREE_FUNC(ID##_value, V)                                                     \
+                                                                               \
+  typedef struct ID##_mhash_entry_s {                                          \
+    K key;                                                                     \
+    V value;                                                                   \
+  } ID##_mhash_entry_t;                                                        \
+                                                                               \
+  typedef struct ID##_mhash_s {                                                \
+    ID##_mhash_entry_t *entries;                                               \
+    uint8_t *ctrl;                                                             \
+    ID##_key_free_func key_frd;                                                \
+    ID##_value_free_func value_frd;                                            \
+    size_t size;                                                               \
+    size_t capacity;                                                           \
+    uint32_t shift;                                                            \
+  } ID##_mhash_ptr_t, *ID##_mhash_t;                                           \
+                                                                               \
+  ID##_mhash_t ID##_mhash(ID##_key_free_func key_frd,                          \
+                          ID##_value_free_func value_frd) {                    \
+    ID##_mhash_t self = ID##_internal_mhash_malloc(sizeof *self);              \
+                                                                               \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->key_frd = key_frd;                                                   \
+    self->value_frd = value_frd;                                               \
+                                                                               \
+    self->entries = NULL;                                                      \
+    self->ctrl = NULL;                                                         \
+    self->size = 0;                                                            \
+    self->capacity = 0;                                                        \
+    self->shift = 64;                                                          \
+                                                                               \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mhash_free_entry(const ID##_mhash_ptr_t *const self,      \
+                                      ID##_mhash_entry_t *const entry) {       \
+    if (self->key_frd != NULL) {                                               \
+      self->key_frd(&entry->key);                                              \
+    }                                                                          \
+                                                                               \
+    if (self->value_frd != NULL) {                                             \
+      self->value_frd(&entry->value);                                          \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mhash_free(ID##_mhash_t *self) {                                 \
+    if ((self != NULL) && (*self != NULL)) {                                   \
+      if (((*self)->key_frd != NULL) || ((*self)->value_frd != NULL)) {        \
+        for (size_t iter = 0; iter < (*self)->capacity; ++iter) {              \
+          if ((*self)->ctrl[iter] != 0) {                                      \
+            ID##_internal_mhash_free_entry(*self, &(*self)->entries[iter]);    \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mhash_free((*self)->entries);                              \
+      ID##_internal_mhash_free((*self)->ctrl);                                 \
+      ID##_internal_mhash_free(*self);                                         \
+      *self = NULL;                                                            \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    return M_FREE_NULL;                                                        \
+  }                                                                            \
+                                                                               \
+  size_t ID##_internal_mhash_home(const ID##_mhash_ptr_t *const self,          \
+                                  const K *const key, uint8_t *const tag) {    \
+    uint64_t hash = (uint64_t)HASH(key) * MHASH_GOLDEN_RATIO;                  \
+                                                                               \
+    *tag = (uint8_t)(0x80 | ((hash >> (self->shift - 7)) & 0x7F));             \
+                                                                               \
+    return (size_t)(hash >> self->shift);                                      \
+  }                                                                            \
+                                                                               \
+  size_t ID##_internal_mhash_find_slot(const ID##_mhash_ptr_t *const self,     \
+                                       const K *const key) {                   \
+    if (self->size == 0) {                                                     \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    uint8_t tag = 0;                                                           \
+    size_t mask = self->capacity - 1;                                          \
+    size_t slot = ID##_internal_mhash_home(self, key, &tag);                   \
+                                                                               \
+    while (self->ctrl[slot] != 0) {                                            \
+      if ((self->ctrl[slot] == tag) && EQ(&self->entries[slot].key, key)) {    \
+        return slot;                                                           \
+      }                                                                        \
+                                                                               \
+      slot = (slot + 1) & mask;                                                \
+    }                                                                          \
+                                                                               \
+    return SIZE_MAX;                                                           \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mhash_rehash(const ID##_mhash_t self,                   \
+                                    size_t capacity) {                         \
+    if (capacity > SIZE_MAX / sizeof(ID##_mhash_entry_t)) {                    \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    ID##_mhash_entry_t *entries =                                              \
+        ID##_internal_mhash_malloc(capacity * sizeof *entries);                \
+    uint8_t *ctrl = ID##_internal_mhash_calloc(capacity, sizeof *ctrl);        \
+                                                                               \
+    if ((entries == NULL) || (ctrl == NULL)) {                                 \
+      ID##_internal_mhash_free(entries);                                       \
+      ID##_internal_mhash_free(ctrl);                                          \
+                                                                               \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    ID##_mhash_entry_t *old_entries = self->entries;                           \
+    uint8_t *old_ctrl = self->ctrl;                                            \
+    size_t old_capacity = self->capacity;                                      \
+                                                                               \
+    uint32_t shift = 64;                                                       \
+                                                                               \
+    while (((size_t)1 << (64 - shift)) < capacity) {                           \
+      --shift;                                                                 \
+    }                                                                          \
+                                                                               \
+    self->entries = entries;                                                   \
+    self->ctrl = ctrl;                                                         \
+    self->capacity = capacity;                                                 \
+    self->shift = shift;                                                       \
+                                                                               \
+    size_t mask = capacity - 1;                                                \
+                                                                               \
+    for (size_t iter = 0; iter < old_capacity; ++iter) {                       \
+      if (old_ctrl[iter] != 0) {                                               \
+        uint8_t tag = 0;                                                       \
+        size_t slot =                                                          \
+            ID##_internal_mhash_home(self, &old_entries[iter].key, &tag);      \
+                                                                               \
+        while (ctrl[slot] != 0) {                                              \
+          slot = (slot + 1) & mask;                                            \
+        }                                                                      \
+                                                                               \
+        ctrl[slot] = tag;                                                      \
+        entries[slot] = old_entries[iter];                                     \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mhash_free(old_entries);                                     \
+    ID##_internal_mhash_free(old_ctrl);                                        \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mhash_fit(const ID##_mhash_t self, size_t size) {       \
+    if (size <= self->capacity - self->capacity / 4) {                         \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t capacity =                                                          \
+        (self->capacity == 0) ? MHASH_MIN_CAPACITY : self->capacity;           \
+                                                                               \
+    while (size > capacity - capacity / 4) {                                   \
+      if (capacity > SIZE_MAX / 2) {                                           \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+                                                                               \
+      capacity *= 2;                                                           \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mhash_rehash(self, capacity);                         \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mhash_put(const ID##_mhash_t self, K *const key,        \
+                                 V *const value) {                             \
+    merr_t err = ID##_internal_mhash_fit(self, self->size + 1);                \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    uint8_t tag = 0;                                                           \
+    size_t mask = self->capacity - 1;                                          \
+    size_t slot = ID##_internal_mhash_home(self, key, &tag);                   \
+                                                                               \
+    while (self->ctrl[slot] != 0) {                                            \
+      if ((self->ctrl[slot] == tag) && EQ(&self->entries[slot].key, key)) {    \
+        if (self->key_frd != NULL) {                                           \
+          self->key_frd(key);                                                  \
+        }                                                                      \
+                                                                               \
+        if (self->value_frd != NULL) {                                         \
+          self->value_frd(&self->entries[slot].value);                         \
+        }                                                                      \
+                                                                               \
+        self->entries[slot].value = *value;                                    \
+                                                                               \
+        return M_OK;                                                           \
+      }                                                                        \
+                                                                               \
+      slot = (slot + 1) & mask;                                                \
+    }                                                                          \
+                                                                               \
+    self->ctrl[slot] = tag;                                                    \
+    self->entries[slot].key = *key;                                            \
+    self->entries[slot].value = *value;                                        \
+    ++(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Defines the `mhash` structure with the standard library
+ * allocator, see `MHASH_WITH_ALLOC`.
+ */
+#define MHASH(ID, K, V, HASH, EQ) MHASH_WITH_ALLOC(ID, K, V, HASH, EQ, m_stdlib)
+
+/**
+ * @brief Function to check if a hash map object is empty or not. A `NULL`
+ * hash map is also considered as an empty hash map.
+ */
+#define MHASH_EMPTY(ID, K, V)                                                  \
+  mbool_t ID##_mhash_empty(const ID##_mhash_ptr_t *const self) {               \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }
+
+/**
+ * @brief Get the number of entries of the hash map. If hash map is not
+ * allocated then function will return SIZE_MAX value.
+ */
+#define MHASH_SIZE(ID, K, V)                                                   \
+  size_t ID##_mhash_size(const ID##_mhash_ptr_t *const self) {                 \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->size;                                                         \
+  }
+
+/**
+ * @brief Preallocates the table for at least `size` entries, so the table is
+ * not rehashed until it holds more entries. The table never shrinks.
+ */
+#define MHASH_RESERVE(ID, K, V)                                                \
+  merr_t ID##_mhash_reserve(const ID##_mhash_t self, size_t size) {            \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mhash_fit(self, size);                                \
+  }
+
+/**
+ * @brief Inserts a key and its value in the hash map. If the key is already
+ * stored, its value is replaced (the old value is freed by the free function
+ * of the values) and the given key is freed by the free function of the keys,
+ * the stored key stays in the map.
+ */
+#define MHASH_PUT(ID, K, V)                                                    \
+  merr_t ID##_mhash_put(const ID##_mhash_t self, K key, V value) {             \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mhash_put(self, &key, &value);                        \
+  }
+
+/**
+ * @brief Inserts `size` keys with their values from two arrays (the i-th key
+ * gets the i-th value), the table is grown once before the insertions. The
+ * keys and the values are copied, like for `mhash_put`.
+ */
+#define MHASH_PUT_ALL(ID, K, V)                                                \
+  merr_t ID##_mhash_put_all(const ID##_mhash_t self, const K *const keys,      \
+                            const V *const values, size_t size) {              \
+    if ((self == NULL) || (keys == NULL) || (values == NULL)) {                \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (size > SIZE_MAX - self->size) {                                        \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mhash_fit(self, self->size + size);             \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < size; ++iter) {                               \
+      K key = keys[iter];                                                      \
+      V value = values[iter];                                                  \
+                                                                               \
+      ID##_internal_mhash_put(self, &key, &value);                             \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Finds the value of a key, the value is stored in the accumulator if
+ * it is not `NULL` (like a `contains` method otherwise). `mhash_find_ptr`
+ * returns the address of the value inside the table, so it can be modified in
+ * place, the address is valid until the next insertion or erase.
+ */
+#define MHASH_FIND(ID, K, V)                                                   \
+  merr_t ID##_mhash_find(const ID##_mhash_ptr_t *const self, K key,            \
+                         V *const acc) {                                       \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t slot = ID##_internal_mhash_find_slot(self, &key);                   \
+                                                                               \
+    if (slot == SIZE_MAX) {                                                    \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    if (acc != NULL) {                                                         \
+      *acc = self->entries[slot].value;                                        \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  V *ID##_mhash_find_ptr(const ID##_mhash_ptr_t *const self, K key) {          \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t slot = ID##_internal_mhash_find_slot(self, &key);                   \
+                                                                               \
+    if (slot == SIZE_MAX) {                                                    \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return &self->entries[slot].value;                                         \
+  }
+
+/**
+ * @brief Erases a key and its value from the hash map, both are freed by the
+ * free functions. The next entries of the run are shifted back into the free
+ * slot (when their home slot allows it), so the searches never step over
+ * erased slots.
+ */
+#define MHASH_POP(ID, K, V)                                                    \
+  merr_t ID##_mhash_pop(const ID##_mhash_t self, K key) {                      \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      return M_POP_FROM_EMPTY;                                                 \
+    }                                                                          \
+                                                                               \
+    size_t hole = ID##_internal_mhash_find_slot(self, &key);                   \
+                                                                               \
+    if (hole == SIZE_MAX) {                                                    \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mhash_free_entry(self, &self->entries[hole]);                \
+                                                                               \
+    size_t mask = self->capacity - 1;                                          \
+                                                                               \
+    for (size_t slot = (hole + 1) & mask; self->ctrl[slot] != 0;               \
+         slot = (slot + 1) & mask) {                                           \
+      uint8_t tag = 0;                                                         \
+      size_t home = ID##_internal_mhash_home(self, &self->entries[slot].key,   \
+                                             &tag);                            \
+                                                                               \
+      if (((slot - home) & mask) >= ((slot - hole) & mask)) {                  \
+        self->ctrl[hole] = self->ctrl[slot];                                   \
+        self->entries[hole] = self->entries[slot];                             \
+        hole = slot;                                                           \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    self->ctrl[hole] = 0;                                                      \
+    --(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Traverses the hash map and do action(basically it is used for
+ * printing the map) on all the entries, in the order of the slots (which is
+ * not the order of the insertions).
+ */
+#define MHASH_TRAVERSE(ID, K, V)                                               \
+  typedef void (*ID##_mhash_action_func)(const K *const, const V *const);      \
+                                                                               \
+  merr_t ID##_mhash_traverse(const ID##_mhash_ptr_t *const self,               \
+                             ID##_mhash_action_func action) {                  \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      printf("[ ]\n");                                                         \
+    } else {                                                                   \
+      printf("[");                                                             \
+                                                                               \
+      for (size_t iter = 0; iter < self->capacity; ++iter) {                   \
+        if (self->ctrl[iter] != 0) {                                           \
+          action(&self->entries[iter].key, &self->entries[iter].value);        \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      printf(" ]");                                                            \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Adds the all API for the `mhash_t` structure. You will not be always
+ * need to use all the API, in this case you must be sure that you call `MHASH`
+ * for definition of the hash map, any other macro definitions are to bring
+ * new functionalities. The code length may be reduced a lot if you do not call
+ * `MHASH_ALL`, the code duplicated when calling `MHASH_ALL` for different ids
+ * or different types. The ID protocol is used when different files want to
+ * have the same two typed structures in order to avoid name collisions.
+ */
+#define MHASH_ALL_WITH_ALLOC(ID, K, V, HASH, EQ, ALLOC)                        \
+  MHASH_WITH_ALLOC(ID, K, V, HASH, EQ, ALLOC)                                  \
+  MHASH_EMPTY(ID, K, V)                                                        \
+  MHASH_SIZE(ID, K, V)                                                         \
+  MHASH_RESERVE(ID, K, V)                                                      \
+  MHASH_PUT(ID, K, V)                                                          \
+  MHASH_PUT_ALL(ID, K, V)                                                      \
+  MHASH_FIND(ID, K, V)                                                         \
+  MHASH_POP(ID, K, V)                                                          \
+  MHASH_TRAVERSE(ID, K, V)
+
+/**
+ * @brief Adds the all API for the `mhash` structure with the standard
+ * library allocator, see `MHASH_ALL_WITH_ALLOC`.
+ */
+#define MHASH_ALL(ID, K, V, HASH, EQ) MHASH_ALL_WITH_ALLOC(ID, K, V, HASH, EQ, m_stdlib)
+
+#endif /* MACROS_GENERICS_HASH_MAP_UTILS_H_ */
@@ -0,0 +1,624 @@
+/**
+ * @file m_hashset.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2023-06-12
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of c-language-data-structures.
+ *
+ * c-language-data-structures is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * c-language-data-structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with c-language-data-structures.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MACROS_GENERICS_HASH_SET_UTILS_H_
+#define MACROS_GENERICS_HASH_SET_UTILS_H_
+
+#include "./m_config.h"
+
+/**
+ * @brief Utility file containing macros that generate functions for a generic
+ * hash set with a Swiss table layout.
+ *
+ * @param ID the id of the structure in order to reduce name collisions.
+ * @param T the type of the data stored inside the structure.
+ * @param HASH the name of the hash function (or function like macro) of an
+ * element, `size_t HASH(const T *const)`, it is known at compile time, so it
+ * is inlined in the probe loops.
+ * @param EQ the name of the equality function (or function like macro) of two
+ * elements, `mbool_t EQ(const T *const, const T *const)`, nonzero for equal
+ * elements, it is also inlined.
+ */
+
+/**
+ * @brief Least number of slots of the table after the first insertion, the
+ * number of slots is always a power of two.
+ */
+#define MHASHSET_MIN_CAPACITY 16
+
+/**
+ * @brief Multiplier of the Fibonacci hashing. The top 7 bits of the product of
+ * the hash and of the multiplier are stored in the control byte of the slot,
+ * the next bits pick the first group of the probe sequence.
+ */
+#define MHASHSET_GOLDEN_RATIO 0x9E3779B97F4A7C15ULL
+
+/**
+ * @brief Values of the control bytes, a full slot keeps 7 bits of the hash of
+ * its element (the high bit is clear).
+ */
+#define MHASHSET_CTRL_EMPTY 0x80
+#define MHASHSET_CTRL_DELETED 0xFE
+
+/**
+ * @brief Test one group of control bytes at once. `MHASHSET_GROUP_LOAD` loads
+ * MHASHSET_GROUP_WIDTH control bytes, the other macros return a mask with one
+ * bit set for every matching slot of the group: a slot with the given 7 bits
+ * of hash, an empty slot, or a free (empty or deleted) slot. The index of a
+ * slot in the group is the index of its bit shifted by MHASHSET_MASK_SHIFT.
+ * SSE2 and NEON compare 16 bytes with one instruction, otherwise 8 bytes are
+ * compared in one 64 bits word (the hash match may give false positives, which
+ * are filtered by the equality function).
+ */
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+#define MHASHSET_GROUP_WIDTH 16
+#define MHASHSET_MASK_SHIFT 0
+
+typedef __m128i mhashset_group_t;
+
+#define MHASHSET_GROUP_LOAD(ctrl) _mm_loadu_si128((const __m128i *)(ctrl))
+#define MHASHSET_GROUP_MATCH(group, h2)                                        \
+  ((uint64_t)_mm_movemask_epi8(                                                \
+      _mm_cmpeq_epi8((group), _mm_set1_epi8((char)(h2)))))
+#define MHASHSET_GROUP_MATCH_EMPTY(group)                                      \
+  MHASHSET_GROUP_MATCH((group), MHASHSET_CTRL_EMPTY)
+#define MHASHSET_GROUP_MATCH_FREE(group)                                       \
+  ((uint64_t)_mm_movemask_epi8((group)))
+
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+
+#define MHASHSET_GROUP_WIDTH 16
+#define MHASHSET_MASK_SHIFT 2
+
+typedef uint8x16_t mhashset_group_t;
+
+#define MHASHSET_GROUP_LOAD(ctrl) vld1q_u8((const uint8_t *)(ctrl))
+#define MHASHSET_GROUP_NIBBLES(bytes)                                          \
+  (vget_lane_u64(                                                              \
+       vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(bytes), 4)), 0) &  \
+   0x8888888888888888ULL)
+#define MHASHSET_GROUP_MATCH(group, h2)                                        \
+  MHASHSET_GROUP_NIBBLES(vceqq_u8((group), vdupq_n_u8((uint8_t)(h2))))
+#define MHASHSET_GROUP_MATCH_EMPTY(group)                                      \
+  MHASHSET_GROUP_MATCH((group), MHASHSET_CTRL_EMPTY)
+#define MHASHSET_GROUP_MATCH_FREE(group)                                       \
+  MHASHSET_GROUP_NIBBLES(vcgeq_u8((group), vdupq_n_u8(MHASHSET_CTRL_EMPTY)))
+
+#else
+
+#define MHASHSET_GROUP_WIDTH 8
+#define MHASHSET_MASK_SHIFT 3
+
+typedef uint64_t mhashset_group_t;
+
+#define MHASHSET_LSBS 0x0101010101010101ULL
+#define MHASHSET_MSBS 0x8080808080808080ULL
+
+#define MHASHSET_GROUP_LOAD(ctrl)                                              \
+  ((uint64_t)(ctrl)[0] | ((uint64_t)(ctrl)[1] << 8) |                          \
+   ((uint64_t)(ctrl)[2] << 16) | ((uint64_t)(ctrl)[3] << 24) |                 \
+   ((uint64_t)(ctrl)[4] << 32) | ((uint64_t)(ctrl)[5] << 40) |                 \
+   ((uint64_t)(ctrl)[6] << 48) | ((uint64_t)(ctrl)[7] << 56))
+#define MHASHSET_GROUP_MATCH(group, h2)                                        \
+  ((((group) ^ (MHASHSET_LSBS * (h2))) - MHASHSET_LSBS) &                      \
+   ~((group) ^ (MHASHSET_LSBS * (h2))) & MHASHSET_MSBS)
+#define MHASHSET_GROUP_MATCH_EMPTY(group)                                      \
+  ((group) & ~((group) << 6) & MHASHSET_MSBS)
+#define MHASHSET_GROUP_MATCH_FREE(group) ((group) & MHASHSET_MSBS)
+
+#endif
+
+/**
+ * @brief Generates the `mhashset_t` structure depending on the name and type.
+ * Also generates basic function for creation and freeing memory for the
+ * structure and the internal probing functions. This structure require a
+ * method for freeing data memory, if data is not stored as a pointer
+ * (T <=> *M), then the free function must be `NULL`.
+ *
+ * The elements are stored inline in one array of power of two slots, split in
+ * groups of MHASHSET_GROUP_WIDTH slots. A second array keeps one control byte
+ * per slot (empty, deleted or 7 bits of the hash of the element), a probe
+ * compares the control bytes of a whole group with the searched 7 bits and
+ * calls the equality function just for the matching slots. The search stops at
+ * the first group that has an empty slot, the next group is picked by
+ * triangular probing, which visits every group. An erased slot becomes empty
+ * if its group has an empty slot (no probe ever went past the group),
+ * otherwise it becomes deleted. At most seven eighths of the slots are used
+ * (full or deleted), then the table is rebuilt: with the same number of slots
+ * if many of them are deleted, otherwise with twice as many slots.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
+ */
+#define MHASHSET_WITH_ALLOC(ID, T, HASH, EQ, ALLOC)                            \
+  M_ALLOC(ID, mhashset, ALLOC)                                                 \
+                                                                               \
+  FREE_FUNC(ID, T)                                                             \
+                                                                               \
+  typedef struct ID##_mhashset_s {                                             \
+    T *data;                                                                   \
+    uint8_t *ctrl;                                                             \
+    ID##_free_func frd;                                                        \
+    size_t size;                                                               \
+    size_t capacity;                                                           \
+    size_t growth_left;                                                        \
+    uint32_t shift;                                                            \
+  } ID##_mhashset_ptr_t, *ID##_mhashset_t;                                     \
+                                                                               \
+  ID##_mhashset_t ID##_mhashset(ID##_free_func frd) {                          \
+    ID##_mhashset_t self = ID##_internal_mhashset_malloc(sizeof *self);        \
+                                                                               \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->frd = frd;                                                           \
+                                                                               \
+    self->data = NULL;                                                         \
+    self->ctrl = NULL;                                                         \
+    self->size = 0;                                                            \
+    self->capacity = 0;                                                        \
+    self->growth_left = 0;                                                     \
+    self->shift = 57;                                                          \
+                                                                               \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mhashset_free(ID##_mhashset_t *self) {                           \
+    if ((self != NULL) && (*self != NULL)) {                                   \
+      if ((*self)->frd != NULL) {                                              \
+        for (size_t iter = 0; iter < (*self)->capacity; ++iter) {              \
+          if ((*self)->ctrl[iter] < MHASHSET_CTRL_EMPTY) {                     \
+            (*self)->frd(&(*self)->data[iter]);                                \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mhashset_free((*self)->data);                              \
+      ID##_internal_mhashset_free((*self)->ctrl);                              \
+      ID##_internal_mhashset_free(*self);                                      \
+      *self = NULL;                                                            \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    return M_FREE_NULL;                                                        \
+  }                                                                            \
+                                                                               \
+  size_t ID##_internal_mhashset_home(const ID##_mhashset_ptr_t *const self,    \
+                                     const T *const data, uint8_t *const h2) { \
+    uint64_t hash = (uint64_t)HASH(data) * MHASHSET_GOLDEN_RATIO;              \
+                                                                               \
+    *h2 = (uint8_t)(hash >> 57);                                               \
+                                                                               \
+    return (size_t)(hash >> self->shift) &                                     \
+           (self->capacity / MHASHSET_GROUP_WIDTH - 1);                        \
+  }                                                                            \
+                                                                               \
+  size_t ID##_internal_mhashset_find_slot(                                     \
+      const ID##_mhashset_ptr_t *const self, const T *const data) {            \
+    if (self->size == 0) {                                                     \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    uint8_t h2 = 0;                                                            \
+    size_t group_mask = self->capacity / MHASHSET_GROUP_WIDTH - 1;             \
+    size_t group = ID##_internal_mhashset_home(self, data, &h2);               \
+                                                                               \
+    for (size_t step = 1;; ++step) {                                           \
+      size_t base = group * MHASHSET_GROUP_WIDTH;                              \
+      mhashset_group_t ctrl = MHASHSET_GROUP_LOAD(&self->ctrl[base]);          \
+                                                                               \
+      for (uint64_t mask = MHASHSET_GROUP_MATCH(ctrl, h2); mask != 0;          \
+           mask &= mask - 1) {                                                 \
+        size_t slot =                                                          \
+            base + ((size_t)__builtin_ctzll(mask) >> MHASHSET_MASK_SHIFT);     \
+                                                                               \
+        if (EQ(&self->data[slot], data)) {                                     \
+          return slot;                                                         \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      if (MHASHSET_GROUP_MATCH_EMPTY(ctrl) != 0) {                             \
+        return SIZE_MAX;                                                       \
+      }                                                                        \
+                                                                               \
+      group = (group + step) & group_mask;                                     \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  size_t ID##_internal_mhashset_free_slot(                                     \
+      const ID##_mhashset_ptr_t *const self, const T *const data,              \
+      uint8_t *const h2) {                                                     \
+    size_t group_mask = self->capacity / MHASHSET_GROUP_WIDTH - 1;             \
+    size_t group = ID##_internal_mhashset_home(self, data, h2);                \
+                                                                               \
+    for (size_t step = 1;; ++step) {                                           \
+      size_t base = group * MHASHSET_GROUP_WIDTH;                              \
+      mhashset_group_t ctrl = MHASHSET_GROUP_LOAD(&self->ctrl[base]);          \
+      uint64_t mask = MHASHSET_GROUP_MATCH_FREE(ctrl);                         \
+                                                                               \
+      if (mask != 0) {                                                         \
+        return base + ((size_t)__builtin_ctzll(mask) >> MHASHSET_MASK_SHIFT);  \
+      }                                                                        \
+                                                                               \
+      group = (group + step) & group_mask;                                     \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mhashset_rehash(const ID##_mhashset_t self,             \
+                                       size_t capacity) {                      \
+    if (capacity > SIZE_MAX / sizeof(T)) {                                     \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    T *data = ID##_internal_mhashset_malloc(capacity * sizeof *data);          \
+    uint8_t *ctrl = ID##_internal_mhashset_malloc(capacity * sizeof *ctrl);    \
+                                                                               \
+    if ((data == NULL) || (ctrl == NULL)) {                                    \
+      ID##_internal_mhashset_free(data);                                       \
+      ID##_internal_mhashset_free(ctrl);                                       \
+                                                                               \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    memset(ctrl, MHASHSET_CTRL_EMPTY, capacity * sizeof *ctrl);                \
+                                                                               \
+    T *old_data = self->data;                                                  \
+    uint8_t *old_ctrl = self->ctrl;                                            \
+    size_t old_capacity = self->capacity;                                      \
+                                                                               \
+    uint32_t shift = 57;                                                       \
+                                                                               \
+    while (((size_t)MHASHSET_GROUP_WIDTH << (57 - shift)) < capacity) {        \
+      --shift;                                                                 \
+    }                                                                          \
+                                                                               \
+    self->data = data;                                                         \
+    self->ctrl = ctrl;                                                         \
+    self->capacity = capacity;                                                 \
+    self->shift = shift;                                                       \
+    self->growth_left = capacity - capacity / 8 - self->size;                  \
+                                                                               \
+    for (size_t iter = 0; iter < old_capacity; ++iter) {                       \
+      if (old_ctrl[iter] < MHASHSET_CTRL_EMPTY) {                              \
+        uint8_t h2 = 0;                                                        \
+        size_t slot =                                                          \
+            ID##_internal_mhashset_free_slot(self, &old_data[iter], &h2);      \
+                                                                               \
+        ctrl[slot] = h2;                                                       \
+        data[slot] = old_data[iter];                                           \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mhashset_free(old_data);                                     \
+    ID##_internal_mhashset_free(old_ctrl);                                     \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mhashset_fit(const ID##_mhashset_t self, size_t size) { \
+    if (size <= self->size + self->growth_left) {                              \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t capacity =                                                          \
+        (self->capacity == 0) ? MHASHSET_MIN_CAPACITY : self->capacity;        \
+                                                                               \
+    while (size > capacity - capacity / 8) {                                   \
+      if (capacity > SIZE_MAX / 2) {                                           \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+                                                                               \
+      capacity *= 2;                                                           \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mhashset_rehash(self, capacity);                      \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mhashset_push(const ID##_mhashset_t self,               \
+                                     T *const data) {                          \
+    if (ID##_internal_mhashset_find_slot(self, data) != SIZE_MAX) {            \
+      if (self->frd != NULL) {                                                 \
+        self->frd(data);                                                       \
+      }                                                                        \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    if (self->growth_left == 0) {                                              \
+      size_t capacity = MHASHSET_MIN_CAPACITY;                                 \
+                                                                               \
+      if (self->capacity != 0) {                                               \
+        capacity = self->capacity;                                             \
+                                                                               \
+        if (self->size > self->capacity / 2) {                                 \
+          if (capacity > SIZE_MAX / 2) {                                       \
+            return M_MALLOC_FAILED;                                            \
+          }                                                                    \
+                                                                               \
+          capacity *= 2;                                                       \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      merr_t err = ID##_internal_mhashset_rehash(self, capacity);              \
+                                                                               \
+      if (err != M_OK) {                                                       \
+        return err;                                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    uint8_t h2 = 0;                                                            \
+    size_t slot = ID##_internal_mhashset_free_slot(self, data, &h2);           \
+                                                                               \
+    if (self->ctrl[slot] == MHASHSET_CTRL_EMPTY) {                             \
+      --(self->growth_left);                                                   \
+    }                                                                          \
+                                                                               \
+    self->ctrl[slot] = h2;                                                     \
+    self->data[slot] = *data;                                                  \
+    ++(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Defines the `mhashset` structure with the standard library
+ * allocator, see `MHASHSET_WITH_ALLOC`.
+ */
+#define MHASHSET(ID, T, HASH, EQ) MHASHSET_WITH_ALLOC(ID, T, HASH, EQ, m_stdlib)
+
+/**
+ * @brief Function to check if a hash set object is empty or not. A `NULL`
+ * hash set is also considered as an empty hash set.
+ */
+#define MHASHSET_EMPTY(ID, T)                                                  \
+  mbool_t ID##_mhashset_empty(const ID##_mhashset_ptr_t *const self) {         \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }
+
+/**
+ * @brief Get the number of elements of the hash set. If hash set is not
+ * allocated then function will return SIZE_MAX value.
+ */
+#define MHASHSET_SIZE(ID, T)                                                   \
+  size_t ID##_mhashset_size(const ID##_mhashset_ptr_t *const self) {           \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->size;                                                         \
+  }
+
+/**
+ * @brief Preallocates the table for at least `size` elements, so the table is
+ * not rebuilt until it holds more elements. The table never shrinks.
+ */
+#define MHASHSET_RESERVE(ID, T)                                                \
+  merr_t ID##_mhashset_reserve(const ID##_mhashset_t self, size_t size) {      \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mhashset_fit(self, size);                             \
+  }
+
+/**
+ * @brief Inserts an element in the hash set, if an equal element is already
+ * stored the given element is freed by the free function and the set does not
+ * change. An element is new if the size of the set grows.
+ */
+#define MHASHSET_PUSH(ID, T)                                                   \
+  merr_t ID##_mhashset_push(const ID##_mhashset_t self, T data) {              \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mhashset_push(self, &data);                           \
+  }
+
+/**
+ * @brief Inserts `size` elements from an array, the table is grown once before
+ * the insertions. The elements are copied, like for `mhashset_push`.
+ */
+#define MHASHSET_PUSH_ALL(ID, T)                                               \
+  merr_t ID##_mhashset_push_all(const ID##_mhashset_t self,                    \
+                                const T *const arr, size_t size) {             \
+    if ((self == NULL) || (arr == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (size > SIZE_MAX - self->size) {                                        \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_internal_mhashset_fit(self, self->size + size);          \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < size; ++iter) {                               \
+      T data = arr[iter];                                                      \
+                                                                               \
+      err = ID##_internal_mhashset_push(self, &data);                          \
+                                                                               \
+      if (err != M_OK) {                                                       \
+        return err;                                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Checks if an element is in the hash set (`mhashset_contains`) and
+ * fetches the stored element in an accumulator (`mhashset_find`), the
+ * accumulator may be `NULL`.
+ */
+#define MHASHSET_FIND(ID, T)                                                   \
+  mbool_t ID##_mhashset_contains(const ID##_mhashset_ptr_t *const self,        \
+                                 T data) {                                     \
+    if (self == NULL) {                                                        \
+      return mfalse;                                                           \
+    }                                                                          \
+                                                                               \
+    if (ID##_internal_mhashset_find_slot(self, &data) == SIZE_MAX) {           \
+      return mfalse;                                                           \
+    }                                                                          \
+                                                                               \
+    return mtrue;                                                              \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mhashset_find(const ID##_mhashset_ptr_t *const self, T data,     \
+                            T *const acc) {                                    \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t slot = ID##_internal_mhashset_find_slot(self, &data);               \
+                                                                               \
+    if (slot == SIZE_MAX) {                                                    \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    if (acc != NULL) {                                                         \
+      *acc = self->data[slot];                                                 \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Erases an element from the hash set, the stored element is freed by
+ * the free function. The slot becomes empty if its group has an empty slot,
+ * otherwise it is marked as deleted so the probes that went past the group
+ * do not stop at it.
+ */
+#define MHASHSET_POP(ID, T)                                                    \
+  merr_t ID##_mhashset_pop(const ID##_mhashset_t self, T data) {               \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      return M_POP_FROM_EMPTY;                                                 \
+    }                                                                          \
+                                                                               \
+    size_t slot = ID##_internal_mhashset_find_slot(self, &data);               \
+                                                                               \
+    if (slot == SIZE_MAX) {                                                    \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    if (self->frd != NULL) {                                                   \
+      self->frd(&self->data[slot]);                                            \
+    }                                                                          \
+                                                                               \
+    size_t base = slot - slot % MHASHSET_GROUP_WIDTH;                          \
+    mhashset_group_t ctrl = MHASHSET_GROUP_LOAD(&self->ctrl[base]);            \
+                                                                               \
+    if (MHASHSET_GROUP_MATCH_EMPTY(ctrl) != 0) {                               \
+      self->ctrl[slot] = MHASHSET_CTRL_EMPTY;                                  \
+      ++(self->growth_left);                                                   \
+    } else {                                                                   \
+      self->ctrl[slot] = MHASHSET_CTRL_DELETED;                                \
+    }                                                                          \
+                                                                               \
+    --(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Traverses the hash set and do action(basically it is used for
+ * printing the set) on all the elements, in the order of the slots (which is
+ * not the order of the insertions).
+ */
+#define MHASHSET_TRAVERSE(ID, T)                                               \
+  ACTION_FUNC(ID, T)                                                           \
+                                                                               \
+  merr_t ID##_mhashset_traverse(const ID##_mhashset_ptr_t *const self,         \
+                                ID##_action_func action) {                     \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      printf("[ ]\n");                                                         \
+    } else {                                                                   \
+      printf("[");                                                             \
+                                                                               \
+      for (size_t iter = 0; iter < self->capacity; ++iter) {                   \
+        if (self->ctrl[iter] < MHASHSET_CTRL_EMPTY) {                          \
+          action(&self->data[iter]);                                           \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      printf(" ]");                                                            \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Adds the all API for the `mhashset_t` structure. You will not be
+ * always need to use all the API, in this case you must be sure that you call
+ * `MHASHSET` for definition of the hash set, any other macro definitions are
+ * to bring new functionalities. The code length may be reduced a lot if you do
+ * not call `MHASHSET_ALL`, the code duplicated when calling `MHASHSET_ALL` for
+ * different ids or different types. The ID protocol is used when different
+ * files want to have the same two typed structures in order to avoid name
+ * collisions.
+ */
+#define MHASHSET_ALL_WITH_ALLOC(ID, T, HASH, EQ, ALLOC)                        \
+  MHASHSET_WITH_ALLOC(ID, T, HASH, EQ, ALLOC)                                  \
+  MHASHSET_EMPTY(ID, T)                                                        \
+  MHASHSET_SIZE(ID, T)                                                         \
+  MHASHSET_RESERVE(ID, T)                                                      \
+  MHASHSET_PUSH(ID, T)                                                         \
+  MHASHSET_PUSH_ALL(ID, T)                                                     \
+  MHASHSET_FIND(ID, T)                                                         \
+  MHASHSET_POP(ID, T)                                                          \
+  MHASHSET_TRAVERSE(ID, T)
+
+/**
+ * @brief Adds the all API for the `mhashset` structure with the standard
+ * library allocator, see `MHASHSET_ALL_WITH_ALLOC`.
+ */
+#define MHASHSET_ALL(ID, T, HASH, EQ) MHASHSET_ALL_WITH_ALLOC(ID, T, HASH, EQ, m_stdlib)
+
+#endif /* MACROS_GENERICS_HASH_SET_UTILS_H_ */
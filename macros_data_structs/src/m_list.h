@@ -36,6 +36,14 @@
  * @param T the type of the data stored inside the structure.
  */
 
+/**
+ * @brief Link of an object stored in an intrusive single linked list, see
+ * `MLIST_INTRUSIVE`. The link is a field of the object.
+ */
+typedef struct mlist_link_s {
+  struct mlist_link_s *next;
+} mlist_link_t;
+
 /**
  * @brief Generates the `mlist_t` structure depending on the name and type.
  * Also generates basic function for creation and freeing memory for the
@@ -43,8 +51,13 @@
  * data memory, if data is not stored as a pointer (T <=> *M), then the free
  * function must be `NULL`. If data represents a structure which contains
  * pointers allocated, then the free function must free those fields.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
  */
-#define MLIST(ID, T)                                                           \
+#define MLIST_WITH_ALLOC(ID, T, ALLOC)                                         \
+  M_ALLOC(ID, mlist, ALLOC)                                                    \
+                                                                               \
   CMP_FUNC(ID, T)                                                              \
   FREE_FUNC(ID, T)                                                             \
                                                                                \
@@ -59,6 +72,8 @@
     ID##_compare_func cmp;                                                     \
     ID##_free_func frd;                                                        \
     size_t size;                                                               \
+    ID##_mlist_node_t slab;                                                    \
+    size_t slab_size;                                                          \
   } ID##_mlist_ptr_t, *ID##_mlist_t;                                           \
                                                                                \
   ID##_mlist_t ID##_mlist(ID##_compare_func cmp, ID##_free_func frd) {         \
@@ -66,7 +81,7 @@
       return NULL;                                                             \
     }                                                                          \
                                                                                \
-    ID##_mlist_t self = malloc(sizeof *self);                                  \
+    ID##_mlist_t self = ID##_internal_mlist_malloc(sizeof *self);              \
                                                                                \
     if (self == NULL) {                                                        \
       return NULL;                                                             \
@@ -77,12 +92,15 @@
                                                                                \
     self->head = self->tail = NULL;                                            \
     self->size = 0;                                                            \
+    self->slab = NULL;                                                         \
+    self->slab_size = 0;                                                       \
                                                                                \
     return self;                                                               \
   }                                                                            \
                                                                                \
   ID##_mlist_node_t ID##_internal_mlist_node(T *const data) {                  \
-    ID##_mlist_node_t self_node = malloc(sizeof *self_node);                   \
+    ID##_mlist_node_t self_node =                                              \
+        ID##_internal_mlist_malloc(sizeof *self_node);                         \
                                                                                \
     if (self_node == NULL) {                                                   \
       return NULL;                                                             \
@@ -94,6 +112,15 @@
     return self_node;                                                          \
   }                                                                            \
                                                                                \
+  void ID##_internal_mlist_node_free(const ID##_mlist_ptr_t *const self,       \
+                                     ID##_mlist_node_t self_node) {            \
+    if ((self->slab == NULL) ||                                                \
+        ((uintptr_t)self_node < (uintptr_t)self->slab) ||                      \
+        ((uintptr_t)self_node >= (uintptr_t)(self->slab + self->slab_size))) { \
+      ID##_internal_mlist_free(self_node);                                     \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
   merr_t ID##_mlist_free(ID##_mlist_t *self) {                                 \
     if ((self != NULL) && (*self != NULL)) {                                   \
       while ((*self)->head != NULL) {                                          \
@@ -104,10 +131,11 @@
           (*self)->frd(&iterator->data);                                       \
         }                                                                      \
                                                                                \
-        free(iterator);                                                        \
+        ID##_internal_mlist_node_free(*self, iterator);                        \
       }                                                                        \
                                                                                \
-      free(*self);                                                             \
+      ID##_internal_mlist_free((*self)->slab);                                 \
+      ID##_internal_mlist_free(*self);                                         \
       *self = NULL;                                                            \
                                                                                \
       return M_OK;                                                             \
@@ -116,6 +144,12 @@
     return M_FREE_NULL;                                                        \
   }
 
+/**
+ * @brief Defines the `mlist` structure with the standard library
+ * allocator, see `MLIST_WITH_ALLOC`.
+ */
+#define MLIST(ID, T) MLIST_WITH_ALLOC(ID, T, m_stdlib)
+
 /**
  * @brief Function to check if a linked list object is empty or not. The
  * function tests if head of list is `NULL` in that case function will return
@@ -572,7 +606,7 @@
       self->frd(&iterator->data);                                              \
     }                                                                          \
                                                                                \
-    free(iterator);                                                            \
+    ID##_internal_mlist_node_free(self, iterator);                             \
                                                                                \
     --(self->size);                                                            \
                                                                                \
@@ -621,7 +655,7 @@
       self->frd(&iterator->data);                                              \
     }                                                                          \
                                                                                \
-    free(iterator);                                                            \
+    ID##_internal_mlist_node_free(self, iterator);                             \
                                                                                \
     --(self->size);                                                            \
                                                                                \
@@ -686,7 +720,7 @@
         self->frd(&iterator->data);                                            \
       }                                                                        \
                                                                                \
-      free(iterator);                                                          \
+      ID##_internal_mlist_node_free(self, iterator);                           \
                                                                                \
       if (prev_iterator == NULL) {                                             \
         iterator = self->head;                                                 \
@@ -807,6 +841,155 @@
     return map_list;                                                           \
   }
 
+/**
+ * @brief Sorts the linked list by relinking its nodes with a bottom-up merge
+ * sort: runs of doubling sizes are merged in place, so no node is allocated
+ * and no data is copied. The sort is stable (on equal data the node that was
+ * first stays first) and takes O(NlogN) time. CMP is the name of the compare
+ * function (or function like macro) of two elements,
+ * `int32_t CMP(const T *const, const T *const)`, it is known at compile time
+ * so it is inlined in the merges (it may differ from the compare function of
+ * the list). `MLIST_ALL` does not define this method, because of CMP.
+ */
+#define MLIST_SORT(ID, T, CMP)                                                 \
+  ID##_mlist_node_t ID##_internal_mlist_sort_cut(ID##_mlist_node_t run,        \
+                                                 size_t run_size) {            \
+    while ((run != NULL) && (run_size > 1)) {                                  \
+      run = run->next;                                                         \
+      --run_size;                                                              \
+    }                                                                          \
+                                                                               \
+    if (run == NULL) {                                                         \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    ID##_mlist_node_t rest = run->next;                                        \
+    run->next = NULL;                                                          \
+                                                                               \
+    return rest;                                                               \
+  }                                                                            \
+                                                                               \
+  ID##_mlist_node_t *ID##_internal_mlist_sort_merge(                           \
+      ID##_mlist_node_t left, ID##_mlist_node_t right,                         \
+      ID##_mlist_node_t *link) {                                               \
+    while ((left != NULL) && (right != NULL)) {                                \
+      if (CMP(&right->data, &left->data) < 0) {                                \
+        *link = right;                                                         \
+        right = right->next;                                                   \
+      } else {                                                                 \
+        *link = left;                                                          \
+        left = left->next;                                                     \
+      }                                                                        \
+                                                                               \
+      link = &(*link)->next;                                                   \
+    }                                                                          \
+                                                                               \
+    *link = (left != NULL) ? left : right;                                     \
+                                                                               \
+    while (*link != NULL) {                                                    \
+      link = &(*link)->next;                                                   \
+    }                                                                          \
+                                                                               \
+    return link;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mlist_sort(const ID##_mlist_t self) {                            \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    for (size_t run_size = 1; run_size < self->size; run_size <<= 1) {         \
+      ID##_mlist_node_t rest = self->head;                                     \
+      ID##_mlist_node_t *link = &self->head;                                   \
+                                                                               \
+      while (rest != NULL) {                                                   \
+        ID##_mlist_node_t left = rest;                                         \
+        ID##_mlist_node_t right = ID##_internal_mlist_sort_cut(left, run_size);\
+                                                                               \
+        rest = ID##_internal_mlist_sort_cut(right, run_size);                  \
+        link = ID##_internal_mlist_sort_merge(left, right, link);              \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    self->tail = self->head;                                                   \
+                                                                               \
+    while ((self->tail != NULL) && (self->tail->next != NULL)) {               \
+      self->tail = self->tail->next;                                           \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Creates a linked list from an array of `number_of_elem` elements (in
+ * the same order). All the nodes are allocated in one block and linked in a
+ * single pass instead of one allocation per element. The block is freed with
+ * the list, so its nodes are not freed one by one when they are removed.
+ */
+#define MLIST_FROM_ARRAY(ID, T)                                                \
+  ID##_mlist_t ID##_mlist_from_array(ID##_compare_func cmp,                    \
+                                     ID##_free_func frd, const T *const arr,   \
+                                     size_t number_of_elem) {                  \
+    if ((arr == NULL) && (number_of_elem != 0)) {                              \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    ID##_mlist_t self = ID##_mlist(cmp, frd);                                  \
+                                                                               \
+    if ((self == NULL) || (number_of_elem == 0)) {                             \
+      return self;                                                             \
+    }                                                                          \
+                                                                               \
+    if (number_of_elem > SIZE_MAX / sizeof(ID##_mlist_node_ptr_t)) {           \
+      ID##_internal_mlist_free(self);                                          \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->slab = ID##_internal_mlist_malloc(number_of_elem *                   \
+                                            sizeof(ID##_mlist_node_ptr_t));    \
+                                                                               \
+    if (self->slab == NULL) {                                                  \
+      ID##_internal_mlist_free(self);                                          \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->slab_size = number_of_elem;                                          \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      self->slab[iter].data = arr[iter];                                       \
+      self->slab[iter].next = &self->slab[iter + 1];                           \
+    }                                                                          \
+                                                                               \
+    self->slab[number_of_elem - 1].next = NULL;                                \
+                                                                               \
+    self->head = &self->slab[0];                                               \
+    self->tail = &self->slab[number_of_elem - 1];                              \
+    self->size = number_of_elem;                                               \
+                                                                               \
+    return self;                                                               \
+  }
+
+/**
+ * @brief Copies the elements of the linked list, in order, into an array. At
+ * most `number_of_elem` elements are copied.
+ */
+#define MLIST_TO_ARRAY(ID, T)                                                  \
+  merr_t ID##_mlist_to_array(const ID##_mlist_ptr_t *const self, T *const arr, \
+                             size_t number_of_elem) {                          \
+    if ((self == NULL) || ((arr == NULL) && (number_of_elem != 0))) {          \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t iter = 0;                                                           \
+                                                                               \
+    for (ID##_mlist_node_t node = self->head;                                  \
+         (node != NULL) && (iter < number_of_elem); node = node->next) {       \
+      arr[iter++] = node->data;                                                \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 /**
  * @brief Adds the all API for the `mlist_t` structure (linked list). You will
  * not be always need to use all the API, in this case you must be sure that you
@@ -818,8 +1001,8 @@
  * when different files want to have the same two typed structures in order to
  * avoid name collisions.
  */
-#define MLIST_ALL(ID, T)                                                       \
-  MLIST(ID, T)                                                                 \
+#define MLIST_ALL_WITH_ALLOC(ID, T, ALLOC)                                     \
+  MLIST_WITH_ALLOC(ID, T, ALLOC)                                               \
   MLIST_EMPTY(ID, T)                                                           \
   MLIST_SIZE(ID, T)                                                            \
   MLIST_HEAD(ID, T)                                                            \
@@ -840,6 +1023,216 @@
   MLIST_ERASE(ID, T)                                                           \
   MLIST_FILTER(ID, T)                                                          \
   MLIST_TRAVERSE(ID, T)                                                        \
+  MLIST_FROM_ARRAY(ID, T)                                                      \
+  MLIST_TO_ARRAY(ID, T)                                                        \
   MLIST_MAP(ID, T, ID, T)
 
+/**
+ * @brief Adds the all API for the `mlist` structure with the standard
+ * library allocator, see `MLIST_ALL_WITH_ALLOC`.
+ */
+#define MLIST_ALL(ID, T) MLIST_ALL_WITH_ALLOC(ID, T, m_stdlib)
+
+/**
+ * @brief Generates an intrusive single linked list (`milist_t`) of `T` objects
+ * linked through their `LINK` field of type `mlist_link_t`. The list never
+ * allocates and never copies the objects, it only chains the links which are
+ * owned by the caller, so an object can be in as many lists as it has links.
+ * The `milist_ptr_t` head is owned by the caller as well and must be set with
+ * `milist_init` before use. An object must not be freed or pushed again while
+ * it is linked.
+ */
+#define MLIST_INTRUSIVE(ID, T, LINK)                                           \
+  ACTION_FUNC(ID, T)                                                           \
+                                                                               \
+  typedef struct ID##_milist_s {                                               \
+    mlist_link_t *head;                                                        \
+    mlist_link_t *tail;                                                        \
+    size_t size;                                                               \
+  } ID##_milist_ptr_t, *ID##_milist_t;                                         \
+                                                                               \
+  T *ID##_internal_milist_entry(mlist_link_t *const link) {                    \
+    if (link == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return (T *)((char *)link - offsetof(T, LINK));                            \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_milist_init(ID##_milist_t const self) {                          \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    self->head = self->tail = NULL;                                            \
+    self->size = 0;                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  mbool_t ID##_milist_empty(const ID##_milist_ptr_t *const self) {             \
+    if ((self == NULL) || (self->head == NULL)) {                              \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }                                                                            \
+                                                                               \
+  size_t ID##_milist_size(const ID##_milist_ptr_t *const self) {               \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->size;                                                         \
+  }                                                                            \
+                                                                               \
+  T *ID##_milist_head(const ID##_milist_ptr_t *const self) {                   \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_milist_entry(self->head);                             \
+  }                                                                            \
+                                                                               \
+  T *ID##_milist_tail(const ID##_milist_ptr_t *const self) {                   \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_milist_entry(self->tail);                             \
+  }                                                                            \
+                                                                               \
+  T *ID##_milist_next(T *const obj) {                                          \
+    if (obj == NULL) {                                                         \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_milist_entry(obj->LINK.next);                         \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_milist_push(ID##_milist_t const self, T *const obj) {            \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    obj->LINK.next = NULL;                                                     \
+                                                                               \
+    if (self->tail == NULL) {                                                  \
+      self->head = &obj->LINK;                                                 \
+    } else {                                                                   \
+      self->tail->next = &obj->LINK;                                           \
+    }                                                                          \
+                                                                               \
+    self->tail = &obj->LINK;                                                   \
+    ++(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_milist_push_front(ID##_milist_t const self, T *const obj) {      \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    obj->LINK.next = self->head;                                               \
+    self->head = &obj->LINK;                                                   \
+                                                                               \
+    if (self->tail == NULL) {                                                  \
+      self->tail = &obj->LINK;                                                 \
+    }                                                                          \
+                                                                               \
+    ++(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  T *ID##_milist_pop(ID##_milist_t const self) {                               \
+    if ((self == NULL) || (self->head == NULL)) {                              \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    mlist_link_t *link = self->head;                                           \
+                                                                               \
+    self->head = link->next;                                                   \
+                                                                               \
+    if (self->head == NULL) {                                                  \
+      self->tail = NULL;                                                       \
+    }                                                                          \
+                                                                               \
+    link->next = NULL;                                                         \
+    --(self->size);                                                            \
+                                                                               \
+    return ID##_internal_milist_entry(link);                                   \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_milist_remove(ID##_milist_t const self, T *const obj) {          \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    mlist_link_t *prev = NULL;                                                 \
+    mlist_link_t *iterator = self->head;                                       \
+                                                                               \
+    while ((iterator != NULL) && (iterator != &obj->LINK)) {                   \
+      prev = iterator;                                                         \
+      iterator = iterator->next;                                               \
+    }                                                                          \
+                                                                               \
+    if (iterator == NULL) {                                                    \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    if (prev == NULL) {                                                        \
+      self->head = iterator->next;                                             \
+    } else {                                                                   \
+      prev->next = iterator->next;                                             \
+    }                                                                          \
+                                                                               \
+    if (self->tail == iterator) {                                              \
+      self->tail = prev;                                                       \
+    }                                                                          \
+                                                                               \
+    iterator->next = NULL;                                                     \
+    --(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_milist_clear(ID##_milist_t const self) {                         \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    self->head = self->tail = NULL;                                            \
+    self->size = 0;                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_milist_traverse(const ID##_milist_ptr_t *const self,             \
+                              ID##_action_func action) {                       \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->head == NULL) {                                                  \
+      printf("[ ]\n");                                                         \
+    } else {                                                                   \
+      printf("[");                                                             \
+                                                                               \
+      for (mlist_link_t *iterator = self->head; iterator != NULL;              \
+           iterator = iterator->next) {                                        \
+        action(ID##_internal_milist_entry(iterator));                          \
+      }                                                                        \
+                                                                               \
+      printf(" ]");                                                            \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 #endif /* MACROS_GENERIC_LIST_UTILS_H_ */
@@ -37,6 +37,11 @@
  */
 
 #define MPQUEUE_DEFAULT_CAPACITY 10
+
+/**
+ * @brief Growth ratio of the node array of a new priority queue, it can be
+ * changed for every priority queue with `mpqueue_set_realloc_ratio`.
+ */
 #define MPQUEUE_DEFAULT_REALLOC_RATIO 2
 
 #define MPQUEUE_INTERNAL_LT_IDX(idx) (2 * (idx) + 1)
@@ -55,8 +60,18 @@
  * data(priority) is not stored as a pointer (T <=> *M), then the free function
  * must be `NULL`. If data represents a structure which contains pointers
  * allocated, then the free function must free those fields.
+ *
+ * The nodes ({priority, data} pairs) are stored inline in one array, which is
+ * the heap, so sifting a node moves it inside the array and no node is
+ * allocated by itself. The array grows by the realloc ratio of the object when
+ * it is full.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
  */
-#define MPQUEUE(ID, K, V)                                                      \
+#define MPQUEUE_WITH_ALLOC(ID, K, V, ALLOC)                                    \
+  M_ALLOC(ID, mpqueue, ALLOC)                                                  \
+                                                                               \
   CMP_FUNC(ID##K, K)                                                           \
   FREE_FUNC(ID##K, K)                                                          \
                                                                                \
@@ -69,13 +84,14 @@
   } ID##_mpqueue_node_ptr_t, *ID##_mpqueue_node_t;                             \
                                                                                \
   typedef struct ID##_mpqueue_s {                                              \
-    ID##_mpqueue_node_t *nodes;                                                \
+    ID##_mpqueue_node_ptr_t *nodes;                                            \
     ID##K##_compare_func cmp_prio;                                             \
     ID##K##_free_func frd_prio;                                                \
     ID##V##_compare_func cmp_data;                                             \
     ID##V##_free_func frd_data;                                                \
     size_t capacity;                                                           \
     size_t size;                                                               \
+    size_t realloc_ratio;                                                      \
   } ID##_mpqueue_ptr_t, *ID##_mpqueue_t;                                       \
                                                                                \
   ID##_mpqueue_t ID##_mpqueue(                                                 \
@@ -90,16 +106,17 @@
       init_capacity = MPQUEUE_DEFAULT_CAPACITY;                                \
     }                                                                          \
                                                                                \
-    ID##_mpqueue_t self = malloc(sizeof *self);                                \
+    ID##_mpqueue_t self = ID##_internal_mpqueue_malloc(sizeof *self);          \
                                                                                \
     if (self == NULL) {                                                        \
       return NULL;                                                             \
     }                                                                          \
                                                                                \
-    self->nodes = malloc(sizeof *self->nodes * init_capacity);                 \
+    self->nodes =                                                              \
+        ID##_internal_mpqueue_malloc(sizeof *self->nodes * init_capacity);     \
                                                                                \
     if (self->nodes == NULL) {                                                 \
-      free(self);                                                              \
+      ID##_internal_mpqueue_free(self);                                        \
       return NULL;                                                             \
     }                                                                          \
                                                                                \
@@ -110,56 +127,28 @@
                                                                                \
     self->capacity = init_capacity;                                            \
     self->size = 0;                                                            \
-                                                                               \
-    for (size_t iter = 0; iter < init_capacity; ++iter) {                      \
-      self->nodes[iter] = NULL;                                                \
-    }                                                                          \
+    self->realloc_ratio = MPQUEUE_DEFAULT_REALLOC_RATIO;                       \
                                                                                \
     return self;                                                               \
   }                                                                            \
                                                                                \
-  ID##_mpqueue_node_t ID##_internal_mpqueue_node(const K *const prio,          \
-                                                 const V *const data) {        \
-    ID##_mpqueue_node_t self_node = malloc(sizeof *self_node);                 \
-                                                                               \
-    if (self_node == NULL) {                                                   \
-      return NULL;                                                             \
-    }                                                                          \
-    memset(&self_node->prio, 0, sizeof self_node->prio);                       \
-    memset(&self_node->data, 0, sizeof self_node->data);                       \
-                                                                               \
-    if (prio != NULL) {                                                        \
-      self_node->prio = *prio;                                                 \
-    }                                                                          \
-                                                                               \
-    if (data != NULL) {                                                        \
-      self_node->data = *data;                                                 \
-    }                                                                          \
-                                                                               \
-    return self_node;                                                          \
-  }                                                                            \
-                                                                               \
   merr_t ID##_mpqueue_free(ID##_mpqueue_t *self) {                             \
     if ((self != NULL) && (*self != NULL)) {                                   \
       if ((*self)->nodes != NULL) {                                            \
-        for (size_t iter = 0; iter < (*self)->capacity; ++iter) {              \
-          if ((*self)->nodes[iter] != NULL) {                                  \
-            if ((*self)->frd_prio != NULL) {                                   \
-              (*self)->frd_prio(&(*self)->nodes[iter]->prio);                  \
-            }                                                                  \
-                                                                               \
-            if ((*self)->frd_data != NULL) {                                   \
-              (*self)->frd_data(&(*self)->nodes[iter]->data);                  \
-            }                                                                  \
+        for (size_t iter = 0; iter < (*self)->size; ++iter) {                  \
+          if ((*self)->frd_prio != NULL) {                                     \
+            (*self)->frd_prio(&(*self)->nodes[iter].prio);                     \
+          }                                                                    \
                                                                                \
-            free((*self)->nodes[iter]);                                        \
+          if ((*self)->frd_data != NULL) {                                     \
+            (*self)->frd_data(&(*self)->nodes[iter].data);                     \
           }                                                                    \
         }                                                                      \
                                                                                \
-        free((*self)->nodes);                                                  \
+        ID##_internal_mpqueue_free((*self)->nodes);                            \
       }                                                                        \
                                                                                \
-      free(*self);                                                             \
+      ID##_internal_mpqueue_free(*self);                                       \
       *self = NULL;                                                            \
                                                                                \
       return M_OK;                                                             \
@@ -170,46 +159,91 @@
                                                                                \
   void ID##_internal_mpqueue_sift_up(const ID##_mpqueue_ptr_t *const self,     \
                                      size_t idx) {                             \
+    ID##_mpqueue_node_ptr_t node = self->nodes[idx];                           \
+                                                                               \
     while ((idx > 0) &&                                                        \
-           (self->cmp_prio(                                                    \
-                &self->nodes[idx]->prio,                                       \
-                &self->nodes[MPQUEUE_INTERNAL_PR_IDX(idx)]->prio) >= 1)) {     \
-      ID##_mpqueue_node_t temp = self->nodes[idx];                             \
+           (self->cmp_prio(&node.prio,                                         \
+                           &self->nodes[MPQUEUE_INTERNAL_PR_IDX(idx)].prio) >= \
+            1)) {                                                              \
       self->nodes[idx] = self->nodes[MPQUEUE_INTERNAL_PR_IDX(idx)];            \
-      self->nodes[MPQUEUE_INTERNAL_PR_IDX(idx)] = temp;                        \
                                                                                \
       idx = MPQUEUE_INTERNAL_PR_IDX(idx);                                      \
     }                                                                          \
+                                                                               \
+    self->nodes[idx] = node;                                                   \
   }                                                                            \
                                                                                \
   void ID##_internal_mpqueue_sift_down(const ID##_mpqueue_ptr_t *const self,   \
                                        size_t idx) {                           \
-    size_t swap_idx = idx;                                                     \
+    ID##_mpqueue_node_ptr_t node = self->nodes[idx];                           \
                                                                                \
-    size_t check_idx = MPQUEUE_INTERNAL_LT_IDX(idx);                           \
+    for (;;) {                                                                 \
+      size_t swap_idx = MPQUEUE_INTERNAL_LT_IDX(idx);                          \
                                                                                \
-    if ((check_idx < self->size) &&                                            \
-        (self->cmp_prio(&self->nodes[check_idx]->prio,                         \
-                        &self->nodes[swap_idx]->prio) >= 1)) {                 \
-      swap_idx = check_idx;                                                    \
+      if (swap_idx >= self->size) {                                            \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      size_t check_idx = MPQUEUE_INTERNAL_RT_IDX(idx);                         \
+                                                                               \
+      if ((check_idx < self->size) &&                                          \
+          (self->cmp_prio(&self->nodes[check_idx].prio,                        \
+                          &self->nodes[swap_idx].prio) >= 1)) {                \
+        swap_idx = check_idx;                                                  \
+      }                                                                        \
+                                                                               \
+      if (self->cmp_prio(&self->nodes[swap_idx].prio, &node.prio) < 1) {       \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      self->nodes[idx] = self->nodes[swap_idx];                                \
+      idx = swap_idx;                                                          \
     }                                                                          \
                                                                                \
-    check_idx = MPQUEUE_INTERNAL_RT_IDX(idx);                                  \
-    if ((check_idx < self->size) &&                                            \
-        (self->cmp_prio(&self->nodes[check_idx]->prio,                         \
-                        &self->nodes[swap_idx]->prio) >= 1)) {                 \
-      swap_idx = check_idx;                                                    \
+    self->nodes[idx] = node;                                                   \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mpqueue_grow(const ID##_mpqueue_t self,                 \
+                                    size_t capacity) {                         \
+    if (capacity <= self->capacity) {                                          \
+      return M_OK;                                                             \
     }                                                                          \
                                                                                \
-    if (idx != swap_idx) {                                                     \
-      ID##_mpqueue_node_t temp = self->nodes[idx];                             \
-      self->nodes[idx] = self->nodes[swap_idx];                                \
-      self->nodes[swap_idx] = temp;                                            \
+    size_t new_capacity = self->capacity;                                      \
                                                                                \
-      ID##_internal_mpqueue_sift_down(self, swap_idx);                         \
+    while (new_capacity < capacity) {                                          \
+      if (new_capacity > SIZE_MAX / self->realloc_ratio) {                     \
+        new_capacity = capacity;                                               \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      new_capacity *= self->realloc_ratio;                                     \
     }                                                                          \
+                                                                               \
+    if (new_capacity > SIZE_MAX / sizeof *(self->nodes)) {                     \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    ID##_mpqueue_node_ptr_t *try_real =                                        \
+        ID##_internal_mpqueue_realloc(self->nodes,                             \
+                                      sizeof *(self->nodes) * new_capacity);   \
+                                                                               \
+    if (try_real == NULL) {                                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->nodes = try_real;                                                    \
+    self->capacity = new_capacity;                                             \
+                                                                               \
+    return M_OK;                                                               \
   }
 
+/**
+ * @brief Defines the `mpqueue` structure with the standard library
+ * allocator, see `MPQUEUE_WITH_ALLOC`.
+ */
+#define MPQUEUE(ID, K, V) MPQUEUE_WITH_ALLOC(ID, K, V, m_stdlib)
+
 /**
  * @brief Creates a priority queue based on heapify method which runs in O(n)
  * time complexity. If a big chunck if data is known is recommended to use this
@@ -231,22 +265,18 @@
     }                                                                          \
                                                                                \
     for (size_t iter = 0; iter < heap_size; ++iter) {                          \
-      ID##_mpqueue_node_t self_node = NULL;                                    \
+      self_empty->nodes[iter].prio = prios[iter];                              \
                                                                                \
       if (data != NULL) {                                                      \
-        self_node = ID##_internal_mpqueue_node(prios + iter, data + iter);     \
+        self_empty->nodes[iter].data = data[iter];                             \
       } else {                                                                 \
-        self_node = ID##_internal_mpqueue_node(prios + iter, NULL);            \
+        memset(&self_empty->nodes[iter].data, 0,                               \
+               sizeof self_empty->nodes[iter].data);                           \
       }                                                                        \
-                                                                               \
-      if (self_node == NULL) {                                                 \
-        return M_MALLOC_FAILED;                                                \
-      }                                                                        \
-                                                                               \
-      self_empty->nodes[iter] = self_node;                                     \
-      ++(self_empty->size);                                                    \
     }                                                                          \
                                                                                \
+    self_empty->size = heap_size;                                              \
+                                                                               \
     for (int64_t iter = (int64_t)(self_empty->size / 2 - 1); iter >= 0;        \
          --iter) {                                                             \
       ID##_internal_mpqueue_sift_down(self_empty, (size_t)iter);               \
@@ -272,13 +302,61 @@
  */
 #define MPQUEUE_SIZE(ID, K, V)                                                 \
   size_t ID##_mpqueue_size(const ID##_mpqueue_ptr_t *const self) {             \
-    if ((self == NULL) || (self->nodes)) {                                     \
+    if ((self == NULL) || (self->nodes == NULL)) {                             \
       return SIZE_MAX;                                                         \
     }                                                                          \
                                                                                \
     return self->size;                                                         \
   }
 
+/**
+ * @brief Preallocates the node array for at least `capacity` nodes
+ * (`mpqueue_reserve`) and sets the ratio by which the array grows when it is
+ * full (`mpqueue_set_realloc_ratio`), the ratio must be at least 2.
+ */
+#define MPQUEUE_CAPACITY(ID, K, V)                                             \
+  merr_t ID##_mpqueue_reserve(ID##_mpqueue_t const self, size_t capacity) {    \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (capacity <= self->capacity) {                                          \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    if (capacity > SIZE_MAX / sizeof *(self->nodes)) {                         \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    ID##_mpqueue_node_ptr_t *try_real =                                        \
+        ID##_internal_mpqueue_realloc(self->nodes,                             \
+                                      sizeof *(self->nodes) * capacity);       \
+                                                                               \
+    if (try_real == NULL) {                                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->nodes = try_real;                                                    \
+    self->capacity = capacity;                                                 \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mpqueue_set_realloc_ratio(ID##_mpqueue_t const self,             \
+                                        size_t realloc_ratio) {                \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (realloc_ratio < 2) {                                                   \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    self->realloc_ratio = realloc_ratio;                                       \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 /**
  * @brief Changes the priority of a node, should be called after you find the
  * index with `find_pri_idx` method. Sifts Up or Down the node regarding to its
@@ -295,18 +373,18 @@
       return M_IDX_OVERFLOW;                                                   \
     }                                                                          \
                                                                                \
-    if (self->cmp_prio(&self->nodes[idx]->prio, &prio) >= 1) {                 \
+    if (self->cmp_prio(&self->nodes[idx].prio, &prio) >= 1) {                  \
       if (self->frd_prio != NULL) {                                            \
-        self->frd_prio(&self->nodes[idx]->prio);                               \
+        self->frd_prio(&self->nodes[idx].prio);                                \
       }                                                                        \
-      self->nodes[idx]->prio = prio;                                           \
+      self->nodes[idx].prio = prio;                                            \
                                                                                \
       ID##_internal_mpqueue_sift_down(self, idx);                              \
-    } else if (self->cmp_prio(&self->nodes[idx]->prio, &prio) <= -1) {         \
+    } else if (self->cmp_prio(&self->nodes[idx].prio, &prio) <= -1) {          \
       if (self->frd_prio != NULL) {                                            \
-        self->frd_prio(&self->nodes[idx]->prio);                               \
+        self->frd_prio(&self->nodes[idx].prio);                                \
       }                                                                        \
-      self->nodes[idx]->prio = prio;                                           \
+      self->nodes[idx].prio = prio;                                            \
                                                                                \
       ID##_internal_mpqueue_sift_up(self, idx);                                \
     }                                                                          \
@@ -330,9 +408,9 @@
     }                                                                          \
                                                                                \
     if (self->frd_data != NULL) {                                              \
-      self->frd_data(&self->nodes[idx]->data);                                 \
+      self->frd_data(&self->nodes[idx].data);                                  \
     }                                                                          \
-    self->nodes[idx]->data = data;                                             \
+    self->nodes[idx].data = data;                                              \
                                                                                \
     return M_OK;                                                               \
   }
@@ -350,14 +428,12 @@
     }                                                                          \
                                                                                \
     for (size_t iter = 0; iter < self->size; ++iter) {                         \
-      if (self->nodes[iter] != NULL) {                                         \
-        if (self->cmp_data(&self->nodes[iter]->data, &data) == 0) {            \
-          if (acc != NULL) {                                                   \
-            *acc = iter;                                                       \
-          }                                                                    \
-                                                                               \
-          return M_OK;                                                         \
+      if (self->cmp_data(&self->nodes[iter].data, &data) == 0) {               \
+        if (acc != NULL) {                                                     \
+          *acc = iter;                                                         \
         }                                                                      \
+                                                                               \
+        return M_OK;                                                           \
       }                                                                        \
     }                                                                          \
                                                                                \
@@ -377,14 +453,12 @@
     }                                                                          \
                                                                                \
     for (size_t iter = 0; iter < self->size; ++iter) {                         \
-      if (self->nodes[iter] != NULL) {                                         \
-        if (self->cmp_prio(&self->nodes[iter]->prio, &prio) == 0) {            \
-          if (acc != NULL) {                                                   \
-            *acc = iter;                                                       \
-          }                                                                    \
-                                                                               \
-          return M_OK;                                                         \
+      if (self->cmp_prio(&self->nodes[iter].prio, &prio) == 0) {               \
+        if (acc != NULL) {                                                     \
+          *acc = iter;                                                         \
         }                                                                      \
+                                                                               \
+        return M_OK;                                                           \
       }                                                                        \
     }                                                                          \
                                                                                \
@@ -401,11 +475,11 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    if ((self->nodes == NULL) || (self->nodes[0] == NULL)) {                   \
+    if ((self->nodes == NULL) || (self->size == 0)) {                          \
       return M_EMPTY_STRUCTURE;                                                \
     }                                                                          \
                                                                                \
-    *acc = self->nodes[0]->prio;                                               \
+    *acc = self->nodes[0].prio;                                                \
                                                                                \
     return M_OK;                                                               \
   }
@@ -420,11 +494,11 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    if ((self->nodes == NULL) || (self->nodes[0] == NULL)) {                   \
+    if ((self->nodes == NULL) || (self->size == 0)) {                          \
       return M_EMPTY_STRUCTURE;                                                \
     }                                                                          \
                                                                                \
-    *acc = self->nodes[0]->data;                                               \
+    *acc = self->nodes[0].data;                                                \
                                                                                \
     return M_OK;                                                               \
   }
@@ -439,28 +513,14 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    if (self->size >= self->capacity) {                                        \
-      self->capacity *= MPQUEUE_DEFAULT_REALLOC_RATIO;                         \
-                                                                               \
-      ID##_mpqueue_node_t *try_real =                                          \
-          realloc(self->nodes, sizeof *(self->nodes) * self->capacity);        \
-                                                                               \
-      if (try_real == NULL) {                                                  \
-        self->capacity /= MPQUEUE_DEFAULT_REALLOC_RATIO;                       \
-                                                                               \
-        return M_REALLOC_FAILED;                                               \
-      }                                                                        \
-                                                                               \
-      self->nodes = try_real;                                                  \
-    }                                                                          \
-                                                                               \
-    ID##_mpqueue_node_t self_node = ID##_internal_mpqueue_node(&prio, &data);  \
+    merr_t err = ID##_internal_mpqueue_grow(self, self->size + 1);             \
                                                                                \
-    if (self_node == NULL) {                                                   \
-      return M_MALLOC_FAILED;                                                  \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
     }                                                                          \
                                                                                \
-    self->nodes[self->size] = self_node;                                       \
+    self->nodes[self->size].prio = prio;                                       \
+    self->nodes[self->size].data = data;                                       \
                                                                                \
     ID##_internal_mpqueue_sift_up(self, self->size);                           \
                                                                                \
@@ -482,28 +542,78 @@
       return M_POP_FROM_EMPTY;                                                 \
     }                                                                          \
                                                                                \
-    ID##_mpqueue_node_t temp = self->nodes[0];                                 \
-    self->nodes[0] = self->nodes[self->size - 1];                              \
-    self->nodes[self->size - 1] = temp;                                        \
-                                                                               \
     if (self->frd_prio != NULL) {                                              \
-      self->frd_prio(&self->nodes[self->size - 1]->prio);                      \
+      self->frd_prio(&self->nodes[0].prio);                                    \
     }                                                                          \
                                                                                \
     if (self->frd_data != NULL) {                                              \
-      self->frd_data(&self->nodes[self->size - 1]->data);                      \
+      self->frd_data(&self->nodes[0].data);                                    \
     }                                                                          \
                                                                                \
-    free(self->nodes[self->size - 1]);                                         \
-    self->nodes[self->size - 1] = NULL;                                        \
-                                                                               \
     --(self->size);                                                            \
                                                                                \
+    if (self->size > 0) {                                                      \
+      self->nodes[0] = self->nodes[self->size];                                \
+                                                                               \
+      ID##_internal_mpqueue_sift_down(self, 0);                                \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Replaces the min or max element of the priority queue with a new
+ * priority and data. The old content of the root is freed and the root node is
+ * overwritten in place and sifted down once, so it costs half of a pop followed
+ * by a push.
+ */
+#define MPQUEUE_REPLACE_TOP(ID, K, V)                                          \
+  merr_t ID##_mpqueue_replace_top(ID##_mpqueue_t const self, K prio, V data) { \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if ((self->nodes == NULL) || (self->size == 0)) {                          \
+      return M_EMPTY_STRUCTURE;                                                \
+    }                                                                          \
+                                                                               \
+    if (self->frd_prio != NULL) {                                              \
+      self->frd_prio(&self->nodes[0].prio);                                    \
+    }                                                                          \
+                                                                               \
+    if (self->frd_data != NULL) {                                              \
+      self->frd_data(&self->nodes[0].data);                                    \
+    }                                                                          \
+                                                                               \
+    self->nodes[0].prio = prio;                                                \
+    self->nodes[0].data = data;                                                \
+                                                                               \
     ID##_internal_mpqueue_sift_down(self, 0);                                  \
                                                                                \
     return M_OK;                                                               \
   }
 
+/**
+ * @brief Pushes a new element and pops the min or max element right after, in
+ * a single sift-down. If the new element ranks at least as high as the root (or
+ * the priority queue is empty) it is not inserted at all and the object is not
+ * changed (its content still belongs to the caller), otherwise the root is
+ * replaced as in `replace_top`. Depends on `MPQUEUE_REPLACE_TOP`.
+ */
+#define MPQUEUE_PUSHPOP(ID, K, V)                                              \
+  merr_t ID##_mpqueue_pushpop(ID##_mpqueue_t const self, K prio, V data) {     \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if ((self->nodes == NULL) || (self->size == 0) ||                          \
+        (self->cmp_prio(&self->nodes[0].prio, &prio) < 1)) {                   \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_mpqueue_replace_top(self, prio, data);                         \
+  }
+
 /**
  * @brief Traverses all the nodes of a priority queue and performs an action on
  * it. This function is used mostly for printing or other non-mutable actions.
@@ -527,9 +637,7 @@
       printf("[");                                                             \
                                                                                \
       for (size_t iter = 0; iter < self->size; ++iter) {                       \
-        if (self->nodes[iter] != NULL) {                                       \
-          action(&self->nodes[iter]->data);                                    \
-        }                                                                      \
+        action(&self->nodes[iter].data);                                       \
       }                                                                        \
                                                                                \
       printf(" ]\n");                                                          \
@@ -549,11 +657,12 @@
  * protocol is used when different files want to have the same two typed
  * structures in order to avoid name collisions.
  */
-#define MPQUEUE_ALL(ID, K, V)                                                  \
-  MPQUEUE(ID, K, V)                                                            \
+#define MPQUEUE_ALL_WITH_ALLOC(ID, K, V, ALLOC)                                \
+  MPQUEUE_WITH_ALLOC(ID, K, V, ALLOC)                                          \
   MPQUEUE_HEAPIFY(ID, K, V)                                                    \
   MPQUEUE_EMPTY(ID, K, V)                                                      \
   MPQUEUE_SIZE(ID, K, V)                                                       \
+  MPQUEUE_CAPACITY(ID, K, V)                                                   \
   MPQUEUE_CHANGE_PRI(ID, K, V)                                                 \
   MPQUEUE_CHANGE(ID, K, V)                                                     \
   MPQUEUE_FIND_PRI_IDX(ID, K, V)                                               \
@@ -562,6 +671,14 @@
   MPQUEUE_TOP(ID, K, V)                                                        \
   MPQUEUE_PUSH(ID, K, V)                                                       \
   MPQUEUE_POP(ID, K, V)                                                        \
+  MPQUEUE_REPLACE_TOP(ID, K, V)                                                \
+  MPQUEUE_PUSHPOP(ID, K, V)                                                    \
   MPQUEUE_TRAVERSE(ID, K, V)
 
+/**
+ * @brief Adds the all API for the `mpqueue` structure with the standard
+ * library allocator, see `MPQUEUE_ALL_WITH_ALLOC`.
+ */
+#define MPQUEUE_ALL(ID, K, V) MPQUEUE_ALL_WITH_ALLOC(ID, K, V, m_stdlib)
+
 #endif /* MACROS_GENERICS_PRIORITY_QUEUE_UTILS_H_ */
@@ -42,25 +42,28 @@
  * structure. This structure require a method for freeing data memory, if data
  * is not stored as a pointer (T <=> *M), then the free function must be `NULL`.
  * If data represents a structure which contains pointers allocated, then the
- * free function must free those fields.
+ * free function must free those fields. The elements are stored inline in a
+ * circular buffer whose capacity is a power of two and doubles when it is
+ * full, so push and pop do not call malloc.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
  */
-#define MQUEUE(ID, T)                                                          \
-  FREE_FUNC(ID, T)                                                             \
+#define MQUEUE_WITH_ALLOC(ID, T, ALLOC)                                        \
+  M_ALLOC(ID, mqueue, ALLOC)                                                   \
                                                                                \
-  typedef struct ID##_mqueue_node_s {                                          \
-    T data;                                                                    \
-    struct ID##_mqueue_node_s *next;                                           \
-  } ID##_mqueue_node_ptr_t, *ID##_mqueue_node_t;                               \
+  FREE_FUNC(ID, T)                                                             \
                                                                                \
   typedef struct ID##_mqueue_s {                                               \
-    ID##_mqueue_node_t front;                                                  \
-    ID##_mqueue_node_t back;                                                   \
+    T *data;                                                                   \
     ID##_free_func frd;                                                        \
+    size_t head;                                                               \
     size_t size;                                                               \
+    size_t capacity;                                                           \
   } ID##_mqueue_ptr_t, *ID##_mqueue_t;                                         \
                                                                                \
   ID##_mqueue_t ID##_mqueue(ID##_free_func frd) {                              \
-    ID##_mqueue_t self = malloc(sizeof *self);                                 \
+    ID##_mqueue_t self = ID##_internal_mqueue_malloc(sizeof *self);            \
                                                                                \
     if (self == NULL) {                                                        \
       return NULL;                                                             \
@@ -68,39 +71,51 @@
                                                                                \
     self->frd = frd;                                                           \
                                                                                \
-    self->front = self->back = NULL;                                           \
+    self->data = NULL;                                                         \
+    self->head = 0;                                                            \
     self->size = 0;                                                            \
+    self->capacity = 0;                                                        \
                                                                                \
     return self;                                                               \
   }                                                                            \
                                                                                \
-  ID##_mqueue_node_t ID##_internal_mqueue_node(T *const data) {                \
-    ID##_mqueue_node_t self_node = malloc(sizeof *self_node);                  \
+  merr_t ID##_internal_mqueue_resize(const ID##_mqueue_t self,                 \
+                                     size_t new_capacity) {                    \
+    if (new_capacity > SIZE_MAX / sizeof(T)) {                                 \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
                                                                                \
-    if (self_node == NULL) {                                                   \
-      return NULL;                                                             \
+    T *new_data = ID##_internal_mqueue_malloc(new_capacity * sizeof(T));       \
+                                                                               \
+    if (new_data == NULL) {                                                    \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < self->size; ++iter) {                         \
+      new_data[iter] = self->data[(self->head + iter) & (self->capacity - 1)]; \
     }                                                                          \
                                                                                \
-    self_node->next = NULL;                                                    \
-    self_node->data = *data;                                                   \
+    ID##_internal_mqueue_free(self->data);                                     \
                                                                                \
-    return self_node;                                                          \
+    self->data = new_data;                                                     \
+    self->head = 0;                                                            \
+    self->capacity = new_capacity;                                             \
+                                                                               \
+    return M_OK;                                                               \
   }                                                                            \
                                                                                \
   merr_t ID##_mqueue_free(ID##_mqueue_t *self) {                               \
     if ((self != NULL) && (*self != NULL)) {                                   \
-      while ((*self)->front != NULL) {                                         \
-        ID##_mqueue_node_t iterator = (*self)->front;                          \
-        (*self)->front = (*self)->front->next;                                 \
-                                                                               \
-        if ((*self)->frd != NULL) {                                            \
-          (*self)->frd(&iterator->data);                                       \
+      if ((*self)->frd != NULL) {                                              \
+        for (size_t iter = 0; iter < (*self)->size; ++iter) {                  \
+          (*self)->frd(                                                        \
+              &(*self)->data[((*self)->head + iter) &                          \
+                             ((*self)->capacity - 1)]);                        \
         }                                                                      \
-                                                                               \
-        free(iterator);                                                        \
       }                                                                        \
                                                                                \
-      free(*self);                                                             \
+      ID##_internal_mqueue_free((*self)->data);                                \
+      ID##_internal_mqueue_free(*self);                                        \
       *self = NULL;                                                            \
                                                                                \
       return M_OK;                                                             \
@@ -109,6 +124,12 @@
     return M_FREE_NULL;                                                        \
   }
 
+/**
+ * @brief Defines the `mqueue` structure with the standard library
+ * allocator, see `MQUEUE_WITH_ALLOC`.
+ */
+#define MQUEUE(ID, T) MQUEUE_WITH_ALLOC(ID, T, m_stdlib)
+
 /**
  * @brief Traverses all queue and do action(basically it is used for printing
  * the queue) on all data nodes.
@@ -126,16 +147,15 @@
       return M_NULL_ACTION;                                                    \
     }                                                                          \
                                                                                \
-    if (self->front == NULL) {                                                 \
+    if (self->size == 0) {                                                     \
       printf("[ ]\n");                                                         \
     } else {                                                                   \
       printf("[");                                                             \
-      ID##_mqueue_node_t iterator = self->front;                               \
                                                                                \
-      while (iterator != NULL) {                                               \
-        action(&iterator->data);                                               \
-        iterator = iterator->next;                                             \
+      for (size_t iter = 0; iter < self->size; ++iter) {                       \
+        action(&self->data[(self->head + iter) & (self->capacity - 1)]);       \
       }                                                                        \
+                                                                               \
       printf(" ]");                                                            \
     }                                                                          \
                                                                                \
@@ -144,13 +164,13 @@
 
 /**
  * @brief Function to check if a queue object is empty or not. The
- * function tests if top of list is `NULL` in that case function will return
- * true, otherwise it will return false. A `NULL` queue is also considered as an
- * empty queue.
+ * function tests if the queue has no elements in that case function will
+ * return true, otherwise it will return false. A `NULL` queue is also
+ * considered as an empty queue.
  */
 #define MQUEUE_EMPTY(ID, T)                                                    \
   mbool_t ID##_mqueue_empty(const ID##_mqueue_ptr_t *const self) {             \
-    if ((self == NULL) || (self->front == NULL)) {                             \
+    if ((self == NULL) || (self->size == 0)) {                                 \
       return mtrue;                                                            \
     }                                                                          \
                                                                                \
@@ -181,11 +201,11 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    if (self->front == NULL) {                                                 \
+    if (self->size == 0) {                                                     \
       return M_EMPTY_STRUCTURE;                                                \
     }                                                                          \
                                                                                \
-    *acc = self->front->data;                                                  \
+    *acc = self->data[self->head];                                             \
                                                                                \
     return M_OK;                                                               \
   }
@@ -200,17 +220,18 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    if (self->back == NULL) {                                                  \
+    if (self->size == 0) {                                                     \
       return M_EMPTY_STRUCTURE;                                                \
     }                                                                          \
                                                                                \
-    *acc = self->back->data;                                                   \
+    *acc = self->data[(self->head + self->size - 1) & (self->capacity - 1)];   \
                                                                                \
     return M_OK;                                                               \
   }
 
 /**
- * @brief Inserts an element to the end of the queue.
+ * @brief Inserts an element to the end of the queue, the buffer doubles when
+ * it is full.
  */
 #define MQUEUE_PUSH(ID, T)                                                     \
   merr_t ID##_mqueue_push(const ID##_mqueue_t self, T data) {                  \
@@ -218,20 +239,16 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    ID##_mqueue_node_t self_node = ID##_internal_mqueue_node(&data);           \
+    if (self->size == self->capacity) {                                        \
+      merr_t err = ID##_internal_mqueue_resize(                                \
+          self, (self->capacity == 0) ? 16 : 2 * self->capacity);              \
                                                                                \
-    if (self_node == NULL) {                                                   \
-      return M_MALLOC_FAILED;                                                  \
-    }                                                                          \
-                                                                               \
-    if (self->front == NULL) {                                                 \
-      self->front = self_node;                                                 \
-      self->back = self_node;                                                  \
-    } else {                                                                   \
-      self->back->next = self_node;                                            \
-      self->back = self_node;                                                  \
+      if (err != M_OK) {                                                       \
+        return err;                                                            \
+      }                                                                        \
     }                                                                          \
                                                                                \
+    self->data[(self->head + self->size) & (self->capacity - 1)] = data;       \
     ++(self->size);                                                            \
                                                                                \
     return M_OK;                                                               \
@@ -247,23 +264,47 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    if ((self->front == NULL) || (self->size == 0)) {                          \
+    if (self->size == 0) {                                                     \
       return M_POP_FROM_EMPTY;                                                 \
     }                                                                          \
                                                                                \
-    ID##_mqueue_node_t self_node = self->front;                                \
-    self->front = self->front->next;                                           \
-    --(self->size);                                                            \
-                                                                               \
     if (self->frd != NULL) {                                                   \
-      self->frd(&self_node->data);                                             \
+      self->frd(&self->data[self->head]);                                      \
     }                                                                          \
                                                                                \
-    free(self_node);                                                           \
+    self->head = (self->head + 1) & (self->capacity - 1);                      \
+    --(self->size);                                                            \
                                                                                \
     return M_OK;                                                               \
   }
 
+/**
+ * @brief Preallocates the buffer of the queue for at least `capacity`
+ * elements (rounded up to a power of two).
+ */
+#define MQUEUE_RESERVE(ID, T)                                                  \
+  merr_t ID##_mqueue_reserve(const ID##_mqueue_t self, size_t capacity) {      \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t new_capacity = (self->capacity == 0) ? 16 : self->capacity;         \
+                                                                               \
+    while (new_capacity < capacity) {                                          \
+      if (new_capacity > SIZE_MAX / 2) {                                       \
+        return M_REALLOC_FAILED;                                               \
+      }                                                                        \
+                                                                               \
+      new_capacity *= 2;                                                       \
+    }                                                                          \
+                                                                               \
+    if (new_capacity == self->capacity) {                                      \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mqueue_resize(self, new_capacity);                    \
+  }
+
 /**
  * @brief Adds the all API for the `mqueue_t` structure. You will not be always
  * need to use all the API, in this case you must be sure that you call `MQUEUE`
@@ -275,14 +316,21 @@
  * different files want to have the same two typed structures in order to avoid
  * name collisions.
  */
-#define MQUEUE_ALL(ID, T)                                                      \
-  MQUEUE(ID, T)                                                                \
+#define MQUEUE_ALL_WITH_ALLOC(ID, T, ALLOC)                                    \
+  MQUEUE_WITH_ALLOC(ID, T, ALLOC)                                              \
   MQUEUE_TRAVERSE(ID, T)                                                       \
   MQUEUE_EMPTY(ID, T)                                                          \
   MQUEUE_SIZE(ID, T)                                                           \
   MQUEUE_FRONT(ID, T)                                                          \
   MQUEUE_BACK(ID, T)                                                           \
   MQUEUE_PUSH(ID, T)                                                           \
-  MQUEUE_POP(ID, T)
+  MQUEUE_POP(ID, T)                                                            \
+  MQUEUE_RESERVE(ID, T)
+
+/**
+ * @brief Adds the all API for the `mqueue` structure with the standard
+ * library allocator, see `MQUEUE_ALL_WITH_ALLOC`.
+ */
+#define MQUEUE_ALL(ID, T) MQUEUE_ALL_WITH_ALLOC(ID, T, m_stdlib)
 
 #endif /* MACROS_GENERIC_QUEUE_UTILS_H_ */
@@ -38,6 +38,17 @@
 
 typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
 
+/**
+ * @brief Link of an object stored in an intrusive red-black tree, see
+ * `MRBK_INTRUSIVE`. The link is a field of the object.
+ */
+typedef struct mrbk_link_s {
+  struct mrbk_link_s *parent;
+  struct mrbk_link_s *left;
+  struct mrbk_link_s *right;
+  notype_rbk_color_t color;
+} mrbk_link_t;
+
 /**
  * @brief Generates the `mrbk_t` structure depending on the name and type.
  * Also generates basic function for creation and freeing memory for the
@@ -45,8 +56,13 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
  * data memory, if data is not stored as a pointer (T <=> *M), then the free
  * function must be `NULL`. If data represents a structure which contains
  * pointers allocated, then the free function must free those fields.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
  */
-#define MRBK(ID, T)                                                            \
+#define MRBK_WITH_ALLOC(ID, T, ALLOC)                                          \
+  M_ALLOC(ID, mrbk, ALLOC)                                                     \
+                                                                               \
   CMP_FUNC(ID, T)                                                              \
   FREE_FUNC(ID, T)                                                             \
                                                                                \
@@ -57,6 +73,7 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
     struct ID##_mrbk_node_s *right;                                            \
     uint32_t count;                                                            \
     notype_rbk_color_t color;                                                  \
+    size_t weight;                                                             \
   } ID##_mrbk_node_ptr_t, *ID##_mrbk_node_t;                                   \
                                                                                \
   typedef struct ID##_mrbk_s {                                                 \
@@ -65,6 +82,10 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
     ID##_compare_func cmp;                                                     \
     ID##_free_func frd;                                                        \
     size_t size;                                                               \
+    mbool_t order_stats;                                                       \
+    ID##_mrbk_node_t node_cache;                                               \
+    size_t cached_nodes;                                                       \
+    size_t node_cache_cap;                                                     \
   } ID##_mrbk_ptr_t, *ID##_mrbk_t;                                             \
                                                                                \
   ID##_mrbk_t ID##_mrbk(ID##_compare_func cmp, ID##_free_func frd) {           \
@@ -72,7 +93,7 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
       return NULL;                                                             \
     }                                                                          \
                                                                                \
-    ID##_mrbk_t self = malloc(sizeof *self);                                   \
+    ID##_mrbk_t self = ID##_internal_mrbk_malloc(sizeof *self);                \
                                                                                \
     if (self == NULL) {                                                        \
       return NULL;                                                             \
@@ -81,39 +102,63 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
     self->cmp = cmp;                                                           \
     self->frd = frd;                                                           \
                                                                                \
-    self->nil = malloc(sizeof *self->nil);                                     \
+    self->nil = ID##_internal_mrbk_malloc(sizeof *self->nil);                  \
                                                                                \
     if (self->nil == NULL) {                                                   \
-      free(self);                                                              \
+      ID##_internal_mrbk_free(self);                                           \
       return NULL;                                                             \
     }                                                                          \
                                                                                \
     self->nil->color = BLACK;                                                  \
     self->nil->count = 1;                                                      \
+    self->nil->weight = 0;                                                     \
     self->nil->left = self->nil->right = self->nil->parent = self->nil;        \
                                                                                \
     self->root = self->nil;                                                    \
     self->size = 0;                                                            \
+    self->order_stats = mfalse;                                                \
+    self->node_cache = NULL;                                                   \
+    self->cached_nodes = 0;                                                    \
+    self->node_cache_cap = 0;                                                  \
                                                                                \
     return self;                                                               \
   }                                                                            \
                                                                                \
-  ID##_mrbk_node_t ID##_internal_mrbk_node(const ID##_mrbk_ptr_t *const self,  \
+  ID##_mrbk_node_t ID##_internal_mrbk_node(ID##_mrbk_t const self,             \
                                            T *const data) {                    \
-    ID##_mrbk_node_t self_node = malloc(sizeof *self_node);                    \
+    ID##_mrbk_node_t self_node = self->node_cache;                             \
                                                                                \
-    if (self_node == NULL) {                                                   \
-      return self->nil;                                                        \
+    if (self_node != NULL) {                                                   \
+      self->node_cache = self_node->right;                                     \
+      --(self->cached_nodes);                                                  \
+    } else {                                                                   \
+      self_node = ID##_internal_mrbk_malloc(sizeof *self_node);                \
+                                                                               \
+      if (self_node == NULL) {                                                 \
+        return self->nil;                                                      \
+      }                                                                        \
     }                                                                          \
                                                                                \
     self_node->left = self_node->right = self_node->parent = self->nil;        \
     self_node->count = 1;                                                      \
+    self_node->weight = 1;                                                     \
     self_node->color = RED;                                                    \
     self_node->data = *data;                                                   \
                                                                                \
     return self_node;                                                          \
   }                                                                            \
                                                                                \
+  void ID##_internal_mrbk_node_release(ID##_mrbk_t const self,                 \
+                                      ID##_mrbk_node_t const self_node) {      \
+    if (self->cached_nodes < self->node_cache_cap) {                           \
+      self_node->right = self->node_cache;                                     \
+      self->node_cache = self_node;                                            \
+      ++(self->cached_nodes);                                                  \
+    } else {                                                                   \
+      ID##_internal_mrbk_free(self_node);                                      \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
   void ID##_internal_mrbk_free_help(const ID##_mrbk_ptr_t *const self,         \
                                     ID##_mrbk_node_t *self_node) {             \
     if (*self_node == self->nil) {                                             \
@@ -127,15 +172,22 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
       self->frd(&(*self_node)->data);                                          \
     }                                                                          \
                                                                                \
-    free(*self_node);                                                          \
+    ID##_internal_mrbk_free(*self_node);                                       \
     *self_node = self->nil;                                                    \
   }                                                                            \
                                                                                \
   merr_t ID##_mrbk_free(ID##_mrbk_t *self) {                                   \
     if ((self != NULL) && (*self != NULL)) {                                   \
       ID##_internal_mrbk_free_help(*self, &(*self)->root);                     \
-      free((*self)->nil);                                                      \
-      free(*self);                                                             \
+                                                                               \
+      while ((*self)->node_cache != NULL) {                                    \
+        ID##_mrbk_node_t next_node = (*self)->node_cache->right;               \
+        ID##_internal_mrbk_free((*self)->node_cache);                          \
+        (*self)->node_cache = next_node;                                       \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mrbk_free((*self)->nil);                                   \
+      ID##_internal_mrbk_free(*self);                                          \
       *self = NULL;                                                            \
                                                                                \
       return M_OK;                                                             \
@@ -170,6 +222,12 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
       }                                                                        \
     } else {                                                                   \
       self->root = temp;                                                       \
+    }                                                                          \
+                                                                               \
+    if (self->order_stats == mtrue) {                                          \
+      temp->weight = self_node->weight;                                        \
+      self_node->weight = self_node->left->weight +                            \
+                          self_node->right->weight + self_node->count;         \
     }                                                                          \
   }                                                                            \
                                                                                \
@@ -199,9 +257,21 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
       }                                                                        \
     } else {                                                                   \
       self->root = temp;                                                       \
+    }                                                                          \
+                                                                               \
+    if (self->order_stats == mtrue) {                                          \
+      temp->weight = self_node->weight;                                        \
+      self_node->weight = self_node->left->weight +                            \
+                          self_node->right->weight + self_node->count;         \
     }                                                                          \
   }
 
+/**
+ * @brief Defines the `mrbk` structure with the standard library
+ * allocator, see `MRBK_WITH_ALLOC`.
+ */
+#define MRBK(ID, T) MRBK_WITH_ALLOC(ID, T, m_stdlib)
+
 /**
  * @brief Checks whether a binary
  * searc tree object is empty or not.
@@ -551,6 +621,14 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
         iterator = iterator->right;                                            \
       } else {                                                                 \
         ++(iterator->count);                                                   \
+                                                                               \
+        if (self->order_stats == mtrue) {                                      \
+          for (ID##_mrbk_node_t node = iterator; node != self->nil;            \
+               node = node->parent) {                                          \
+            ++(node->weight);                                                  \
+          }                                                                    \
+        }                                                                      \
+                                                                               \
         return M_OK;                                                           \
       }                                                                        \
     }                                                                          \
@@ -570,6 +648,13 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
         parent_iterator->right = self_node;                                    \
       }                                                                        \
                                                                                \
+      if (self->order_stats == mtrue) {                                        \
+        for (ID##_mrbk_node_t node = parent_iterator; node != self->nil;       \
+             node = node->parent) {                                            \
+          ++(node->weight);                                                    \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
       ID##_internal_mrbk_push_fix(self, self_node);                            \
     } else {                                                                   \
       self->root = self_node;                                                  \
@@ -598,6 +683,10 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
     dest->color = src->color;                                                  \
     src->color = temp_color;                                                   \
                                                                                \
+    size_t temp_weight = dest->weight;                                         \
+    dest->weight = src->weight;                                                \
+    src->weight = temp_weight;                                                 \
+                                                                               \
     ID##_mrbk_node_t temp = dest->right;                                       \
     dest->right = src->right;                                                  \
                                                                                \
@@ -750,9 +839,17 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
     }                                                                          \
                                                                                \
     if ((self_node->left != self->nil) && (self_node->right != self->nil)) {   \
-      ID##_internal_mrbk_swap(                                                 \
-          self, self_node,                                                     \
-          ID##_internal_mrbk_min_node(self, self_node->right));                \
+      ID##_mrbk_node_t successor =                                             \
+          ID##_internal_mrbk_min_node(self, self_node->right);                 \
+                                                                               \
+      ID##_internal_mrbk_swap(self, self_node, successor);                     \
+                                                                               \
+      if (self->order_stats == mtrue) {                                        \
+        for (ID##_mrbk_node_t node = self_node; node != successor;             \
+             node = node->parent) {                                            \
+          node->weight = node->weight + self_node->count - successor->count;   \
+        }                                                                      \
+      }                                                                        \
     }                                                                          \
                                                                                \
     mbool_t need_fixing = mtrue;                                               \
@@ -814,11 +911,18 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
                                                                                \
     ID##_mrbk_node_t parent_self_node = self_node->parent;                     \
                                                                                \
+    if (self->order_stats == mtrue) {                                          \
+      for (ID##_mrbk_node_t node = parent_self_node; node != self->nil;        \
+           node = node->parent) {                                              \
+        node->weight -= self_node->count;                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
     if (self->frd != NULL) {                                                   \
       self->frd(&self_node->data);                                             \
     }                                                                          \
                                                                                \
-    free(self_node);                                                           \
+    ID##_internal_mrbk_node_release(self, self_node);                          \
                                                                                \
     --(self->size);                                                            \
                                                                                \
@@ -947,6 +1051,249 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
     return M_OK;                                                               \
   }
 
+/**
+ * @brief Builds the tree from an array sorted in ascending order (according to
+ * the compare function) in O(N) time, instead of N pushes. The nodes are linked
+ * into a perfectly balanced tree, the nodes from the deepest level are colored
+ * in red (except the root) and all the others in black. Equal neighbour
+ * elements are merged into one node, as the push method does. The tree must be
+ * empty.
+ */
+#define MRBK_BUILD_SORTED(ID, T)                                               \
+  ID##_mrbk_node_t ID##_internal_mrbk_build_sorted(                            \
+      const ID##_mrbk_ptr_t *const self, ID##_mrbk_node_t *const chain,        \
+      size_t number_of_nodes, size_t depth,                                    \
+      size_t red_depth) {                                                      \
+    if (number_of_nodes == 0) {                                                \
+      return self->nil;                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mrbk_node_t left_node = ID##_internal_mrbk_build_sorted(              \
+        self, chain, number_of_nodes / 2, depth + 1, red_depth);               \
+                                                                               \
+    ID##_mrbk_node_t root = *chain;                                            \
+    *chain = root->right;                                                      \
+                                                                               \
+    ID##_mrbk_node_t right_node = ID##_internal_mrbk_build_sorted(             \
+        self, chain, number_of_nodes - number_of_nodes / 2 - 1, depth + 1,     \
+        red_depth);                                                            \
+                                                                               \
+    root->left = left_node;                                                    \
+    root->right = right_node;                                                  \
+    root->parent = self->nil;                                                  \
+                                                                               \
+    if (left_node != self->nil) {                                              \
+      left_node->parent = root;                                                \
+    }                                                                          \
+                                                                               \
+    if (right_node != self->nil) {                                             \
+      right_node->parent = root;                                               \
+    }                                                                          \
+                                                                               \
+    root->weight = left_node->weight + right_node->weight + root->count;       \
+    root->color = ((depth != 0) && (depth == red_depth)) ? RED : BLACK;        \
+                                                                               \
+    return root;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mrbk_build_sorted(const ID##_mrbk_t self, const T *const arr,    \
+                               size_t number_of_elem) {                        \
+    if ((self == NULL) || ((arr == NULL) && (number_of_elem != 0))) {          \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size != 0) {                                                     \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    size_t number_of_nodes = 0;                                                \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      int32_t cmp = (iter == 0) ? -1 : self->cmp(&arr[iter - 1], &arr[iter]);  \
+                                                                               \
+      if (cmp > 0) {                                                           \
+        return M_INVALID_INPUT;                                                \
+      }                                                                        \
+                                                                               \
+      if (cmp < 0) {                                                           \
+        ++number_of_nodes;                                                     \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_mrbk_node_t chain = self->nil;                                        \
+    ID##_mrbk_node_t last_node = self->nil;                                    \
+                                                                               \
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {                     \
+      if ((last_node != self->nil) &&                                          \
+          (self->cmp(&last_node->data, &arr[iter]) == 0)) {                    \
+        ++(last_node->count);                                                  \
+        continue;                                                              \
+      }                                                                        \
+                                                                               \
+      T data = arr[iter];                                                      \
+      ID##_mrbk_node_t self_node = ID##_internal_mrbk_node(self, &data);       \
+                                                                               \
+      if (self_node == self->nil) {                                            \
+        while (chain != self->nil) {                                           \
+          ID##_mrbk_node_t next_node = chain->right;                           \
+          ID##_internal_mrbk_free(chain);                                      \
+          chain = next_node;                                                   \
+        }                                                                      \
+                                                                               \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+                                                                               \
+      if (last_node == self->nil) {                                            \
+        chain = self_node;                                                     \
+      } else {                                                                 \
+        last_node->right = self_node;                                          \
+      }                                                                        \
+                                                                               \
+      last_node = self_node;                                                   \
+    }                                                                          \
+                                                                               \
+    size_t red_depth = 0;                                                      \
+                                                                               \
+    while ((number_of_nodes >> (red_depth + 1)) != 0) {                        \
+      ++red_depth;                                                             \
+    }                                                                          \
+                                                                               \
+    self->root = ID##_internal_mrbk_build_sorted(self, &chain, number_of_nodes,\
+                                                 0, red_depth);                \
+    self->size = number_of_nodes;                                              \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Makes every node keep the number of elements of its subtree (equal
+ * elements are counted separately), so that the k-th smallest element and the
+ * rank of a data are found in O(logN) time. The weights are kept up to date by
+ * every push, pop and rotation.
+ */
+#define MRBK_ORDER_STATS(ID, T)                                                \
+  size_t ID##_internal_mrbk_order_stats(const ID##_mrbk_ptr_t *const self,     \
+                                       ID##_mrbk_node_t const self_node) {     \
+    if (self_node == self->nil) {                                              \
+      return 0;                                                                \
+    }                                                                          \
+                                                                               \
+    size_t left_weight = ID##_internal_mrbk_order_stats(self, self_node->left);\
+    size_t right_weight =                                                      \
+        ID##_internal_mrbk_order_stats(self, self_node->right);                \
+                                                                               \
+    self_node->weight = left_weight + right_weight + self_node->count;         \
+                                                                               \
+    return self_node->weight;                                                  \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mrbk_use_order_stats(ID##_mrbk_t const self) {                   \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->order_stats == mfalse) {                                         \
+      ID##_internal_mrbk_order_stats(self, self->root);                        \
+      self->order_stats = mtrue;                                               \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  size_t ID##_mrbk_total_count(const ID##_mrbk_ptr_t *const self) {            \
+    if ((self == NULL) || (self->order_stats == mfalse)) {                     \
+      return 0;                                                                \
+    }                                                                          \
+                                                                               \
+    return self->root->weight;                                                 \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mrbk_select(const ID##_mrbk_ptr_t *const self, size_t k,         \
+                         T *const acc) {                                       \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->order_stats == mfalse) {                                         \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    ID##_mrbk_node_t iterator = self->root;                                    \
+                                                                               \
+    while (iterator != self->nil) {                                            \
+      if (k < iterator->left->weight) {                                        \
+        iterator = iterator->left;                                             \
+      } else if (k < iterator->left->weight + iterator->count) {               \
+        *acc = iterator->data;                                                 \
+        return M_OK;                                                           \
+      } else {                                                                 \
+        k -= iterator->left->weight + iterator->count;                         \
+        iterator = iterator->right;                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_IDX_OVERFLOW;                                                     \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mrbk_rank(const ID##_mrbk_ptr_t *const self, T data,             \
+                       size_t *const acc) {                                    \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->order_stats == mfalse) {                                         \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    ID##_mrbk_node_t iterator = self->root;                                    \
+    size_t rank = 0;                                                           \
+                                                                               \
+    while (iterator != self->nil) {                                            \
+      int32_t cmp = self->cmp(&iterator->data, &data);                         \
+                                                                               \
+      if (cmp > 0) {                                                           \
+        iterator = iterator->left;                                             \
+      } else {                                                                 \
+        rank += iterator->left->weight;                                        \
+                                                                               \
+        if (cmp == 0) {                                                        \
+          break;                                                               \
+        }                                                                      \
+                                                                               \
+        rank += iterator->count;                                               \
+        iterator = iterator->right;                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    *acc = rank;                                                               \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Keeps up to `capacity` nodes of the popped elements in a free list of
+ * the object and reuses them for the next pushes, so a steady stream of pushes
+ * and pops does not call the allocator. The cache is off (`capacity` 0) for a
+ * new object, a smaller capacity frees the nodes above it.
+ */
+#define MRBK_NODE_CACHE(ID, T)                                                 \
+  merr_t ID##_mrbk_node_cache(ID##_mrbk_t const self, size_t capacity) {       \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    self->node_cache_cap = capacity;                                           \
+                                                                               \
+    while (self->cached_nodes > capacity) {                                    \
+      ID##_mrbk_node_t next_node = self->node_cache->right;                    \
+      ID##_internal_mrbk_free(self->node_cache);                               \
+      self->node_cache = next_node;                                            \
+      --(self->cached_nodes);                                                  \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 /**
  * @brief Adds the all API for the `mrbk_t` structure (binary search tree). You
  * will not be always need to use all the API, in this case you must be sure
@@ -957,8 +1304,8 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
  * different ids for the same type. The ID protocol is used when different files
  * want to have the same two typed structures in order to avoid name collisions.
  */
-#define MRBK_ALL(ID, T)                                                        \
-  MRBK(ID, T)                                                                  \
+#define MRBK_ALL_WITH_ALLOC(ID, T, ALLOC)                                      \
+  MRBK_WITH_ALLOC(ID, T, ALLOC)                                                \
   MRBK_EMPTY(ID, T)                                                            \
   MRBK_SIZE(ID, T)                                                             \
   MRBK_ROOT(ID, T)                                                             \
@@ -973,6 +1320,497 @@ typedef enum notype_rbk_color_s { RED, BLACK } notype_rbk_color_t;
   MRBK_POP(ID, T)                                                              \
   MRBK_TRAVERSE_INORDER(ID, T)                                                 \
   MRBK_TRAVERSE_PREORDER(ID, T)                                                \
-  MRBK_TRAVERSE_POSTORDER(ID, T)
+  MRBK_TRAVERSE_POSTORDER(ID, T)                                               \
+  MRBK_BUILD_SORTED(ID, T)                                                     \
+  MRBK_ORDER_STATS(ID, T)                                                      \
+  MRBK_NODE_CACHE(ID, T)
+
+/**
+ * @brief Adds the all API for the `mrbk` structure with the standard
+ * library allocator, see `MRBK_ALL_WITH_ALLOC`.
+ */
+#define MRBK_ALL(ID, T) MRBK_ALL_WITH_ALLOC(ID, T, m_stdlib)
+
+/**
+ * @brief Generates an intrusive red-black tree (`mirbk_t`) of `T` objects
+ * linked through their `LINK` field of type `mrbk_link_t` and ordered by
+ * `CMP(const T *, const T *)`, which is pasted at expansion (returns less than,
+ * equal to or greater than zero). The tree never allocates and never copies the
+ * objects, so it can index objects that already live in an array, a pool or
+ * another intrusive container. Equal objects are all kept, a new one is placed
+ * after the equal ones. The `mirbk_ptr_t` head is owned by the caller, it holds
+ * the nil sentinel of the tree, so it must be set with `mirbk_init` and must
+ * not be copied or moved afterwards.
+ */
+#define MRBK_INTRUSIVE(ID, T, LINK, CMP)                                       \
+  ACTION_FUNC(ID, T)                                                           \
+                                                                               \
+  typedef struct ID##_mirbk_s {                                                \
+    mrbk_link_t *root;                                                         \
+    mrbk_link_t nil;                                                           \
+    size_t size;                                                               \
+  } ID##_mirbk_ptr_t, *ID##_mirbk_t;                                           \
+                                                                               \
+  T *ID##_internal_mirbk_entry(const ID##_mirbk_ptr_t *const self,             \
+                               mrbk_link_t *const link) {                      \
+    if (link == &self->nil) {                                                  \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return (T *)((char *)link - offsetof(T, LINK));                            \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mirbk_rotl(ID##_mirbk_t const self, mrbk_link_t *link) {  \
+    mrbk_link_t *right = link->right;                                          \
+                                                                               \
+    link->right = right->left;                                                 \
+                                                                               \
+    if (right->left != &self->nil) {                                           \
+      right->left->parent = link;                                              \
+    }                                                                          \
+                                                                               \
+    right->parent = link->parent;                                              \
+                                                                               \
+    if (link->parent == &self->nil) {                                          \
+      self->root = right;                                                      \
+    } else if (link->parent->left == link) {                                   \
+      link->parent->left = right;                                              \
+    } else {                                                                   \
+      link->parent->right = right;                                             \
+    }                                                                          \
+                                                                               \
+    right->left = link;                                                        \
+    link->parent = right;                                                      \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mirbk_rotr(ID##_mirbk_t const self, mrbk_link_t *link) {  \
+    mrbk_link_t *left = link->left;                                            \
+                                                                               \
+    link->left = left->right;                                                  \
+                                                                               \
+    if (left->right != &self->nil) {                                           \
+      left->right->parent = link;                                              \
+    }                                                                          \
+                                                                               \
+    left->parent = link->parent;                                               \
+                                                                               \
+    if (link->parent == &self->nil) {                                          \
+      self->root = left;                                                       \
+    } else if (link->parent->right == link) {                                  \
+      link->parent->right = left;                                              \
+    } else {                                                                   \
+      link->parent->left = left;                                               \
+    }                                                                          \
+                                                                               \
+    left->right = link;                                                        \
+    link->parent = left;                                                       \
+  }                                                                            \
+                                                                               \
+  mrbk_link_t *ID##_internal_mirbk_min(const ID##_mirbk_ptr_t *const self,     \
+                                       mrbk_link_t *link) {                    \
+    while (link->left != &self->nil) {                                         \
+      link = link->left;                                                       \
+    }                                                                          \
+                                                                               \
+    return link;                                                               \
+  }                                                                            \
+                                                                               \
+  mrbk_link_t *ID##_internal_mirbk_max(const ID##_mirbk_ptr_t *const self,     \
+                                       mrbk_link_t *link) {                    \
+    while (link->right != &self->nil) {                                        \
+      link = link->right;                                                      \
+    }                                                                          \
+                                                                               \
+    return link;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mirbk_init(ID##_mirbk_t const self) {                            \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    self->nil.color = BLACK;                                                   \
+    self->nil.left = self->nil.right = self->nil.parent = &self->nil;          \
+    self->root = &self->nil;                                                   \
+    self->size = 0;                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  mbool_t ID##_mirbk_empty(const ID##_mirbk_ptr_t *const self) {               \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }                                                                            \
+                                                                               \
+  size_t ID##_mirbk_size(const ID##_mirbk_ptr_t *const self) {                 \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->size;                                                         \
+  }                                                                            \
+                                                                               \
+  T *ID##_mirbk_min(const ID##_mirbk_ptr_t *const self) {                      \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mirbk_entry(                                          \
+        self, ID##_internal_mirbk_min(self, self->root));                      \
+  }                                                                            \
+                                                                               \
+  T *ID##_mirbk_max(const ID##_mirbk_ptr_t *const self) {                      \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mirbk_entry(                                          \
+        self, ID##_internal_mirbk_max(self, self->root));                      \
+  }                                                                            \
+                                                                               \
+  T *ID##_mirbk_succ(const ID##_mirbk_ptr_t *const self, T *const obj) {       \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    mrbk_link_t *link = &obj->LINK;                                            \
+                                                                               \
+    if (link->right != &self->nil) {                                           \
+      return ID##_internal_mirbk_entry(                                        \
+          self, ID##_internal_mirbk_min(self, link->right));                   \
+    }                                                                          \
+                                                                               \
+    mrbk_link_t *parent = link->parent;                                        \
+                                                                               \
+    while ((parent != &self->nil) && (parent->right == link)) {                \
+      link = parent;                                                           \
+      parent = parent->parent;                                                 \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mirbk_entry(self, parent);                            \
+  }                                                                            \
+                                                                               \
+  T *ID##_mirbk_pred(const ID##_mirbk_ptr_t *const self, T *const obj) {       \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    mrbk_link_t *link = &obj->LINK;                                            \
+                                                                               \
+    if (link->left != &self->nil) {                                            \
+      return ID##_internal_mirbk_entry(                                        \
+          self, ID##_internal_mirbk_max(self, link->left));                    \
+    }                                                                          \
+                                                                               \
+    mrbk_link_t *parent = link->parent;                                        \
+                                                                               \
+    while ((parent != &self->nil) && (parent->left == link)) {                 \
+      link = parent;                                                           \
+      parent = parent->parent;                                                 \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mirbk_entry(self, parent);                            \
+  }                                                                            \
+                                                                               \
+  T *ID##_mirbk_find(const ID##_mirbk_ptr_t *const self, const T *const key) { \
+    if ((self == NULL) || (key == NULL)) {                                     \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    mrbk_link_t *iterator = self->root;                                        \
+                                                                               \
+    while (iterator != &self->nil) {                                           \
+      int cmp = CMP(key, ID##_internal_mirbk_entry(self, iterator));           \
+                                                                               \
+      if (cmp == 0) {                                                          \
+        return ID##_internal_mirbk_entry(self, iterator);                      \
+      }                                                                        \
+                                                                               \
+      iterator = (cmp < 0) ? iterator->left : iterator->right;                 \
+    }                                                                          \
+                                                                               \
+    return NULL;                                                               \
+  }                                                                            \
+                                                                               \
+  T *ID##_mirbk_lower_bound(const ID##_mirbk_ptr_t *const self,                \
+                            const T *const key) {                              \
+    if ((self == NULL) || (key == NULL)) {                                     \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    mrbk_link_t *iterator = self->root;                                        \
+    mrbk_link_t *bound = NULL;                                                 \
+                                                                               \
+    while (iterator != &self->nil) {                                           \
+      if (CMP(ID##_internal_mirbk_entry(self, iterator), key) < 0) {           \
+        iterator = iterator->right;                                            \
+      } else {                                                                 \
+        bound = iterator;                                                      \
+        iterator = iterator->left;                                             \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    if (bound == NULL) {                                                       \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mirbk_entry(self, bound);                             \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mirbk_push_fix(ID##_mirbk_t const self,                   \
+                                    mrbk_link_t *link) {                       \
+    while (link->parent->color == RED) {                                       \
+      mrbk_link_t *parent = link->parent;                                      \
+      mrbk_link_t *grand = parent->parent;                                     \
+                                                                               \
+      if (grand->left == parent) {                                             \
+        mrbk_link_t *uncle = grand->right;                                     \
+                                                                               \
+        if (uncle->color == RED) {                                             \
+          parent->color = uncle->color = BLACK;                                \
+          grand->color = RED;                                                  \
+          link = grand;                                                        \
+          continue;                                                            \
+        }                                                                      \
+                                                                               \
+        if (parent->right == link) {                                           \
+          link = parent;                                                       \
+          ID##_internal_mirbk_rotl(self, link);                                \
+          parent = link->parent;                                               \
+        }                                                                      \
+                                                                               \
+        parent->color = BLACK;                                                 \
+        grand->color = RED;                                                    \
+        ID##_internal_mirbk_rotr(self, grand);                                 \
+      } else {                                                                 \
+        mrbk_link_t *uncle = grand->left;                                      \
+                                                                               \
+        if (uncle->color == RED) {                                             \
+          parent->color = uncle->color = BLACK;                                \
+          grand->color = RED;                                                  \
+          link = grand;                                                        \
+          continue;                                                            \
+        }                                                                      \
+                                                                               \
+        if (parent->left == link) {                                            \
+          link = parent;                                                       \
+          ID##_internal_mirbk_rotr(self, link);                                \
+          parent = link->parent;                                               \
+        }                                                                      \
+                                                                               \
+        parent->color = BLACK;                                                 \
+        grand->color = RED;                                                    \
+        ID##_internal_mirbk_rotl(self, grand);                                 \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    self->root->color = BLACK;                                                 \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mirbk_push(ID##_mirbk_t const self, T *const obj) {              \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    mrbk_link_t *link = &obj->LINK;                                            \
+    mrbk_link_t *parent = &self->nil;                                          \
+    mrbk_link_t *iterator = self->root;                                        \
+    int cmp = 0;                                                               \
+                                                                               \
+    while (iterator != &self->nil) {                                           \
+      parent = iterator;                                                       \
+      cmp = CMP(obj, ID##_internal_mirbk_entry(self, iterator));               \
+      iterator = (cmp < 0) ? iterator->left : iterator->right;                 \
+    }                                                                          \
+                                                                               \
+    link->parent = parent;                                                     \
+    link->left = link->right = &self->nil;                                     \
+    link->color = RED;                                                         \
+                                                                               \
+    if (parent == &self->nil) {                                                \
+      self->root = link;                                                       \
+    } else if (cmp < 0) {                                                      \
+      parent->left = link;                                                     \
+    } else {                                                                   \
+      parent->right = link;                                                    \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mirbk_push_fix(self, link);                                  \
+    ++(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mirbk_transplant(ID##_mirbk_t const self,                 \
+                                      mrbk_link_t *const old_link,             \
+                                      mrbk_link_t *const new_link) {           \
+    if (old_link->parent == &self->nil) {                                      \
+      self->root = new_link;                                                   \
+    } else if (old_link->parent->left == old_link) {                           \
+      old_link->parent->left = new_link;                                       \
+    } else {                                                                   \
+      old_link->parent->right = new_link;                                      \
+    }                                                                          \
+                                                                               \
+    new_link->parent = old_link->parent;                                       \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mirbk_remove_fix(ID##_mirbk_t const self,                 \
+                                      mrbk_link_t *link) {                     \
+    while ((link != self->root) && (link->color == BLACK)) {                   \
+      mrbk_link_t *parent = link->parent;                                      \
+                                                                               \
+      if (parent->left == link) {                                              \
+        mrbk_link_t *brother = parent->right;                                  \
+                                                                               \
+        if (brother->color == RED) {                                           \
+          brother->color = BLACK;                                              \
+          parent->color = RED;                                                 \
+          ID##_internal_mirbk_rotl(self, parent);                              \
+          brother = parent->right;                                             \
+        }                                                                      \
+                                                                               \
+        if ((brother->left->color == BLACK) &&                                 \
+            (brother->right->color == BLACK)) {                                \
+          brother->color = RED;                                                \
+          link = parent;                                                       \
+          continue;                                                            \
+        }                                                                      \
+                                                                               \
+        if (brother->right->color == BLACK) {                                  \
+          brother->left->color = BLACK;                                        \
+          brother->color = RED;                                                \
+          ID##_internal_mirbk_rotr(self, brother);                             \
+          brother = parent->right;                                             \
+        }                                                                      \
+                                                                               \
+        brother->color = parent->color;                                        \
+        parent->color = BLACK;                                                 \
+        brother->right->color = BLACK;                                         \
+        ID##_internal_mirbk_rotl(self, parent);                                \
+      } else {                                                                 \
+        mrbk_link_t *brother = parent->left;                                   \
+                                                                               \
+        if (brother->color == RED) {                                           \
+          brother->color = BLACK;                                              \
+          parent->color = RED;                                                 \
+          ID##_internal_mirbk_rotr(self, parent);                              \
+          brother = parent->left;                                              \
+        }                                                                      \
+                                                                               \
+        if ((brother->left->color == BLACK) &&                                 \
+            (brother->right->color == BLACK)) {                                \
+          brother->color = RED;                                                \
+          link = parent;                                                       \
+          continue;                                                            \
+        }                                                                      \
+                                                                               \
+        if (brother->left->color == BLACK) {                                   \
+          brother->right->color = BLACK;                                       \
+          brother->color = RED;                                                \
+          ID##_internal_mirbk_rotl(self, brother);                             \
+          brother = parent->left;                                              \
+        }                                                                      \
+                                                                               \
+        brother->color = parent->color;                                        \
+        parent->color = BLACK;                                                 \
+        brother->left->color = BLACK;                                          \
+        ID##_internal_mirbk_rotr(self, parent);                                \
+      }                                                                        \
+                                                                               \
+      link = self->root;                                                       \
+    }                                                                          \
+                                                                               \
+    link->color = BLACK;                                                       \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mirbk_remove(ID##_mirbk_t const self, T *const obj) {            \
+    if ((self == NULL) || (obj == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      return M_EMPTY_STRUCTURE;                                                \
+    }                                                                          \
+                                                                               \
+    mrbk_link_t *link = &obj->LINK;                                            \
+    mrbk_link_t *child = &self->nil;                                           \
+    notype_rbk_color_t removed_color = link->color;                            \
+                                                                               \
+    if (link->left == &self->nil) {                                            \
+      child = link->right;                                                     \
+      ID##_internal_mirbk_transplant(self, link, link->right);                 \
+    } else if (link->right == &self->nil) {                                    \
+      child = link->left;                                                      \
+      ID##_internal_mirbk_transplant(self, link, link->left);                  \
+    } else {                                                                   \
+      mrbk_link_t *next = ID##_internal_mirbk_min(self, link->right);          \
+                                                                               \
+      removed_color = next->color;                                             \
+      child = next->right;                                                     \
+                                                                               \
+      if (next->parent == link) {                                              \
+        child->parent = next;                                                  \
+      } else {                                                                 \
+        ID##_internal_mirbk_transplant(self, next, next->right);               \
+        next->right = link->right;                                             \
+        next->right->parent = next;                                            \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mirbk_transplant(self, link, next);                        \
+      next->left = link->left;                                                 \
+      next->left->parent = next;                                               \
+      next->color = link->color;                                               \
+    }                                                                          \
+                                                                               \
+    if (removed_color == BLACK) {                                              \
+      ID##_internal_mirbk_remove_fix(self, child);                             \
+    }                                                                          \
+                                                                               \
+    link->parent = link->left = link->right = NULL;                            \
+    --(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mirbk_clear(ID##_mirbk_t const self) {                           \
+    return ID##_mirbk_init(self);                                              \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mirbk_traverse_inorder_help(                              \
+      const ID##_mirbk_ptr_t *const self, mrbk_link_t *const link,             \
+      ID##_action_func action) {                                               \
+    if (link == &self->nil) {                                                  \
+      return;                                                                  \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mirbk_traverse_inorder_help(self, link->left, action);       \
+    action(ID##_internal_mirbk_entry(self, link));                             \
+    ID##_internal_mirbk_traverse_inorder_help(self, link->right, action);      \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mirbk_traverse_inorder(const ID##_mirbk_ptr_t *const self,       \
+                                     ID##_action_func action) {                \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      printf("(Nil)\n");                                                       \
+    } else {                                                                   \
+      printf("[");                                                             \
+      ID##_internal_mirbk_traverse_inorder_help(self, self->root, action);     \
+      printf(" ]");                                                            \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
 
 #endif /* MACROS_GENERIC_RBK_BINARY_SEARCH_TREE_UTILS_H_ */
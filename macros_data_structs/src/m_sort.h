@@ -0,0 +1,399 @@
+/**
+ * @file m_sort.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2023-06-12
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of c-language-data-structures.
+ *
+ * c-language-data-structures is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * c-language-data-structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with c-language-data-structures.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MACROS_GENERICS_SORT_UTILS_H_
+#define MACROS_GENERICS_SORT_UTILS_H_
+
+#include "./m_config.h"
+
+/**
+ * @brief Utility file containing macros that generate sorting and searching
+ * functions for arrays of one type.
+ *
+ * @param ID the id of the functions in order to reduce name collisions.
+ * @param T the type of the elements of the arrays.
+ * @param CMP the name of the compare function (or function like macro) of two
+ * elements, `int32_t CMP(const T *const, const T *const)`, it is known at
+ * compile time, so it is inlined in the generated functions and the elements
+ * are moved as values of type T (not byte by byte).
+ */
+
+#define MSORT_INSERTION_CUTOFF 16
+
+/**
+ * @brief Defines the introsort of an array (`ID_msort`) and the internal
+ * functions used by the other sorting methods. The pivot is the median of three
+ * elements, ranges of at most MSORT_INSERTION_CUTOFF elements are sorted by
+ * insertion sort, just the smaller part of every partition is sorted
+ * recursevily and if the partitions are unbalanced for too long the range is
+ * sorted by heap sort, so the sort takes O(NlogN) time for any input. The sort
+ * is not stable.
+ */
+#define MSORT(ID, T, CMP)                                                      \
+  void ID##_internal_msort_swap(T *const fst, T *const snd) {                  \
+    T temp = *fst;                                                             \
+    *fst = *snd;                                                               \
+    *snd = temp;                                                               \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_msort_insertion(T *const arr, size_t size) {              \
+    for (size_t iter = 1; iter < size; ++iter) {                               \
+      T value = arr[iter];                                                     \
+      size_t idx = iter;                                                       \
+                                                                               \
+      while ((idx > 0) && (CMP(&value, &arr[idx - 1]) < 0)) {                  \
+        arr[idx] = arr[idx - 1];                                               \
+        --idx;                                                                 \
+      }                                                                        \
+                                                                               \
+      arr[idx] = value;                                                        \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_msort_sift_down(T *const arr, size_t idx, size_t size) {  \
+    T value = arr[idx];                                                        \
+                                                                               \
+    for (;;) {                                                                 \
+      size_t child = 2 * idx + 1;                                              \
+                                                                               \
+      if (child >= size) {                                                     \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      if ((child + 1 < size) && (CMP(&arr[child], &arr[child + 1]) < 0)) {     \
+        ++child;                                                               \
+      }                                                                        \
+                                                                               \
+      if (CMP(&value, &arr[child]) >= 0) {                                     \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      arr[idx] = arr[child];                                                   \
+      idx = child;                                                             \
+    }                                                                          \
+                                                                               \
+    arr[idx] = value;                                                          \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_msort_make_heap(T *const arr, size_t size) {              \
+    for (size_t iter = size / 2; iter > 0; --iter) {                           \
+      ID##_internal_msort_sift_down(arr, iter - 1, size);                      \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_msort_sort_heap(T *const arr, size_t size) {              \
+    for (size_t iter = size; iter > 1; --iter) {                               \
+      ID##_internal_msort_swap(&arr[0], &arr[iter - 1]);                       \
+      ID##_internal_msort_sift_down(arr, 0, iter - 1);                         \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  T *ID##_internal_msort_median(T *const fst, T *const snd, T *const trd) {    \
+    if (CMP(fst, snd) < 0) {                                                   \
+      if (CMP(snd, trd) < 0) {                                                 \
+        return snd;                                                            \
+      }                                                                        \
+                                                                               \
+      return (CMP(fst, trd) < 0) ? trd : fst;                                  \
+    }                                                                          \
+                                                                               \
+    if (CMP(fst, trd) < 0) {                                                   \
+      return fst;                                                              \
+    }                                                                          \
+                                                                               \
+    return (CMP(snd, trd) < 0) ? trd : snd;                                    \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_msort_intro(T *arr, size_t size, size_t depth) {          \
+    while (size > MSORT_INSERTION_CUTOFF) {                                    \
+      if (depth == 0) {                                                        \
+        ID##_internal_msort_make_heap(arr, size);                              \
+        ID##_internal_msort_sort_heap(arr, size);                              \
+        return;                                                                \
+      }                                                                        \
+                                                                               \
+      --depth;                                                                 \
+                                                                               \
+      T pivot = *ID##_internal_msort_median(&arr[0], &arr[size / 2],           \
+                                            &arr[size - 1]);                   \
+                                                                               \
+      size_t lt = 0;                                                           \
+      size_t rt = size - 1;                                                    \
+                                                                               \
+      for (;;) {                                                               \
+        while (CMP(&arr[lt], &pivot) < 0) {                                    \
+          ++lt;                                                                \
+        }                                                                      \
+                                                                               \
+        while (CMP(&pivot, &arr[rt]) < 0) {                                    \
+          --rt;                                                                \
+        }                                                                      \
+                                                                               \
+        if (lt >= rt) {                                                        \
+          break;                                                               \
+        }                                                                      \
+                                                                               \
+        ID##_internal_msort_swap(&arr[lt], &arr[rt]);                          \
+        ++lt;                                                                  \
+        --rt;                                                                  \
+      }                                                                        \
+                                                                               \
+      size_t lt_size = rt + 1;                                                 \
+                                                                               \
+      if (lt_size < size - lt_size) {                                          \
+        ID##_internal_msort_intro(arr, lt_size, depth);                        \
+        arr += lt_size;                                                        \
+        size -= lt_size;                                                       \
+      } else {                                                                 \
+        ID##_internal_msort_intro(arr + lt_size, size - lt_size, depth);       \
+        size = lt_size;                                                        \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_internal_msort_insertion(arr, size);                                  \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_msort(T *const arr, size_t size) {                               \
+    if (arr == NULL) {                                                         \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t depth = 0;                                                          \
+                                                                               \
+    for (size_t iter = size; iter > 1; iter >>= 1) {                           \
+      depth += 2;                                                              \
+    }                                                                          \
+                                                                               \
+    ID##_internal_msort_intro(arr, size, depth);                               \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Function to sort an array and to keep the order of equal elements. The
+ * array is split in runs of MSORT_INSERTION_CUTOFF elements sorted by insertion
+ * sort and then the runs are merged in a loop between the array and one buffer
+ * of the size of the array, so the function may fail if the buffer can not be
+ * allocated. `MSORT` must be defined for the same id before.
+ */
+#define MSORT_STABLE(ID, T, CMP)                                               \
+  void ID##_internal_mstable_merge(const T *const lt, size_t lt_size,          \
+                                   const T *const rt, size_t rt_size,          \
+                                   T *const dst) {                             \
+    size_t lt_idx = 0;                                                         \
+    size_t rt_idx = 0;                                                         \
+    size_t dst_idx = 0;                                                        \
+                                                                               \
+    while ((lt_idx < lt_size) && (rt_idx < rt_size)) {                         \
+      if (CMP(&rt[rt_idx], &lt[lt_idx]) < 0) {                                 \
+        dst[dst_idx++] = rt[rt_idx++];                                         \
+      } else {                                                                 \
+        dst[dst_idx++] = lt[lt_idx++];                                         \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    while (lt_idx < lt_size) {                                                 \
+      dst[dst_idx++] = lt[lt_idx++];                                           \
+    }                                                                          \
+                                                                               \
+    while (rt_idx < rt_size) {                                                 \
+      dst[dst_idx++] = rt[rt_idx++];                                           \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mstable_sort(T *const arr, size_t size) {                        \
+    if (arr == NULL) {                                                         \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (size <= MSORT_INSERTION_CUTOFF) {                                      \
+      ID##_internal_msort_insertion(arr, size);                                \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    T *buffer = malloc(sizeof *buffer * size);                                 \
+                                                                               \
+    if (buffer == NULL) {                                                      \
+      return M_MALLOC_FAILED;                                                  \
+    }                                                                          \
+                                                                               \
+    for (size_t iter = 0; iter < size; iter += MSORT_INSERTION_CUTOFF) {       \
+      size_t run_size = size - iter;                                           \
+                                                                               \
+      if (run_size > MSORT_INSERTION_CUTOFF) {                                 \
+        run_size = MSORT_INSERTION_CUTOFF;                                     \
+      }                                                                        \
+                                                                               \
+      ID##_internal_msort_insertion(arr + iter, run_size);                     \
+    }                                                                          \
+                                                                               \
+    T *src = arr;                                                              \
+    T *dst = buffer;                                                           \
+                                                                               \
+    for (size_t width = MSORT_INSERTION_CUTOFF; width < size; width *= 2) {    \
+      for (size_t iter = 0; iter < size; iter += 2 * width) {                  \
+        size_t lt_size = (size - iter < width) ? (size - iter) : width;        \
+        size_t rt_size = size - iter - lt_size;                                \
+                                                                               \
+        if (rt_size > width) {                                                 \
+          rt_size = width;                                                     \
+        }                                                                      \
+                                                                               \
+        ID##_internal_mstable_merge(src + iter, lt_size, src + iter + lt_size, \
+                                    rt_size, dst + iter);                      \
+      }                                                                        \
+                                                                               \
+      T *temp = src;                                                           \
+      src = dst;                                                               \
+      dst = temp;                                                              \
+    }                                                                          \
+                                                                               \
+    if (src != arr) {                                                          \
+      memcpy(arr, src, sizeof *arr * size);                                    \
+    }                                                                          \
+                                                                               \
+    free(buffer);                                                              \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Function to place the smallest `middle` elements of the array sorted
+ * in the first `middle` positions, the order of the other elements is not
+ * defined. It keeps a heap of the `middle` smallest elements, so it takes
+ * O(Nlog(middle)) time and no extra memory. `MSORT` must be defined for the
+ * same id before.
+ */
+#define MSORT_PARTIAL(ID, T, CMP)                                              \
+  merr_t ID##_mpartial_sort(T *const arr, size_t middle, size_t size) {        \
+    if (arr == NULL) {                                                         \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (middle > size) {                                                       \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    ID##_internal_msort_make_heap(arr, middle);                                \
+                                                                               \
+    for (size_t iter = middle; iter < size; ++iter) {                          \
+      if ((middle > 0) && (CMP(&arr[iter], &arr[0]) < 0)) {                    \
+        ID##_internal_msort_swap(&arr[iter], &arr[0]);                         \
+        ID##_internal_msort_sift_down(arr, 0, middle);                         \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    ID##_internal_msort_sort_heap(arr, middle);                                \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Functions to search data in an array sorted by the same compare
+ * function. The lower bound is the index of the first element not less than the
+ * data and the upper bound is the index of the first element greater than the
+ * data (the size of the array if there is no such element). The binary search
+ * stores the index of the first element equal to the data in a non `NULL`
+ * accumulator or returns M_NOT_FOUND.
+ */
+#define MSORT_BSEARCH(ID, T, CMP)                                              \
+  merr_t ID##_mlower_bound(const T *const arr, size_t size, T data,            \
+                           size_t *const idx) {                                \
+    if ((arr == NULL) || (idx == NULL)) {                                      \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t low = 0;                                                            \
+                                                                               \
+    while (size > 0) {                                                         \
+      size_t half = size / 2;                                                  \
+                                                                               \
+      if (CMP(&arr[low + half], &data) < 0) {                                  \
+        low += half + 1;                                                       \
+        size -= half + 1;                                                      \
+      } else {                                                                 \
+        size = half;                                                           \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    *idx = low;                                                                \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mupper_bound(const T *const arr, size_t size, T data,            \
+                           size_t *const idx) {                                \
+    if ((arr == NULL) || (idx == NULL)) {                                      \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t low = 0;                                                            \
+                                                                               \
+    while (size > 0) {                                                         \
+      size_t half = size / 2;                                                  \
+                                                                               \
+      if (CMP(&data, &arr[low + half]) < 0) {                                  \
+        size = half;                                                           \
+      } else {                                                                 \
+        low += half + 1;                                                       \
+        size -= half + 1;                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    *idx = low;                                                                \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbinary_search(const T *const arr, size_t size, T data,          \
+                             size_t *const idx) {                              \
+    size_t found = 0;                                                          \
+    merr_t err = ID##_mlower_bound(arr, size, data, &found);                   \
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    if ((found == size) || (CMP(&arr[found], &data) != 0)) {                   \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    *idx = found;                                                              \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Defines every sorting and searching function for the same id, type and
+ * compare function. The functions are defined for every call, so call it just
+ * once for one id.
+ */
+#define MSORT_ALL(ID, T, CMP)                                                  \
+  MSORT(ID, T, CMP)                                                            \
+  MSORT_STABLE(ID, T, CMP)                                                     \
+  MSORT_PARTIAL(ID, T, CMP)                                                    \
+  MSORT_BSEARCH(ID, T, CMP)
+
+#endif /* MACROS_GENERICS_SORT_UTILS_H_ */
@@ -42,24 +42,27 @@
  * structure. This structure require a method for freeing data memory, if data
  * is not stored as a pointer (T <=> *M), then the free function must be `NULL`.
  * If data represents a structure which contains pointers allocated, then the
- * free function must free those fields.
+ * free function must free those fields. The elements are stored inline in one
+ * array that doubles when it is full, so push and pop do not call malloc.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
  */
-#define MSTACK(ID, T)                                                          \
-  FREE_FUNC(ID, T)                                                             \
+#define MSTACK_WITH_ALLOC(ID, T, ALLOC)                                        \
+  M_ALLOC(ID, mstack, ALLOC)                                                   \
                                                                                \
-  typedef struct ID##_mstack_node_s {                                          \
-    T data;                                                                    \
-    struct ID##_mstack_node_s *next;                                           \
-  } ID##_mstack_node_ptr_t, *ID##_mstack_node_t;                               \
+  FREE_FUNC(ID, T)                                                             \
                                                                                \
   typedef struct ID##_mstack_s {                                               \
-    ID##_mstack_node_t top;                                                    \
+    T *data;                                                                   \
     ID##_free_func frd;                                                        \
     size_t size;                                                               \
+    size_t capacity;                                                           \
+    size_t shrink_ratio;                                                       \
   } ID##_mstack_ptr_t, *ID##_mstack_t;                                         \
                                                                                \
   ID##_mstack_t ID##_mstack(ID##_free_func frd) {                              \
-    ID##_mstack_t self = malloc(sizeof *self);                                 \
+    ID##_mstack_t self = ID##_internal_mstack_malloc(sizeof *self);            \
                                                                                \
     if (self == NULL) {                                                        \
       return NULL;                                                             \
@@ -67,39 +70,24 @@
                                                                                \
     self->frd = frd;                                                           \
                                                                                \
-    self->top = NULL;                                                          \
+    self->data = NULL;                                                         \
     self->size = 0;                                                            \
+    self->capacity = 0;                                                        \
+    self->shrink_ratio = 0;                                                    \
                                                                                \
     return self;                                                               \
   }                                                                            \
                                                                                \
-  ID##_mstack_node_t ID##_internal_mstack_node(T *const data) {                \
-    ID##_mstack_node_t self_node = malloc(sizeof *self_node);                  \
-                                                                               \
-    if (self_node == NULL) {                                                   \
-      return NULL;                                                             \
-    }                                                                          \
-                                                                               \
-    self_node->next = NULL;                                                    \
-    self_node->data = *data;                                                   \
-                                                                               \
-    return self_node;                                                          \
-  }                                                                            \
-                                                                               \
   merr_t ID##_mstack_free(ID##_mstack_t *self) {                               \
     if ((self != NULL) && (*self != NULL)) {                                   \
-      while ((*self)->top != NULL) {                                           \
-        ID##_mstack_node_t iterator = (*self)->top;                            \
-        (*self)->top = (*self)->top->next;                                     \
-                                                                               \
-        if ((*self)->frd != NULL) {                                            \
-          (*self)->frd(&iterator->data);                                       \
+      if ((*self)->frd != NULL) {                                              \
+        for (size_t iter = 0; iter < (*self)->size; ++iter) {                  \
+          (*self)->frd(&(*self)->data[iter]);                                  \
         }                                                                      \
-                                                                               \
-        free(iterator);                                                        \
       }                                                                        \
                                                                                \
-      free(*self);                                                             \
+      ID##_internal_mstack_free((*self)->data);                                \
+      ID##_internal_mstack_free(*self);                                        \
       *self = NULL;                                                            \
                                                                                \
       return M_OK;                                                             \
@@ -108,9 +96,15 @@
     return M_FREE_NULL;                                                        \
   }
 
+/**
+ * @brief Defines the `mstack` structure with the standard library
+ * allocator, see `MSTACK_WITH_ALLOC`.
+ */
+#define MSTACK(ID, T) MSTACK_WITH_ALLOC(ID, T, m_stdlib)
+
 /**
  * @brief Traverses all stack and do action(basically it is used for printing
- * the stack) on all data nodes.
+ * the stack) on all data nodes, from the top to the bottom.
  */
 #define MSTACK_TRAVERSE(ID, T)                                                 \
   ACTION_FUNC(ID, T)                                                           \
@@ -125,16 +119,15 @@
       return M_NULL_ACTION;                                                    \
     }                                                                          \
                                                                                \
-    if (self->top == NULL) {                                                   \
+    if (self->size == 0) {                                                     \
       printf("[ ]\n");                                                         \
     } else {                                                                   \
       printf("[");                                                             \
-      ID##_mstack_node_t iterator = self->top;                                 \
                                                                                \
-      while (iterator != NULL) {                                               \
-        action(&iterator->data);                                               \
-        iterator = iterator->next;                                             \
+      for (size_t iter = self->size; iter > 0; --iter) {                       \
+        action(&self->data[iter - 1]);                                         \
       }                                                                        \
+                                                                               \
       printf(" ]");                                                            \
     }                                                                          \
                                                                                \
@@ -143,13 +136,13 @@
 
 /**
  * @brief Function to check if a stack object is empty or not. The
- * function tests if top of list is `NULL` in that case function will return
- * true, otherwise it will return false. A `NULL` stack is also considered as an
- * empty stack.
+ * function tests if the stack has no elements in that case function will
+ * return true, otherwise it will return false. A `NULL` stack is also
+ * considered as an empty stack.
  */
 #define MSTACK_EMPTY(ID, T)                                                    \
   mbool_t ID##_mstack_empty(const ID##_mstack_ptr_t *const self) {             \
-    if ((self == NULL) || (self->top == NULL)) {                               \
+    if ((self == NULL) || (self->size == 0)) {                                 \
       return mtrue;                                                            \
     }                                                                          \
                                                                                \
@@ -179,17 +172,18 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    if (self->top == NULL) {                                                   \
+    if (self->size == 0) {                                                     \
       return M_EMPTY_STRUCTURE;                                                \
     }                                                                          \
                                                                                \
-    *acc = self->top->data;                                                    \
+    *acc = self->data[self->size - 1];                                         \
                                                                                \
     return M_OK;                                                               \
   }
 
 /**
- * @brief Inserts an element to the end of the stack.
+ * @brief Inserts an element to the end of the stack, the array doubles when
+ * it is full.
  */
 #define MSTACK_PUSH(ID, T)                                                     \
   merr_t ID##_mstack_push(const ID##_mstack_t self, T data) {                  \
@@ -197,27 +191,33 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    ID##_mstack_node_t self_node = ID##_internal_mstack_node(&data);           \
+    if (self->size == self->capacity) {                                        \
+      size_t new_capacity = (self->capacity == 0) ? 16 : 2 * self->capacity;   \
                                                                                \
-    if (self_node == NULL) {                                                   \
-      return M_MALLOC_FAILED;                                                  \
-    }                                                                          \
+      if (new_capacity > SIZE_MAX / sizeof(T)) {                               \
+        return M_REALLOC_FAILED;                                               \
+      }                                                                        \
                                                                                \
-    if (self->top == NULL) {                                                   \
-      self->top = self_node;                                                   \
-    } else {                                                                   \
-      self_node->next = self->top;                                             \
-      self->top = self_node;                                                   \
+      T *new_data =                                                            \
+          ID##_internal_mstack_realloc(self->data, new_capacity * sizeof(T));  \
+                                                                               \
+      if (new_data == NULL) {                                                  \
+        return M_REALLOC_FAILED;                                               \
+      }                                                                        \
+                                                                               \
+      self->data = new_data;                                                   \
+      self->capacity = new_capacity;                                           \
     }                                                                          \
                                                                                \
-    ++(self->size);                                                            \
+    self->data[(self->size)++] = data;                                         \
                                                                                \
     return M_OK;                                                               \
   }
 
 /**
  * @brief Removed the top element from the stack object, or returs an error if
- * the stack was empty or `NULL`.
+ * the stack was empty or `NULL`. If a shrink ratio was set the array halves
+ * when it is mostly empty.
  */
 #define MSTACK_POP(ID, T)                                                      \
   merr_t ID##_mstack_pop(const ID##_mstack_t self) {                           \
@@ -225,19 +225,65 @@
       return M_NULL_INPUT;                                                     \
     }                                                                          \
                                                                                \
-    if ((self->top == NULL) || (self->size == 0)) {                            \
+    if (self->size == 0) {                                                     \
       return M_POP_FROM_EMPTY;                                                 \
     }                                                                          \
                                                                                \
-    ID##_mstack_node_t self_node = self->top;                                  \
-    self->top = self->top->next;                                               \
     --(self->size);                                                            \
                                                                                \
     if (self->frd != NULL) {                                                   \
-      self->frd(&self_node->data);                                             \
+      self->frd(&self->data[self->size]);                                      \
     }                                                                          \
                                                                                \
-    free(self_node);                                                           \
+    if ((self->shrink_ratio != 0) && (self->capacity > 16) &&                  \
+        (self->size <= self->capacity / self->shrink_ratio)) {                 \
+      T *new_data =                                                            \
+          ID##_internal_mstack_realloc(self->data,                             \
+                                       self->capacity / 2 * sizeof(T));        \
+                                                                               \
+      if (new_data != NULL) {                                                  \
+        self->data = new_data;                                                 \
+        self->capacity /= 2;                                                   \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Preallocates the array of the stack for at least `capacity` elements
+ * and sets the shrink ratio, the array halves after a pop that leaves at most
+ * capacity / shrink_ratio elements (0 never shrinks, otherwise at least 4 so
+ * a halved array is at most half full).
+ */
+#define MSTACK_RESERVE(ID, T)                                                  \
+  merr_t ID##_mstack_reserve(const ID##_mstack_t self, size_t capacity,        \
+                             size_t shrink_ratio) {                            \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if ((shrink_ratio != 0) && (shrink_ratio < 4)) {                           \
+      return M_INVALID_INPUT;                                                  \
+    }                                                                          \
+                                                                               \
+    self->shrink_ratio = shrink_ratio;                                         \
+                                                                               \
+    if (capacity > self->capacity) {                                           \
+      if (capacity > SIZE_MAX / sizeof(T)) {                                   \
+        return M_REALLOC_FAILED;                                               \
+      }                                                                        \
+                                                                               \
+      T *new_data =                                                            \
+          ID##_internal_mstack_realloc(self->data, capacity * sizeof(T));      \
+                                                                               \
+      if (new_data == NULL) {                                                  \
+        return M_REALLOC_FAILED;                                               \
+      }                                                                        \
+                                                                               \
+      self->data = new_data;                                                   \
+      self->capacity = capacity;                                               \
+    }                                                                          \
                                                                                \
     return M_OK;                                                               \
   }
@@ -253,13 +299,20 @@
  * different files want to have the same two typed structures in order to avoid
  * name collisions.
  */
-#define MSTACK_ALL(ID, T)                                                      \
-  MSTACK(ID, T)                                                                \
+#define MSTACK_ALL_WITH_ALLOC(ID, T, ALLOC)                                    \
+  MSTACK_WITH_ALLOC(ID, T, ALLOC)                                              \
   MSTACK_TRAVERSE(ID, T)                                                       \
   MSTACK_EMPTY(ID, T)                                                          \
   MSTACK_SIZE(ID, T)                                                           \
   MSTACK_TOP(ID, T)                                                            \
   MSTACK_PUSH(ID, T)                                                           \
-  MSTACK_POP(ID, T)
+  MSTACK_POP(ID, T)                                                            \
+  MSTACK_RESERVE(ID, T)
+
+/**
+ * @brief Adds the all API for the `mstack` structure with the standard
+ * library allocator, see `MSTACK_ALL_WITH_ALLOC`.
+ */
+#define MSTACK_ALL(ID, T) MSTACK_ALL_WITH_ALLOC(ID, T, m_stdlib)
 
 #endif /* MACROS_GENERIC_STACK_UTILS_H_ */
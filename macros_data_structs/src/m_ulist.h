@@ -0,0 +1,755 @@
+/**
+ * @file m_ulist.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2023-06-12
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of c-language-data-structures.
+ *
+ * c-language-data-structures is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * c-language-data-structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with c-language-data-structures.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MACROS_GENERICS_ULIST_UTILS_H_
+#define MACROS_GENERICS_ULIST_UTILS_H_
+
+#include "./m_config.h"
+
+/**
+ * @brief Utility file containing macros that generate functions for generic
+ * unrolled linked list, a list of chunks that store many elements each.
+ *
+ * @param ID the id of the structure in order to reduce name collisions.
+ * @param T the type of the data stored inside the structure.
+ */
+
+/**
+ * @brief Length in bytes of the elements of one chunk and the least number of
+ * elements of one chunk, the capacity of a chunk is known at compile time.
+ */
+#define MULIST_CHUNK_BYTES 256
+#define MULIST_MIN_CHUNK_ELEMS 4
+
+#define MULIST_CHUNK_CAP(T)                                                    \
+  ((sizeof(T) * MULIST_MIN_CHUNK_ELEMS > MULIST_CHUNK_BYTES)                   \
+       ? (size_t)MULIST_MIN_CHUNK_ELEMS                                        \
+       : (size_t)(MULIST_CHUNK_BYTES / sizeof(T)))
+
+/**
+ * @brief Generates the `mulist_t` structure depending on the name and type.
+ * Every chunk keeps up to `MULIST_CHUNK_CAP(T)` elements in an inline array,
+ * so a traversal reads the elements one after another and an insertion in the
+ * middle moves just the elements of one chunk (a full chunk is split in two
+ * halves). After a deletion a chunk under a quarter full is merged with a
+ * neighbour chunk or takes elements from it. Also generates the internal
+ * methods for the chunks and the basic functions for creation and freeing
+ * memory for the structure. This structure require a method for comparing
+ * data and for freeing data memory, if data is not stored as a pointer
+ * (T <=> *M), then the free function must be `NULL`.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
+ */
+#define MULIST_WITH_ALLOC(ID, T, ALLOC)                                        \
+  M_ALLOC(ID, mulist, ALLOC)                                                   \
+                                                                               \
+  CMP_FUNC(ID, T)                                                              \
+  FREE_FUNC(ID, T)                                                             \
+                                                                               \
+  typedef struct ID##_mulist_node_s {                                          \
+    struct ID##_mulist_node_s *prev;                                           \
+    struct ID##_mulist_node_s *next;                                           \
+    size_t count;                                                              \
+    T data[MULIST_CHUNK_CAP(T)];                                               \
+  } ID##_mulist_node_ptr_t, *ID##_mulist_node_t;                               \
+                                                                               \
+  typedef struct ID##_mulist_s {                                               \
+    ID##_mulist_node_t head;                                                   \
+    ID##_mulist_node_t tail;                                                   \
+    ID##_compare_func cmp;                                                     \
+    ID##_free_func frd;                                                        \
+    size_t size;                                                               \
+  } ID##_mulist_ptr_t, *ID##_mulist_t;                                         \
+                                                                               \
+  ID##_mulist_t ID##_mulist(ID##_compare_func cmp, ID##_free_func frd) {       \
+    if (cmp == NULL) {                                                         \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    ID##_mulist_t self = ID##_internal_mulist_malloc(sizeof *self);            \
+                                                                               \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->cmp = cmp;                                                           \
+    self->frd = frd;                                                           \
+                                                                               \
+    self->head = self->tail = NULL;                                            \
+    self->size = 0;                                                            \
+                                                                               \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
+  ID##_mulist_node_t ID##_internal_mulist_link(const ID##_mulist_t self,       \
+                                               ID##_mulist_node_t node) {      \
+    ID##_mulist_node_t self_node =                                             \
+        ID##_internal_mulist_malloc(sizeof *self_node);                        \
+                                                                               \
+    if (self_node == NULL) {                                                   \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self_node->count = 0;                                                      \
+    self_node->prev = node;                                                    \
+                                                                               \
+    if (node == NULL) {                                                        \
+      self_node->next = self->head;                                            \
+      self->head = self_node;                                                  \
+    } else {                                                                   \
+      self_node->next = node->next;                                            \
+      node->next = self_node;                                                  \
+    }                                                                          \
+                                                                               \
+    if (self_node->next == NULL) {                                             \
+      self->tail = self_node;                                                  \
+    } else {                                                                   \
+      self_node->next->prev = self_node;                                       \
+    }                                                                          \
+                                                                               \
+    return self_node;                                                          \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mulist_unlink(const ID##_mulist_t self,                   \
+                                   ID##_mulist_node_t node) {                  \
+    if (node->prev == NULL) {                                                  \
+      self->head = node->next;                                                 \
+    } else {                                                                   \
+      node->prev->next = node->next;                                           \
+    }                                                                          \
+                                                                               \
+    if (node->next == NULL) {                                                  \
+      self->tail = node->prev;                                                 \
+    } else {                                                                   \
+      node->next->prev = node->prev;                                           \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mulist_free(node);                                           \
+  }                                                                            \
+                                                                               \
+  ID##_mulist_node_t ID##_internal_mulist_locate(                              \
+      const ID##_mulist_ptr_t *const self, size_t idx, size_t *const off) {    \
+    ID##_mulist_node_t iterator = NULL;                                        \
+                                                                               \
+    if (idx < self->size / 2) {                                                \
+      iterator = self->head;                                                   \
+                                                                               \
+      while (idx >= iterator->count) {                                         \
+        idx -= iterator->count;                                                \
+        iterator = iterator->next;                                             \
+      }                                                                        \
+                                                                               \
+      *off = idx;                                                              \
+    } else {                                                                   \
+      size_t back = self->size - 1 - idx;                                      \
+      iterator = self->tail;                                                   \
+                                                                               \
+      while (back >= iterator->count) {                                        \
+        back -= iterator->count;                                               \
+        iterator = iterator->prev;                                             \
+      }                                                                        \
+                                                                               \
+      *off = iterator->count - 1 - back;                                       \
+    }                                                                          \
+                                                                               \
+    return iterator;                                                           \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_internal_mulist_insert(const ID##_mulist_t self,                 \
+                                     ID##_mulist_node_t node, size_t off,      \
+                                     T data) {                                 \
+    if (node->count == MULIST_CHUNK_CAP(T)) {                                  \
+      ID##_mulist_node_t split = ID##_internal_mulist_link(self, node);        \
+                                                                               \
+      if (split == NULL) {                                                     \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+                                                                               \
+      const size_t half = node->count / 2;                                     \
+                                                                               \
+      split->count = node->count - half;                                       \
+      node->count = half;                                                      \
+                                                                               \
+      memcpy(split->data, node->data + half, split->count * sizeof(T));        \
+                                                                               \
+      if (off > half) {                                                        \
+        node = split;                                                          \
+        off -= half;                                                           \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    memmove(node->data + off + 1, node->data + off,                            \
+            (node->count - off) * sizeof(T));                                  \
+    node->data[off] = data;                                                    \
+                                                                               \
+    ++(node->count);                                                           \
+    ++(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mulist_remove(const ID##_mulist_t self,                   \
+                                   ID##_mulist_node_t node, size_t off,        \
+                                   size_t dl) {                                \
+    if (self->frd != NULL) {                                                   \
+      for (size_t iter = off; iter < off + dl; ++iter) {                       \
+        self->frd(&node->data[iter]);                                          \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    memmove(node->data + off, node->data + off + dl,                           \
+            (node->count - off - dl) * sizeof(T));                             \
+                                                                               \
+    node->count -= dl;                                                         \
+    self->size -= dl;                                                          \
+  }                                                                            \
+                                                                               \
+  void ID##_internal_mulist_rebalance(const ID##_mulist_t self,                \
+                                      ID##_mulist_node_t node) {               \
+    if (node->count == 0) {                                                    \
+      ID##_internal_mulist_unlink(self, node);                                 \
+      return;                                                                  \
+    }                                                                          \
+                                                                               \
+    if (node->count >= MULIST_CHUNK_CAP(T) / 4) {                              \
+      return;                                                                  \
+    }                                                                          \
+                                                                               \
+    if (node->next != NULL) {                                                  \
+      ID##_mulist_node_t next = node->next;                                    \
+                                                                               \
+      if (node->count + next->count <= MULIST_CHUNK_CAP(T)) {                  \
+        memcpy(node->data + node->count, next->data,                           \
+               next->count * sizeof(T));                                       \
+        node->count += next->count;                                            \
+                                                                               \
+        ID##_internal_mulist_unlink(self, next);                               \
+      } else {                                                                 \
+        const size_t moved = (next->count - node->count) / 2;                  \
+                                                                               \
+        memcpy(node->data + node->count, next->data, moved * sizeof(T));       \
+        memmove(next->data, next->data + moved,                                \
+                (next->count - moved) * sizeof(T));                            \
+                                                                               \
+        node->count += moved;                                                  \
+        next->count -= moved;                                                  \
+      }                                                                        \
+    } else if (node->prev != NULL) {                                           \
+      ID##_mulist_node_t prev = node->prev;                                    \
+                                                                               \
+      if (prev->count + node->count <= MULIST_CHUNK_CAP(T)) {                  \
+        memcpy(prev->data + prev->count, node->data,                           \
+               node->count * sizeof(T));                                       \
+        prev->count += node->count;                                            \
+                                                                               \
+        ID##_internal_mulist_unlink(self, node);                               \
+      } else {                                                                 \
+        const size_t moved = (prev->count - node->count) / 2;                  \
+                                                                               \
+        memmove(node->data + moved, node->data, node->count * sizeof(T));      \
+        memcpy(node->data, prev->data + prev->count - moved,                   \
+               moved * sizeof(T));                                             \
+                                                                               \
+        node->count += moved;                                                  \
+        prev->count -= moved;                                                  \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mulist_free(ID##_mulist_t *self) {                               \
+    if ((self != NULL) && (*self != NULL)) {                                   \
+      while ((*self)->head != NULL) {                                          \
+        ID##_mulist_node_t iterator = (*self)->head;                           \
+        (*self)->head = (*self)->head->next;                                   \
+                                                                               \
+        if ((*self)->frd != NULL) {                                            \
+          for (size_t iter = 0; iter < iterator->count; ++iter) {              \
+            (*self)->frd(&iterator->data[iter]);                               \
+          }                                                                    \
+        }                                                                      \
+                                                                               \
+        ID##_internal_mulist_free(iterator);                                   \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mulist_free(*self);                                        \
+      *self = NULL;                                                            \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    return M_FREE_NULL;                                                        \
+  }
+
+/**
+ * @brief Defines the `mulist` structure with the standard library
+ * allocator, see `MULIST_WITH_ALLOC`.
+ */
+#define MULIST(ID, T) MULIST_WITH_ALLOC(ID, T, m_stdlib)
+
+/**
+ * @brief Function to check if an unrolled list object is empty or not. A
+ * `NULL` list is also considered as an empty list.
+ */
+#define MULIST_EMPTY(ID, T)                                                    \
+  mbool_t ID##_mulist_empty(const ID##_mulist_ptr_t *const self) {             \
+    if ((self == NULL) || (self->head == NULL)) {                              \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }
+
+/**
+ * @brief Get the list size object. If list is not allocated then function will
+ * return SIZE_MAX value.
+ */
+#define MULIST_SIZE(ID, T)                                                     \
+  size_t ID##_mulist_size(const ID##_mulist_ptr_t *const self) {               \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->size;                                                         \
+  }
+
+/**
+ * @brief Get the list head data, stored in an accumulator, the accumulator
+ * should not be NULL.
+ */
+#define MULIST_HEAD(ID, T)                                                     \
+  merr_t ID##_mulist_head(const ID##_mulist_ptr_t *const self, T *const acc) { \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->head == NULL) {                                                  \
+      return M_EMPTY_STRUCTURE;                                                \
+    }                                                                          \
+                                                                               \
+    *acc = self->head->data[0];                                                \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Get the list tail data, stored in an accumulator, the accumulator
+ * should not be NULL.
+ */
+#define MULIST_TAIL(ID, T)                                                     \
+  merr_t ID##_mulist_tail(const ID##_mulist_ptr_t *const self, T *const acc) { \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->tail == NULL) {                                                  \
+      return M_EMPTY_STRUCTURE;                                                \
+    }                                                                          \
+                                                                               \
+    *acc = self->tail->data[self->tail->count - 1];                            \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Function to find the data from a given index, whole chunks are
+ * skipped from the closer end of the list. Function will fail if index is
+ * bigger than current size of list or list is not allocated, the data is
+ * stored in a non NULL accumulator.
+ */
+#define MULIST_FIND_IDX(ID, T)                                                 \
+  merr_t ID##_mulist_find_idx(const ID##_mulist_ptr_t *const self, size_t idx, \
+                              T *const acc) {                                  \
+    if ((self == NULL) || (idx >= self->size) || (acc == NULL)) {              \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t off = 0;                                                            \
+    ID##_mulist_node_t node = ID##_internal_mulist_locate(self, idx, &off);    \
+                                                                               \
+    *acc = node->data[off];                                                    \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Function to find the first element equal to the data provided by
+ * user. It uses cmp function provided by user at the creation of the unrolled
+ * list, the data is palced in an accumulator (it may be NULL).
+ */
+#define MULIST_FIND(ID, T)                                                     \
+  merr_t ID##_mulist_find(const ID##_mulist_ptr_t *const self, T data,         \
+                          T *const acc) {                                      \
+    if ((self == NULL) || (self->head == NULL)) {                              \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    for (ID##_mulist_node_t iterator = self->head; iterator != NULL;           \
+         iterator = iterator->next) {                                          \
+      for (size_t iter = 0; iter < iterator->count; ++iter) {                  \
+        if (self->cmp(&iterator->data[iter], &data) == 0) {                    \
+          if (acc != NULL) {                                                   \
+            *acc = iterator->data[iter];                                       \
+          }                                                                    \
+                                                                               \
+          return M_OK;                                                         \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_NOT_FOUND;                                                        \
+  }
+
+/**
+ * @brief Inserts an element to the end of the unrolled list, a new chunk is
+ * linked just when the last chunk is full.
+ */
+#define MULIST_PUSH(ID, T)                                                     \
+  merr_t ID##_mulist_push(const ID##_mulist_t self, T data) {                  \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    ID##_mulist_node_t node = self->tail;                                      \
+                                                                               \
+    if ((node == NULL) || (node->count == MULIST_CHUNK_CAP(T))) {              \
+      node = ID##_internal_mulist_link(self, node);                            \
+                                                                               \
+      if (node == NULL) {                                                      \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mulist_insert(self, node, node->count, data);         \
+  }
+
+/**
+ * @brief Inserts a new element in front of the unrolled list, a new chunk is
+ * linked just when the first chunk is full.
+ */
+#define MULIST_PUSH_FRONT(ID, T)                                               \
+  merr_t ID##_mulist_push_front(const ID##_mulist_t self, T data) {            \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    ID##_mulist_node_t node = self->head;                                      \
+                                                                               \
+    if ((node == NULL) || (node->count == MULIST_CHUNK_CAP(T))) {              \
+      node = ID##_internal_mulist_link(self, NULL);                            \
+                                                                               \
+      if (node == NULL) {                                                      \
+        return M_MALLOC_FAILED;                                                \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mulist_insert(self, node, 0, data);                   \
+  }
+
+/**
+ * @brief Inserts an element at a specified index in the list. If index is
+ * bigger than current list size than element will be inserted at the end of
+ * the list. Depends on `MULIST_PUSH` and `MULIST_PUSH_FRONT`.
+ */
+#define MULIST_PUSH_IDX(ID, T)                                                 \
+  merr_t ID##_mulist_push_idx(const ID##_mulist_t self, T data, size_t idx) {  \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (idx >= self->size) {                                                   \
+      return ID##_mulist_push(self, data);                                     \
+    }                                                                          \
+                                                                               \
+    if (idx == 0) {                                                            \
+      return ID##_mulist_push_front(self, data);                               \
+    }                                                                          \
+                                                                               \
+    size_t off = 0;                                                            \
+    ID##_mulist_node_t node = ID##_internal_mulist_locate(self, idx, &off);    \
+                                                                               \
+    return ID##_internal_mulist_insert(self, node, off, data);                 \
+  }
+
+/**
+ * @brief Function to insert an element in order in the list, the chunks whose
+ * last element is smaller than the data are skipped whole. Depends on
+ * `MULIST_PUSH`.
+ */
+#define MULIST_PUSH_ORDER(ID, T)                                               \
+  merr_t ID##_mulist_push_order(const ID##_mulist_t self, T data) {            \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    ID##_mulist_node_t iterator = self->head;                                  \
+                                                                               \
+    while ((iterator != NULL) &&                                               \
+           (self->cmp(&data, &iterator->data[iterator->count - 1]) > 0)) {     \
+      iterator = iterator->next;                                               \
+    }                                                                          \
+                                                                               \
+    if (iterator == NULL) {                                                    \
+      return ID##_mulist_push(self, data);                                     \
+    }                                                                          \
+                                                                               \
+    size_t off = 0;                                                            \
+                                                                               \
+    while (self->cmp(&data, &iterator->data[off]) > 0) {                       \
+      ++off;                                                                   \
+    }                                                                          \
+                                                                               \
+    return ID##_internal_mulist_insert(self, iterator, off, data);             \
+  }
+
+/**
+ * @brief Deletes the first element equal to a value, the data has to exist in
+ * the current list.
+ */
+#define MULIST_POP(ID, T)                                                      \
+  merr_t ID##_mulist_pop(const ID##_mulist_t self, T data) {                   \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->head == NULL) {                                                  \
+      return M_POP_FROM_EMPTY;                                                 \
+    }                                                                          \
+                                                                               \
+    for (ID##_mulist_node_t iterator = self->head; iterator != NULL;           \
+         iterator = iterator->next) {                                          \
+      for (size_t iter = 0; iter < iterator->count; ++iter) {                  \
+        if (self->cmp(&iterator->data[iter], &data) == 0) {                    \
+          ID##_internal_mulist_remove(self, iterator, iter, 1);                \
+          ID##_internal_mulist_rebalance(self, iterator);                      \
+                                                                               \
+          return M_OK;                                                         \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_NOT_FOUND;                                                        \
+  }
+
+/**
+ * @brief Deletes an element based on an index. If idx is bigger than actual
+ * size of the list then function will fail its execution and will return an
+ * error.
+ */
+#define MULIST_POP_IDX(ID, T)                                                  \
+  merr_t ID##_mulist_pop_idx(const ID##_mulist_t self, size_t idx) {           \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->head == NULL) {                                                  \
+      return M_POP_FROM_EMPTY;                                                 \
+    }                                                                          \
+                                                                               \
+    if (idx >= self->size) {                                                   \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    size_t off = 0;                                                            \
+    ID##_mulist_node_t node = ID##_internal_mulist_locate(self, idx, &off);    \
+                                                                               \
+    ID##_internal_mulist_remove(self, node, off, 1);                           \
+    ID##_internal_mulist_rebalance(self, node);                                \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Erases a set of elements from range [left_index; right_index]. If
+ * left_index is greater than right_index that they will be swapped. If
+ * right_index is bigger than actual size of the list right_index will be
+ * updated to the end of the list. If both left and right index are bigger than
+ * actual list size than the last element from unrolled object will be removed.
+ * The chunks inside the range are freed whole.
+ */
+#define MULIST_ERASE(ID, T)                                                    \
+  merr_t ID##_mulist_erase(const ID##_mulist_t self, size_t lt, size_t rt) {   \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->head == NULL) {                                                  \
+      return M_POP_FROM_EMPTY;                                                 \
+    }                                                                          \
+                                                                               \
+    if (lt > rt) {                                                             \
+      size_t temp = lt;                                                        \
+      lt = rt;                                                                 \
+      rt = temp;                                                               \
+    }                                                                          \
+                                                                               \
+    if (lt >= self->size) {                                                    \
+      lt = self->size - 1;                                                     \
+    }                                                                          \
+                                                                               \
+    if (rt >= self->size) {                                                    \
+      rt = self->size - 1;                                                     \
+    }                                                                          \
+                                                                               \
+    size_t dl = rt - lt + 1;                                                   \
+    size_t off = 0;                                                            \
+                                                                               \
+    ID##_mulist_node_t first = ID##_internal_mulist_locate(self, lt, &off);    \
+                                                                               \
+    size_t removed = first->count - off;                                       \
+                                                                               \
+    if (removed > dl) {                                                        \
+      removed = dl;                                                            \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mulist_remove(self, first, off, removed);                    \
+    dl -= removed;                                                             \
+                                                                               \
+    ID##_mulist_node_t last = first->next;                                     \
+                                                                               \
+    while ((dl != 0) && (dl >= last->count)) {                                 \
+      ID##_mulist_node_t next = last->next;                                    \
+                                                                               \
+      dl -= last->count;                                                       \
+      ID##_internal_mulist_remove(self, last, 0, last->count);                 \
+      ID##_internal_mulist_unlink(self, last);                                 \
+                                                                               \
+      last = next;                                                             \
+    }                                                                          \
+                                                                               \
+    if (dl != 0) {                                                             \
+      ID##_internal_mulist_remove(self, last, 0, dl);                          \
+      ID##_internal_mulist_rebalance(self, last);                              \
+    }                                                                          \
+                                                                               \
+    ID##_internal_mulist_rebalance(self, first);                               \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Filters a given unrolled list object. User has to provide a function
+ * that return mtrue(1) or mfalse(0). If filter function return 1 for an item
+ * then it will be added in a new unrolled list, otherwise item will not be
+ * inserted. If no element was inserted in the new unrolled list than the list
+ * will be automatically erased from memory. Depends on `MULIST_PUSH`.
+ */
+#define MULIST_FILTER(ID, T)                                                   \
+  FILTER_FUNC(ID, T)                                                           \
+                                                                               \
+  ID##_mulist_t ID##_mulist_filter(const ID##_mulist_ptr_t *const self,        \
+                                   ID##_filter_func f) {                       \
+    if ((self == NULL) || (self->head == NULL) || (f == NULL)) {               \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    ID##_mulist_t filter_list = ID##_mulist(self->cmp, self->frd);             \
+                                                                               \
+    if (filter_list == NULL) {                                                 \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    for (ID##_mulist_node_t iterator = self->head; iterator != NULL;           \
+         iterator = iterator->next) {                                          \
+      for (size_t iter = 0; iter < iterator->count; ++iter) {                  \
+        if (f(&iterator->data[iter]) == mtrue) {                               \
+          ID##_mulist_push(filter_list, iterator->data[iter]);                 \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    if (filter_list->head == NULL) {                                           \
+      ID##_mulist_free(&filter_list);                                          \
+    }                                                                          \
+                                                                               \
+    return filter_list;                                                        \
+  }
+
+/**
+ * @brief Traverses all list and do action on all data, the elements of one
+ * chunk are visited one after another in memory.
+ */
+#define MULIST_TRAVERSE(ID, T)                                                 \
+  ACTION_FUNC(ID, T)                                                           \
+                                                                               \
+  merr_t ID##_mulist_traverse(const ID##_mulist_ptr_t *self,                   \
+                              ID##_action_func action) {                       \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->head == NULL) {                                                  \
+      printf("[ ]\n");                                                         \
+    } else {                                                                   \
+      printf("[");                                                             \
+                                                                               \
+      for (ID##_mulist_node_t iterator = self->head; iterator != NULL;         \
+           iterator = iterator->next) {                                        \
+        for (size_t iter = 0; iter < iterator->count; ++iter) {                \
+          action(&iterator->data[iter]);                                       \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      printf(" ]");                                                            \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Adds the all API for the `mulist_t` structure (unrolled linked list).
+ * You will not be always need to use all the API, in this case you must be
+ * sure that you call `MULIST` for definition of the unrolled list, any other
+ * macro definitions are to bring new functionalities.
+ */
+#define MULIST_ALL_WITH_ALLOC(ID, T, ALLOC)                                    \
+  MULIST_WITH_ALLOC(ID, T, ALLOC)                                              \
+  MULIST_EMPTY(ID, T)                                                          \
+  MULIST_SIZE(ID, T)                                                           \
+  MULIST_HEAD(ID, T)                                                           \
+  MULIST_TAIL(ID, T)                                                           \
+  MULIST_FIND_IDX(ID, T)                                                       \
+  MULIST_FIND(ID, T)                                                           \
+  MULIST_PUSH(ID, T)                                                           \
+  MULIST_PUSH_FRONT(ID, T)                                                     \
+  MULIST_PUSH_IDX(ID, T)                                                       \
+  MULIST_PUSH_ORDER(ID, T)                                                     \
+  MULIST_POP(ID, T)                                                            \
+  MULIST_POP_IDX(ID, T)                                                        \
+  MULIST_ERASE(ID, T)                                                          \
+  MULIST_FILTER(ID, T)                                                         \
+  MULIST_TRAVERSE(ID, T)
+
+/**
+ * @brief Adds the all API for the `mulist` structure with the standard
+ * library allocator, see `MULIST_ALL_WITH_ALLOC`.
+ */
+#define MULIST_ALL(ID, T) MULIST_ALL_WITH_ALLOC(ID, T, m_stdlib)
+
+#endif /* MACROS_GENERICS_ULIST_UTILS_H_ */
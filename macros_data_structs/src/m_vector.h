@@ -0,0 +1,483 @@
+/**
+ * @file m_vector.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2023-06-12
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of c-language-data-structures.
+ *
+ * c-language-data-structures is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * c-language-data-structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with c-language-data-structures.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MACROS_GENERICS_VECTOR_UTILS_H_
+#define MACROS_GENERICS_VECTOR_UTILS_H_
+
+#include "./m_config.h"
+
+/**
+ * @brief Utility file containing macros that generate functions for generic
+ * dynamic array (vector).
+ *
+ * @param ID the id of the structure in order to reduce name collisions.
+ * @param T the type of the data stored inside the structure.
+ */
+
+/**
+ * @brief Least number of elements of the array after the first growth.
+ */
+#define MVECTOR_MIN_CAPACITY 16
+
+/**
+ * @brief Generates the `mvector_t` structure depending on the name and type.
+ * Also generates basic function for creation and freeing memory for the
+ * structure. This structure require a method for freeing data memory, if data
+ * is not stored as a pointer (T <=> *M), then the free function must be `NULL`.
+ * If data represents a structure which contains pointers allocated, then the
+ * free function must free those fields. The elements are stored inline in one
+ * array that doubles when it is full. The internal grow function makes room
+ * for at least `capacity` elements.
+ *
+ * `ALLOC` is the allocator of the object and of all its memory (`m_stdlib`
+ * for the standard library), read `M_ALLOC` from "m_config.h".
+ */
+#define MVECTOR_WITH_ALLOC(ID, T, ALLOC)                                       \
+  M_ALLOC(ID, mvector, ALLOC)                                                  \
+                                                                               \
+  FREE_FUNC(ID, T)                                                             \
+                                                                               \
+  typedef struct ID##_mvector_s {                                              \
+    T *data;                                                                   \
+    ID##_free_func frd;                                                        \
+    size_t size;                                                               \
+    size_t capacity;                                                           \
+  } ID##_mvector_ptr_t, *ID##_mvector_t;                                       \
+                                                                               \
+  ID##_mvector_t ID##_mvector(ID##_free_func frd) {                            \
+    ID##_mvector_t self = ID##_internal_mvector_malloc(sizeof *self);          \
+                                                                               \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    self->frd = frd;                                                           \
+                                                                               \
+    self->data = NULL;                                                         \
+    self->size = 0;                                                            \
+    self->capacity = 0;                                                        \
+                                                                               \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mvector_free(ID##_mvector_t *self) {                             \
+    if ((self != NULL) && (*self != NULL)) {                                   \
+      if ((*self)->frd != NULL) {                                              \
+        for (size_t iter = 0; iter < (*self)->size; ++iter) {                  \
+          (*self)->frd(&(*self)->data[iter]);                                  \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      ID##_internal_mvector_free((*self)->data);                               \
+      ID##_internal_mvector_free(*self);                                       \
+      *self = NULL;                                                            \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    return M_FREE_NULL;                                                        \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mvector_internal_grow(const ID##_mvector_t self,                 \
+                                    size_t capacity) {                         \
+    if (capacity <= self->capacity) {                                          \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    size_t new_capacity =                                                      \
+        (self->capacity == 0) ? MVECTOR_MIN_CAPACITY : self->capacity;         \
+                                                                               \
+    while (new_capacity < capacity) {                                          \
+      if (new_capacity > SIZE_MAX / 2) {                                       \
+        new_capacity = capacity;                                               \
+        break;                                                                 \
+      }                                                                        \
+                                                                               \
+      new_capacity *= 2;                                                       \
+    }                                                                          \
+                                                                               \
+    if (new_capacity > SIZE_MAX / sizeof(T)) {                                 \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    T *new_data =                                                              \
+        ID##_internal_mvector_realloc(self->data, new_capacity * sizeof(T));   \
+                                                                               \
+    if (new_data == NULL) {                                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->data = new_data;                                                     \
+    self->capacity = new_capacity;                                             \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Defines the `mvector` structure with the standard library
+ * allocator, see `MVECTOR_WITH_ALLOC`.
+ */
+#define MVECTOR(ID, T) MVECTOR_WITH_ALLOC(ID, T, m_stdlib)
+
+/**
+ * @brief Function to check if a vector object is empty or not. A `NULL`
+ * vector is also considered as an empty vector.
+ */
+#define MVECTOR_EMPTY(ID, T)                                                   \
+  mbool_t ID##_mvector_empty(const ID##_mvector_ptr_t *const self) {           \
+    if ((self == NULL) || (self->size == 0)) {                                 \
+      return mtrue;                                                            \
+    }                                                                          \
+                                                                               \
+    return mfalse;                                                             \
+  }
+
+/**
+ * @brief Get the vector size object. If vector is not allocated then function
+ * will return SIZE_MAX value.
+ */
+#define MVECTOR_SIZE(ID, T)                                                    \
+  size_t ID##_mvector_size(const ID##_mvector_ptr_t *const self) {             \
+    if (self == NULL) {                                                        \
+      return SIZE_MAX;                                                         \
+    }                                                                          \
+                                                                               \
+    return self->size;                                                         \
+  }
+
+/**
+ * @brief Get the raw array of the vector, it may be sorted or searched in
+ * place. The pointer is valid until the next call that changes the capacity,
+ * the function returns `NULL` if nothing is allocated.
+ */
+#define MVECTOR_DATA(ID, T)                                                    \
+  T *ID##_mvector_data(const ID##_mvector_ptr_t *const self) {                 \
+    if (self == NULL) {                                                        \
+      return NULL;                                                             \
+    }                                                                          \
+                                                                               \
+    return self->data;                                                         \
+  }
+
+/**
+ * @brief Get the element from the `data_index` position of the vector, stored
+ * in an accumulator, the accumulator should not be NULL.
+ */
+#define MVECTOR_AT(ID, T)                                                      \
+  merr_t ID##_mvector_at(const ID##_mvector_ptr_t *const self,                 \
+                         size_t data_index, T *const acc) {                    \
+    if ((self == NULL) || (acc == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (data_index >= self->size) {                                            \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    *acc = self->data[data_index];                                             \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Preallocates the array of the vector for at least `capacity`
+ * elements, the capacity never decreases.
+ */
+#define MVECTOR_RESERVE(ID, T)                                                 \
+  merr_t ID##_mvector_reserve(const ID##_mvector_t self, size_t capacity) {    \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (capacity <= self->capacity) {                                          \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    if (capacity > SIZE_MAX / sizeof(T)) {                                     \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    T *new_data =                                                              \
+        ID##_internal_mvector_realloc(self->data, capacity * sizeof(T));       \
+                                                                               \
+    if (new_data == NULL) {                                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->data = new_data;                                                     \
+    self->capacity = capacity;                                                 \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Reduces the capacity of the vector to its size, an empty vector
+ * frees the array.
+ */
+#define MVECTOR_SHRINK(ID, T)                                                  \
+  merr_t ID##_mvector_shrink_to_fit(const ID##_mvector_t self) {               \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size == self->capacity) {                                        \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      ID##_internal_mvector_free(self->data);                                  \
+      self->data = NULL;                                                       \
+      self->capacity = 0;                                                      \
+                                                                               \
+      return M_OK;                                                             \
+    }                                                                          \
+                                                                               \
+    T *new_data =                                                              \
+        ID##_internal_mvector_realloc(self->data, self->size * sizeof(T));     \
+                                                                               \
+    if (new_data == NULL) {                                                    \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    self->data = new_data;                                                     \
+    self->capacity = self->size;                                               \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Inserts an element to the end of the vector, the array doubles when
+ * it is full.
+ */
+#define MVECTOR_PUSH(ID, T)                                                    \
+  merr_t ID##_mvector_push(const ID##_mvector_t self, T data) {                \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size == self->capacity) {                                        \
+      merr_t err = ID##_mvector_internal_grow(self, self->size + 1);           \
+                                                                               \
+      if (err != M_OK) {                                                       \
+        return err;                                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    self->data[(self->size)++] = data;                                         \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Inserts an element at the `data_index` position of the vector and
+ * shifts the next elements to the right. If the index is greater than the size
+ * the element is inserted at the end.
+ */
+#define MVECTOR_PUSH_IDX(ID, T)                                                \
+  merr_t ID##_mvector_push_idx(const ID##_mvector_t self, T data,              \
+                               size_t data_index) {                            \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size == self->capacity) {                                        \
+      merr_t err = ID##_mvector_internal_grow(self, self->size + 1);           \
+                                                                               \
+      if (err != M_OK) {                                                       \
+        return err;                                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    if (data_index > self->size) {                                             \
+      data_index = self->size;                                                 \
+    }                                                                          \
+                                                                               \
+    memmove(&self->data[data_index + 1], &self->data[data_index],              \
+            (self->size - data_index) * sizeof(T));                            \
+                                                                               \
+    self->data[data_index] = data;                                             \
+    ++(self->size);                                                            \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Copies `number_of_elem` elements from an array to the end of the
+ * vector, the array grows at most once.
+ */
+#define MVECTOR_APPEND(ID, T)                                                  \
+  merr_t ID##_mvector_append(const ID##_mvector_t self, const T *const arr,    \
+                             size_t number_of_elem) {                          \
+    if ((self == NULL) || (arr == NULL)) {                                     \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (number_of_elem > SIZE_MAX - self->size) {                              \
+      return M_REALLOC_FAILED;                                                 \
+    }                                                                          \
+                                                                               \
+    merr_t err = ID##_mvector_internal_grow(self, self->size + number_of_elem);\
+                                                                               \
+    if (err != M_OK) {                                                         \
+      return err;                                                              \
+    }                                                                          \
+                                                                               \
+    memcpy(&self->data[self->size], arr, number_of_elem * sizeof(T));          \
+    self->size += number_of_elem;                                              \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Removes the last element from the vector object, or returs an error
+ * if the vector was empty or `NULL`. The capacity is not changed.
+ */
+#define MVECTOR_POP(ID, T)                                                     \
+  merr_t ID##_mvector_pop(const ID##_mvector_t self) {                         \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      return M_POP_FROM_EMPTY;                                                 \
+    }                                                                          \
+                                                                               \
+    --(self->size);                                                            \
+                                                                               \
+    if (self->frd != NULL) {                                                   \
+      self->frd(&self->data[self->size]);                                      \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Removes the elements between two indexes (both included) and shifts
+ * the rest of the vector to the left. If the right index is greater than the
+ * size, all elements from the left index to the end are removed.
+ */
+#define MVECTOR_ERASE(ID, T)                                                   \
+  merr_t ID##_mvector_erase(const ID##_mvector_t self, size_t left_index,      \
+                            size_t right_index) {                              \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      return M_EMPTY_STRUCTURE;                                                \
+    }                                                                          \
+                                                                               \
+    if (left_index > right_index) {                                            \
+      size_t temp = left_index;                                                \
+      left_index = right_index;                                                \
+      right_index = temp;                                                      \
+    }                                                                          \
+                                                                               \
+    if (left_index >= self->size) {                                            \
+      return M_IDX_OVERFLOW;                                                   \
+    }                                                                          \
+                                                                               \
+    if (right_index >= self->size) {                                           \
+      right_index = self->size - 1;                                            \
+    }                                                                          \
+                                                                               \
+    if (self->frd != NULL) {                                                   \
+      for (size_t iter = left_index; iter <= right_index; ++iter) {            \
+        self->frd(&self->data[iter]);                                          \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    memmove(&self->data[left_index], &self->data[right_index + 1],             \
+            (self->size - right_index - 1) * sizeof(T));                       \
+                                                                               \
+    self->size -= right_index - left_index + 1;                                \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Traverses the vector and do action(basically it is used for printing
+ * the vector) on all data, from the first element to the last one.
+ */
+#define MVECTOR_TRAVERSE(ID, T)                                                \
+  ACTION_FUNC(ID, T)                                                           \
+                                                                               \
+  merr_t ID##_mvector_traverse(const ID##_mvector_ptr_t *self,                 \
+                               ID##_action_func action) {                      \
+    if (self == NULL) {                                                        \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (action == NULL) {                                                      \
+      return M_NULL_ACTION;                                                    \
+    }                                                                          \
+                                                                               \
+    if (self->size == 0) {                                                     \
+      printf("[ ]\n");                                                         \
+    } else {                                                                   \
+      printf("[");                                                             \
+                                                                               \
+      for (size_t iter = 0; iter < self->size; ++iter) {                       \
+        action(&self->data[iter]);                                             \
+      }                                                                        \
+                                                                               \
+      printf(" ]");                                                            \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
+/**
+ * @brief Adds the all API for the `mvector_t` structure. You will not be always
+ * need to use all the API, in this case you must be sure that you call
+ * `MVECTOR` for definition of the vector, any other macro definitions are to
+ * bring new functionalities. The code length may be reduced a lot if you do
+ * not call `MVECTOR_ALL`, the code duplicated when calling `MVECTOR_ALL` for
+ * different ids or different types. The ID protocol is used when different
+ * files want to have the same two typed structures in order to avoid name
+ * collisions.
+ */
+#define MVECTOR_ALL_WITH_ALLOC(ID, T, ALLOC)                                   \
+  MVECTOR_WITH_ALLOC(ID, T, ALLOC)                                             \
+  MVECTOR_TRAVERSE(ID, T)                                                      \
+  MVECTOR_EMPTY(ID, T)                                                         \
+  MVECTOR_SIZE(ID, T)                                                          \
+  MVECTOR_DATA(ID, T)                                                          \
+  MVECTOR_AT(ID, T)                                                            \
+  MVECTOR_RESERVE(ID, T)                                                       \
+  MVECTOR_SHRINK(ID, T)                                                        \
+  MVECTOR_PUSH(ID, T)                                                          \
+  MVECTOR_PUSH_IDX(ID, T)                                                      \
+  MVECTOR_APPEND(ID, T)                                                        \
+  MVECTOR_POP(ID, T)                                                           \
+  MVECTOR_ERASE(ID, T)
+
+/**
+ * @brief Adds the all API for the `mvector` structure with the standard
+ * library allocator, see `MVECTOR_ALL_WITH_ALLOC`.
+ */
+#define MVECTOR_ALL(ID, T) MVECTOR_ALL_WITH_ALLOC(ID, T, m_stdlib)
+
+#endif /* MACROS_GENERICS_VECTOR_UTILS_H_ */
@@ -0,0 +1,271 @@
+/**
+ * @file bench.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *  
+ */
+
+#include "./bench.h"
+#include <math.h>
+#include <time.h>
+
+/**
+ * @brief Number of results already printed, used to separate the JSON
+ * objects with commas.
+ * 
+ */
+static size_t printed_results = 0;
+
+/**
+ * @brief Reads the monotonic clock.
+ * 
+ * @return uint64_t the current time in nanoseconds.
+ */
+uint64_t bench_now_ns(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Gets the name of a keys distribution as printed in the results.
+ * 
+ * @param dist keys distribution.
+ * @return const char* the name of the distribution.
+ */
+const char* bench_dist_name(bench_dist_t dist) {
+    switch (dist) {
+        case BENCH_SEQUENTIAL:
+            return "sequential";
+        case BENCH_RANDOM:
+            return "random";
+        case BENCH_ZIPF:
+            return "zipf";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @brief Generates the next pseudo random number with the splitmix64
+ * generator, the benchmarks must not depend on the quality of rand().
+ * 
+ * @param state pointer to the generator state.
+ * @return uint64_t the next pseudo random number.
+ */
+static uint64_t bench_random(uint64_t * const state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Generates the keys of a benchmark case, the same seed always
+ * generates the same keys, so two runs of the suite are comparable.
+ * The zipf keys are drawn with the method of Gray et al. (the one used
+ * by YCSB) and the ranks are mapped to a random permutation, so that the
+ * hot keys are not neighbours.
+ * 
+ * @param size number of keys.
+ * @param dist keys distribution.
+ * @param seed seed of the pseudo random generator.
+ * @return int* the allocated array of keys, NULL if the allocation failed.
+ */
+int* bench_make_keys(size_t size, bench_dist_t dist, uint64_t seed) {
+    int *keys = malloc(size * sizeof(*keys));
+
+    if (NULL == keys) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        keys[i] = (int)i;
+    }
+
+    if (BENCH_SEQUENTIAL == dist) {
+        return keys;
+    }
+
+    uint64_t state = seed;
+
+    for (size_t i = size; i > 1; --i) {
+        size_t j = (size_t)(bench_random(&state) % i);
+        int temp = keys[i - 1];
+
+        keys[i - 1] = keys[j];
+        keys[j] = temp;
+    }
+
+    if (BENCH_RANDOM == dist) {
+        return keys;
+    }
+
+    int *ranks = malloc(size * sizeof(*ranks));
+
+    if (NULL == ranks) {
+        free(keys);
+        return NULL;
+    }
+
+    const double theta = 0.99;
+    double zetan = 0.0;
+
+    for (size_t i = 1; i <= size; ++i) {
+        zetan += 1.0 / pow((double)i, theta);
+    }
+
+    double zeta2 = 1.0 + 1.0 / pow(2.0, theta);
+    double alpha = 1.0 / (1.0 - theta);
+    double eta = (1.0 - pow(2.0 / (double)size, 1.0 - theta)) / (1.0 - zeta2 / zetan);
+
+    for (size_t i = 0; i < size; ++i) {
+        double u = (double)(bench_random(&state) >> 11) * (1.0 / 9007199254740992.0);
+        double uz = u * zetan;
+        size_t rank = 0;
+
+        if (uz < 1.0) {
+            rank = 0;
+        } else if (uz < zeta2) {
+            rank = 1;
+        } else {
+            rank = (size_t)((double)size * pow(eta * u - eta + 1.0, alpha));
+        }
+
+        ranks[i] = keys[(rank < size) ? rank : size - 1];
+    }
+
+    free(keys);
+
+    return ranks;
+}
+
+/**
+ * @brief Checks if a case was selected on the command line.
+ * 
+ * @param config options of the run.
+ * @param name name of the container or of the sort.
+ * @return int 1 if the case must run, 0 otherwise.
+ */
+int bench_selected(const bench_config_t * const config, const char *name) {
+    return (NULL == config->filter) || (0 == strcmp(config->filter, name));
+}
+
+/**
+ * @brief Prints the result of one case as a JSON object.
+ * 
+ * @param group "container" or "sort".
+ * @param name name of the container or of the sort.
+ * @param op timed operation.
+ * @param dist keys distribution.
+ * @param size number of elements.
+ * @param ops number of timed operations.
+ * @param ns best time of the operations in nanoseconds.
+ */
+void bench_report(const char *group, const char *name, const char *op, bench_dist_t dist, size_t size, size_t ops, uint64_t ns) {
+    printf("%s\n    { \"group\": \"%s\", \"name\": \"%s\", \"op\": \"%s\", \"dist\": \"%s\", "
+           "\"size\": %zu, \"ops\": %zu, \"total_ns\": %llu, \"ns_per_op\": %.2f }",
+           (0 == printed_results) ? "" : ",", group, name, op, bench_dist_name(dist),
+           size, ops, (unsigned long long)ns, (0 == ops) ? 0.0 : (double)ns / (double)ops);
+
+    ++printed_results;
+    fflush(stdout);
+}
+
+/**
+ * @brief Reads a size from the command line, accepts "1e6" as well as "1000000".
+ * 
+ * @param str text to read.
+ * @return size_t the size, or 0 if the text is not a positive number.
+ */
+static size_t bench_parse_size(const char *str) {
+    char *end = NULL;
+    double value = strtod(str, &end);
+
+    if ((end == str) || ('\0' != *end) || (value < 1.0) || (value > 1e12)) {
+        return 0;
+    }
+
+    return (size_t)value;
+}
+
+/**
+ * @brief Prints the options of the benchmark.
+ * 
+ * @param program name of the program.
+ */
+static void bench_usage(const char *program) {
+    fprintf(stderr,
+            "Usage: %s [--min SIZE] [--max SIZE] [--repeats N] [--linear N] [--only NAME]\n"
+            "    --min SIZE      smallest number of elements (default 1e3)\n"
+            "    --max SIZE      greatest number of elements (default 1e6, up to 1e8)\n"
+            "    --repeats N     runs of every case, the best one is reported (default 3)\n"
+            "    --linear N      finds and deletes timed on the linear containers (default 1000)\n"
+            "    --only NAME     runs only one container or sort\n",
+            program);
+}
+
+/**
+ * @brief Runs the containers and sorts benchmarks over the sizes
+ * min, 10 * min, ... max and prints the results as one JSON document.
+ * 
+ */
+int main(int argc, char *argv[]) {
+    bench_config_t config = { 1000, 1000000, 3, 1000, NULL };
+
+    for (int i = 1; i < argc; ++i) {
+        if ((i + 1 < argc) && (0 == strcmp(argv[i], "--min"))) {
+            config.min_size = bench_parse_size(argv[++i]);
+        } else if ((i + 1 < argc) && (0 == strcmp(argv[i], "--max"))) {
+            config.max_size = bench_parse_size(argv[++i]);
+        } else if ((i + 1 < argc) && (0 == strcmp(argv[i], "--repeats"))) {
+            config.repeats = bench_parse_size(argv[++i]);
+        } else if ((i + 1 < argc) && (0 == strcmp(argv[i], "--linear"))) {
+            config.linear_queries = bench_parse_size(argv[++i]);
+        } else if ((i + 1 < argc) && (0 == strcmp(argv[i], "--only"))) {
+            config.filter = argv[++i];
+        } else {
+            bench_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((0 == config.min_size) || (config.max_size < config.min_size) ||
+        (0 == config.repeats) || (0 == config.linear_queries)) {
+        bench_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    printf("{\n  \"suite\": \"libdstruc\",\n  \"compiler\": \"%s\",\n", __VERSION__);
+    printf("  \"min_size\": %zu,\n  \"max_size\": %zu,\n  \"repeats\": %zu,\n",
+           config.min_size, config.max_size, config.repeats);
+    printf("  \"results\": [");
+
+    bench_containers(&config);
+    bench_sorts(&config);
+
+    printf("\n  ]\n}\n");
+
+    return EXIT_SUCCESS;
+}
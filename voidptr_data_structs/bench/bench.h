@@ -0,0 +1,69 @@
+/**
+ * @file bench.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *  
+ */
+
+#ifndef SCL_BENCH_H_
+#define SCL_BENCH_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../src/include/scl_datastruc.h"
+
+/**
+ * @brief Distributions of the keys given to the benchmarks. The sequential
+ * keys are 0, 1, ..., n - 1, the random keys are a random permutation of
+ * them and the zipf keys are n draws with a Zipf law (theta = 0.99) over
+ * the same keys, so a few keys repeat very often.
+ * 
+ */
+typedef enum bench_dist_s {
+    BENCH_SEQUENTIAL    = 0,
+    BENCH_RANDOM        = 1,
+    BENCH_ZIPF          = 2,
+    BENCH_DISTS         = 3
+} bench_dist_t;
+
+/**
+ * @brief Options of a benchmark run, read from the command line.
+ * 
+ */
+typedef struct bench_config_s {
+    size_t      min_size;               /* Smallest number of elements */
+    size_t      max_size;               /* Greatest number of elements */
+    size_t      repeats;                /* Runs of every case, the best one is reported */
+    size_t      linear_queries;         /* Finds and deletes timed on the linear containers */
+    const char  *filter;                /* Runs only the cases with this name, NULL for all */
+} bench_config_t;
+
+uint64_t            bench_now_ns            (void);
+const char*         bench_dist_name         (bench_dist_t dist);
+int*                bench_make_keys         (size_t size, bench_dist_t dist, uint64_t seed);
+int                 bench_selected          (const bench_config_t * const config, const char *name);
+void                bench_report            (const char *group, const char *name, const char *op, bench_dist_t dist, size_t size, size_t ops, uint64_t ns);
+
+void                bench_containers        (const bench_config_t * const config);
+void                bench_sorts             (const bench_config_t * const config);
+
+#endif /* SCL_BENCH_H_ */
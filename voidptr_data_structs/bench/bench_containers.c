@@ -0,0 +1,672 @@
+/**
+ * @file bench_containers.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *  
+ */
+
+#include "./bench.h"
+
+/**
+ * @brief Sum of the elements visited by the traversals, read after every
+ * traversal so the compiler can not drop the visits.
+ * 
+ */
+static volatile size_t bench_visited = 0;
+
+/**
+ * @brief Action given to the traversals of the containers.
+ * 
+ * @param data visited element.
+ */
+static void bench_visit(void * const data) {
+    bench_visited += (size_t)*(const int *)data;
+}
+
+/**
+ * @brief Operations of a container used by the benchmarks, every
+ * container is wrapped by a few small functions working on int keys.
+ * An operation that the container does not support is NULL.
+ * 
+ */
+typedef struct bench_container_s {
+    const char *name;                                           /* Name printed in the results */
+    int linear;                                                 /* Finds and deletes cost O(n) */
+    int degenerates_on_sorted;                                  /* Sorted keys make the operations O(n) */
+    void* (*create)(size_t size);                               /* Creates an empty container */
+    void (*destroy)(void *container);                           /* Frees the container */
+    scl_error_t (*insert)(void *container, const int *key);     /* Inserts one key */
+    const void* (*find)(void *container, const int *key);       /* Finds one key */
+    scl_error_t (*erase)(void *container, const int *key);      /* Deletes one key, or the next element */
+    void (*iterate)(void *container);                           /* Visits every element */
+} bench_container_t;
+
+/**
+ * @brief Adapters of the `avl` container used by the benchmarks.
+ * 
+ */
+static void* bench_avl_create(size_t size) {
+    (void)size;
+
+    return create_avl(&compare_int, NULL, sizeof(int));
+}
+
+static void bench_avl_destroy(void *container) {
+    free_avl(container);
+}
+
+static scl_error_t bench_avl_insert(void *container, const int *key) {
+    avl_tree_t *c = container;
+
+    return avl_insert(c, key);
+}
+
+static const void* bench_avl_find(void *container, const int *key) {
+    avl_tree_t *c = container;
+
+    return avl_find_data(c, key);
+}
+
+static scl_error_t bench_avl_erase(void *container, const int *key) {
+    avl_tree_t *c = container;
+
+    return avl_delete(c, key);
+}
+
+static void bench_avl_iterate(void *container) {
+    avl_traverse_inorder(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `rbk` container used by the benchmarks.
+ * 
+ */
+static void* bench_rbk_create(size_t size) {
+    (void)size;
+
+    return create_rbk(&compare_int, NULL, sizeof(int));
+}
+
+static void bench_rbk_destroy(void *container) {
+    free_rbk(container);
+}
+
+static scl_error_t bench_rbk_insert(void *container, const int *key) {
+    rbk_tree_t *c = container;
+
+    return rbk_insert(c, key);
+}
+
+static const void* bench_rbk_find(void *container, const int *key) {
+    rbk_tree_t *c = container;
+
+    return rbk_find_data(c, key);
+}
+
+static scl_error_t bench_rbk_erase(void *container, const int *key) {
+    rbk_tree_t *c = container;
+
+    return rbk_delete(c, key);
+}
+
+static void bench_rbk_iterate(void *container) {
+    rbk_traverse_inorder(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `bst` container used by the benchmarks.
+ * 
+ */
+static void* bench_bst_create(size_t size) {
+    (void)size;
+
+    return create_bst(&compare_int, NULL, sizeof(int));
+}
+
+static void bench_bst_destroy(void *container) {
+    free_bst(container);
+}
+
+static scl_error_t bench_bst_insert(void *container, const int *key) {
+    bst_tree_t *c = container;
+
+    return bst_insert(c, key);
+}
+
+static const void* bench_bst_find(void *container, const int *key) {
+    bst_tree_t *c = container;
+
+    return bst_find_data(c, key);
+}
+
+static scl_error_t bench_bst_erase(void *container, const int *key) {
+    bst_tree_t *c = container;
+
+    return bst_delete(c, key);
+}
+
+static void bench_bst_iterate(void *container) {
+    bst_traverse_inorder(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `bplus_tree` container used by the benchmarks.
+ * 
+ */
+static void* bench_bplus_tree_create(size_t size) {
+    (void)size;
+
+    return create_bplus_tree(&compare_int, NULL, sizeof(int), 0);
+}
+
+static void bench_bplus_tree_destroy(void *container) {
+    free_bplus_tree(container);
+}
+
+static scl_error_t bench_bplus_tree_insert(void *container, const int *key) {
+    bplus_tree_t *c = container;
+
+    return bplus_tree_insert(c, key);
+}
+
+static const void* bench_bplus_tree_find(void *container, const int *key) {
+    bplus_tree_t *c = container;
+
+    return bplus_tree_find_data(c, key);
+}
+
+static scl_error_t bench_bplus_tree_erase(void *container, const int *key) {
+    bplus_tree_t *c = container;
+
+    return bplus_tree_delete(c, key);
+}
+
+static void bench_bplus_tree_iterate(void *container) {
+    bplus_tree_traverse(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `skip_list` container used by the benchmarks.
+ * 
+ */
+static void* bench_skip_list_create(size_t size) {
+    (void)size;
+
+    return create_skip_list(&compare_int, NULL, sizeof(int));
+}
+
+static void bench_skip_list_destroy(void *container) {
+    free_skip_list(container);
+}
+
+static scl_error_t bench_skip_list_insert(void *container, const int *key) {
+    skip_list_t *c = container;
+
+    return skip_list_insert(c, key);
+}
+
+static const void* bench_skip_list_find(void *container, const int *key) {
+    skip_list_t *c = container;
+
+    return skip_list_find_data(c, key);
+}
+
+static scl_error_t bench_skip_list_erase(void *container, const int *key) {
+    skip_list_t *c = container;
+
+    return skip_list_delete_data(c, key);
+}
+
+static void bench_skip_list_iterate(void *container) {
+    skip_list_traverse(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `hash_table` container used by the benchmarks.
+ * 
+ */
+static void* bench_hash_table_create(size_t size) {
+    (void)size;
+
+    return create_hash_table(0, &hash_int, &compare_int, &compare_int, NULL, NULL, sizeof(int), sizeof(int));
+}
+
+static void bench_hash_table_destroy(void *container) {
+    free_hash_table(container);
+}
+
+static scl_error_t bench_hash_table_insert(void *container, const int *key) {
+    hash_table_t *c = container;
+
+    return hash_table_insert(c, key, key);
+}
+
+static const void* bench_hash_table_find(void *container, const int *key) {
+    hash_table_t *c = container;
+
+    return hash_table_find_data(c, key);
+}
+
+static scl_error_t bench_hash_table_erase(void *container, const int *key) {
+    hash_table_t *c = container;
+
+    return hash_table_delete_key(c, key);
+}
+
+/**
+ * @brief Adapters of the `flat_hash_table` container used by the benchmarks.
+ * 
+ */
+static void* bench_flat_hash_table_create(size_t size) {
+    (void)size;
+
+    return create_flat_hash_table(0, &hash_int, &compare_int, &compare_int, NULL, NULL, sizeof(int), sizeof(int));
+}
+
+static void bench_flat_hash_table_destroy(void *container) {
+    free_flat_hash_table(container);
+}
+
+static scl_error_t bench_flat_hash_table_insert(void *container, const int *key) {
+    flat_hash_table_t *c = container;
+
+    return flat_hash_table_insert(c, key, key);
+}
+
+static const void* bench_flat_hash_table_find(void *container, const int *key) {
+    flat_hash_table_t *c = container;
+
+    return flat_hash_table_find_data(c, key);
+}
+
+static scl_error_t bench_flat_hash_table_erase(void *container, const int *key) {
+    flat_hash_table_t *c = container;
+
+    return flat_hash_table_delete_key(c, key);
+}
+
+static void bench_flat_hash_table_iterate(void *container) {
+    flat_hash_table_traverse(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `list` container used by the benchmarks.
+ * 
+ */
+static void* bench_list_create(size_t size) {
+    (void)size;
+
+    return create_list(&compare_int, NULL, sizeof(int));
+}
+
+static void bench_list_destroy(void *container) {
+    free_list(container);
+}
+
+static scl_error_t bench_list_insert(void *container, const int *key) {
+    list_t *c = container;
+
+    return list_insert(c, key);
+}
+
+static const void* bench_list_find(void *container, const int *key) {
+    list_t *c = container;
+
+    return list_find_data(c, key);
+}
+
+static scl_error_t bench_list_erase(void *container, const int *key) {
+    list_t *c = container;
+
+    return list_delete_data(c, key);
+}
+
+static void bench_list_iterate(void *container) {
+    list_traverse(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `dlist` container used by the benchmarks.
+ * 
+ */
+static void* bench_dlist_create(size_t size) {
+    (void)size;
+
+    return create_dlist(&compare_int, NULL, sizeof(int));
+}
+
+static void bench_dlist_destroy(void *container) {
+    free_dlist(container);
+}
+
+static scl_error_t bench_dlist_insert(void *container, const int *key) {
+    dlist_t *c = container;
+
+    return dlist_insert(c, key);
+}
+
+static const void* bench_dlist_find(void *container, const int *key) {
+    dlist_t *c = container;
+
+    return dlist_find_data(c, key);
+}
+
+static scl_error_t bench_dlist_erase(void *container, const int *key) {
+    dlist_t *c = container;
+
+    return dlist_delete_data(c, key);
+}
+
+static void bench_dlist_iterate(void *container) {
+    dlist_traverse(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `vector` container used by the benchmarks.
+ * 
+ */
+static void* bench_vector_create(size_t size) {
+    (void)size;
+
+    return create_vector(NULL, sizeof(int));
+}
+
+static void bench_vector_destroy(void *container) {
+    free_vector(container);
+}
+
+static scl_error_t bench_vector_insert(void *container, const int *key) {
+    vector_t *c = container;
+
+    return vector_push_back(c, key);
+}
+
+static scl_error_t bench_vector_erase(void *container, const int *key) {
+    vector_t *c = container;
+    (void)key;
+
+    return vector_pop_back(c);
+}
+
+static void bench_vector_iterate(void *container) {
+    vector_traverse(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `queue` container used by the benchmarks.
+ * 
+ */
+static void* bench_queue_create(size_t size) {
+    (void)size;
+
+    return create_queue(NULL, sizeof(int));
+}
+
+static void bench_queue_destroy(void *container) {
+    free_queue(container);
+}
+
+static scl_error_t bench_queue_insert(void *container, const int *key) {
+    queue_t *c = container;
+
+    return queue_push(c, key);
+}
+
+static scl_error_t bench_queue_erase(void *container, const int *key) {
+    queue_t *c = container;
+    (void)key;
+
+    return queue_pop(c);
+}
+
+/**
+ * @brief Adapters of the `stack` container used by the benchmarks.
+ * 
+ */
+static void* bench_stack_create(size_t size) {
+    (void)size;
+
+    return create_stack(NULL, sizeof(int));
+}
+
+static void bench_stack_destroy(void *container) {
+    free_stack(container);
+}
+
+static scl_error_t bench_stack_insert(void *container, const int *key) {
+    sstack_t *c = container;
+
+    return stack_push(c, key);
+}
+
+static scl_error_t bench_stack_erase(void *container, const int *key) {
+    sstack_t *c = container;
+    (void)key;
+
+    return stack_pop(c);
+}
+
+/**
+ * @brief Adapters of the `priority_queue` container used by the benchmarks.
+ * 
+ */
+static void* bench_priority_queue_create(size_t size) {
+    return create_priority_queue(size, &compare_int, &compare_int, NULL, NULL, sizeof(int), sizeof(int));
+}
+
+static void bench_priority_queue_destroy(void *container) {
+    free_priority_queue(container);
+}
+
+static scl_error_t bench_priority_queue_insert(void *container, const int *key) {
+    priority_queue_t *c = container;
+
+    return pri_queue_push(c, key, key);
+}
+
+static scl_error_t bench_priority_queue_erase(void *container, const int *key) {
+    priority_queue_t *c = container;
+    (void)key;
+
+    return pri_queue_pop(c);
+}
+
+static void bench_priority_queue_iterate(void *container) {
+    pri_queue_traverse(container, &bench_visit);
+}
+
+/**
+ * @brief Adapters of the `flat_priority_queue` container used by the benchmarks.
+ * 
+ */
+static void* bench_flat_priority_queue_create(size_t size) {
+    return create_flat_priority_queue(size, 4, &compare_int, NULL, NULL, sizeof(int), 0);
+}
+
+static void bench_flat_priority_queue_destroy(void *container) {
+    free_flat_priority_queue(container);
+}
+
+static scl_error_t bench_flat_priority_queue_insert(void *container, const int *key) {
+    flat_priority_queue_t *c = container;
+
+    return flat_pri_queue_push(c, key, key);
+}
+
+static scl_error_t bench_flat_priority_queue_erase(void *container, const int *key) {
+    flat_priority_queue_t *c = container;
+    (void)key;
+
+    return flat_pri_queue_pop(c);
+}
+
+/**
+ * @brief Containers timed by the suite.
+ * 
+ */
+static const bench_container_t bench_containers_table[] = {
+    { "avl", 0, 0, &bench_avl_create, &bench_avl_destroy, &bench_avl_insert,
+      &bench_avl_find, &bench_avl_erase, &bench_avl_iterate },
+    { "rbk", 0, 0, &bench_rbk_create, &bench_rbk_destroy, &bench_rbk_insert,
+      &bench_rbk_find, &bench_rbk_erase, &bench_rbk_iterate },
+    { "bst", 0, 1, &bench_bst_create, &bench_bst_destroy, &bench_bst_insert,
+      &bench_bst_find, &bench_bst_erase, &bench_bst_iterate },
+    { "bplus_tree", 0, 0, &bench_bplus_tree_create, &bench_bplus_tree_destroy, &bench_bplus_tree_insert,
+      &bench_bplus_tree_find, &bench_bplus_tree_erase, &bench_bplus_tree_iterate },
+    { "skip_list", 0, 0, &bench_skip_list_create, &bench_skip_list_destroy, &bench_skip_list_insert,
+      &bench_skip_list_find, &bench_skip_list_erase, &bench_skip_list_iterate },
+    { "hash_table", 0, 0, &bench_hash_table_create, &bench_hash_table_destroy, &bench_hash_table_insert,
+      &bench_hash_table_find, &bench_hash_table_erase, NULL },
+    { "flat_hash_table", 0, 0, &bench_flat_hash_table_create, &bench_flat_hash_table_destroy, &bench_flat_hash_table_insert,
+      &bench_flat_hash_table_find, &bench_flat_hash_table_erase, &bench_flat_hash_table_iterate },
+    { "list", 1, 0, &bench_list_create, &bench_list_destroy, &bench_list_insert,
+      &bench_list_find, &bench_list_erase, &bench_list_iterate },
+    { "dlist", 1, 0, &bench_dlist_create, &bench_dlist_destroy, &bench_dlist_insert,
+      &bench_dlist_find, &bench_dlist_erase, &bench_dlist_iterate },
+    { "vector", 0, 0, &bench_vector_create, &bench_vector_destroy, &bench_vector_insert,
+      NULL, &bench_vector_erase, &bench_vector_iterate },
+    { "queue", 0, 0, &bench_queue_create, &bench_queue_destroy, &bench_queue_insert,
+      NULL, &bench_queue_erase, NULL },
+    { "stack", 0, 0, &bench_stack_create, &bench_stack_destroy, &bench_stack_insert,
+      NULL, &bench_stack_erase, NULL },
+    { "priority_queue", 0, 0, &bench_priority_queue_create, &bench_priority_queue_destroy, &bench_priority_queue_insert,
+      NULL, &bench_priority_queue_erase, &bench_priority_queue_iterate },
+    { "flat_priority_queue", 0, 0, &bench_flat_priority_queue_create, &bench_flat_priority_queue_destroy, &bench_flat_priority_queue_insert,
+      NULL, &bench_flat_priority_queue_erase, NULL }
+};
+
+/**
+ * @brief Times the operations of one container on one set of keys, every
+ * operation is run `repeats` times on a fresh container and the best time
+ * is reported. The finds and deletes of the linear containers are limited
+ * to `linear_queries` keys spread over the container.
+ * 
+ * @param config options of the run.
+ * @param bench container to time.
+ * @param keys keys inserted, looked up and deleted.
+ * @param size number of keys.
+ * @param dist distribution of the keys.
+ */
+static void bench_container(const bench_config_t * const config, const bench_container_t *bench, const int *keys, size_t size, bench_dist_t dist) {
+    uint64_t best[4] = { UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX };
+    size_t queries = size;
+
+    if (bench->linear && (queries > config->linear_queries)) {
+        queries = config->linear_queries;
+    }
+
+    for (size_t run = 0; run < config->repeats; ++run) {
+        void *container = bench->create(size);
+
+        if (NULL == container) {
+            fprintf(stderr, "Could not create %s of %zu elements\n", bench->name, size);
+            return;
+        }
+
+        uint64_t start = bench_now_ns();
+        for (size_t i = 0; i < size; ++i) {
+            bench->insert(container, &keys[i]);
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        best[0] = (elapsed < best[0]) ? elapsed : best[0];
+
+        if (NULL != bench->find) {
+            size_t found = 0;
+
+            start = bench_now_ns();
+            for (size_t i = 0; i < queries; ++i) {
+                found += (NULL != bench->find(container, &keys[(size_t)((uint64_t)i * size / queries)]));
+            }
+            elapsed = bench_now_ns() - start;
+            best[1] = (elapsed < best[1]) ? elapsed : best[1];
+            bench_visited += found;
+        }
+
+        if (NULL != bench->iterate) {
+            start = bench_now_ns();
+            bench->iterate(container);
+            elapsed = bench_now_ns() - start;
+            best[2] = (elapsed < best[2]) ? elapsed : best[2];
+        }
+
+        start = bench_now_ns();
+        for (size_t i = 0; i < queries; ++i) {
+            bench->erase(container, &keys[(size_t)((uint64_t)i * size / queries)]);
+        }
+        elapsed = bench_now_ns() - start;
+        best[3] = (elapsed < best[3]) ? elapsed : best[3];
+
+        bench->destroy(container);
+    }
+
+    bench_report("container", bench->name, "insert", dist, size, size, best[0]);
+
+    if (NULL != bench->find) {
+        bench_report("container", bench->name, "find", dist, size, queries, best[1]);
+    }
+
+    if (NULL != bench->iterate) {
+        bench_report("container", bench->name, "iterate", dist, size, size, best[2]);
+    }
+
+    bench_report("container", bench->name, "delete", dist, size, queries, best[3]);
+}
+
+/**
+ * @brief Times every selected container for every size and distribution.
+ * The containers that degenerate to O(n) operations on sorted keys (the
+ * unbalanced binary search tree) skip the sequential keys above 1e4 elements.
+ * 
+ * @param config options of the run.
+ */
+void bench_containers(const bench_config_t * const config) {
+    const size_t count = sizeof(bench_containers_table) / sizeof(*bench_containers_table);
+
+    for (size_t size = config->min_size; size <= config->max_size; size *= 10) {
+        for (int dist = 0; dist < BENCH_DISTS; ++dist) {
+            int *keys = bench_make_keys(size, (bench_dist_t)dist, 0x5EEDULL + size);
+
+            if (NULL == keys) {
+                fprintf(stderr, "Could not allocate %zu keys\n", size);
+                return;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                const bench_container_t *bench = &bench_containers_table[i];
+
+                if (!bench_selected(config, bench->name)) {
+                    continue;
+                }
+
+                if (bench->degenerates_on_sorted && (BENCH_SEQUENTIAL == dist) && (size > 10000)) {
+                    continue;
+                }
+
+                bench_container(config, bench, keys, size, (bench_dist_t)dist);
+            }
+
+            free(keys);
+        }
+
+        if (size > SIZE_MAX / 10) {
+            break;
+        }
+    }
+}
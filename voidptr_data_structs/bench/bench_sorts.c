@@ -0,0 +1,205 @@
+/**
+ * @file bench_sorts.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *  
+ */
+
+#include "./bench.h"
+
+/**
+ * @brief Number of threads given to the parallel sort.
+ * 
+ */
+#define BENCH_SORT_THREADS 4
+
+/**
+ * @brief Compares two ints for `qsort`, the reference of the sorts.
+ * 
+ * @param data1 pointer to the first int.
+ * @param data2 pointer to the second int.
+ * @return int -1, 0 or 1 as the first int is less than, equal to or greater than the second.
+ */
+static int bench_qsort_compare(const void *data1, const void *data2) {
+    const int a = *(const int *)data1;
+    const int b = *(const int *)data2;
+
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Sorts of the suite, every one sorts `size` ints in place, the
+ * workspace has room for `size` ints.
+ * 
+ */
+static void bench_sort_qsort(int *arr, size_t size, void *workspace) {
+    qsort(arr, size, sizeof(*arr), &bench_qsort_compare);
+}
+
+static void bench_sort_quick(int *arr, size_t size, void *workspace) {
+    quick_sort(arr, size, sizeof(*arr), &compare_int);
+}
+
+static void bench_sort_merge(int *arr, size_t size, void *workspace) {
+    merge_sort(arr, size, sizeof(*arr), &compare_int);
+}
+
+static void bench_sort_merge_bottom_up(int *arr, size_t size, void *workspace) {
+    merge_sort_bottom_up(arr, size, sizeof(*arr), &compare_int, workspace);
+}
+
+static void bench_sort_tim(int *arr, size_t size, void *workspace) {
+    tim_sort(arr, size, sizeof(*arr), &compare_int, workspace);
+}
+
+static void bench_sort_heap(int *arr, size_t size, void *workspace) {
+    heap_sort(arr, size, sizeof(*arr), &compare_int);
+}
+
+static void bench_sort_parallel(int *arr, size_t size, void *workspace) {
+    parallel_sort(arr, size, sizeof(*arr), &compare_int, BENCH_SORT_THREADS);
+}
+
+static void bench_sort_radix(int *arr, size_t size, void *workspace) {
+    uint64_t *wide = workspace;
+
+    for (size_t i = 0; i < size; ++i) {
+        wide[i] = (uint64_t)arr[i];
+    }
+
+    radix_sort(wide, size);
+
+    for (size_t i = 0; i < size; ++i) {
+        arr[i] = (int)wide[i];
+    }
+}
+
+/**
+ * @brief A sort timed by the suite.
+ * 
+ */
+typedef struct bench_sort_s {
+    const char *name;                                           /* Name printed in the results */
+    int ascending;                                              /* Sorts in increasing order */
+    void (*sort)(int *arr, size_t size, void *workspace);       /* Sorts the array */
+} bench_sort_t;
+
+/**
+ * @brief Sorts timed by the suite. The heap sort ranks the greatest
+ * element first, so it sorts in decreasing order. The radix sort copies the keys
+ * to 64 bits integers and back, the copies are part of its time.
+ * 
+ */
+static const bench_sort_t bench_sorts_table[] = {
+    { "qsort",                  1,  &bench_sort_qsort },
+    { "quick_sort",             1,  &bench_sort_quick },
+    { "merge_sort",             1,  &bench_sort_merge },
+    { "merge_sort_bottom_up",   1,  &bench_sort_merge_bottom_up },
+    { "tim_sort",               1,  &bench_sort_tim },
+    { "heap_sort",              0,  &bench_sort_heap },
+    { "parallel_sort",          1,  &bench_sort_parallel },
+    { "radix_sort",             1,  &bench_sort_radix },
+};
+
+/**
+ * @brief Checks that an array is sorted, so a broken sort is not reported
+ * as a fast one.
+ * 
+ * @param arr sorted array.
+ * @param size number of ints.
+ * @param ascending 1 for the increasing order, 0 for the decreasing one.
+ * @return int 1 if the array is sorted, 0 otherwise.
+ */
+static int bench_is_sorted(const int *arr, size_t size, int ascending) {
+    for (size_t i = 1; i < size; ++i) {
+        if (ascending ? (arr[i - 1] > arr[i]) : (arr[i - 1] < arr[i])) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Times every selected sort for every size and distribution, every
+ * sort runs `repeats` times on a fresh copy of the keys and the best time
+ * is reported.
+ * 
+ * @param config options of the run.
+ */
+void bench_sorts(const bench_config_t * const config) {
+    const size_t count = sizeof(bench_sorts_table) / sizeof(*bench_sorts_table);
+
+    for (size_t size = config->min_size; size <= config->max_size; size *= 10) {
+        int *arr = malloc(size * sizeof(*arr));
+        void *workspace = malloc(size * sizeof(uint64_t));
+
+        if ((NULL == arr) || (NULL == workspace)) {
+            fprintf(stderr, "Could not allocate %zu keys\n", size);
+            free(arr);
+            free(workspace);
+            return;
+        }
+
+        for (int dist = 0; dist < BENCH_DISTS; ++dist) {
+            int *keys = bench_make_keys(size, (bench_dist_t)dist, 0x5EEDULL + size);
+
+            if (NULL == keys) {
+                fprintf(stderr, "Could not allocate %zu keys\n", size);
+                break;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                const bench_sort_t *bench = &bench_sorts_table[i];
+                uint64_t best = UINT64_MAX;
+
+                if (!bench_selected(config, bench->name)) {
+                    continue;
+                }
+
+                for (size_t run = 0; run < config->repeats; ++run) {
+                    memcpy(arr, keys, size * sizeof(*arr));
+
+                    uint64_t start = bench_now_ns();
+                    bench->sort(arr, size, workspace);
+                    uint64_t elapsed = bench_now_ns() - start;
+
+                    best = (elapsed < best) ? elapsed : best;
+                }
+
+                if (!bench_is_sorted(arr, size, bench->ascending)) {
+                    fprintf(stderr, "%s did not sort %zu %s keys\n", bench->name, size, bench_dist_name((bench_dist_t)dist));
+                    continue;
+                }
+
+                bench_report("sort", bench->name, "sort", (bench_dist_t)dist, size, size, best);
+            }
+
+            free(keys);
+        }
+
+        free(arr);
+        free(workspace);
+
+        if (size > SIZE_MAX / 10) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#!/bin/sh
+# Builds the single header version of the library: the headers of
+# scl_datastruc.h followed by every source file under `SCL_IMPLEMENTATION`.
+# Every local include is pasted once, in the place of its first use.
+#
+# Usage: amalgamate.sh <include path> <source path> <output file>
+
+INCLUDE_PATH=$1
+SRC_PATH=$2
+OUTPUT=$3
+
+awk -v include_path="$INCLUDE_PATH" -v sources="$(ls "$SRC_PATH"/*.c)" '
+function normalize(file) {
+  while (sub(/\/\.\//, "/", file)) {
+  }
+
+  return file
+}
+
+function paste(file,    line, dir, inc) {
+  file = normalize(file)
+
+  if (file in pasted) {
+    return
+  }
+
+  pasted[file] = 1
+  dir = file
+  sub(/[^\/]*$/, "", dir)
+  printf "\n/* --- %s --- */\n\n", substr(file, length(file) - index(reverse(file), "/") + 2)
+
+  while ((getline line < file) > 0) {
+    if (line ~ /^[ \t]*#[ \t]*include[ \t]*"/) {
+      inc = line
+      sub(/^[^"]*"/, "", inc)
+      sub(/".*$/, "", inc)
+      paste(dir inc)
+      continue
+    }
+
+    print line
+  }
+
+  close(file)
+}
+
+function reverse(str,    out, i) {
+  out = ""
+
+  for (i = length(str); i > 0; --i) {
+    out = out substr(str, i, 1)
+  }
+
+  return out
+}
+
+BEGIN {
+  print "/* Single header build of the voidptr library, generated by amalgamate.sh."
+  print " * Define SCL_IMPLEMENTATION in exactly one translation unit before the"
+  print " * include to get the definitions, every other unit gets the declarations. */"
+  print ""
+  print "#ifndef SCL_DATASTRUC_SINGLE_H_"
+  print "#define SCL_DATASTRUC_SINGLE_H_"
+
+  paste(include_path "/scl_datastruc.h")
+
+  print ""
+  print "#endif /* SCL_DATASTRUC_SINGLE_H_ */"
+  print ""
+  print "#ifdef SCL_IMPLEMENTATION"
+  print "#ifndef SCL_DATASTRUC_SINGLE_IMPLEMENTATION_"
+  print "#define SCL_DATASTRUC_SINGLE_IMPLEMENTATION_"
+
+  count = split(sources, files, "\n")
+
+  for (iter = 1; iter <= count; ++iter) {
+    paste(files[iter])
+  }
+
+  print ""
+  print "#endif /* SCL_DATASTRUC_SINGLE_IMPLEMENTATION_ */"
+  print "#endif /* SCL_IMPLEMENTATION */"
+}
+' > "$OUTPUT"
@@ -31,16 +31,18 @@
 #include <stdint.h>
 #include <errno.h>
 #include "scl_config.h"
+#include "scl_mem_pool.h"
 
 /**
  * @brief Adelson-Velsky-Landis Tree Node object definition
  * 
  */
 typedef struct avl_tree_node_s {
-    void *data;                                                 /* Pointer to data */
+    void *data;                                                 /* Pointer to data, stored inline after the node */
     struct avl_tree_node_s *parent;                             /* Pointer to parent node */
     struct avl_tree_node_s *left;                               /* Pointer to left child node */
     struct avl_tree_node_s *right;                              /* Pointer to right child node */
+    size_t weight;                                              /* Sum of the counts of the subtree (kept if order_stats is set) */
     uint32_t count;                                             /* Number of nodes with the same data value */
     uint32_t height;                                            /* Height of a node */
 } avl_tree_node_t;
@@ -56,23 +58,46 @@ typedef struct avl_tree_s {
     free_func frd;                                              /* Function to free content of data */
     size_t data_size;                                           /* Length in bytes of the data data type */
     size_t size;                                                /* Size of the avl tree */
+    mem_pool_t *node_pool;                                      /* Optional pool of nodes with inline data (`NULL` if not used) */
+    uint8_t order_stats;                                        /* 1 if the nodes keep their weights, 0 otherwise */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+    SCL_STATS_MEMBER                                            /* Operation counters (only with SCL_STATS) */
 } avl_tree_t;
 
+/**
+ * @brief Cursor over the nodes of an avl tree in ascending order. The
+ * cursor moves through the parent links, so it needs no recursion and no
+ * allocation. Any insertion or deletion invalidates the cursors of the tree
+ * 
+ */
+typedef struct avl_tree_iter_s {
+    const avl_tree_t *tree;                                     /* Tree of the cursor */
+    avl_tree_node_t *node;                                      /* Current node (`nil` after the end of the tree) */
+} avl_tree_iter_t;
+
 avl_tree_t*             create_avl                          (compare_func cmp, free_func frd, size_t data_size);
 scl_error_t             free_avl                            (avl_tree_t * const __restrict__ tree);
+scl_error_t             avl_use_node_pool                   (avl_tree_t * const __restrict__ tree, size_t nodes_per_chunk);
+scl_error_t             avl_use_order_stats                 (avl_tree_t * const __restrict__ tree);
 
 scl_error_t             avl_insert                          (avl_tree_t * const __restrict__ tree, const void * __restrict__ data);
+scl_error_t             avl_build_sorted                    (avl_tree_t * const __restrict__ tree, const void * __restrict__ arr, size_t number_of_elem);
 const void*             avl_find_data                       (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*             avl_find_key                        (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp);
 int32_t                 avl_data_level                      (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 
 uint8_t                 is_avl_empty                        (const avl_tree_t * const __restrict__ tree);
 const void*             get_avl_root                        (const avl_tree_t * const __restrict__ tree);
 size_t                  get_avl_size                        (const avl_tree_t * const __restrict__ tree);
+scl_error_t             avl_memory_usage                    (const avl_tree_t * const __restrict__ tree, scl_memory_usage_t * const __restrict__ usage);
+scl_error_t             avl_get_stats                       (const avl_tree_t * const __restrict__ tree, scl_stats_t * const __restrict__ stats);
+scl_error_t             avl_reset_stats                     (avl_tree_t * const __restrict__ tree);
 
 const void*             avl_max_data                        (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 const void*             avl_min_data                        (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 
 scl_error_t             avl_delete                          (avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             avl_delete_key                      (avl_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp);
 
 const void*             avl_predecessor_data                (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 const void*             avl_successor_data                  (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
@@ -83,4 +108,26 @@ scl_error_t             avl_traverse_preorder               (const avl_tree_t *
 scl_error_t             avl_traverse_postorder              (const avl_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             avl_traverse_level                  (const avl_tree_t * const __restrict__ tree, action_func action);
 
+const void*             avl_iter_begin                      (const avl_tree_t * const __restrict__ tree, avl_tree_iter_t * const __restrict__ iter);
+const void*             avl_iter_rbegin                     (const avl_tree_t * const __restrict__ tree, avl_tree_iter_t * const __restrict__ iter);
+const void*             avl_iter_seek                       (const avl_tree_t * const __restrict__ tree, avl_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data);
+const void*             avl_iter_next                       (avl_tree_iter_t * const __restrict__ iter);
+const void*             avl_iter_prev                       (avl_tree_iter_t * const __restrict__ iter);
+const void*             avl_iter_data                       (const avl_tree_iter_t * const __restrict__ iter);
+uint32_t                avl_iter_count                      (const avl_tree_iter_t * const __restrict__ iter);
+
+const void*             avl_lower_bound                     (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*             avl_upper_bound                     (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             avl_range                           (const avl_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action);
+
+size_t                  avl_total_count                     (const avl_tree_t * const __restrict__ tree);
+const void*             avl_select                          (const avl_tree_t * const __restrict__ tree, size_t k);
+size_t                  avl_rank                            (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+
+scl_error_t             avl_join                            (avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other);
+scl_error_t             avl_split                           (avl_tree_t * const __restrict__ tree, const void * const __restrict__ data, avl_tree_t * const __restrict__ greater);
+scl_error_t             avl_union                           (avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other);
+scl_error_t             avl_intersection                    (avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other);
+scl_error_t             avl_difference                      (avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other);
+
 #endif /* AVLTREE_UTILS_H_ */
@@ -0,0 +1,150 @@
+/**
+ * @file scl_bitset.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BITSET_UTILS_H_
+#define BITSET_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/* Number of bits of one word of a bitset */
+#define BITSET_WORD_BITS 64
+
+/* Number of low bits of a value kept by a roaring container, the high bits select the container */
+#define ROARING_CHUNK_BITS 16
+
+/* Maximum cardinality of an array container, a bigger one becomes a bitmap container */
+#define ROARING_ARRAY_MAX 4096
+
+/* Number of 64 bits words of a bitmap container (2^16 bits) */
+#define ROARING_BITMAP_WORDS 1024
+
+/**
+ * @brief Dense Bitset object definition. Bit `i` is bit `i % 64` of word
+ * `i / 64`, the bits after the last one of the bitset are always zero, so
+ * the word loops need no masks
+ * 
+ */
+typedef struct bitset_s {
+    uint64_t *words;                                            /* Words holding the bits */
+    size_t size;                                                /* Number of bits of the bitset */
+    size_t number_of_words;                                     /* Number of words, (size + 63) / 64 */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} bitset_t;
+
+/**
+ * @brief Kinds of the containers of a roaring set
+ * 
+ */
+typedef enum roaring_container_kind_s {
+    ROARING_ARRAY_CONTAINER                                     = 0,    /* Sorted array of the low bits of at most ROARING_ARRAY_MAX values */
+    ROARING_BITMAP_CONTAINER                                    = 1,    /* 2^16 bits, one for every low value */
+    ROARING_RUN_CONTAINER                                       = 2     /* Sorted runs of consecutive low values */
+} roaring_container_kind_t;
+
+/**
+ * @brief Run of consecutive values of a run container, from start
+ * up to start + length (both included)
+ * 
+ */
+typedef struct roaring_run_s {
+    uint16_t start;                                             /* First low value of the run */
+    uint16_t length;                                            /* Number of values of the run minus one */
+} roaring_run_t;
+
+/**
+ * @brief Container of the values of a roaring set with the same high bits
+ * 
+ */
+typedef struct roaring_container_s {
+    void *data;                                                 /* uint16_t values, ROARING_BITMAP_WORDS words or roaring_run_t runs */
+    size_t key;                                                 /* High bits of the values (value >> ROARING_CHUNK_BITS) */
+    uint32_t cardinality;                                       /* Number of values of the container (never zero) */
+    uint32_t length;                                            /* Number of values of an array container or runs of a run container */
+    uint32_t capacity;                                          /* Number of values or runs the data can hold (unused by bitmaps) */
+    uint8_t kind;                                               /* Kind of the container, a roaring_container_kind_t */
+} roaring_container_t;
+
+/**
+ * @brief Roaring Set object definition, a compressed set of size_t values.
+ * The values are split by their high bits into chunks of 2^16 values and
+ * every chunk with values has one container, a sorted array for a few
+ * values, a bitmap for many values and (after roaring_run_optimize) runs
+ * for long sequences of consecutive values
+ * 
+ */
+typedef struct roaring_s {
+    roaring_container_t *containers;                            /* Containers sorted by their keys */
+    size_t number_of_containers;                                /* Number of containers of the set */
+    size_t capacity;                                            /* Number of containers the array can hold */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} roaring_t;
+
+bitset_t*               create_bitset                           (size_t number_of_bits);
+scl_error_t             free_bitset                             (bitset_t * const __restrict__ bs);
+scl_error_t             bitset_resize                           (bitset_t * const __restrict__ bs, size_t number_of_bits);
+
+scl_error_t             bitset_set                              (bitset_t * const __restrict__ bs, size_t index);
+scl_error_t             bitset_reset                            (bitset_t * const __restrict__ bs, size_t index);
+scl_error_t             bitset_flip                             (bitset_t * const __restrict__ bs, size_t index);
+scl_error_t             bitset_clear                            (bitset_t * const __restrict__ bs);
+uint8_t                 bitset_test                             (const bitset_t * const __restrict__ bs, size_t index);
+
+size_t                  get_bitset_size                         (const bitset_t * const __restrict__ bs);
+size_t                  bitset_count                            (const bitset_t * const __restrict__ bs);
+size_t                  bitset_rank                             (const bitset_t * const __restrict__ bs, size_t index);
+size_t                  bitset_select                           (const bitset_t * const __restrict__ bs, size_t rank);
+size_t                  bitset_next_set                         (const bitset_t * const __restrict__ bs, size_t index);
+size_t                  bitset_intersection_count               (const bitset_t * const __restrict__ bs, const bitset_t * const __restrict__ other);
+scl_error_t             bitset_memory_usage                     (const bitset_t * const __restrict__ bs, scl_memory_usage_t * const __restrict__ usage);
+
+scl_error_t             bitset_and                              (bitset_t * const __restrict__ dst, const bitset_t * const __restrict__ src);
+scl_error_t             bitset_or                               (bitset_t * const __restrict__ dst, const bitset_t * const __restrict__ src);
+scl_error_t             bitset_xor                              (bitset_t * const __restrict__ dst, const bitset_t * const __restrict__ src);
+scl_error_t             bitset_andnot                           (bitset_t * const __restrict__ dst, const bitset_t * const __restrict__ src);
+
+roaring_t*              create_roaring                          (void);
+scl_error_t             free_roaring                            (roaring_t * const __restrict__ rs);
+
+scl_error_t             roaring_add                             (roaring_t * const __restrict__ rs, size_t value);
+scl_error_t             roaring_add_range                       (roaring_t * const __restrict__ rs, size_t start, size_t end);
+scl_error_t             roaring_remove                          (roaring_t * const __restrict__ rs, size_t value);
+uint8_t                 roaring_contains                        (const roaring_t * const __restrict__ rs, size_t value);
+scl_error_t             roaring_run_optimize                    (roaring_t * const __restrict__ rs);
+
+size_t                  roaring_cardinality                     (const roaring_t * const __restrict__ rs);
+size_t                  roaring_rank                            (const roaring_t * const __restrict__ rs, size_t value);
+size_t                  roaring_to_array                        (const roaring_t * const __restrict__ rs, size_t * __restrict__ values);
+scl_error_t             roaring_memory_usage                    (const roaring_t * const __restrict__ rs, scl_memory_usage_t * const __restrict__ usage);
+
+scl_error_t             roaring_and                             (roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src);
+scl_error_t             roaring_or                              (roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src);
+scl_error_t             roaring_xor                             (roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src);
+scl_error_t             roaring_andnot                          (roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src);
+
+#endif /* BITSET_UTILS_H_ */
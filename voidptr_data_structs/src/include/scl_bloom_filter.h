@@ -0,0 +1,74 @@
+/**
+ * @file scl_bloom_filter.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BLOOM_FILTER_UTILS_H_
+#define BLOOM_FILTER_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/* Size in bytes of one block of the filter, one cache line */
+#define BLOOM_FILTER_BLOCK_BYTES 64
+
+/* Number of 64-bit words of one block */
+#define BLOOM_FILTER_BLOCK_WORDS (BLOOM_FILTER_BLOCK_BYTES / sizeof(uint64_t))
+
+/* Smallest number of keys a filter is sized for */
+#define BLOOM_FILTER_MIN_KEYS 64
+
+/**
+ * @brief Blocked Bloom Filter object definition. Every key sets all its
+ * bits inside one block of one cache line, selected by its hash value, so
+ * a test reads one cache line. A filter may answer that a missing key is
+ * present (false positive), never that a present key is missing
+ * 
+ */
+typedef struct bloom_filter_s {
+    uint64_t *blocks;                                           /* Array of blocks, BLOOM_FILTER_BLOCK_WORDS words each */
+    void *blocks_memory;                                        /* Block holding the blocks array (not aligned) */
+    size_t number_of_blocks;                                    /* Number of blocks, always a power of two */
+    size_t number_of_hashes;                                    /* Number of bits set by every key */
+    size_t bits_per_key;                                        /* Number of bits of the filter for every key it is sized for */
+    size_t capacity;                                            /* Number of keys the filter is sized for */
+    size_t size;                                                /* Number of keys added since the filter was created or cleared */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} bloom_filter_t;
+
+bloom_filter_t*     create_bloom_filter             (size_t capacity, size_t bits_per_key);
+scl_error_t         free_bloom_filter               (bloom_filter_t * const __restrict__ filter);
+
+scl_error_t         bloom_filter_add_hash           (bloom_filter_t * const __restrict__ filter, size_t key_hash);
+uint8_t             bloom_filter_may_contain_hash   (const bloom_filter_t * const __restrict__ filter, size_t key_hash);
+scl_error_t         bloom_filter_clear              (bloom_filter_t * const __restrict__ filter);
+uint8_t             bloom_filter_needs_rebuild      (const bloom_filter_t * const __restrict__ filter, size_t live_keys);
+
+size_t              get_bloom_filter_size           (const bloom_filter_t * const __restrict__ filter);
+size_t              get_bloom_filter_capacity       (const bloom_filter_t * const __restrict__ filter);
+scl_error_t         bloom_filter_memory_usage       (const bloom_filter_t * const __restrict__ filter, scl_memory_usage_t * const __restrict__ usage);
+
+#endif /* BLOOM_FILTER_UTILS_H_ */
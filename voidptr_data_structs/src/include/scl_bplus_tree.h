@@ -0,0 +1,121 @@
+/**
+ * @file scl_bplus_tree.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BPLUS_TREE_UTILS_H_
+#define BPLUS_TREE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/* Default size in bytes of one node (eight cache lines of 64 bytes) */
+#define BPLUS_TREE_NODE_SIZE 512
+
+/* Least number of keys a full node can hold, whatever the node size */
+#define BPLUS_TREE_MIN_KEYS 4
+
+/* Maximum height of a B+ tree (at least BPLUS_TREE_MIN_KEYS / 2 + 1 children per inner node) */
+#define BPLUS_TREE_MAX_HEIGHT 64
+
+/**
+ * @brief B+ Tree Node object definition. The keys are stored inline
+ * after the header, an inner node also stores its children after the keys
+ * (one more child than keys). The separator key i of an inner node is a copy
+ * of the smallest element of the child i + 1.
+ *
+ */
+typedef struct bplus_tree_node_s {
+    struct bplus_tree_node_s *next;                     /* Next leaf (`NULL` for inner nodes and for the last leaf) */
+    struct bplus_tree_node_s *prev;                     /* Previous leaf (`NULL` for inner nodes and for the first leaf) */
+    uint32_t count;                                     /* Number of keys of the node */
+    uint8_t is_leaf;                                    /* 1 if the node is a leaf, 0 otherwise */
+} bplus_tree_node_t;
+
+/**
+ * @brief B+ Tree object definition, an ordered set where every node
+ * holds many elements in one block sized to some cache lines or to a
+ * page. All the elements are stored in the leaves, which are linked in
+ * order for range scans, the inner nodes keep only separators so the
+ * height is log(N) in base of the fanout instead of base two.
+ *
+ */
+typedef struct bplus_tree_s {
+    bplus_tree_node_t *root;                            /* Root node (`NULL` for an empty tree) */
+    bplus_tree_node_t *head;                            /* First leaf, starting point of the scans */
+    bplus_tree_node_t *tail;                            /* Last leaf */
+    compare_func cmp;                                   /* Function to compare two elements */
+    free_func frd;                                      /* Function to free content of data */
+    size_t data_size;                                   /* Length in bytes of the data data type */
+    size_t size;                                        /* Number of elements of the tree */
+    size_t height;                                      /* Number of levels of the tree */
+    size_t node_size;                                   /* Size in bytes of one node */
+    size_t leaf_capacity;                               /* Maximum number of keys of a leaf */
+    size_t inner_capacity;                              /* Maximum number of keys of an inner node */
+    const scl_allocator_t *allocator;                   /* Allocator of the object, selected at creation */
+} bplus_tree_t;
+
+/**
+ * @brief Cursor over the elements of a B+ tree in ascending order, it
+ * walks the linked leaves. Any insertion or deletion invalidates the
+ * cursors of the tree.
+ *
+ */
+typedef struct bplus_tree_iter_s {
+    const bplus_tree_t *tree;                           /* Tree of the cursor */
+    const bplus_tree_node_t *node;                      /* Current leaf (`NULL` after the end of the tree) */
+    size_t index;                                       /* Index of the current element in the leaf */
+} bplus_tree_iter_t;
+
+bplus_tree_t*       create_bplus_tree               (compare_func cmp, free_func frd, size_t data_size, size_t node_size);
+scl_error_t         free_bplus_tree                 (bplus_tree_t * const __restrict__ tree);
+
+uint8_t             is_bplus_tree_empty             (const bplus_tree_t * const __restrict__ tree);
+size_t              get_bplus_tree_size             (const bplus_tree_t * const __restrict__ tree);
+scl_error_t         bplus_tree_memory_usage         (const bplus_tree_t * const __restrict__ tree, scl_memory_usage_t * const __restrict__ usage);
+size_t              get_bplus_tree_height           (const bplus_tree_t * const __restrict__ tree);
+
+scl_error_t         bplus_tree_insert               (bplus_tree_t * const __restrict__ tree, const void * __restrict__ data);
+scl_error_t         bplus_tree_build_sorted         (bplus_tree_t * const __restrict__ tree, const void * __restrict__ arr, size_t number_of_elem);
+scl_error_t         bplus_tree_delete               (bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+
+const void*         bplus_tree_find_data            (const bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*         bplus_tree_min_data             (const bplus_tree_t * const __restrict__ tree);
+const void*         bplus_tree_max_data             (const bplus_tree_t * const __restrict__ tree);
+const void*         bplus_tree_lower_bound          (const bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*         bplus_tree_upper_bound          (const bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+
+scl_error_t         bplus_tree_range                (const bplus_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action);
+scl_error_t         bplus_tree_traverse             (const bplus_tree_t * const __restrict__ tree, action_func action);
+
+const void*         bplus_tree_iter_begin           (const bplus_tree_t * const __restrict__ tree, bplus_tree_iter_t * const __restrict__ iter);
+const void*         bplus_tree_iter_rbegin          (const bplus_tree_t * const __restrict__ tree, bplus_tree_iter_t * const __restrict__ iter);
+const void*         bplus_tree_iter_seek            (const bplus_tree_t * const __restrict__ tree, bplus_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data);
+const void*         bplus_tree_iter_next            (bplus_tree_iter_t * const __restrict__ iter);
+const void*         bplus_tree_iter_prev            (bplus_tree_iter_t * const __restrict__ iter);
+const void*         bplus_tree_iter_data            (const bplus_tree_iter_t * const __restrict__ iter);
+
+#endif /* BPLUS_TREE_UTILS_H_ */
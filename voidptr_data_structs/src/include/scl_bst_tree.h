@@ -31,13 +31,14 @@
 #include <stdint.h>
 #include <errno.h>
 #include "scl_config.h"
+#include "scl_mem_pool.h"
 
 /**
  * @brief Binary Search Tree Node object definition
  * 
  */
 typedef struct bst_tree_node_s {
-    void *data;                                             /* Pointer to data */
+    void *data;                                             /* Pointer to data, stored inline after the node */
     struct bst_tree_node_s *parent;                         /* Pointer to parent node */
     struct bst_tree_node_s *left;                           /* Pointer to left child node */
     struct bst_tree_node_s *right;                          /* Pointer to right child node */
@@ -55,23 +56,41 @@ typedef struct bst_tree_s {
     free_func frd;                                          /* Function to free content of data */
     size_t data_size;                                       /* Length in bytes of the data data type */
     size_t size;                                            /* Size of the binary search tree */
+    mem_pool_t *node_pool;                                  /* Optional pool of nodes with inline data (`NULL` if not used) */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
 } bst_tree_t;
 
+/**
+ * @brief Cursor over the nodes of a binary search tree in ascending order. The
+ * cursor moves through the parent links, so it needs no recursion and no
+ * allocation. Any insertion or deletion invalidates the cursors of the tree
+ * 
+ */
+typedef struct bst_tree_iter_s {
+    const bst_tree_t *tree;                                 /* Tree of the cursor */
+    bst_tree_node_t *node;                                  /* Current node (`nil` after the end of the tree) */
+} bst_tree_iter_t;
+
 bst_tree_t*             create_bst                          (compare_func cmp, free_func frd, size_t data_size);
 scl_error_t             free_bst                            (bst_tree_t * const __restrict__ tree);
+scl_error_t             bst_use_node_pool                   (bst_tree_t * const __restrict__ tree, size_t nodes_per_chunk);
 
 scl_error_t             bst_insert                          (bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             bst_build_sorted                    (bst_tree_t * const __restrict__ tree, const void * __restrict__ arr, size_t number_of_elem);
 const void*             bst_find_data                       (const bst_tree_t * const __restrict__ tree, const void * __restrict__ data);
+const void*             bst_find_key                        (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp);
 int32_t                 bst_data_level                      (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 
 uint8_t                 is_bst_empty                        (const bst_tree_t * const __restrict__ tree);
 const void*             get_bst_root                        (const bst_tree_t * const __restrict__ tree);
 size_t                  get_bst_size                        (const bst_tree_t * const __restrict__ tree);
+scl_error_t             bst_memory_usage                    (const bst_tree_t * const __restrict__ tree, scl_memory_usage_t * const __restrict__ usage);
 
 const void*             bst_max_data                        (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 const void*             bst_min_data                        (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 
 scl_error_t             bst_delete                          (bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             bst_delete_key                      (bst_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp);
 
 const void*             bst_predecessor_data                (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 const void*             bst_successor_data                  (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
@@ -82,4 +101,16 @@ scl_error_t             bst_traverse_preorder               (const bst_tree_t *
 scl_error_t             bst_traverse_postorder              (const bst_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             bst_traverse_level                  (const bst_tree_t * const __restrict__ tree, action_func action);
 
+const void*             bst_iter_begin                      (const bst_tree_t * const __restrict__ tree, bst_tree_iter_t * const __restrict__ iter);
+const void*             bst_iter_rbegin                     (const bst_tree_t * const __restrict__ tree, bst_tree_iter_t * const __restrict__ iter);
+const void*             bst_iter_seek                       (const bst_tree_t * const __restrict__ tree, bst_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data);
+const void*             bst_iter_next                       (bst_tree_iter_t * const __restrict__ iter);
+const void*             bst_iter_prev                       (bst_tree_iter_t * const __restrict__ iter);
+const void*             bst_iter_data                       (const bst_tree_iter_t * const __restrict__ iter);
+uint32_t                bst_iter_count                      (const bst_tree_iter_t * const __restrict__ iter);
+
+const void*             bst_lower_bound                     (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*             bst_upper_bound                     (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             bst_range                           (const bst_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action);
+
 #endif /* BST_UTILS_H_ */
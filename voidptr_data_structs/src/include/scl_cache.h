@@ -0,0 +1,140 @@
+/**
+ * @file scl_cache.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CACHE_UTILS_H_
+#define CACHE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pthread.h>
+#include "scl_config.h"
+#include "scl_hash_table.h"
+
+/* Size in bytes of one cache line, every shard starts on its own line */
+#define CACHE_SHARD_ALIGN 64
+
+/**
+ * @brief Policy used by a cache to select the entry to evict
+ * 
+ */
+typedef enum cache_policy_e {
+    CACHE_POLICY_LRU,                                           /* Evict the least recently used entry */
+    CACHE_POLICY_LFU                                            /* Evict the least frequently used entry (the least recent of them) */
+} cache_policy_t;
+
+/**
+ * @brief Function called with the key and the data of every entry evicted
+ * to make room for a new one, right before they are freed
+ * 
+ */
+typedef void (*cache_evict_func)(const void * const key, const void * const data, void * const arg);
+
+struct cache_freq_s;
+
+/**
+ * @brief Cache entry object definition. The recency links are stored in the
+ * entry itself, the key and the data are stored inline after it, so one entry
+ * is one allocation and it is moved or evicted in O(1). The index node of the
+ * entry holds a second copy of the key and a pointer to the entry
+ * 
+ */
+typedef struct cache_entry_s {
+    struct cache_entry_s *prev;                                 /* More recently used entry (of the shard or of the frequency) */
+    struct cache_entry_s *next;                                 /* Less recently used entry (of the shard or of the frequency) */
+    struct cache_freq_s *freq;                                  /* Frequency node of the entry (just for LFU policy) */
+    size_t hash;                                                /* Hash value of the key */
+    void *key;                                                  /* Key of the entry, inline after the entry */
+    void *data;                                                 /* Data of the entry, inline after the key */
+} cache_entry_t;
+
+/**
+ * @brief Frequency node of a LFU cache, it links all the entries used the
+ * same number of times, from the most recent to the least recent one
+ * 
+ */
+typedef struct cache_freq_s {
+    struct cache_freq_s *prev;                                  /* Frequency node with a smaller count */
+    struct cache_freq_s *next;                                  /* Frequency node with a greater count */
+    cache_entry_t *head;                                        /* Most recently used entry of the frequency */
+    cache_entry_t *tail;                                        /* Least recently used entry of the frequency */
+    size_t count;                                               /* Number of uses of every entry of the node */
+} cache_freq_t;
+
+/**
+ * @brief One shard of a cache, a bounded set of entries indexed by a hash
+ * table and protected by its own lock
+ * 
+ */
+typedef struct cache_shard_s {
+    _Alignas(CACHE_SHARD_ALIGN) pthread_mutex_t lock;           /* Lock protecting every access to the shard */
+    hash_table_t *index;                                        /* Hash table mapping every key to its entry */
+    cache_entry_t *head;                                        /* Most recently used entry (just for LRU policy) */
+    cache_entry_t *tail;                                        /* Least recently used entry (just for LRU policy) */
+    cache_freq_t *freqs;                                        /* Frequency node with the smallest count (just for LFU policy) */
+    cache_freq_t *spare_freqs;                                  /* Unused frequency nodes kept for reuse */
+    size_t capacity;                                            /* Maximum number of entries of the shard */
+    size_t size;                                                /* Current number of entries of the shard */
+} cache_shard_t;
+
+/**
+ * @brief Cache Object definition. Every key is mapped to exactly one shard
+ * by its hash value and every shard evicts its own entries, so threads
+ * working on different shards never wait for each other
+ * 
+ */
+typedef struct cache_s {
+    cache_shard_t *shards;                                      /* Array of independently locked shards */
+    void *shards_memory;                                        /* Block holding the shards array (not aligned) */
+    hash_func hash;                                             /* Pointer to a hash function */
+    free_func frd_key;                                          /* Function to free memory of a single key element */
+    free_func frd_dt;                                           /* Function to free memory of a single data element */
+    cache_evict_func evict;                                     /* Function called for every evicted entry (`NULL` if not used) */
+    void *evict_arg;                                            /* Argument given to the evict function */
+    cache_policy_t policy;                                      /* Policy used to select the evicted entries */
+    size_t number_of_shards;                                    /* Number of shards, always a power of two */
+    size_t key_size;                                            /* Length in bytes of the key data type */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t data_offset;                                         /* Offset in bytes of the data from the beginning of one entry */
+    size_t capacity;                                            /* Maximum number of entries of all the shards */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} cache_t;
+
+cache_t*        create_cache                (size_t capacity, size_t number_of_shards, cache_policy_t policy, hash_func hash, compare_func cmp_key, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size);
+scl_error_t     free_cache                  (cache_t * const __restrict__ cache);
+scl_error_t     cache_set_evict_callback    (cache_t * const __restrict__ cache, cache_evict_func evict, void * const arg);
+
+scl_error_t     cache_put                   (cache_t * const __restrict__ cache, const void * const key, const void * const data);
+scl_error_t     cache_get                   (cache_t * const __restrict__ cache, const void * const key, void * const data);
+uint8_t         cache_contains_key          (cache_t * const __restrict__ cache, const void * const __restrict__ key);
+scl_error_t     cache_delete_key            (cache_t * const __restrict__ cache, const void * const __restrict__ key);
+scl_error_t     cache_clear                 (cache_t * const __restrict__ cache);
+
+size_t          get_cache_size              (cache_t * const __restrict__ cache);
+size_t          get_cache_capacity          (const cache_t * const __restrict__ cache);
+uint8_t         is_cache_empty              (cache_t * const __restrict__ cache);
+
+#endif /* CACHE_UTILS_H_ */
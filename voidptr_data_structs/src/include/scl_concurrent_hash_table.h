@@ -0,0 +1,85 @@
+/**
+ * @file scl_concurrent_hash_table.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CONCURRENT_HASH_TABLE_UTILS_H_
+#define CONCURRENT_HASH_TABLE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pthread.h>
+#include "scl_config.h"
+#include "scl_hash_table.h"
+
+/* Size in bytes of one cache line, every shard starts on its own line */
+#define CONCURRENT_HASH_SHARD_ALIGN 64
+
+/**
+ * @brief One shard of the concurrent hash table, a hash table
+ * object protected by its own readers-writer lock
+ *
+ */
+typedef struct concurrent_hash_table_shard_s {
+    _Alignas(CONCURRENT_HASH_SHARD_ALIGN) pthread_rwlock_t lock; /* Lock protecting every access to the table of the shard */
+    hash_table_t *table;                                        /* Hash table holding the keys mapped to the shard */
+} concurrent_hash_table_shard_t;
+
+/**
+ * @brief Concurrent (sharded) Hash Table object definition.
+ * Every key is mapped to exactly one shard by its hash value, the
+ * operations on different shards never wait for each other and the
+ * readers of the same shard share its lock.
+ *
+ */
+typedef struct concurrent_hash_table_s {
+    concurrent_hash_table_shard_t *shards;                      /* Array of independently locked shards */
+    void *shards_memory;                                        /* Block holding the shards array (not aligned) */
+    hash_func hash;                                             /* Pointer to a hash function */
+    size_t number_of_shards;                                    /* Number of shards, always a power of two */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} concurrent_hash_table_t;
+
+concurrent_hash_table_t*    create_concurrent_hash_table            (size_t number_of_shards, size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size);
+scl_error_t                 free_concurrent_hash_table              (concurrent_hash_table_t * const __restrict__ cht);
+
+scl_error_t                 concurrent_hash_table_insert            (concurrent_hash_table_t * const __restrict__ cht, const void *key, const void *data);
+scl_error_t                 concurrent_hash_table_find_data         (concurrent_hash_table_t * const __restrict__ cht, const void * const key, void * const data);
+scl_error_t                 concurrent_hash_table_update_data       (concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key, action_func action);
+uint8_t                     concurrent_hash_table_contains_key      (concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key);
+uint8_t                     concurrent_hash_table_contains_key_data (concurrent_hash_table_t * const __restrict__ cht, const void * const key, const void * const data);
+
+uint8_t                     is_concurrent_hash_table_empty          (concurrent_hash_table_t * const __restrict__ cht);
+size_t                      get_concurrent_hash_table_size          (concurrent_hash_table_t * const __restrict__ cht);
+scl_error_t                 concurrent_hash_table_memory_usage      (concurrent_hash_table_t * const __restrict__ cht, scl_memory_usage_t * const __restrict__ usage);
+size_t                      get_concurrent_hash_table_shards        (const concurrent_hash_table_t * const __restrict__ cht);
+
+scl_error_t                 concurrent_hash_table_delete_key_data   (concurrent_hash_table_t * const __restrict__ cht, const void * const key, const void * const data);
+scl_error_t                 concurrent_hash_table_delete_key        (concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key);
+
+scl_error_t                 concurrent_hash_table_traverse          (concurrent_hash_table_t * const __restrict__ cht, action_func action);
+
+#endif /* CONCURRENT_HASH_TABLE_UTILS_H_ */
@@ -0,0 +1,102 @@
+/**
+ * @file scl_concurrent_queue.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CONCURRENT_QUEUE_UTILS_H_
+#define CONCURRENT_QUEUE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include "scl_config.h"
+
+/* Size in bytes of one cache line, the indexes of producers and consumers live on their own lines */
+#define CONCURRENT_QUEUE_ALIGN 64
+
+/* Least number of elements of a bounded concurrent queue */
+#define CONCURRENT_QUEUE_MIN_CAPACITY 2
+
+/**
+ * @brief Wait-free bounded queue for exactly one producer thread and
+ * exactly one consumer thread. The elements are stored inline in a
+ * circular buffer, every side keeps a cached copy of the index of the
+ * other side, so the shared cache lines are read just when the cached
+ * copy says the queue is full (or empty).
+ *
+ */
+typedef struct spsc_queue_s {
+    _Alignas(CONCURRENT_QUEUE_ALIGN) atomic_size_t head;        /* Index of the next element to pop, written by the consumer */
+    size_t cached_tail;                                         /* Last tail seen by the consumer */
+    _Alignas(CONCURRENT_QUEUE_ALIGN) atomic_size_t tail;        /* Index of the next element to push, written by the producer */
+    size_t cached_head;                                         /* Last head seen by the producer */
+    _Alignas(CONCURRENT_QUEUE_ALIGN) uint8_t *buffer;           /* Circular buffer of the elements */
+    size_t capacity;                                            /* Number of elements of the buffer (a power of two) */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    void *memory;                                               /* Block holding the queue object (not aligned) */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} spsc_queue_t;
+
+/**
+ * @brief Lock-free bounded queue for any number of producer and
+ * consumer threads (Vyukov). Every cell of the circular buffer has a
+ * sequence number telling which lap of the buffer may write or read it,
+ * so one compare and swap on an index claims the cell (or a run of cells).
+ *
+ */
+typedef struct mpmc_queue_s {
+    _Alignas(CONCURRENT_QUEUE_ALIGN) atomic_size_t enqueue_pos; /* Position claimed by the next producer */
+    _Alignas(CONCURRENT_QUEUE_ALIGN) atomic_size_t dequeue_pos; /* Position claimed by the next consumer */
+    _Alignas(CONCURRENT_QUEUE_ALIGN) uint8_t *cells;            /* Circular buffer of cells, a sequence number and the data */
+    size_t cell_size;                                           /* Length in bytes of one cell */
+    size_t capacity;                                            /* Number of cells of the buffer (a power of two) */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    void *memory;                                               /* Block holding the queue object (not aligned) */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} mpmc_queue_t;
+
+spsc_queue_t*           create_spsc_queue                   (size_t capacity, size_t data_size);
+scl_error_t             free_spsc_queue                     (spsc_queue_t * const __restrict__ queue);
+
+scl_error_t             spsc_queue_push                     (spsc_queue_t * const __restrict__ queue, const void * const __restrict__ data);
+scl_error_t             spsc_queue_pop                      (spsc_queue_t * const __restrict__ queue, void * const __restrict__ data);
+size_t                  spsc_queue_push_n                   (spsc_queue_t * const __restrict__ queue, const void * const __restrict__ data, size_t number_of_elem);
+size_t                  spsc_queue_pop_n                    (spsc_queue_t * const __restrict__ queue, void * const __restrict__ data, size_t number_of_elem);
+
+size_t                  get_spsc_queue_size                 (const spsc_queue_t * const __restrict__ queue);
+size_t                  get_spsc_queue_capacity             (const spsc_queue_t * const __restrict__ queue);
+
+mpmc_queue_t*           create_mpmc_queue                   (size_t capacity, size_t data_size);
+scl_error_t             free_mpmc_queue                     (mpmc_queue_t * const __restrict__ queue);
+
+scl_error_t             mpmc_queue_push                     (mpmc_queue_t * const __restrict__ queue, const void * const __restrict__ data);
+scl_error_t             mpmc_queue_pop                      (mpmc_queue_t * const __restrict__ queue, void * const __restrict__ data);
+size_t                  mpmc_queue_push_n                   (mpmc_queue_t * const __restrict__ queue, const void * const __restrict__ data, size_t number_of_elem);
+size_t                  mpmc_queue_pop_n                    (mpmc_queue_t * const __restrict__ queue, void * const __restrict__ data, size_t number_of_elem);
+
+size_t                  get_mpmc_queue_size                 (const mpmc_queue_t * const __restrict__ queue);
+size_t                  get_mpmc_queue_capacity             (const mpmc_queue_t * const __restrict__ queue);
+
+#endif /* CONCURRENT_QUEUE_UTILS_H_ */
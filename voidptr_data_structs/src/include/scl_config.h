@@ -26,7 +26,30 @@
 #define _CONFIG_UTILS_H_
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+
+/* Alignment in bytes of the values stored inline after a node (the malloc alignment) */
+#define SCL_ALIGN _Alignof(max_align_t)
+
+/* Rounds up a size in bytes to the alignment of the values stored inline after a node */
+#define SCL_ALIGN_SIZE(size) (((size) + SCL_ALIGN - 1) & ~((size_t)SCL_ALIGN - 1))
+
+/* Hints the processor to load the cache line of an address that is read soon */
+#if defined(__GNUC__)
+#define SCL_PREFETCH(addr) __builtin_prefetch((addr))
+#else
+#define SCL_PREFETCH(addr) ((void)(addr))
+#endif
+
+/* Asks the compiler to inline a function even in an unoptimized build */
+#if defined(__GNUC__)
+#define SCL_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define SCL_ALWAYS_INLINE inline
+#endif
 
 /**
  * @brief Definition of error table handler
@@ -98,7 +121,76 @@ typedef enum scl_error_s {
     SCL_NULL_VERTICES_DISTANCES                 = -49,
     SCL_NULL_VERTICES_PARENTS                   = -50,
     SCL_NULL_PATH_MATRIX                        = -51,
-    SCL_GRAPH_INVALID_NEW_VERTICES              = -52
+    SCL_GRAPH_INVALID_NEW_VERTICES              = -52,
+
+    SCL_HASH_TABLE_LOCK_FAILED                  = -53,
+
+    SCL_NULL_MEM_POOL                           = -54,
+    SCL_NOT_EMPTY_OBJECT_FOR_POOL               = -55,
+
+    SCL_NULL_GRAPH_CSR                          = -56,
+
+    SCL_ID_ALREADY_IN_PQUEUE                    = -57,
+
+    SCL_NULL_GRAPH_TRAVERSAL                    = -58,
+
+    SCL_NULL_THREAD_POOL                        = -59,
+
+    SCL_NULL_GRAPH_PATH_QUERY                   = -60,
+
+    SCL_NULL_GRAPH_SCC                          = -61,
+
+    SCL_GRAPH_FILE_IO_FAIL                      = -62,
+
+    SCL_NULL_GRAPH_TOPO_ORDER                   = -63,
+    SCL_EDGE_MAKES_CYCLE                        = -64,
+
+    SCL_QUEUE_FULL                              = -65,
+
+    SCL_NULL_WORK_DEQUE                         = -66,
+
+    SCL_NULL_ULIST                              = -67,
+
+    SCL_NULL_SKIP_LIST                          = -68,
+
+    SCL_NULL_VECTOR                             = -69,
+
+    SCL_NULL_BPLUS_TREE                         = -70,
+
+    SCL_INCOMPATIBLE_TREES                      = -71,
+
+    SCL_NULL_PRBK                               = -72,
+    SCL_SNAPSHOTS_IN_USE                        = -73,
+
+    SCL_NULL_FROZEN_TREE                        = -74,
+
+    SCL_STATS_DISABLED                          = -75,
+
+    SCL_NULL_TOPK                               = -76,
+
+    SCL_HASH_TABLE_FILE_IO_FAIL                 = -77,
+    SCL_NULL_HASH_TABLE_IMAGE                   = -78,
+
+    SCL_NULL_CACHE                              = -79,
+    SCL_CACHE_LOCK_FAILED                       = -80,
+
+    SCL_NULL_BLOOM_FILTER                       = -81,
+
+    SCL_NULL_GRAPH_REACH_INDEX                  = -82,
+
+    SCL_NULL_MULTI_QUEUE                        = -83,
+    SCL_MULTI_QUEUE_LOCK_FAILED                 = -84,
+
+    SCL_NULL_RADIX_HEAP                         = -85,
+    SCL_RADIX_HEAP_KEY_TOO_LOW                  = -86,
+
+    SCL_NULL_ITERATOR                           = -87,
+
+    SCL_NULL_STRING_ARENA                       = -88,
+
+    SCL_NULL_BITSET                             = -89,
+    SCL_BITSET_SIZE_MISMATCH                    = -90,
+    SCL_NULL_ROARING                            = -91
 } scl_error_t;
 
 /**
@@ -107,10 +199,172 @@ typedef enum scl_error_s {
  */
 typedef         size_t          (*hash_func)            (const void * const);
 typedef         int32_t         (*compare_func)         (const void * const, const void * const);
+typedef         int32_t         (*key_compare_func)     (const void * const, const void * const);
 typedef         void            (*free_func)            (void *);
 typedef         void            (*action_func)          (void * const);
 typedef         int32_t         (*filter_func)          (const void * const);
+typedef         uint64_t        (*radix_key_func)       (const void * const);
+
+/**
+ * @brief Definition of the memory footprint of one object, as requested
+ * from the allocator (the bookkeeping of the allocator is not counted)
+ * 
+ */
+typedef struct scl_memory_usage_s {
+    size_t object_bytes;                                                        /* Object headers, sentinels and scratch buffers */
+    size_t node_bytes;                                                          /* Links, counters and padding of the nodes (the overhead of every element) */
+    size_t payload_bytes;                                                       /* Keys and data of the stored elements */
+    size_t array_bytes;                                                         /* Index arrays (buckets, heaps, vertices, offsets) */
+    size_t slack_bytes;                                                         /* Allocated bytes holding no element (free capacity, unused pool objects) */
+    size_t nodes;                                                               /* Number of nodes, slots or records in use */
+} scl_memory_usage_t;
+
+/**
+ * @brief Definition of the operation counters of one object. The counters
+ * are kept only when the library is built with SCL_STATS defined (the same
+ * flag MUST be given to the library and to the programs using it, the layout
+ * of the objects changes), otherwise the hooks compile to nothing. Counters
+ * updated while several readers share one object are approximate
+ * 
+ */
+typedef struct scl_stats_s {
+    uint64_t comparisons;                                                       /* Calls of the compare function or of the inlined compare */
+    uint64_t allocations;                                                       /* Nodes and arrays requested from the allocator or from a pool */
+    uint64_t rotations;                                                         /* Single rotations done to rebalance a tree */
+    uint64_t rehashes;                                                          /* Resizes of a hash table (every element is moved once) */
+    uint64_t lookups;                                                           /* Searches of a key in a hash table */
+    uint64_t probes;                                                            /* Nodes or slots visited by the searches of a hash table */
+    uint64_t sift_steps;                                                        /* Levels moved by the elements of a heap */
+    uint64_t relaxations;                                                       /* Distances lowered by the shortest path algorithms */
+} scl_stats_t;
+
+#if defined(SCL_STATS)
+/* Declares the counters inside the definition of an object */
+#define SCL_STATS_MEMBER                scl_stats_t stats;
+
+/* Adds value to one counter of an object, the counters of a const object can change (they are not part of its state) */
+#define SCL_STATS_ADD(object, counter, value) ((void)(((scl_stats_t *)&(object)->stats)->counter += (uint64_t)(value)))
+
+/* Copies the counters of an object into out and evaluates to SCL_OK */
+#define SCL_STATS_GET(object, out)      (*(out) = (object)->stats, SCL_OK)
+
+/* Sets the counters of an object to zero and evaluates to SCL_OK */
+#define SCL_STATS_RESET(object)         (memset(&(object)->stats, 0, sizeof((object)->stats)), SCL_OK)
+#else
+#define SCL_STATS_MEMBER
+#define SCL_STATS_ADD(object, counter, value) ((void)0)
+#define SCL_STATS_GET(object, out)      ((void)(object), memset((out), 0, sizeof(*(out))), SCL_STATS_DISABLED)
+#define SCL_STATS_RESET(object)         ((void)(object), SCL_STATS_DISABLED)
+#endif
+
+/**
+ * @brief Kinds of keys with a comparison known by the library. A container
+ * that knows the kind of its elements compares them inline instead of calling
+ * the compare function through a pointer on every step of a search. Any kind
+ * other than SCL_KEY_GENERIC MUST order the elements as the compare function does
+ * 
+ */
+typedef enum scl_key_kind_s {
+    SCL_KEY_GENERIC                             = 0,    /* Elements are compared by the compare function */
+    SCL_KEY_INT32                               = 1,    /* Elements are signed 32 bits integers */
+    SCL_KEY_INT64                               = 2,    /* Elements are signed 64 bits integers */
+    SCL_KEY_U32                                 = 3,    /* Elements are unsigned 32 bits integers */
+    SCL_KEY_U64                                 = 4,    /* Elements are unsigned 64 bits integers */
+    SCL_KEY_BYTES                               = 5,    /* Elements are compared byte by byte (memcmp over their size) */
+    SCL_KEY_CSTRING                             = 6     /* Elements are null terminated strings compared by strcmp */
+} scl_key_kind_t;
+
+/**
+ * @brief Function to compare two elements of a known kind, the call is
+ * inlined and the switch folds away when kind is a constant
+ * 
+ * @param kind kind of the two elements
+ * @param cmp compare function of the elements (used by SCL_KEY_GENERIC)
+ * @param size length in bytes of one element (used by SCL_KEY_BYTES)
+ * @param data1 pointer to the first element
+ * @param data2 pointer to the second element
+ * @return int32_t 1 if data1 is greater than data2, -1 if data1 is less
+ * than data2, 0 if they are equal (or the result of cmp for SCL_KEY_GENERIC)
+ */
+static SCL_ALWAYS_INLINE int32_t scl_key_compare(scl_key_kind_t kind, compare_func cmp, size_t size, const void * const data1, const void * const data2) {
+    switch (kind) {
+        case SCL_KEY_INT32: {
+            int32_t value1 = 0, value2 = 0;
+            memcpy(&value1, data1, sizeof(value1));
+            memcpy(&value2, data2, sizeof(value2));
+            return (value1 > value2) - (value1 < value2);
+        }
+        case SCL_KEY_INT64: {
+            int64_t value1 = 0, value2 = 0;
+            memcpy(&value1, data1, sizeof(value1));
+            memcpy(&value2, data2, sizeof(value2));
+            return (value1 > value2) - (value1 < value2);
+        }
+        case SCL_KEY_U32: {
+            uint32_t value1 = 0, value2 = 0;
+            memcpy(&value1, data1, sizeof(value1));
+            memcpy(&value2, data2, sizeof(value2));
+            return (value1 > value2) - (value1 < value2);
+        }
+        case SCL_KEY_U64: {
+            uint64_t value1 = 0, value2 = 0;
+            memcpy(&value1, data1, sizeof(value1));
+            memcpy(&value2, data2, sizeof(value2));
+            return (value1 > value2) - (value1 < value2);
+        }
+        case SCL_KEY_BYTES: {
+            int result = memcmp(data1, data2, size);
+            return (result > 0) - (result < 0);
+        }
+        case SCL_KEY_CSTRING: {
+            int result = strcmp((const char *)data1, (const char *)data2);
+            return (result > 0) - (result < 0);
+        }
+        default:
+            return cmp(data1, data2);
+    }
+}
+
+/* Runs CALL(kind) with kind as a constant, so every case gets its own inlined compare */
+#define SCL_KEY_KIND_DISPATCH(kind, CALL)                                       \
+    switch (kind) {                                                             \
+        case SCL_KEY_INT32:     CALL(SCL_KEY_INT32);    break;                  \
+        case SCL_KEY_INT64:     CALL(SCL_KEY_INT64);    break;                  \
+        case SCL_KEY_U32:       CALL(SCL_KEY_U32);      break;                  \
+        case SCL_KEY_U64:       CALL(SCL_KEY_U64);      break;                  \
+        case SCL_KEY_BYTES:     CALL(SCL_KEY_BYTES);    break;                  \
+        case SCL_KEY_CSTRING:   CALL(SCL_KEY_CSTRING);  break;                  \
+        default:                CALL(SCL_KEY_GENERIC);  break;                  \
+    }
+
+/**
+ * @brief Definition of an allocator object, every object of the
+ * library takes its memory through the allocator that was selected
+ * when the object was created. The alloc function MUST return memory
+ * aligned for any data type (as malloc does)
+ * 
+ */
+typedef struct scl_allocator_s {
+    void*       (*alloc)        (void *context, size_t size);                   /* Allocates size bytes */
+    void*       (*realloc)      (void *context, void *ptr, size_t size);        /* Resizes a block to size bytes */
+    void        (*free)         (void *context, void *ptr);                     /* Releases a block */
+    void        *context;                                                       /* User context sent to every function */
+} scl_allocator_t;
 
 void                            scl_error_message       (scl_error_t error_message);
 
+const scl_allocator_t*          scl_get_allocator       (void);
+void                            scl_set_allocator       (const scl_allocator_t * const allocator);
+
+size_t                          scl_memory_usage_total  (const scl_memory_usage_t * const usage);
+void                            scl_memory_usage_add    (scl_memory_usage_t * const usage, const scl_memory_usage_t * const other);
+
+scl_key_kind_t                  scl_key_kind_of         (compare_func cmp, size_t size);
+uint8_t                         scl_key_kind_fits       (scl_key_kind_t kind, size_t size);
+
+void*                           scl_malloc              (const scl_allocator_t * const allocator, size_t size);
+void*                           scl_calloc              (const scl_allocator_t * const allocator, size_t number, size_t size);
+void*                           scl_realloc             (const scl_allocator_t * const allocator, void *ptr, size_t size);
+void                            scl_free                (const scl_allocator_t * const allocator, void *ptr);
+
 #endif /* _CONFIG_UTILS_H_ */
@@ -26,16 +26,34 @@
 #define DATA_STRUCTURES_H_
 
 #include "scl_avl_tree.h"
+#include "scl_bitset.h"
+#include "scl_bloom_filter.h"
+#include "scl_bplus_tree.h"
 #include "scl_bst_tree.h"
+#include "scl_cache.h"
+#include "scl_concurrent_hash_table.h"
+#include "scl_concurrent_queue.h"
 #include "scl_dlist.h"
+#include "scl_flat_hash_table.h"
+#include "scl_frozen_tree.h"
 #include "scl_func_types.h"
 #include "scl_graph.h"
 #include "scl_hash_table.h"
+#include "scl_iterator.h"
 #include "scl_list.h"
+#include "scl_mem_pool.h"
+#include "scl_multi_queue.h"
+#include "scl_persistent_rbk_tree.h"
 #include "scl_priority_queue.h"
 #include "scl_queue.h"
 #include "scl_red_black_tree.h"
+#include "scl_skip_list.h"
 #include "scl_sort_algo.h"
 #include "scl_stack.h"
+#include "scl_string_arena.h"
+#include "scl_thread_pool.h"
+#include "scl_ulist.h"
+#include "scl_vector.h"
+#include "scl_work_deque.h"
 
 #endif /* DATA_STRUCTURES_H_ */
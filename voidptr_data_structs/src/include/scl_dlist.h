@@ -37,11 +37,23 @@
  * 
  */
 typedef struct dlist_node_s {
-    void *data;                                         /* Pointer to data */
+    void *data;                                         /* Pointer to data, stored inline after the node */
     struct dlist_node_s *prev;                          /* Pointer to previous node */
     struct dlist_node_s *next;                          /* Pointer to next node */
 } dlist_node_t;
 
+/**
+ * @brief Block of nodes allocated at once by dlist_from_array, the
+ * nodes are stored right after the (aligned) header. Every node of the
+ * block keeps a pointer to the block between the node and its data, the
+ * block is freed with its last node
+ * 
+ */
+typedef struct dlist_slab_s {
+    size_t nodes;                                       /* Number of nodes of the block not freed yet */
+    size_t bytes;                                       /* Length in bytes of the block, header included */
+} dlist_slab_t;
+
 /**
  * @brief Double Linked List object definition
  * 
@@ -53,13 +65,18 @@ typedef struct dlist_s {
     free_func frd;                                      /* function to free item */
     size_t data_size;                                   /* Length in bytes of the data data type */
     size_t size;                                        /* size of linked list */
+    const scl_allocator_t *allocator;                   /* Allocator of the object, selected at creation */
 } dlist_t;
 
 dlist_t*          create_dlist            (compare_func cmp, free_func frd, size_t data_size);
 scl_error_t       free_dlist              (dlist_t * const __restrict__ list);
 
+dlist_t*          dlist_from_array        (compare_func cmp, free_func frd, const void * __restrict__ arr, size_t number_of_elem, size_t data_size);
+scl_error_t       dlist_to_array          (const dlist_t * const __restrict__ list, void * __restrict__ arr, size_t number_of_elem);
+
 uint8_t           is_dlist_empty          (const dlist_t * const __restrict__ list);
 size_t            get_dlist_size          (const dlist_t * const __restrict__ list);
+scl_error_t       dlist_memory_usage      (const dlist_t * const __restrict__ list, scl_memory_usage_t * const __restrict__ usage);
 const void*       get_dlist_head          (const dlist_t * const __restrict__ list);
 const void*       get_dlist_tail          (const dlist_t * const __restrict__ list);
 
@@ -76,8 +93,14 @@ const void*       dlist_find_data         (const dlist_t * const __restrict__ li
 scl_error_t       dlist_delete_data       (dlist_t * const __restrict__ list, const void * const __restrict__ data);
 scl_error_t       dlist_delete_index      (dlist_t * const __restrict__ list, size_t data_index);
 scl_error_t       dlist_erase             (dlist_t * const __restrict__ list, size_t left_index, size_t right_index);
+scl_error_t       dlist_sort              (dlist_t * const __restrict__ list);
+
+scl_error_t       dlist_concat            (dlist_t * const __restrict__ list, dlist_t * const __restrict__ other);
+scl_error_t       dlist_splice            (dlist_t * const __restrict__ list, size_t data_index, dlist_t * const __restrict__ other);
+dlist_t*          dlist_split_at          (dlist_t * const __restrict__ list, size_t data_index);
 
 dlist_t*          dlist_filter            (const dlist_t * const __restrict__ list, filter_func filter);
+scl_error_t       dlist_retain            (dlist_t * const __restrict__ list, filter_func filter);
 scl_error_t       dlist_traverse          (const dlist_t * const __restrict__ list, action_func action);
 
 #endif /* DOUBLE_LIST_UTILS_H_ */
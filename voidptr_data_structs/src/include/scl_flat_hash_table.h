@@ -0,0 +1,89 @@
+/**
+ * @file scl_flat_hash_table.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FLAT_HASH_TABLE_UTILS_H_
+#define FLAT_HASH_TABLE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/**
+ * @brief Header of one flat hash table slot, the key bytes and
+ * the data bytes are stored inline right after the header
+ *
+ */
+typedef struct flat_hash_table_slot_s {
+    size_t hash;                                                /* Mixed hash value of the key stored in the slot */
+    size_t dist;                                                /* Probe distance from the home slot plus one (0 means empty slot) */
+} flat_hash_table_slot_t;
+
+/**
+ * @brief Flat (open addressing) Hash Table object definition
+ *
+ */
+typedef struct flat_hash_table_s {
+    uint8_t *slots;                                             /* Contiguous array of slots {header, key, data} */
+    uint8_t *swap_area;                                         /* Two scratch slots used while displacing entries */
+    hash_func hash;                                             /* Pointer to a hash function */
+    compare_func cmp_key;                                       /* Pointer to a compare function to compare key values */
+    compare_func cmp_dt;                                        /* Pointer to a compare function to compare data values */
+    free_func frd_key;                                          /* Pointer to a function to delete content of the key */
+    free_func frd_dt;                                           /* Pointer to a function to delete content of the data */
+    size_t key_size;                                            /* Length in bytes of the key data type */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t data_offset;                                         /* Offset in bytes of the data from the beginning of one slot */
+    size_t slot_size;                                           /* Length in bytes of one slot from the slots array */
+    size_t capacity;                                            /* Number of slots, always a power of two */
+    size_t size;                                                /* Number of occupied slots */
+    scl_key_kind_t key_kind;                                    /* Kind of the keys, compared inline if it is not generic */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+    SCL_STATS_MEMBER                                            /* Operation counters (only with SCL_STATS) */
+} flat_hash_table_t;
+
+flat_hash_table_t*      create_flat_hash_table                  (size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size);
+scl_error_t             free_flat_hash_table                    (flat_hash_table_t * const __restrict__ ht);
+scl_error_t             flat_hash_table_use_key_kind            (flat_hash_table_t * const __restrict__ ht, scl_key_kind_t kind);
+
+scl_error_t             flat_hash_table_insert                  (flat_hash_table_t * const __restrict__ ht, const void *key, const void *data);
+const void*             flat_hash_table_find_key_data           (const flat_hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
+const void*             flat_hash_table_find_data               (const flat_hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
+uint8_t                 flat_hash_table_contains_key_data       (const flat_hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
+
+uint8_t                 is_flat_hash_table_empty                (const flat_hash_table_t * const __restrict__ ht);
+size_t                  get_flat_hash_table_size                (const flat_hash_table_t * const __restrict__ ht);
+scl_error_t             flat_hash_table_memory_usage            (const flat_hash_table_t * const __restrict__ ht, scl_memory_usage_t * const __restrict__ usage);
+scl_error_t             flat_hash_table_get_stats               (const flat_hash_table_t * const __restrict__ ht, scl_stats_t * const __restrict__ stats);
+scl_error_t             flat_hash_table_reset_stats             (flat_hash_table_t * const __restrict__ ht);
+size_t                  get_flat_hash_table_capacity            (const flat_hash_table_t * const __restrict__ ht);
+
+scl_error_t             flat_hash_table_delete_key_data         (flat_hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
+scl_error_t             flat_hash_table_delete_key              (flat_hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
+
+scl_error_t             flat_hash_table_traverse                (const flat_hash_table_t * const __restrict__ ht, action_func action);
+
+#endif /* FLAT_HASH_TABLE_UTILS_H_ */
@@ -0,0 +1,73 @@
+/**
+ * @file scl_frozen_tree.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FROZEN_TREE_UTILS_H_
+#define FROZEN_TREE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+#include "scl_avl_tree.h"
+#include "scl_red_black_tree.h"
+
+/**
+ * @brief Frozen (static) search tree object definition. The elements are
+ * stored inline in one array in Eytzinger order (the breadth-first order
+ * of a complete binary search tree: the children of slot k are the slots
+ * 2k and 2k + 1, slot 0 is not used), so the tree has no pointers and a
+ * search reads the top levels from the same few cache lines. The tree
+ * cannot change after it was built
+ *
+ */
+typedef struct frozen_tree_s {
+    uint8_t *data;                                              /* Elements in Eytzinger order, starting from slot 1 */
+    uint32_t *counts;                                           /* Number of equal elements of every slot */
+    compare_func cmp;                                           /* Function to compare two elements */
+    free_func frd;                                              /* Function to free content of data */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t size;                                                /* Number of distinct elements */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} frozen_tree_t;
+
+frozen_tree_t*          create_frozen_tree                  (compare_func cmp, free_func frd, size_t data_size, const void * __restrict__ arr, size_t number_of_elem);
+frozen_tree_t*          freeze_avl                          (avl_tree_t * const __restrict__ tree);
+frozen_tree_t*          freeze_rbk                          (rbk_tree_t * const __restrict__ tree);
+scl_error_t             free_frozen_tree                    (frozen_tree_t * const __restrict__ ft);
+
+const void*             frozen_tree_find_data               (const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data);
+uint32_t                frozen_tree_count                   (const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data);
+const void*             frozen_tree_lower_bound             (const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data);
+const void*             frozen_tree_upper_bound             (const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data);
+const void*             frozen_tree_min_data                (const frozen_tree_t * const __restrict__ ft);
+const void*             frozen_tree_max_data                (const frozen_tree_t * const __restrict__ ft);
+size_t                  get_frozen_tree_size                (const frozen_tree_t * const __restrict__ ft);
+scl_error_t             frozen_tree_memory_usage            (const frozen_tree_t * const __restrict__ ft, scl_memory_usage_t * const __restrict__ usage);
+
+scl_error_t             frozen_tree_range                   (const frozen_tree_t * const __restrict__ ft, const void * const lo, const void * const hi, action_func action);
+scl_error_t             frozen_tree_traverse_inorder        (const frozen_tree_t * const __restrict__ ft, action_func action);
+
+#endif /* FROZEN_TREE_UTILS_H_ */
@@ -36,6 +36,12 @@
 #define         make_pair(m1, m2)               (m1), (m2)
 #define         make_triplet(m1, m2, m3)        (m1), (m2), (m3)
 
+/* Defines a hash function named func_name for keys of exactly bytes_size bytes */
+#define         define_hash_bytes(func_name, bytes_size)                                    \
+                size_t func_name(const void * const data) {                                 \
+                    return hash_bytes(data, (bytes_size));                                  \
+                }
+
 void            print_short_int                 (void * const data);
 void            print_ushort_int                (void * const data);
 void            print_uint                      (void * const data);
@@ -68,4 +74,20 @@ int32_t         compare_string_size             (const void * const data1, const
 int32_t         compare_string_lexi             (const void * const data1, const void * const data2);
 int32_t         compare_string                  (const void * const data1, const void * const data2);
 
+size_t          hash_mix                        (size_t value);
+size_t          hash_bytes                      (const void * const data, size_t data_size);
+size_t          hash_short_int                  (const void * const data);
+size_t          hash_ushort_int                 (const void * const data);
+size_t          hash_uint                       (const void * const data);
+size_t          hash_int                        (const void * const data);
+size_t          hash_long_int                   (const void * const data);
+size_t          hash_ulong_int                  (const void * const data);
+size_t          hash_llong_int                  (const void * const data);
+size_t          hash_ullong_int                 (const void * const data);
+size_t          hash_char                       (const void * const data);
+size_t          hash_uchar                      (const void * const data);
+size_t          hash_float                      (const void * const data);
+size_t          hash_double                     (const void * const data);
+size_t          hash_string                     (const void * const data);
+
 #endif /* _FUNCTION_TYPES_H_ */
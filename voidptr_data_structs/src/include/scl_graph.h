@@ -29,17 +29,56 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <float.h>
 #include <errno.h>
 #include "scl_config.h"
+#include "scl_thread_pool.h"
+#include "scl_mem_pool.h"
+
+/*
+ * Type of the vertex numbers stored in every edge, the library may be built with
+ * -DSCL_GRAPH_VERTEX_TYPE=uint32_t -DSCL_GRAPH_VERTEX_MAX=UINT32_MAX, then a graph has
+ * less than SCL_GRAPH_VERTEX_MAX vertices. The programs using the library MUST be
+ * built with the same definitions.
+ */
+#ifndef SCL_GRAPH_VERTEX_TYPE
+    #define SCL_GRAPH_VERTEX_TYPE size_t
+    #define SCL_GRAPH_VERTEX_MAX SIZE_MAX
+#endif /* SCL_GRAPH_VERTEX_TYPE */
+
+/*
+ * Type of the length of every edge, the library may be built with
+ * -DSCL_GRAPH_WEIGHT_TYPE=float -DSCL_GRAPH_WEIGHT_MAX=FLT_MAX (or an unsigned
+ * integer type and its maximum value), the maximum value marks the vertices
+ * that are not reached. The programs using the library MUST be built with
+ * the same definitions.
+ */
+#ifndef SCL_GRAPH_WEIGHT_TYPE
+    #define SCL_GRAPH_WEIGHT_TYPE long double
+    #define SCL_GRAPH_WEIGHT_MAX __LDBL_MAX__
+#endif /* SCL_GRAPH_WEIGHT_TYPE */
+
+#if !defined(SCL_GRAPH_VERTEX_MAX) || !defined(SCL_GRAPH_WEIGHT_MAX)
+    #error "SCL_GRAPH_VERTEX_MAX and SCL_GRAPH_WEIGHT_MAX must be defined with the graph types"
+#endif
+
+typedef SCL_GRAPH_VERTEX_TYPE graph_vertex_id_t;
+typedef SCL_GRAPH_WEIGHT_TYPE graph_weight_t;
+
+/* Maximum number of vertices of a graph (the vertex numbers are less than it) */
+#define GRAPH_VERTEX_ID_MAX ((size_t)SCL_GRAPH_VERTEX_MAX)
+
+/* Distance of the vertices that are not reached */
+#define GRAPH_WEIGHT_MAX ((graph_weight_t)SCL_GRAPH_WEIGHT_MAX)
 
 /**
  * @brief Graph Edge Object definition as a linked list
  * 
  */
 typedef struct graph_link_s {
-    size_t vertex;                                          /* Vertex number that links with the original vertex */
-    long double edge_len;                                   /* Length of the edge starting from original vertex to number vartex */
     struct graph_link_s *next;                              /* Pointer to the next link or edge from the graph */
+    graph_vertex_id_t vertex;                               /* Vertex number that links with the original vertex */
+    graph_weight_t edge_len;                                /* Length of the edge starting from original vertex to number vartex */
 } graph_link_t;
 
 /**
@@ -48,6 +87,7 @@ typedef struct graph_link_s {
  */
 typedef struct graph_vertex_s {
     graph_link_t *link;                                     /* Linked list representing all edges with current vertex with other vertices */
+    graph_link_t *in_link;                                  /* Linked list of the start vertices of the in edges, `NULL` if in edges are not indexed */
     size_t in_deg;                                          /* Number of edges that point to current vertex */
     size_t out_deg;                                         /* Number of edges that point from current vertex */
 } graph_vertex_t;
@@ -58,39 +98,258 @@ typedef struct graph_vertex_s {
  */
 typedef struct graph_s {
     graph_vertex_t **vertices;                              /* Array of vertices of the graph */
-    uint8_t *visit;                                         /* Array of visited vertices from the current graph */
     size_t size;                                            /* Number of vertices from the current graph object */
+    size_t capacity;                                        /* Number of vertices the vertices array can hold */
+    mem_pool_t *vertex_pool;                                /* Memory pool of the vertex objects */
+    mem_pool_t *link_pool;                                  /* Memory pool of the edge objects */
+    size_t tombstones;                                      /* Number of deleted vertices (`NULL` in vertices) until graph_compact */
+    uint8_t has_in_edges;                                   /* 1 if every vertex keeps its in edges in in_link */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+    SCL_STATS_MEMBER                                        /* Operation counters (only with SCL_STATS) */
 } graph_t;
 
+/**
+ * @brief Caller owned state of the graph traversals. A vertex is visited
+ * by the current query if its mark equals the generation, so a new query
+ * just increases the generation instead of clearing all the marks. Every
+ * thread querying a graph uses its own traversal object, so many threads
+ * can query the same graph at once.
+ * 
+ */
+typedef struct graph_traversal_s {
+    uint32_t *marks;                                        /* Generation of the last query that visited every vertex */
+    size_t *frontier;                                       /* Queue of the breath-first-search traversals */
+    size_t capacity;                                        /* Number of vertices of the marks and frontier arrays */
+    uint32_t generation;                                    /* Generation of the current query */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+} graph_traversal_t;
+
+/**
+ * @brief Caller owned state of the point-to-point shortest path queries,
+ * one search state for the start vertex (0) and one for the end vertex (1).
+ * A vertex is reached by a search of the current query if its mark equals
+ * the generation, so a query touches just the vertices it reaches.
+ * 
+ */
+typedef struct graph_path_query_s {
+    uint32_t *marks[2];                                     /* Generation of the last query that reached every vertex */
+    graph_weight_t *dists[2];                               /* Distances of the reached vertices (A* keeps the estimates in dists[1]) */
+    size_t *parents[2];                                     /* Previous vertex on the path to every reached vertex */
+    size_t *heaps[2];                                       /* Min heaps of the reached but not settled vertices */
+    size_t *heap_pos[2];                                    /* Position of every reached vertex in its heap */
+    size_t heap_sizes[2];                                   /* Number of vertices of the heaps */
+    size_t capacity;                                        /* Number of vertices of every array */
+    uint32_t generation;                                    /* Generation of the current query */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+} graph_path_query_t;
+
+/**
+ * @brief Strongly connected components of a graph object. The vertices of
+ * component `c` are `members[offsets[c]]` up to (without) `members[offsets[c + 1]]`,
+ * the components are numbered in reverse topological order (a component has
+ * edges just to components with smaller numbers).
+ * 
+ */
+typedef struct graph_scc_s {
+    size_t *component;                                      /* Component of every vertex (size elements) */
+    size_t *offsets;                                        /* Index of the first member of every component (number_of_components + 1 elements) */
+    size_t *members;                                        /* Vertices grouped by component (size elements) */
+    size_t number_of_components;                            /* Number of strongly connected components */
+    size_t size;                                            /* Number of vertices of the graph */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+} graph_scc_t;
+
+/**
+ * @brief Topological order of a directed acyclic graph kept up to date
+ * while edges are inserted by **graph_topo_insert_edge**. The vertex at
+ * position `p` is `order[p]` and `position[order[p]] == p`, every edge goes
+ * from a smaller position to a greater one.
+ * 
+ */
+typedef struct graph_topo_order_s {
+    size_t *order;                                          /* Vertex at every position of the order */
+    size_t *position;                                       /* Position of every vertex in the order */
+    graph_traversal_t *trav;                                /* Marks and stack of the bounded searches */
+    size_t size;                                            /* Number of ordered vertices */
+    size_t capacity;                                        /* Number of vertices the arrays can hold */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+} graph_topo_order_t;
+
+/**
+ * @brief Reachability index of a directed acyclic graph kept up to date
+ * while edges are inserted by **graph_reach_insert_edge**. Every vertex has
+ * one row of bits in both directions, bit `w` of past row `v` is set if
+ * there is a path from `v` to `w` and bit `w` of future row `v` is set if
+ * there is a path from `w` to `v`. The rows take 2 * capacity * capacity / 8 bytes.
+ * 
+ */
+typedef struct graph_reach_index_s {
+    uint64_t *past;                                         /* Past rows, words elements for every vertex */
+    uint64_t *future;                                       /* Future rows, words elements for every vertex */
+    size_t words;                                           /* Number of 64 bits words of every row */
+    size_t size;                                            /* Number of indexed vertices */
+    size_t capacity;                                        /* Number of vertices the rows can hold (words * 64) */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+} graph_reach_index_t;
+
+/**
+ * @brief Heuristic of the A* search, a lower bound of the length of a path
+ * from vertex to end_vertex (for example the straight line distance).
+ * 
+ */
+typedef graph_weight_t (*graph_heuristic_func)(size_t vertex, size_t end_vertex, void * const arg);
+
+/**
+ * @brief Immutable Compressed Sparse Row snapshot of a graph object.
+ * The edges of vertex `v` are `targets[offsets[v]]` up to (without)
+ * `targets[offsets[v + 1]]`, in the same order as in the graph object.
+ * The in edges are indexed only by **graph_csr_index_in_edges**.
+ * A snapshot loaded by **graph_load_mmap** keeps its arrays in the
+ * read-only mapping of the file.
+ * 
+ */
+typedef struct graph_csr_s {
+    size_t *offsets;                                        /* Index of the first edge of every vertex (size + 1 elements) */
+    graph_vertex_id_t *targets;                             /* End vertex of every edge, grouped by start vertex */
+    graph_weight_t *weights;                                /* Length of every edge, parallel to targets */
+    size_t *in_offsets;                                     /* Index of the first in edge of every vertex, NULL if not indexed */
+    graph_vertex_id_t *sources;                             /* Start vertex of every edge, grouped by end vertex */
+    size_t size;                                            /* Number of vertices of the snapshot */
+    size_t number_of_edges;                                 /* Number of edges of the snapshot */
+    void *mapping;                                          /* Mapping of the file holding the arrays, NULL if they are on heap */
+    size_t mapping_size;                                    /* Length in bytes of the mapping */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+    SCL_STATS_MEMBER                                        /* Operation counters (only with SCL_STATS) */
+} graph_csr_t;
+
+/* First bytes of a graph file written by graph_save */
+#define GRAPH_FILE_MAGIC "SCLGRAPH"
+
+/* Version of the graph file layout */
+#define GRAPH_FILE_VERSION 1
+
+/* Alignment in bytes of every array from a graph file */
+#define GRAPH_FILE_ALIGN 64
+
+/**
+ * @brief Header of a graph file, the arrays of the CSR snapshot are
+ * stored right after it, every one at an offset that is a multiple of
+ * GRAPH_FILE_ALIGN. A file is loaded just by a program with the same
+ * byte order and the same types of offsets, vertices and weights.
+ * 
+ */
+typedef struct graph_file_header_s {
+    char magic[8];                                          /* GRAPH_FILE_MAGIC without the terminator */
+    uint32_t version;                                       /* GRAPH_FILE_VERSION */
+    uint32_t byte_order;                                    /* 0x01020304 in the byte order of the writer */
+    uint32_t offset_size;                                   /* sizeof(size_t) of the writer */
+    uint32_t vertex_size;                                   /* sizeof(graph_vertex_id_t) of the writer */
+    uint32_t weight_size;                                   /* sizeof(graph_weight_t) of the writer */
+    uint32_t has_in_edges;                                  /* 1 if in_offsets and sources are stored */
+    uint64_t size;                                          /* Number of vertices */
+    uint64_t number_of_edges;                               /* Number of edges */
+} graph_file_header_t;
+
 graph_t*            create_graph                            (size_t number_of_vertexes);
 scl_error_t         free_graph                              (graph_t * const __restrict__ gr);
 
-scl_error_t         graph_insert_edge                       (const graph_t * const __restrict__ gr, size_t first_vertex, size_t second_vertex, long double edge_len);
+scl_error_t         graph_insert_edge                       (const graph_t * const __restrict__ gr, size_t first_vertex, size_t second_vertex, graph_weight_t edge_len);
 scl_error_t         graph_insert_vertices                   (graph_t * const __restrict__ gr, size_t new_vertices);
+scl_error_t         graph_insert_edges_bulk                 (const graph_t * const __restrict__ gr, const size_t * __restrict__ start_vertices, const size_t * __restrict__ end_vertices, const graph_weight_t * __restrict__ edge_lens, size_t number_of_edges);
+scl_error_t         graph_reserve_vertices                  (graph_t * const __restrict__ gr, size_t number_of_vertices);
+scl_error_t         graph_reserve_edges                     (const graph_t * const __restrict__ gr, size_t number_of_edges);
 graph_t*            create_transpose_graph                  (const graph_t * const __restrict__ gr);
+graph_t*            graph_clone                             (const graph_t * const __restrict__ gr);
 scl_error_t         graph_print                             (const graph_t * const __restrict__ gr, const uint8_t ** const data_arr);
 
 scl_error_t         graph_delete_edge                       (const graph_t * const __restrict__ gr, size_t first_vertex, size_t second_vertex);
 scl_error_t         graph_delete_all_edges                  (const graph_t * const __restrict__ gr, size_t first_vertex, size_t second_vertex);
 scl_error_t         graph_delete_vertex                     (graph_t * const __restrict__ gr, size_t vertex);
+scl_error_t         graph_index_in_edges                    (graph_t * const __restrict__ gr);
+scl_error_t         graph_tombstone_vertex                  (graph_t * const __restrict__ gr, size_t vertex);
+scl_error_t         graph_compact                           (graph_t * const __restrict__ gr, size_t * __restrict__ new_vertices);
 
 size_t              get_graph_size                          (const graph_t * const __restrict__ gr);
+size_t              get_graph_tombstones                    (const graph_t * const __restrict__ gr);
+scl_error_t         graph_memory_usage                      (const graph_t * const __restrict__ gr, scl_memory_usage_t * const __restrict__ usage);
+scl_error_t         graph_get_stats                         (const graph_t * const __restrict__ gr, scl_stats_t * const __restrict__ stats);
+scl_error_t         graph_reset_stats                       (graph_t * const __restrict__ gr);
+
+graph_traversal_t*  create_graph_traversal                  (size_t number_of_vertices);
+scl_error_t         free_graph_traversal                    (graph_traversal_t * const __restrict__ trav);
 
 size_t              graph_bfs_traverse                      (const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path);
 size_t              graph_dfs_traverse                      (const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path);
+size_t              graph_bfs_traverse_ctx                  (const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path);
+size_t              graph_dfs_traverse_ctx                  (const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path);
 
 uint8_t             graph_has_cycle                         (const graph_t * const __restrict__ gr);
 size_t              graph_vertex_past_vertices              (const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path);
 size_t              graph_vertex_future_vertices            (const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path);
 size_t              graph_vertex_anticone_vertices          (const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path);
 size_t              graph_tips_vertices                     (const graph_t * const __restrict__ gr, size_t * __restrict__ vertex_path);
+size_t              graph_vertex_past_vertices_ctx          (const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path);
+size_t              graph_vertex_future_vertices_ctx        (const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path);
 
 size_t              graph_topological_sort                  (const graph_t * const __restrict__ gr, size_t * __restrict__ vertex_path);
-scl_error_t         graph_dijkstra                          (const graph_t * const __restrict__ gr, size_t start_vertex, long double * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents);
-scl_error_t         graph_prim                              (const graph_t * const __restrict__ gr, size_t start_vertex, long double * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents);
-scl_error_t         graph_floyd_warshall                    (const graph_t * const __restrict__ gr, long double ** __restrict__ vertices_dists);
+size_t              graph_topological_sort_ctx              (const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t * __restrict__ vertex_path);
+
+graph_topo_order_t* create_graph_topo_order                 (const graph_t * const __restrict__ gr);
+scl_error_t         free_graph_topo_order                   (graph_topo_order_t * const __restrict__ topo);
+scl_error_t         graph_topo_insert_edge                  (const graph_t * const __restrict__ gr, graph_topo_order_t * const __restrict__ topo, size_t start_vertex, size_t end_vertex, graph_weight_t edge_len);
+const size_t*       get_graph_topo_order                    (const graph_topo_order_t * const __restrict__ topo);
+size_t              get_graph_topo_position                 (const graph_topo_order_t * const __restrict__ topo, size_t vertex);
+
+graph_reach_index_t* create_graph_reach_index               (const graph_t * const __restrict__ gr);
+scl_error_t         free_graph_reach_index                  (graph_reach_index_t * const __restrict__ reach);
+scl_error_t         graph_reach_insert_edge                 (const graph_t * const __restrict__ gr, graph_reach_index_t * const __restrict__ reach, size_t start_vertex, size_t end_vertex, graph_weight_t edge_len);
+uint8_t             graph_reach_is_past                     (const graph_reach_index_t * const __restrict__ reach, size_t vertex, size_t other_vertex);
+uint8_t             graph_reach_is_future                   (const graph_reach_index_t * const __restrict__ reach, size_t vertex, size_t other_vertex);
+size_t              graph_reach_past_vertices               (const graph_t * const __restrict__ gr, const graph_reach_index_t * const __restrict__ reach, size_t start_vertex, size_t * __restrict__ vertex_path);
+size_t              graph_reach_future_vertices             (const graph_t * const __restrict__ gr, const graph_reach_index_t * const __restrict__ reach, size_t start_vertex, size_t * __restrict__ vertex_path);
+size_t              graph_reach_anticone_vertices           (const graph_t * const __restrict__ gr, const graph_reach_index_t * const __restrict__ reach, size_t start_vertex, size_t * __restrict__ vertex_path);
+scl_error_t         graph_reach_memory_usage                (const graph_reach_index_t * const __restrict__ reach, scl_memory_usage_t * const __restrict__ usage);
+
+scl_error_t         graph_dijkstra                          (const graph_t * const __restrict__ gr, size_t start_vertex, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents);
+scl_error_t         graph_dijkstra_radix                    (const graph_t * const __restrict__ gr, size_t start_vertex, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents);
+scl_error_t         graph_prim                              (const graph_t * const __restrict__ gr, size_t start_vertex, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents);
+scl_error_t         graph_floyd_warshall                    (const graph_t * const __restrict__ gr, graph_weight_t ** __restrict__ vertices_dists);
+scl_error_t         graph_floyd_warshall_double             (const graph_t * const __restrict__ gr, thread_pool_t * const __restrict__ pool, double * __restrict__ vertices_dists);
+scl_error_t         graph_floyd_warshall_float              (const graph_t * const __restrict__ gr, thread_pool_t * const __restrict__ pool, float * __restrict__ vertices_dists);
+
+graph_path_query_t* create_graph_path_query                 (size_t number_of_vertices);
+scl_error_t         free_graph_path_query                   (graph_path_query_t * const __restrict__ query);
+
+scl_error_t         graph_shortest_path                     (const graph_t * const __restrict__ gr, const graph_t * const __restrict__ transpose_gr, size_t start_vertex, size_t end_vertex, graph_weight_t * __restrict__ path_dist, size_t * __restrict__ vertex_path, size_t * __restrict__ path_size);
+scl_error_t         graph_shortest_path_ctx                 (const graph_t * const __restrict__ gr, const graph_t * const __restrict__ transpose_gr, graph_path_query_t * const __restrict__ query, size_t start_vertex, size_t end_vertex, graph_weight_t * __restrict__ path_dist, size_t * __restrict__ vertex_path, size_t * __restrict__ path_size);
+scl_error_t         graph_astar                             (const graph_t * const __restrict__ gr, size_t start_vertex, size_t end_vertex, graph_heuristic_func heuristic, void * const arg, graph_weight_t * __restrict__ path_dist, size_t * __restrict__ vertex_path, size_t * __restrict__ path_size);
+scl_error_t         graph_astar_ctx                         (const graph_t * const __restrict__ gr, graph_path_query_t * const __restrict__ query, size_t start_vertex, size_t end_vertex, graph_heuristic_func heuristic, void * const arg, graph_weight_t * __restrict__ path_dist, size_t * __restrict__ vertex_path, size_t * __restrict__ path_size);
 
 uint8_t             graph_is_strongly_connected             (const graph_t * const __restrict__ gr);
 size_t**            graph_strongly_connected_components     (const graph_t * const __restrict__ gr, size_t *number_of_scc);
+graph_scc_t*        graph_tarjan_scc                        (const graph_t * const __restrict__ gr);
+scl_error_t         free_graph_scc                          (graph_scc_t * const __restrict__ scc);
+
+graph_csr_t*        graph_to_csr                            (const graph_t * const __restrict__ gr);
+graph_csr_t*        graph_csr_from_edges                    (size_t number_of_vertices, const size_t * __restrict__ start_vertices, const size_t * __restrict__ end_vertices, const graph_weight_t * __restrict__ edge_lens, size_t number_of_edges);
+scl_error_t         free_graph_csr                          (graph_csr_t * const __restrict__ csr);
+
+scl_error_t         graph_csr_save                          (const graph_csr_t * const __restrict__ csr, const char * const __restrict__ path);
+scl_error_t         graph_save                              (const graph_t * const __restrict__ gr, const char * const __restrict__ path);
+graph_csr_t*        graph_load_mmap                         (const char * const __restrict__ path);
+
+size_t              get_graph_csr_size                      (const graph_csr_t * const __restrict__ csr);
+scl_error_t         graph_csr_memory_usage                  (const graph_csr_t * const __restrict__ csr, scl_memory_usage_t * const __restrict__ usage);
+scl_error_t         graph_csr_get_stats                     (const graph_csr_t * const __restrict__ csr, scl_stats_t * const __restrict__ stats);
+scl_error_t         graph_csr_reset_stats                   (graph_csr_t * const __restrict__ csr);
+size_t              get_graph_csr_edges                     (const graph_csr_t * const __restrict__ csr);
+
+size_t              graph_csr_bfs_traverse                  (const graph_csr_t * const __restrict__ csr, size_t start_vertex, size_t * __restrict__ vertex_path);
+size_t              graph_csr_dfs_traverse                  (const graph_csr_t * const __restrict__ csr, size_t start_vertex, size_t * __restrict__ vertex_path);
+scl_error_t         graph_csr_dijkstra                      (const graph_csr_t * const __restrict__ csr, size_t start_vertex, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents);
+scl_error_t         graph_csr_delta_stepping                (const graph_csr_t * const __restrict__ csr, thread_pool_t * const __restrict__ pool, size_t start_vertex, graph_weight_t delta, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents);
+
+scl_error_t         graph_csr_index_in_edges                (graph_csr_t * const __restrict__ csr);
+size_t              graph_csr_parallel_bfs                  (const graph_csr_t * const __restrict__ csr, thread_pool_t * const __restrict__ pool, size_t start_vertex, size_t * __restrict__ vertex_levels);
 
 #endif /* GRAPH_UTILS_H_ */
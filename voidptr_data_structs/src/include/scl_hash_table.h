@@ -31,6 +31,8 @@
 #include <stdint.h>
 #include <errno.h>
 #include "scl_config.h"
+#include "scl_mem_pool.h"
+#include "scl_bloom_filter.h"
 
 /**
  * @brief Color of one hash table node
@@ -46,15 +48,46 @@ typedef enum hash_table_node_color_s {
  * 
  */
 typedef struct hash_table_node_s {
-    void *key;                                                  /* Pointer to a location of a value representing key of the hash */
-    void *data;                                                 /* Pointer to a location of a value representing data of a node */
+    void *key;                                                  /* Pointer to a location of a value representing key of the hash (inline after the node) */
+    void *data;                                                 /* Pointer to a location of a value representing data of a node (inline after the key) */
     struct hash_table_node_s *parent;                           /* Pointer to the parent of the current node */
     struct hash_table_node_s *left;                             /* Pointer to the left child of the current node */
     struct hash_table_node_s *right;                            /* Pointer to the right child of the current node */
+    size_t hash;                                                /* Cached hash value of the key (nodes are ordered by it first) */
     uint32_t count;                                             /* Number of nodes with the same data and key value */
     hash_table_node_color_t color;                              /* Color of the current node */
 } hash_table_node_t;
 
+/* Number of entries of the probe length histogram of a hash table */
+#define HASH_TABLE_PROBE_HISTOGRAM_SIZE 16
+
+/**
+ * @brief Distribution of the keys of a hash table over its buckets, filled
+ * by **hash_table_stats**. The probe length of a key is the number of nodes
+ * visited by a search that finds it (its depth in the bucket tree plus one)
+ * 
+ */
+typedef struct hash_table_stats_s {
+    double load_factor;                                         /* Number of keys divided by the number of buckets */
+    double mean_bucket_size;                                    /* Mean number of keys of the buckets holding at least one key */
+    double mean_probe_length;                                   /* Mean probe length of the keys (0 for an empty table) */
+    double skew;                                                /* Largest bucket divided by (load factor + 1), a few units for a uniform hash */
+    size_t used_buckets;                                        /* Number of buckets holding at least one key */
+    size_t max_bucket_size;                                     /* Number of keys of the largest bucket */
+    size_t max_probe_length;                                    /* Largest probe length of a key */
+    size_t probe_histogram[HASH_TABLE_PROBE_HISTOGRAM_SIZE];    /* Keys found after iter + 1 visited nodes, the last entry holds the longer probes too */
+} hash_table_stats_t;
+
+/* The skew warning receives the hash table defined below */
+struct hash_table_s;
+
+/**
+ * @brief Function called when the skew of a hash table crosses the threshold
+ * selected by **hash_table_set_skew_warning**
+ * 
+ */
+typedef void (*hash_table_skew_func)(const struct hash_table_s * const ht, const hash_table_stats_t * const stats, void * const arg);
+
 /**
  * @brief Hash Table object definition
  * 
@@ -69,27 +102,134 @@ typedef struct hash_table_s {
     free_func frd_dt;                                           /* Pointer to a function to delete content of the data */
     size_t key_size;                                            /* Length in bytes of the key data type */
     size_t data_size;                                           /* Length in bytes of the data data type */
-    size_t capacity;                                            /* Number of red black trees within the hash table */
+    size_t capacity;                                            /* Number of red black trees within the hash table, always a power of two */
     size_t size;                                                /* Number of total nodes from hash table object*/
+    hash_table_node_t **old_buckets;                            /* Buckets waiting to be moved during an incremental rehash */
+    size_t old_capacity;                                        /* Number of buckets from the old buckets array */
+    size_t rehash_index;                                        /* Index of the next old bucket to be moved */
+    size_t rehash_step;                                         /* Number of old buckets moved per operation (0 means full rehash) */
+    mem_pool_t *node_pool;                                      /* Optional pool of nodes with inline key and data (`NULL` if not used) */
+    bloom_filter_t *filter;                                     /* Optional filter of the key hashes tested before every search (`NULL` if not used) */
+    hash_table_skew_func skew_warn;                             /* Function called when the skew crosses skew_threshold (`NULL` if not used) */
+    void *skew_arg;                                             /* User argument sent to skew_warn */
+    double skew_threshold;                                      /* Skew checked after every rehash and by hash_table_stats */
+    scl_key_kind_t key_kind;                                    /* Kind of the keys, compared inline if it is not generic */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+    SCL_STATS_MEMBER                                            /* Operation counters (only with SCL_STATS) */
 } hash_table_t;
 
+/**
+ * @brief Cursor over the nodes of a hash table, bucket after bucket and
+ * in order inside a bucket. The cursor moves through the parent links, so
+ * it needs no recursion and no allocation, and it can erase its current
+ * node without searching it again. Any other insertion or deletion
+ * invalidates the cursors of the hash table
+ * 
+ */
+typedef struct hash_table_iter_s {
+    hash_table_t *ht;                                           /* Hash table of the cursor */
+    const hash_table_node_t *node;                              /* Current node of the cursor (`NULL` if none) */
+    const hash_table_node_t *next;                              /* Node after an erased current node (`NULL` if none) */
+    size_t bucket_index;                                        /* Bucket of the current node */
+} hash_table_iter_t;
+
+/* First bytes of a hash table image written by hash_table_freeze_to_file */
+#define HASH_TABLE_FILE_MAGIC "SCLHASHT"
+
+/* Version of the hash table image layout */
+#define HASH_TABLE_FILE_VERSION 1
+
+/* Length in bytes of the header section of a hash table image, the slots start right after it */
+#define HASH_TABLE_FILE_HEADER_BYTES 128
+
+/**
+ * @brief Header of a hash table image file. An image is opened just by a
+ * program with the same byte order, the slots are laid out as in
+ * **hash_table_image_slot_t** followed by the key and the data bytes
+ * 
+ */
+typedef struct hash_table_file_header_s {
+    char magic[8];                                              /* HASH_TABLE_FILE_MAGIC without the terminator */
+    uint32_t version;                                           /* HASH_TABLE_FILE_VERSION */
+    uint32_t byte_order;                                        /* 0x01020304 in the byte order of the writer */
+    uint64_t key_size;                                          /* Length in bytes of the key data type */
+    uint64_t data_size;                                         /* Length in bytes of the data data type */
+    uint64_t size;                                              /* Number of keys */
+    uint64_t capacity;                                          /* Number of slots, a power of two at least twice the number of keys */
+    uint64_t slot_size;                                         /* Length in bytes of one slot */
+    uint64_t data_offset;                                       /* Offset in bytes of the data from the beginning of one slot */
+    uint64_t max_dist;                                          /* Longest probe distance plus one of a key */
+} hash_table_file_header_t;
+
+/**
+ * @brief Header of one slot of a hash table image, the key bytes
+ * and the data bytes are stored inline right after it
+ * 
+ */
+typedef struct hash_table_image_slot_s {
+    uint64_t hash;                                              /* Hash value of the key returned by the hash function */
+    uint64_t dist;                                              /* Probe distance from the home slot plus one (0 means empty slot) */
+} hash_table_image_slot_t;
+
+/**
+ * @brief Read-only hash table image mapped by **hash_table_open_mmap**,
+ * the slots are used straight from the shared mapping of the file
+ * 
+ */
+typedef struct hash_table_image_s {
+    const uint8_t *slots;                                       /* Open-addressed slots inside the mapping */
+    hash_func hash;                                             /* Pointer to the hash function of the frozen table */
+    compare_func cmp_key;                                       /* Pointer to a compare function to compare key values */
+    size_t key_size;                                            /* Length in bytes of the key data type */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t data_offset;                                         /* Offset in bytes of the data from the beginning of one slot */
+    size_t slot_size;                                           /* Length in bytes of one slot */
+    size_t capacity;                                            /* Number of slots, always a power of two */
+    size_t size;                                                /* Number of keys */
+    size_t max_dist;                                            /* Longest probe distance plus one, no lookup goes further */
+    scl_key_kind_t key_kind;                                    /* Kind of the keys, compared inline if it is not generic */
+    void *mapping;                                              /* Mapping of the image file */
+    size_t mapping_size;                                        /* Length in bytes of the mapping */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} hash_table_image_t;
+
 hash_table_t*           create_hash_table                       (size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size);
 scl_error_t             free_hash_table                         (hash_table_t * const __restrict__ ht);
+scl_error_t             hash_table_use_node_pool                (hash_table_t * const __restrict__ ht, size_t nodes_per_chunk);
+scl_error_t             hash_table_use_key_kind                 (hash_table_t * const __restrict__ ht, scl_key_kind_t kind);
+scl_error_t             hash_table_use_bloom_filter             (hash_table_t * const __restrict__ ht, size_t bits_per_key);
+scl_error_t             hash_table_rebuild_bloom_filter         (hash_table_t * const __restrict__ ht);
+
+scl_error_t             hash_table_set_incremental_rehash       (hash_table_t * const __restrict__ ht, size_t buckets_per_step);
+scl_error_t             hash_table_finish_rehash                (hash_table_t * const __restrict__ ht);
+uint8_t                 is_hash_table_rehashing                 (const hash_table_t * const __restrict__ ht);
+scl_error_t             hash_table_reserve                      (hash_table_t * const __restrict__ ht, size_t number_of_keys);
 
 scl_error_t             hash_table_insert                       (hash_table_t * const __restrict__ ht, const void *key, const void *data);
+scl_error_t             hash_table_insert_with_hash             (hash_table_t * const __restrict__ ht, size_t key_hash, const void *key, const void *data);
+scl_error_t             hash_table_insert_bulk                  (hash_table_t * const __restrict__ ht, const void *keys, const void *datas, size_t count);
 const void*             hash_table_find_key_data                (const hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
 const void*             hash_table_find_data                    (const hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
+const void*             hash_table_find_data_with_hash          (const hash_table_t * const __restrict__ ht, size_t key_hash, const void * const __restrict__ key);
+scl_error_t             hash_table_find_batch                   (const hash_table_t * const __restrict__ ht, const void * const __restrict__ keys, size_t count, const void ** const __restrict__ results);
 uint8_t                 hash_table_contains_key_data            (const hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
 
 uint8_t                 is_hash_table_empty                     (const hash_table_t * const __restrict__ ht);
 uint8_t                 is_hash_table_bucket_key_empty          (const hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
 size_t                  get_hash_table_size                     (const hash_table_t * const __restrict__ ht);
+scl_error_t             hash_table_memory_usage                 (const hash_table_t * const __restrict__ ht, scl_memory_usage_t * const __restrict__ usage);
+scl_error_t             hash_table_get_stats                    (const hash_table_t * const __restrict__ ht, scl_stats_t * const __restrict__ stats);
+scl_error_t             hash_table_reset_stats                  (hash_table_t * const __restrict__ ht);
+scl_error_t             hash_table_stats                        (const hash_table_t * const __restrict__ ht, hash_table_stats_t * const __restrict__ stats);
+scl_error_t             hash_table_set_skew_warning             (hash_table_t * const __restrict__ ht, double threshold, hash_table_skew_func warn, void * const arg);
 size_t                  get_hash_table_capacity                 (const hash_table_t * const __restrict__ ht);
 size_t                  hash_table_count_bucket_elements        (const hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
 
 scl_error_t             hash_table_delete_key_data              (hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
+scl_error_t             hash_table_delete_key_data_with_hash    (hash_table_t * const __restrict__ ht, size_t key_hash, const void * const key, const void * const data);
 scl_error_t             hash_table_delete_hash                  (hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
 scl_error_t             hash_table_delete_key                   (hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
+scl_error_t             hash_table_delete_key_with_hash         (hash_table_t * const __restrict__ ht, size_t key_hash, const void * const __restrict__ key);
 
 scl_error_t             hash_table_bucket_traverse_inorder      (const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action);
 scl_error_t             hash_table_traverse_inorder             (const hash_table_t * const __restrict__ ht, action_func action);
@@ -100,4 +240,16 @@ scl_error_t             hash_table_traverse_postorder           (const hash_tabl
 scl_error_t             hash_table_bucket_traverse_level        (const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action);
 scl_error_t             hash_table_traverse_level               (const hash_table_t * const __restrict__ ht, action_func action);
 
+const void*             hash_table_iter_begin                   (hash_table_t * const __restrict__ ht, hash_table_iter_t * const __restrict__ iter);
+const void*             hash_table_iter_next                    (hash_table_iter_t * const __restrict__ iter);
+const void*             hash_table_iter_key                     (const hash_table_iter_t * const __restrict__ iter);
+const void*             hash_table_iter_data                    (const hash_table_iter_t * const __restrict__ iter);
+scl_error_t             hash_table_iter_erase_current           (hash_table_iter_t * const __restrict__ iter);
+
+scl_error_t             hash_table_freeze_to_file               (const hash_table_t * const __restrict__ ht, const char * const __restrict__ path);
+hash_table_image_t*     hash_table_open_mmap                    (const char * const __restrict__ path, hash_func hash, compare_func cmp_key);
+scl_error_t             free_hash_table_image                   (hash_table_image_t * const __restrict__ image);
+const void*             hash_table_image_find_data              (const hash_table_image_t * const __restrict__ image, const void * const __restrict__ key);
+size_t                  get_hash_table_image_size               (const hash_table_image_t * const __restrict__ image);
+
 #endif /* HASH_TABLE_UTILS_H_ */
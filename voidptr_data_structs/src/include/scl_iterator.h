@@ -0,0 +1,85 @@
+/**
+ * @file scl_iterator.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ITERATOR_UTILS_H_
+#define ITERATOR_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+#include "scl_list.h"
+#include "scl_dlist.h"
+#include "scl_vector.h"
+
+typedef struct scl_iter_s scl_iter_t;
+
+/* Function of one stage to get its next element, `NULL` if no element is left */
+typedef const void*     (*iter_next_func)       (scl_iter_t * const);
+
+/* Function of a user defined source to get its next element, `NULL` if no element is left */
+typedef const void*     (*iter_generator_func)  (void * const);
+
+/* Function to write the image of an element (first) into an output buffer (second) */
+typedef void            (*map_func)             (const void * const, void * const);
+
+/**
+ * @brief Lazy Iterator Object definition. An iterator is one stage of a
+ * pipeline: a source walks the elements of a container, an adaptor (filter,
+ * map or take) pulls the elements of its source stage one by one. Nothing is
+ * copied into intermediate containers and the stages live where the user
+ * declares them (usually on the stack), so a pipeline allocates no memory.
+ * Changing a container invalidates the iterators over it
+ * 
+ */
+struct scl_iter_s {
+    iter_next_func next;                                    /* Function of the stage, selected by the constructor */
+    scl_iter_t *source;                                     /* Previous stage of the pipeline (`NULL` for a source) */
+    const void *position;                                   /* Next node or element of the container */
+    const void *end;                                        /* End of the elements of an array source */
+    size_t elem_size;                                       /* Length in bytes of one element of an array source */
+    size_t left;                                            /* Number of elements a take stage can still give */
+    filter_func filter;                                     /* Filter function of a filter stage */
+    map_func map;                                           /* Map function of a map stage */
+    iter_generator_func generator;                          /* Function of a user defined source */
+    void *arg;                                              /* Output buffer of a map stage or state of a user defined source */
+};
+
+scl_error_t         scl_iter_list               (scl_iter_t * const __restrict__ iter, const list_t * const __restrict__ list);
+scl_error_t         scl_iter_dlist              (scl_iter_t * const __restrict__ iter, const dlist_t * const __restrict__ list);
+scl_error_t         scl_iter_vector             (scl_iter_t * const __restrict__ iter, const vector_t * const __restrict__ vec);
+scl_error_t         scl_iter_array              (scl_iter_t * const __restrict__ iter, const void * const __restrict__ arr, size_t number_of_elem, size_t elem_size);
+scl_error_t         scl_iter_generator          (scl_iter_t * const __restrict__ iter, iter_generator_func generator, void * const state);
+
+scl_error_t         scl_iter_filter             (scl_iter_t * const __restrict__ iter, scl_iter_t * const __restrict__ source, filter_func filter);
+scl_error_t         scl_iter_map                (scl_iter_t * const __restrict__ iter, scl_iter_t * const __restrict__ source, map_func map, void * const buffer);
+scl_error_t         scl_iter_take               (scl_iter_t * const __restrict__ iter, scl_iter_t * const __restrict__ source, size_t count);
+
+const void*         scl_iter_next               (scl_iter_t * const __restrict__ iter);
+size_t              scl_iter_count              (scl_iter_t * const __restrict__ iter);
+scl_error_t         scl_iter_to_vector          (scl_iter_t * const __restrict__ iter, vector_t * const __restrict__ vec);
+
+#endif /* ITERATOR_UTILS_H_ */
@@ -37,10 +37,22 @@
  * 
  */
 typedef struct list_node_s {
-    void *data;                                         /* Pointer to data */
+    void *data;                                         /* Pointer to data, stored inline after the node */
     struct list_node_s *next;                           /* Pointer to next node */
 } list_node_t;
 
+/**
+ * @brief Block of nodes allocated at once by list_from_array, the
+ * nodes are stored right after the (aligned) header. Every node of the
+ * block keeps a pointer to the block between the node and its data, the
+ * block is freed with its last node
+ * 
+ */
+typedef struct list_slab_s {
+    size_t nodes;                                       /* Number of nodes of the block not freed yet */
+    size_t bytes;                                       /* Length in bytes of the block, header included */
+} list_slab_t;
+
 /**
  * @brief Linked List object definition
  * 
@@ -52,13 +64,18 @@ typedef struct list_s {
     free_func frd;                                      /* function to free item */
     size_t data_size;                                   /* Length in bytes of the data data type */
     size_t size;                                        /* size of linked list */
+    const scl_allocator_t *allocator;                   /* Allocator of the object, selected at creation */
 } list_t;
 
 list_t*         create_list         (compare_func cmp, free_func frd, size_t data_size);
 scl_error_t     free_list           (list_t * const __restrict__ list);
 
+list_t*         list_from_array     (compare_func cmp, free_func frd, const void * __restrict__ arr, size_t number_of_elem, size_t data_size);
+scl_error_t     list_to_array       (const list_t * const __restrict__ list, void * __restrict__ arr, size_t number_of_elem);
+
 uint8_t         is_list_empty       (const list_t * const __restrict__ list);
 size_t          get_list_size       (const list_t * const __restrict__ list);
+scl_error_t     list_memory_usage   (const list_t * const __restrict__ list, scl_memory_usage_t * const __restrict__ usage);
 const void*     get_list_head       (const list_t * const __restrict__ list);
 const void*     get_list_tail       (const list_t * const __restrict__ list);
 
@@ -75,8 +92,14 @@ const void*     list_find_data      (const list_t * const __restrict__ list, con
 scl_error_t     list_delete_data    (list_t * const __restrict__ list, const void * const __restrict__ data);
 scl_error_t     list_delete_index   (list_t * const __restrict__ list, size_t data_index);
 scl_error_t     list_erase          (list_t * const __restrict__ list, size_t left_index, size_t right_index);
+scl_error_t     list_sort           (list_t * const __restrict__ list);
+
+scl_error_t     list_concat         (list_t * const __restrict__ list, list_t * const __restrict__ other);
+scl_error_t     list_splice         (list_t * const __restrict__ list, size_t data_index, list_t * const __restrict__ other);
+list_t*         list_split_at       (list_t * const __restrict__ list, size_t data_index);
 
 list_t*         list_filter         (const list_t * const __restrict__ list, filter_func filter);
+scl_error_t     list_retain         (list_t * const __restrict__ list, filter_func filter);
 scl_error_t     list_traverse       (const list_t * const __restrict__ list, action_func map);
 
 #endif /* LIST_UTILS_H_ */
@@ -0,0 +1,79 @@
+/**
+ * @file scl_mem_pool.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEM_POOL_UTILS_H_
+#define MEM_POOL_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/* Alignment in bytes of every object handed out by a memory pool (the malloc alignment) */
+#define MEM_POOL_ALIGN SCL_ALIGN
+
+/* Rounds up a size in bytes to the alignment of the memory pool objects */
+#define MEM_POOL_ALIGN_SIZE(size) SCL_ALIGN_SIZE(size)
+
+/**
+ * @brief Header of one chunk of objects, the objects
+ * are stored right after the (aligned) header
+ *
+ */
+typedef struct mem_pool_chunk_s {
+    struct mem_pool_chunk_s *next;                              /* Pointer to the previous allocated chunk */
+} mem_pool_chunk_t;
+
+/**
+ * @brief Memory Pool object definition, hands out objects of
+ * one fixed size from contiguous chunks
+ *
+ */
+typedef struct mem_pool_s {
+    mem_pool_chunk_t *chunks;                                   /* List of all allocated chunks, newest first */
+    void *free_list;                                            /* List of released objects, reused first */
+    uint8_t *bump;                                              /* Next never used object from the newest chunk */
+    uint8_t *bump_end;                                          /* End of the objects area of the newest chunk */
+    size_t object_size;                                         /* Length in bytes of one object (aligned) */
+    size_t objects_per_chunk;                                   /* Number of objects from one chunk */
+    size_t used;                                                /* Number of objects in use */
+    size_t capacity;                                            /* Number of objects of all the chunks */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} mem_pool_t;
+
+mem_pool_t*             create_mem_pool                     (size_t object_size, size_t objects_per_chunk);
+scl_error_t             free_mem_pool                       (mem_pool_t * const __restrict__ pool);
+
+void*                   mem_pool_alloc                      (mem_pool_t * const __restrict__ pool);
+scl_error_t             mem_pool_reserve                    (mem_pool_t * const __restrict__ pool, size_t number_of_objects);
+void*                   mem_pool_alloc_array                (mem_pool_t * const __restrict__ pool, size_t number_of_objects);
+scl_error_t             mem_pool_free                       (mem_pool_t * const __restrict__ pool, void * const __restrict__ object);
+
+size_t                  get_mem_pool_used                   (const mem_pool_t * const __restrict__ pool);
+size_t                  get_mem_pool_object_size            (const mem_pool_t * const __restrict__ pool);
+scl_error_t             mem_pool_memory_usage               (const mem_pool_t * const __restrict__ pool, scl_memory_usage_t * const __restrict__ usage);
+
+#endif /* MEM_POOL_UTILS_H_ */
@@ -0,0 +1,89 @@
+/**
+ * @file scl_multi_queue.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MULTI_QUEUE_UTILS_H_
+#define MULTI_QUEUE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "scl_config.h"
+#include "scl_priority_queue.h"
+
+/* Size in bytes of one cache line, every heap starts on its own line */
+#define MULTI_QUEUE_HEAP_ALIGN 64
+
+/* Number of heaps for every online processor if no number of heaps is given */
+#define MULTI_QUEUE_HEAPS_PER_THREAD 2
+
+/* Number of random heaps tried without waiting for a lock before blocking */
+#define MULTI_QUEUE_ATTEMPTS 8
+
+/**
+ * @brief One heap of a multi queue, a sequential flat priority queue
+ * protected by its own lock
+ * 
+ */
+typedef struct multi_queue_heap_s {
+    _Alignas(MULTI_QUEUE_HEAP_ALIGN) pthread_mutex_t lock;      /* Lock protecting every access to the heap */
+    flat_priority_queue_t *heap;                                /* Elements of the heap, {priority, data} slots */
+    atomic_size_t size;                                         /* Number of elements, read without the lock to skip empty heaps */
+} multi_queue_heap_t;
+
+/**
+ * @brief Multi Queue Object definition, a relaxed concurrent priority queue.
+ * Every push goes to one random heap and every pop removes the better top of
+ * two random heaps, so threads seldom wait for the same lock and the popped
+ * element is one of the best ones, not always the best one
+ * 
+ */
+typedef struct multi_queue_s {
+    multi_queue_heap_t *heaps;                                  /* Array of independently locked heaps */
+    void *heaps_memory;                                         /* Block holding the heaps array (not aligned) */
+    compare_func cmp_pr;                                        /* Function to compare two sets of priority */
+    free_func frd_pr;                                           /* Function to free memory of a single priority element */
+    free_func frd_dt;                                           /* Function to free memory of a single data element */
+    size_t number_of_heaps;                                     /* Number of heaps */
+    size_t pri_size;                                            /* Length in bytes of the priority data type */
+    size_t data_size;                                           /* Length in bytes of the data data type (may be zero) */
+    atomic_size_t size;                                         /* Number of elements of all the heaps */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} multi_queue_t;
+
+multi_queue_t*  create_multi_queue          (size_t number_of_heaps, compare_func cmp_pr, free_func frd_pr, free_func frd_dt, size_t pri_size, size_t data_size);
+scl_error_t     free_multi_queue            (multi_queue_t * const __restrict__ mqueue);
+
+scl_error_t     multi_queue_push            (multi_queue_t * const __restrict__ mqueue, const void * const priority, const void * const data);
+scl_error_t     multi_queue_pop             (multi_queue_t * const __restrict__ mqueue, void * const priority, void * const data);
+scl_error_t     multi_queue_clear           (multi_queue_t * const __restrict__ mqueue);
+
+size_t          get_multi_queue_size        (const multi_queue_t * const __restrict__ mqueue);
+size_t          get_multi_queue_heaps       (const multi_queue_t * const __restrict__ mqueue);
+uint8_t         is_multi_queue_empty        (const multi_queue_t * const __restrict__ mqueue);
+
+#endif /* MULTI_QUEUE_UTILS_H_ */
@@ -0,0 +1,134 @@
+/**
+ * @file scl_persistent_rbk_tree.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PERSISTENT_RBK_TREE_UTILS_H_
+#define PERSISTENT_RBK_TREE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include "scl_config.h"
+#include "scl_red_black_tree.h"
+
+/* Most nodes copied on one level of the tree by one insertion or deletion */
+#define PRBK_COPIES_PER_LEVEL 8
+
+/* Number of reader stripes of a tree, the threads share the stripes round robin */
+#define PRBK_READER_STRIPES 16
+
+/* Size in bytes of one cache line, every reader stripe starts on its own line */
+#define PRBK_READER_STRIPE_ALIGN 64
+
+/**
+ * @brief Persistent (left-leaning) Red-Black Tree Node object definition.
+ * A node never changes after it was published, an update copies the nodes
+ * of its path and the copies share the untouched subtrees and the data
+ * with the old nodes, so the nodes have no parent links
+ *
+ */
+typedef struct prbk_tree_node_s {
+    void *data;                                                 /* Pointer to data, in a block shared by all the copies of the node */
+    struct prbk_tree_node_s *left;                              /* Pointer to left child node or `NULL` */
+    struct prbk_tree_node_s *right;                             /* Pointer to right child node or `NULL` */
+    _Atomic size_t refs;                                        /* Number of nodes and snapshots pointing to the node */
+    uint64_t stamp;                                             /* Version in which the node was created */
+    uint32_t count;                                             /* Number of nodes with the same data value */
+    rbk_tree_node_color_t color;                                /* Color of a node */
+} prbk_tree_node_t;
+
+/**
+ * @brief Published version of a persistent red-black tree. A snapshot
+ * never changes, so any number of threads may read it without locks
+ * while the writer updates the tree
+ *
+ */
+typedef struct prbk_snapshot_s {
+    prbk_tree_node_t *root;                                     /* Pointer to the root of the version or `NULL` */
+    size_t size;                                                /* Number of nodes of the version */
+    const struct prbk_tree_s *tree;                             /* Tree that published the version */
+    _Atomic size_t refs;                                        /* References of the readers and of the tree (if current) */
+} prbk_snapshot_t;
+
+/**
+ * @brief Reader counters of a group of threads, on its own cache line so
+ * the readers of different stripes do not write the same line. The readers
+ * between loading and referencing the current snapshot are counted by the
+ * parity of the publish epoch they started in
+ *
+ */
+typedef struct prbk_reader_stripe_s {
+    _Alignas(PRBK_READER_STRIPE_ALIGN) _Atomic size_t acquiring[2]; /* Readers of the stripe in prbk_acquire_snapshot, by epoch parity */
+    _Atomic size_t readers;                                     /* Acquires minus releases of the threads of the stripe */
+} prbk_reader_stripe_t;
+
+/**
+ * @brief Persistent Red-Black Tree object definition. One writer thread
+ * inserts and deletes elements in a private working version and publishes
+ * it with one atomic store of the snapshot pointer, any number of reader
+ * threads acquire the current snapshot and release it when done. The nodes
+ * of old versions are reclaimed by reference counting when the last
+ * snapshot holding them is released. A publish waits for the readers that
+ * were acquiring a snapshot when it started, never for later readers nor
+ * for the readers that hold snapshots
+ *
+ */
+typedef struct prbk_tree_s {
+    _Atomic(prbk_snapshot_t *) current;                         /* Last published snapshot */
+    _Atomic size_t epoch;                                       /* Number of publishes, its parity selects the acquiring counters */
+    prbk_reader_stripe_t *stripes;                              /* Reader counters, PRBK_READER_STRIPES cache lines */
+    void *stripes_memory;                                       /* Block holding the stripes array (not aligned) */
+    prbk_tree_node_t *root;                                     /* Pointer to the root of the working version */
+    prbk_tree_node_t *spare;                                    /* Free nodes reserved for the next update */
+    size_t spare_count;                                         /* Number of reserved free nodes */
+    uint64_t stamp;                                             /* Version of the working nodes (the unpublished ones) */
+    compare_func cmp;                                           /* Function to compare two elements */
+    free_func frd;                                              /* Function to free content of data */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t size;                                                /* Number of nodes of the working version */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} prbk_tree_t;
+
+prbk_tree_t*            create_prbk                         (compare_func cmp, free_func frd, size_t data_size);
+scl_error_t             free_prbk                           (prbk_tree_t * const __restrict__ tree);
+
+scl_error_t             prbk_insert                         (prbk_tree_t * const __restrict__ tree, const void * __restrict__ data);
+scl_error_t             prbk_delete                         (prbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*             prbk_find_data                      (const prbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+uint8_t                 is_prbk_empty                       (const prbk_tree_t * const __restrict__ tree);
+size_t                  get_prbk_size                       (const prbk_tree_t * const __restrict__ tree);
+
+scl_error_t             prbk_publish                        (prbk_tree_t * const __restrict__ tree);
+const prbk_snapshot_t*  prbk_acquire_snapshot               (prbk_tree_t * const __restrict__ tree);
+scl_error_t             prbk_release_snapshot               (prbk_tree_t * const __restrict__ tree, const prbk_snapshot_t * const __restrict__ snapshot);
+
+const void*             prbk_snapshot_find_data             (const prbk_snapshot_t * const __restrict__ snapshot, const void * const __restrict__ data);
+const void*             prbk_snapshot_lower_bound           (const prbk_snapshot_t * const __restrict__ snapshot, const void * const __restrict__ data);
+size_t                  get_prbk_snapshot_size              (const prbk_snapshot_t * const __restrict__ snapshot);
+scl_error_t             prbk_snapshot_range                 (const prbk_snapshot_t * const __restrict__ snapshot, const void * const lo, const void * const hi, action_func action);
+scl_error_t             prbk_snapshot_traverse_inorder      (const prbk_snapshot_t * const __restrict__ snapshot, action_func action);
+
+#endif /* PERSISTENT_RBK_TREE_UTILS_H_ */
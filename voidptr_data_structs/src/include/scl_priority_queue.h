@@ -31,14 +31,15 @@
 #include <stdint.h>
 #include <errno.h>
 #include "scl_config.h"
+#include "scl_vector.h"
 
 /**
  * @brief Priority Queue Node Object definition
  * 
  */
 typedef struct pri_node_s {
-    void *pri;                                              /* Priority element definition */
-    void *data;                                             /* Data type element definition */
+    void *pri;                                              /* Priority element definition (inline after the node) */
+    void *data;                                             /* Data type element definition (inline after the priority or `NULL`) */
 } pri_node_t;
 
 /**
@@ -55,11 +56,81 @@ typedef struct priority_queue_s {
     size_t pri_size;                                        /* Length in bytes of the priority data type */
     size_t data_size;                                       /* Length in bytes of the data data type */
     size_t size;                                            /* Current size of the priority queue */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+    SCL_STATS_MEMBER                                        /* Operation counters (only with SCL_STATS) */
 } priority_queue_t;
 
+/**
+ * @brief Indexed Priority Queue Object definition. Every element is
+ * an id from [0, capacity) and a position map keeps the heap slot of
+ * every id, so the priority of any element is changed in O(log n)
+ * 
+ */
+typedef struct indexed_priority_queue_s {
+    size_t *heap;                                           /* Array of ids ordered as a binary heap */
+    size_t *positions;                                      /* Heap slot of every id (SIZE_MAX if id is not in queue) */
+    uint8_t *priorities;                                    /* Priority of every id, pri_size bytes each */
+    compare_func cmp_pr;                                    /* Function to compare two sets of priority */
+    free_func frd_pr;                                       /* Function to free memory of a single priority element */
+    size_t capacity;                                        /* Number of ids, maximum size of the queue */
+    size_t pri_size;                                        /* Length in bytes of the priority data type */
+    size_t size;                                            /* Current size of the indexed priority queue */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+} indexed_priority_queue_t;
+
+/**
+ * @brief Flat Priority Queue Object definition. The priority and the
+ * data of every element are stored inline in one contiguous array of
+ * slots ordered as a d-ary heap, so the children of one node are
+ * neighbours in memory and no node is allocated separately
+ * 
+ */
+typedef struct flat_priority_queue_s {
+    vector_t slots;                                         /* Contiguous array of slots {priority, data}, the heap */
+    uint8_t *swap_area;                                     /* One scratch slot used while sifting */
+    compare_func cmp_pr;                                    /* Function to compare two sets of priority */
+    free_func frd_dt;                                       /* Function to free memory of a single data element */
+    free_func frd_pr;                                       /* Function to free memory of a single priority element */
+    size_t arity;                                           /* Number of children of every heap node */
+    size_t pri_size;                                        /* Length in bytes of the priority data type */
+    size_t data_size;                                       /* Length in bytes of the data data type (may be zero) */
+    size_t data_offset;                                     /* Offset in bytes of the data from the beginning of one slot */
+    size_t slot_size;                                       /* Length in bytes of one slot from the slots array */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+    SCL_STATS_MEMBER                                        /* Operation counters (only with SCL_STATS) */
+} flat_priority_queue_t;
+
+/**
+ * @brief Number of buckets of a radix heap, one for the keys equal to
+ * the last popped key and one for every bit where a key can differ from it
+ * 
+ */
+#define RADIX_HEAP_BUCKETS 65
+
+/**
+ * @brief Radix Heap Object definition. A monotone priority queue with
+ * unsigned integer keys, the popped keys never decrease. An element with
+ * key k is kept in the bucket given by the highest bit where k differs
+ * from the last popped key, so every element moves at most 64 times
+ * between buckets during its life
+ * 
+ */
+typedef struct radix_heap_s {
+    vector_t buckets[RADIX_HEAP_BUCKETS];                   /* Arrays of slots {key, data}, bucket 0 holds keys equal to last */
+    uint64_t used_buckets;                                  /* Bit (i - 1) is set if bucket i (1 <= i <= 64) may be not empty */
+    uint64_t last;                                          /* Last popped key, every key of the heap is not lower than it */
+    free_func frd_dt;                                       /* Function to free memory of a single data element */
+    size_t data_size;                                       /* Length in bytes of the data data type (may be zero) */
+    size_t slot_size;                                       /* Length in bytes of one slot from the buckets */
+    size_t size;                                            /* Current size of the radix heap */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+} radix_heap_t;
+
 priority_queue_t*   create_priority_queue       (size_t init_capacity, compare_func cmp_pr, compare_func cmp_dt, free_func frd_pr, free_func frd_dt, size_t pri_size, size_t data_size);
 scl_error_t         free_priority_queue         (priority_queue_t * const __restrict__ pqueue);
 scl_error_t         heapify                     (priority_queue_t * const __restrict__ empty_pqueue, const void *priority, const void *data);
+scl_error_t         pri_queue_build             (priority_queue_t * const __restrict__ pqueue, const void *priorities, const void *datas, size_t count);
+scl_error_t         pri_queue_push_bulk         (priority_queue_t * const __restrict__ pqueue, const void *priorities, const void *datas, size_t count);
 
 scl_error_t         change_node_priority        (const priority_queue_t * const __restrict__ pqueue, size_t node_index, const void * __restrict__ new_pri);
 scl_error_t         change_node_data            (const priority_queue_t * const __restrict__ pqueue, size_t node_index, const void * __restrict__ new_data);
@@ -71,11 +142,60 @@ scl_error_t         pri_queue_push              (priority_queue_t * const __rest
 const void*         pri_queue_top               (const priority_queue_t * const __restrict__ pqueue);
 const void*         pri_queue_top_pri           (const priority_queue_t * const __restrict__ pqueue);
 scl_error_t         pri_queue_pop               (priority_queue_t * const __restrict__ pqueue);
+scl_error_t         pri_queue_replace_top       (priority_queue_t * const __restrict__ pqueue, const void *priority, const void *data);
+scl_error_t         pri_queue_pushpop           (priority_queue_t * const __restrict__ pqueue, const void *priority, const void *data);
 scl_error_t         pri_queue_traverse          (const priority_queue_t * const __restrict__ pqueue, action_func action);
 
 size_t              pri_queue_size              (const priority_queue_t * const __restrict__ pqueue);
+scl_error_t         pri_queue_memory_usage      (const priority_queue_t * const __restrict__ pqueue, scl_memory_usage_t * const __restrict__ usage);
+scl_error_t         pri_queue_get_stats         (const priority_queue_t * const __restrict__ pqueue, scl_stats_t * const __restrict__ stats);
+scl_error_t         pri_queue_reset_stats       (priority_queue_t * const __restrict__ pqueue);
 uint8_t             is_priq_empty               (const priority_queue_t * const __restrict__ pqueue);
 
 scl_error_t         heap_sort                   (void* arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
 
+indexed_priority_queue_t*   create_indexed_priority_queue           (size_t capacity, compare_func cmp_pr, free_func frd_pr, size_t pri_size);
+scl_error_t                 free_indexed_priority_queue             (indexed_priority_queue_t * const __restrict__ ipqueue);
+
+scl_error_t                 indexed_pri_queue_push                  (indexed_priority_queue_t * const __restrict__ ipqueue, size_t id, const void * const __restrict__ priority);
+scl_error_t                 indexed_pri_queue_change_priority       (indexed_priority_queue_t * const __restrict__ ipqueue, size_t id, const void * const __restrict__ new_pri);
+uint8_t                     indexed_pri_queue_contains              (const indexed_priority_queue_t * const __restrict__ ipqueue, size_t id);
+const void*                 indexed_pri_queue_get_priority          (const indexed_priority_queue_t * const __restrict__ ipqueue, size_t id);
+
+size_t                      indexed_pri_queue_top                   (const indexed_priority_queue_t * const __restrict__ ipqueue);
+const void*                 indexed_pri_queue_top_pri               (const indexed_priority_queue_t * const __restrict__ ipqueue);
+scl_error_t                 indexed_pri_queue_pop                   (indexed_priority_queue_t * const __restrict__ ipqueue);
+scl_error_t                 indexed_pri_queue_delete                (indexed_priority_queue_t * const __restrict__ ipqueue, size_t id);
+
+size_t                      indexed_pri_queue_size                  (const indexed_priority_queue_t * const __restrict__ ipqueue);
+scl_error_t                 indexed_pri_queue_memory_usage          (const indexed_priority_queue_t * const __restrict__ ipqueue, scl_memory_usage_t * const __restrict__ usage);
+uint8_t                     is_indexed_priq_empty                   (const indexed_priority_queue_t * const __restrict__ ipqueue);
+
+flat_priority_queue_t*      create_flat_priority_queue              (size_t init_capacity, size_t arity, compare_func cmp_pr, free_func frd_pr, free_func frd_dt, size_t pri_size, size_t data_size);
+scl_error_t                 free_flat_priority_queue                (flat_priority_queue_t * const __restrict__ fpqueue);
+
+scl_error_t                 flat_pri_queue_push                     (flat_priority_queue_t * const __restrict__ fpqueue, const void *priority, const void *data);
+const void*                 flat_pri_queue_top                      (const flat_priority_queue_t * const __restrict__ fpqueue);
+const void*                 flat_pri_queue_top_pri                  (const flat_priority_queue_t * const __restrict__ fpqueue);
+scl_error_t                 flat_pri_queue_pop                      (flat_priority_queue_t * const __restrict__ fpqueue);
+scl_error_t                 flat_pri_queue_traverse                 (const flat_priority_queue_t * const __restrict__ fpqueue, action_func action);
+
+size_t                      flat_pri_queue_size                     (const flat_priority_queue_t * const __restrict__ fpqueue);
+scl_error_t                 flat_pri_queue_memory_usage             (const flat_priority_queue_t * const __restrict__ fpqueue, scl_memory_usage_t * const __restrict__ usage);
+scl_error_t                 flat_pri_queue_get_stats                (const flat_priority_queue_t * const __restrict__ fpqueue, scl_stats_t * const __restrict__ stats);
+scl_error_t                 flat_pri_queue_reset_stats              (flat_priority_queue_t * const __restrict__ fpqueue);
+uint8_t                     is_flat_priq_empty                      (const flat_priority_queue_t * const __restrict__ fpqueue);
+
+radix_heap_t*               create_radix_heap                       (free_func frd_dt, size_t data_size);
+scl_error_t                 free_radix_heap                         (radix_heap_t * const __restrict__ rheap);
+
+scl_error_t                 radix_heap_push                         (radix_heap_t * const __restrict__ rheap, uint64_t key, const void * __restrict__ data);
+scl_error_t                 radix_heap_pop                          (radix_heap_t * const __restrict__ rheap, uint64_t * const __restrict__ key, void * __restrict__ data);
+scl_error_t                 radix_heap_clear                        (radix_heap_t * const __restrict__ rheap);
+
+uint64_t                    radix_heap_last_key                     (const radix_heap_t * const __restrict__ rheap);
+size_t                      radix_heap_size                         (const radix_heap_t * const __restrict__ rheap);
+scl_error_t                 radix_heap_memory_usage                 (const radix_heap_t * const __restrict__ rheap, scl_memory_usage_t * const __restrict__ usage);
+uint8_t                     is_radix_heap_empty                     (const radix_heap_t * const __restrict__ rheap);
+
 #endif /* PRIORITY_QUEUE_UTILS_H_ */
@@ -37,7 +37,7 @@
  * 
  */
 typedef struct queue_node_s {
-    void *data;                     /* Pointer to data */
+    void *data;                     /* Pointer to data, stored inline after the node */
     struct queue_node_s *next;      /* Pointer to next data node */
 } queue_node_t;
 
@@ -51,14 +51,23 @@ typedef struct queue_s {
     free_func frd;                  /* Function to free one data */
     size_t data_size;               /* Length in bytes of the data data type */
     size_t size;                    /* Size of the queue */
+    uint8_t *ring;                  /* Circular buffer of the ring mode, `NULL` in the linked mode */
+    size_t capacity;                /* Number of elements of the ring (a power of two) */
+    size_t head;                    /* Index in the ring of the front element */
+    const scl_allocator_t *allocator;/* Allocator of the object, selected at creation */
 } queue_t;
 
+/* Least number of elements of the ring of a queue */
+#define QUEUE_RING_MIN_CAPACITY 16
+
 queue_t*        create_queue        (free_func frd, size_t data_size);
 scl_error_t     free_queue          (queue_t * const __restrict__ queue);
 scl_error_t     print_queue         (const queue_t * const __restrict__ queue, action_func print);
+scl_error_t     queue_use_ring      (queue_t * const __restrict__ queue, size_t initial_capacity);
 
 uint8_t         is_queue_empty      (const queue_t * const __restrict__ queue);
 size_t          get_queue_size      (const queue_t * const __restrict__ queue);
+scl_error_t     queue_memory_usage  (const queue_t * const __restrict__ queue, scl_memory_usage_t * const __restrict__ usage);
 
 const void*     queue_front         (const queue_t * const __restrict__ queue);
 const void*     queue_back          (const queue_t * const __restrict__ queue);
@@ -31,6 +31,8 @@
 #include <errno.h>
 #include <stdint.h>
 #include "scl_config.h"
+#include "scl_mem_pool.h"
+#include "scl_bloom_filter.h"
 
 /**
  * @brief Color of one red-black tree node
@@ -46,10 +48,11 @@ typedef enum rbk_tree_node_color_s {
  * 
  */
 typedef struct rbk_tree_node_s {
-    void *data;                                                 /* Pointer to data */
+    void *data;                                                 /* Pointer to data, stored inline after the node */
     struct rbk_tree_node_s *parent;                             /* Pointer to parent node */
     struct rbk_tree_node_s *left;                               /* Pointer to left child node */
     struct rbk_tree_node_s *right;                              /* Pointer to right child node */
+    size_t weight;                                              /* Sum of the counts of the subtree (kept if order_stats is set) */
     uint32_t count;                                             /* Number of nodes with the same data value */
     rbk_tree_node_color_t color;                                /* Color of a node */
 } rbk_tree_node_t;
@@ -65,23 +68,53 @@ typedef struct rbk_tree_s {
     free_func frd;                                              /* Function to free content of data */
     size_t data_size;                                           /* Length in bytes of the data data type */
     size_t size;                                                /* Size of the red-black tree */
+    mem_pool_t *node_pool;                                      /* Optional pool of nodes with inline data (`NULL` if not used) */
+    bloom_filter_t *filter;                                     /* Optional filter of the element hashes tested before every search (`NULL` if not used) */
+    hash_func filter_hash;                                      /* Function to hash the elements for the filter (`NULL` if not used) */
+    uint8_t order_stats;                                        /* 1 if the nodes keep their weights, 0 otherwise */
+    scl_key_kind_t key_kind;                                    /* Kind of the elements, compared inline if it is not generic */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+    SCL_STATS_MEMBER                                            /* Operation counters (only with SCL_STATS) */
 } rbk_tree_t;
 
+/**
+ * @brief Cursor over the nodes of a red-black tree in ascending order. The
+ * cursor moves through the parent links, so it needs no recursion and no
+ * allocation. Any insertion or deletion invalidates the cursors of the tree
+ * 
+ */
+typedef struct rbk_tree_iter_s {
+    const rbk_tree_t *tree;                                     /* Tree of the cursor */
+    rbk_tree_node_t *node;                                      /* Current node (`nil` after the end of the tree) */
+} rbk_tree_iter_t;
+
 rbk_tree_t*             create_rbk                          (compare_func cmp, free_func frd, size_t data_size);
 scl_error_t             free_rbk                            (rbk_tree_t * const __restrict__ tree);
+scl_error_t             rbk_use_node_pool                   (rbk_tree_t * const __restrict__ tree, size_t nodes_per_chunk);
+scl_error_t             rbk_use_order_stats                 (rbk_tree_t * const __restrict__ tree);
+scl_error_t             rbk_use_key_kind                    (rbk_tree_t * const __restrict__ tree, scl_key_kind_t kind);
+scl_error_t             rbk_use_bloom_filter                (rbk_tree_t * const __restrict__ tree, hash_func hash, size_t bits_per_key);
+scl_error_t             rbk_rebuild_bloom_filter            (rbk_tree_t * const __restrict__ tree);
 
 scl_error_t             rbk_insert                          (rbk_tree_t * const __restrict__ tree, const void * __restrict__ data);
+scl_error_t             rbk_build_sorted                    (rbk_tree_t * const __restrict__ tree, const void * __restrict__ arr, size_t number_of_elem);
 const void*             rbk_find_data                       (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*             rbk_find_key                        (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp);
+scl_error_t             rbk_find_batch                      (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data, size_t count, const void ** const __restrict__ results);
 int32_t                 rbk_data_level                      (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 
 uint8_t                 is_rbk_empty                        (const rbk_tree_t * const __restrict__ tree);
 const void*             get_rbk_root                        (const rbk_tree_t * const __restrict__ tree);
 size_t                  get_rbk_size                        (const rbk_tree_t * const __restrict__ tree);
+scl_error_t             rbk_memory_usage                    (const rbk_tree_t * const __restrict__ tree, scl_memory_usage_t * const __restrict__ usage);
+scl_error_t             rbk_get_stats                       (const rbk_tree_t * const __restrict__ tree, scl_stats_t * const __restrict__ stats);
+scl_error_t             rbk_reset_stats                     (rbk_tree_t * const __restrict__ tree);
 
 const void*             rbk_max_data                        (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 const void*             rbk_min_data                        (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 
 scl_error_t             rbk_delete                          (rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             rbk_delete_key                      (rbk_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp);
 
 const void*             rbk_predecessor_data                (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 const void*             rbk_successor_data                  (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
@@ -92,4 +125,26 @@ scl_error_t             rbk_traverse_preorder               (const rbk_tree_t *
 scl_error_t             rbk_traverse_postorder              (const rbk_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             rbk_traverse_level                  (const rbk_tree_t * const __restrict__ tree, action_func action);
 
+const void*             rbk_iter_begin                      (const rbk_tree_t * const __restrict__ tree, rbk_tree_iter_t * const __restrict__ iter);
+const void*             rbk_iter_rbegin                     (const rbk_tree_t * const __restrict__ tree, rbk_tree_iter_t * const __restrict__ iter);
+const void*             rbk_iter_seek                       (const rbk_tree_t * const __restrict__ tree, rbk_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data);
+const void*             rbk_iter_next                       (rbk_tree_iter_t * const __restrict__ iter);
+const void*             rbk_iter_prev                       (rbk_tree_iter_t * const __restrict__ iter);
+const void*             rbk_iter_data                       (const rbk_tree_iter_t * const __restrict__ iter);
+uint32_t                rbk_iter_count                      (const rbk_tree_iter_t * const __restrict__ iter);
+
+const void*             rbk_lower_bound                     (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*             rbk_upper_bound                     (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             rbk_range                           (const rbk_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action);
+
+size_t                  rbk_total_count                     (const rbk_tree_t * const __restrict__ tree);
+const void*             rbk_select                          (const rbk_tree_t * const __restrict__ tree, size_t k);
+size_t                  rbk_rank                            (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+
+scl_error_t             rbk_join                            (rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other);
+scl_error_t             rbk_split                           (rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data, rbk_tree_t * const __restrict__ greater);
+scl_error_t             rbk_union                           (rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other);
+scl_error_t             rbk_intersection                    (rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other);
+scl_error_t             rbk_difference                      (rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other);
+
 #endif /* _RED_BLACK_TREE_UTILS_H_ */
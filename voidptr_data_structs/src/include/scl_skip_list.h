@@ -0,0 +1,98 @@
+/**
+ * @file scl_skip_list.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKIP_LIST_UTILS_H_
+#define SKIP_LIST_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/* Maximum number of levels of a skip list node */
+#define SKIP_LIST_MAX_LEVEL 32
+
+/**
+ * @brief Forward link of a skip list node on one level, span is the
+ * number of elements the link jumps over (the rank distance to the next node)
+ *
+ */
+typedef struct skip_list_link_s {
+    struct skip_list_node_s *next;                      /* Next node on this level */
+    size_t span;                                        /* Rank distance to the next node */
+} skip_list_link_t;
+
+/**
+ * @brief Skip List Node object definition, the data is stored
+ * inline after the links of the node, in the same block
+ *
+ */
+typedef struct skip_list_node_s {
+    void *data;                                         /* Pointer to data */
+    size_t level;                                       /* Number of links of the node */
+    skip_list_link_t links[];                           /* Links of the node, from the bottom level */
+} skip_list_node_t;
+
+/**
+ * @brief Indexable Skip List object definition. The elements are kept
+ * in order, every node has a random number of levels (each level with
+ * probability 1/4) and every link knows how many elements it jumps over,
+ * so ordered insert, find, delete and index lookup take expected O(log n).
+ *
+ */
+typedef struct skip_list_s {
+    skip_list_node_t *head;                             /* Sentinel node with SKIP_LIST_MAX_LEVEL links */
+    skip_list_node_t *tail;                             /* Last node of the list */
+    compare_func cmp;                                   /* function to compare items */
+    free_func frd;                                      /* function to free item */
+    size_t data_size;                                   /* Length in bytes of the data data type */
+    size_t size;                                        /* Number of elements of the list */
+    size_t level;                                       /* Number of levels in use */
+    uint64_t seed;                                      /* State of the generator of node levels */
+    const scl_allocator_t *allocator;                   /* Allocator of the object, selected at creation */
+} skip_list_t;
+
+skip_list_t*        create_skip_list        (compare_func cmp, free_func frd, size_t data_size);
+scl_error_t         free_skip_list          (skip_list_t * const __restrict__ list);
+
+uint8_t             is_skip_list_empty      (const skip_list_t * const __restrict__ list);
+size_t              get_skip_list_size      (const skip_list_t * const __restrict__ list);
+scl_error_t         skip_list_memory_usage  (const skip_list_t * const __restrict__ list, scl_memory_usage_t * const __restrict__ usage);
+const void*         get_skip_list_head      (const skip_list_t * const __restrict__ list);
+const void*         get_skip_list_tail      (const skip_list_t * const __restrict__ list);
+
+scl_error_t         skip_list_insert        (skip_list_t * const __restrict__ list, const void * __restrict__ data);
+
+const void*         skip_list_find_index    (const skip_list_t * const __restrict__ list, size_t data_index);
+const void*         skip_list_find_data     (const skip_list_t * const __restrict__ list, const void * const __restrict__ data);
+size_t              skip_list_rank          (const skip_list_t * const __restrict__ list, const void * const __restrict__ data);
+
+scl_error_t         skip_list_delete_data   (skip_list_t * const __restrict__ list, const void * const __restrict__ data);
+scl_error_t         skip_list_delete_index  (skip_list_t * const __restrict__ list, size_t data_index);
+
+scl_error_t         skip_list_traverse      (const skip_list_t * const __restrict__ list, action_func action);
+
+#endif /* SKIP_LIST_UTILS_H_ */
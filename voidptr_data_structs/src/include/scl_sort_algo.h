@@ -32,15 +32,62 @@
 #include <errno.h>
 #include "scl_priority_queue.h"
 #include "scl_config.h"
+#include "scl_thread_pool.h"
+
+/**
+ * @brief Top-k Object definition. The k lowest elements of a stream
+ * are kept in a priority queue ordered by cmp, so the top is the
+ * greatest element kept and it is replaced in place by a lower one
+ * 
+ */
+typedef struct topk_s {
+    priority_queue_t *heap;                                 /* Priority queue of the elements kept, without data */
+    compare_func cmp;                                       /* Function to compare two elements */
+    size_t k;                                               /* Maximum number of elements kept */
+    size_t elem_size;                                       /* Length in bytes of one element */
+    size_t seen;                                            /* Number of elements offered since creation */
+    const scl_allocator_t *allocator;                       /* Allocator of the object, selected at creation */
+} topk_t;
 
 scl_error_t         quick_sort          (void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
 scl_error_t         merge_sort          (void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
+scl_error_t         merge_sort_buffered (void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, void *workspace);
+scl_error_t         merge_sort_bottom_up(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, void *workspace);
+scl_error_t         tim_sort            (void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, void *workspace);
 scl_error_t         bubble_sort         (void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
 scl_error_t         radix_sort          (uint64_t *arr, size_t number_of_elem);
+scl_error_t         radix_sort_int64    (int64_t *arr, size_t number_of_elem);
+scl_error_t         radix_sort_double   (double *arr, size_t number_of_elem);
+scl_error_t         radix_sort_records  (void *arr, size_t number_of_elem, size_t arr_elem_size, radix_key_func key);
 scl_error_t         insertion_sort      (void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
 scl_error_t         selection_sort      (void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
 
+scl_error_t         nth_element         (void *arr, size_t number_of_elem, size_t nth, size_t arr_elem_size, compare_func cmp);
+scl_error_t         partial_sort        (void *arr, size_t number_of_elem, size_t k, size_t arr_elem_size, compare_func cmp);
+
+topk_t*             create_topk         (size_t k, size_t elem_size, compare_func cmp);
+scl_error_t         free_topk           (topk_t * const __restrict__ topk);
+scl_error_t         topk_push           (topk_t * const __restrict__ topk, const void * const __restrict__ elem);
+scl_error_t         topk_push_array     (topk_t * const __restrict__ topk, const void * const __restrict__ elems, size_t number_of_elem);
+const void*         topk_threshold      (const topk_t * const __restrict__ topk);
+size_t              topk_size           (const topk_t * const __restrict__ topk);
+size_t              topk_seen           (const topk_t * const __restrict__ topk);
+scl_error_t         topk_extract        (const topk_t * const __restrict__ topk, void * const __restrict__ out);
+
+scl_error_t         parallel_sort       (void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, size_t number_of_threads);
+scl_error_t         parallel_radix_sort (uint64_t *arr, size_t number_of_elem, size_t number_of_threads);
+
 scl_error_t         reverse_array       (void *arr, size_t number_of_elem, size_t arr_elem_size);
 void*               binary_search       (void *arr, void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
 
+size_t              lower_bound         (const void *arr, const void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
+size_t              upper_bound         (const void *arr, const void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
+size_t              lower_bound_uint64  (const uint64_t *arr, size_t number_of_elem, uint64_t key);
+scl_error_t         lower_bound_uint64_batch            (const uint64_t *arr, size_t number_of_elem, const uint64_t *keys, size_t number_of_keys, size_t *results);
+
+scl_error_t         eytzinger_layout                    (const void *sorted, void *eytzinger, size_t number_of_elem, size_t arr_elem_size);
+size_t              eytzinger_lower_bound               (const void *eytzinger, const void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp);
+size_t              eytzinger_lower_bound_uint64        (const uint64_t *eytzinger, size_t number_of_elem, uint64_t key);
+scl_error_t         eytzinger_lower_bound_uint64_batch  (const uint64_t *eytzinger, size_t number_of_elem, const uint64_t *keys, size_t number_of_keys, size_t *results);
+
 #endif /* SORT_ALGORITHMS_H_ */
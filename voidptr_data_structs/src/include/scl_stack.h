@@ -31,13 +31,14 @@
 #include <stdint.h>
 #include <errno.h>
 #include "scl_config.h"
+#include "scl_vector.h"
 
 /**
  * @brief stack Node object definition
  * 
  */
 typedef struct stack_node_s {
-    void *data;                     /* Pointer to data */
+    void *data;                     /* Pointer to data, stored inline after the node */
     struct stack_node_s *next;      /* Pointer to next data node */
 } stack_node_t;
 
@@ -50,14 +51,22 @@ typedef struct stack_s {
     free_func frd;                  /* Function to free one data */
     size_t data_size;               /* Length in bytes of the data data type */
     size_t size;                    /* Size of the stack */
+    vector_t array;                 /* Contiguous elements of the array mode, no array in the linked mode */
+    size_t shrink_ratio;            /* Array halves when size * shrink_ratio <= capacity (0 never shrinks) */
+    const scl_allocator_t *allocator;/* Allocator of the object, selected at creation */
 } sstack_t;
 
+/* Least number of elements of the array of a stack */
+#define STACK_ARRAY_MIN_CAPACITY 16
+
 sstack_t*       create_stack        (free_func frd, size_t data_size);
 scl_error_t     free_stack          (sstack_t * const __restrict__ stack);
 scl_error_t     print_stack         (const sstack_t * const __restrict__ stack, action_func print);
+scl_error_t     stack_use_array     (sstack_t * const __restrict__ stack, size_t initial_capacity, size_t shrink_ratio);
 
 uint8_t         is_stack_empty      (const sstack_t * const __restrict__ stack);
 size_t          get_stack_size      (const sstack_t * const __restrict__ stack);
+scl_error_t     stack_memory_usage  (const sstack_t * const __restrict__ stack, scl_memory_usage_t * const __restrict__ usage);
 
 const void*     stack_top           (const sstack_t * const __restrict__ stack);
 scl_error_t     stack_push          (sstack_t * const __restrict__ stack, const void * __restrict__ data);
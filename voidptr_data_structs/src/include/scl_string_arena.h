@@ -0,0 +1,96 @@
+/**
+ * @file scl_string_arena.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STRING_ARENA_UTILS_H_
+#define STRING_ARENA_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/* Default length in bytes of one chunk of a string arena */
+#define STRING_ARENA_CHUNK_BYTES 65536
+
+/* Number of slots of the index of an empty string arena, a power of two */
+#define STRING_ARENA_MIN_SLOTS 64
+
+/**
+ * @brief Interned string definition, stored inline into a chunk of a
+ * string arena. The hash and the length are computed once, when the
+ * string is interned. The bytes are followed by a null terminator, so
+ * they can be used as a C string (if the string has no null byte inside)
+ * 
+ */
+typedef struct scl_string_s {
+    size_t hash;                                                /* Value returned by hash_bytes for the bytes of the string */
+    size_t len;                                                 /* Number of bytes of the string, terminator excluded */
+    char bytes[];                                               /* Bytes of the string and a null terminator */
+} scl_string_t;
+
+/**
+ * @brief Chunk of a string arena, the strings are stored right after the header
+ * 
+ */
+typedef struct string_arena_chunk_s {
+    struct string_arena_chunk_s *next;                          /* Chunk allocated before this one (`NULL` for the first one) */
+    size_t used;                                                /* Number of bytes used after the header */
+    size_t capacity;                                            /* Number of bytes after the header */
+} string_arena_chunk_t;
+
+/**
+ * @brief String Arena object definition. The strings are appended to big
+ * chunks and are never moved nor freed one by one, so a handle (a pointer
+ * to an interned string) stays valid until the arena is freed. An open
+ * addressing index keeps one handle for every distinct string, so two
+ * equal strings interned by the same arena have the same handle
+ * 
+ */
+typedef struct string_arena_s {
+    string_arena_chunk_t *chunks;                               /* Chunk being filled, linked to the older ones */
+    const scl_string_t **slots;                                 /* Index of the interned strings by their hash (`NULL` slots are empty) */
+    size_t number_of_slots;                                     /* Number of index slots, always a power of two */
+    size_t chunk_bytes;                                         /* Length in bytes of one chunk */
+    size_t size;                                                /* Number of interned strings */
+    size_t string_bytes;                                        /* Number of bytes of the interned strings, terminators excluded */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} string_arena_t;
+
+string_arena_t*         create_string_arena                     (size_t chunk_bytes);
+scl_error_t             free_string_arena                       (string_arena_t * const __restrict__ arena);
+
+const scl_string_t*     string_arena_intern                     (string_arena_t * const __restrict__ arena, const char * const __restrict__ str);
+const scl_string_t*     string_arena_intern_bytes               (string_arena_t * const __restrict__ arena, const void * const __restrict__ bytes, size_t len);
+const scl_string_t*     string_arena_find                       (const string_arena_t * const __restrict__ arena, const void * const __restrict__ bytes, size_t len);
+
+size_t                  get_string_arena_size                   (const string_arena_t * const __restrict__ arena);
+scl_error_t             string_arena_memory_usage               (const string_arena_t * const __restrict__ arena, scl_memory_usage_t * const __restrict__ usage);
+
+int32_t                 compare_string_handle                   (const void * const data1, const void * const data2);
+int32_t                 compare_string_handle_lexi              (const void * const data1, const void * const data2);
+size_t                  hash_string_handle                      (const void * const data);
+
+#endif /* STRING_ARENA_UTILS_H_ */
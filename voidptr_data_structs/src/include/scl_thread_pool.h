@@ -0,0 +1,84 @@
+/**
+ * @file scl_thread_pool.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef THREAD_POOL_UTILS_H_
+#define THREAD_POOL_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "scl_config.h"
+#include "scl_work_deque.h"
+
+/**
+ * @brief Function to run one task of a batch, it gets the argument
+ * of the batch and the index of the task inside the batch
+ * 
+ */
+typedef void (*thread_pool_task_func)(void * const arg, size_t task);
+
+/**
+ * @brief Thread Pool object definition, a fixed set of worker threads
+ * that run batches of tasks. The thread calling **thread_pool_run** works
+ * on the batch too and the call returns when every task is done, so the
+ * parallel algorithms are written as a sequence of parallel phases. Every
+ * thread owns a work-stealing deque holding the tasks spawned by the tasks
+ * it runs, idle threads steal them from the other deques.
+ * 
+ */
+typedef struct thread_pool_s {
+    pthread_mutex_t lock;                                       /* Lock protecting the fields below */
+    pthread_cond_t work_cond;                                   /* Signaled when a new batch is ready or on stop */
+    pthread_cond_t done_cond;                                   /* Signaled when the last worker finished a batch */
+    thread_pool_task_func task;                                 /* Function running the tasks of the current batch */
+    void *task_arg;                                             /* Argument of the current batch */
+    size_t number_of_tasks;                                     /* Number of tasks of the current batch */
+    atomic_size_t next_task;                                    /* Index of the next task of the batch to run */
+    atomic_size_t pending_tasks;                                /* Number of batch and spawned tasks not finished yet */
+    work_deque_t **deques;                                      /* Deque of spawned tasks of every thread, the calling thread is the last one */
+    size_t number_of_deques;                                    /* Number of allocated deques */
+    size_t started_workers;                                     /* Number of workers that took their deque */
+    size_t busy_workers;                                        /* Number of workers still on the current batch */
+    size_t generation;                                          /* Number of batches handed to the workers */
+    uint8_t stop;                                               /* Set when the workers must exit */
+    pthread_t *threads;                                         /* Worker threads */
+    size_t number_of_workers;                                   /* Number of created worker threads */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} thread_pool_t;
+
+thread_pool_t*          create_thread_pool                  (size_t number_of_threads);
+scl_error_t             free_thread_pool                    (thread_pool_t * const __restrict__ pool);
+
+scl_error_t             thread_pool_run                     (thread_pool_t * const __restrict__ pool, thread_pool_task_func task, void * const arg, size_t number_of_tasks);
+scl_error_t             thread_pool_spawn                   (thread_pool_t * const __restrict__ pool, thread_pool_task_func task, void * const arg, size_t task_index);
+
+size_t                  get_thread_pool_threads             (const thread_pool_t * const __restrict__ pool);
+size_t                  get_online_processors               (void);
+
+#endif /* THREAD_POOL_UTILS_H_ */
@@ -0,0 +1,97 @@
+/**
+ * @file scl_ulist.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ULIST_UTILS_H_
+#define ULIST_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/* Length in bytes of the elements of one chunk of an unrolled list */
+#define ULIST_CHUNK_BYTES 256
+
+/* Least number of elements of one chunk of an unrolled list */
+#define ULIST_MIN_CHUNK_ELEMS 4
+
+/**
+ * @brief Unrolled Linked List Chunk object definition, the elements
+ * of the chunk are stored inline after the chunk, in the same block
+ *
+ */
+typedef struct ulist_chunk_s {
+    struct ulist_chunk_s *prev;                         /* Pointer to previous chunk */
+    struct ulist_chunk_s *next;                         /* Pointer to next chunk */
+    size_t count;                                       /* Number of elements of the chunk */
+} ulist_chunk_t;
+
+/**
+ * @brief Unrolled Linked List object definition. Every chunk holds
+ * up to chunk_capacity elements next to each other, so a traversal reads
+ * whole cache lines and an insertion in the middle moves just the
+ * elements of one chunk. Every chunk (except for a single one) is kept
+ * at least a quarter full.
+ *
+ */
+typedef struct ulist_s {
+    ulist_chunk_t *head;                                /* First chunk of the list */
+    ulist_chunk_t *tail;                                /* Last chunk of the list */
+    compare_func cmp;                                   /* function to compare items */
+    free_func frd;                                      /* function to free item */
+    size_t data_size;                                   /* Length in bytes of the data data type */
+    size_t chunk_capacity;                              /* Maximum number of elements of one chunk */
+    size_t size;                                        /* Number of elements of the list */
+    const scl_allocator_t *allocator;                   /* Allocator of the object, selected at creation */
+} ulist_t;
+
+ulist_t*        create_ulist        (compare_func cmp, free_func frd, size_t data_size);
+scl_error_t     free_ulist          (ulist_t * const __restrict__ list);
+
+uint8_t         is_ulist_empty      (const ulist_t * const __restrict__ list);
+size_t          get_ulist_size      (const ulist_t * const __restrict__ list);
+scl_error_t     ulist_memory_usage  (const ulist_t * const __restrict__ list, scl_memory_usage_t * const __restrict__ usage);
+const void*     get_ulist_head      (const ulist_t * const __restrict__ list);
+const void*     get_ulist_tail      (const ulist_t * const __restrict__ list);
+
+scl_error_t     ulist_swap_data     (const ulist_t * const __restrict__ list, const void * const __restrict__ first_data, const void * const __restrict__ second_data);
+scl_error_t     ulist_change_data   (const ulist_t * const __restrict__ list, const void * const __restrict__ base_data, const void * __restrict__ new_data);
+scl_error_t     ulist_insert        (ulist_t * const __restrict__ list, const void * __restrict__ data);
+scl_error_t     ulist_insert_order  (ulist_t * const __restrict__ list, const void * __restrict__ data);
+scl_error_t     ulist_insert_front  (ulist_t * const __restrict__ list, const void * __restrict__ data);
+scl_error_t     ulist_insert_index  (ulist_t * const __restrict__ list, const void * __restrict__ data, size_t data_index);
+
+const void*     ulist_find_index    (const ulist_t * const __restrict__ list, size_t data_index);
+const void*     ulist_find_data     (const ulist_t * const __restrict__ list, const void * const __restrict__ data);
+
+scl_error_t     ulist_delete_data   (ulist_t * const __restrict__ list, const void * const __restrict__ data);
+scl_error_t     ulist_delete_index  (ulist_t * const __restrict__ list, size_t data_index);
+scl_error_t     ulist_erase         (ulist_t * const __restrict__ list, size_t left_index, size_t right_index);
+
+ulist_t*        ulist_filter        (const ulist_t * const __restrict__ list, filter_func filter);
+scl_error_t     ulist_traverse      (const ulist_t * const __restrict__ list, action_func action);
+
+#endif /* ULIST_UTILS_H_ */
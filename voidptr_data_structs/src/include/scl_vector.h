@@ -0,0 +1,82 @@
+/**
+ * @file scl_vector.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef VECTOR_UTILS_H_
+#define VECTOR_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/* Least number of elements of the array after the first growth */
+#define VECTOR_MIN_CAPACITY 16
+
+/**
+ * @brief Vector object definition, a dynamic array of elements stored
+ * inline one after another. The array doubles when it is full, so a push
+ * at the end takes amortized O(1). A vector may be created on heap or
+ * embedded inside another object (see vector_init).
+ *
+ */
+typedef struct vector_s {
+    uint8_t *data;                                      /* Contiguous elements or `NULL` if nothing is allocated */
+    free_func frd;                                      /* Function to free one element */
+    size_t data_size;                                   /* Length in bytes of the data data type */
+    size_t size;                                        /* Number of elements of the vector */
+    size_t capacity;                                    /* Number of elements the array can hold */
+    const scl_allocator_t *allocator;                   /* Allocator of the array */
+} vector_t;
+
+vector_t*       create_vector           (free_func frd, size_t data_size);
+scl_error_t     free_vector             (vector_t * const __restrict__ vec);
+
+scl_error_t     vector_init             (vector_t * const __restrict__ vec, free_func frd, size_t data_size, const scl_allocator_t * const __restrict__ allocator);
+scl_error_t     vector_release          (vector_t * const __restrict__ vec);
+
+uint8_t         is_vector_empty         (const vector_t * const __restrict__ vec);
+size_t          get_vector_size         (const vector_t * const __restrict__ vec);
+scl_error_t     vector_memory_usage     (const vector_t * const __restrict__ vec, scl_memory_usage_t * const __restrict__ usage);
+size_t          get_vector_capacity     (const vector_t * const __restrict__ vec);
+
+void*           vector_data             (const vector_t * const __restrict__ vec);
+void*           vector_at               (const vector_t * const __restrict__ vec, size_t data_index);
+void*           vector_back             (const vector_t * const __restrict__ vec);
+
+scl_error_t     vector_reserve          (vector_t * const __restrict__ vec, size_t capacity);
+scl_error_t     vector_shrink           (vector_t * const __restrict__ vec, size_t capacity);
+scl_error_t     vector_shrink_to_fit    (vector_t * const __restrict__ vec);
+
+scl_error_t     vector_push_back        (vector_t * const __restrict__ vec, const void * __restrict__ data);
+scl_error_t     vector_pop_back         (vector_t * const __restrict__ vec);
+scl_error_t     vector_insert           (vector_t * const __restrict__ vec, const void * __restrict__ data, size_t data_index);
+scl_error_t     vector_append           (vector_t * const __restrict__ vec, const void * __restrict__ arr, size_t number_of_elem);
+scl_error_t     vector_erase            (vector_t * const __restrict__ vec, size_t left_index, size_t right_index);
+scl_error_t     vector_clear            (vector_t * const __restrict__ vec);
+
+scl_error_t     vector_traverse         (const vector_t * const __restrict__ vec, action_func action);
+
+#endif /* VECTOR_UTILS_H_ */
@@ -0,0 +1,78 @@
+/**
+ * @file scl_work_deque.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef WORK_DEQUE_UTILS_H_
+#define WORK_DEQUE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include "scl_config.h"
+
+/* Size in bytes of one cache line, the owner end and the thieves end live on their own lines */
+#define WORK_DEQUE_ALIGN 64
+
+/* Least number of items of the array of a work-stealing deque */
+#define WORK_DEQUE_MIN_CAPACITY 64
+
+/**
+ * @brief Circular array of a work-stealing deque. When the owner grows
+ * the deque the old array is kept (thieves may still read it) until the
+ * deque is freed.
+ *
+ */
+typedef struct work_deque_array_s {
+    struct work_deque_array_s *previous;                        /* Array replaced by this one or `NULL` */
+    int64_t capacity;                                           /* Number of items of the array (a power of two) */
+    _Atomic(void *) items[];                                    /* Items of the deque, indexed modulo capacity */
+} work_deque_array_t;
+
+/**
+ * @brief Lock-free work-stealing deque object definition (Chase-Lev).
+ * One owner thread pushes and pops items on the bottom end (LIFO), any
+ * other thread may steal items from the top end (FIFO). The items are
+ * opaque pointers, usually pointers to tasks.
+ *
+ */
+typedef struct work_deque_s {
+    _Alignas(WORK_DEQUE_ALIGN) _Atomic int64_t top;             /* Index of the next item to steal */
+    _Alignas(WORK_DEQUE_ALIGN) _Atomic int64_t bottom;          /* Index of the next item to push, written by the owner */
+    _Atomic(work_deque_array_t *) array;                        /* Current circular array of items */
+    void *memory;                                               /* Block holding the deque object (not aligned) */
+    const scl_allocator_t *allocator;                           /* Allocator of the object, selected at creation */
+} work_deque_t;
+
+work_deque_t*           create_work_deque                   (size_t initial_capacity);
+scl_error_t             free_work_deque                     (work_deque_t * const __restrict__ deque);
+
+scl_error_t             work_deque_push                     (work_deque_t * const __restrict__ deque, void * const item);
+scl_error_t             work_deque_pop                      (work_deque_t * const __restrict__ deque, void ** const __restrict__ item);
+scl_error_t             work_deque_steal                    (work_deque_t * const __restrict__ deque, void ** const __restrict__ item);
+
+size_t                  get_work_deque_size                 (const work_deque_t * const __restrict__ deque);
+
+#endif /* WORK_DEQUE_UTILS_H_ */
@@ -32,6 +32,21 @@
  */
 #define _MAX(A, B) (((A) >= (B))?(A):(B))
 
+/**
+ * @brief Function to compare two elements of an avl tree and count the
+ * comparison. MUST not be used outside this file.
+ * 
+ * @param tree an allocated avl tree object
+ * @param data1 pointer to the first element
+ * @param data2 pointer to the second element
+ * @return int32_t result of the compare function of the tree
+ */
+static inline int32_t avl_compare(const avl_tree_t * const __restrict__ tree, const void * const data1, const void * const data2) {
+    SCL_STATS_ADD(tree, comparisons, 1);
+
+    return tree->cmp(data1, data2);
+}
+
 /**
  * @brief Create an avl object. Allocation may fail if there
  * is not enough memory on heap or cmp function is not valid
@@ -57,23 +72,28 @@ avl_tree_t* create_avl(compare_func cmp, free_func frd, size_t data_size) {
         return NULL;
     }
 
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new avl tree object on heap */
-    avl_tree_t *new_tree = malloc(sizeof(*new_tree));
+    avl_tree_t *new_tree = scl_malloc(allocator, sizeof(*new_tree));
 
     /* Check if avl tree object was allocated */
     if (NULL != new_tree) {
+        new_tree->allocator = allocator;
 
         /* Set function pointers */
         new_tree->cmp = cmp;
         new_tree->frd = frd;
 
         /* Create `nil` node */
-        new_tree->nil = malloc(sizeof(*new_tree->nil));
+        new_tree->nil = scl_malloc(allocator, sizeof(*new_tree->nil));
 
         /* Set default values for a `nil` cell*/
         if (NULL != new_tree->nil) {
             new_tree->nil->data = NULL;
             new_tree->nil->count = 1;
+            new_tree->nil->weight = 0;
             new_tree->nil->height = 0;
             new_tree->nil->left = new_tree->nil->right = new_tree->nil;
             new_tree->nil->parent = new_tree->nil;
@@ -86,6 +106,9 @@ avl_tree_t* create_avl(compare_func cmp, free_func frd, size_t data_size) {
         new_tree->root = new_tree->nil;
         new_tree->data_size = data_size;
         new_tree->size = 0;
+        new_tree->node_pool = NULL;
+        new_tree->order_stats = 0;
+        (void)SCL_STATS_RESET(new_tree);
     } else {
         errno = ENOMEM;
         perror("Not enough memory for avl allocation");
@@ -111,36 +134,34 @@ static avl_tree_node_t* create_avl_node(const avl_tree_t * const __restrict__ tr
         return tree->nil;
     }
 
-    /* Allocate a new node on the heap */
-    avl_tree_node_t *new_node = malloc(sizeof(*new_node));
+    /* Allocate a new node from the node pool or on the heap */
+    avl_tree_node_t *new_node = NULL;
+
+    if (NULL != tree->node_pool) {
+        new_node = mem_pool_alloc(tree->node_pool);
+    } else {
+        new_node = scl_malloc(tree->allocator, SCL_ALIGN_SIZE(sizeof(*new_node)) + tree->data_size);
+    }
 
     /* Check if allocation went successfully */
     if (NULL != new_node) {
+        SCL_STATS_ADD(tree, allocations, 1);
 
         /* Set default node data */
         new_node->right = new_node->left = tree->nil;
         new_node->parent = tree->nil;
         new_node->count = 1;
+        new_node->weight = 1;
         new_node->height = 1;
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(tree->data_size);
-
-        /* Check if memory allocation went right */
-        if (NULL != new_node->data) {
-
-            /*
-             * Copy all bytes from data pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->data, data, tree->data_size);
-        } else {
-            free(new_node);
-            new_node = tree->nil;
+        /* The data is stored inline, right after the node, in the same block */
+        new_node->data = (uint8_t *)new_node + SCL_ALIGN_SIZE(sizeof(*new_node));
 
-            errno = ENOMEM;
-            perror("Not enough memory for node avl data allocation");
-        }
+        /*
+         * Copy all bytes from data pointer
+         * to memory allocated on heap
+         */
+        memcpy(new_node->data, data, tree->data_size);
     } else {
         new_node = tree->nil;
         errno = ENOMEM;
@@ -152,42 +173,51 @@ static avl_tree_node_t* create_avl_node(const avl_tree_t * const __restrict__ tr
 }
 
 /**
- * @brief A helper function for free_avl function.
- * Function will iterate through all nodes recursively
- * by Left-Right-Root principle.
+ * @brief A helper function for free_avl function. The nodes are
+ * freed without recursion: the left child of the current node is
+ * rotated up until the node has no left child, then the node is
+ * freed and its right child becomes the current node. The rotations
+ * do not update the heights or the parent links, the nodes are freed
+ * anyway. Every node is visited O(1) times.
  * 
  * @param tree an allocated avl tree object
- * @param root pointer to pointer of current avl node object
+ * @param root pointer to pointer of the root avl node object
  */
 static void free_avl_helper(const avl_tree_t * const __restrict__ tree, avl_tree_node_t ** const __restrict__ root) {
-    /* Check if current node is valid */
-    if (tree->nil == *root) {
-        return;
-    }
+    avl_tree_node_t *iterator = *root;
 
-    /* Recursive calls */
-    free_avl_helper(tree, &(*root)->left);
-    free_avl_helper(tree, &(*root)->right);
+    while (tree->nil != iterator) {
+        if (tree->nil != iterator->left) {
 
-    /* Free content of the data pointer */
-    if ((NULL != tree->frd) && (NULL != (*root)->data)) {
-        tree->frd((*root)->data);
-    }
+            /* Rotate the left child up, the tree becomes a right chain */
+            avl_tree_node_t *left_node = iterator->left;
 
-    /* Free data pointer */
-    if (NULL != (*root)->data) {
-        free((*root)->data);
-    }
+            iterator->left = left_node->right;
+            left_node->right = iterator;
+            iterator = left_node;
+        } else {
+            avl_tree_node_t *right_node = iterator->right;
 
-    /* Set data pointer as NULL */
-    (*root)->data = NULL;
+            /* Free content of the data pointer */
+            if ((NULL != tree->frd) && (NULL != iterator->data)) {
+                tree->frd(iterator->data);
+            }
 
-    /* Free avl node pointer */
-    if (tree->nil != *root) {
-        free(*root);
+            /* Set data pointer as NULL */
+            iterator->data = NULL;
 
-        *root = tree->nil;
+            /* Free avl node pointer */
+            if (NULL != tree->node_pool) {
+                mem_pool_free(tree->node_pool, iterator);
+            } else {
+                scl_free(tree->allocator, iterator);
+            }
+
+            iterator = right_node;
+        }
     }
+
+    *root = tree->nil;
 }
 
 /**
@@ -206,15 +236,23 @@ scl_error_t free_avl(avl_tree_t * const __restrict__ tree) {
     if (NULL != tree) {
 
         /* Free every node from avl -> tree */
-        free_avl_helper(tree, &tree->root);
+        if ((NULL == tree->node_pool) || (NULL != tree->frd)) {
+            free_avl_helper(tree, &tree->root);
+        }
+
+        /* Free all chunks of the node pool at once */
+        if (NULL != tree->node_pool) {
+            free_mem_pool(tree->node_pool);
+            tree->node_pool = NULL;
+        }
         
         /* Free `nil` cell*/
-        free(tree->nil);
+        scl_free(tree->allocator, tree->nil);
 
         tree->nil = NULL;        
 
         /* Free avl tree object */
-        free(tree);
+        scl_free(tree->allocator, tree);
 
         return SCL_OK;
     }
@@ -222,6 +260,98 @@ scl_error_t free_avl(avl_tree_t * const __restrict__ tree) {
     return SCL_NULL_AVL;
 }
 
+/**
+ * @brief Function to make the avl tree allocate its nodes from a node pool.
+ * Every node and its data are stored in one object of the pool, the objects
+ * are taken from contiguous chunks and are reused through a free list, and
+ * free_avl releases whole chunks (without visiting the nodes if no free
+ * function was provided). The avl tree must be empty.
+ * 
+ * @param tree an allocated avl tree object
+ * @param nodes_per_chunk number of nodes from one chunk of the pool (0 for default)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_use_node_pool(avl_tree_t * const __restrict__ tree, size_t nodes_per_chunk) {
+    /* Check if tree is allocated */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    /* Nodes allocated on the heap cannot be moved into a pool */
+    if (0 != tree->size) {
+        return SCL_NOT_EMPTY_OBJECT_FOR_POOL;
+    }
+
+    /* Tree already uses a node pool */
+    if (NULL != tree->node_pool) {
+        return SCL_OK;
+    }
+
+    /* The pool takes its chunks from the allocator of the object */
+    const scl_allocator_t *thread_allocator = scl_get_allocator();
+
+    scl_set_allocator(tree->allocator);
+
+    /* One object of the pool holds the node and its data */
+    tree->node_pool = create_mem_pool(SCL_ALIGN_SIZE(sizeof(*tree->root)) + tree->data_size, nodes_per_chunk);
+    scl_set_allocator(thread_allocator);
+
+    /* Check if node pool was allocated successfully */
+    if (NULL == tree->node_pool) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Helper function for avl_use_order_stats function. Function will
+ * set the weight of every node by Left-Right-Root principle.
+ * 
+ * @param tree an allocated avl tree object
+ * @param root starting point of the avl tree subtree
+ * @return size_t the weight of the subtree
+ */
+static size_t avl_order_stats_helper(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const __restrict__ root) {
+    /* The `nil` node has no elements */
+    if (tree->nil == root) {
+        return 0;
+    }
+
+    root->weight = avl_order_stats_helper(tree, root->left) + avl_order_stats_helper(tree, root->right) + root->count;
+
+    return root->weight;
+}
+
+/**
+ * @brief Function to make every node of an avl tree keep the number of
+ * elements from its subtree (its weight, equal elements are counted separately),
+ * so that avl_select and avl_rank work in O(logN) time. The weights are
+ * updated by every insertion, deletion and rotation. If the tree is not empty
+ * the weights are computed in O(N) time.
+ * 
+ * @param tree an allocated avl tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_use_order_stats(avl_tree_t * const __restrict__ tree) {
+    /* Check if tree is allocated */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    /* Tree already keeps the weights */
+    if (0 != tree->order_stats) {
+        return SCL_OK;
+    }
+
+    avl_order_stats_helper(tree, tree->root);
+    tree->order_stats = 1;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to update the height of a node that is broken.
  * Function may fail if the selected node is `nil`.
@@ -235,6 +365,11 @@ static void avl_update_node_height(const avl_tree_t * const __restrict__ tree, a
 
         /* Update node height */
         fix_node->height = _MAX(fix_node->left->height, fix_node->right->height) + 1;
+
+        /* Update node weight */
+        if (0 != tree->order_stats) {
+            fix_node->weight = fix_node->left->weight + fix_node->right->weight + fix_node->count;
+        }
     }
 }
 
@@ -253,6 +388,8 @@ static void avl_rotate_left(avl_tree_t * const __restrict__ tree, avl_tree_node_
         return;
     }
 
+    SCL_STATS_ADD(tree, rotations, 1);
+
     /* Check if rotation may happen */
     if (tree->nil == fix_node->right) {
         return;
@@ -280,7 +417,7 @@ static void avl_rotate_left(avl_tree_t * const __restrict__ tree, avl_tree_node_
 
     /* Update new sub-root links to the rest of tree */
     if (tree->nil != rotate_node->parent) {
-        if (tree->cmp(rotate_node->data, rotate_node->parent->data) >= 1) {
+        if (avl_compare(tree, rotate_node->data, rotate_node->parent->data) >= 1) {
             rotate_node->parent->right = rotate_node;
         } else {
             rotate_node->parent->left = rotate_node;
@@ -309,6 +446,8 @@ static void avl_rotate_right(avl_tree_t * const __restrict__ tree, avl_tree_node
         return;
     }
 
+    SCL_STATS_ADD(tree, rotations, 1);
+
     /* Check if rotation may happen */
     if (tree->nil == fix_node->left) {
         return;
@@ -336,7 +475,7 @@ static void avl_rotate_right(avl_tree_t * const __restrict__ tree, avl_tree_node
 
     /* Update new sub-root links to the rest of tree */
     if (tree->nil != rotate_node->parent) {
-        if (tree->cmp(rotate_node->data, rotate_node->parent->data) >= 1) {
+        if (avl_compare(tree, rotate_node->data, rotate_node->parent->data) >= 1) {
             rotate_node->parent->right = rotate_node;
         } else {
             rotate_node->parent->left = rotate_node;
@@ -452,9 +591,9 @@ scl_error_t avl_insert(avl_tree_t * const __restrict__ tree, const void * __rest
     while (tree->nil != iterator) {
         parent_iterator = iterator;
 
-        if (tree->cmp(iterator->data, data) >= 1) {
+        if (avl_compare(tree, iterator->data, data) >= 1) {
             iterator = iterator->left;
-        } else if (tree->cmp(iterator->data, data) <= -1) {
+        } else if (avl_compare(tree, iterator->data, data) <= -1) {
             iterator = iterator->right;
         } else {
 
@@ -463,6 +602,14 @@ scl_error_t avl_insert(avl_tree_t * const __restrict__ tree, const void * __rest
              * increment count value of node
              */
             ++(iterator->count);
+
+            /* The node and its ancestors hold one more element */
+            if (0 != tree->order_stats) {
+                for (avl_tree_node_t *weight_iterator = iterator; tree->nil != weight_iterator; weight_iterator = weight_iterator->parent) {
+                    ++(weight_iterator->weight);
+                }
+            }
+
             return 0;
         }
     }
@@ -483,7 +630,7 @@ scl_error_t avl_insert(avl_tree_t * const __restrict__ tree, const void * __rest
         new_node->parent = parent_iterator;
 
         /* Update children links */
-        if (tree->cmp(parent_iterator->data, new_node->data) >= 1) {
+        if (avl_compare(tree, parent_iterator->data, new_node->data) >= 1) {
             parent_iterator->left = new_node;
         } else {
             parent_iterator->right = new_node;
@@ -504,6 +651,141 @@ scl_error_t avl_insert(avl_tree_t * const __restrict__ tree, const void * __rest
     return err;
 }
 
+/**
+ * @brief Function to link a chain of avl tree nodes, kept in order through
+ * their right links, into a perfectly balanced subtree. The first half
+ * of the nodes goes into the left subtree, the next node becomes the root
+ * and the rest of the nodes go into the right subtree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param chain pointer to the first node of the chain, moved after the used nodes
+ * @param number_of_nodes number of nodes of the subtree
+ * @return avl_tree_node_t* the root of the subtree or `nil`
+ */
+static avl_tree_node_t* avl_build_sorted_helper(const avl_tree_t * const __restrict__ tree, avl_tree_node_t ** const __restrict__ chain, size_t number_of_nodes) {
+    /* Empty subtree */
+    if (0 == number_of_nodes) {
+        return tree->nil;
+    }
+
+    avl_tree_node_t *left_node = avl_build_sorted_helper(tree, chain, number_of_nodes / 2);
+
+    /* The next node of the chain is the root of the subtree */
+    avl_tree_node_t *root = *chain;
+    *chain = root->right;
+
+    avl_tree_node_t *right_node = avl_build_sorted_helper(tree, chain, number_of_nodes - number_of_nodes / 2 - 1);
+
+    /* Update the links of the root */
+    root->left = left_node;
+    root->right = right_node;
+    root->parent = tree->nil;
+
+    if (tree->nil != left_node) {
+        left_node->parent = root;
+    }
+
+    if (tree->nil != right_node) {
+        right_node->parent = root;
+    }
+
+    /* Update the height of the root */
+    root->height = _MAX(left_node->height, right_node->height) + 1;
+    root->weight = left_node->weight + right_node->weight + root->count;
+
+    return root;
+}
+
+/**
+ * @brief Function to build an avl tree from an array sorted in ascending
+ * order (according to the compare function) in O(N) time, instead of N
+ * insertions. The nodes are allocated in one pass and linked into a
+ * perfectly balanced tree, every height is set while linking. Equal neighbour elements are merged
+ * into one node, as avl_insert does. The tree must be empty.
+ * 
+ * @param tree an allocated avl tree object
+ * @param arr pointer to the first element of the sorted array
+ * @param number_of_elem number of elements of the array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_build_sorted(avl_tree_t * const __restrict__ tree, const void * __restrict__ arr, size_t number_of_elem) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (((NULL == arr) && (0 != number_of_elem)) || (0 != tree->size)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const uint8_t * const data = arr;
+    size_t number_of_nodes = 0;
+
+    /* Check the order of the array and count the distinct elements */
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        int32_t cmp = (0 == iter) ? -1 : avl_compare(tree, data + (iter - 1) * tree->data_size, data + iter * tree->data_size);
+
+        if (cmp >= 1) {
+            return SCL_INVALID_INPUT;
+        }
+
+        if (cmp <= -1) {
+            ++number_of_nodes;
+        }
+    }
+
+    /* All the nodes are taken from one chunk of the node pool */
+    if ((NULL != tree->node_pool) && (SCL_OK != mem_pool_reserve(tree->node_pool, number_of_nodes))) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    /* Create the nodes in order, chained through their right links */
+    avl_tree_node_t *chain = tree->nil;
+    avl_tree_node_t *last_node = tree->nil;
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        if ((tree->nil != last_node) && (0 == avl_compare(tree, last_node->data, data + iter * tree->data_size))) {
+            ++(last_node->count);
+            continue;
+        }
+
+        avl_tree_node_t *new_node = create_avl_node(tree, data + iter * tree->data_size);
+
+        if (tree->nil == new_node) {
+
+            /* Free the created nodes, their data belongs to the array */
+            while (tree->nil != chain) {
+                avl_tree_node_t *next_node = chain->right;
+
+                if (NULL != tree->node_pool) {
+                    mem_pool_free(tree->node_pool, chain);
+                } else {
+                    scl_free(tree->allocator, chain);
+                }
+
+                chain = next_node;
+            }
+
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        if (tree->nil == last_node) {
+            chain = new_node;
+        } else {
+            last_node->right = new_node;
+        }
+
+        last_node = new_node;
+    }
+
+    /* Link the nodes into a perfectly balanced tree */
+    tree->root = avl_build_sorted_helper(tree, &chain, number_of_nodes);
+    tree->size = number_of_nodes;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to search data in avl tree O(log N).
  * Function will start searching from avl tree root and will
@@ -525,9 +807,9 @@ static avl_tree_node_t* avl_find_node(const avl_tree_t * const __restrict__ tree
 
     /* Search for input data (void *data) in all tree */
     while (tree->nil != iterator) {
-        if (tree->cmp(iterator->data, data) <= -1) {
+        if (avl_compare(tree, iterator->data, data) <= -1) {
             iterator = iterator->right;
-        } else if (tree->cmp(iterator->data, data) >= 1) {
+        } else if (avl_compare(tree, iterator->data, data) >= 1) {
             iterator = iterator->left;
         } else {
             return iterator;
@@ -558,6 +840,57 @@ const void* avl_find_data(const avl_tree_t * const __restrict__ tree, const void
     return avl_find_node(tree, data)->data;
 }
 
+/**
+ * @brief Function to search the node of an avl tree whose data matches
+ * a key O(log N). key_cmp(key, data) must order the keys exactly like the
+ * compare function of the tree orders the data, so only the key has to be
+ * built for the search.
+ * 
+ * @param tree an allocated avl tree object
+ * @param key pointer to the key to search for
+ * @param key_cmp function to compare a key with the data of a node
+ * @return avl_tree_node_t* the node matching the key or `nil` if no such node exists
+ */
+static avl_tree_node_t* avl_find_key_node(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    avl_tree_node_t *iterator = tree->root;
+
+    /* Search for the key in all tree */
+    while (tree->nil != iterator) {
+        int32_t cmp = key_cmp(key, iterator->data);
+        SCL_STATS_ADD(tree, comparisons, 1);
+
+        if (cmp < 0) {
+            iterator = iterator->left;
+        } else if (cmp > 0) {
+            iterator = iterator->right;
+        } else {
+            return iterator;
+        }
+    }
+
+    /* Key was not found */
+    return tree->nil;
+}
+
+/**
+ * @brief Function to search data in an avl tree by a key O(log N),
+ * without building a whole data object to compare against.
+ * 
+ * @param tree an allocated avl tree object
+ * @param key pointer to the key to search for
+ * @param key_cmp function to compare a key with the data of a node,
+ * negative if key is before the data, zero if it matches and positive if it is after
+ * @return const void* the data matching the key or `NULL` if it is not found
+ */
+const void* avl_find_key(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == key) || (NULL == key_cmp)) {
+        return NULL;
+    }
+
+    return avl_find_key_node(tree, key, key_cmp)->data;
+}
+
 /**
  * @brief Function to swap two nodes from an avl tree object.
  * This function MUST NOT be used by users, because it will
@@ -732,6 +1065,88 @@ size_t get_avl_size(const avl_tree_t * const __restrict__ tree) {
     return tree->size;
 }
 
+/**
+ * @brief Function to get the memory footprint of an avl tree. Every node
+ * holds one element inline, so the node bytes are the per node overhead
+ * (links, counters and padding) and the payload is size * data_size.
+ * With a node pool the chunk headers are counted as node bytes and the
+ * free objects of the pool as slack.
+ * 
+ * @param tree an allocated avl tree object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_memory_usage(const avl_tree_t * const __restrict__ tree, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* The tree object and its `nil` node */
+    usage->object_bytes = sizeof(*tree) + sizeof(*tree->nil);
+    usage->payload_bytes = tree->size * tree->data_size;
+    usage->array_bytes = 0;
+    usage->nodes = tree->size;
+
+    if (NULL != tree->node_pool) {
+        scl_memory_usage_t pool_usage;
+        mem_pool_memory_usage(tree->node_pool, &pool_usage);
+
+        /* Every node fills one object of the pool, the rest of the object is overhead */
+        usage->object_bytes += pool_usage.object_bytes;
+        usage->node_bytes = pool_usage.node_bytes + pool_usage.payload_bytes - usage->payload_bytes;
+        usage->slack_bytes = pool_usage.slack_bytes;
+    } else {
+        usage->node_bytes = tree->size * SCL_ALIGN_SIZE(sizeof(*tree->nil));
+        usage->slack_bytes = 0;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the operation counters of an avl tree, comparisons, node allocations and rotations.
+ * The counters are kept only when the library is built with SCL_STATS.
+ * 
+ * @param tree an allocated avl tree object
+ * @param stats pointer to the counters to fill (set to zero without SCL_STATS)
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t avl_get_stats(const avl_tree_t * const __restrict__ tree, scl_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return SCL_STATS_GET(tree, stats);
+}
+
+/**
+ * @brief Function to set the operation counters of an avl tree to zero.
+ * 
+ * @param tree an allocated avl tree object
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t avl_reset_stats(avl_tree_t * const __restrict__ tree) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    return SCL_STATS_RESET(tree);
+}
+
 /**
  * @brief Function to get node with maximum data value.
  * Function will search the maximum considering root node
@@ -871,37 +1286,15 @@ static scl_error_t avl_delete_fix_node_up(avl_tree_t * const __restrict__ tree,
 }
 
 /**
- * @brief Function to delete one generic data from a avl.
- * Function may fail if input data is not valid or if
- * changing the data fails. You can delete one data at a time
- * and MUST specify a valid avl tree and a valid data pointer
+ * @brief Helper function to unlink and free a found node of an avl tree
+ * and to rebalance the tree after it. Used by the delete by data and
+ * the delete by key functions.
  * 
  * @param tree an allocated avl tree object
- * @param data pointer to an address of a generic data to be deleted
+ * @param delete_node the node to delete, not `nil`
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
-    /* Check if input data is valid */
-    if (NULL == tree) {
-        return SCL_NULL_AVL;
-    }
-
-    if (tree->nil == tree->root) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
-    }
-
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
-    }
-
-    /* Find current node (root) in avl tree */
-    avl_tree_node_t *delete_node = avl_find_node(tree, data);
-
-    /* Bst node was not found exit process */
-    if (tree->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
-
+static scl_error_t avl_delete_node(avl_tree_t * const __restrict__ tree, avl_tree_node_t *delete_node) {
     /* Delete selected node */
     if ((tree->nil != delete_node->left) && (tree->nil != delete_node->right)) {
 
@@ -996,17 +1389,16 @@ scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const
         tree->frd(delete_node->data);
     }
 
-    /* Free data pointer of selected node */
-    if (NULL != delete_node->data) {
-        free(delete_node->data);
-    }
-
     /* Set data pointer as NULL */
     delete_node->data = NULL;
 
     /* Free selected avl node pointer */
     if (tree->nil != delete_node) {
-        free(delete_node);
+        if (NULL != tree->node_pool) {
+            mem_pool_free(tree->node_pool, delete_node);
+        } else {
+            scl_free(tree->allocator, delete_node);
+        }
     }
 
     /* Set selected avl node as NULL */
@@ -1023,6 +1415,75 @@ scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const
     return avl_delete_fix_node_up(tree, parent_delete_node);
 }
 
+/**
+ * @brief Function to delete one generic data from a avl.
+ * Function may fail if input data is not valid or if
+ * changing the data fails. You can delete one data at a time
+ * and MUST specify a valid avl tree and a valid data pointer
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to an address of a generic data to be deleted
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Find current node (root) in avl tree */
+    avl_tree_node_t *delete_node = avl_find_node(tree, data);
+
+    /* Bst node was not found exit process */
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return avl_delete_node(tree, delete_node);
+}
+
+/**
+ * @brief Function to delete the data of an avl tree that matches a key,
+ * without building a whole data object to compare against. Function may
+ * fail if the tree is empty or if no data matches the key.
+ * 
+ * @param tree an allocated avl tree object
+ * @param key pointer to the key of the data to be deleted
+ * @param key_cmp function to compare a key with the data of a node,
+ * negative if key is before the data, zero if it matches and positive if it is after
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_delete_key(avl_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if ((NULL == key) || (NULL == key_cmp)) {
+        return SCL_INVALID_DATA;
+    }
+
+    avl_tree_node_t *delete_node = avl_find_key_node(tree, key, key_cmp);
+
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return avl_delete_node(tree, delete_node);
+}
+
 /**
  * @brief Function to search the inorder predecessor for
  * a specified data type value. Function may fail if
@@ -1191,9 +1652,9 @@ static avl_tree_node_t* avl_lowest_common_ancestor_node(const avl_tree_t * const
 
     /* Find the lowest common ancestor */
     while (tree->nil != iterator) {
-        if ((tree->cmp(iterator->data, data1) >= 1) && (tree->cmp(iterator->data, data2) >= 1)) {
+        if ((avl_compare(tree, iterator->data, data1) >= 1) && (avl_compare(tree, iterator->data, data2) >= 1)) {
             iterator = iterator->left;
-        } else if ((tree->cmp(iterator->data, data1) <= -1) && (tree->cmp(iterator->data, data2) <= -1)) {
+        } else if ((avl_compare(tree, iterator->data, data1) <= -1) && (avl_compare(tree, iterator->data, data2) <= -1)) {
             iterator = iterator->right;
         } else {
 
@@ -1232,27 +1693,49 @@ const void* avl_lowest_common_ancestor_data(const avl_tree_t * const __restrict_
 
 /**
  * @brief Helper function for avl_traverse_inorder function.
- * This method will recursively iterate through all nodes by
- * Left-Root-Right principle.
+ * This method will iterate through all nodes by Left-Root-Right
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated avl tree object
  * @param root starting point of the avl tree traversal
  * @param action a pointer function to perform an action on one avl node object
  */
 static void avl_traverse_inorder_helper(const avl_tree_t * const __restrict__ tree, const avl_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working avl node is not `nil` */
+    /* Check if current working node is not `nil` */
     if (tree->nil == root) {
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    avl_traverse_inorder_helper(tree, root->left, action);
-    
-    /* Call action function */
-    action(root->data);
+    const avl_tree_node_t *iterator = root;
+
+    while (tree->nil != iterator->left) {
+        iterator = iterator->left;
+    }
+
+    while (tree->nil != iterator) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (tree->nil != iterator->right) {
+
+            /* The next node is the leftmost node of the right sub-tree */
+            iterator = iterator->right;
+
+            while (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            }
+        } else {
+
+            /* The next node is the first ancestor reached from its left sub-tree */
+            while ((root != iterator) && (iterator->parent->right == iterator)) {
+                iterator = iterator->parent;
+            }
 
-    /* Traverse in the right sub-tree */
-    avl_traverse_inorder_helper(tree, root->right, action);
+            iterator = (root == iterator) ? tree->nil : iterator->parent;
+        }
+    }
 }
 
 /**
@@ -1295,27 +1778,36 @@ scl_error_t avl_traverse_inorder(const avl_tree_t * const __restrict__ tree, act
 
 /**
  * @brief Helper function for avl_traverse_preorder function.
- * This method will recursively iterate through all nodes by
- * Root-Left-Right principle.
+ * This method will iterate through all nodes by Root-Left-Right
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated avl tree object
  * @param root starting point of the avl tree traversal
  * @param action a pointer function to perform an action on one avl node object
  */
 static void avl_traverse_preorder_helper(const avl_tree_t * const __restrict__ tree, const avl_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working avl node is not `nil` */
-    if (tree->nil == root) {
-        return;
-    }
+    const avl_tree_node_t *iterator = root;
+
+    while (tree->nil != iterator) {
+
+        /* Call action function */
+        action(iterator->data);
 
-    /* Call action function */
-    action(root->data);
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
 
-    /* Traverse in the left sub-tree */
-    avl_traverse_preorder_helper(tree, root->left, action);
+            /* Climb to the first ancestor with a right sub-tree not visited yet */
+            while ((root != iterator) && ((iterator->parent->right == iterator) || (tree->nil == iterator->parent->right))) {
+                iterator = iterator->parent;
+            }
 
-    /* Traverse in the right sub-tree */
-    avl_traverse_preorder_helper(tree, root->right, action);
+            iterator = (root == iterator) ? tree->nil : iterator->parent->right;
+        }
+    }
 }
 
 /**
@@ -1354,29 +1846,62 @@ scl_error_t avl_traverse_preorder(const avl_tree_t * const __restrict__ tree, ac
     return SCL_OK;
 }
 
+/**
+ * @brief Helper function to find the first node of a subtree in
+ * postorder (the deepest node reached by going left whenever possible).
+ * 
+ * @param tree an allocated avl tree object
+ * @param root root of a subtree
+ * @return const avl_tree_node_t* the first node of the subtree in postorder
+ */
+static const avl_tree_node_t* avl_traverse_postorder_first(const avl_tree_t * const __restrict__ tree, const avl_tree_node_t *root) {
+    while (1) {
+        if (tree->nil != root->left) {
+            root = root->left;
+        } else if (tree->nil != root->right) {
+            root = root->right;
+        } else {
+            return root;
+        }
+    }
+}
+
 /**
  * @brief Helper function for avl_traverse_postorder function.
- * This method will recursively iterate through all nodes by
- * Left-Right-Root principle.
+ * This method will iterate through all nodes by Left-Right-Root
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated avl tree object
  * @param root starting point of the avl tree traversal
  * @param action a pointer function to perform an action on one avl node object
  */
 static void avl_traverse_postorder_helper(const avl_tree_t * const __restrict__ tree, const avl_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working avl node is not `nil` */
+    /* Check if current working node is not `nil` */
     if (tree->nil == root) {
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    avl_traverse_postorder_helper(tree, root->left, action);
+    const avl_tree_node_t *iterator = avl_traverse_postorder_first(tree, root);
+
+    while (1) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (root == iterator) {
+            break;
+        }
 
-    /* Traverse in the right sub-tree */
-    avl_traverse_postorder_helper(tree, root->right, action);
+        /* After a left child comes the right sub-tree of the parent, then the parent */
+        const avl_tree_node_t *parent = iterator->parent;
 
-    /* Call action function */
-    action(root->data);
+        if ((parent->left == iterator) && (tree->nil != parent->right)) {
+            iterator = avl_traverse_postorder_first(tree, parent->right);
+        } else {
+            iterator = parent;
+        }
+    }
 }
 
 /**
@@ -1450,6 +1975,9 @@ scl_error_t avl_traverse_level(const avl_tree_t * const __restrict__ tree, actio
         /* Check if queue was created successfully */
         if (NULL != level_queue) {
 
+            /* Nodes go through a ring buffer, if it cannot be allocated the queue stays linked */
+            queue_use_ring(level_queue, 0);
+
             scl_error_t err = SCL_OK;
             
             /* Push pointer to root node into qeuue */
@@ -1501,3 +2029,1122 @@ scl_error_t avl_traverse_level(const avl_tree_t * const __restrict__ tree, actio
 
     return SCL_NULL_QUEUE;
 }
+
+/**
+ * @brief Helper function to find the first node of an avl tree that is
+ * not smaller than data (strict is 0) or that is greater than data (strict is 1).
+ * Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to the data to search for
+ * @param strict 1 to skip the node equal to data, 0 otherwise
+ * @return avl_tree_node_t* the found node or `nil` if no node is
+ * after data
+ */
+static avl_tree_node_t* avl_bound_node(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data, uint8_t strict) {
+    avl_tree_node_t *iterator = tree->root;
+    avl_tree_node_t *bound = tree->nil;
+
+    /* Remember the last node after data on the search path */
+    while (tree->nil != iterator) {
+        int32_t cmp = avl_compare(tree, iterator->data, data);
+
+        if ((cmp > 0) || ((0 == cmp) && (0 == strict))) {
+            bound = iterator;
+
+            if (0 == cmp) {
+                break;
+            }
+
+            iterator = iterator->left;
+        } else {
+            iterator = iterator->right;
+        }
+    }
+
+    return bound;
+}
+
+/**
+ * @brief Function to place a cursor on the smallest element of an avl tree.
+ * The elements of the tree can be visited in ascending order without a callback:
+ * for (d = avl_iter_begin(tree, &iter); NULL != d; d = avl_iter_next(&iter)).
+ * 
+ * @param tree an allocated avl tree object
+ * @param iter pointer to the cursor to place
+ * @return const void* the smallest element or `NULL` if the tree is empty
+ */
+const void* avl_iter_begin(const avl_tree_t * const __restrict__ tree, avl_tree_iter_t * const __restrict__ iter) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if (NULL == tree) {
+        return NULL;
+    }
+
+    iter->node = avl_min_node(tree, tree->root);
+
+    return avl_iter_data(iter);
+}
+
+/**
+ * @brief Function to place a cursor on the greatest element of an
+ * avl tree, in order to visit the elements in descending order with avl_iter_prev.
+ * 
+ * @param tree an allocated avl tree object
+ * @param iter pointer to the cursor to place
+ * @return const void* the greatest element or `NULL` if the tree is empty
+ */
+const void* avl_iter_rbegin(const avl_tree_t * const __restrict__ tree, avl_tree_iter_t * const __restrict__ iter) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if (NULL == tree) {
+        return NULL;
+    }
+
+    iter->node = avl_max_node(tree, tree->root);
+
+    return avl_iter_data(iter);
+}
+
+/**
+ * @brief Function to place a cursor on the first element of an avl tree
+ * that is not smaller than data (the lower bound of data). Takes O(logN) time
+ * for a balanced tree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param iter pointer to the cursor to place
+ * @param data pointer to the data to search for
+ * @return const void* the first element not smaller than data or `NULL`
+ * if all the elements are smaller
+ */
+const void* avl_iter_seek(const avl_tree_t * const __restrict__ tree, avl_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    iter->node = avl_bound_node(tree, data, 0);
+
+    return avl_iter_data(iter);
+}
+
+/**
+ * @brief Function to move a cursor to the next element in ascending
+ * order. Visiting all the elements takes O(N) time, O(1) amortized for
+ * one step. A cursor after the end of the tree stays there.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the next element or `NULL` if the cursor passed
+ * the greatest element
+ */
+const void* avl_iter_next(avl_tree_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is on a node */
+    if (NULL == avl_iter_data(iter)) {
+        return NULL;
+    }
+
+    const avl_tree_t * const tree = iter->tree;
+    avl_tree_node_t *iterator = iter->node;
+
+    if (tree->nil != iterator->right) {
+
+        /* The next node is the smallest node of the right subtree */
+        iterator = avl_min_node(tree, iterator->right);
+    } else {
+
+        /* Go up until the node is in a left subtree */
+        avl_tree_node_t *parent_iterator = iterator->parent;
+
+        while ((tree->nil != parent_iterator) && (parent_iterator->right == iterator)) {
+            iterator = parent_iterator;
+            parent_iterator = parent_iterator->parent;
+        }
+
+        iterator = parent_iterator;
+    }
+
+    iter->node = iterator;
+
+    return avl_iter_data(iter);
+}
+
+/**
+ * @brief Function to move a cursor to the previous element in ascending
+ * order. A cursor after the end of the tree stays there.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the previous element or `NULL` if the cursor passed
+ * the smallest element
+ */
+const void* avl_iter_prev(avl_tree_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is on a node */
+    if (NULL == avl_iter_data(iter)) {
+        return NULL;
+    }
+
+    const avl_tree_t * const tree = iter->tree;
+    avl_tree_node_t *iterator = iter->node;
+
+    if (tree->nil != iterator->left) {
+
+        /* The previous node is the greatest node of the left subtree */
+        iterator = avl_max_node(tree, iterator->left);
+    } else {
+
+        /* Go up until the node is in a right subtree */
+        avl_tree_node_t *parent_iterator = iterator->parent;
+
+        while ((tree->nil != parent_iterator) && (parent_iterator->left == iterator)) {
+            iterator = parent_iterator;
+            parent_iterator = parent_iterator->parent;
+        }
+
+        iterator = parent_iterator;
+    }
+
+    iter->node = iterator;
+
+    return avl_iter_data(iter);
+}
+
+/**
+ * @brief Function to get the element under a cursor.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the element under the cursor or `NULL` if the
+ * cursor is after the end of the tree
+ */
+const void* avl_iter_data(const avl_tree_iter_t * const __restrict__ iter) {
+    if ((NULL == iter) || (NULL == iter->tree) || (NULL == iter->node) || (iter->tree->nil == iter->node)) {
+        return NULL;
+    }
+
+    return iter->node->data;
+}
+
+/**
+ * @brief Function to get how many equal elements were inserted into
+ * the node under a cursor.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return uint32_t the count of the node or 0 if the cursor is after
+ * the end of the tree
+ */
+uint32_t avl_iter_count(const avl_tree_iter_t * const __restrict__ iter) {
+    if (NULL == avl_iter_data(iter)) {
+        return 0;
+    }
+
+    return iter->node->count;
+}
+
+/**
+ * @brief Function to find the first element of an avl tree that is not
+ * smaller than data. Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to the data to search for
+ * @return const void* the first element not smaller than data or `NULL`
+ * if all the elements are smaller
+ */
+const void* avl_lower_bound(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    avl_tree_node_t *bound = avl_bound_node(tree, data, 0);
+
+    if (tree->nil == bound) {
+        return NULL;
+    }
+
+    return bound->data;
+}
+
+/**
+ * @brief Function to find the first element of an avl tree that is
+ * greater than data. Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to the data to search for
+ * @return const void* the first element greater than data or `NULL`
+ * if no element is greater
+ */
+const void* avl_upper_bound(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    avl_tree_node_t *bound = avl_bound_node(tree, data, 1);
+
+    if (tree->nil == bound) {
+        return NULL;
+    }
+
+    return bound->data;
+}
+
+/**
+ * @brief Function to call action on every element of an avl tree from the
+ * half-open interval [lo, hi) in ascending order. The first element is found
+ * once and the others are reached through the parent links, so the
+ * scan takes O(logN + K) time for a balanced tree, where K is the
+ * number of visited elements.
+ * 
+ * @param tree an allocated avl tree object
+ * @param lo pointer to the lower bound of the interval (inclusive)
+ * @param hi pointer to the upper bound of the interval (exclusive)
+ * @param action a pointer to a function that will perform an action
+ * on every element of the interval
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_range(const avl_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    avl_tree_iter_t iter;
+
+    iter.tree = tree;
+    iter.node = avl_bound_node(tree, lo, 0);
+
+    /* Stop at the end of the tree or at the first element not smaller than hi */
+    while ((tree->nil != iter.node) && (avl_compare(tree, iter.node->data, hi) < 0)) {
+        action(iter.node->data);
+        avl_iter_next(&iter);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the number of elements of an avl tree,
+ * counting every equal element separately (get_avl_size counts the nodes).
+ * The tree must keep the weights of its nodes (see avl_use_order_stats).
+ * 
+ * @param tree an allocated avl tree object
+ * @return size_t the number of elements or 0 if the tree does not keep the weights
+ */
+size_t avl_total_count(const avl_tree_t * const __restrict__ tree) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (0 == tree->order_stats)) {
+        return 0;
+    }
+
+    return tree->root->weight;
+}
+
+/**
+ * @brief Function to find the k-th smallest element of an avl tree
+ * (counting from 0), an element inserted several times fills several
+ * positions. Takes O(logN) time, the tree must keep the weights of its
+ * nodes (see avl_use_order_stats).
+ * 
+ * @param tree an allocated avl tree object
+ * @param k position of the element in ascending order, counted from 0
+ * @return const void* the k-th smallest element or `NULL` if k is not less
+ * than the number of elements or the tree does not keep the weights
+ */
+const void* avl_select(const avl_tree_t * const __restrict__ tree, size_t k) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (0 == tree->order_stats)) {
+        return NULL;
+    }
+
+    avl_tree_node_t *iterator = tree->root;
+
+    while (tree->nil != iterator) {
+        if (k < iterator->left->weight) {
+            iterator = iterator->left;
+        } else if (k < iterator->left->weight + iterator->count) {
+            return iterator->data;
+        } else {
+            k -= iterator->left->weight + iterator->count;
+            iterator = iterator->right;
+        }
+    }
+
+    /* Position is after the last element */
+    return NULL;
+}
+
+/**
+ * @brief Function to count the elements of an avl tree that are smaller
+ * than data, which is the position of the first occurrence of data in
+ * ascending order. The data does not have to be in the tree. Takes O(logN)
+ * time, the tree must keep the weights of its nodes (see avl_use_order_stats).
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to the data to rank
+ * @return size_t the number of smaller elements or `SIZE_MAX` if input is not
+ * valid or the tree does not keep the weights
+ */
+size_t avl_rank(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data) || (0 == tree->order_stats)) {
+        return SIZE_MAX;
+    }
+
+    const avl_tree_node_t *iterator = tree->root;
+    size_t rank = 0;
+
+    while (tree->nil != iterator) {
+        int32_t cmp = avl_compare(tree, iterator->data, data);
+
+        if (cmp >= 1) {
+            iterator = iterator->left;
+        } else {
+
+            /* The left subtree is smaller, the node is smaller if it is not equal */
+            rank += iterator->left->weight;
+
+            if (0 == cmp) {
+                break;
+            }
+
+            rank += iterator->count;
+            iterator = iterator->right;
+        }
+    }
+
+    return rank;
+}
+
+/**
+ * @brief Helper function to move a detached subtree from the `nil` node
+ * of one tree to the `nil` node of another tree, the links of the leaves
+ * are changed by Root-Left-Right principle.
+ * 
+ * @param old_nil the `nil` node of the subtree
+ * @param new_nil the new `nil` node of the subtree
+ * @param root starting point of the subtree
+ */
+static void avl_set_move_helper(const avl_tree_node_t * const __restrict__ old_nil, avl_tree_node_t * const __restrict__ new_nil, avl_tree_node_t * const __restrict__ root) {
+    if (old_nil == root) {
+        return;
+    }
+
+    if (old_nil == root->left) {
+        root->left = new_nil;
+    } else {
+        avl_set_move_helper(old_nil, new_nil, root->left);
+    }
+
+    if (old_nil == root->right) {
+        root->right = new_nil;
+    } else {
+        avl_set_move_helper(old_nil, new_nil, root->right);
+    }
+}
+
+/**
+ * @brief Helper function to count the nodes of a subtree, the count
+ * stops at limit nodes, so it takes O(min(N, limit)) time.
+ * 
+ * @param tree an allocated avl tree object
+ * @param root starting point of the subtree
+ * @param limit maximum number of nodes to count
+ * @return size_t the number of nodes of the subtree or limit
+ */
+static size_t avl_set_count_helper(const avl_tree_t * const __restrict__ tree, const avl_tree_node_t * const __restrict__ root, size_t limit) {
+    if ((tree->nil == root) || (0 == limit)) {
+        return 0;
+    }
+
+    size_t count = 1 + avl_set_count_helper(tree, root->left, limit - 1);
+
+    if (count < limit) {
+        count += avl_set_count_helper(tree, root->right, limit - count);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to free one detached node of an avl tree and the content
+ * of its data, the size of the tree is decreased.
+ * 
+ * @param tree an allocated avl tree object
+ * @param free_node a detached avl tree node object
+ */
+static void avl_set_free_node(avl_tree_t * const __restrict__ tree, avl_tree_node_t * const __restrict__ free_node) {
+    if ((NULL != tree->frd) && (NULL != free_node->data)) {
+        tree->frd(free_node->data);
+    }
+
+    free_node->data = NULL;
+    scl_free(tree->allocator, free_node);
+
+    --(tree->size);
+}
+
+/**
+ * @brief Function to free every node of a detached subtree
+ * by Left-Right-Root principle.
+ * 
+ * @param tree an allocated avl tree object
+ * @param root starting point of the subtree
+ */
+static void avl_set_free_subtree(avl_tree_t * const __restrict__ tree, avl_tree_node_t * const __restrict__ root) {
+    if (tree->nil == root) {
+        return;
+    }
+
+    avl_set_free_subtree(tree, root->left);
+    avl_set_free_subtree(tree, root->right);
+    avl_set_free_node(tree, root);
+}
+
+/**
+ * @brief Function to link a node between two detached subtrees, the
+ * node becomes the root of a detached subtree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param left left subtree of the node
+ * @param link_node node to link
+ * @param right right subtree of the node
+ * @return avl_tree_node_t* the linked node
+ */
+static avl_tree_node_t* avl_set_link(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const left, avl_tree_node_t * const __restrict__ link_node, avl_tree_node_t * const right) {
+    link_node->left = left;
+    link_node->right = right;
+    link_node->parent = tree->nil;
+
+    if (tree->nil != left) {
+        left->parent = link_node;
+    }
+
+    if (tree->nil != right) {
+        right->parent = link_node;
+    }
+
+    avl_update_node_height(tree, link_node);
+
+    return link_node;
+}
+
+/**
+ * @brief Function to rotate to left a detached subtree,
+ * the nodes are not attached to any parent.
+ * 
+ * @param tree an allocated avl tree object
+ * @param root root of the subtree, with a right child
+ * @return avl_tree_node_t* the new root of the subtree
+ */
+static avl_tree_node_t* avl_set_rotate_left(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const __restrict__ root) {
+    avl_tree_node_t * const new_root = root->right;
+
+    SCL_STATS_ADD(tree, rotations, 1);
+    avl_set_link(tree, root->left, root, new_root->left);
+
+    return avl_set_link(tree, root, new_root, new_root->right);
+}
+
+/**
+ * @brief Function to rotate to right a detached subtree,
+ * the nodes are not attached to any parent.
+ * 
+ * @param tree an allocated avl tree object
+ * @param root root of the subtree, with a left child
+ * @return avl_tree_node_t* the new root of the subtree
+ */
+static avl_tree_node_t* avl_set_rotate_right(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const __restrict__ root) {
+    avl_tree_node_t * const new_root = root->left;
+
+    SCL_STATS_ADD(tree, rotations, 1);
+    avl_set_link(tree, new_root->right, root, root->right);
+
+    return avl_set_link(tree, new_root->left, new_root, root);
+}
+
+static avl_tree_node_t* avl_set_join(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const left, avl_tree_node_t * const __restrict__ join_node, avl_tree_node_t * const right);
+
+/**
+ * @brief Helper function for avl_set_join when the left subtree is higher.
+ * The node and the right subtree replace the first subtree from the right
+ * spine of the left subtree that is not higher than the right subtree plus
+ * one, then the spine is rebalanced on the way back.
+ * 
+ * @param tree an allocated avl tree object
+ * @param left the higher left subtree
+ * @param join_node node to link between the subtrees
+ * @param right the right subtree
+ * @return avl_tree_node_t* the root of the joined subtree
+ */
+static avl_tree_node_t* avl_set_join_right(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const left, avl_tree_node_t * const __restrict__ join_node, avl_tree_node_t * const right) {
+    avl_tree_node_t *joined = NULL;
+    uint8_t rotate = 0;
+
+    if (left->right->height <= right->height + 1) {
+        joined = avl_set_link(tree, left->right, join_node, right);
+
+        /* Double rotation, the joined subtree leans to the left */
+        if (joined->height > left->left->height + 1) {
+            joined = avl_set_rotate_right(tree, joined);
+            rotate = 1;
+        }
+    } else {
+        joined = avl_set_join_right(tree, left->right, join_node, right);
+        rotate = (joined->height > left->left->height + 1);
+    }
+
+    avl_set_link(tree, left->left, left, joined);
+
+    return (0 != rotate) ? avl_set_rotate_left(tree, left) : left;
+}
+
+/**
+ * @brief Helper function for avl_set_join when the right subtree is higher,
+ * symmetric to avl_set_join_right.
+ * 
+ * @param tree an allocated avl tree object
+ * @param left the left subtree
+ * @param join_node node to link between the subtrees
+ * @param right the higher right subtree
+ * @return avl_tree_node_t* the root of the joined subtree
+ */
+static avl_tree_node_t* avl_set_join_left(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const left, avl_tree_node_t * const __restrict__ join_node, avl_tree_node_t * const right) {
+    avl_tree_node_t *joined = NULL;
+    uint8_t rotate = 0;
+
+    if (right->left->height <= left->height + 1) {
+        joined = avl_set_link(tree, left, join_node, right->left);
+
+        /* Double rotation, the joined subtree leans to the right */
+        if (joined->height > right->right->height + 1) {
+            joined = avl_set_rotate_left(tree, joined);
+            rotate = 1;
+        }
+    } else {
+        joined = avl_set_join_left(tree, left, join_node, right->left);
+        rotate = (joined->height > right->right->height + 1);
+    }
+
+    avl_set_link(tree, joined, right, right->right);
+
+    return (0 != rotate) ? avl_set_rotate_right(tree, right) : right;
+}
+
+/**
+ * @brief Function to join two detached subtrees and a node, every element
+ * of the left subtree must be smaller than the node and every element of
+ * the right subtree must be greater. Takes O(|h(left) - h(right)| + 1) time.
+ * 
+ * @param tree an allocated avl tree object
+ * @param left the left subtree
+ * @param join_node node to link between the subtrees
+ * @param right the right subtree
+ * @return avl_tree_node_t* the root of the joined subtree
+ */
+static avl_tree_node_t* avl_set_join(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const left, avl_tree_node_t * const __restrict__ join_node, avl_tree_node_t * const right) {
+    avl_tree_node_t *joined = NULL;
+
+    if (left->height > right->height + 1) {
+        joined = avl_set_join_right(tree, left, join_node, right);
+    } else if (right->height > left->height + 1) {
+        joined = avl_set_join_left(tree, left, join_node, right);
+    } else {
+        joined = avl_set_link(tree, left, join_node, right);
+    }
+
+    joined->parent = tree->nil;
+
+    return joined;
+}
+
+/**
+ * @brief Function to split a detached subtree by data into the subtree
+ * of the smaller elements, the node equal to data (or `nil`) and the
+ * subtree of the greater elements. Takes O(logN) time.
+ * 
+ * @param tree an allocated avl tree object
+ * @param root starting point of the subtree
+ * @param data pointer to the data to split by
+ * @param left pointer to save the subtree of the smaller elements
+ * @param found pointer to save the node equal to data or `nil`
+ * @param right pointer to save the subtree of the greater elements
+ */
+static void avl_set_split(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const root, const void * const __restrict__ data, avl_tree_node_t ** const __restrict__ left, avl_tree_node_t ** const __restrict__ found, avl_tree_node_t ** const __restrict__ right) {
+    if (tree->nil == root) {
+        *left = *found = *right = tree->nil;
+        return;
+    }
+
+    avl_tree_node_t * const root_left = root->left;
+    avl_tree_node_t * const root_right = root->right;
+
+    root_left->parent = root_right->parent = tree->nil;
+
+    int32_t cmp = avl_compare(tree, root->data, data);
+
+    if (0 == cmp) {
+        *left = root_left;
+        *right = root_right;
+        *found = avl_set_link(tree, tree->nil, root, tree->nil);
+    } else if (cmp >= 1) {
+        avl_set_split(tree, root_left, data, left, found, right);
+        *right = avl_set_join(tree, *right, root, root_right);
+    } else {
+        avl_set_split(tree, root_right, data, left, found, right);
+        *left = avl_set_join(tree, root_left, root, *left);
+    }
+}
+
+/**
+ * @brief Function to remove the greatest node of a detached subtree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param root starting point of a non-empty subtree
+ * @param last pointer to save the greatest node
+ * @return avl_tree_node_t* the subtree without its greatest node
+ */
+static avl_tree_node_t* avl_set_split_last(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const root, avl_tree_node_t ** const __restrict__ last) {
+    avl_tree_node_t * const root_left = root->left;
+
+    root_left->parent = tree->nil;
+
+    if (tree->nil == root->right) {
+        *last = root;
+        return root_left;
+    }
+
+    avl_tree_node_t * const rest = avl_set_split_last(tree, root->right, last);
+
+    return avl_set_join(tree, root_left, root, rest);
+}
+
+/**
+ * @brief Function to join two detached subtrees without a middle node,
+ * every element of the left subtree must be smaller than every element
+ * of the right subtree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param left the left subtree
+ * @param right the right subtree
+ * @return avl_tree_node_t* the root of the joined subtree
+ */
+static avl_tree_node_t* avl_set_join2(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const left, avl_tree_node_t * const right) {
+    if (tree->nil == left) {
+        return right;
+    }
+
+    avl_tree_node_t *last = tree->nil;
+    avl_tree_node_t * const rest = avl_set_split_last(tree, left, &last);
+
+    return avl_set_join(tree, rest, last, right);
+}
+
+/**
+ * @brief Helper function for avl_union function. The second subtree is
+ * split by the root of the first one and the halves are merged recursively,
+ * the two recursive calls are independent of each other.
+ * 
+ * @param tree an allocated avl tree object
+ * @param first a detached subtree
+ * @param second a detached subtree
+ * @return avl_tree_node_t* the root of the union
+ */
+static avl_tree_node_t* avl_union_helper(avl_tree_t * const __restrict__ tree, avl_tree_node_t * const first, avl_tree_node_t * const second) {
+    if (tree->nil == first) {
+        return second;
+    }
+
+    if (tree->nil == second) {
+        return first;
+    }
+
+    avl_tree_node_t * const first_left = first->left;
+    avl_tree_node_t * const first_right = first->right;
+    avl_tree_node_t *second_left = tree->nil, *found = tree->nil, *second_right = tree->nil;
+
+    first_left->parent = first_right->parent = tree->nil;
+    avl_set_split(tree, second, first->data, &second_left, &found, &second_right);
+
+    avl_tree_node_t * const left = avl_union_helper(tree, first_left, second_left);
+    avl_tree_node_t * const right = avl_union_helper(tree, first_right, second_right);
+
+    /* Equal elements are merged into one node */
+    if (tree->nil != found) {
+        first->count += found->count;
+        avl_set_free_node(tree, found);
+    }
+
+    return avl_set_join(tree, left, first, right);
+}
+
+/**
+ * @brief Helper function for avl_intersection function, works like
+ * avl_union_helper and frees the nodes that are not in both subtrees.
+ * 
+ * @param tree an allocated avl tree object
+ * @param first a detached subtree
+ * @param second a detached subtree
+ * @return avl_tree_node_t* the root of the intersection
+ */
+static avl_tree_node_t* avl_intersection_helper(avl_tree_t * const __restrict__ tree, avl_tree_node_t * const first, avl_tree_node_t * const second) {
+    if ((tree->nil == first) || (tree->nil == second)) {
+        avl_set_free_subtree(tree, first);
+        avl_set_free_subtree(tree, second);
+
+        return tree->nil;
+    }
+
+    avl_tree_node_t * const first_left = first->left;
+    avl_tree_node_t * const first_right = first->right;
+    avl_tree_node_t *second_left = tree->nil, *found = tree->nil, *second_right = tree->nil;
+
+    first_left->parent = first_right->parent = tree->nil;
+    avl_set_split(tree, second, first->data, &second_left, &found, &second_right);
+
+    avl_tree_node_t * const left = avl_intersection_helper(tree, first_left, second_left);
+    avl_tree_node_t * const right = avl_intersection_helper(tree, first_right, second_right);
+
+    if (tree->nil == found) {
+        avl_set_free_node(tree, first);
+
+        return avl_set_join2(tree, left, right);
+    }
+
+    /* The element is kept as many times as in both trees */
+    if (found->count < first->count) {
+        first->count = found->count;
+    }
+
+    avl_set_free_node(tree, found);
+
+    return avl_set_join(tree, left, first, right);
+}
+
+/**
+ * @brief Helper function for avl_difference function. The first subtree
+ * is split by the root of the second one and the halves are subtracted
+ * recursively, the nodes of the second subtree are freed.
+ * 
+ * @param tree an allocated avl tree object
+ * @param first a detached subtree
+ * @param second a detached subtree
+ * @return avl_tree_node_t* the root of the difference
+ */
+static avl_tree_node_t* avl_difference_helper(avl_tree_t * const __restrict__ tree, avl_tree_node_t * const first, avl_tree_node_t * const second) {
+    if ((tree->nil == first) || (tree->nil == second)) {
+        avl_set_free_subtree(tree, second);
+
+        return first;
+    }
+
+    avl_tree_node_t * const second_left = second->left;
+    avl_tree_node_t * const second_right = second->right;
+    avl_tree_node_t *first_left = tree->nil, *found = tree->nil, *first_right = tree->nil;
+
+    second_left->parent = second_right->parent = tree->nil;
+    avl_set_split(tree, first, second->data, &first_left, &found, &first_right);
+
+    avl_tree_node_t * const left = avl_difference_helper(tree, first_left, second_left);
+    avl_tree_node_t * const right = avl_difference_helper(tree, first_right, second_right);
+
+    if (tree->nil != found) {
+        avl_set_free_node(tree, found);
+    }
+
+    avl_set_free_node(tree, second);
+
+    return avl_set_join2(tree, left, right);
+}
+
+/**
+ * @brief Function to check that two avl trees can exchange their nodes.
+ * 
+ * @param tree an allocated avl tree object
+ * @param other an allocated avl tree object
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t avl_set_check(const avl_tree_t * const tree, const avl_tree_t * const other) {
+    if ((NULL == tree) || (NULL == other)) {
+        return SCL_NULL_AVL;
+    }
+
+    if (tree == other) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if ((tree->cmp != other->cmp) || (tree->data_size != other->data_size) || (tree->allocator != other->allocator) ||
+        (NULL != tree->node_pool) || (NULL != other->node_pool)) {
+        return SCL_INCOMPATIBLE_TREES;
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move all the nodes of other into tree, the nodes of
+ * the smaller tree are moved to the `nil` node of the bigger tree (the two
+ * trees exchange their `nil` nodes if tree is smaller), so the move takes
+ * O(min(N, M)) time. The other tree becomes empty.
+ * 
+ * @param tree an allocated avl tree object
+ * @param other an allocated avl tree object
+ * @return avl_tree_node_t* the root of the moved nodes, a detached subtree of tree
+ */
+static avl_tree_node_t* avl_set_take(avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other) {
+    avl_tree_node_t * const other_root = other->root;
+
+    if (other->nil == other_root) {
+        return tree->nil;
+    }
+
+    if (other->size <= tree->size) {
+        avl_set_move_helper(other->nil, tree->nil, other_root);
+        other_root->parent = tree->nil;
+    } else {
+        avl_tree_node_t * const tree_nil = tree->nil;
+
+        if (tree_nil != tree->root) {
+            avl_set_move_helper(tree_nil, other->nil, tree->root);
+            tree->root->parent = other->nil;
+        } else {
+            tree->root = other->nil;
+        }
+
+        tree->nil = other->nil;
+        other->nil = tree_nil;
+    }
+
+    /* The weights of the moved nodes are needed by tree */
+    if ((0 != tree->order_stats) && (0 == other->order_stats)) {
+        avl_order_stats_helper(tree, other_root);
+    }
+
+    tree->size += other->size;
+
+    other->root = other->nil;
+    other->size = 0;
+
+    return other_root;
+}
+
+/**
+ * @brief Function to append all the elements of other to tree, every
+ * element of tree must be smaller than every element of other. Takes
+ * O(logN + min(N, M)) time (see avl_set_take), the other tree becomes empty.
+ * Both trees must have the same compare function, data size and allocator,
+ * and must not use node pools.
+ * 
+ * @param tree an allocated avl tree object
+ * @param other an allocated avl tree object with greater elements
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_join(avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other) {
+    scl_error_t err = avl_set_check(tree, other);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    if (other->nil == other->root) {
+        return SCL_OK;
+    }
+
+    /* The trees must not overlap */
+    if ((tree->nil != tree->root) && (avl_compare(tree, avl_max_node(tree, tree->root)->data, avl_min_node(other, other->root)->data) >= 0)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    avl_tree_node_t * const other_root = avl_set_take(tree, other);
+
+    tree->root = avl_set_join2(tree, tree->root, other_root);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move the elements of tree that are greater than or
+ * equal to data into the empty tree greater. Takes O(logN + min(K, N - K))
+ * time, where K is the number of moved nodes. Both trees must have the same
+ * compare function, data size and allocator, and must not use node pools.
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to the data to split by
+ * @param greater an allocated empty avl tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_split(avl_tree_t * const __restrict__ tree, const void * const __restrict__ data, avl_tree_t * const __restrict__ greater) {
+    scl_error_t err = avl_set_check(tree, greater);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (greater->nil != greater->root) {
+        return SCL_INVALID_INPUT;
+    }
+
+    avl_tree_node_t *left = tree->nil, *found = tree->nil, *right = tree->nil;
+
+    avl_set_split(tree, tree->root, data, &left, &found, &right);
+
+    /* The element equal to data goes with the greater elements */
+    if (tree->nil != found) {
+        right = avl_set_join(tree, tree->nil, found, right);
+    }
+
+    /* Count the smaller part, doubling the limit on both parts */
+    size_t left_size = 0, right_size = 0;
+
+    for (size_t limit = 1; ; limit *= 2) {
+        left_size = avl_set_count_helper(tree, left, limit);
+
+        if (left_size < limit) {
+            right_size = tree->size - left_size;
+            break;
+        }
+
+        right_size = avl_set_count_helper(tree, right, limit);
+
+        if (right_size < limit) {
+            left_size = tree->size - right_size;
+            break;
+        }
+    }
+
+    /* The smaller part is moved to the `nil` node of greater */
+    avl_tree_node_t * const tree_nil = tree->nil;
+    avl_tree_node_t * const greater_nil = greater->nil;
+
+    if (left_size < right_size) {
+        avl_set_move_helper(tree_nil, greater_nil, left);
+
+        tree->nil = greater_nil;
+        greater->nil = tree_nil;
+    } else {
+        avl_set_move_helper(tree_nil, greater_nil, right);
+    }
+
+    /* Empty parts get the `nil` node of their tree */
+    left = (tree_nil == left) ? tree->nil : left;
+    right = (tree_nil == right) ? greater->nil : right;
+
+    left->parent = tree->nil;
+    right->parent = greater->nil;
+
+    if ((0 != greater->order_stats) && (0 == tree->order_stats)) {
+        avl_order_stats_helper(greater, right);
+    }
+
+    tree->root = left;
+    tree->size = left_size;
+
+    greater->root = right;
+    greater->size = right_size;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to merge all the elements of other into tree by the
+ * join-based union algorithm, in O(M * log(N / M + 1)) time for M <= N
+ * (plus the move of avl_set_take). The count of an element found in both
+ * trees is the sum of its counts. The other tree becomes empty. Both trees
+ * must have the same compare function, data size and allocator, and must
+ * not use node pools.
+ * 
+ * @param tree an allocated avl tree object
+ * @param other an allocated avl tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_union(avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other) {
+    scl_error_t err = avl_set_check(tree, other);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    avl_tree_node_t * const other_root = avl_set_take(tree, other);
+
+    tree->root = avl_union_helper(tree, tree->root, other_root);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to keep in tree only the elements that are also in
+ * other, by the join-based intersection algorithm. The count of a kept
+ * element is the smaller of its counts. All the nodes of other are freed
+ * and the other tree becomes empty. Both trees must have the same compare
+ * function, data size and allocator, and must not use node pools.
+ * 
+ * @param tree an allocated avl tree object
+ * @param other an allocated avl tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_intersection(avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other) {
+    scl_error_t err = avl_set_check(tree, other);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    avl_tree_node_t * const other_root = avl_set_take(tree, other);
+
+    tree->root = avl_intersection_helper(tree, tree->root, other_root);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove from tree the elements that are in other
+ * (the whole node, as avl_delete does), by the join-based difference
+ * algorithm. All the nodes of other are freed and the other tree becomes
+ * empty. Both trees must have the same compare function, data size and
+ * allocator, and must not use node pools.
+ * 
+ * @param tree an allocated avl tree object
+ * @param other an allocated avl tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_difference(avl_tree_t * const __restrict__ tree, avl_tree_t * const __restrict__ other) {
+    scl_error_t err = avl_set_check(tree, other);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    avl_tree_node_t * const other_root = avl_set_take(tree, other);
+
+    tree->root = avl_difference_helper(tree, tree->root, other_root);
+
+    return SCL_OK;
+}
@@ -0,0 +1,2025 @@
+/**
+ * @file scl_bitset.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_bitset.h"
+
+/**
+ * @brief Function to get the number of words holding a number of bits.
+ * Function MUST not be used outside this file.
+ * 
+ * @param number_of_bits number of bits
+ * @return size_t number of 64 bits words
+ */
+static inline size_t bitset_words_of(size_t number_of_bits) {
+    return number_of_bits / BITSET_WORD_BITS + (0 != number_of_bits % BITSET_WORD_BITS);
+}
+
+/**
+ * @brief Create a bitset object with every bit set to zero. Function may
+ * fail if the number of bits is zero or no heap memory is left.
+ * 
+ * @param number_of_bits number of bits of the bitset
+ * @return bitset_t* a new allocated bitset object or `NULL` if function fails
+ */
+bitset_t* create_bitset(size_t number_of_bits) {
+    /* Check if input data is valid */
+    if (0 == number_of_bits) {
+        errno = EINVAL;
+        perror("Number of bits of the bitset is zero at creation");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new bitset object on heap memory */
+    bitset_t *new_bs = scl_malloc(allocator, sizeof(*new_bs));
+
+    /* Check if bitset was allocated successfully */
+    if (NULL == new_bs) {
+        errno = ENOMEM;
+        perror("Not enough memory for bitset allocation");
+        return NULL;
+    }
+
+    new_bs->number_of_words = bitset_words_of(number_of_bits);
+    new_bs->words = scl_calloc(allocator, new_bs->number_of_words, sizeof(*new_bs->words));
+
+    if (NULL == new_bs->words) {
+        scl_free(allocator, new_bs);
+
+        errno = ENOMEM;
+        perror("Not enough memory for bitset words allocation");
+        return NULL;
+    }
+
+    new_bs->size = number_of_bits;
+    new_bs->allocator = allocator;
+
+    /* Return a new allocated bitset */
+    return new_bs;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated
+ * for a specific bitset object.
+ * 
+ * @param bs an allocated bitset object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_bitset(bitset_t * const __restrict__ bs) {
+    /* Check if bitset needs to be freed */
+    if (NULL == bs) {
+        return SCL_NULL_BITSET;
+    }
+
+    scl_free(bs->allocator, bs->words);
+    scl_free(bs->allocator, bs);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to change the number of bits of a bitset, the new bits
+ * are zero and the bits over the new size are lost (for example when the
+ * vertices of a graph are added or compacted).
+ * 
+ * @param bs an allocated bitset object
+ * @param number_of_bits new number of bits of the bitset (not zero)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_resize(bitset_t * const __restrict__ bs, size_t number_of_bits) {
+    /* Check if input data is valid */
+    if (NULL == bs) {
+        return SCL_NULL_BITSET;
+    }
+
+    if (0 == number_of_bits) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const size_t new_number_of_words = bitset_words_of(number_of_bits);
+
+    if (new_number_of_words != bs->number_of_words) {
+        if (new_number_of_words > SIZE_MAX / sizeof(*bs->words)) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        uint64_t *try_realloc = scl_realloc(bs->allocator, bs->words, sizeof(*try_realloc) * new_number_of_words);
+
+        if (NULL == try_realloc) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        if (new_number_of_words > bs->number_of_words) {
+            memset(try_realloc + bs->number_of_words, 0, sizeof(*try_realloc) * (new_number_of_words - bs->number_of_words));
+        }
+
+        bs->words = try_realloc;
+        bs->number_of_words = new_number_of_words;
+    }
+
+    /* Keep the bits after the last one zero */
+    if ((number_of_bits < bs->size) && (0 != number_of_bits % BITSET_WORD_BITS)) {
+        bs->words[new_number_of_words - 1] &= (UINT64_C(1) << (number_of_bits % BITSET_WORD_BITS)) - 1;
+    }
+
+    bs->size = number_of_bits;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to set one bit of a bitset to one.
+ * 
+ * @param bs an allocated bitset object
+ * @param index index of the bit
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_set(bitset_t * const __restrict__ bs, size_t index) {
+    /* Check if input data is valid */
+    if (NULL == bs) {
+        return SCL_NULL_BITSET;
+    }
+
+    if (index >= bs->size) {
+        return SCL_INDEX_OVERFLOWS_SIZE;
+    }
+
+    bs->words[index / BITSET_WORD_BITS] |= UINT64_C(1) << (index % BITSET_WORD_BITS);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to set one bit of a bitset to zero.
+ * 
+ * @param bs an allocated bitset object
+ * @param index index of the bit
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_reset(bitset_t * const __restrict__ bs, size_t index) {
+    /* Check if input data is valid */
+    if (NULL == bs) {
+        return SCL_NULL_BITSET;
+    }
+
+    if (index >= bs->size) {
+        return SCL_INDEX_OVERFLOWS_SIZE;
+    }
+
+    bs->words[index / BITSET_WORD_BITS] &= ~(UINT64_C(1) << (index % BITSET_WORD_BITS));
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to invert one bit of a bitset.
+ * 
+ * @param bs an allocated bitset object
+ * @param index index of the bit
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_flip(bitset_t * const __restrict__ bs, size_t index) {
+    /* Check if input data is valid */
+    if (NULL == bs) {
+        return SCL_NULL_BITSET;
+    }
+
+    if (index >= bs->size) {
+        return SCL_INDEX_OVERFLOWS_SIZE;
+    }
+
+    bs->words[index / BITSET_WORD_BITS] ^= UINT64_C(1) << (index % BITSET_WORD_BITS);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to set every bit of a bitset to zero.
+ * 
+ * @param bs an allocated bitset object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_clear(bitset_t * const __restrict__ bs) {
+    /* Check if bitset is valid */
+    if (NULL == bs) {
+        return SCL_NULL_BITSET;
+    }
+
+    memset(bs->words, 0, sizeof(*bs->words) * bs->number_of_words);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if one bit of a bitset is set.
+ * 
+ * @param bs an allocated bitset object
+ * @param index index of the bit
+ * @return uint8_t 1 if the bit is set, 0 if it is not set or the input is not valid
+ */
+uint8_t bitset_test(const bitset_t * const __restrict__ bs, size_t index) {
+    /* Check if input data is valid */
+    if ((NULL == bs) || (index >= bs->size)) {
+        return 0;
+    }
+
+    return (uint8_t)((bs->words[index / BITSET_WORD_BITS] >> (index % BITSET_WORD_BITS)) & 1);
+}
+
+/**
+ * @brief Function to get the number of bits of a bitset. If bitset is
+ * not allocated than `SIZE_MAX` will be returned as an warning.
+ * 
+ * @param bs an allocated bitset object
+ * @return size_t number of bits of the bitset
+ */
+size_t get_bitset_size(const bitset_t * const __restrict__ bs) {
+    /* Check if bitset is valid */
+    if (NULL == bs) {
+        return SIZE_MAX;
+    }
+
+    return bs->size;
+}
+
+/**
+ * @brief Function to count the bits set in a bitset, one population count
+ * for every word. If bitset is not allocated than `SIZE_MAX` will be
+ * returned as an warning.
+ * 
+ * @param bs an allocated bitset object
+ * @return size_t number of bits set
+ */
+size_t bitset_count(const bitset_t * const __restrict__ bs) {
+    /* Check if bitset is valid */
+    if (NULL == bs) {
+        return SIZE_MAX;
+    }
+
+    size_t count = 0;
+
+    for (size_t iter = 0; iter < bs->number_of_words; ++iter) {
+        count += (size_t)__builtin_popcountll(bs->words[iter]);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to count the bits set in a bitset before a position
+ * (the rank of the position). A position greater than the number of bits
+ * counts all the bits. If bitset is not allocated than `SIZE_MAX` will be
+ * returned as an warning.
+ * 
+ * @param bs an allocated bitset object
+ * @param index position to count the bits before
+ * @return size_t number of bits set at positions less than index
+ */
+size_t bitset_rank(const bitset_t * const __restrict__ bs, size_t index) {
+    /* Check if bitset is valid */
+    if (NULL == bs) {
+        return SIZE_MAX;
+    }
+
+    if (index > bs->size) {
+        index = bs->size;
+    }
+
+    const size_t full_words = index / BITSET_WORD_BITS;
+    size_t count = 0;
+
+    for (size_t iter = 0; iter < full_words; ++iter) {
+        count += (size_t)__builtin_popcountll(bs->words[iter]);
+    }
+
+    if (0 != index % BITSET_WORD_BITS) {
+        count += (size_t)__builtin_popcountll(bs->words[full_words] & ((UINT64_C(1) << (index % BITSET_WORD_BITS)) - 1));
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to find the position of a bit set by its rank, the
+ * inverse of bitset_rank (rank 0 is the lowest bit set).
+ * 
+ * @param bs an allocated bitset object
+ * @param rank number of bits set before the bit to find
+ * @return size_t position of the bit or `SIZE_MAX` if fewer bits are set
+ */
+size_t bitset_select(const bitset_t * const __restrict__ bs, size_t rank) {
+    /* Check if bitset is valid */
+    if (NULL == bs) {
+        return SIZE_MAX;
+    }
+
+    for (size_t iter = 0; iter < bs->number_of_words; ++iter) {
+        uint64_t word = bs->words[iter];
+        const size_t word_count = (size_t)__builtin_popcountll(word);
+
+        if (rank < word_count) {
+
+            /* Drop the lowest bits set before the searched one */
+            for (; 0 != rank; --rank) {
+                word &= word - 1;
+            }
+
+            return iter * BITSET_WORD_BITS + (size_t)__builtin_ctzll(word);
+        }
+
+        rank -= word_count;
+    }
+
+    return SIZE_MAX;
+}
+
+/**
+ * @brief Function to find the first bit set at a position greater than or
+ * equal to index, the bits set are visited by
+ * `for (i = bitset_next_set(bs, 0); SIZE_MAX != i; i = bitset_next_set(bs, i + 1))`.
+ * 
+ * @param bs an allocated bitset object
+ * @param index first position to check
+ * @return size_t position of the bit or `SIZE_MAX` if no bit is set from index
+ */
+size_t bitset_next_set(const bitset_t * const __restrict__ bs, size_t index) {
+    /* Check if input data is valid */
+    if ((NULL == bs) || (index >= bs->size)) {
+        return SIZE_MAX;
+    }
+
+    size_t word_index = index / BITSET_WORD_BITS;
+    uint64_t word = bs->words[word_index] & (UINT64_MAX << (index % BITSET_WORD_BITS));
+
+    while (0 == word) {
+        if (++word_index == bs->number_of_words) {
+            return SIZE_MAX;
+        }
+
+        word = bs->words[word_index];
+    }
+
+    return word_index * BITSET_WORD_BITS + (size_t)__builtin_ctzll(word);
+}
+
+/**
+ * @brief Function to count the bits set in both bitsets without building
+ * their intersection (for example the common neighbours of two vertices).
+ * The bitsets may have different sizes. If one bitset is not allocated
+ * than `SIZE_MAX` will be returned as an warning.
+ * 
+ * @param bs an allocated bitset object
+ * @param other an allocated bitset object
+ * @return size_t number of bits set in both bitsets
+ */
+size_t bitset_intersection_count(const bitset_t * const __restrict__ bs, const bitset_t * const __restrict__ other) {
+    /* Check if bitsets are valid */
+    if ((NULL == bs) || (NULL == other)) {
+        return SIZE_MAX;
+    }
+
+    const size_t number_of_words = (bs->number_of_words < other->number_of_words) ? bs->number_of_words : other->number_of_words;
+    const uint64_t * const __restrict__ words = bs->words;
+    const uint64_t * const __restrict__ other_words = other->words;
+    size_t count = 0;
+
+    for (size_t iter = 0; iter < number_of_words; ++iter) {
+        count += (size_t)__builtin_popcountll(words[iter] & other_words[iter]);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to get the memory footprint of a bitset, the words
+ * are an index array of one bit for every element.
+ * 
+ * @param bs an allocated bitset object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_memory_usage(const bitset_t * const __restrict__ bs, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == bs) {
+        return SCL_NULL_BITSET;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*bs);
+    usage->node_bytes = 0;
+    usage->payload_bytes = 0;
+    usage->array_bytes = sizeof(*bs->words) * bs->number_of_words;
+    usage->slack_bytes = 0;
+    usage->nodes = bs->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if the bits of src fit into dst for a set
+ * operation. Function MUST not be used outside this file.
+ * 
+ * @param dst an allocated bitset object, the result of the operation
+ * @param src an allocated bitset object
+ * @return scl_error_t enum object for handling errors
+ */
+static inline scl_error_t bitset_check_operands(const bitset_t * const dst, const bitset_t * const src) {
+    if ((NULL == dst) || (NULL == src)) {
+        return SCL_NULL_BITSET;
+    }
+
+    if (src->size > dst->size) {
+        return SCL_BITSET_SIZE_MISMATCH;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to intersect dst with src, word by word (a loop the
+ * compilers turn into vector code). src may have fewer bits than dst, the
+ * missing bits are zero.
+ * 
+ * @param dst an allocated bitset object, the result of the operation
+ * @param src an allocated bitset object with at most as many bits as dst
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_and(bitset_t * const __restrict__ dst, const bitset_t * const __restrict__ src) {
+    const scl_error_t err = bitset_check_operands(dst, src);
+
+    if ((SCL_OK != err) || (dst == src)) {
+        return err;
+    }
+
+    uint64_t * const __restrict__ dst_words = dst->words;
+    const uint64_t * const __restrict__ src_words = src->words;
+
+    for (size_t iter = 0; iter < src->number_of_words; ++iter) {
+        dst_words[iter] &= src_words[iter];
+    }
+
+    memset(dst_words + src->number_of_words, 0, sizeof(*dst_words) * (dst->number_of_words - src->number_of_words));
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to unite dst with src, word by word (a loop the
+ * compilers turn into vector code). src may have fewer bits than dst, the
+ * missing bits are zero.
+ * 
+ * @param dst an allocated bitset object, the result of the operation
+ * @param src an allocated bitset object with at most as many bits as dst
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_or(bitset_t * const __restrict__ dst, const bitset_t * const __restrict__ src) {
+    const scl_error_t err = bitset_check_operands(dst, src);
+
+    if ((SCL_OK != err) || (dst == src)) {
+        return err;
+    }
+
+    uint64_t * const __restrict__ dst_words = dst->words;
+    const uint64_t * const __restrict__ src_words = src->words;
+
+    for (size_t iter = 0; iter < src->number_of_words; ++iter) {
+        dst_words[iter] |= src_words[iter];
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to keep in dst the bits set in just one of dst and
+ * src, word by word (a loop the compilers turn into vector code). src may
+ * have fewer bits than dst, the missing bits are zero.
+ * 
+ * @param dst an allocated bitset object, the result of the operation
+ * @param src an allocated bitset object with at most as many bits as dst
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_xor(bitset_t * const __restrict__ dst, const bitset_t * const __restrict__ src) {
+    const scl_error_t err = bitset_check_operands(dst, src);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    if (dst == src) {
+        return bitset_clear(dst);
+    }
+
+    uint64_t * const __restrict__ dst_words = dst->words;
+    const uint64_t * const __restrict__ src_words = src->words;
+
+    for (size_t iter = 0; iter < src->number_of_words; ++iter) {
+        dst_words[iter] ^= src_words[iter];
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove from dst the bits set in src, word by word
+ * (a loop the compilers turn into vector code). src may have fewer bits
+ * than dst, the missing bits are zero.
+ * 
+ * @param dst an allocated bitset object, the result of the operation
+ * @param src an allocated bitset object with at most as many bits as dst
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bitset_andnot(bitset_t * const __restrict__ dst, const bitset_t * const __restrict__ src) {
+    const scl_error_t err = bitset_check_operands(dst, src);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    if (dst == src) {
+        return bitset_clear(dst);
+    }
+
+    uint64_t * const __restrict__ dst_words = dst->words;
+    const uint64_t * const __restrict__ src_words = src->words;
+
+    for (size_t iter = 0; iter < src->number_of_words; ++iter) {
+        dst_words[iter] &= ~src_words[iter];
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Set operations of the roaring sets
+ * 
+ */
+typedef enum roaring_operation_s {
+    ROARING_OPERATION_AND                                       = 0,
+    ROARING_OPERATION_OR                                        = 1,
+    ROARING_OPERATION_XOR                                       = 2,
+    ROARING_OPERATION_ANDNOT                                    = 3
+} roaring_operation_t;
+
+/**
+ * @brief Create a roaring set object with no values, no container is
+ * allocated until the first value is added.
+ * 
+ * @return roaring_t* a new allocated roaring set object or `NULL` if function fails
+ */
+roaring_t* create_roaring(void) {
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new roaring set object on heap memory */
+    roaring_t *new_rs = scl_malloc(allocator, sizeof(*new_rs));
+
+    /* Check if roaring set was allocated successfully */
+    if (NULL == new_rs) {
+        errno = ENOMEM;
+        perror("Not enough memory for roaring set allocation");
+        return NULL;
+    }
+
+    new_rs->containers = NULL;
+    new_rs->number_of_containers = 0;
+    new_rs->capacity = 0;
+    new_rs->allocator = allocator;
+
+    /* Return a new allocated roaring set */
+    return new_rs;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated
+ * for a specific roaring set object.
+ * 
+ * @param rs an allocated roaring set object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_roaring(roaring_t * const __restrict__ rs) {
+    /* Check if roaring set needs to be freed */
+    if (NULL == rs) {
+        return SCL_NULL_ROARING;
+    }
+
+    for (size_t iter = 0; iter < rs->number_of_containers; ++iter) {
+        scl_free(rs->allocator, rs->containers[iter].data);
+    }
+
+    scl_free(rs->allocator, rs->containers);
+    scl_free(rs->allocator, rs);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find the container of the values with the selected
+ * high bits, appending in increasing order checks just the last container.
+ * Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param key high bits of the values
+ * @param found set to 1 if the container exists, 0 otherwise
+ * @return size_t index of the container or of the place to insert it
+ */
+static size_t roaring_find_container(const roaring_t * const __restrict__ rs, size_t key, uint8_t * const __restrict__ found) {
+    size_t low = 0;
+    size_t high = rs->number_of_containers;
+
+    /* Values are often added in increasing order */
+    if ((0 != high) && (rs->containers[high - 1].key <= key)) {
+        *found = (rs->containers[high - 1].key == key);
+
+        return *found ? high - 1 : high;
+    }
+
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+
+        if (rs->containers[middle].key < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    *found = (low < rs->number_of_containers) && (rs->containers[low].key == key);
+
+    return low;
+}
+
+/**
+ * @brief Function to insert an empty array container at the selected
+ * index of the containers array. Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param position index of the new container
+ * @param key high bits of the values of the new container
+ * @return roaring_container_t* the new container or `NULL` if no heap memory is left
+ */
+static roaring_container_t* roaring_insert_container(roaring_t * const __restrict__ rs, size_t position, size_t key) {
+    /* Grow the containers array twice if it is full */
+    if (rs->number_of_containers == rs->capacity) {
+        const size_t new_capacity = (0 == rs->capacity) ? 4 : 2 * rs->capacity;
+        roaring_container_t *try_realloc = scl_realloc(rs->allocator, rs->containers, sizeof(*try_realloc) * new_capacity);
+
+        if (NULL == try_realloc) {
+            errno = ENOMEM;
+            perror("Not enough memory for roaring set containers");
+            return NULL;
+        }
+
+        rs->containers = try_realloc;
+        rs->capacity = new_capacity;
+    }
+
+    roaring_container_t * const container = &rs->containers[position];
+
+    memmove(container + 1, container, sizeof(*container) * (rs->number_of_containers - position));
+    ++(rs->number_of_containers);
+
+    container->data = NULL;
+    container->key = key;
+    container->cardinality = 0;
+    container->length = 0;
+    container->capacity = 0;
+    container->kind = ROARING_ARRAY_CONTAINER;
+
+    return container;
+}
+
+/**
+ * @brief Function to free and remove the container at the selected index
+ * of the containers array. Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param position index of the container
+ */
+static void roaring_remove_container(roaring_t * const __restrict__ rs, size_t position) {
+    roaring_container_t * const container = &rs->containers[position];
+
+    scl_free(rs->allocator, container->data);
+
+    --(rs->number_of_containers);
+    memmove(container, container + 1, sizeof(*container) * (rs->number_of_containers - position));
+}
+
+/**
+ * @brief Function to find a low value in the values of an array container.
+ * Function MUST not be used outside this file.
+ * 
+ * @param values sorted values of the array container
+ * @param length number of values
+ * @param low value to find
+ * @param position set to the index of the first value not less than low
+ * @return uint8_t 1 if the value is found, 0 otherwise
+ */
+static inline uint8_t roaring_array_find(const uint16_t * const __restrict__ values, uint32_t length, uint16_t low, uint32_t * const __restrict__ position) {
+    uint32_t first = 0;
+    uint32_t last = length;
+
+    while (first < last) {
+        const uint32_t middle = first + (last - first) / 2;
+
+        if (values[middle] < low) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+
+    *position = first;
+
+    return (first < length) && (values[first] == low);
+}
+
+/**
+ * @brief Function to check if a low value is in the runs of a run
+ * container. Function MUST not be used outside this file.
+ * 
+ * @param runs sorted runs of the run container
+ * @param length number of runs
+ * @param low value to find
+ * @return uint8_t 1 if the value is found, 0 otherwise
+ */
+static inline uint8_t roaring_run_contains(const roaring_run_t * const __restrict__ runs, uint32_t length, uint16_t low) {
+    uint32_t first = 0;
+    uint32_t last = length;
+
+    /* Find the first run starting after low */
+    while (first < last) {
+        const uint32_t middle = first + (last - first) / 2;
+
+        if (runs[middle].start <= low) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+
+    return (0 != first) && ((uint32_t)(low - runs[first - 1].start) <= runs[first - 1].length);
+}
+
+/**
+ * @brief Function to check if a low value is in a container.
+ * Function MUST not be used outside this file.
+ * 
+ * @param container a container of a roaring set
+ * @param low value to find
+ * @return uint8_t 1 if the value is found, 0 otherwise
+ */
+static uint8_t roaring_container_contains(const roaring_container_t * const __restrict__ container, uint16_t low) {
+    uint32_t position = 0;
+
+    switch (container->kind) {
+    case ROARING_ARRAY_CONTAINER:
+        return roaring_array_find(container->data, container->length, low, &position);
+
+    case ROARING_BITMAP_CONTAINER:
+        return (uint8_t)((((const uint64_t *)container->data)[low / 64] >> (low % 64)) & 1);
+
+    default:
+        return roaring_run_contains(container->data, container->length, low);
+    }
+}
+
+/**
+ * @brief Function to set the bits [start, end) of a bitmap of 2^16 bits.
+ * Function MUST not be used outside this file.
+ * 
+ * @param words words of the bitmap
+ * @param start first bit to set
+ * @param end bit after the last one to set (at most 2^16)
+ */
+static void roaring_bitmap_set_range(uint64_t * const __restrict__ words, uint32_t start, uint32_t end) {
+    if (start >= end) {
+        return;
+    }
+
+    const uint32_t first_word = start / 64;
+    const uint32_t last_word = (end - 1) / 64;
+    const uint64_t first_mask = UINT64_MAX << (start % 64);
+    const uint64_t last_mask = UINT64_MAX >> (63 - (end - 1) % 64);
+
+    if (first_word == last_word) {
+        words[first_word] |= first_mask & last_mask;
+        return;
+    }
+
+    words[first_word] |= first_mask;
+
+    for (uint32_t iter = first_word + 1; iter < last_word; ++iter) {
+        words[iter] = UINT64_MAX;
+    }
+
+    words[last_word] |= last_mask;
+}
+
+/**
+ * @brief Function to count the bits set in a bitmap of 2^16 bits.
+ * Function MUST not be used outside this file.
+ * 
+ * @param words words of the bitmap
+ * @return uint32_t number of bits set
+ */
+static uint32_t roaring_bitmap_count(const uint64_t * const __restrict__ words) {
+    uint32_t count = 0;
+
+    for (uint32_t iter = 0; iter < ROARING_BITMAP_WORDS; ++iter) {
+        count += (uint32_t)__builtin_popcountll(words[iter]);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to find the first bit of a bitmap of 2^16 bits, from a
+ * position, that is set (flip is zero) or that is not set (flip is all ones).
+ * Function MUST not be used outside this file.
+ * 
+ * @param words words of the bitmap
+ * @param position first bit to check
+ * @param flip zero to find a bit set, UINT64_MAX to find a bit not set
+ * @return uint32_t position of the bit or 2^16 if there is none
+ */
+static uint32_t roaring_bitmap_next(const uint64_t * const __restrict__ words, uint32_t position, uint64_t flip) {
+    if (position >= 64 * ROARING_BITMAP_WORDS) {
+        return 64 * ROARING_BITMAP_WORDS;
+    }
+
+    uint32_t word_index = position / 64;
+    uint64_t word = (words[word_index] ^ flip) & (UINT64_MAX << (position % 64));
+
+    while (0 == word) {
+        if (++word_index == ROARING_BITMAP_WORDS) {
+            return 64 * ROARING_BITMAP_WORDS;
+        }
+
+        word = words[word_index] ^ flip;
+    }
+
+    return 64 * word_index + (uint32_t)__builtin_ctzll(word);
+}
+
+/**
+ * @brief Function to write the values of a container into a bitmap of
+ * 2^16 bits, the other bits of the bitmap are zero. Function MUST not be
+ * used outside this file.
+ * 
+ * @param container a container of a roaring set
+ * @param words words of the bitmap to fill
+ */
+static void roaring_container_fill_bitmap(const roaring_container_t * const __restrict__ container, uint64_t * const __restrict__ words) {
+    if (ROARING_BITMAP_CONTAINER == container->kind) {
+        memcpy(words, container->data, sizeof(*words) * ROARING_BITMAP_WORDS);
+        return;
+    }
+
+    memset(words, 0, sizeof(*words) * ROARING_BITMAP_WORDS);
+
+    if (ROARING_ARRAY_CONTAINER == container->kind) {
+        const uint16_t * const values = container->data;
+
+        for (uint32_t iter = 0; iter < container->length; ++iter) {
+            words[values[iter] / 64] |= UINT64_C(1) << (values[iter] % 64);
+        }
+    } else {
+        const roaring_run_t * const runs = container->data;
+
+        for (uint32_t iter = 0; iter < container->length; ++iter) {
+            roaring_bitmap_set_range(words, runs[iter].start, (uint32_t)runs[iter].start + runs[iter].length + 1);
+        }
+    }
+}
+
+/**
+ * @brief Function to write the values of a container into a sorted array.
+ * Function MUST not be used outside this file.
+ * 
+ * @param container a container of a roaring set
+ * @param values array of at least cardinality values to fill
+ */
+static void roaring_container_fill_array(const roaring_container_t * const __restrict__ container, uint16_t * const __restrict__ values) {
+    uint32_t count = 0;
+
+    if (ROARING_ARRAY_CONTAINER == container->kind) {
+        memcpy(values, container->data, sizeof(*values) * container->length);
+    } else if (ROARING_BITMAP_CONTAINER == container->kind) {
+        const uint64_t * const words = container->data;
+
+        for (uint32_t iter = 0; iter < ROARING_BITMAP_WORDS; ++iter) {
+            for (uint64_t word = words[iter]; 0 != word; word &= word - 1) {
+                values[count++] = (uint16_t)(64 * iter + (uint32_t)__builtin_ctzll(word));
+            }
+        }
+    } else {
+        const roaring_run_t * const runs = container->data;
+
+        for (uint32_t iter = 0; iter < container->length; ++iter) {
+            for (uint32_t value = runs[iter].start; value <= (uint32_t)runs[iter].start + runs[iter].length; ++value) {
+                values[count++] = (uint16_t)value;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Function to turn a container into a bitmap container.
+ * Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param container a container of the roaring set
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t roaring_container_to_bitmap(const roaring_t * const __restrict__ rs, roaring_container_t * const __restrict__ container) {
+    if (ROARING_BITMAP_CONTAINER == container->kind) {
+        return SCL_OK;
+    }
+
+    uint64_t * const words = scl_malloc(rs->allocator, sizeof(*words) * ROARING_BITMAP_WORDS);
+
+    if (NULL == words) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    roaring_container_fill_bitmap(container, words);
+    scl_free(rs->allocator, container->data);
+
+    container->data = words;
+    container->kind = ROARING_BITMAP_CONTAINER;
+    container->length = 0;
+    container->capacity = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to turn a container into an array container, the
+ * container has at most ROARING_ARRAY_MAX values. Function MUST not be
+ * used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param container a container of the roaring set
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t roaring_container_to_array(const roaring_t * const __restrict__ rs, roaring_container_t * const __restrict__ container) {
+    if (ROARING_ARRAY_CONTAINER == container->kind) {
+        return SCL_OK;
+    }
+
+    uint16_t * const values = scl_malloc(rs->allocator, sizeof(*values) * (container->cardinality + 1));
+
+    if (NULL == values) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    roaring_container_fill_array(container, values);
+    scl_free(rs->allocator, container->data);
+
+    container->data = values;
+    container->kind = ROARING_ARRAY_CONTAINER;
+    container->length = container->cardinality;
+    container->capacity = container->cardinality + 1;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to turn a run container, or a container of the wrong
+ * size, into an array container (at most ROARING_ARRAY_MAX values) or a
+ * bitmap container (more values). Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param container a container of the roaring set
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t roaring_container_normalize(const roaring_t * const __restrict__ rs, roaring_container_t * const __restrict__ container) {
+    if (container->cardinality <= ROARING_ARRAY_MAX) {
+        return roaring_container_to_array(rs, container);
+    }
+
+    return roaring_container_to_bitmap(rs, container);
+}
+
+/**
+ * @brief Function to count the runs of consecutive values of a container.
+ * Function MUST not be used outside this file.
+ * 
+ * @param container a container of a roaring set
+ * @return uint32_t number of runs
+ */
+static uint32_t roaring_container_count_runs(const roaring_container_t * const __restrict__ container) {
+    if (ROARING_RUN_CONTAINER == container->kind) {
+        return container->length;
+    }
+
+    uint32_t runs = 0;
+
+    if (ROARING_ARRAY_CONTAINER == container->kind) {
+        const uint16_t * const values = container->data;
+
+        for (uint32_t iter = 0; iter < container->length; ++iter) {
+            runs += (0 == iter) || (values[iter] != values[iter - 1] + 1);
+        }
+    } else {
+        const uint64_t * const words = container->data;
+        uint64_t carry = 0;
+
+        /* A run starts at every bit set whose lower neighbour is not set */
+        for (uint32_t iter = 0; iter < ROARING_BITMAP_WORDS; ++iter) {
+            runs += (uint32_t)__builtin_popcountll(words[iter] & ~((words[iter] << 1) | carry));
+            carry = words[iter] >> 63;
+        }
+    }
+
+    return runs;
+}
+
+/**
+ * @brief Function to turn a container into a run container.
+ * Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param container a container of the roaring set
+ * @param number_of_runs number of runs of the container
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t roaring_container_to_runs(const roaring_t * const __restrict__ rs, roaring_container_t * const __restrict__ container, uint32_t number_of_runs) {
+    if (ROARING_RUN_CONTAINER == container->kind) {
+        return SCL_OK;
+    }
+
+    roaring_run_t * const runs = scl_malloc(rs->allocator, sizeof(*runs) * number_of_runs);
+
+    if (NULL == runs) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    uint32_t count = 0;
+
+    if (ROARING_ARRAY_CONTAINER == container->kind) {
+        const uint16_t * const values = container->data;
+
+        for (uint32_t iter = 0; iter < container->length; ++iter) {
+            if ((0 != count) && (values[iter] == runs[count - 1].start + runs[count - 1].length + 1)) {
+                ++(runs[count - 1].length);
+            } else {
+                runs[count].start = values[iter];
+                runs[count].length = 0;
+                ++count;
+            }
+        }
+    } else {
+        const uint64_t * const words = container->data;
+        uint32_t start = roaring_bitmap_next(words, 0, 0);
+
+        while (start < 64 * ROARING_BITMAP_WORDS) {
+            const uint32_t end = roaring_bitmap_next(words, start, UINT64_MAX);
+
+            runs[count].start = (uint16_t)start;
+            runs[count].length = (uint16_t)(end - start - 1);
+            ++count;
+
+            start = roaring_bitmap_next(words, end, 0);
+        }
+    }
+
+    scl_free(rs->allocator, container->data);
+
+    container->data = runs;
+    container->kind = ROARING_RUN_CONTAINER;
+    container->length = count;
+    container->capacity = count;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to add a value to a roaring set. An array container
+ * full of ROARING_ARRAY_MAX values becomes a bitmap container and a run
+ * container that gets a new value is turned back into an array or a bitmap
+ * (call roaring_run_optimize after a batch of changes). Adding a value that
+ * is already in the set does nothing.
+ * 
+ * @param rs an allocated roaring set object
+ * @param value value to add
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_add(roaring_t * const __restrict__ rs, size_t value) {
+    /* Check if roaring set is valid */
+    if (NULL == rs) {
+        return SCL_NULL_ROARING;
+    }
+
+    const uint16_t low = (uint16_t)value;
+    uint8_t found = 0;
+    const size_t position = roaring_find_container(rs, value >> ROARING_CHUNK_BITS, &found);
+    roaring_container_t *container = NULL;
+
+    if (0 == found) {
+        container = roaring_insert_container(rs, position, value >> ROARING_CHUNK_BITS);
+
+        if (NULL == container) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+    } else {
+        container = &rs->containers[position];
+
+        if (ROARING_RUN_CONTAINER == container->kind) {
+            if (0 != roaring_run_contains(container->data, container->length, low)) {
+                return SCL_OK;
+            }
+
+            if (SCL_OK != roaring_container_normalize(rs, container)) {
+                return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+            }
+        }
+    }
+
+    if (ROARING_ARRAY_CONTAINER == container->kind) {
+        uint32_t index = 0;
+
+        if (0 != roaring_array_find(container->data, container->length, low, &index)) {
+            return SCL_OK;
+        }
+
+        if (container->length < ROARING_ARRAY_MAX) {
+
+            /* Grow the values twice if they are full */
+            if (container->length == container->capacity) {
+                uint32_t new_capacity = (0 == container->capacity) ? 4 : 2 * container->capacity;
+
+                if (new_capacity > ROARING_ARRAY_MAX) {
+                    new_capacity = ROARING_ARRAY_MAX;
+                }
+
+                uint16_t *try_realloc = scl_realloc(rs->allocator, container->data, sizeof(*try_realloc) * new_capacity);
+
+                if (NULL == try_realloc) {
+                    if (0 == container->cardinality) {
+                        roaring_remove_container(rs, position);
+                    }
+
+                    return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+                }
+
+                container->data = try_realloc;
+                container->capacity = new_capacity;
+            }
+
+            uint16_t * const values = container->data;
+
+            memmove(values + index + 1, values + index, sizeof(*values) * (container->length - index));
+            values[index] = low;
+
+            ++(container->length);
+            ++(container->cardinality);
+
+            /* All good */
+            return SCL_OK;
+        }
+
+        if (SCL_OK != roaring_container_to_bitmap(rs, container)) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+    }
+
+    uint64_t * const word = &((uint64_t *)container->data)[low / 64];
+    const uint64_t bit = UINT64_C(1) << (low % 64);
+
+    if (0 == (*word & bit)) {
+        *word |= bit;
+        ++(container->cardinality);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to add every value from start up to end (without it)
+ * to a roaring set. The chunks covered by the range become run containers
+ * of one run, the two partial chunks at the ends are set word by word.
+ * 
+ * @param rs an allocated roaring set object
+ * @param start first value to add
+ * @param end value after the last value to add
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_add_range(roaring_t * const __restrict__ rs, size_t start, size_t end) {
+    /* Check if input data is valid */
+    if (NULL == rs) {
+        return SCL_NULL_ROARING;
+    }
+
+    if (start > end) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (start == end) {
+        return SCL_OK;
+    }
+
+    const size_t first_key = start >> ROARING_CHUNK_BITS;
+    const size_t last_key = (end - 1) >> ROARING_CHUNK_BITS;
+    const uint32_t chunk_values = (uint32_t)1 << ROARING_CHUNK_BITS;
+
+    for (size_t key = first_key; ; ++key) {
+        const uint32_t low_start = (key == first_key) ? (uint32_t)(uint16_t)start : 0;
+        const uint32_t low_end = (key == last_key) ? (uint32_t)(uint16_t)(end - 1) + 1 : chunk_values;
+
+        uint8_t found = 0;
+        const size_t position = roaring_find_container(rs, key, &found);
+        roaring_container_t *container = found ? &rs->containers[position] : roaring_insert_container(rs, position, key);
+
+        if (NULL == container) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        if ((0 == low_start) && (chunk_values == low_end)) {
+
+            /* The whole chunk is one run */
+            roaring_run_t * const run = scl_malloc(rs->allocator, sizeof(*run));
+
+            if (NULL == run) {
+                if (0 == container->cardinality) {
+                    roaring_remove_container(rs, position);
+                }
+
+                return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+            }
+
+            run->start = 0;
+            run->length = (uint16_t)(chunk_values - 1);
+
+            scl_free(rs->allocator, container->data);
+
+            container->data = run;
+            container->kind = ROARING_RUN_CONTAINER;
+            container->cardinality = chunk_values;
+            container->length = 1;
+            container->capacity = 1;
+        } else {
+            if (SCL_OK != roaring_container_to_bitmap(rs, container)) {
+                if (0 == container->cardinality) {
+                    roaring_remove_container(rs, position);
+                }
+
+                return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+            }
+
+            roaring_bitmap_set_range(container->data, low_start, low_end);
+            container->cardinality = roaring_bitmap_count(container->data);
+
+            if (SCL_OK != roaring_container_normalize(rs, container)) {
+                return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+            }
+        }
+
+        if (key == last_key) {
+            break;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove a value from a roaring set. A bitmap container
+ * left with ROARING_ARRAY_MAX values becomes an array container and an
+ * empty container is freed.
+ * 
+ * @param rs an allocated roaring set object
+ * @param value value to remove
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_remove(roaring_t * const __restrict__ rs, size_t value) {
+    /* Check if roaring set is valid */
+    if (NULL == rs) {
+        return SCL_NULL_ROARING;
+    }
+
+    const uint16_t low = (uint16_t)value;
+    uint8_t found = 0;
+    const size_t position = roaring_find_container(rs, value >> ROARING_CHUNK_BITS, &found);
+
+    if ((0 == found) || (0 == roaring_container_contains(&rs->containers[position], low))) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    roaring_container_t * const container = &rs->containers[position];
+
+    if (1 == container->cardinality) {
+        roaring_remove_container(rs, position);
+
+        /* All good */
+        return SCL_OK;
+    }
+
+    if ((ROARING_RUN_CONTAINER == container->kind) && (SCL_OK != roaring_container_normalize(rs, container))) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    if (ROARING_ARRAY_CONTAINER == container->kind) {
+        uint16_t * const values = container->data;
+        uint32_t index = 0;
+
+        (void)roaring_array_find(values, container->length, low, &index);
+        memmove(values + index, values + index + 1, sizeof(*values) * (container->length - index - 1));
+
+        --(container->length);
+        --(container->cardinality);
+    } else {
+        ((uint64_t *)container->data)[low / 64] &= ~(UINT64_C(1) << (low % 64));
+        --(container->cardinality);
+
+        /* A failed conversion leaves a valid bitmap container */
+        if (container->cardinality <= ROARING_ARRAY_MAX) {
+            (void)roaring_container_to_array(rs, container);
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if a value is in a roaring set, one binary
+ * search over the containers and one lookup in the container.
+ * 
+ * @param rs an allocated roaring set object
+ * @param value value to find
+ * @return uint8_t 1 if the value is in the set, 0 otherwise
+ */
+uint8_t roaring_contains(const roaring_t * const __restrict__ rs, size_t value) {
+    /* Check if roaring set is valid */
+    if (NULL == rs) {
+        return 0;
+    }
+
+    uint8_t found = 0;
+    const size_t position = roaring_find_container(rs, value >> ROARING_CHUNK_BITS, &found);
+
+    return found && roaring_container_contains(&rs->containers[position], (uint16_t)value);
+}
+
+/**
+ * @brief Function to give every container of a roaring set its smallest
+ * kind: runs of consecutive values (4 bytes for every run), a sorted array
+ * (2 bytes for every value, at most ROARING_ARRAY_MAX values) or a bitmap
+ * (8 KiB). Long sequences of consecutive values (the vertices of one
+ * strongly connected component, a range of row ids) take a few bytes.
+ * 
+ * @param rs an allocated roaring set object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_run_optimize(roaring_t * const __restrict__ rs) {
+    /* Check if roaring set is valid */
+    if (NULL == rs) {
+        return SCL_NULL_ROARING;
+    }
+
+    for (size_t iter = 0; iter < rs->number_of_containers; ++iter) {
+        roaring_container_t * const container = &rs->containers[iter];
+        const size_t run_bytes = sizeof(roaring_run_t) * roaring_container_count_runs(container);
+        const size_t other_bytes = (container->cardinality <= ROARING_ARRAY_MAX)
+                                    ? sizeof(uint16_t) * container->cardinality
+                                    : sizeof(uint64_t) * ROARING_BITMAP_WORDS;
+
+        const scl_error_t err = (run_bytes < other_bytes)
+                                ? roaring_container_to_runs(rs, container, (uint32_t)(run_bytes / sizeof(roaring_run_t)))
+                                : roaring_container_normalize(rs, container);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the number of values of a roaring set. If roaring
+ * set is not allocated than `SIZE_MAX` will be returned as an warning.
+ * 
+ * @param rs an allocated roaring set object
+ * @return size_t number of values of the set
+ */
+size_t roaring_cardinality(const roaring_t * const __restrict__ rs) {
+    /* Check if roaring set is valid */
+    if (NULL == rs) {
+        return SIZE_MAX;
+    }
+
+    size_t cardinality = 0;
+
+    for (size_t iter = 0; iter < rs->number_of_containers; ++iter) {
+        cardinality += rs->containers[iter].cardinality;
+    }
+
+    return cardinality;
+}
+
+/**
+ * @brief Function to count the values of a roaring set less than a value
+ * (the rank of the value). If roaring set is not allocated than `SIZE_MAX`
+ * will be returned as an warning.
+ * 
+ * @param rs an allocated roaring set object
+ * @param value value to count the smaller values of
+ * @return size_t number of values of the set less than value
+ */
+size_t roaring_rank(const roaring_t * const __restrict__ rs, size_t value) {
+    /* Check if roaring set is valid */
+    if (NULL == rs) {
+        return SIZE_MAX;
+    }
+
+    uint8_t found = 0;
+    const size_t position = roaring_find_container(rs, value >> ROARING_CHUNK_BITS, &found);
+    size_t rank = 0;
+
+    for (size_t iter = 0; iter < position; ++iter) {
+        rank += rs->containers[iter].cardinality;
+    }
+
+    if (0 == found) {
+        return rank;
+    }
+
+    const roaring_container_t * const container = &rs->containers[position];
+    const uint16_t low = (uint16_t)value;
+
+    if (ROARING_ARRAY_CONTAINER == container->kind) {
+        uint32_t index = 0;
+
+        (void)roaring_array_find(container->data, container->length, low, &index);
+        rank += index;
+    } else if (ROARING_BITMAP_CONTAINER == container->kind) {
+        const uint64_t * const words = container->data;
+
+        for (uint32_t iter = 0; iter < low / 64; ++iter) {
+            rank += (size_t)__builtin_popcountll(words[iter]);
+        }
+
+        rank += (size_t)__builtin_popcountll(words[low / 64] & ((UINT64_C(1) << (low % 64)) - 1));
+    } else {
+        const roaring_run_t * const runs = container->data;
+
+        for (uint32_t iter = 0; (iter < container->length) && (runs[iter].start < low); ++iter) {
+            const uint32_t before = (uint32_t)low - runs[iter].start;
+
+            rank += (before < (uint32_t)runs[iter].length + 1) ? before : (uint32_t)runs[iter].length + 1;
+        }
+    }
+
+    return rank;
+}
+
+/**
+ * @brief Function to write the values of a roaring set in increasing order.
+ * If input data is not valid than `SIZE_MAX` will be returned as an warning.
+ * 
+ * @param rs an allocated roaring set object
+ * @param values array of at least roaring_cardinality values to fill
+ * @return size_t number of values written
+ */
+size_t roaring_to_array(const roaring_t * const __restrict__ rs, size_t * __restrict__ values) {
+    /* Check if input data is valid */
+    if ((NULL == rs) || (NULL == values)) {
+        return SIZE_MAX;
+    }
+
+    size_t count = 0;
+
+    for (size_t iter = 0; iter < rs->number_of_containers; ++iter) {
+        const roaring_container_t * const container = &rs->containers[iter];
+        const size_t high = container->key << ROARING_CHUNK_BITS;
+
+        if (ROARING_ARRAY_CONTAINER == container->kind) {
+            const uint16_t * const lows = container->data;
+
+            for (uint32_t index = 0; index < container->length; ++index) {
+                values[count++] = high | lows[index];
+            }
+        } else if (ROARING_BITMAP_CONTAINER == container->kind) {
+            const uint64_t * const words = container->data;
+
+            for (uint32_t index = 0; index < ROARING_BITMAP_WORDS; ++index) {
+                for (uint64_t word = words[index]; 0 != word; word &= word - 1) {
+                    values[count++] = high | (64 * index + (size_t)__builtin_ctzll(word));
+                }
+            }
+        } else {
+            const roaring_run_t * const runs = container->data;
+
+            for (uint32_t index = 0; index < container->length; ++index) {
+                for (uint32_t low = runs[index].start; low <= (uint32_t)runs[index].start + runs[index].length; ++low) {
+                    values[count++] = high | low;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to get the number of bytes of the data of a container
+ * and the number of bytes it uses. Function MUST not be used outside this file.
+ * 
+ * @param container a container of a roaring set
+ * @param used set to the number of bytes holding values
+ * @return size_t number of bytes allocated for the data
+ */
+static size_t roaring_container_bytes(const roaring_container_t * const __restrict__ container, size_t * const __restrict__ used) {
+    switch (container->kind) {
+    case ROARING_ARRAY_CONTAINER:
+        *used = sizeof(uint16_t) * container->length;
+        return sizeof(uint16_t) * container->capacity;
+
+    case ROARING_BITMAP_CONTAINER:
+        *used = sizeof(uint64_t) * ROARING_BITMAP_WORDS;
+        return *used;
+
+    default:
+        *used = sizeof(roaring_run_t) * container->length;
+        return sizeof(roaring_run_t) * container->capacity;
+    }
+}
+
+/**
+ * @brief Function to get the memory footprint of a roaring set. The
+ * compressed values are the payload, the containers are the index and the
+ * free capacity of the arrays is slack. Function visits every container.
+ * 
+ * @param rs an allocated roaring set object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_memory_usage(const roaring_t * const __restrict__ rs, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == rs) {
+        return SCL_NULL_ROARING;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*rs);
+    usage->node_bytes = 0;
+    usage->payload_bytes = 0;
+    usage->array_bytes = sizeof(*rs->containers) * rs->number_of_containers;
+    usage->slack_bytes = sizeof(*rs->containers) * (rs->capacity - rs->number_of_containers);
+    usage->nodes = rs->number_of_containers;
+
+    for (size_t iter = 0; iter < rs->number_of_containers; ++iter) {
+        size_t used = 0;
+        const size_t allocated = roaring_container_bytes(&rs->containers[iter], &used);
+
+        usage->payload_bytes += used;
+        usage->slack_bytes += allocated - used;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to merge the values of two array containers into the
+ * first one. Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param dst an array container of the roaring set, the result of the operation
+ * @param src an array container
+ * @param operation set operation to apply
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t roaring_array_operation(const roaring_t * const __restrict__ rs, roaring_container_t * const __restrict__ dst, const roaring_container_t * const __restrict__ src, roaring_operation_t operation) {
+    const uint16_t * const src_values = src->data;
+    uint16_t * const dst_values = dst->data;
+    uint32_t dst_index = 0;
+    uint32_t src_index = 0;
+    uint32_t count = 0;
+
+    /* The intersection and the difference are written over the first values */
+    if ((ROARING_OPERATION_AND == operation) || (ROARING_OPERATION_ANDNOT == operation)) {
+        const uint8_t keep_common = (ROARING_OPERATION_AND == operation);
+
+        while (dst_index < dst->length) {
+            while ((src_index < src->length) && (src_values[src_index] < dst_values[dst_index])) {
+                ++src_index;
+            }
+
+            const uint8_t common = (src_index < src->length) && (src_values[src_index] == dst_values[dst_index]);
+
+            if (common == keep_common) {
+                dst_values[count++] = dst_values[dst_index];
+            }
+
+            ++dst_index;
+        }
+
+        dst->length = count;
+        dst->cardinality = count;
+
+        /* All good */
+        return SCL_OK;
+    }
+
+    const uint32_t new_capacity = dst->length + src->length;
+    uint16_t * const values = scl_malloc(rs->allocator, sizeof(*values) * new_capacity);
+
+    if (NULL == values) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    while ((dst_index < dst->length) || (src_index < src->length)) {
+        if ((src_index == src->length) || ((dst_index < dst->length) && (dst_values[dst_index] < src_values[src_index]))) {
+            values[count++] = dst_values[dst_index++];
+        } else if ((dst_index == dst->length) || (src_values[src_index] < dst_values[dst_index])) {
+            values[count++] = src_values[src_index++];
+        } else {
+            if (ROARING_OPERATION_OR == operation) {
+                values[count++] = dst_values[dst_index];
+            }
+
+            ++dst_index;
+            ++src_index;
+        }
+    }
+
+    scl_free(rs->allocator, dst->data);
+
+    dst->data = values;
+    dst->length = count;
+    dst->cardinality = count;
+    dst->capacity = new_capacity;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to apply a set operation on two containers with the
+ * same key, the result is kept by the first one (an empty result is left to
+ * the caller to free). Sparse operands are merged as sorted arrays, the
+ * other ones are combined word by word as bitmaps. If function fails the
+ * first container keeps valid values. Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object
+ * @param dst a container of the roaring set, the result of the operation
+ * @param src a container with the same key
+ * @param operation set operation to apply
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t roaring_container_operation(const roaring_t * const __restrict__ rs, roaring_container_t * const __restrict__ dst, const roaring_container_t * const __restrict__ src, roaring_operation_t operation) {
+    const uint8_t shrinks = (ROARING_OPERATION_AND == operation) || (ROARING_OPERATION_ANDNOT == operation);
+
+    /* Two sparse containers */
+    if ((ROARING_ARRAY_CONTAINER == dst->kind) && (ROARING_ARRAY_CONTAINER == src->kind)
+        && ((0 != shrinks) || (dst->length + src->length <= ROARING_ARRAY_MAX))) {
+        return roaring_array_operation(rs, dst, src, operation);
+    }
+
+    /* The values of a sparse first container are filtered in place */
+    if ((ROARING_ARRAY_CONTAINER == dst->kind) && (0 != shrinks)) {
+        uint16_t * const values = dst->data;
+        const uint8_t keep_common = (ROARING_OPERATION_AND == operation);
+        uint32_t count = 0;
+
+        for (uint32_t iter = 0; iter < dst->length; ++iter) {
+            if (roaring_container_contains(src, values[iter]) == keep_common) {
+                values[count++] = values[iter];
+            }
+        }
+
+        dst->length = count;
+        dst->cardinality = count;
+
+        /* All good */
+        return SCL_OK;
+    }
+
+    /* The intersection with a sparse second container is sparse */
+    if ((ROARING_ARRAY_CONTAINER == src->kind) && (ROARING_OPERATION_AND == operation)) {
+        const uint16_t * const src_values = src->data;
+        uint16_t * const values = scl_malloc(rs->allocator, sizeof(*values) * src->length);
+        uint32_t count = 0;
+
+        if (NULL == values) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        for (uint32_t iter = 0; iter < src->length; ++iter) {
+            if (0 != roaring_container_contains(dst, src_values[iter])) {
+                values[count++] = src_values[iter];
+            }
+        }
+
+        scl_free(rs->allocator, dst->data);
+
+        dst->data = values;
+        dst->kind = ROARING_ARRAY_CONTAINER;
+        dst->length = count;
+        dst->cardinality = count;
+        dst->capacity = src->length;
+
+        /* All good */
+        return SCL_OK;
+    }
+
+    /* Combine the containers as bitmaps */
+    if (SCL_OK != roaring_container_to_bitmap(rs, dst)) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    uint64_t * const __restrict__ words = dst->data;
+
+    if (ROARING_ARRAY_CONTAINER == src->kind) {
+        const uint16_t * const src_values = src->data;
+
+        for (uint32_t iter = 0; iter < src->length; ++iter) {
+            const uint64_t bit = UINT64_C(1) << (src_values[iter] % 64);
+            uint64_t * const word = &words[src_values[iter] / 64];
+
+            if (ROARING_OPERATION_OR == operation) {
+                *word |= bit;
+            } else if (ROARING_OPERATION_XOR == operation) {
+                *word ^= bit;
+            } else {
+                *word &= ~bit;
+            }
+        }
+    } else {
+        uint64_t scratch[ROARING_BITMAP_WORDS];
+        const uint64_t *src_words = src->data;
+
+        if (ROARING_RUN_CONTAINER == src->kind) {
+            roaring_container_fill_bitmap(src, scratch);
+            src_words = scratch;
+        }
+
+        const uint64_t * const __restrict__ other = src_words;
+
+        switch (operation) {
+        case ROARING_OPERATION_AND:
+            for (uint32_t iter = 0; iter < ROARING_BITMAP_WORDS; ++iter) {
+                words[iter] &= other[iter];
+            }
+            break;
+
+        case ROARING_OPERATION_OR:
+            for (uint32_t iter = 0; iter < ROARING_BITMAP_WORDS; ++iter) {
+                words[iter] |= other[iter];
+            }
+            break;
+
+        case ROARING_OPERATION_XOR:
+            for (uint32_t iter = 0; iter < ROARING_BITMAP_WORDS; ++iter) {
+                words[iter] ^= other[iter];
+            }
+            break;
+
+        default:
+            for (uint32_t iter = 0; iter < ROARING_BITMAP_WORDS; ++iter) {
+                words[iter] &= ~other[iter];
+            }
+        }
+    }
+
+    dst->cardinality = roaring_bitmap_count(words);
+
+    /* A failed conversion leaves a valid bitmap container */
+    if ((0 != dst->cardinality) && (dst->cardinality <= ROARING_ARRAY_MAX)) {
+        (void)roaring_container_to_array(rs, dst);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to copy a container of another roaring set.
+ * Function MUST not be used outside this file.
+ * 
+ * @param rs an allocated roaring set object, the owner of the copy
+ * @param src a container to copy
+ * @param copy set to the copy of the container
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t roaring_container_copy(const roaring_t * const __restrict__ rs, const roaring_container_t * const __restrict__ src, roaring_container_t * const __restrict__ copy) {
+    size_t used = 0;
+
+    (void)roaring_container_bytes(src, &used);
+
+    void * const data = scl_malloc(rs->allocator, used);
+
+    if (NULL == data) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    memcpy(data, src->data, used);
+
+    *copy = *src;
+    copy->data = data;
+    copy->capacity = (ROARING_BITMAP_CONTAINER == src->kind) ? 0 : src->length;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to apply a set operation on two roaring sets, the
+ * result is kept by the first one. The containers of both sets are walked
+ * in the order of their keys, so the operation is linear in the number of
+ * containers. If no heap memory is left the first set keeps valid values,
+ * partially updated. Function MUST not be used outside this file.
+ * 
+ * @param dst an allocated roaring set object, the result of the operation
+ * @param src an allocated roaring set object
+ * @param operation set operation to apply
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t roaring_operation(roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src, roaring_operation_t operation) {
+    /* Check if input data is valid */
+    if ((NULL == dst) || (NULL == src)) {
+        return SCL_NULL_ROARING;
+    }
+
+    const uint8_t grows = (ROARING_OPERATION_OR == operation) || (ROARING_OPERATION_XOR == operation);
+
+    /* A set combined with itself */
+    if (dst == src) {
+        if ((ROARING_OPERATION_AND == operation) || (ROARING_OPERATION_OR == operation)) {
+            return SCL_OK;
+        }
+
+        for (size_t iter = 0; iter < dst->number_of_containers; ++iter) {
+            scl_free(dst->allocator, dst->containers[iter].data);
+        }
+
+        dst->number_of_containers = 0;
+
+        /* All good */
+        return SCL_OK;
+    }
+
+    const size_t new_capacity = dst->number_of_containers + (grows ? src->number_of_containers : 0);
+
+    if (0 == new_capacity) {
+        return SCL_OK;
+    }
+
+    roaring_container_t * const merged = scl_malloc(dst->allocator, sizeof(*merged) * new_capacity);
+
+    if (NULL == merged) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    scl_error_t err = SCL_OK;
+    size_t dst_index = 0;
+    size_t src_index = 0;
+    size_t count = 0;
+
+    while ((dst_index < dst->number_of_containers) || (src_index < src->number_of_containers)) {
+        roaring_container_t * const dst_container = (dst_index < dst->number_of_containers) ? &dst->containers[dst_index] : NULL;
+        const roaring_container_t * const src_container = (src_index < src->number_of_containers) ? &src->containers[src_index] : NULL;
+
+        if ((NULL == src_container) || ((NULL != dst_container) && (dst_container->key < src_container->key))) {
+
+            /* Key just in the first set */
+            if (ROARING_OPERATION_AND == operation) {
+                scl_free(dst->allocator, dst_container->data);
+            } else {
+                merged[count++] = *dst_container;
+            }
+
+            ++dst_index;
+        } else if ((NULL == dst_container) || (src_container->key < dst_container->key)) {
+
+            /* Key just in the second set */
+            if ((0 != grows) && (SCL_OK == err)) {
+                err = roaring_container_copy(dst, src_container, &merged[count]);
+
+                if (SCL_OK == err) {
+                    ++count;
+                }
+            }
+
+            ++src_index;
+        } else {
+
+            /* Key in both sets */
+            if (SCL_OK == err) {
+                err = roaring_container_operation(dst, dst_container, src_container, operation);
+            }
+
+            if (0 == dst_container->cardinality) {
+                scl_free(dst->allocator, dst_container->data);
+            } else {
+                merged[count++] = *dst_container;
+            }
+
+            ++dst_index;
+            ++src_index;
+        }
+    }
+
+    scl_free(dst->allocator, dst->containers);
+
+    dst->containers = merged;
+    dst->number_of_containers = count;
+    dst->capacity = new_capacity;
+
+    return err;
+}
+
+/**
+ * @brief Function to intersect dst with src.
+ * 
+ * @param dst an allocated roaring set object, the result of the operation
+ * @param src an allocated roaring set object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_and(roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src) {
+    return roaring_operation(dst, src, ROARING_OPERATION_AND);
+}
+
+/**
+ * @brief Function to unite dst with src.
+ * 
+ * @param dst an allocated roaring set object, the result of the operation
+ * @param src an allocated roaring set object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_or(roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src) {
+    return roaring_operation(dst, src, ROARING_OPERATION_OR);
+}
+
+/**
+ * @brief Function to keep in dst the values of just one of dst and src.
+ * 
+ * @param dst an allocated roaring set object, the result of the operation
+ * @param src an allocated roaring set object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_xor(roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src) {
+    return roaring_operation(dst, src, ROARING_OPERATION_XOR);
+}
+
+/**
+ * @brief Function to remove from dst the values of src.
+ * 
+ * @param dst an allocated roaring set object, the result of the operation
+ * @param src an allocated roaring set object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t roaring_andnot(roaring_t * const __restrict__ dst, const roaring_t * const __restrict__ src) {
+    return roaring_operation(dst, src, ROARING_OPERATION_ANDNOT);
+}
@@ -0,0 +1,316 @@
+/**
+ * @file scl_bloom_filter.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_bloom_filter.h"
+#include "./include/scl_func_types.h"
+
+/* Greatest number of bits set by one key */
+#define BLOOM_FILTER_MAX_HASHES 16
+
+/**
+ * @brief Function to build the mask of the bits of a key inside its block.
+ * The bits are found by double hashing from the low bits of the mixed hash,
+ * the block is selected by its high bits. Function MUST not be used outside this file.
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @param key_hash hash value of the key
+ * @param mask array of BLOOM_FILTER_BLOCK_WORDS words to fill with the bits of the key
+ * @return uint64_t* pointer to the block of the key
+ */
+static inline uint64_t* bloom_filter_key_mask(const bloom_filter_t * const __restrict__ filter, size_t key_hash, uint64_t * const __restrict__ mask) {
+    const uint64_t mixed = (uint64_t)hash_mix(key_hash);
+    const uint32_t step = (uint32_t)(mixed >> 9) | 1;
+    uint32_t bit = (uint32_t)mixed;
+
+    for (size_t iter = 0; iter < BLOOM_FILTER_BLOCK_WORDS; ++iter) {
+        mask[iter] = 0;
+    }
+
+    for (size_t iter = 0; iter < filter->number_of_hashes; ++iter) {
+        const uint32_t block_bit = bit & (BLOOM_FILTER_BLOCK_BYTES * 8 - 1);
+
+        mask[block_bit >> 6] |= (uint64_t)1 << (block_bit & 63);
+        bit += step;
+    }
+
+    return filter->blocks + ((mixed >> 32) & (filter->number_of_blocks - 1)) * BLOOM_FILTER_BLOCK_WORDS;
+}
+
+/**
+ * @brief Create a blocked bloom filter object sized for a number of keys.
+ * The number of bits set by every key is bits_per_key * ln(2) (at least 1,
+ * at most 16), 10 bits per key give about 1% false positives. Allocation may
+ * fail if there is not enough memory on heap or bits_per_key is zero.
+ * 
+ * @param capacity number of keys the filter is sized for (at least BLOOM_FILTER_MIN_KEYS)
+ * @param bits_per_key number of bits of the filter for every key
+ * @return bloom_filter_t* a new allocated bloom filter or `NULL` (if function fails)
+ */
+bloom_filter_t* create_bloom_filter(size_t capacity, size_t bits_per_key) {
+    /* Check if bits per key are valid */
+    if ((0 == bits_per_key) || (bits_per_key > BLOOM_FILTER_BLOCK_BYTES * 8)) {
+        errno = EINVAL;
+        perror("Bits per key of the bloom filter are not valid");
+        return NULL;
+    }
+
+    if (capacity < BLOOM_FILTER_MIN_KEYS) {
+        capacity = BLOOM_FILTER_MIN_KEYS;
+    }
+
+    /* Check if the filter fits in the address space */
+    if (capacity > SIZE_MAX / 2 / bits_per_key) {
+        errno = EINVAL;
+        perror("Capacity of the bloom filter is too big");
+        return NULL;
+    }
+
+    /* Blocks are selected by masking, their number must be a power of two */
+    const size_t wanted_blocks = (capacity * bits_per_key + BLOOM_FILTER_BLOCK_BYTES * 8 - 1) / (BLOOM_FILTER_BLOCK_BYTES * 8);
+    size_t number_of_blocks = 1;
+
+    while (number_of_blocks < wanted_blocks) {
+        number_of_blocks <<= 1;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new bloom filter object on heap */
+    bloom_filter_t *new_filter = scl_malloc(allocator, sizeof(*new_filter));
+
+    /* Check if bloom filter was allocated successfully */
+    if (NULL == new_filter) {
+        errno = ENOMEM;
+        perror("Not enough memory for bloom filter allocation");
+        return NULL;
+    }
+
+    /*
+     * Allocate the blocks, the allocator guarantees just the malloc
+     * alignment so one more block is taken to align the array
+     */
+    new_filter->blocks_memory = scl_calloc(allocator, number_of_blocks + 1, BLOOM_FILTER_BLOCK_BYTES);
+
+    /* Check if blocks were allocated successfully */
+    if (NULL == new_filter->blocks_memory) {
+        scl_free(allocator, new_filter);
+
+        errno = ENOMEM;
+        perror("Not enough memory for bloom filter blocks allocation");
+        return NULL;
+    }
+
+    /* Every block is one aligned cache line */
+    new_filter->blocks = (uint64_t *)(((uintptr_t)new_filter->blocks_memory + BLOOM_FILTER_BLOCK_BYTES - 1) & ~(uintptr_t)(BLOOM_FILTER_BLOCK_BYTES - 1));
+    new_filter->number_of_blocks = number_of_blocks;
+    new_filter->bits_per_key = bits_per_key;
+    new_filter->capacity = capacity;
+    new_filter->size = 0;
+    new_filter->allocator = allocator;
+
+    /* The best number of bits per key is bits_per_key * ln(2) */
+    new_filter->number_of_hashes = (bits_per_key * 69 + 50) / 100;
+
+    if (0 == new_filter->number_of_hashes) {
+        new_filter->number_of_hashes = 1;
+    } else if (new_filter->number_of_hashes > BLOOM_FILTER_MAX_HASHES) {
+        new_filter->number_of_hashes = BLOOM_FILTER_MAX_HASHES;
+    }
+
+    /* Return the new bloom filter */
+    return new_filter;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a bloom filter.
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_bloom_filter(bloom_filter_t * const __restrict__ filter) {
+    /* Check if bloom filter needs to be freed */
+    if (NULL == filter) {
+        return SCL_NULL_BLOOM_FILTER;
+    }
+
+    scl_free(filter->allocator, filter->blocks_memory);
+    scl_free(filter->allocator, filter);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to add the hash value of a key to a bloom filter. The
+ * hash value is mixed again, so a hash function that does not spread its
+ * values (as the identity) can be used.
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @param key_hash hash value of the key
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bloom_filter_add_hash(bloom_filter_t * const __restrict__ filter, size_t key_hash) {
+    /* Check if bloom filter is allocated */
+    if (NULL == filter) {
+        return SCL_NULL_BLOOM_FILTER;
+    }
+
+    uint64_t mask[BLOOM_FILTER_BLOCK_WORDS];
+    uint64_t * const block = bloom_filter_key_mask(filter, key_hash, mask);
+
+    for (size_t iter = 0; iter < BLOOM_FILTER_BLOCK_WORDS; ++iter) {
+        block[iter] |= mask[iter];
+    }
+
+    ++filter->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to test if the hash value of a key may have been added to
+ * a bloom filter. All the bits of the key are tested at once, word by word,
+ * on the one block of the key (a loop the compilers turn into vector code).
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @param key_hash hash value of the key
+ * @return uint8_t 0 if the key was surely not added, 1 if it may have been
+ * added or if the filter is not allocated
+ */
+uint8_t bloom_filter_may_contain_hash(const bloom_filter_t * const __restrict__ filter, size_t key_hash) {
+    /* Without a filter any key may be present */
+    if (NULL == filter) {
+        return 1;
+    }
+
+    uint64_t mask[BLOOM_FILTER_BLOCK_WORDS];
+    const uint64_t * const block = bloom_filter_key_mask(filter, key_hash, mask);
+    uint64_t missing = 0;
+
+    for (size_t iter = 0; iter < BLOOM_FILTER_BLOCK_WORDS; ++iter) {
+        missing |= mask[iter] & ~block[iter];
+    }
+
+    return (0 == missing) ? 1 : 0;
+}
+
+/**
+ * @brief Function to remove every key from a bloom filter.
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bloom_filter_clear(bloom_filter_t * const __restrict__ filter) {
+    /* Check if bloom filter is allocated */
+    if (NULL == filter) {
+        return SCL_NULL_BLOOM_FILTER;
+    }
+
+    memset(filter->blocks, 0, filter->number_of_blocks * BLOOM_FILTER_BLOCK_BYTES);
+    filter->size = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if a bloom filter should be rebuilt from the keys
+ * still present in its owner. Keys cannot be removed from a filter, so the
+ * removed keys and the keys added over its capacity raise the false positive
+ * rate. A rebuild is needed when more keys were added than the filter is sized
+ * for or when more than half of the added keys were removed, so rebuilding
+ * after every change costs O(1) amortized.
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @param live_keys number of keys added to the filter and still present
+ * @return uint8_t 1 if the filter should be rebuilt, 0 otherwise
+ */
+uint8_t bloom_filter_needs_rebuild(const bloom_filter_t * const __restrict__ filter, size_t live_keys) {
+    if (NULL == filter) {
+        return 0;
+    }
+
+    return ((filter->size > filter->capacity) || (filter->size / 2 > live_keys)) ? 1 : 0;
+}
+
+/**
+ * @brief Function to get the number of keys added to a bloom filter
+ * since it was created or cleared.
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @return size_t number of keys or `SIZE_MAX` if filter is not allocated
+ */
+size_t get_bloom_filter_size(const bloom_filter_t * const __restrict__ filter) {
+    if (NULL == filter) {
+        return SIZE_MAX;
+    }
+
+    return filter->size;
+}
+
+/**
+ * @brief Function to get the number of keys a bloom filter is sized for.
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @return size_t number of keys or `SIZE_MAX` if filter is not allocated
+ */
+size_t get_bloom_filter_capacity(const bloom_filter_t * const __restrict__ filter) {
+    if (NULL == filter) {
+        return SIZE_MAX;
+    }
+
+    return filter->capacity;
+}
+
+/**
+ * @brief Function to get the number of bytes used by a bloom filter,
+ * the blocks are counted as array bytes.
+ * 
+ * @param filter pointer to an allocated bloom filter
+ * @param usage pointer to the memory usage to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bloom_filter_memory_usage(const bloom_filter_t * const __restrict__ filter, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == filter) {
+        return SCL_NULL_BLOOM_FILTER;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* The object and the alignment block */
+    usage->object_bytes = sizeof(*filter) + BLOOM_FILTER_BLOCK_BYTES;
+    usage->node_bytes = 0;
+    usage->payload_bytes = 0;
+    usage->array_bytes = filter->number_of_blocks * BLOOM_FILTER_BLOCK_BYTES;
+    usage->slack_bytes = 0;
+    usage->nodes = filter->size;
+
+    /* All good */
+    return SCL_OK;
+}
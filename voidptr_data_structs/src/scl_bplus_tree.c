@@ -0,0 +1,1295 @@
+/**
+ * @file scl_bplus_tree.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_bplus_tree.h"
+
+/* Offset in bytes of the first key of a node */
+#define BPLUS_TREE_KEYS_OFFSET SCL_ALIGN_SIZE(sizeof(bplus_tree_node_t))
+
+/**
+ * @brief Function to get the address of a key of a B+ tree node.
+ *
+ * @param tree an allocated B+ tree object
+ * @param node a node of the tree
+ * @param key_index index of the key in the node
+ * @return uint8_t* address of the key
+ */
+static uint8_t* bplus_tree_key(const bplus_tree_t * const __restrict__ tree, const bplus_tree_node_t * const __restrict__ node, size_t key_index) {
+    return (uint8_t *)node + BPLUS_TREE_KEYS_OFFSET + key_index * tree->data_size;
+}
+
+/**
+ * @brief Function to get the array of children of an inner B+ tree node,
+ * stored after all the key slots of the node.
+ *
+ * @param tree an allocated B+ tree object
+ * @param node an inner node of the tree
+ * @return bplus_tree_node_t** the children of the node
+ */
+static bplus_tree_node_t** bplus_tree_children(const bplus_tree_t * const __restrict__ tree, const bplus_tree_node_t * const __restrict__ node) {
+    return (bplus_tree_node_t **)((uint8_t *)node + SCL_ALIGN_SIZE(BPLUS_TREE_KEYS_OFFSET + tree->inner_capacity * tree->data_size));
+}
+
+/**
+ * @brief Create a B+ Tree object. Allocation may fail if user
+ * does not provide a compare function, also in case if heap memory
+ * is full function will return a `NULL` pointer. The number of keys
+ * of a node is chosen so that the node fits in node_size bytes (at
+ * least BPLUS_TREE_MIN_KEYS keys are kept in one node).
+ *
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free the content of data
+ * basic types like int, float, double, etc... do not need a free function
+ * so you can pass a NULL pointer
+ * @param data_size length in bytes of the data data type
+ * @param node_size size in bytes of one node, a few cache lines or a
+ * page (0 for BPLUS_TREE_NODE_SIZE)
+ * @return bplus_tree_t* return a new dynamically allocated tree or `NULL` if
+ * allocation went wrong
+ */
+bplus_tree_t* create_bplus_tree(compare_func cmp, free_func frd, size_t data_size, size_t node_size) {
+    /* Check if compare function is valid */
+    if (NULL == cmp) {
+        errno = EINVAL;
+        perror("Compare function undefined for B+ tree");
+        return NULL;
+    }
+
+    /* Check if the data size of one element is valid */
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    if (0 == node_size) {
+        node_size = BPLUS_TREE_NODE_SIZE;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new B+ tree on heap */
+    bplus_tree_t *new_tree = scl_malloc(allocator, sizeof(*new_tree));
+
+    if (NULL == new_tree) {
+        errno = ENOMEM;
+        perror("Not enough memory for B+ tree allocation");
+        return NULL;
+    }
+
+    new_tree->allocator = allocator;
+
+    /* Set function pointers */
+    new_tree->cmp = cmp;
+    new_tree->frd = frd;
+
+    new_tree->root = new_tree->head = new_tree->tail = NULL;
+    new_tree->data_size = data_size;
+    new_tree->size = 0;
+    new_tree->height = 0;
+    new_tree->node_size = node_size;
+
+    /* A leaf holds only keys */
+    new_tree->leaf_capacity = BPLUS_TREE_MIN_KEYS;
+
+    if ((node_size > BPLUS_TREE_KEYS_OFFSET) && ((node_size - BPLUS_TREE_KEYS_OFFSET) / data_size > BPLUS_TREE_MIN_KEYS)) {
+        new_tree->leaf_capacity = (node_size - BPLUS_TREE_KEYS_OFFSET) / data_size;
+    }
+
+    /* An inner node holds its keys and one more child than keys */
+    new_tree->inner_capacity = BPLUS_TREE_MIN_KEYS;
+
+    if ((node_size > BPLUS_TREE_KEYS_OFFSET + sizeof(bplus_tree_node_t *)) &&
+        ((node_size - BPLUS_TREE_KEYS_OFFSET - sizeof(bplus_tree_node_t *)) / (data_size + sizeof(bplus_tree_node_t *)) > BPLUS_TREE_MIN_KEYS)) {
+        new_tree->inner_capacity = (node_size - BPLUS_TREE_KEYS_OFFSET - sizeof(bplus_tree_node_t *)) / (data_size + sizeof(bplus_tree_node_t *));
+    }
+
+    /* The children are aligned after the keys, the padding may take one key */
+    while ((new_tree->inner_capacity > BPLUS_TREE_MIN_KEYS) &&
+           (SCL_ALIGN_SIZE(BPLUS_TREE_KEYS_OFFSET + new_tree->inner_capacity * data_size) + (new_tree->inner_capacity + 1) * sizeof(bplus_tree_node_t *) > node_size)) {
+        --(new_tree->inner_capacity);
+    }
+
+    /* Return new allocated tree */
+    return new_tree;
+}
+
+/**
+ * @brief Create a B+ Tree Node object, a leaf or an inner node.
+ * Creation will fail if heap memory is full, in this case function
+ * will return a `NULL` pointer.
+ *
+ * @param tree an allocated B+ tree object
+ * @param is_leaf 1 for a leaf, 0 for an inner node
+ * @return bplus_tree_node_t* a new allocated node object or `NULL`
+ */
+static bplus_tree_node_t* create_bplus_tree_node(const bplus_tree_t * const __restrict__ tree, uint8_t is_leaf) {
+    size_t bytes = BPLUS_TREE_KEYS_OFFSET + tree->leaf_capacity * tree->data_size;
+
+    if (0 == is_leaf) {
+        bytes = SCL_ALIGN_SIZE(BPLUS_TREE_KEYS_OFFSET + tree->inner_capacity * tree->data_size) + (tree->inner_capacity + 1) * sizeof(bplus_tree_node_t *);
+    }
+
+    bplus_tree_node_t *new_node = scl_malloc(tree->allocator, bytes);
+
+    if (NULL != new_node) {
+        new_node->next = new_node->prev = NULL;
+        new_node->count = 0;
+        new_node->is_leaf = is_leaf;
+    }
+
+    return new_node;
+}
+
+/**
+ * @brief Helper function for free_bplus_tree function, frees a subtree
+ * by Left-Right-Root principle. The free function is called only for
+ * the elements of the leaves, the inner keys are copies.
+ *
+ * @param tree an allocated B+ tree object
+ * @param node root of the subtree to free
+ */
+static void free_bplus_tree_helper(const bplus_tree_t * const __restrict__ tree, bplus_tree_node_t * const __restrict__ node) {
+    if (0 == node->is_leaf) {
+        bplus_tree_node_t ** const children = bplus_tree_children(tree, node);
+
+        for (size_t iter = 0; iter <= node->count; ++iter) {
+            free_bplus_tree_helper(tree, children[iter]);
+        }
+    } else if (NULL != tree->frd) {
+        for (size_t iter = 0; iter < node->count; ++iter) {
+            tree->frd(bplus_tree_key(tree, node, iter));
+        }
+    }
+
+    scl_free(tree->allocator, node);
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * B+ tree object. The free function provided at creation is called
+ * for every element.
+ *
+ * @param tree an allocated B+ tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_bplus_tree(bplus_tree_t * const __restrict__ tree) {
+    /* Check if tree needs to be deallocated */
+    if (NULL == tree) {
+        return SCL_NULL_BPLUS_TREE;
+    }
+
+    if (NULL != tree->root) {
+        free_bplus_tree_helper(tree, tree->root);
+    }
+
+    scl_free(tree->allocator, tree);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if a B+ tree object is empty or not.
+ * A `NULL` tree is also considered as an empty tree
+ *
+ * @param tree a B+ tree object
+ * @return uint8_t true(1) if tree is empty and false(0) if tree is not
+ * empty
+ */
+uint8_t is_bplus_tree_empty(const bplus_tree_t * const __restrict__ tree) {
+    if ((NULL == tree) || (NULL == tree->root)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the number of elements of a B+ tree.
+ *
+ * @param tree an allocated B+ tree object
+ * @return size_t number of elements or `SIZE_MAX` if tree is not allocated
+ */
+size_t get_bplus_tree_size(const bplus_tree_t * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SIZE_MAX;
+    }
+
+    return tree->size;
+}
+
+/**
+ * @brief Helper function for bplus_tree_memory_usage function, counts the
+ * inner nodes of a subtree and their keys. The leaves are not visited.
+ *
+ * @param tree an allocated B+ tree object
+ * @param node an inner node of the tree
+ * @param inner_nodes pointer to the number of inner nodes to increase
+ * @param inner_keys pointer to the number of inner keys to increase
+ */
+static void bplus_tree_memory_usage_helper(const bplus_tree_t * const __restrict__ tree, const bplus_tree_node_t * const __restrict__ node, size_t * const __restrict__ inner_nodes, size_t * const __restrict__ inner_keys) {
+    bplus_tree_node_t ** const children = bplus_tree_children(tree, node);
+
+    ++(*inner_nodes);
+    *inner_keys += node->count;
+
+    /* Children of the last inner level are leaves */
+    if (0 == children[0]->is_leaf) {
+        for (size_t iter = 0; iter <= node->count; ++iter) {
+            bplus_tree_memory_usage_helper(tree, children[iter], inner_nodes, inner_keys);
+        }
+    }
+}
+
+/**
+ * @brief Function to get the memory footprint of a B+ tree. The elements
+ * of the leaves are the payload, the free key slots of all nodes and the
+ * free children slots of the inner nodes are slack, and the node headers,
+ * the inner keys (copies of leaf elements) and the used children slots
+ * are counted as node bytes. Function visits every inner node of the tree.
+ *
+ * @param tree an allocated B+ tree object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bplus_tree_memory_usage(const bplus_tree_t * const __restrict__ tree, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BPLUS_TREE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const size_t leaf_bytes = BPLUS_TREE_KEYS_OFFSET + tree->leaf_capacity * tree->data_size;
+    const size_t inner_bytes = SCL_ALIGN_SIZE(BPLUS_TREE_KEYS_OFFSET + tree->inner_capacity * tree->data_size) + (tree->inner_capacity + 1) * sizeof(bplus_tree_node_t *);
+
+    usage->object_bytes = sizeof(*tree);
+    usage->node_bytes = 0;
+    usage->payload_bytes = tree->size * tree->data_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = 0;
+    usage->nodes = 0;
+
+    /* Leaves are linked, visit them in order */
+    for (const bplus_tree_node_t *leaf = tree->head; NULL != leaf; leaf = leaf->next) {
+        usage->slack_bytes += (tree->leaf_capacity - leaf->count) * tree->data_size;
+        ++(usage->nodes);
+    }
+
+    usage->node_bytes = usage->nodes * leaf_bytes - usage->payload_bytes - usage->slack_bytes;
+
+    if ((NULL != tree->root) && (0 == tree->root->is_leaf)) {
+        size_t inner_nodes = 0, inner_keys = 0;
+
+        bplus_tree_memory_usage_helper(tree, tree->root, &inner_nodes, &inner_keys);
+
+        /* A node with count keys uses count + 1 children slots */
+        const size_t inner_slack = (inner_nodes * tree->inner_capacity - inner_keys) * (tree->data_size + sizeof(bplus_tree_node_t *));
+
+        usage->slack_bytes += inner_slack;
+        usage->node_bytes += inner_nodes * inner_bytes - inner_slack;
+        usage->nodes += inner_nodes;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the number of levels of a B+ tree, a search reads one
+ * node of every level.
+ *
+ * @param tree an allocated B+ tree object
+ * @return size_t number of levels (0 for an empty tree) or `SIZE_MAX`
+ * if tree is not allocated
+ */
+size_t get_bplus_tree_height(const bplus_tree_t * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SIZE_MAX;
+    }
+
+    return tree->height;
+}
+
+/**
+ * @brief Function to find the first key of a node that is not smaller
+ * than data (strict is 0) or that is greater than data (strict is 1),
+ * by binary search.
+ *
+ * @param tree an allocated B+ tree object
+ * @param node a node of the tree
+ * @param data pointer to the data to search for
+ * @param strict 1 to skip the keys equal to data, 0 otherwise
+ * @return size_t index of the found key or the number of keys of the node
+ */
+static size_t bplus_tree_bound(const bplus_tree_t * const __restrict__ tree, const bplus_tree_node_t * const __restrict__ node, const void * const __restrict__ data, uint8_t strict) {
+    size_t left = 0;
+    size_t right = node->count;
+
+    while (left < right) {
+        size_t middle = left + (right - left) / 2;
+        int32_t cmp = tree->cmp(bplus_tree_key(tree, node, middle), data);
+
+        if ((cmp < 0) || ((0 == cmp) && (0 != strict))) {
+            left = middle + 1;
+        } else {
+            right = middle;
+        }
+    }
+
+    return left;
+}
+
+/**
+ * @brief Function to descend from the root to the leaf that may contain
+ * data. The child of an inner node is the number of its keys not greater
+ * than data, every key being the smallest element of its right subtree.
+ *
+ * @param tree an allocated non-empty B+ tree object
+ * @param data pointer to the data to search for
+ * @param path array to save the inner nodes of the path or `NULL`
+ * @param child_index array to save the index of the followed children or `NULL`
+ * @return bplus_tree_node_t* the leaf of the data
+ */
+static bplus_tree_node_t* bplus_tree_find_leaf(const bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data, bplus_tree_node_t ** const __restrict__ path, size_t * const __restrict__ child_index) {
+    bplus_tree_node_t *node = tree->root;
+    size_t depth = 0;
+
+    while (0 == node->is_leaf) {
+        size_t index = bplus_tree_bound(tree, node, data, 1);
+        bplus_tree_node_t *child = bplus_tree_children(tree, node)[index];
+
+        /* The next node is read soon, ask for its keys */
+        SCL_PREFETCH(bplus_tree_key(tree, child, 0));
+
+        if (NULL != path) {
+            path[depth] = node;
+            child_index[depth] = index;
+        }
+
+        ++depth;
+        node = child;
+    }
+
+    return node;
+}
+
+/**
+ * @brief Function to insert a key and its right child into an inner
+ * node that is not full.
+ *
+ * @param tree an allocated B+ tree object
+ * @param node an inner node with a free key slot
+ * @param key_index index of the new key
+ * @param key pointer to the new key
+ * @param child new child, placed after the new key
+ */
+static void bplus_tree_inner_insert(const bplus_tree_t * const __restrict__ tree, bplus_tree_node_t * const __restrict__ node, size_t key_index, const void * const __restrict__ key, bplus_tree_node_t * const __restrict__ child) {
+    bplus_tree_node_t ** const children = bplus_tree_children(tree, node);
+
+    memmove(bplus_tree_key(tree, node, key_index + 1), bplus_tree_key(tree, node, key_index), (node->count - key_index) * tree->data_size);
+    memcpy(bplus_tree_key(tree, node, key_index), key, tree->data_size);
+
+    memmove(children + key_index + 2, children + key_index + 1, (node->count - key_index) * sizeof(*children));
+    children[key_index + 1] = child;
+
+    ++(node->count);
+}
+
+/**
+ * @brief Function to insert one generic data into a B+ tree. The data
+ * is copied into its leaf, a full leaf is split in two halves and the
+ * smallest key of the new half is inserted into the parent, which may
+ * split in turn up to the root. All the nodes needed by the splits are
+ * allocated before the tree is changed, so a failed insertion leaves the
+ * tree untouched. An element equal to a stored element is not stored again.
+ *
+ * @param tree an allocated B+ tree object
+ * @param data pointer to an address of a generic data type
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bplus_tree_insert(bplus_tree_t * const __restrict__ tree, const void * __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BPLUS_TREE;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* The first element creates a leaf root */
+    if (NULL == tree->root) {
+        tree->root = create_bplus_tree_node(tree, 1);
+
+        if (NULL == tree->root) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        tree->head = tree->tail = tree->root;
+        tree->height = 1;
+    }
+
+    bplus_tree_node_t *path[BPLUS_TREE_MAX_HEIGHT];
+    size_t child_index[BPLUS_TREE_MAX_HEIGHT];
+    size_t depth = tree->height - 1;
+
+    bplus_tree_node_t *leaf = bplus_tree_find_leaf(tree, data, path, child_index);
+    size_t position = bplus_tree_bound(tree, leaf, data, 0);
+
+    /* Element is already in the tree */
+    if ((position < leaf->count) && (0 == tree->cmp(bplus_tree_key(tree, leaf, position), data))) {
+        return SCL_OK;
+    }
+
+    /* Leaf has a free slot */
+    if (leaf->count < tree->leaf_capacity) {
+        memmove(bplus_tree_key(tree, leaf, position + 1), bplus_tree_key(tree, leaf, position), (leaf->count - position) * tree->data_size);
+        memcpy(bplus_tree_key(tree, leaf, position), data, tree->data_size);
+
+        ++(leaf->count);
+        ++(tree->size);
+
+        return SCL_OK;
+    }
+
+    /* Count the full inner nodes above the leaf, a full root needs a new root */
+    size_t number_of_splits = 0;
+
+    while ((number_of_splits < depth) && (tree->inner_capacity == path[depth - 1 - number_of_splits]->count)) {
+        ++number_of_splits;
+    }
+
+    size_t number_of_nodes = number_of_splits + 1 + ((number_of_splits == depth) ? 1 : 0);
+
+    /* Allocate the new leaf and the new inner nodes */
+    bplus_tree_node_t *new_nodes[BPLUS_TREE_MAX_HEIGHT + 1];
+
+    for (size_t iter = 0; iter < number_of_nodes; ++iter) {
+        new_nodes[iter] = create_bplus_tree_node(tree, (0 == iter) ? 1 : 0);
+
+        if (NULL == new_nodes[iter]) {
+            while (iter > 0) {
+                scl_free(tree->allocator, new_nodes[--iter]);
+            }
+
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+    }
+
+    /* Split the leaf, the right half goes into the new leaf */
+    bplus_tree_node_t * const new_leaf = new_nodes[0];
+    const size_t left_count = (tree->leaf_capacity + 1) / 2;
+
+    memcpy(bplus_tree_key(tree, new_leaf, 0), bplus_tree_key(tree, leaf, left_count), (leaf->count - left_count) * tree->data_size);
+    new_leaf->count = (uint32_t)(leaf->count - left_count);
+    leaf->count = (uint32_t)left_count;
+
+    bplus_tree_node_t *insert_leaf = leaf;
+
+    if (position > left_count) {
+        insert_leaf = new_leaf;
+        position -= left_count;
+    }
+
+    memmove(bplus_tree_key(tree, insert_leaf, position + 1), bplus_tree_key(tree, insert_leaf, position), (insert_leaf->count - position) * tree->data_size);
+    memcpy(bplus_tree_key(tree, insert_leaf, position), data, tree->data_size);
+    ++(insert_leaf->count);
+
+    /* Link the new leaf after the split leaf */
+    new_leaf->next = leaf->next;
+    new_leaf->prev = leaf;
+
+    if (NULL != leaf->next) {
+        leaf->next->prev = new_leaf;
+    } else {
+        tree->tail = new_leaf;
+    }
+
+    leaf->next = new_leaf;
+
+    /* Separator and node to insert into the parent */
+    const void *separator = bplus_tree_key(tree, new_leaf, 0);
+    bplus_tree_node_t *right_node = new_leaf;
+
+    for (size_t iter = 1; iter <= number_of_splits; ++iter) {
+        bplus_tree_node_t * const node = path[--depth];
+        bplus_tree_node_t * const new_node = new_nodes[iter];
+        const size_t middle = tree->inner_capacity / 2;
+        const size_t key_index = child_index[depth];
+
+        /* The keys after the middle one and their children go into the new node */
+        memcpy(bplus_tree_key(tree, new_node, 0), bplus_tree_key(tree, node, middle + 1), (node->count - middle - 1) * tree->data_size);
+        memcpy(bplus_tree_children(tree, new_node), bplus_tree_children(tree, node) + middle + 1, (node->count - middle) * sizeof(bplus_tree_node_t *));
+        new_node->count = (uint32_t)(node->count - middle - 1);
+
+        /*
+         * The middle key moves up, it waits in the last key slot of the
+         * new node, which stays free after the insertion below
+         */
+        memcpy(bplus_tree_key(tree, new_node, tree->inner_capacity - 1), bplus_tree_key(tree, node, middle), tree->data_size);
+        node->count = (uint32_t)middle;
+
+        if (key_index <= middle) {
+            bplus_tree_inner_insert(tree, node, key_index, separator, right_node);
+        } else {
+            bplus_tree_inner_insert(tree, new_node, key_index - middle - 1, separator, right_node);
+        }
+
+        separator = bplus_tree_key(tree, new_node, tree->inner_capacity - 1);
+        right_node = new_node;
+    }
+
+    if (0 == depth) {
+
+        /* The root was split, the tree grows by one level */
+        bplus_tree_node_t * const new_root = new_nodes[number_of_nodes - 1];
+
+        memcpy(bplus_tree_key(tree, new_root, 0), separator, tree->data_size);
+        bplus_tree_children(tree, new_root)[0] = tree->root;
+        bplus_tree_children(tree, new_root)[1] = right_node;
+        new_root->count = 1;
+
+        tree->root = new_root;
+        ++(tree->height);
+    } else {
+        bplus_tree_inner_insert(tree, path[depth - 1], child_index[depth - 1], separator, right_node);
+    }
+
+    ++(tree->size);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to build a B+ tree from an array sorted in ascending
+ * order (according to the compare function) in O(N) time, instead of N
+ * insertions. The elements fill the leaves one after another (equal
+ * neighbour elements are stored once) and every level of inner nodes is
+ * built over the previous one, the nodes of a level get the same number of
+ * entries (give or take one). All the nodes are allocated before the tree
+ * is built. The tree must be empty.
+ *
+ * @param tree an allocated B+ tree object
+ * @param arr pointer to the first element of the sorted array
+ * @param number_of_elem number of elements of the array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bplus_tree_build_sorted(bplus_tree_t * const __restrict__ tree, const void * __restrict__ arr, size_t number_of_elem) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BPLUS_TREE;
+    }
+
+    if (((NULL == arr) && (0 != number_of_elem)) || (0 != tree->size)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const uint8_t * const data = arr;
+    size_t number_of_keys = 0;
+
+    /* Check the order of the array and count the distinct elements */
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        int32_t cmp = (0 == iter) ? -1 : tree->cmp(data + (iter - 1) * tree->data_size, data + iter * tree->data_size);
+
+        if (cmp >= 1) {
+            return SCL_INVALID_INPUT;
+        }
+
+        if (cmp <= -1) {
+            ++number_of_keys;
+        }
+    }
+
+    if (0 == number_of_keys) {
+        return SCL_OK;
+    }
+
+    /* Count the nodes of every level */
+    size_t number_of_leaves = (number_of_keys + tree->leaf_capacity - 1) / tree->leaf_capacity;
+    size_t number_of_inner = 0;
+
+    for (size_t level_nodes = number_of_leaves; level_nodes > 1;) {
+        level_nodes = (level_nodes + tree->inner_capacity) / (tree->inner_capacity + 1);
+        number_of_inner += level_nodes;
+    }
+
+    /* Allocate all the nodes, chained through their next links */
+    bplus_tree_node_t *leaves = NULL;
+    bplus_tree_node_t *inner = NULL;
+
+    for (size_t iter = 0; iter < number_of_leaves + number_of_inner; ++iter) {
+        bplus_tree_node_t *new_node = create_bplus_tree_node(tree, (iter < number_of_leaves) ? 1 : 0);
+
+        if (NULL == new_node) {
+            while (NULL != leaves) {
+                bplus_tree_node_t *next_node = leaves->next;
+                scl_free(tree->allocator, leaves);
+                leaves = next_node;
+            }
+
+            while (NULL != inner) {
+                bplus_tree_node_t *next_node = inner->next;
+                scl_free(tree->allocator, inner);
+                inner = next_node;
+            }
+
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        if (iter < number_of_leaves) {
+            new_node->next = leaves;
+            leaves = new_node;
+        } else {
+            new_node->next = inner;
+            inner = new_node;
+        }
+    }
+
+    /* Fill the leaves in order, skipping the equal neighbour elements */
+    bplus_tree_node_t *leaf = leaves;
+    size_t elem_index = 0;
+
+    tree->head = leaves;
+
+    for (size_t iter = 0; iter < number_of_leaves; ++iter) {
+        size_t leaf_keys = number_of_keys / number_of_leaves + ((iter < number_of_keys % number_of_leaves) ? 1 : 0);
+
+        while (leaf->count < leaf_keys) {
+
+            /* Skip the elements equal to the previous one */
+            while ((0 != elem_index) && (0 == tree->cmp(data + (elem_index - 1) * tree->data_size, data + elem_index * tree->data_size))) {
+                ++elem_index;
+            }
+
+            memcpy(bplus_tree_key(tree, leaf, leaf->count), data + elem_index * tree->data_size, tree->data_size);
+
+            ++(leaf->count);
+            ++elem_index;
+        }
+
+        if (NULL != leaf->next) {
+            leaf->next->prev = leaf;
+        } else {
+            tree->tail = leaf;
+        }
+
+        leaf = leaf->next;
+    }
+
+    /* Build the inner levels, the first node of a level is chained through next */
+    bplus_tree_node_t *level = leaves;
+    size_t level_nodes = number_of_leaves;
+
+    tree->height = 1;
+
+    while (level_nodes > 1) {
+        size_t parent_nodes = (level_nodes + tree->inner_capacity) / (tree->inner_capacity + 1);
+        bplus_tree_node_t *parent_level = inner;
+        bplus_tree_node_t *child = level;
+
+        for (size_t iter = 0; iter < parent_nodes; ++iter) {
+            bplus_tree_node_t * const parent = inner;
+            bplus_tree_node_t ** const children = bplus_tree_children(tree, parent);
+            size_t parent_children = level_nodes / parent_nodes + ((iter < level_nodes % parent_nodes) ? 1 : 0);
+
+            inner = inner->next;
+
+            for (size_t child_iter = 0; child_iter < parent_children; ++child_iter) {
+                bplus_tree_node_t * const next_child = child->next;
+
+                /* The key before a child is the smallest element of the child */
+                if (0 != child_iter) {
+                    const bplus_tree_node_t *min_node = child;
+
+                    while (0 == min_node->is_leaf) {
+                        min_node = bplus_tree_children(tree, min_node)[0];
+                    }
+
+                    memcpy(bplus_tree_key(tree, parent, child_iter - 1), bplus_tree_key(tree, min_node, 0), tree->data_size);
+                }
+
+                children[child_iter] = child;
+
+                /* Only the leaves stay linked */
+                if (0 == child->is_leaf) {
+                    child->next = NULL;
+                }
+
+                child = next_child;
+            }
+
+            parent->count = (uint32_t)(parent_children - 1);
+            parent->next = (iter + 1 < parent_nodes) ? inner : NULL;
+        }
+
+        level = parent_level;
+        level_nodes = parent_nodes;
+        ++(tree->height);
+    }
+
+    tree->root = level;
+    tree->size = number_of_keys;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove a key and its right child from an inner node.
+ *
+ * @param tree an allocated B+ tree object
+ * @param node an inner node of the tree
+ * @param key_index index of the key to remove
+ */
+static void bplus_tree_inner_remove(const bplus_tree_t * const __restrict__ tree, bplus_tree_node_t * const __restrict__ node, size_t key_index) {
+    bplus_tree_node_t ** const children = bplus_tree_children(tree, node);
+
+    memmove(bplus_tree_key(tree, node, key_index), bplus_tree_key(tree, node, key_index + 1), (node->count - key_index - 1) * tree->data_size);
+    memmove(children + key_index + 1, children + key_index + 2, (node->count - key_index - 1) * sizeof(*children));
+
+    --(node->count);
+}
+
+/**
+ * @brief Function to fix a node with too few keys (less than half of its
+ * capacity) by borrowing one entry from a sibling or by merging with a
+ * sibling, in which case the parent loses one key.
+ *
+ * @param tree an allocated B+ tree object
+ * @param parent parent of the node
+ * @param index index of the node among the children of parent
+ */
+static void bplus_tree_rebalance(bplus_tree_t * const __restrict__ tree, bplus_tree_node_t * const __restrict__ parent, size_t index) {
+    bplus_tree_node_t ** const parent_children = bplus_tree_children(tree, parent);
+    bplus_tree_node_t * const node = parent_children[index];
+    bplus_tree_node_t * const left = (0 != index) ? parent_children[index - 1] : NULL;
+    bplus_tree_node_t * const right = (index < parent->count) ? parent_children[index + 1] : NULL;
+    const size_t ds = tree->data_size;
+
+    if (0 != node->is_leaf) {
+        const size_t min_keys = tree->leaf_capacity / 2;
+
+        if ((NULL != left) && (left->count > min_keys)) {
+
+            /* Move the greatest element of the left leaf in front of the node */
+            memmove(bplus_tree_key(tree, node, 1), bplus_tree_key(tree, node, 0), node->count * ds);
+            memcpy(bplus_tree_key(tree, node, 0), bplus_tree_key(tree, left, left->count - 1), ds);
+
+            --(left->count);
+            ++(node->count);
+
+            memcpy(bplus_tree_key(tree, parent, index - 1), bplus_tree_key(tree, node, 0), ds);
+        } else if ((NULL != right) && (right->count > min_keys)) {
+
+            /* Move the smallest element of the right leaf after the node */
+            memcpy(bplus_tree_key(tree, node, node->count), bplus_tree_key(tree, right, 0), ds);
+            memmove(bplus_tree_key(tree, right, 0), bplus_tree_key(tree, right, 1), (right->count - 1) * ds);
+
+            --(right->count);
+            ++(node->count);
+
+            memcpy(bplus_tree_key(tree, parent, index), bplus_tree_key(tree, right, 0), ds);
+        } else {
+
+            /* Merge the node with one of its siblings, the left one is kept */
+            bplus_tree_node_t * const merge_left = (NULL != left) ? left : node;
+            bplus_tree_node_t * const merge_right = (NULL != left) ? node : right;
+
+            memcpy(bplus_tree_key(tree, merge_left, merge_left->count), bplus_tree_key(tree, merge_right, 0), merge_right->count * ds);
+            merge_left->count += merge_right->count;
+
+            merge_left->next = merge_right->next;
+
+            if (NULL != merge_right->next) {
+                merge_right->next->prev = merge_left;
+            } else {
+                tree->tail = merge_left;
+            }
+
+            bplus_tree_inner_remove(tree, parent, (NULL != left) ? index - 1 : index);
+            scl_free(tree->allocator, merge_right);
+        }
+    } else {
+        const size_t min_keys = (tree->inner_capacity - 1) / 2;
+        bplus_tree_node_t ** const children = bplus_tree_children(tree, node);
+
+        if ((NULL != left) && (left->count > min_keys)) {
+            bplus_tree_node_t ** const left_children = bplus_tree_children(tree, left);
+
+            /* Rotate the last child of the left node through the parent */
+            memmove(bplus_tree_key(tree, node, 1), bplus_tree_key(tree, node, 0), node->count * ds);
+            memmove(children + 1, children, (node->count + 1) * sizeof(*children));
+
+            memcpy(bplus_tree_key(tree, node, 0), bplus_tree_key(tree, parent, index - 1), ds);
+            children[0] = left_children[left->count];
+            memcpy(bplus_tree_key(tree, parent, index - 1), bplus_tree_key(tree, left, left->count - 1), ds);
+
+            --(left->count);
+            ++(node->count);
+        } else if ((NULL != right) && (right->count > min_keys)) {
+            bplus_tree_node_t ** const right_children = bplus_tree_children(tree, right);
+
+            /* Rotate the first child of the right node through the parent */
+            memcpy(bplus_tree_key(tree, node, node->count), bplus_tree_key(tree, parent, index), ds);
+            children[node->count + 1] = right_children[0];
+            memcpy(bplus_tree_key(tree, parent, index), bplus_tree_key(tree, right, 0), ds);
+
+            memmove(bplus_tree_key(tree, right, 0), bplus_tree_key(tree, right, 1), (right->count - 1) * ds);
+            memmove(right_children, right_children + 1, right->count * sizeof(*right_children));
+
+            --(right->count);
+            ++(node->count);
+        } else {
+
+            /* Merge the node with one of its siblings, the key between them comes down */
+            bplus_tree_node_t * const merge_left = (NULL != left) ? left : node;
+            bplus_tree_node_t * const merge_right = (NULL != left) ? node : right;
+            const size_t key_index = (NULL != left) ? index - 1 : index;
+
+            memcpy(bplus_tree_key(tree, merge_left, merge_left->count), bplus_tree_key(tree, parent, key_index), ds);
+            memcpy(bplus_tree_key(tree, merge_left, merge_left->count + 1), bplus_tree_key(tree, merge_right, 0), merge_right->count * ds);
+            memcpy(bplus_tree_children(tree, merge_left) + merge_left->count + 1, bplus_tree_children(tree, merge_right), (merge_right->count + 1) * sizeof(*children));
+            merge_left->count += merge_right->count + 1;
+
+            bplus_tree_inner_remove(tree, parent, key_index);
+            scl_free(tree->allocator, merge_right);
+        }
+    }
+}
+
+/**
+ * @brief Function to delete one generic data from a B+ tree. The element
+ * is removed from its leaf, the separator that copied it is replaced by the
+ * next element of the leaf, and a leaf or an inner node left less than half
+ * full borrows from a sibling or is merged with it, up to the root.
+ *
+ * @param tree an allocated B+ tree object
+ * @param data pointer to an address of a generic data to be deleted
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bplus_tree_delete(bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BPLUS_TREE;
+    }
+
+    if (NULL == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    bplus_tree_node_t *path[BPLUS_TREE_MAX_HEIGHT];
+    size_t child_index[BPLUS_TREE_MAX_HEIGHT];
+    size_t depth = tree->height - 1;
+
+    bplus_tree_node_t * const leaf = bplus_tree_find_leaf(tree, data, path, child_index);
+    const size_t position = bplus_tree_bound(tree, leaf, data, 0);
+
+    if ((position == leaf->count) || (0 != tree->cmp(bplus_tree_key(tree, leaf, position), data))) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    /* Free content of the data and remove it from the leaf */
+    if (NULL != tree->frd) {
+        tree->frd(bplus_tree_key(tree, leaf, position));
+    }
+
+    memmove(bplus_tree_key(tree, leaf, position), bplus_tree_key(tree, leaf, position + 1), (leaf->count - position - 1) * tree->data_size);
+
+    --(leaf->count);
+    --(tree->size);
+
+    /* The last element of the tree was deleted, only the root leaf can get empty */
+    if (0 == leaf->count) {
+        scl_free(tree->allocator, leaf);
+
+        tree->root = tree->head = tree->tail = NULL;
+        tree->height = 0;
+
+        return SCL_OK;
+    }
+
+    /* The smallest element of the leaf was a separator of an ancestor, copy the new one */
+    if (0 == position) {
+        for (size_t iter = depth; iter > 0; --iter) {
+            if (0 != child_index[iter - 1]) {
+                memcpy(bplus_tree_key(tree, path[iter - 1], child_index[iter - 1] - 1), bplus_tree_key(tree, leaf, 0), tree->data_size);
+                break;
+            }
+        }
+    }
+
+    /* Fix the nodes left less than half full, from the leaf to the root */
+    bplus_tree_node_t *node = leaf;
+
+    while (depth > 0) {
+        const size_t min_keys = (0 != node->is_leaf) ? tree->leaf_capacity / 2 : (tree->inner_capacity - 1) / 2;
+
+        if (node->count >= min_keys) {
+            break;
+        }
+
+        --depth;
+        bplus_tree_rebalance(tree, path[depth], child_index[depth]);
+        node = path[depth];
+    }
+
+    /* A root without keys gives its place to its only child */
+    if ((0 == tree->root->is_leaf) && (0 == tree->root->count)) {
+        bplus_tree_node_t * const old_root = tree->root;
+
+        tree->root = bplus_tree_children(tree, old_root)[0];
+        --(tree->height);
+
+        scl_free(tree->allocator, old_root);
+    }
+
+    /* Deletion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search data in a B+ tree, one node is read on every
+ * level and the keys of a node are searched by binary search.
+ *
+ * @param tree an allocated B+ tree object
+ * @param data pointer to an address of a generic data type
+ * @return const void* the stored element equal to data or `NULL`
+ */
+const void* bplus_tree_find_data(const bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == data) || (NULL == tree->root)) {
+        return NULL;
+    }
+
+    const bplus_tree_node_t * const leaf = bplus_tree_find_leaf(tree, data, NULL, NULL);
+    const size_t position = bplus_tree_bound(tree, leaf, data, 0);
+
+    if ((position < leaf->count) && (0 == tree->cmp(bplus_tree_key(tree, leaf, position), data))) {
+        return bplus_tree_key(tree, leaf, position);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to get the smallest element of a B+ tree in O(1).
+ *
+ * @param tree an allocated B+ tree object
+ * @return const void* the smallest element or `NULL` if tree is empty
+ */
+const void* bplus_tree_min_data(const bplus_tree_t * const __restrict__ tree) {
+    if ((NULL == tree) || (NULL == tree->head)) {
+        return NULL;
+    }
+
+    return bplus_tree_key(tree, tree->head, 0);
+}
+
+/**
+ * @brief Function to get the greatest element of a B+ tree in O(1).
+ *
+ * @param tree an allocated B+ tree object
+ * @return const void* the greatest element or `NULL` if tree is empty
+ */
+const void* bplus_tree_max_data(const bplus_tree_t * const __restrict__ tree) {
+    if ((NULL == tree) || (NULL == tree->tail)) {
+        return NULL;
+    }
+
+    return bplus_tree_key(tree, tree->tail, tree->tail->count - 1);
+}
+
+/**
+ * @brief Helper function to place a cursor on the first element that
+ * is not smaller than data (strict is 0) or that is greater than data
+ * (strict is 1).
+ *
+ * @param tree an allocated non-empty B+ tree object
+ * @param iter pointer to the cursor to place
+ * @param data pointer to the data to search for
+ * @param strict 1 to skip the element equal to data, 0 otherwise
+ */
+static void bplus_tree_seek_helper(const bplus_tree_t * const __restrict__ tree, bplus_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data, uint8_t strict) {
+    const bplus_tree_node_t * const leaf = bplus_tree_find_leaf(tree, data, NULL, NULL);
+    const size_t position = bplus_tree_bound(tree, leaf, data, strict);
+
+    iter->tree = tree;
+    iter->node = leaf;
+    iter->index = position;
+
+    /* All the elements of the leaf are before data, the bound starts the next leaf */
+    if (position == leaf->count) {
+        iter->node = leaf->next;
+        iter->index = 0;
+    }
+}
+
+/**
+ * @brief Function to find the first element of a B+ tree that is not
+ * smaller than data.
+ *
+ * @param tree an allocated B+ tree object
+ * @param data pointer to the data to search for
+ * @return const void* the first element not smaller than data or `NULL`
+ * if all the elements are smaller
+ */
+const void* bplus_tree_lower_bound(const bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    bplus_tree_iter_t iter;
+
+    return bplus_tree_iter_seek(tree, &iter, data);
+}
+
+/**
+ * @brief Function to find the first element of a B+ tree that is
+ * greater than data.
+ *
+ * @param tree an allocated B+ tree object
+ * @param data pointer to the data to search for
+ * @return const void* the first element greater than data or `NULL`
+ * if no element is greater
+ */
+const void* bplus_tree_upper_bound(const bplus_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data) || (NULL == tree->root)) {
+        return NULL;
+    }
+
+    bplus_tree_iter_t iter;
+
+    bplus_tree_seek_helper(tree, &iter, data, 1);
+
+    return bplus_tree_iter_data(&iter);
+}
+
+/**
+ * @brief Function to call action on every element of a B+ tree from the
+ * half-open interval [lo, hi) in ascending order. The first element is
+ * searched once and the scan goes through the linked leaves, so it takes
+ * O(logN + K) time and reads the elements of a leaf contiguously.
+ *
+ * @param tree an allocated B+ tree object
+ * @param lo pointer to the lower bound of the interval (inclusive)
+ * @param hi pointer to the upper bound of the interval (exclusive)
+ * @param action a pointer to a function that will perform an action
+ * on every element of the interval
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bplus_tree_range(const bplus_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BPLUS_TREE;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    bplus_tree_iter_t iter;
+
+    /* Stop at the end of the tree or at the first element not smaller than hi */
+    for (const void *data = bplus_tree_iter_seek(tree, &iter, lo); (NULL != data) && (tree->cmp(data, hi) < 0); data = bplus_tree_iter_next(&iter)) {
+        action((void *)data);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to call action on every element of a B+ tree in
+ * ascending order, walking the linked leaves.
+ *
+ * @param tree an allocated B+ tree object
+ * @param action a pointer to a function that will perform an action
+ * on every element
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bplus_tree_traverse(const bplus_tree_t * const __restrict__ tree, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BPLUS_TREE;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    for (const bplus_tree_node_t *leaf = tree->head; NULL != leaf; leaf = leaf->next) {
+
+        /* The next leaf is read after this one, ask for it */
+        if (NULL != leaf->next) {
+            SCL_PREFETCH(leaf->next);
+        }
+
+        for (size_t iter = 0; iter < leaf->count; ++iter) {
+            action(bplus_tree_key(tree, leaf, iter));
+        }
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the smallest element of a B+ tree.
+ * The elements can be visited in ascending order without a callback:
+ * for (d = bplus_tree_iter_begin(tree, &iter); NULL != d; d = bplus_tree_iter_next(&iter)).
+ *
+ * @param tree an allocated B+ tree object
+ * @param iter pointer to the cursor to place
+ * @return const void* the smallest element or `NULL` if the tree is empty
+ */
+const void* bplus_tree_iter_begin(const bplus_tree_t * const __restrict__ tree, bplus_tree_iter_t * const __restrict__ iter) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = (NULL != tree) ? tree->head : NULL;
+    iter->index = 0;
+
+    return bplus_tree_iter_data(iter);
+}
+
+/**
+ * @brief Function to place a cursor on the greatest element of a B+ tree,
+ * in order to visit the elements in descending order with bplus_tree_iter_prev.
+ *
+ * @param tree an allocated B+ tree object
+ * @param iter pointer to the cursor to place
+ * @return const void* the greatest element or `NULL` if the tree is empty
+ */
+const void* bplus_tree_iter_rbegin(const bplus_tree_t * const __restrict__ tree, bplus_tree_iter_t * const __restrict__ iter) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = (NULL != tree) ? tree->tail : NULL;
+    iter->index = (NULL != iter->node) ? iter->node->count - 1 : 0;
+
+    return bplus_tree_iter_data(iter);
+}
+
+/**
+ * @brief Function to place a cursor on the first element of a B+ tree
+ * that is not smaller than data (the lower bound of data).
+ *
+ * @param tree an allocated B+ tree object
+ * @param iter pointer to the cursor to place
+ * @param data pointer to the data to search for
+ * @return const void* the first element not smaller than data or `NULL`
+ * if all the elements are smaller
+ */
+const void* bplus_tree_iter_seek(const bplus_tree_t * const __restrict__ tree, bplus_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+    iter->index = 0;
+
+    if ((NULL == tree) || (NULL == data) || (NULL == tree->root)) {
+        return NULL;
+    }
+
+    bplus_tree_seek_helper(tree, iter, data, 0);
+
+    return bplus_tree_iter_data(iter);
+}
+
+/**
+ * @brief Function to move a cursor to the next element in ascending
+ * order, in O(1). A cursor after the end of the tree stays there.
+ *
+ * @param iter pointer to a placed cursor
+ * @return const void* the next element or `NULL` if the cursor passed
+ * the greatest element
+ */
+const void* bplus_tree_iter_next(bplus_tree_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is on an element */
+    if (NULL == bplus_tree_iter_data(iter)) {
+        return NULL;
+    }
+
+    if (++(iter->index) == iter->node->count) {
+        iter->node = iter->node->next;
+        iter->index = 0;
+    }
+
+    return bplus_tree_iter_data(iter);
+}
+
+/**
+ * @brief Function to move a cursor to the previous element in ascending
+ * order, in O(1). A cursor after the end of the tree stays there.
+ *
+ * @param iter pointer to a placed cursor
+ * @return const void* the previous element or `NULL` if the cursor passed
+ * the smallest element
+ */
+const void* bplus_tree_iter_prev(bplus_tree_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is on an element */
+    if (NULL == bplus_tree_iter_data(iter)) {
+        return NULL;
+    }
+
+    if (0 == iter->index) {
+        iter->node = iter->node->prev;
+        iter->index = (NULL != iter->node) ? iter->node->count - 1 : 0;
+    } else {
+        --(iter->index);
+    }
+
+    return bplus_tree_iter_data(iter);
+}
+
+/**
+ * @brief Function to get the element under a cursor.
+ *
+ * @param iter pointer to a placed cursor
+ * @return const void* the element under the cursor or `NULL` if the
+ * cursor is after the end of the tree
+ */
+const void* bplus_tree_iter_data(const bplus_tree_iter_t * const __restrict__ iter) {
+    if ((NULL == iter) || (NULL == iter->tree) || (NULL == iter->node) || (iter->index >= iter->node->count)) {
+        return NULL;
+    }
+
+    return bplus_tree_key(iter->tree, iter->node, iter->index);
+}
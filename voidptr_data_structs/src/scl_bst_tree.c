@@ -50,18 +50,22 @@ bst_tree_t* create_bst(compare_func cmp, free_func frd, size_t data_size) {
         return NULL;
     }
 
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new binary search tree on heap */
-    bst_tree_t *new_tree = malloc(sizeof(*new_tree));
+    bst_tree_t *new_tree = scl_malloc(allocator, sizeof(*new_tree));
 
     /* Check if binary search tree was allocated */
     if (NULL != new_tree) {
+        new_tree->allocator = allocator;
 
         /* Set function pointers */
         new_tree->cmp = cmp;
         new_tree->frd = frd;
 
         /* Create `nil` node */
-        new_tree->nil = malloc(sizeof(*new_tree->nil));
+        new_tree->nil = scl_malloc(allocator, sizeof(*new_tree->nil));
 
         /* Set default values for a `nil` cell*/
         if (NULL != new_tree->nil) {
@@ -78,6 +82,7 @@ bst_tree_t* create_bst(compare_func cmp, free_func frd, size_t data_size) {
         new_tree->root = new_tree->nil;
         new_tree->data_size = data_size;
         new_tree->size = 0;
+        new_tree->node_pool = NULL;
     } else {
         errno = ENOMEM;
         perror("Not enough memory for bst allocation");
@@ -103,8 +108,14 @@ static bst_tree_node_t* create_bst_node(const bst_tree_t * const __restrict__ tr
         return tree->nil;
     }
 
-    /* Allocate a new node on the heap */
-    bst_tree_node_t *new_node = malloc(sizeof(*new_node));
+    /* Allocate a new node from the node pool or on the heap */
+    bst_tree_node_t *new_node = NULL;
+
+    if (NULL != tree->node_pool) {
+        new_node = mem_pool_alloc(tree->node_pool);
+    } else {
+        new_node = scl_malloc(tree->allocator, SCL_ALIGN_SIZE(sizeof(*new_node)) + tree->data_size);
+    }
 
     /* Check if allocation went successfully */
     if (NULL != new_node) {
@@ -114,24 +125,14 @@ static bst_tree_node_t* create_bst_node(const bst_tree_t * const __restrict__ tr
         new_node->parent = tree->nil;
         new_node->count = 1;
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(tree->data_size);
+        /* The data is stored inline, right after the node, in the same block */
+        new_node->data = (uint8_t *)new_node + SCL_ALIGN_SIZE(sizeof(*new_node));
 
-        /* Check if memory allocation went right */
-        if (NULL != new_node->data) {
-
-            /*
-             * Copy all bytes from data pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->data, data, tree->data_size);
-        } else {
-            free(new_node);
-            new_node = tree->nil;
-
-            errno = ENOMEM;
-            perror("Not enough memory for node bst data allocation");
-        }
+        /*
+         * Copy all bytes from data pointer
+         * to memory allocated on heap
+         */
+        memcpy(new_node->data, data, tree->data_size);
     } else {
         new_node = tree->nil;
         errno = ENOMEM;
@@ -143,42 +144,51 @@ static bst_tree_node_t* create_bst_node(const bst_tree_t * const __restrict__ tr
 }
 
 /**
- * @brief A helper function for free_bst function.
- * Function will iterate through all nodes recursively
- * by Left-Right-Root principle.
+ * @brief A helper function for free_bst function. A binary search
+ * tree is not balanced, filled with sorted data it is a chain of N
+ * nodes, so the nodes are freed without recursion and any shape of
+ * the tree takes constant stack: the left child of the current node
+ * is rotated up until the node has no left child, then the node is
+ * freed and its right child becomes the current node.
  * 
  * @param tree an allocated binary search tree object
- * @param root pointer to pointer to current bst node object
+ * @param root pointer to pointer of the root bst node object
  */
 static void free_bst_helper(const bst_tree_t * const __restrict__ tree, bst_tree_node_t ** const __restrict__ root) {
-    /* Check if current node is valid */
-    if (tree->nil == *root) {
-        return;
-    }
+    bst_tree_node_t *iterator = *root;
 
-    /* Recursive calls */
-    free_bst_helper(tree, &(*root)->left);
-    free_bst_helper(tree, &(*root)->right);
+    while (tree->nil != iterator) {
+        if (tree->nil != iterator->left) {
 
-    /* Free content of the data pointer */
-    if ((NULL != tree->frd) && (NULL != (*root)->data)) {
-        tree->frd((*root)->data);
-    }
+            /* Rotate the left child up, the tree becomes a right chain */
+            bst_tree_node_t *left_node = iterator->left;
 
-    /* Free data pointer */
-    if (NULL != (*root)->data) {
-        free((*root)->data);
-    }
+            iterator->left = left_node->right;
+            left_node->right = iterator;
+            iterator = left_node;
+        } else {
+            bst_tree_node_t *right_node = iterator->right;
+
+            /* Free content of the data pointer */
+            if ((NULL != tree->frd) && (NULL != iterator->data)) {
+                tree->frd(iterator->data);
+            }
 
-    /* Set data pointer as NULL */
-    (*root)->data = NULL;
+            /* Set data pointer as NULL */
+            iterator->data = NULL;
 
-    /* Free bst node pointer */
-    if (tree->nil != *root) {
-        free(*root);
+            /* Free bst node pointer */
+            if (NULL != tree->node_pool) {
+                mem_pool_free(tree->node_pool, iterator);
+            } else {
+                scl_free(tree->allocator, iterator);
+            }
 
-        *root = tree->nil;
+            iterator = right_node;
+        }
     }
+
+    *root = tree->nil;
 }
 
 /**
@@ -197,15 +207,23 @@ scl_error_t free_bst(bst_tree_t *const __restrict__ tree) {
     if (NULL != tree) {
 
         /* Free every node from bst -> tree */
-        free_bst_helper(tree, &tree->root);
+        if ((NULL == tree->node_pool) || (NULL != tree->frd)) {
+            free_bst_helper(tree, &tree->root);
+        }
+
+        /* Free all chunks of the node pool at once */
+        if (NULL != tree->node_pool) {
+            free_mem_pool(tree->node_pool);
+            tree->node_pool = NULL;
+        }
         
         /* Free `nil` cell*/
-        free(tree->nil);
+        scl_free(tree->allocator, tree->nil);
 
         tree->nil = NULL;
 
         /* Free binary search tree object */
-        free(tree);
+        scl_free(tree->allocator, tree);
 
         return SCL_OK;
     }
@@ -213,6 +231,51 @@ scl_error_t free_bst(bst_tree_t *const __restrict__ tree) {
     return SCL_NULL_BST;
 }
 
+/**
+ * @brief Function to make the binary search tree allocate its nodes from a node pool.
+ * Every node and its data are stored in one object of the pool, the objects
+ * are taken from contiguous chunks and are reused through a free list, and
+ * free_bst releases whole chunks (without visiting the nodes if no free
+ * function was provided). The binary search tree must be empty.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param nodes_per_chunk number of nodes from one chunk of the pool (0 for default)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_use_node_pool(bst_tree_t * const __restrict__ tree, size_t nodes_per_chunk) {
+    /* Check if tree is allocated */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    /* Nodes allocated on the heap cannot be moved into a pool */
+    if (0 != tree->size) {
+        return SCL_NOT_EMPTY_OBJECT_FOR_POOL;
+    }
+
+    /* Tree already uses a node pool */
+    if (NULL != tree->node_pool) {
+        return SCL_OK;
+    }
+
+    /* The pool takes its chunks from the allocator of the object */
+    const scl_allocator_t *thread_allocator = scl_get_allocator();
+
+    scl_set_allocator(tree->allocator);
+
+    /* One object of the pool holds the node and its data */
+    tree->node_pool = create_mem_pool(SCL_ALIGN_SIZE(sizeof(*tree->root)) + tree->data_size, nodes_per_chunk);
+    scl_set_allocator(thread_allocator);
+
+    /* Check if node pool was allocated successfully */
+    if (NULL == tree->node_pool) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to insert one generic data to a bst.
  * Function may fail if bst or data os not valid (have
@@ -289,6 +352,137 @@ scl_error_t bst_insert(bst_tree_t * const __restrict__ tree, const void * __rest
     return SCL_OK;
 }
 
+/**
+ * @brief Function to link a chain of binary search tree nodes, kept in order through
+ * their right links, into a perfectly balanced subtree. The first half
+ * of the nodes goes into the left subtree, the next node becomes the root
+ * and the rest of the nodes go into the right subtree.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param chain pointer to the first node of the chain, moved after the used nodes
+ * @param number_of_nodes number of nodes of the subtree
+ * @return bst_tree_node_t* the root of the subtree or `nil`
+ */
+static bst_tree_node_t* bst_build_sorted_helper(const bst_tree_t * const __restrict__ tree, bst_tree_node_t ** const __restrict__ chain, size_t number_of_nodes) {
+    /* Empty subtree */
+    if (0 == number_of_nodes) {
+        return tree->nil;
+    }
+
+    bst_tree_node_t *left_node = bst_build_sorted_helper(tree, chain, number_of_nodes / 2);
+
+    /* The next node of the chain is the root of the subtree */
+    bst_tree_node_t *root = *chain;
+    *chain = root->right;
+
+    bst_tree_node_t *right_node = bst_build_sorted_helper(tree, chain, number_of_nodes - number_of_nodes / 2 - 1);
+
+    /* Update the links of the root */
+    root->left = left_node;
+    root->right = right_node;
+    root->parent = tree->nil;
+
+    if (tree->nil != left_node) {
+        left_node->parent = root;
+    }
+
+    if (tree->nil != right_node) {
+        right_node->parent = root;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Function to build a binary search tree from an array sorted in ascending
+ * order (according to the compare function) in O(N) time, instead of N
+ * insertions. The nodes are allocated in one pass and linked into a
+ * perfectly balanced tree. Equal neighbour elements are merged
+ * into one node, as bst_insert does. The tree must be empty.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param arr pointer to the first element of the sorted array
+ * @param number_of_elem number of elements of the array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_build_sorted(bst_tree_t * const __restrict__ tree, const void * __restrict__ arr, size_t number_of_elem) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if (((NULL == arr) && (0 != number_of_elem)) || (0 != tree->size)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const uint8_t * const data = arr;
+    size_t number_of_nodes = 0;
+
+    /* Check the order of the array and count the distinct elements */
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        int32_t cmp = (0 == iter) ? -1 : tree->cmp(data + (iter - 1) * tree->data_size, data + iter * tree->data_size);
+
+        if (cmp >= 1) {
+            return SCL_INVALID_INPUT;
+        }
+
+        if (cmp <= -1) {
+            ++number_of_nodes;
+        }
+    }
+
+    /* All the nodes are taken from one chunk of the node pool */
+    if ((NULL != tree->node_pool) && (SCL_OK != mem_pool_reserve(tree->node_pool, number_of_nodes))) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    /* Create the nodes in order, chained through their right links */
+    bst_tree_node_t *chain = tree->nil;
+    bst_tree_node_t *last_node = tree->nil;
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        if ((tree->nil != last_node) && (0 == tree->cmp(last_node->data, data + iter * tree->data_size))) {
+            ++(last_node->count);
+            continue;
+        }
+
+        bst_tree_node_t *new_node = create_bst_node(tree, data + iter * tree->data_size);
+
+        if (tree->nil == new_node) {
+
+            /* Free the created nodes, their data belongs to the array */
+            while (tree->nil != chain) {
+                bst_tree_node_t *next_node = chain->right;
+
+                if (NULL != tree->node_pool) {
+                    mem_pool_free(tree->node_pool, chain);
+                } else {
+                    scl_free(tree->allocator, chain);
+                }
+
+                chain = next_node;
+            }
+
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        if (tree->nil == last_node) {
+            chain = new_node;
+        } else {
+            last_node->right = new_node;
+        }
+
+        last_node = new_node;
+    }
+
+    /* Link the nodes into a perfectly balanced tree */
+    tree->root = bst_build_sorted_helper(tree, &chain, number_of_nodes);
+    tree->size = number_of_nodes;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to search data in binary search tree O(log h).
  * Function will start searching from bst tree root and will
@@ -346,6 +540,56 @@ const void* bst_find_data(const bst_tree_t * const __restrict__ tree, const void
     return bst_find_node(tree, data)->data;
 }
 
+/**
+ * @brief Function to search the node of a binary search tree whose data matches
+ * a key O(log N). key_cmp(key, data) must order the keys exactly like the
+ * compare function of the tree orders the data, so only the key has to be
+ * built for the search.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param key pointer to the key to search for
+ * @param key_cmp function to compare a key with the data of a node
+ * @return bst_tree_node_t* the node matching the key or `nil` if no such node exists
+ */
+static bst_tree_node_t* bst_find_key_node(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    bst_tree_node_t *iterator = tree->root;
+
+    /* Search for the key in all tree */
+    while (tree->nil != iterator) {
+        int32_t cmp = key_cmp(key, iterator->data);
+
+        if (cmp < 0) {
+            iterator = iterator->left;
+        } else if (cmp > 0) {
+            iterator = iterator->right;
+        } else {
+            return iterator;
+        }
+    }
+
+    /* Key was not found */
+    return tree->nil;
+}
+
+/**
+ * @brief Function to search data in a binary search tree by a key O(log N),
+ * without building a whole data object to compare against.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param key pointer to the key to search for
+ * @param key_cmp function to compare a key with the data of a node,
+ * negative if key is before the data, zero if it matches and positive if it is after
+ * @return const void* the data matching the key or `NULL` if it is not found
+ */
+const void* bst_find_key(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == key) || (NULL == key_cmp)) {
+        return NULL;
+    }
+
+    return bst_find_key_node(tree, key, key_cmp)->data;
+}
+
 /**
  * @brief Function to swap two nodes from an bst tree object.
  * This function MUST NOT be used by users, because it will
@@ -521,6 +765,50 @@ size_t get_bst_size(const bst_tree_t * const __restrict__ tree) {
     return tree->size;
 }
 
+/**
+ * @brief Function to get the memory footprint of a binary search tree. Every node
+ * holds one element inline, so the node bytes are the per node overhead
+ * (links, counters and padding) and the payload is size * data_size.
+ * With a node pool the chunk headers are counted as node bytes and the
+ * free objects of the pool as slack.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_memory_usage(const bst_tree_t * const __restrict__ tree, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* The tree object and its `nil` node */
+    usage->object_bytes = sizeof(*tree) + sizeof(*tree->nil);
+    usage->payload_bytes = tree->size * tree->data_size;
+    usage->array_bytes = 0;
+    usage->nodes = tree->size;
+
+    if (NULL != tree->node_pool) {
+        scl_memory_usage_t pool_usage;
+        mem_pool_memory_usage(tree->node_pool, &pool_usage);
+
+        /* Every node fills one object of the pool, the rest of the object is overhead */
+        usage->object_bytes += pool_usage.object_bytes;
+        usage->node_bytes = pool_usage.node_bytes + pool_usage.payload_bytes - usage->payload_bytes;
+        usage->slack_bytes = pool_usage.slack_bytes;
+    } else {
+        usage->node_bytes = tree->size * SCL_ALIGN_SIZE(sizeof(*tree->nil));
+        usage->slack_bytes = 0;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to get node with maximum data value.
  * Function will search the maximum considering root node
@@ -600,37 +888,15 @@ const void* bst_min_data(const bst_tree_t * const __restrict__ tree, const void
 }
 
 /**
- * @brief Function to delete one generic data from a bst.
- * Function may fail if input data is not valid or if
- * changing the data fails. You can delete one data at a time
- * and MUST specify a valid bst tree and a valid data pointer
+ * @brief Helper function to unlink and free a found node of a binary
+ * search tree. Used by the delete by data and
+ * the delete by key functions.
  * 
  * @param tree an allocated binary search tree object
- * @param data pointer to an address of a generic data to be deleted
+ * @param delete_node the node to delete, not `nil`
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
-    /* Check if input data is valid */
-    if (NULL == tree) {
-        return SCL_NULL_BST;
-    }
-
-    if (tree->nil == tree->root) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
-    }
-
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
-    }
-
-    /* Find current node (root) in binary search tree */
-    bst_tree_node_t *delete_node = bst_find_node(tree, data);
-
-    /* Bst node was not found exit process */
-    if (tree->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
-
+static scl_error_t bst_delete_node(bst_tree_t * const __restrict__ tree, bst_tree_node_t *delete_node) {
     /* Delete selected node */
     if ((tree->nil != delete_node->left) && (tree->nil != delete_node->right)) {
 
@@ -721,17 +987,16 @@ scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const
         tree->frd(delete_node->data);
     }
 
-    /* Free data pointer of selected node */
-    if (NULL != delete_node->data) {
-        free(delete_node->data);
-    }
-
     /* Set data pointer as `NULL` */
     delete_node->data = NULL;
 
     /* Free selected bst node pointer */
     if (tree->nil != delete_node) {
-        free(delete_node);
+        if (NULL != tree->node_pool) {
+            mem_pool_free(tree->node_pool, delete_node);
+        } else {
+            scl_free(tree->allocator, delete_node);
+        }
     }
 
     /* Set selected bst node as `nil` */
@@ -744,6 +1009,75 @@ scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const
     return SCL_OK;
 }
 
+/**
+ * @brief Function to delete one generic data from a bst.
+ * Function may fail if input data is not valid or if
+ * changing the data fails. You can delete one data at a time
+ * and MUST specify a valid bst tree and a valid data pointer
+ * 
+ * @param tree an allocated binary search tree object
+ * @param data pointer to an address of a generic data to be deleted
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Find current node (root) in binary search tree */
+    bst_tree_node_t *delete_node = bst_find_node(tree, data);
+
+    /* Bst node was not found exit process */
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return bst_delete_node(tree, delete_node);
+}
+
+/**
+ * @brief Function to delete the data of a binary search tree that matches a key,
+ * without building a whole data object to compare against. Function may
+ * fail if the tree is empty or if no data matches the key.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param key pointer to the key of the data to be deleted
+ * @param key_cmp function to compare a key with the data of a node,
+ * negative if key is before the data, zero if it matches and positive if it is after
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_delete_key(bst_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if ((NULL == key) || (NULL == key_cmp)) {
+        return SCL_INVALID_DATA;
+    }
+
+    bst_tree_node_t *delete_node = bst_find_key_node(tree, key, key_cmp);
+
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return bst_delete_node(tree, delete_node);
+}
+
 /**
  * @brief Function to search the inorder predecessor for
  * a specified data type value. Function may fail if
@@ -953,27 +1287,49 @@ const void* bst_lowest_common_ancestor_data(const bst_tree_t * const __restrict_
 
 /**
  * @brief Helper function for bst_traverse_inorder function.
- * This method will recursively iterate through all nodes by
- * Left-Root-Right principle.
+ * This method will iterate through all nodes by Left-Root-Right
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated binary search tree object
  * @param root starting point of the binary search tree traversal
  * @param action a pointer function to perform an action on one bst node object
  */
 static void bst_traverse_inorder_helper(const bst_tree_t * const __restrict__ tree, const bst_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working bst node is not `nil` */
+    /* Check if current working node is not `nil` */
     if (tree->nil == root) {
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    bst_traverse_inorder_helper(tree, root->left, action);
-    
-    /* Call action function */
-    action(root->data);
+    const bst_tree_node_t *iterator = root;
+
+    while (tree->nil != iterator->left) {
+        iterator = iterator->left;
+    }
+
+    while (tree->nil != iterator) {
+
+        /* Call action function */
+        action(iterator->data);
 
-    /* Traverse in the right sub-tree */
-    bst_traverse_inorder_helper(tree, root->right, action);
+        if (tree->nil != iterator->right) {
+
+            /* The next node is the leftmost node of the right sub-tree */
+            iterator = iterator->right;
+
+            while (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            }
+        } else {
+
+            /* The next node is the first ancestor reached from its left sub-tree */
+            while ((root != iterator) && (iterator->parent->right == iterator)) {
+                iterator = iterator->parent;
+            }
+
+            iterator = (root == iterator) ? tree->nil : iterator->parent;
+        }
+    }
 }
 
 /**
@@ -1014,27 +1370,36 @@ scl_error_t bst_traverse_inorder(const bst_tree_t * const __restrict__ tree, act
 
 /**
  * @brief Helper function for bst_traverse_preorder function.
- * This method will recursively iterate through all nodes by
- * Root-Left-Right principle.
+ * This method will iterate through all nodes by Root-Left-Right
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated binary search tree object
  * @param root starting point of the binary search tree traversal
  * @param action a pointer function to perform an action on one bst node object
  */
 static void bst_traverse_preorder_helper(const bst_tree_t * const __restrict__ tree, const bst_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working bst node is not `nil` */
-    if (tree->nil == root) {
-        return;
-    }
+    const bst_tree_node_t *iterator = root;
 
-    /* Call action function */
-    action(root->data);
+    while (tree->nil != iterator) {
 
-    /* Traverse in the left sub-tree */
-    bst_traverse_preorder_helper(tree, root->left, action);
+        /* Call action function */
+        action(iterator->data);
 
-    /* Traverse in the right sub-tree */
-    bst_traverse_preorder_helper(tree, root->right, action);
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
+
+            /* Climb to the first ancestor with a right sub-tree not visited yet */
+            while ((root != iterator) && ((iterator->parent->right == iterator) || (tree->nil == iterator->parent->right))) {
+                iterator = iterator->parent;
+            }
+
+            iterator = (root == iterator) ? tree->nil : iterator->parent->right;
+        }
+    }
 }
 
 /**
@@ -1073,29 +1438,62 @@ scl_error_t bst_traverse_preorder(const bst_tree_t * const __restrict__ tree, ac
     return SCL_OK;
 }
 
+/**
+ * @brief Helper function to find the first node of a subtree in
+ * postorder (the deepest node reached by going left whenever possible).
+ * 
+ * @param tree an allocated binary search tree object
+ * @param root root of a subtree
+ * @return const bst_tree_node_t* the first node of the subtree in postorder
+ */
+static const bst_tree_node_t* bst_traverse_postorder_first(const bst_tree_t * const __restrict__ tree, const bst_tree_node_t *root) {
+    while (1) {
+        if (tree->nil != root->left) {
+            root = root->left;
+        } else if (tree->nil != root->right) {
+            root = root->right;
+        } else {
+            return root;
+        }
+    }
+}
+
 /**
  * @brief Helper function for bst_traverse_postorder function.
- * This method will recursively iterate through all nodes by
- * Left-Right-Root principle.
+ * This method will iterate through all nodes by Left-Right-Root
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated binary search tree object
  * @param root starting point of the binary search tree traversal
  * @param action a pointer function to perform an action on one bst node object
  */
 static void bst_traverse_postorder_helper(const bst_tree_t * const __restrict__ tree, const bst_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working bst node is not `nil` */
+    /* Check if current working node is not `nil` */
     if (tree->nil == root) {
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    bst_traverse_postorder_helper(tree, root->left, action);
+    const bst_tree_node_t *iterator = bst_traverse_postorder_first(tree, root);
 
-    /* Traverse in the right sub-tree */
-    bst_traverse_postorder_helper(tree, root->right, action);
+    while (1) {
 
-    /* Call action function */
-    action(root->data);
+        /* Call action function */
+        action(iterator->data);
+
+        if (root == iterator) {
+            break;
+        }
+
+        /* After a left child comes the right sub-tree of the parent, then the parent */
+        const bst_tree_node_t *parent = iterator->parent;
+
+        if ((parent->left == iterator) && (tree->nil != parent->right)) {
+            iterator = bst_traverse_postorder_first(tree, parent->right);
+        } else {
+            iterator = parent;
+        }
+    }
 }
 
 /**
@@ -1169,6 +1567,9 @@ scl_error_t bst_traverse_level(const bst_tree_t * const __restrict__ tree, actio
         /* Check if queue was created successfully */
         if (NULL != level_queue) {
 
+            /* Nodes go through a ring buffer, if it cannot be allocated the queue stays linked */
+            queue_use_ring(level_queue, 0);
+
             scl_error_t err = SCL_OK;
 
             /* Push pointer to root node into qeuue */
@@ -1220,3 +1621,320 @@ scl_error_t bst_traverse_level(const bst_tree_t * const __restrict__ tree, actio
 
     return SCL_NULL_QUEUE;
 }
+
+/**
+ * @brief Helper function to find the first node of a binary search tree that is
+ * not smaller than data (strict is 0) or that is greater than data (strict is 1).
+ * Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param data pointer to the data to search for
+ * @param strict 1 to skip the node equal to data, 0 otherwise
+ * @return bst_tree_node_t* the found node or `nil` if no node is
+ * after data
+ */
+static bst_tree_node_t* bst_bound_node(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data, uint8_t strict) {
+    bst_tree_node_t *iterator = tree->root;
+    bst_tree_node_t *bound = tree->nil;
+
+    /* Remember the last node after data on the search path */
+    while (tree->nil != iterator) {
+        int32_t cmp = tree->cmp(iterator->data, data);
+
+        if ((cmp > 0) || ((0 == cmp) && (0 == strict))) {
+            bound = iterator;
+
+            if (0 == cmp) {
+                break;
+            }
+
+            iterator = iterator->left;
+        } else {
+            iterator = iterator->right;
+        }
+    }
+
+    return bound;
+}
+
+/**
+ * @brief Function to place a cursor on the smallest element of a binary search tree.
+ * The elements of the tree can be visited in ascending order without a callback:
+ * for (d = bst_iter_begin(tree, &iter); NULL != d; d = bst_iter_next(&iter)).
+ * 
+ * @param tree an allocated binary search tree object
+ * @param iter pointer to the cursor to place
+ * @return const void* the smallest element or `NULL` if the tree is empty
+ */
+const void* bst_iter_begin(const bst_tree_t * const __restrict__ tree, bst_tree_iter_t * const __restrict__ iter) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if (NULL == tree) {
+        return NULL;
+    }
+
+    iter->node = bst_min_node(tree, tree->root);
+
+    return bst_iter_data(iter);
+}
+
+/**
+ * @brief Function to place a cursor on the greatest element of a
+ * binary search tree, in order to visit the elements in descending order with bst_iter_prev.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param iter pointer to the cursor to place
+ * @return const void* the greatest element or `NULL` if the tree is empty
+ */
+const void* bst_iter_rbegin(const bst_tree_t * const __restrict__ tree, bst_tree_iter_t * const __restrict__ iter) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if (NULL == tree) {
+        return NULL;
+    }
+
+    iter->node = bst_max_node(tree, tree->root);
+
+    return bst_iter_data(iter);
+}
+
+/**
+ * @brief Function to place a cursor on the first element of a binary search tree
+ * that is not smaller than data (the lower bound of data). Takes O(logN) time
+ * for a balanced tree.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param iter pointer to the cursor to place
+ * @param data pointer to the data to search for
+ * @return const void* the first element not smaller than data or `NULL`
+ * if all the elements are smaller
+ */
+const void* bst_iter_seek(const bst_tree_t * const __restrict__ tree, bst_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    iter->node = bst_bound_node(tree, data, 0);
+
+    return bst_iter_data(iter);
+}
+
+/**
+ * @brief Function to move a cursor to the next element in ascending
+ * order. Visiting all the elements takes O(N) time, O(1) amortized for
+ * one step. A cursor after the end of the tree stays there.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the next element or `NULL` if the cursor passed
+ * the greatest element
+ */
+const void* bst_iter_next(bst_tree_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is on a node */
+    if (NULL == bst_iter_data(iter)) {
+        return NULL;
+    }
+
+    const bst_tree_t * const tree = iter->tree;
+    bst_tree_node_t *iterator = iter->node;
+
+    if (tree->nil != iterator->right) {
+
+        /* The next node is the smallest node of the right subtree */
+        iterator = bst_min_node(tree, iterator->right);
+    } else {
+
+        /* Go up until the node is in a left subtree */
+        bst_tree_node_t *parent_iterator = iterator->parent;
+
+        while ((tree->nil != parent_iterator) && (parent_iterator->right == iterator)) {
+            iterator = parent_iterator;
+            parent_iterator = parent_iterator->parent;
+        }
+
+        iterator = parent_iterator;
+    }
+
+    iter->node = iterator;
+
+    return bst_iter_data(iter);
+}
+
+/**
+ * @brief Function to move a cursor to the previous element in ascending
+ * order. A cursor after the end of the tree stays there.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the previous element or `NULL` if the cursor passed
+ * the smallest element
+ */
+const void* bst_iter_prev(bst_tree_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is on a node */
+    if (NULL == bst_iter_data(iter)) {
+        return NULL;
+    }
+
+    const bst_tree_t * const tree = iter->tree;
+    bst_tree_node_t *iterator = iter->node;
+
+    if (tree->nil != iterator->left) {
+
+        /* The previous node is the greatest node of the left subtree */
+        iterator = bst_max_node(tree, iterator->left);
+    } else {
+
+        /* Go up until the node is in a right subtree */
+        bst_tree_node_t *parent_iterator = iterator->parent;
+
+        while ((tree->nil != parent_iterator) && (parent_iterator->left == iterator)) {
+            iterator = parent_iterator;
+            parent_iterator = parent_iterator->parent;
+        }
+
+        iterator = parent_iterator;
+    }
+
+    iter->node = iterator;
+
+    return bst_iter_data(iter);
+}
+
+/**
+ * @brief Function to get the element under a cursor.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the element under the cursor or `NULL` if the
+ * cursor is after the end of the tree
+ */
+const void* bst_iter_data(const bst_tree_iter_t * const __restrict__ iter) {
+    if ((NULL == iter) || (NULL == iter->tree) || (NULL == iter->node) || (iter->tree->nil == iter->node)) {
+        return NULL;
+    }
+
+    return iter->node->data;
+}
+
+/**
+ * @brief Function to get how many equal elements were inserted into
+ * the node under a cursor.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return uint32_t the count of the node or 0 if the cursor is after
+ * the end of the tree
+ */
+uint32_t bst_iter_count(const bst_tree_iter_t * const __restrict__ iter) {
+    if (NULL == bst_iter_data(iter)) {
+        return 0;
+    }
+
+    return iter->node->count;
+}
+
+/**
+ * @brief Function to find the first element of a binary search tree that is not
+ * smaller than data. Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param data pointer to the data to search for
+ * @return const void* the first element not smaller than data or `NULL`
+ * if all the elements are smaller
+ */
+const void* bst_lower_bound(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    bst_tree_node_t *bound = bst_bound_node(tree, data, 0);
+
+    if (tree->nil == bound) {
+        return NULL;
+    }
+
+    return bound->data;
+}
+
+/**
+ * @brief Function to find the first element of a binary search tree that is
+ * greater than data. Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param data pointer to the data to search for
+ * @return const void* the first element greater than data or `NULL`
+ * if no element is greater
+ */
+const void* bst_upper_bound(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    bst_tree_node_t *bound = bst_bound_node(tree, data, 1);
+
+    if (tree->nil == bound) {
+        return NULL;
+    }
+
+    return bound->data;
+}
+
+/**
+ * @brief Function to call action on every element of a binary search tree from the
+ * half-open interval [lo, hi) in ascending order. The first element is found
+ * once and the others are reached through the parent links, so the
+ * scan takes O(logN + K) time for a balanced tree, where K is the
+ * number of visited elements.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param lo pointer to the lower bound of the interval (inclusive)
+ * @param hi pointer to the upper bound of the interval (exclusive)
+ * @param action a pointer to a function that will perform an action
+ * on every element of the interval
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_range(const bst_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    bst_tree_iter_t iter;
+
+    iter.tree = tree;
+    iter.node = bst_bound_node(tree, lo, 0);
+
+    /* Stop at the end of the tree or at the first element not smaller than hi */
+    while ((tree->nil != iter.node) && (tree->cmp(iter.node->data, hi) < 0)) {
+        action(iter.node->data);
+        bst_iter_next(&iter);
+    }
+
+    return SCL_OK;
+}
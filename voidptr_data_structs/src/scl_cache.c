@@ -0,0 +1,857 @@
+/**
+ * @file scl_cache.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_cache.h"
+#include "./include/scl_func_types.h"
+
+/**
+ * @brief Function to compare two entries of the index of a shard. The index
+ * maps every key to one entry, two entries are equal just if they are the same.
+ * Function MUST not be used outside this file.
+ * 
+ * @param data1 pointer to a pointer to the first entry
+ * @param data2 pointer to a pointer to the second entry
+ * @return int32_t 0 if entries are the same, 1 otherwise
+ */
+static int32_t cache_compare_entries(const void * const data1, const void * const data2) {
+    return (*(cache_entry_t * const *)data1 == *(cache_entry_t * const *)data2) ? 0 : 1;
+}
+
+/**
+ * @brief Function to select the shard of a hash value. The shard is
+ * selected by the upper half of the mixed hash, the lower bits select
+ * the bucket inside the index of the shard.
+ * Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param key_hash hash value of a key computed by the user hash function
+ * @return cache_shard_t* pointer to the shard of the key
+ */
+static cache_shard_t* cache_shard(const cache_t * const __restrict__ cache, size_t key_hash) {
+    return &cache->shards[(hash_mix(key_hash) >> 32) & (cache->number_of_shards - 1)];
+}
+
+/**
+ * @brief Function to get a frequency node for a shard, an unused
+ * node is reused if there is one. Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param shard pointer to a shard of the cache
+ * @param count number of uses of the new frequency node
+ * @return cache_freq_t* new frequency node or `NULL` if allocation failed
+ */
+static cache_freq_t* cache_get_freq(const cache_t * const __restrict__ cache, cache_shard_t * const __restrict__ shard, size_t count) {
+    cache_freq_t *freq = shard->spare_freqs;
+
+    if (NULL != freq) {
+        shard->spare_freqs = freq->next;
+    } else {
+        freq = scl_malloc(cache->allocator, sizeof(*freq));
+
+        if (NULL == freq) {
+            return NULL;
+        }
+    }
+
+    freq->prev = freq->next = NULL;
+    freq->head = freq->tail = NULL;
+    freq->count = count;
+
+    return freq;
+}
+
+/**
+ * @brief Function to unlink an empty frequency node from the frequencies
+ * of a shard and to keep it for reuse. Function MUST not be used outside this file.
+ * 
+ * @param shard pointer to a shard of the cache
+ * @param freq empty frequency node of the shard
+ */
+static void cache_put_freq(cache_shard_t * const __restrict__ shard, cache_freq_t * const __restrict__ freq) {
+    if (NULL != freq->prev) {
+        freq->prev->next = freq->next;
+    } else {
+        shard->freqs = freq->next;
+    }
+
+    if (NULL != freq->next) {
+        freq->next->prev = freq->prev;
+    }
+
+    freq->next = shard->spare_freqs;
+    shard->spare_freqs = freq;
+}
+
+/**
+ * @brief Function to unlink an entry from the recency links it belongs to,
+ * the ones of the shard for LRU or the ones of its frequency node for LFU.
+ * An empty frequency node is not removed. Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param shard pointer to the shard of the entry
+ * @param entry pointer to a linked entry
+ */
+static void cache_unlink_entry(const cache_t * const __restrict__ cache, cache_shard_t * const __restrict__ shard, cache_entry_t * const __restrict__ entry) {
+    cache_entry_t **head = &shard->head;
+    cache_entry_t **tail = &shard->tail;
+
+    if (CACHE_POLICY_LFU == cache->policy) {
+        head = &entry->freq->head;
+        tail = &entry->freq->tail;
+    }
+
+    if (NULL != entry->prev) {
+        entry->prev->next = entry->next;
+    } else {
+        *head = entry->next;
+    }
+
+    if (NULL != entry->next) {
+        entry->next->prev = entry->prev;
+    } else {
+        *tail = entry->prev;
+    }
+
+    entry->prev = entry->next = NULL;
+}
+
+/**
+ * @brief Function to link an entry as the most recently used one of the
+ * shard (LRU) or of its frequency node (LFU). Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param shard pointer to the shard of the entry
+ * @param entry pointer to an unlinked entry
+ */
+static void cache_link_entry(const cache_t * const __restrict__ cache, cache_shard_t * const __restrict__ shard, cache_entry_t * const __restrict__ entry) {
+    cache_entry_t **head = &shard->head;
+    cache_entry_t **tail = &shard->tail;
+
+    if (CACHE_POLICY_LFU == cache->policy) {
+        head = &entry->freq->head;
+        tail = &entry->freq->tail;
+    }
+
+    entry->prev = NULL;
+    entry->next = *head;
+
+    if (NULL != *head) {
+        (*head)->prev = entry;
+    } else {
+        *tail = entry;
+    }
+
+    *head = entry;
+}
+
+/**
+ * @brief Function to mark one more use of an entry. For LRU the entry becomes
+ * the most recently used one of the shard, for LFU the entry moves to the
+ * frequency node of the next count, which is created right after the current
+ * one if it does not exist. If no frequency node can be allocated the entry
+ * keeps its count and becomes the most recent of it.
+ * Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param shard pointer to the shard of the entry
+ * @param entry pointer to a linked entry
+ */
+static void cache_touch_entry(const cache_t * const __restrict__ cache, cache_shard_t * const __restrict__ shard, cache_entry_t * const __restrict__ entry) {
+    cache_unlink_entry(cache, shard, entry);
+
+    if (CACHE_POLICY_LFU == cache->policy) {
+        cache_freq_t * const freq = entry->freq;
+        cache_freq_t *next = freq->next;
+
+        if ((NULL == next) || (next->count != freq->count + 1)) {
+            cache_freq_t * const new_freq = cache_get_freq(cache, shard, freq->count + 1);
+
+            if (NULL != new_freq) {
+                new_freq->prev = freq;
+                new_freq->next = next;
+
+                if (NULL != next) {
+                    next->prev = new_freq;
+                }
+
+                freq->next = new_freq;
+            }
+
+            next = new_freq;
+        }
+
+        if (NULL != next) {
+            entry->freq = next;
+
+            /* The old frequency node is never the new one, so it can be dropped */
+            if (NULL == freq->head) {
+                cache_put_freq(shard, freq);
+            }
+        }
+    }
+
+    cache_link_entry(cache, shard, entry);
+}
+
+/**
+ * @brief Function to remove an entry from a shard, to remove its key from the
+ * index of the shard and to free it. The evict function is called first if the
+ * entry is removed to make room for a new one.
+ * Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param shard pointer to the shard of the entry
+ * @param entry pointer to a linked entry
+ * @param evicted 1 if the entry is evicted, 0 if it is deleted
+ */
+static void cache_remove_entry(const cache_t * const __restrict__ cache, cache_shard_t * const __restrict__ shard, cache_entry_t * const __restrict__ entry, uint8_t evicted) {
+    cache_unlink_entry(cache, shard, entry);
+
+    if ((CACHE_POLICY_LFU == cache->policy) && (NULL == entry->freq->head)) {
+        cache_put_freq(shard, entry->freq);
+    }
+
+    hash_table_delete_key_with_hash(shard->index, entry->hash, entry->key);
+    --shard->size;
+
+    if ((0 != evicted) && (NULL != cache->evict)) {
+        cache->evict(entry->key, entry->data, cache->evict_arg);
+    }
+
+    if (NULL != cache->frd_key) {
+        cache->frd_key(entry->key);
+    }
+
+    if (NULL != cache->frd_dt) {
+        cache->frd_dt(entry->data);
+    }
+
+    scl_free(cache->allocator, entry);
+}
+
+/**
+ * @brief Function to get the entry to evict from a full shard, the least
+ * recently used one (LRU) or the least recently used of the least frequently
+ * used ones (LFU). Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param shard pointer to a shard with at least one entry
+ * @return cache_entry_t* pointer to the entry to evict
+ */
+static cache_entry_t* cache_victim(const cache_t * const __restrict__ cache, const cache_shard_t * const __restrict__ shard) {
+    if (CACHE_POLICY_LFU == cache->policy) {
+        return shard->freqs->tail;
+    }
+
+    return shard->tail;
+}
+
+/**
+ * @brief Function to free a chain of entries linked by their next links.
+ * Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param entry first entry of the chain
+ */
+static void cache_free_entries(const cache_t * const __restrict__ cache, cache_entry_t *entry) {
+    while (NULL != entry) {
+        cache_entry_t * const next = entry->next;
+
+        if (NULL != cache->frd_key) {
+            cache->frd_key(entry->key);
+        }
+
+        if (NULL != cache->frd_dt) {
+            cache->frd_dt(entry->data);
+        }
+
+        scl_free(cache->allocator, entry);
+        entry = next;
+    }
+}
+
+/**
+ * @brief Function to free every entry and every frequency node of a shard,
+ * the index of the shard is not changed. Function MUST not be used outside this file.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param shard pointer to a shard of the cache
+ */
+static void cache_free_shard_entries(const cache_t * const __restrict__ cache, cache_shard_t * const __restrict__ shard) {
+    cache_free_entries(cache, shard->head);
+
+    while (NULL != shard->freqs) {
+        cache_freq_t * const next = shard->freqs->next;
+
+        cache_free_entries(cache, shard->freqs->head);
+        scl_free(cache->allocator, shard->freqs);
+        shard->freqs = next;
+    }
+
+    shard->head = shard->tail = NULL;
+    shard->size = 0;
+}
+
+/**
+ * @brief Create a cache object, a bounded map of {key, data} that evicts an
+ * entry when a new key is put into a full shard. Every entry is one allocation
+ * holding its recency links, its key and its data and every shard keeps a hash
+ * table from keys to entries, so get, put and evict run in O(1). The hash table
+ * node copies the key again next to the entry pointer, so every key is stored
+ * twice. Allocation may fail if there is not enough memory on heap, compare or
+ * hash functions are not valid or the locks of the shards cannot be initialized.
+ * 
+ * @param capacity maximum number of entries of all the shards together
+ * @param number_of_shards number of independently locked shards (0 for one shard),
+ * rounded up to a power of two and lowered so every shard holds at least one entry.
+ * The capacity is split between the shards, so a key is evicted when its own shard
+ * is full even if the others are not
+ * @param policy policy used to select the evicted entries
+ * @param hash pointer to a function to hash the key into a size_t type (should not apply modulo)
+ * @param cmp_key pointer to a function to compare two sets of key
+ * @param frd_key pointer to a function to free memory allocated for the CONTENT of the key pointer
+ * @param frd_dt pointer to a function to free memory allocated for the CONTENT of the data pointer
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @return cache_t* a new allocated cache object or `NULL` (if function fails)
+ */
+cache_t* create_cache(size_t capacity, size_t number_of_shards, cache_policy_t policy, hash_func hash, compare_func cmp_key, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size) {
+    /* Check if hash function and compare function are valid */
+    if ((NULL == hash) || (NULL == cmp_key)) {
+        errno = EINVAL;
+        perror("Compare or hash functions undefined in cache");
+        return NULL;
+    }
+
+    /* Check if capacity, data and key sizes are valid */
+    if ((0 == capacity) || (0 == key_size) || (0 == data_size)) {
+        errno = EINVAL;
+        perror("Capacity, key or data size are zero");
+        return NULL;
+    }
+
+    /* Check if policy is valid */
+    if ((CACHE_POLICY_LRU != policy) && (CACHE_POLICY_LFU != policy)) {
+        errno = EINVAL;
+        perror("Cache policy is not valid");
+        return NULL;
+    }
+
+    /* Shards are selected by masking, their number must be a power of two */
+    size_t shards = 1;
+
+    while ((shards < number_of_shards) && (shards <= capacity / 2)) {
+        shards <<= 1;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new cache object on heap */
+    cache_t *new_cache = scl_malloc(allocator, sizeof(*new_cache));
+
+    /* Check if cache was allocated successfully */
+    if (NULL == new_cache) {
+        errno = ENOMEM;
+        perror("Not enough memory for cache allocation");
+        return NULL;
+    }
+
+    new_cache->allocator = allocator;
+    new_cache->hash = hash;
+    new_cache->frd_key = frd_key;
+    new_cache->frd_dt = frd_dt;
+    new_cache->evict = NULL;
+    new_cache->evict_arg = NULL;
+    new_cache->policy = policy;
+    new_cache->number_of_shards = shards;
+    new_cache->key_size = key_size;
+    new_cache->data_size = data_size;
+    new_cache->data_offset = SCL_ALIGN_SIZE(sizeof(cache_entry_t)) + SCL_ALIGN_SIZE(key_size);
+    new_cache->capacity = capacity;
+
+    /*
+     * Allocate the shards, the allocator guarantees just the malloc
+     * alignment so one more cache line is taken to align the array
+     */
+    new_cache->shards_memory = scl_malloc(allocator, sizeof(*new_cache->shards) * shards + CACHE_SHARD_ALIGN - 1);
+
+    /* Check if shards were allocated successfully */
+    if (NULL == new_cache->shards_memory) {
+        scl_free(allocator, new_cache);
+
+        errno = ENOMEM;
+        perror("Not enough memory for cache shards allocation");
+        return NULL;
+    }
+
+    /* Every shard starts on its own cache line */
+    new_cache->shards = (cache_shard_t *)(((uintptr_t)new_cache->shards_memory + CACHE_SHARD_ALIGN - 1) & ~(uintptr_t)(CACHE_SHARD_ALIGN - 1));
+
+    /* Create the index and the lock of every shard */
+    for (size_t iter = 0; iter < shards; ++iter) {
+        cache_shard_t * const shard = &new_cache->shards[iter];
+
+        shard->head = shard->tail = NULL;
+        shard->freqs = shard->spare_freqs = NULL;
+        shard->size = 0;
+
+        /* The first shards take the rest of the capacity */
+        shard->capacity = capacity / shards + ((iter < capacity % shards) ? 1 : 0);
+
+        /* The index holds pointers to the entries, the entries own the keys */
+        shard->index = create_hash_table(shard->capacity, hash, cmp_key, &cache_compare_entries, NULL, NULL, key_size, sizeof(cache_entry_t *));
+
+        if ((NULL != shard->index) && (SCL_OK != hash_table_reserve(shard->index, shard->capacity))) {
+            free_hash_table(shard->index);
+            shard->index = NULL;
+        }
+
+        if ((NULL == shard->index) || (0 != pthread_mutex_init(&shard->lock, NULL))) {
+
+            /* Wipe the shards created until now */
+            free_hash_table(shard->index);
+
+            for (size_t destroy_iter = 0; destroy_iter < iter; ++destroy_iter) {
+                pthread_mutex_destroy(&new_cache->shards[destroy_iter].lock);
+                free_hash_table(new_cache->shards[destroy_iter].index);
+            }
+
+            scl_free(allocator, new_cache->shards_memory);
+            scl_free(allocator, new_cache);
+
+            errno = ENOMEM;
+            perror("Not enough memory for cache shard allocation");
+            return NULL;
+        }
+    }
+
+    /* Return a new allocated cache */
+    return new_cache;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * cache object. The evict function is not called for the freed entries.
+ * No other thread may use the cache while it is freed.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_cache(cache_t * const __restrict__ cache) {
+    /* Check if cache needs to be freed */
+    if (NULL == cache) {
+        return SCL_NULL_CACHE;
+    }
+
+    /* Free every shard */
+    for (size_t iter = 0; iter < cache->number_of_shards; ++iter) {
+        cache_shard_t * const shard = &cache->shards[iter];
+
+        cache_free_shard_entries(cache, shard);
+
+        while (NULL != shard->spare_freqs) {
+            cache_freq_t * const next = shard->spare_freqs->next;
+
+            scl_free(cache->allocator, shard->spare_freqs);
+            shard->spare_freqs = next;
+        }
+
+        pthread_mutex_destroy(&shard->lock);
+        free_hash_table(shard->index);
+    }
+
+    /* Free the shards array and the object */
+    scl_free(cache->allocator, cache->shards_memory);
+    scl_free(cache->allocator, cache);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to set the function called for every entry evicted to make
+ * room for a new one. It is called while the shard of the entry is locked, so
+ * it MUST not use the same cache. The key and the data are freed right after.
+ * No other thread may use the cache while the function is changed.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param evict pointer to the evict function (`NULL` to remove it)
+ * @param arg argument given to every call of the evict function
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t cache_set_evict_callback(cache_t * const __restrict__ cache, cache_evict_func evict, void * const arg) {
+    /* Check if cache is allocated */
+    if (NULL == cache) {
+        return SCL_NULL_CACHE;
+    }
+
+    cache->evict = evict;
+    cache->evict_arg = arg;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to put a pair {key, data} into the cache. If the key is
+ * already cached its data is replaced (the old data is freed) and the entry
+ * is used once more. Otherwise, if the shard of the key is full, the entry
+ * selected by the policy is evicted first and the new entry is used once.
+ * The key is hashed once, outside of the lock.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the entry
+ * @param data pointer to a location of a value representing data of the entry
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t cache_put(cache_t * const __restrict__ cache, const void * const key, const void * const data) {
+    /* Check if cache is allocated */
+    if ((NULL == cache) || (NULL == cache->shards)) {
+        return SCL_NULL_CACHE;
+    }
+
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data pointer is not `NULL` */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    const size_t key_hash = cache->hash(key);
+    cache_shard_t * const shard = cache_shard(cache, key_hash);
+
+    /* Lock the shard */
+    if (0 != pthread_mutex_lock(&shard->lock)) {
+        return SCL_CACHE_LOCK_FAILED;
+    }
+
+    cache_entry_t * const * const found = hash_table_find_data_with_hash(shard->index, key_hash, key);
+
+    if (NULL != found) {
+        cache_entry_t * const entry = *found;
+
+        /* Replace the data of the cached key */
+        if (NULL != cache->frd_dt) {
+            cache->frd_dt(entry->data);
+        }
+
+        memcpy(entry->data, data, cache->data_size);
+        cache_touch_entry(cache, shard, entry);
+
+        pthread_mutex_unlock(&shard->lock);
+
+        return SCL_OK;
+    }
+
+    /* The key, the data and the links are allocated at once */
+    cache_entry_t * const entry = scl_malloc(cache->allocator, cache->data_offset + cache->data_size);
+
+    if (NULL == entry) {
+        pthread_mutex_unlock(&shard->lock);
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    /* A LFU entry starts in the frequency node of one use */
+    cache_freq_t *first_freq = NULL;
+
+    if ((CACHE_POLICY_LFU == cache->policy) && ((NULL == shard->freqs) || (1 != shard->freqs->count))) {
+        first_freq = cache_get_freq(cache, shard, 1);
+
+        if (NULL == first_freq) {
+            scl_free(cache->allocator, entry);
+            pthread_mutex_unlock(&shard->lock);
+
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+    }
+
+    entry->prev = entry->next = NULL;
+    entry->freq = NULL;
+    entry->hash = key_hash;
+    entry->key = (uint8_t *)entry + SCL_ALIGN_SIZE(sizeof(*entry));
+    entry->data = (uint8_t *)entry + cache->data_offset;
+
+    memcpy(entry->key, key, cache->key_size);
+    memcpy(entry->data, data, cache->data_size);
+
+    /* The victim is evicted after the new key is indexed, so a failed put changes nothing */
+    scl_error_t err = hash_table_insert_with_hash(shard->index, key_hash, entry->key, &entry);
+
+    if (SCL_OK != err) {
+        if (NULL != first_freq) {
+            first_freq->next = shard->spare_freqs;
+            shard->spare_freqs = first_freq;
+        }
+
+        scl_free(cache->allocator, entry);
+        pthread_mutex_unlock(&shard->lock);
+
+        return err;
+    }
+
+    if (shard->size >= shard->capacity) {
+        cache_remove_entry(cache, shard, cache_victim(cache, shard), 1);
+
+        /* The evicted entry may have emptied the frequency node of one use, it is reused at once */
+        if ((CACHE_POLICY_LFU == cache->policy) && (NULL == first_freq) && ((NULL == shard->freqs) || (1 != shard->freqs->count))) {
+            first_freq = cache_get_freq(cache, shard, 1);
+        }
+    }
+
+    if (NULL != first_freq) {
+        first_freq->next = shard->freqs;
+
+        if (NULL != shard->freqs) {
+            shard->freqs->prev = first_freq;
+        }
+
+        shard->freqs = first_freq;
+    }
+
+    entry->freq = shard->freqs;
+    cache_link_entry(cache, shard, entry);
+    ++shard->size;
+
+    pthread_mutex_unlock(&shard->lock);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the data of a key and to use the entry once more.
+ * The bytes of the data are copied into the data buffer while the shard is
+ * locked, because the entry could be evicted by another thread right after
+ * the lock is released.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the entry
+ * @param data pointer to a buffer of data_size bytes to receive the data
+ * @return scl_error_t SCL_OK if key was found, SCL_DATA_NOT_FOUND if key is
+ * missing or other enum object for handling errors
+ */
+scl_error_t cache_get(cache_t * const __restrict__ cache, const void * const key, void * const data) {
+    /* Check if cache is allocated */
+    if ((NULL == cache) || (NULL == cache->shards)) {
+        return SCL_NULL_CACHE;
+    }
+
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data buffer is not `NULL` */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    const size_t key_hash = cache->hash(key);
+    cache_shard_t * const shard = cache_shard(cache, key_hash);
+
+    /* Lock the shard, a get changes the recency links */
+    if (0 != pthread_mutex_lock(&shard->lock)) {
+        return SCL_CACHE_LOCK_FAILED;
+    }
+
+    scl_error_t err = SCL_DATA_NOT_FOUND;
+    cache_entry_t * const * const found = hash_table_find_data_with_hash(shard->index, key_hash, key);
+
+    /* Copy the data before releasing the lock */
+    if (NULL != found) {
+        memcpy(data, (*found)->data, cache->data_size);
+        cache_touch_entry(cache, shard, *found);
+        err = SCL_OK;
+    }
+
+    pthread_mutex_unlock(&shard->lock);
+
+    /* Data was found, or not */
+    return err;
+}
+
+/**
+ * @brief Function to check if a key is cached, the entry is not used
+ * so its place in the eviction order does not change.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the entry
+ * @return uint8_t 1 if key is cached, 0 if key is missing or cache is not valid
+ */
+uint8_t cache_contains_key(cache_t * const __restrict__ cache, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == cache) || (NULL == cache->shards) || (NULL == key)) {
+        return 0;
+    }
+
+    const size_t key_hash = cache->hash(key);
+    cache_shard_t * const shard = cache_shard(cache, key_hash);
+
+    /* Lock the shard */
+    if (0 != pthread_mutex_lock(&shard->lock)) {
+        return 0;
+    }
+
+    const uint8_t found = (NULL != hash_table_find_data_with_hash(shard->index, key_hash, key)) ? 1 : 0;
+
+    pthread_mutex_unlock(&shard->lock);
+
+    return found;
+}
+
+/**
+ * @brief Function to delete a key from the cache, the key and the data
+ * are freed and the evict function is not called.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the entry
+ * @return scl_error_t SCL_OK if key was deleted, SCL_DATA_NOT_FOUND_FOR_DELETE
+ * if key is missing or other enum object for handling errors
+ */
+scl_error_t cache_delete_key(cache_t * const __restrict__ cache, const void * const __restrict__ key) {
+    /* Check if cache is allocated */
+    if ((NULL == cache) || (NULL == cache->shards)) {
+        return SCL_NULL_CACHE;
+    }
+
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    const size_t key_hash = cache->hash(key);
+    cache_shard_t * const shard = cache_shard(cache, key_hash);
+
+    /* Lock the shard */
+    if (0 != pthread_mutex_lock(&shard->lock)) {
+        return SCL_CACHE_LOCK_FAILED;
+    }
+
+    scl_error_t err = SCL_DATA_NOT_FOUND_FOR_DELETE;
+    cache_entry_t * const * const found = hash_table_find_data_with_hash(shard->index, key_hash, key);
+
+    if (NULL != found) {
+        cache_remove_entry(cache, shard, *found, 0);
+        err = SCL_OK;
+    }
+
+    pthread_mutex_unlock(&shard->lock);
+
+    /* Key was deleted, or not */
+    return err;
+}
+
+/**
+ * @brief Function to delete every entry of the cache, the keys and the
+ * data are freed and the evict function is not called.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t cache_clear(cache_t * const __restrict__ cache) {
+    /* Check if cache is allocated */
+    if ((NULL == cache) || (NULL == cache->shards)) {
+        return SCL_NULL_CACHE;
+    }
+
+    for (size_t iter = 0; iter < cache->number_of_shards; ++iter) {
+        cache_shard_t * const shard = &cache->shards[iter];
+
+        if (0 != pthread_mutex_lock(&shard->lock)) {
+            return SCL_CACHE_LOCK_FAILED;
+        }
+
+        /* Every entry leaves the index one by one, the evict function is not called */
+        while (0 != shard->size) {
+            cache_remove_entry(cache, shard, cache_victim(cache, shard), 0);
+        }
+
+        pthread_mutex_unlock(&shard->lock);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the number of entries of the cache, every shard is
+ * locked in turn so the result is exact just if no thread changes it.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @return size_t SIZE_MAX if cache is not allocated or number of entries
+ */
+size_t get_cache_size(cache_t * const __restrict__ cache) {
+    /* Check if cache is allocated */
+    if ((NULL == cache) || (NULL == cache->shards)) {
+        return SIZE_MAX;
+    }
+
+    size_t total_size = 0;
+
+    /* Sum the sizes of all shards */
+    for (size_t iter = 0; iter < cache->number_of_shards; ++iter) {
+        cache_shard_t * const shard = &cache->shards[iter];
+
+        if (0 != pthread_mutex_lock(&shard->lock)) {
+            return SIZE_MAX;
+        }
+
+        total_size += shard->size;
+
+        pthread_mutex_unlock(&shard->lock);
+    }
+
+    return total_size;
+}
+
+/**
+ * @brief Get the maximum number of entries of the cache.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @return size_t SIZE_MAX if cache is not allocated or capacity of the cache
+ */
+size_t get_cache_capacity(const cache_t * const __restrict__ cache) {
+    if (NULL == cache) {
+        return SIZE_MAX;
+    }
+
+    return cache->capacity;
+}
+
+/**
+ * @brief Function to check if the cache has no entries.
+ * 
+ * @param cache pointer to an allocated cache memory location
+ * @return uint8_t 1 if cache is empty or not allocated, 0 otherwise
+ */
+uint8_t is_cache_empty(cache_t * const __restrict__ cache) {
+    const size_t size = get_cache_size(cache);
+
+    return ((SIZE_MAX == size) || (0 == size)) ? 1 : 0;
+}
@@ -0,0 +1,668 @@
+/**
+ * @file scl_concurrent_hash_table.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_concurrent_hash_table.h"
+#include "./include/scl_func_types.h"
+
+#define DEFAULT_CONCURRENT_HASH_SHARDS 64
+
+/*
+ * The lookups of a shard table update its operation counters when the
+ * library is built with SCL_STATS, so the finds lock the shard for writing
+ */
+#if defined(SCL_STATS)
+#define CONCURRENT_HASH_TABLE_FIND_LOCK(lock) pthread_rwlock_wrlock(lock)
+#else
+#define CONCURRENT_HASH_TABLE_FIND_LOCK(lock) pthread_rwlock_rdlock(lock)
+#endif
+
+/**
+ * @brief Function to compute the smallest power of two that is
+ * greater or equal than the input value.
+ *
+ * @param value value to round up
+ * @return size_t power of two greater or equal than value
+ */
+static size_t concurrent_hash_table_next_pow2(size_t value) {
+    size_t power = 1;
+
+    /* Double the power until it reaches the value */
+    while (power < value) {
+        power <<= 1;
+    }
+
+    return power;
+}
+
+/**
+ * @brief Function to select the shard of a hash value. The shard is
+ * selected by the upper half of the mixed hash, the lower bits select
+ * the bucket inside the hash table of the shard, so the keys of one
+ * shard still spread over all its buckets.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key_hash hash value of a key computed by the user hash function
+ * @return concurrent_hash_table_shard_t* pointer to the shard of the key
+ */
+static concurrent_hash_table_shard_t* concurrent_hash_table_shard(const concurrent_hash_table_t * const __restrict__ cht, size_t key_hash) {
+    return &cht->shards[(hash_mix(key_hash) >> 32) & (cht->number_of_shards - 1)];
+}
+
+/**
+ * @brief Create a concurrent hash table object. Allocation may fail if there is
+ * not enough memory on heap, compare or hash functions are not valid or the
+ * locks of the shards cannot be initialized.
+ *
+ * @param number_of_shards number of independently locked shards (0 for default),
+ * rounded up to a power of two, should be greater than the number of threads
+ * @param init_capacity initial capacity for all the shards together
+ * @param hash pointer to a function to hash the key into a size_t type (should not apply modulo)
+ * @param cmp_key pointer to a function to compare two sets of key
+ * @param cmp_dt pointer to a function to compare two sets of data
+ * @param frd_key pointer to a function to free memory allocated for the CONTENT of the key pointer
+ * @param frd_dt pointer to a function to free memory allocated for the CONTENT of the data pointer
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @return concurrent_hash_table_t* a new allocated concurrent hash table object or `NULL` (if function fails)
+ */
+concurrent_hash_table_t* create_concurrent_hash_table(size_t number_of_shards, size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size) {
+    /* Check if hash function and compare function are valid */
+    if ((NULL == hash) || (NULL == cmp_key) || (NULL == cmp_dt)) {
+        errno = EINVAL;
+        perror("Compare or hash functions undefined in concurrent_hash_table");
+        return NULL;
+    }
+
+    /* Check if data and key sizes are valid */
+    if ((0 == key_size) || (0 == data_size)) {
+        errno = EINVAL;
+        perror("Key or data size are zero");
+        return NULL;
+    }
+
+    /* Check if number of shards is valid if not set it as default value */
+    if (0 == number_of_shards) {
+        number_of_shards = DEFAULT_CONCURRENT_HASH_SHARDS;
+    }
+
+    /* Shards are selected by masking, their number must be a power of two */
+    number_of_shards = concurrent_hash_table_next_pow2(number_of_shards);
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new concurrent hash table object on heap */
+    concurrent_hash_table_t *new_cht = scl_malloc(allocator, sizeof(*new_cht));
+
+    /* Check if concurrent hash table was allocated successfully */
+    if (NULL == new_cht) {
+        errno = ENOMEM;
+        perror("Not enough memory for concurrent hash table allocation");
+        return NULL;
+    }
+
+    new_cht->allocator = allocator;
+    new_cht->hash = hash;
+    new_cht->number_of_shards = number_of_shards;
+    new_cht->data_size = data_size;
+
+    /*
+     * Allocate the shards, the allocator guarantees just the malloc
+     * alignment so one more cache line is taken to align the array
+     */
+    new_cht->shards_memory = scl_malloc(allocator, sizeof(*new_cht->shards) * number_of_shards + CONCURRENT_HASH_SHARD_ALIGN - 1);
+
+    /* Check if shards were allocated successfully */
+    if (NULL == new_cht->shards_memory) {
+        scl_free(allocator, new_cht);
+
+        errno = ENOMEM;
+        perror("Not enough memory for concurrent hash table shards allocation");
+        return NULL;
+    }
+
+    /* Every shard starts on its own cache line */
+    new_cht->shards = (concurrent_hash_table_shard_t *)(((uintptr_t)new_cht->shards_memory + CONCURRENT_HASH_SHARD_ALIGN - 1) & ~(uintptr_t)(CONCURRENT_HASH_SHARD_ALIGN - 1));
+
+    /* Create the hash table and the lock of every shard */
+    for (size_t iter = 0; iter < number_of_shards; ++iter) {
+        concurrent_hash_table_shard_t * const shard = &new_cht->shards[iter];
+
+        shard->table = create_hash_table(init_capacity / number_of_shards + 1, hash, cmp_key, cmp_dt, frd_key, frd_dt, key_size, data_size);
+
+        if ((NULL == shard->table) || (0 != pthread_rwlock_init(&shard->lock, NULL))) {
+
+            /* Wipe the shards created until now */
+            free_hash_table(shard->table);
+
+            for (size_t destroy_iter = 0; destroy_iter < iter; ++destroy_iter) {
+                pthread_rwlock_destroy(&new_cht->shards[destroy_iter].lock);
+                free_hash_table(new_cht->shards[destroy_iter].table);
+            }
+
+            scl_free(allocator, new_cht->shards_memory);
+            scl_free(allocator, new_cht);
+
+            errno = ENOMEM;
+            perror("Not enough memory for concurrent hash table shard allocation");
+            return NULL;
+        }
+    }
+
+    /* Return a new allocated concurrent hash table */
+    return new_cht;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * concurrent hash table object. No other thread may use the concurrent
+ * hash table while it is freed.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_concurrent_hash_table(concurrent_hash_table_t * const __restrict__ cht) {
+    /* Check if concurrent hash table needs to be freed */
+    if (NULL == cht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Free every shard */
+    for (size_t iter = 0; iter < cht->number_of_shards; ++iter) {
+        pthread_rwlock_destroy(&cht->shards[iter].lock);
+        free_hash_table(cht->shards[iter].table);
+    }
+
+    /* Free the shards array and the object */
+    scl_free(cht->allocator, cht->shards_memory);
+    scl_free(cht->allocator, cht);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to insert a pair {key, data} into the concurrent hash table.
+ * The key is hashed once, outside of any lock, then the shard of the key is
+ * locked for writing. See hash_table_insert function.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_insert(concurrent_hash_table_t * const __restrict__ cht, const void *key, const void *data) {
+    /* Check if concurrent hash table is allocated */
+    if ((NULL == cht) || (NULL == cht->shards)) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data pointer is not `NULL` */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    size_t key_hash = cht->hash(key);
+    concurrent_hash_table_shard_t * const shard = concurrent_hash_table_shard(cht, key_hash);
+
+    /* Lock the shard for writing */
+    if (0 != pthread_rwlock_wrlock(&shard->lock)) {
+        return SCL_HASH_TABLE_LOCK_FAILED;
+    }
+
+    scl_error_t err = hash_table_insert_with_hash(shard->table, key_hash, key, data);
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    /* Insertion went successfully, or not */
+    return err;
+}
+
+/**
+ * @brief Function to find the data of a key. The bytes of the data are copied
+ * into the data buffer while the shard is locked for reading, because a
+ * pointer inside the shard could be freed by another thread right after the
+ * lock is released.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of a node
+ * @param data pointer to a buffer of data_size bytes to receive the data
+ * @return scl_error_t SCL_OK if key was found, SCL_DATA_NOT_FOUND if key is
+ * missing or other enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_find_data(concurrent_hash_table_t * const __restrict__ cht, const void * const key, void * const data) {
+    /* Check if concurrent hash table is allocated */
+    if ((NULL == cht) || (NULL == cht->shards)) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data buffer is not `NULL` */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    size_t key_hash = cht->hash(key);
+    concurrent_hash_table_shard_t * const shard = concurrent_hash_table_shard(cht, key_hash);
+
+    /* Lock the shard for reading (for writing with SCL_STATS) */
+    if (0 != CONCURRENT_HASH_TABLE_FIND_LOCK(&shard->lock)) {
+        return SCL_HASH_TABLE_LOCK_FAILED;
+    }
+
+    scl_error_t err = SCL_DATA_NOT_FOUND;
+    const void * const search_data = hash_table_find_data_with_hash(shard->table, key_hash, key);
+
+    /* Copy the data before releasing the lock */
+    if (NULL != search_data) {
+        memcpy(data, search_data, cht->data_size);
+        err = SCL_OK;
+    }
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    /* Data was found, or not */
+    return err;
+}
+
+/**
+ * @brief Function to change the data of a key in place. The action function
+ * is called on the data of the key while the shard is locked for writing,
+ * so read-modify-write updates (as counters) are atomic.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of a node
+ * @param action a pointer function to change the data of the key
+ * @return scl_error_t SCL_OK if key was found, SCL_DATA_NOT_FOUND if key is
+ * missing or other enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_update_data(concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key, action_func action) {
+    /* Check if concurrent hash table is allocated */
+    if ((NULL == cht) || (NULL == cht->shards)) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    size_t key_hash = cht->hash(key);
+    concurrent_hash_table_shard_t * const shard = concurrent_hash_table_shard(cht, key_hash);
+
+    /* Lock the shard for writing */
+    if (0 != pthread_rwlock_wrlock(&shard->lock)) {
+        return SCL_HASH_TABLE_LOCK_FAILED;
+    }
+
+    scl_error_t err = SCL_DATA_NOT_FOUND;
+    void * const search_data = (void *)hash_table_find_data_with_hash(shard->table, key_hash, key);
+
+    /* Change the data while no other thread can see it */
+    if (NULL != search_data) {
+        action(search_data);
+        err = SCL_OK;
+    }
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    /* Data was found, or not */
+    return err;
+}
+
+/**
+ * @brief Function to check if concurrent hash table contains a key.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of a node
+ * @return uint8_t 0 if key is not found in concurrent hash table or 1 otherwise
+ */
+uint8_t concurrent_hash_table_contains_key(concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == cht) || (NULL == cht->shards) || (NULL == key)) {
+        return 0;
+    }
+
+    size_t key_hash = cht->hash(key);
+    concurrent_hash_table_shard_t * const shard = concurrent_hash_table_shard(cht, key_hash);
+
+    /* Lock the shard for reading (for writing with SCL_STATS) */
+    if (0 != CONCURRENT_HASH_TABLE_FIND_LOCK(&shard->lock)) {
+        return 0;
+    }
+
+    uint8_t found = (NULL != hash_table_find_data_with_hash(shard->table, key_hash, key));
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    /* Key is in the current concurrent hash table, or not */
+    return found;
+}
+
+/**
+ * @brief Function to check if concurrent hash table contains the {key, data} pair.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return uint8_t 0 if pair {key, data} is not found in concurrent hash table or 1 otherwise
+ */
+uint8_t concurrent_hash_table_contains_key_data(concurrent_hash_table_t * const __restrict__ cht, const void * const key, const void * const data) {
+    /* Check if input data is valid */
+    if ((NULL == cht) || (NULL == cht->shards) || (NULL == key) || (NULL == data)) {
+        return 0;
+    }
+
+    size_t key_hash = cht->hash(key);
+    concurrent_hash_table_shard_t * const shard = concurrent_hash_table_shard(cht, key_hash);
+
+    /* Lock the shard for reading (for writing with SCL_STATS) */
+    if (0 != CONCURRENT_HASH_TABLE_FIND_LOCK(&shard->lock)) {
+        return 0;
+    }
+
+    const void * const search_data = hash_table_find_data_with_hash(shard->table, key_hash, key);
+    uint8_t found = ((NULL != search_data) && (0 == shard->table->cmp_dt(search_data, data)));
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    /* Pair is in the current concurrent hash table, or not */
+    return found;
+}
+
+/**
+ * @brief Function to check if concurrent hash table is empty or not.
+ * See get_concurrent_hash_table_size function.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @return uint8_t 0 if concurrent hash table is not empty or 1 otherwise
+ */
+uint8_t is_concurrent_hash_table_empty(concurrent_hash_table_t * const __restrict__ cht) {
+    /* Concurrent hash table is empty */
+    if ((NULL == cht) || (NULL == cht->shards) || (0 == get_concurrent_hash_table_size(cht))) {
+        return 1;
+    }
+
+    /* Concurrent hash table is not empty */
+    return 0;
+}
+
+/**
+ * @brief Function to get the memory footprint of a concurrent hash table,
+ * the sum of the footprints of the hash tables of all the shards. The
+ * shards are locked one after another, so while other threads are writing
+ * the result is just an estimation, as for the size of the table.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_memory_usage(concurrent_hash_table_t * const __restrict__ cht, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if ((NULL == cht) || (NULL == cht->shards)) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* The object and the block of the shards array, alignment included */
+    usage->object_bytes = sizeof(*cht) + sizeof(*cht->shards) * cht->number_of_shards + CONCURRENT_HASH_SHARD_ALIGN - 1;
+    usage->node_bytes = usage->payload_bytes = usage->array_bytes = usage->slack_bytes = usage->nodes = 0;
+
+    /* Sum the footprints of all shards */
+    for (size_t iter = 0; iter < cht->number_of_shards; ++iter) {
+        concurrent_hash_table_shard_t * const shard = &cht->shards[iter];
+        scl_memory_usage_t shard_usage;
+
+        if (0 != pthread_rwlock_rdlock(&shard->lock)) {
+            return SCL_HASH_TABLE_LOCK_FAILED;
+        }
+
+        scl_error_t err = hash_table_memory_usage(shard->table, &shard_usage);
+
+        pthread_rwlock_unlock(&shard->lock);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        scl_memory_usage_add(usage, &shard_usage);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the current concurrent hash table size. The shards are locked
+ * one after another, so while other threads are writing the result is just
+ * an estimation and not a snapshot of the whole table.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @return size_t SIZE_MAX if concurrent hash table is not allocated or
+ * concurrent hash table's size.
+ */
+size_t get_concurrent_hash_table_size(concurrent_hash_table_t * const __restrict__ cht) {
+    if ((NULL == cht) || (NULL == cht->shards)) {
+        return SIZE_MAX;
+    }
+
+    size_t total_size = 0;
+
+    /* Sum the sizes of all shards */
+    for (size_t iter = 0; iter < cht->number_of_shards; ++iter) {
+        concurrent_hash_table_shard_t * const shard = &cht->shards[iter];
+
+        if (0 != pthread_rwlock_rdlock(&shard->lock)) {
+            return SIZE_MAX;
+        }
+
+        total_size += get_hash_table_size(shard->table);
+
+        pthread_rwlock_unlock(&shard->lock);
+    }
+
+    return total_size;
+}
+
+/**
+ * @brief Get the number of shards of the concurrent hash table.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @return size_t SIZE_MAX if concurrent hash table is not allocated or
+ * number of shards.
+ */
+size_t get_concurrent_hash_table_shards(const concurrent_hash_table_t * const __restrict__ cht) {
+    if (NULL == cht) {
+        return SIZE_MAX;
+    }
+
+    return cht->number_of_shards;
+}
+
+/**
+ * @brief Function to delete the pair {key, data} from the concurrent hash table.
+ * See hash_table_delete_key_data function.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_delete_key_data(concurrent_hash_table_t * const __restrict__ cht, const void * const key, const void * const data) {
+    /* Check if concurrent hash table is allocated */
+    if ((NULL == cht) || (NULL == cht->shards)) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data type pointer is valid */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    size_t key_hash = cht->hash(key);
+    concurrent_hash_table_shard_t * const shard = concurrent_hash_table_shard(cht, key_hash);
+
+    /* Lock the shard for writing */
+    if (0 != pthread_rwlock_wrlock(&shard->lock)) {
+        return SCL_HASH_TABLE_LOCK_FAILED;
+    }
+
+    scl_error_t err = hash_table_delete_key_data_with_hash(shard->table, key_hash, key, data);
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    /* Deletion went successfully, or not */
+    return err;
+}
+
+/**
+ * @brief Function to delete the key from the concurrent hash table.
+ * See hash_table_delete_key function.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_delete_key(concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key) {
+    /* Check if concurrent hash table is allocated */
+    if ((NULL == cht) || (NULL == cht->shards)) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    size_t key_hash = cht->hash(key);
+    concurrent_hash_table_shard_t * const shard = concurrent_hash_table_shard(cht, key_hash);
+
+    /* Lock the shard for writing */
+    if (0 != pthread_rwlock_wrlock(&shard->lock)) {
+        return SCL_HASH_TABLE_LOCK_FAILED;
+    }
+
+    scl_error_t err = hash_table_delete_key_with_hash(shard->table, key_hash, key);
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    /* Deletion went successfully, or not */
+    return err;
+}
+
+/**
+ * @brief Helper function to call an action function on the data of
+ * every node from one bucket of a shard (Left-Root-Right principle).
+ *
+ * @param table pointer to the hash table of a shard
+ * @param bucket pointer to current hash table node to start the traversal
+ * @param action a pointer function to perform an action on one data
+ */
+static void concurrent_hash_table_traverse_helper(const hash_table_t * const __restrict__ table, const hash_table_node_t * const __restrict__ bucket, action_func action) {
+    /* Check if current working hash table node is not nil */
+    if (table->nil == bucket) {
+        return;
+    }
+
+    concurrent_hash_table_traverse_helper(table, bucket->left, action);
+    action(bucket->data);
+    concurrent_hash_table_traverse_helper(table, bucket->right, action);
+}
+
+/**
+ * @brief Function to traverse all the shards of the concurrent hash table
+ * and to call an action function on every data. Every shard is locked for
+ * reading while it is traversed, so the action function MUST NOT change the
+ * data and MUST NOT call other functions of the same concurrent hash table.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param action a pointer function to perform an action on one data
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_traverse(concurrent_hash_table_t * const __restrict__ cht, action_func action) {
+    /* Check if concurrent hash table is allocated */
+    if ((NULL == cht) || (NULL == cht->shards)) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    /* Empty concurrent hash table */
+    if (1 == is_concurrent_hash_table_empty(cht)) {
+        printf("[ ]\n");
+        return SCL_OK;
+    }
+
+    /* Traverse every shard under its read lock */
+    for (size_t iter = 0; iter < cht->number_of_shards; ++iter) {
+        concurrent_hash_table_shard_t * const shard = &cht->shards[iter];
+
+        if (0 != pthread_rwlock_rdlock(&shard->lock)) {
+            return SCL_HASH_TABLE_LOCK_FAILED;
+        }
+
+        const hash_table_t * const table = shard->table;
+
+        for (size_t bucket_iter = 0; bucket_iter < table->capacity; ++bucket_iter) {
+            concurrent_hash_table_traverse_helper(table, table->buckets[bucket_iter], action);
+        }
+
+        /* Visit the old buckets that were not moved yet */
+        if (NULL != table->old_buckets) {
+            for (size_t bucket_iter = 0; bucket_iter < table->old_capacity; ++bucket_iter) {
+                concurrent_hash_table_traverse_helper(table, table->old_buckets[bucket_iter], action);
+            }
+        }
+
+        pthread_rwlock_unlock(&shard->lock);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
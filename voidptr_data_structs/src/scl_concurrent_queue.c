@@ -0,0 +1,748 @@
+/**
+ * @file scl_concurrent_queue.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_concurrent_queue.h"
+#include <sched.h>
+
+/* Number of spins of a thread waiting for a cell before it yields its processor */
+#define CONCURRENT_QUEUE_SPINS 64
+
+/**
+ * @brief Function to compute the capacity of a bounded queue, the
+ * smallest power of two that is greater or equal than the requested
+ * capacity (at least CONCURRENT_QUEUE_MIN_CAPACITY).
+ *
+ * @param capacity requested number of elements
+ * @return size_t power of two capacity or 0 if it overflows
+ */
+static size_t concurrent_queue_capacity(size_t capacity) {
+    size_t power = CONCURRENT_QUEUE_MIN_CAPACITY;
+
+    /* Double the power until it reaches the capacity */
+    while (power < capacity) {
+        if (power > SIZE_MAX / 2) {
+            return 0;
+        }
+
+        power <<= 1;
+    }
+
+    return power;
+}
+
+/**
+ * @brief Function to allocate a block starting on a cache line. The
+ * allocator guarantees just the malloc alignment so one more cache line
+ * is taken, the unaligned block is returned in memory to be freed.
+ *
+ * @param allocator allocator of the object
+ * @param size length in bytes of the aligned block
+ * @param memory pointer to store the unaligned allocated block
+ * @return void* aligned block or `NULL` if allocation failed
+ */
+static void* concurrent_queue_aligned_alloc(const scl_allocator_t * const __restrict__ allocator, size_t size, void ** const __restrict__ memory) {
+    *memory = scl_malloc(allocator, size + CONCURRENT_QUEUE_ALIGN - 1);
+
+    if (NULL == *memory) {
+        return NULL;
+    }
+
+    return (void *)(((uintptr_t)*memory + CONCURRENT_QUEUE_ALIGN - 1) & ~(uintptr_t)(CONCURRENT_QUEUE_ALIGN - 1));
+}
+
+/**
+ * @brief Function to wait for a thread that claimed a cell and did not
+ * finish copying it yet. The thread spins for a while and then gives its
+ * processor away, so a preempted thread gets the time to finish.
+ *
+ * @param spins number of times the caller waited until now
+ */
+static void concurrent_queue_backoff(size_t * const __restrict__ spins) {
+    if (++(*spins) >= CONCURRENT_QUEUE_SPINS) {
+        *spins = 0;
+        sched_yield();
+    }
+}
+
+/**
+ * @brief Create a single producer single consumer queue object. Allocation
+ * may fail if there is not enough memory on heap or the data size is zero.
+ *
+ * @param capacity maximum number of elements in the queue, rounded up to a
+ * power of two (at least CONCURRENT_QUEUE_MIN_CAPACITY)
+ * @param data_size length in bytes of the data data type
+ * @return spsc_queue_t* a new allocated queue object or `NULL` (if function fails)
+ */
+spsc_queue_t* create_spsc_queue(size_t capacity, size_t data_size) {
+    /* Check if data size is valid */
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    capacity = concurrent_queue_capacity(capacity);
+
+    if ((0 == capacity) || (capacity > SIZE_MAX / data_size)) {
+        errno = ENOMEM;
+        perror("Capacity of the spsc queue is too big");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    void *memory = NULL;
+
+    /* The indexes of the producer and of the consumer start on their own cache lines */
+    spsc_queue_t *new_queue = concurrent_queue_aligned_alloc(allocator, sizeof(*new_queue), &memory);
+
+    /* Check if queue was allocated successfully */
+    if (NULL == new_queue) {
+        errno = ENOMEM;
+        perror("Not enough memory for spsc queue allocation");
+        return NULL;
+    }
+
+    new_queue->buffer = scl_malloc(allocator, capacity * data_size);
+
+    /* Check if the buffer was allocated successfully */
+    if (NULL == new_queue->buffer) {
+        scl_free(allocator, memory);
+
+        errno = ENOMEM;
+        perror("Not enough memory for spsc queue buffer allocation");
+        return NULL;
+    }
+
+    /* Set default values of the queue */
+    atomic_init(&new_queue->head, 0);
+    atomic_init(&new_queue->tail, 0);
+    new_queue->cached_tail = 0;
+    new_queue->cached_head = 0;
+    new_queue->capacity = capacity;
+    new_queue->data_size = data_size;
+    new_queue->memory = memory;
+    new_queue->allocator = allocator;
+
+    /* Return a new allocated queue object */
+    return new_queue;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * spsc queue object. No other thread may use the queue while it is freed.
+ *
+ * @param queue an allocated spsc queue object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_spsc_queue(spsc_queue_t * const __restrict__ queue) {
+    /* Check if queue needs to be freed */
+    if (NULL == queue) {
+        return SCL_NULL_QUEUE;
+    }
+
+    const scl_allocator_t *allocator = queue->allocator;
+
+    scl_free(allocator, queue->buffer);
+    scl_free(allocator, queue->memory);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to push a run of elements into the spsc queue. Just the
+ * producer thread may call this function. The elements are published to
+ * the consumer by one release store, together.
+ *
+ * @param queue an allocated spsc queue object
+ * @param data pointer to an array of number_of_elem elements
+ * @param number_of_elem number of elements to push
+ * @return size_t number of pushed elements, less than number_of_elem if the
+ * queue has not enough free cells (0 for invalid input or a full queue)
+ */
+size_t spsc_queue_push_n(spsc_queue_t * const __restrict__ queue, const void * const __restrict__ data, size_t number_of_elem) {
+    /* Check if input data is valid */
+    if ((NULL == queue) || (NULL == data) || (0 == number_of_elem)) {
+        return 0;
+    }
+
+    const size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    /* Read the index of the consumer just if the cached one says there is no room */
+    if (queue->capacity - (tail - queue->cached_head) < number_of_elem) {
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    }
+
+    const size_t free_cells = queue->capacity - (tail - queue->cached_head);
+
+    if (number_of_elem > free_cells) {
+        number_of_elem = free_cells;
+    }
+
+    if (0 == number_of_elem) {
+        return 0;
+    }
+
+    /* Copy the run in at most two parts, before and after the end of the buffer */
+    const size_t index = tail & (queue->capacity - 1);
+    const size_t first_part = (number_of_elem < queue->capacity - index) ? number_of_elem : queue->capacity - index;
+
+    memcpy(queue->buffer + index * queue->data_size, data, first_part * queue->data_size);
+    memcpy(queue->buffer, (const uint8_t *)data + first_part * queue->data_size, (number_of_elem - first_part) * queue->data_size);
+
+    /* Publish the elements to the consumer */
+    atomic_store_explicit(&queue->tail, tail + number_of_elem, memory_order_release);
+
+    return number_of_elem;
+}
+
+/**
+ * @brief Function to pop a run of elements from the spsc queue. Just the
+ * consumer thread may call this function. The cells are given back to the
+ * producer by one release store, together.
+ *
+ * @param queue an allocated spsc queue object
+ * @param data pointer to an array of at least number_of_elem elements to
+ * copy the popped elements in or `NULL` to just drop them
+ * @param number_of_elem maximum number of elements to pop
+ * @return size_t number of popped elements (0 for invalid input or an empty queue)
+ */
+size_t spsc_queue_pop_n(spsc_queue_t * const __restrict__ queue, void * const __restrict__ data, size_t number_of_elem) {
+    /* Check if input data is valid */
+    if ((NULL == queue) || (0 == number_of_elem)) {
+        return 0;
+    }
+
+    const size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    /* Read the index of the producer just if the cached one says there are not enough elements */
+    if (queue->cached_tail - head < number_of_elem) {
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    }
+
+    const size_t used_cells = queue->cached_tail - head;
+
+    if (number_of_elem > used_cells) {
+        number_of_elem = used_cells;
+    }
+
+    if (0 == number_of_elem) {
+        return 0;
+    }
+
+    if (NULL != data) {
+        /* Copy the run in at most two parts, before and after the end of the buffer */
+        const size_t index = head & (queue->capacity - 1);
+        const size_t first_part = (number_of_elem < queue->capacity - index) ? number_of_elem : queue->capacity - index;
+
+        memcpy(data, queue->buffer + index * queue->data_size, first_part * queue->data_size);
+        memcpy((uint8_t *)data + first_part * queue->data_size, queue->buffer, (number_of_elem - first_part) * queue->data_size);
+    }
+
+    /* Give the cells back to the producer */
+    atomic_store_explicit(&queue->head, head + number_of_elem, memory_order_release);
+
+    return number_of_elem;
+}
+
+/**
+ * @brief Function to push one element into the spsc queue. Just the
+ * producer thread may call this function.
+ *
+ * @param queue an allocated spsc queue object
+ * @param data pointer to the element to push
+ * @return scl_error_t enum object for handling errors, SCL_QUEUE_FULL if
+ * there is no free cell
+ */
+scl_error_t spsc_queue_push(spsc_queue_t * const __restrict__ queue, const void * const __restrict__ data) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SCL_NULL_QUEUE;
+    }
+
+    /* Check if data is valid */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (0 == spsc_queue_push_n(queue, data, 1)) {
+        return SCL_QUEUE_FULL;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to pop one element from the spsc queue. Just the
+ * consumer thread may call this function.
+ *
+ * @param queue an allocated spsc queue object
+ * @param data pointer to copy the popped element in or `NULL` to drop it
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t spsc_queue_pop(spsc_queue_t * const __restrict__ queue, void * const __restrict__ data) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SCL_NULL_QUEUE;
+    }
+
+    if (0 == spsc_queue_pop_n(queue, data, 1)) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the number of elements of the spsc queue. If other threads
+ * use the queue the value may be old when it is returned.
+ *
+ * @param queue an allocated spsc queue object
+ * @return size_t number of elements or SIZE_MAX if queue is not allocated
+ */
+size_t get_spsc_queue_size(const spsc_queue_t * const __restrict__ queue) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SIZE_MAX;
+    }
+
+    const size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    const size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    return tail - head;
+}
+
+/**
+ * @brief Get the maximum number of elements of the spsc queue.
+ *
+ * @param queue an allocated spsc queue object
+ * @return size_t capacity of the queue or SIZE_MAX if queue is not allocated
+ */
+size_t get_spsc_queue_capacity(const spsc_queue_t * const __restrict__ queue) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SIZE_MAX;
+    }
+
+    return queue->capacity;
+}
+
+/**
+ * @brief Function to get the sequence number of the cell of a position.
+ *
+ * @param queue an allocated mpmc queue object
+ * @param pos position in the queue (not reduced to the buffer)
+ * @return atomic_size_t* pointer to the sequence number of the cell
+ */
+static inline atomic_size_t* mpmc_queue_sequence(const mpmc_queue_t * const __restrict__ queue, size_t pos) {
+    return (atomic_size_t *)(queue->cells + (pos & (queue->capacity - 1)) * queue->cell_size);
+}
+
+/**
+ * @brief Function to get the data of the cell of a position, stored
+ * inline after the sequence number.
+ *
+ * @param queue an allocated mpmc queue object
+ * @param pos position in the queue (not reduced to the buffer)
+ * @return uint8_t* pointer to the data of the cell
+ */
+static inline uint8_t* mpmc_queue_data(const mpmc_queue_t * const __restrict__ queue, size_t pos) {
+    return queue->cells + (pos & (queue->capacity - 1)) * queue->cell_size + SCL_ALIGN_SIZE(sizeof(atomic_size_t));
+}
+
+/**
+ * @brief Create a multi producer multi consumer queue object. Allocation
+ * may fail if there is not enough memory on heap or the data size is zero.
+ *
+ * @param capacity maximum number of elements in the queue, rounded up to a
+ * power of two (at least CONCURRENT_QUEUE_MIN_CAPACITY)
+ * @param data_size length in bytes of the data data type
+ * @return mpmc_queue_t* a new allocated queue object or `NULL` (if function fails)
+ */
+mpmc_queue_t* create_mpmc_queue(size_t capacity, size_t data_size) {
+    /* Check if data size is valid */
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    capacity = concurrent_queue_capacity(capacity);
+
+    /* Every cell keeps its sequence number and the data, both aligned */
+    const size_t cell_size = SCL_ALIGN_SIZE(sizeof(atomic_size_t)) + SCL_ALIGN_SIZE(data_size);
+
+    if ((0 == capacity) || (data_size > SIZE_MAX - 2 * SCL_ALIGN) || (capacity > SIZE_MAX / cell_size)) {
+        errno = ENOMEM;
+        perror("Capacity of the mpmc queue is too big");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    void *memory = NULL;
+
+    /* The indexes of the producers and of the consumers start on their own cache lines */
+    mpmc_queue_t *new_queue = concurrent_queue_aligned_alloc(allocator, sizeof(*new_queue), &memory);
+
+    /* Check if queue was allocated successfully */
+    if (NULL == new_queue) {
+        errno = ENOMEM;
+        perror("Not enough memory for mpmc queue allocation");
+        return NULL;
+    }
+
+    new_queue->cells = scl_malloc(allocator, capacity * cell_size);
+
+    /* Check if the cells were allocated successfully */
+    if (NULL == new_queue->cells) {
+        scl_free(allocator, memory);
+
+        errno = ENOMEM;
+        perror("Not enough memory for mpmc queue cells allocation");
+        return NULL;
+    }
+
+    /* Set default values of the queue */
+    atomic_init(&new_queue->enqueue_pos, 0);
+    atomic_init(&new_queue->dequeue_pos, 0);
+    new_queue->cell_size = cell_size;
+    new_queue->capacity = capacity;
+    new_queue->data_size = data_size;
+    new_queue->memory = memory;
+    new_queue->allocator = allocator;
+
+    /* Cell i is written first by the producer of position i */
+    for (size_t iter = 0; iter < capacity; ++iter) {
+        atomic_init(mpmc_queue_sequence(new_queue, iter), iter);
+    }
+
+    /* Return a new allocated queue object */
+    return new_queue;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * mpmc queue object. No other thread may use the queue while it is freed.
+ *
+ * @param queue an allocated mpmc queue object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_mpmc_queue(mpmc_queue_t * const __restrict__ queue) {
+    /* Check if queue needs to be freed */
+    if (NULL == queue) {
+        return SCL_NULL_QUEUE;
+    }
+
+    const scl_allocator_t *allocator = queue->allocator;
+
+    scl_free(allocator, queue->cells);
+    scl_free(allocator, queue->memory);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to push one element into the mpmc queue. Any thread
+ * may call this function, a producer claims its cell by one compare and
+ * swap and publishes the data by the sequence number of the cell.
+ *
+ * @param queue an allocated mpmc queue object
+ * @param data pointer to the element to push
+ * @return scl_error_t enum object for handling errors, SCL_QUEUE_FULL if
+ * there is no free cell
+ */
+scl_error_t mpmc_queue_push(mpmc_queue_t * const __restrict__ queue, const void * const __restrict__ data) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SCL_NULL_QUEUE;
+    }
+
+    /* Check if data is valid */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+
+    for (;;) {
+        const size_t seq = atomic_load_explicit(mpmc_queue_sequence(queue, pos), memory_order_acquire);
+        const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (0 == diff) {
+            /* The cell is free on this lap, try to claim it */
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The element of the previous lap was not popped yet */
+            return SCL_QUEUE_FULL;
+        } else {
+            /* Another producer claimed the cell */
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    memcpy(mpmc_queue_data(queue, pos), data, queue->data_size);
+
+    /* Give the cell to the consumer of the position */
+    atomic_store_explicit(mpmc_queue_sequence(queue, pos), pos + 1, memory_order_release);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to pop one element from the mpmc queue. Any thread
+ * may call this function, a consumer claims its cell by one compare and
+ * swap and gives it back to the producers of the next lap.
+ *
+ * @param queue an allocated mpmc queue object
+ * @param data pointer to copy the popped element in or `NULL` to drop it
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t mpmc_queue_pop(mpmc_queue_t * const __restrict__ queue, void * const __restrict__ data) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SCL_NULL_QUEUE;
+    }
+
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+
+    for (;;) {
+        const size_t seq = atomic_load_explicit(mpmc_queue_sequence(queue, pos), memory_order_acquire);
+        const intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (0 == diff) {
+            /* The cell is filled on this lap, try to claim it */
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The element of the position was not pushed yet */
+            return SCL_DELETE_FROM_EMPTY_OBJECT;
+        } else {
+            /* Another consumer claimed the cell */
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    if (NULL != data) {
+        memcpy(data, mpmc_queue_data(queue, pos), queue->data_size);
+    }
+
+    /* Give the cell to the producer of the next lap */
+    atomic_store_explicit(mpmc_queue_sequence(queue, pos), pos + queue->capacity, memory_order_release);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to push a run of elements into the mpmc queue by one
+ * compare and swap. If the last cell of the run is free on this lap, the
+ * elements of the previous lap of all the cells before it were already
+ * claimed by consumers, so the run is claimed at once and every cell is
+ * written as soon as its consumer finished copying it out.
+ *
+ * @param queue an allocated mpmc queue object
+ * @param data pointer to an array of number_of_elem elements
+ * @param number_of_elem number of elements to push
+ * @return size_t number of pushed elements, less than number_of_elem if the
+ * queue has not enough free cells (0 for invalid input or a full queue)
+ */
+size_t mpmc_queue_push_n(mpmc_queue_t * const __restrict__ queue, const void * const __restrict__ data, size_t number_of_elem) {
+    /* Check if input data is valid */
+    if ((NULL == queue) || (NULL == data) || (0 == number_of_elem)) {
+        return 0;
+    }
+
+    if (number_of_elem > queue->capacity) {
+        number_of_elem = queue->capacity;
+    }
+
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    size_t run = 0;
+
+    for (;;) {
+        const size_t seq = atomic_load_explicit(mpmc_queue_sequence(queue, pos), memory_order_acquire);
+        const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff < 0) {
+            /* The first cell is still used on the previous lap */
+            return 0;
+        }
+
+        if (diff > 0) {
+            /* Another producer claimed the cell */
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+            continue;
+        }
+
+        /* Halve the run until its last cell is free on this lap */
+        run = number_of_elem;
+
+        while ((run > 1) && (atomic_load_explicit(mpmc_queue_sequence(queue, pos + run - 1), memory_order_acquire) != pos + run - 1)) {
+            run >>= 1;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + run, memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    for (size_t iter = 0; iter < run; ++iter) {
+        atomic_size_t * const sequence = mpmc_queue_sequence(queue, pos + iter);
+        size_t spins = 0;
+
+        /* Wait for the consumer of the previous lap to copy the cell out */
+        while (atomic_load_explicit(sequence, memory_order_acquire) != pos + iter) {
+            concurrent_queue_backoff(&spins);
+        }
+
+        memcpy(mpmc_queue_data(queue, pos + iter), (const uint8_t *)data + iter * queue->data_size, queue->data_size);
+
+        atomic_store_explicit(sequence, pos + iter + 1, memory_order_release);
+    }
+
+    return run;
+}
+
+/**
+ * @brief Function to pop a run of elements from the mpmc queue by one
+ * compare and swap. If the last cell of the run is filled on this lap, all
+ * the cells before it were already claimed by producers, so the run is
+ * claimed at once and every cell is read as soon as its producer finished
+ * copying it in.
+ *
+ * @param queue an allocated mpmc queue object
+ * @param data pointer to an array of at least number_of_elem elements to
+ * copy the popped elements in or `NULL` to just drop them
+ * @param number_of_elem maximum number of elements to pop
+ * @return size_t number of popped elements (0 for invalid input or an empty queue)
+ */
+size_t mpmc_queue_pop_n(mpmc_queue_t * const __restrict__ queue, void * const __restrict__ data, size_t number_of_elem) {
+    /* Check if input data is valid */
+    if ((NULL == queue) || (0 == number_of_elem)) {
+        return 0;
+    }
+
+    if (number_of_elem > queue->capacity) {
+        number_of_elem = queue->capacity;
+    }
+
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    size_t run = 0;
+
+    for (;;) {
+        const size_t seq = atomic_load_explicit(mpmc_queue_sequence(queue, pos), memory_order_acquire);
+        const intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff < 0) {
+            /* The first cell was not pushed yet */
+            return 0;
+        }
+
+        if (diff > 0) {
+            /* Another consumer claimed the cell */
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+            continue;
+        }
+
+        /* Halve the run until its last cell is filled on this lap */
+        run = number_of_elem;
+
+        while ((run > 1) && (atomic_load_explicit(mpmc_queue_sequence(queue, pos + run - 1), memory_order_acquire) != pos + run)) {
+            run >>= 1;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + run, memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    for (size_t iter = 0; iter < run; ++iter) {
+        atomic_size_t * const sequence = mpmc_queue_sequence(queue, pos + iter);
+        size_t spins = 0;
+
+        /* Wait for the producer of the position to copy the cell in */
+        while (atomic_load_explicit(sequence, memory_order_acquire) != pos + iter + 1) {
+            concurrent_queue_backoff(&spins);
+        }
+
+        if (NULL != data) {
+            memcpy((uint8_t *)data + iter * queue->data_size, mpmc_queue_data(queue, pos + iter), queue->data_size);
+        }
+
+        atomic_store_explicit(sequence, pos + iter + queue->capacity, memory_order_release);
+    }
+
+    return run;
+}
+
+/**
+ * @brief Get the number of elements of the mpmc queue, counting the cells
+ * claimed by producers and not claimed by consumers. If other threads use
+ * the queue the value may be old when it is returned.
+ *
+ * @param queue an allocated mpmc queue object
+ * @return size_t number of elements or SIZE_MAX if queue is not allocated
+ */
+size_t get_mpmc_queue_size(const mpmc_queue_t * const __restrict__ queue) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SIZE_MAX;
+    }
+
+    const size_t dequeue_pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire);
+    const size_t enqueue_pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_acquire);
+
+    /* The consumers may pass an old reading of the producers index */
+    if ((intptr_t)(enqueue_pos - dequeue_pos) < 0) {
+        return 0;
+    }
+
+    return (enqueue_pos - dequeue_pos < queue->capacity) ? enqueue_pos - dequeue_pos : queue->capacity;
+}
+
+/**
+ * @brief Get the maximum number of elements of the mpmc queue.
+ *
+ * @param queue an allocated mpmc queue object
+ * @return size_t capacity of the queue or SIZE_MAX if queue is not allocated
+ */
+size_t get_mpmc_queue_capacity(const mpmc_queue_t * const __restrict__ queue) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SIZE_MAX;
+    }
+
+    return queue->capacity;
+}
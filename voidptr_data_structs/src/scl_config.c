@@ -23,6 +23,58 @@
  */
 
 #include "./include/scl_config.h"
+#include "./include/scl_func_types.h"
+#include <string.h>
+
+/**
+ * @brief Default allocation function, forwards to malloc.
+ * 
+ * @param context unused
+ * @param size number of bytes to allocate
+ * @return void* pointer to the allocated block or `NULL`
+ */
+static void* scl_default_alloc(void *context, size_t size) {
+    (void)context;
+
+    return malloc(size);
+}
+
+/**
+ * @brief Default reallocation function, forwards to realloc.
+ * 
+ * @param context unused
+ * @param ptr pointer to the block to resize
+ * @param size new number of bytes of the block
+ * @return void* pointer to the resized block or `NULL`
+ */
+static void* scl_default_realloc(void *context, void *ptr, size_t size) {
+    (void)context;
+
+    return realloc(ptr, size);
+}
+
+/**
+ * @brief Default release function, forwards to free.
+ * 
+ * @param context unused
+ * @param ptr pointer to the block to release
+ */
+static void scl_default_free(void *context, void *ptr) {
+    (void)context;
+
+    free(ptr);
+}
+
+/* Allocator used when no other allocator was selected */
+static const scl_allocator_t scl_default_allocator = {
+    &scl_default_alloc,
+    &scl_default_realloc,
+    &scl_default_free,
+    NULL
+};
+
+/* Allocator selected by the current thread for the new objects */
+static _Thread_local const scl_allocator_t *scl_thread_allocator = NULL;
 
 /**
  * @brief Function to show more information about
@@ -245,7 +297,349 @@ void scl_error_message(scl_error_t error_message) {
         printf("The number to add to the selected graph is zero, so no action needed\n");
         break;
 
+    case SCL_HASH_TABLE_LOCK_FAILED:
+        printf("Could not acquire the lock of a concurrent hash table shard\n");
+        break;
+
+    case SCL_NULL_MEM_POOL:
+        printf("Memory pool is not allocated\n");
+        break;
+
+    case SCL_NOT_EMPTY_OBJECT_FOR_POOL:
+        printf("Node pool can be set just on an empty object\n");
+        break;
+
+    case SCL_NULL_GRAPH_CSR:
+        printf("Graph CSR snapshot is not allocated\n");
+        break;
+
+    case SCL_ID_ALREADY_IN_PQUEUE:
+        printf("Element id is already in the indexed priority queue\n");
+        break;
+
+    case SCL_NULL_GRAPH_TRAVERSAL:
+        printf("Graph traversal object is not allocated\n");
+        break;
+
+    case SCL_NULL_THREAD_POOL:
+        printf("Thread pool is not allocated\n");
+        break;
+
+    case SCL_NULL_GRAPH_PATH_QUERY:
+        printf("Graph path query object is not allocated\n");
+        break;
+
+    case SCL_NULL_GRAPH_SCC:
+        printf("Graph strongly connected components object is not allocated\n");
+        break;
+
+    case SCL_GRAPH_FILE_IO_FAIL:
+        printf("Graph file could not be written\n");
+        break;
+
+    case SCL_NULL_GRAPH_TOPO_ORDER:
+        printf("Graph topological order object is not allocated\n");
+        break;
+
+    case SCL_EDGE_MAKES_CYCLE:
+        printf("Edge was not inserted because it closes a cycle\n");
+        break;
+
+    case SCL_QUEUE_FULL:
+        printf("Bounded queue is full, element was not inserted\n");
+        break;
+
+    case SCL_NULL_WORK_DEQUE:
+        printf("Work-stealing deque is not allocated\n");
+        break;
+
+    case SCL_NULL_ULIST:
+        printf("Unrolled linked list is not allocated\n");
+        break;
+
+    case SCL_NULL_SKIP_LIST:
+        printf("Skip list is not allocated\n");
+        break;
+
+    case SCL_NULL_VECTOR:
+        printf("Vector is not allocated\n");
+        break;
+
+    case SCL_NULL_BPLUS_TREE:
+        printf("B+ tree is not allocated\n");
+        break;
+    case SCL_INCOMPATIBLE_TREES:
+        printf("Trees have different compare functions, data sizes or allocators, or use node pools\n");
+        break;
+    case SCL_NULL_PRBK:
+        printf("Persistent red-black tree is not allocated\n");
+        break;
+    case SCL_SNAPSHOTS_IN_USE:
+        printf("Snapshots of the object are still held by readers\n");
+        break;
+    case SCL_NULL_FROZEN_TREE:
+        printf("Frozen tree is not allocated\n");
+        break;
+
+    case SCL_STATS_DISABLED:
+        printf("Library was built without SCL_STATS, no operation is counted\n");
+        break;
+
+    case SCL_NULL_TOPK:
+        printf("Top-k object is not allocated\n");
+        break;
+
+    case SCL_HASH_TABLE_FILE_IO_FAIL:
+        printf("Hash table image could not be written\n");
+        break;
+    case SCL_NULL_HASH_TABLE_IMAGE:
+        printf("Hash table image is not allocated\n");
+        break;
+
+    case SCL_NULL_CACHE:
+        printf("Cache is not allocated\n");
+        break;
+    case SCL_CACHE_LOCK_FAILED:
+        printf("Could not acquire the lock of a cache shard\n");
+        break;
+
+    case SCL_NULL_BLOOM_FILTER:
+        printf("Bloom filter is not allocated\n");
+        break;
+
+    case SCL_NULL_GRAPH_REACH_INDEX:
+        printf("Graph reachability index is not allocated\n");
+        break;
+
+    case SCL_NULL_MULTI_QUEUE:
+        printf("Multi queue is not allocated\n");
+        break;
+    case SCL_MULTI_QUEUE_LOCK_FAILED:
+        printf("Could not acquire the lock of a multi queue heap\n");
+        break;
+
+    case SCL_NULL_RADIX_HEAP:
+        printf("Radix heap is not allocated\n");
+        break;
+    case SCL_RADIX_HEAP_KEY_TOO_LOW:
+        printf("Key is lower than the last key popped from the radix heap\n");
+        break;
+
+    case SCL_NULL_ITERATOR:
+        printf("Iterator is not started\n");
+        break;
+
+    case SCL_NULL_STRING_ARENA:
+        printf("String arena is not allocated\n");
+        break;
+
+    case SCL_NULL_BITSET:
+        printf("Bitset is not allocated\n");
+        break;
+    case SCL_BITSET_SIZE_MISMATCH:
+        printf("Second bitset has more bits than the first one\n");
+        break;
+
+    case SCL_NULL_ROARING:
+        printf("Roaring set is not allocated\n");
+        break;
+
     default:
         printf("Unknown error check again\n");
     }
 }
+
+/**
+ * @brief Function to get the total number of bytes of a memory footprint.
+ * 
+ * @param usage pointer to a memory footprint filled by a *_memory_usage function
+ * @return size_t number of bytes requested from the allocator or 0 if usage is `NULL`
+ */
+size_t scl_memory_usage_total(const scl_memory_usage_t * const usage) {
+    if (NULL == usage) {
+        return 0;
+    }
+
+    return usage->object_bytes + usage->node_bytes + usage->payload_bytes + usage->array_bytes + usage->slack_bytes;
+}
+
+/**
+ * @brief Function to add a memory footprint to another one, for example
+ * to sum the footprints of all the objects of a program.
+ * 
+ * @param usage pointer to the memory footprint to increase
+ * @param other pointer to the memory footprint to add
+ */
+void scl_memory_usage_add(scl_memory_usage_t * const usage, const scl_memory_usage_t * const other) {
+    if ((NULL == usage) || (NULL == other)) {
+        return;
+    }
+
+    usage->object_bytes += other->object_bytes;
+    usage->node_bytes += other->node_bytes;
+    usage->payload_bytes += other->payload_bytes;
+    usage->array_bytes += other->array_bytes;
+    usage->slack_bytes += other->slack_bytes;
+    usage->nodes += other->nodes;
+}
+
+/**
+ * @brief Function to find the kind of keys compared by one of the compare
+ * functions of the library. Containers created with a known compare function
+ * compare their elements inline, without calling the function.
+ * 
+ * @param cmp compare function of the elements
+ * @param size length in bytes of one element
+ * @return scl_key_kind_t kind of the elements or SCL_KEY_GENERIC if
+ * cmp is not a compare function of the library with a known kind
+ */
+scl_key_kind_t scl_key_kind_of(compare_func cmp, size_t size) {
+    scl_key_kind_t kind = SCL_KEY_GENERIC;
+
+    if (compare_int == cmp) {
+        kind = (4 == sizeof(int)) ? SCL_KEY_INT32 : SCL_KEY_GENERIC;
+    } else if (compare_uint == cmp) {
+        kind = (4 == sizeof(unsigned int)) ? SCL_KEY_U32 : SCL_KEY_GENERIC;
+    } else if (compare_long_int == cmp) {
+        kind = (8 == sizeof(long int)) ? SCL_KEY_INT64 : ((4 == sizeof(long int)) ? SCL_KEY_INT32 : SCL_KEY_GENERIC);
+    } else if (compare_ulong_int == cmp) {
+        kind = (8 == sizeof(unsigned long int)) ? SCL_KEY_U64 : ((4 == sizeof(unsigned long int)) ? SCL_KEY_U32 : SCL_KEY_GENERIC);
+    } else if (compare_llong_int == cmp) {
+        kind = (8 == sizeof(long long int)) ? SCL_KEY_INT64 : SCL_KEY_GENERIC;
+    } else if (compare_ullong_int == cmp) {
+        kind = (8 == sizeof(unsigned long long int)) ? SCL_KEY_U64 : SCL_KEY_GENERIC;
+    } else if (compare_string_lexi == cmp) {
+        kind = SCL_KEY_CSTRING;
+    }
+
+    /* The elements must be wide enough for the kind */
+    return (0 != scl_key_kind_fits(kind, size)) ? kind : SCL_KEY_GENERIC;
+}
+
+/**
+ * @brief Function to check if elements of size bytes can be compared
+ * as keys of a kind. Integer kinds read the first bytes of an element,
+ * SCL_KEY_BYTES compares all the bytes of an element.
+ * 
+ * @param kind kind of the keys
+ * @param size length in bytes of one element
+ * @return uint8_t 1 if the kind can be used, 0 otherwise
+ */
+uint8_t scl_key_kind_fits(scl_key_kind_t kind, size_t size) {
+    switch (kind) {
+        case SCL_KEY_GENERIC:
+        case SCL_KEY_CSTRING:
+            return 1;
+        case SCL_KEY_INT32:
+        case SCL_KEY_U32:
+            return (size >= sizeof(uint32_t)) ? 1 : 0;
+        case SCL_KEY_INT64:
+        case SCL_KEY_U64:
+            return (size >= sizeof(uint64_t)) ? 1 : 0;
+        case SCL_KEY_BYTES:
+            return (0 != size) ? 1 : 0;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Get the allocator that the current thread uses for
+ * the new created objects.
+ * 
+ * @return const scl_allocator_t* selected allocator or the
+ * default (malloc) allocator if none was selected
+ */
+const scl_allocator_t* scl_get_allocator(void) {
+    if (NULL == scl_thread_allocator) {
+        return &scl_default_allocator;
+    }
+
+    return scl_thread_allocator;
+}
+
+/**
+ * @brief Select the allocator for the objects created from now on
+ * by the current thread. Every object keeps the allocator it was
+ * created with until it is freed, so the allocator MUST outlive it.
+ * 
+ * @param allocator pointer to an allocator object or `NULL`
+ * to go back to the default (malloc) allocator
+ */
+void scl_set_allocator(const scl_allocator_t * const allocator) {
+    scl_thread_allocator = allocator;
+}
+
+/**
+ * @brief Allocate a block of memory through an allocator.
+ * 
+ * @param allocator pointer to an allocator object or `NULL` for default
+ * @param size number of bytes to allocate
+ * @return void* pointer to the allocated block or `NULL`
+ */
+void* scl_malloc(const scl_allocator_t * const allocator, size_t size) {
+    if (NULL == allocator) {
+        return malloc(size);
+    }
+
+    return allocator->alloc(allocator->context, size);
+}
+
+/**
+ * @brief Allocate a zeroed array of memory through an allocator.
+ * 
+ * @param allocator pointer to an allocator object or `NULL` for default
+ * @param number number of elements of the array
+ * @param size number of bytes of one element
+ * @return void* pointer to the allocated block or `NULL`
+ */
+void* scl_calloc(const scl_allocator_t * const allocator, size_t number, size_t size) {
+    if (NULL == allocator) {
+        return calloc(number, size);
+    }
+
+    /* Check if the size of the array overflows */
+    if ((0 != size) && (number > SIZE_MAX / size)) {
+        return NULL;
+    }
+
+    void *block = allocator->alloc(allocator->context, number * size);
+
+    if (NULL != block) {
+        memset(block, 0, number * size);
+    }
+
+    return block;
+}
+
+/**
+ * @brief Resize a block of memory through the allocator that
+ * allocated it.
+ * 
+ * @param allocator pointer to an allocator object or `NULL` for default
+ * @param ptr pointer to the block to resize
+ * @param size new number of bytes of the block
+ * @return void* pointer to the resized block or `NULL`
+ */
+void* scl_realloc(const scl_allocator_t * const allocator, void *ptr, size_t size) {
+    if (NULL == allocator) {
+        return realloc(ptr, size);
+    }
+
+    return allocator->realloc(allocator->context, ptr, size);
+}
+
+/**
+ * @brief Release a block of memory through the allocator that
+ * allocated it.
+ * 
+ * @param allocator pointer to an allocator object or `NULL` for default
+ * @param ptr pointer to the block to release
+ */
+void scl_free(const scl_allocator_t * const allocator, void *ptr) {
+    if (NULL == allocator) {
+        free(ptr);
+    } else if (NULL != ptr) {
+        allocator->free(allocator->context, ptr);
+    }
+}
@@ -53,11 +53,15 @@ dlist_t* create_dlist(compare_func cmp, free_func frd, size_t data_size) {
         return NULL;
     }
 
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new list on heap */
-    dlist_t *new_list = malloc(sizeof(*new_list));
+    dlist_t *new_list = scl_malloc(allocator, sizeof(*new_list));
 
     /* Check if new list was allocated */
     if (NULL != new_list) {
+        new_list->allocator = allocator;
 
         /* Set pointer functions in linked list class */
         new_list->cmp = cmp;
@@ -93,30 +97,20 @@ static dlist_node_t* create_dlist_node(const dlist_t * const __restrict__ list,
     }
 
     /* Allocate a new Node on heap */
-    dlist_node_t *new_node = malloc(sizeof(*new_node));
+    dlist_node_t *new_node = scl_malloc(list->allocator, SCL_ALIGN_SIZE(sizeof(*new_node)) + list->data_size);
 
     /* Check if new node was allocated */
     if (NULL != new_node) {
         new_node->prev = new_node->next = NULL;
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(list->data_size);
-
-        /* Check if data pointer was allocated */ 
-        if (NULL != new_node->data) {
+        /* The data is stored inline, right after the node, in the same block */
+        new_node->data = (uint8_t *)new_node + SCL_ALIGN_SIZE(sizeof(*new_node));
 
-            /*
-             * Copy all bytes from data pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->data, data, list->data_size);
-        } else {
-            free(new_node);
-            new_node = NULL;
-
-            errno = ENOMEM;
-            perror("Not enough memory for node list allocation");
-        }
+        /*
+         * Copy all bytes from data pointer
+         * to memory allocated on heap
+         */
+        memcpy(new_node->data, data, list->data_size);
     } else {
         errno = ENOMEM;
         perror("Not enough memory for node list allocation");
@@ -126,6 +120,142 @@ static dlist_node_t* create_dlist_node(const dlist_t * const __restrict__ list,
     return new_node;
 }
 
+/**
+ * @brief Function to free one node of a double linked list. The nodes allocated
+ * inside a block by dlist_from_array keep their data after a pointer to the
+ * block, so they are told apart from the nodes allocated one by one in O(1)
+ * time. The block is freed with its last node.
+ * 
+ * @param list an allocated double linked list object
+ * @param node a node that was removed from the list
+ */
+static void dlist_free_node(const dlist_t * const __restrict__ list, dlist_node_t * const __restrict__ node) {
+    uint8_t * const inline_data = (uint8_t *)node + SCL_ALIGN_SIZE(sizeof(*node));
+
+    if (inline_data == (uint8_t *)node->data) {
+        scl_free(list->allocator, node);
+        return;
+    }
+
+    dlist_slab_t * const slab = *(dlist_slab_t **)inline_data;
+
+    if (0 == --(slab->nodes)) {
+        scl_free(list->allocator, slab);
+    }
+}
+
+/**
+ * @brief Create a Double Linked List object from an array of elements. All the
+ * nodes (with their inline data) are allocated in one block and linked in a
+ * single pass, instead of one allocation per element. The elements are copied
+ * byte by byte, so the list takes the ownership of the memory they point to.
+ * The nodes from the block are not freed one by one when they are deleted,
+ * the block is freed when no list holds its nodes anymore.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free the content of data
+ * @param arr pointer to the first element of the array
+ * @param number_of_elem number of elements of the array
+ * @param data_size length in bytes of one element
+ * @return dlist_t* return a new list with the elements of the array
+ * (in the same order) or `NULL` if allocation went wrong
+ */
+dlist_t* dlist_from_array(compare_func cmp, free_func frd, const void * __restrict__ arr, size_t number_of_elem, size_t data_size) {
+    /* Check if input is valid */
+    if ((NULL == arr) && (0 != number_of_elem)) {
+        errno = EINVAL;
+        perror("Array to build the list from is not allocated");
+        return NULL;
+    }
+
+    dlist_t *new_list = create_dlist(cmp, frd, data_size);
+
+    if ((NULL == new_list) || (0 == number_of_elem)) {
+        return new_list;
+    }
+
+    const size_t header_size = SCL_ALIGN_SIZE(sizeof(dlist_slab_t));
+    const size_t slab_link_size = SCL_ALIGN_SIZE(sizeof(dlist_slab_t *));
+    const size_t node_size = SCL_ALIGN_SIZE(SCL_ALIGN_SIZE(sizeof(dlist_node_t)) + slab_link_size + data_size);
+
+    /* Check if the block size overflows */
+    if ((node_size < data_size) || (number_of_elem > (SIZE_MAX - header_size) / node_size)) {
+        free_dlist(new_list);
+        errno = ENOMEM;
+        perror("Not enough memory for node list allocation");
+        return NULL;
+    }
+
+    dlist_slab_t *slab = scl_malloc(new_list->allocator, header_size + number_of_elem * node_size);
+
+    if (NULL == slab) {
+        free_dlist(new_list);
+        errno = ENOMEM;
+        perror("Not enough memory for node list allocation");
+        return NULL;
+    }
+
+    slab->nodes = number_of_elem;
+    slab->bytes = header_size + number_of_elem * node_size;
+
+    /* Link all the nodes of the block in one pass */
+    uint8_t *block = (uint8_t *)slab + header_size;
+    const uint8_t *data = arr;
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        dlist_node_t *node = (dlist_node_t *)(block + iter * node_size);
+
+        uint8_t * const slab_link = (uint8_t *)node + SCL_ALIGN_SIZE(sizeof(*node));
+
+        /* The block is kept between the node and its data */
+        *(dlist_slab_t **)slab_link = slab;
+        node->data = slab_link + slab_link_size;
+        node->prev = (0 != iter) ? (dlist_node_t *)(block + (iter - 1) * node_size) : NULL;
+        node->next = (iter + 1 < number_of_elem) ? (dlist_node_t *)(block + (iter + 1) * node_size) : NULL;
+
+        memcpy(node->data, data + iter * data_size, data_size);
+    }
+
+    new_list->head = (dlist_node_t *)block;
+    new_list->tail = (dlist_node_t *)(block + (number_of_elem - 1) * node_size);
+    new_list->size = number_of_elem;
+
+    /* Return the new list */
+    return new_list;
+}
+
+/**
+ * @brief Function to copy the elements of a list, in order, into an array
+ * provided by the user. At most number_of_elem elements are copied, the array
+ * must have room for min(number_of_elem, size of the list) elements.
+ * 
+ * @param list a double linked list object
+ * @param arr pointer to the first element of the array
+ * @param number_of_elem number of elements the array can hold
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t dlist_to_array(const dlist_t * const __restrict__ list, void * __restrict__ arr, size_t number_of_elem) {
+    /* Check if input is valid */
+    if (NULL == list) {
+        return SCL_NULL_LIST;
+    }
+
+    if ((NULL == arr) && (0 != number_of_elem)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    uint8_t *dest = arr;
+
+    for (const dlist_node_t *iterator = list->head; (NULL != iterator) && (0 != number_of_elem); iterator = iterator->next) {
+        memcpy(dest, iterator->data, list->data_size);
+        dest += list->data_size;
+        --number_of_elem;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to free every byte of memory allocated for a specific
  * double linked list object. The function will iterate through all nodes and will
@@ -152,17 +282,9 @@ scl_error_t free_dlist(dlist_t * const __restrict__ list) {
                 list->frd(iterator->data);
             }
 
-            /* Free data pointer */
-            if (NULL != iterator->data) {
-                free(iterator->data);
-            }
-
-            /* Set data pointer to `NULL` */
-            iterator->data = NULL;
-            
             /* Free node pointer */
             if (NULL != iterator) {
-                free(iterator);
+                dlist_free_node(list, iterator);
             }
 
             /* Set node pointer to `NULL` */
@@ -170,7 +292,7 @@ scl_error_t free_dlist(dlist_t * const __restrict__ list) {
         }
 
         /* Free list */
-        free(list);
+        scl_free(list->allocator, list);
 
         return SCL_OK;
     }
@@ -213,6 +335,58 @@ size_t get_dlist_size(const dlist_t * const __restrict__ list) {
     return list->size;
 }
 
+/**
+ * @brief Function to get the memory footprint of a double linked list. Every node
+ * holds one element inline, so the node bytes are the per node overhead
+ * (links, the pointer to the block and padding) and the payload is
+ * size * data_size. The header and the freed nodes of a block built by
+ * dlist_from_array are counted as slack, divided equally between the nodes
+ * of the block that are still in a list. Function visits every node of the list.
+ * 
+ * @param list an allocated double linked list object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t dlist_memory_usage(const dlist_t * const __restrict__ list, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == list) {
+        return SCL_NULL_DLIST;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const size_t node_size = SCL_ALIGN_SIZE(sizeof(dlist_node_t));
+    const size_t slab_node_size = SCL_ALIGN_SIZE(node_size + SCL_ALIGN_SIZE(sizeof(dlist_slab_t *)) + list->data_size);
+
+    usage->object_bytes = sizeof(*list);
+    usage->node_bytes = 0;
+    usage->payload_bytes = list->size * list->data_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = 0;
+    usage->nodes = list->size;
+
+    /* Nodes allocated one by one or inside a block of dlist_from_array */
+    for (const dlist_node_t *iterator = list->head; NULL != iterator; iterator = iterator->next) {
+        const uint8_t * const inline_data = (const uint8_t *)iterator + node_size;
+
+        if (inline_data == (const uint8_t *)iterator->data) {
+            usage->node_bytes += node_size;
+        } else {
+            const dlist_slab_t * const slab = *(const dlist_slab_t * const *)inline_data;
+
+            usage->node_bytes += slab_node_size - list->data_size;
+
+            /* The header and the freed nodes of a block are shared by its nodes */
+            usage->slack_bytes += (slab->bytes - slab->nodes * slab_node_size) / slab->nodes;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Get the list head object
  * 
@@ -729,16 +903,9 @@ scl_error_t dlist_delete_data(dlist_t * const __restrict__ list, const void * co
         list->frd(iterator->data);
     }
 
-    /* Free data pointer and set to `NULL` */
-    if (NULL != iterator->data) { 
-        free(iterator->data);
-    }
-
-    iterator->data = NULL;
-
     /* Free node pointer and set to `NULL` */
     if (NULL != iterator) {
-        free(iterator);
+        dlist_free_node(list, iterator);
     }
 
     iterator = NULL;
@@ -804,16 +971,9 @@ scl_error_t dlist_delete_index(dlist_t * const __restrict__ list, size_t data_in
         list->frd(iterator->data);
     }
 
-    /* Free data pointer and set to `NULL` */
-    if (NULL != iterator->data) {
-        free(iterator->data);
-    }
-
-    iterator->data = NULL;
-
     /* Free node pointer and set to `NULL` */
     if (NULL != iterator) { 
-        free(iterator);
+        dlist_free_node(list, iterator);
     }
 
     iterator = NULL;
@@ -911,16 +1071,9 @@ scl_error_t dlist_erase(dlist_t * const __restrict__ list, size_t left_index, si
             list->frd(delete_node->data);
         }
 
-        /* Free data pointer and set to `NULL` */
-        if (NULL != delete_node->data) {
-            free(delete_node->data);
-        }
-
-        delete_node->data = NULL;
-
         /* Free node pointer and set to `NULL` */
         if (NULL != delete_node) {
-            free(delete_node);
+            dlist_free_node(list, delete_node);
         }
 
         delete_node = NULL;
@@ -930,6 +1083,288 @@ scl_error_t dlist_erase(dlist_t * const __restrict__ list, size_t left_index, si
     return SCL_OK;
 }
 
+/**
+ * @brief Function to cut a run of at most run_size nodes from the front
+ * of a chain of nodes.
+ * 
+ * @param run first node of the run
+ * @param run_size maximum number of nodes of the run
+ * @return dlist_node_t* first node after the run or `NULL`
+ */
+static dlist_node_t* dlist_sort_cut(dlist_node_t *run, size_t run_size) {
+    /* Walk to the last node of the run */
+    while ((NULL != run) && (run_size > 1)) {
+        run = run->next;
+        --run_size;
+    }
+
+    if (NULL == run) {
+        return NULL;
+    }
+
+    dlist_node_t * const rest = run->next;
+    run->next = NULL;
+
+    return rest;
+}
+
+/**
+ * @brief Function to merge two sorted runs of nodes and to append the
+ * result after a link. On equal data the node of the left run goes first,
+ * so the merge is stable.
+ * 
+ * @param list a double linked list object
+ * @param left first sorted run
+ * @param right second sorted run (placed after left in the list)
+ * @param link pointer to the link to append the merged run to
+ * @return dlist_node_t** pointer to the next link of the last merged node
+ */
+static dlist_node_t** dlist_sort_merge(const dlist_t * const __restrict__ list, dlist_node_t *left, dlist_node_t *right, dlist_node_t **link) {
+    while ((NULL != left) && (NULL != right)) {
+        if (list->cmp(right->data, left->data) < 0) {
+            *link = right;
+            right = right->next;
+        } else {
+            *link = left;
+            left = left->next;
+        }
+
+        link = &(*link)->next;
+    }
+
+    /* Append the rest of the run that is left */
+    *link = (NULL != left) ? left : right;
+
+    while (NULL != *link) {
+        link = &(*link)->next;
+    }
+
+    return link;
+}
+
+/**
+ * @brief Function to sort a double linked list by the compare function of the list.
+ * The nodes are relinked by a bottom-up merge sort (runs of doubling
+ * sizes are merged in place), so no node or data is allocated or copied,
+ * the sort is stable and takes O(NlogN) time and O(1) extra memory.
+ * 
+ * @param list a double linked list object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t dlist_sort(dlist_t * const __restrict__ list) {
+    /* Check if list is allocated */
+    if (NULL == list) {
+        return SCL_NULL_DLIST;
+    }
+
+    for (size_t run_size = 1; run_size < list->size; run_size <<= 1) {
+        dlist_node_t *rest = list->head;
+        dlist_node_t **link = &list->head;
+
+        /* Merge every pair of neighbour runs of the current size */
+        while (NULL != rest) {
+            dlist_node_t * const left = rest;
+            dlist_node_t * const right = dlist_sort_cut(left, run_size);
+
+            rest = dlist_sort_cut(right, run_size);
+            link = dlist_sort_merge(list, left, right, link);
+        }
+    }
+
+    /* Find the new tail of the list */
+    list->tail = list->head;
+
+    while ((NULL != list->tail) && (NULL != list->tail->next)) {
+        list->tail = list->tail->next;
+    }
+
+    /* The merges relinked just the next pointers, restore the previous ones */
+    dlist_node_t *prev = NULL;
+
+    for (dlist_node_t *iterator = list->head; NULL != iterator; iterator = iterator->next) {
+        iterator->prev = prev;
+        prev = iterator;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move all the nodes of other list at the end of the
+ * list in O(1) time, the nodes are relinked, not copied, and other list
+ * remains empty. Both lists must have the same data size and allocator.
+ * 
+ * @param list a double linked list object
+ * @param other a double linked list object to take the nodes from
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t dlist_concat(dlist_t * const __restrict__ list, dlist_t * const __restrict__ other) {
+    /* Check if lists are allocated */
+    if ((NULL == list) || (NULL == other)) {
+        return SCL_NULL_DLIST;
+    }
+
+    /* The nodes keep their data inline and are freed by the allocator of their list */
+    if ((list == other) || (list->data_size != other->data_size) || (list->allocator != other->allocator)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return dlist_splice(list, list->size, other);
+}
+
+/**
+ * @brief Function to find the node from an index of a double linked list,
+ * walking from the closer end of the list.
+ * 
+ * @param list a double linked list object
+ * @param data_index index of the node, less than the size of the list
+ * @return dlist_node_t* the node from data_index
+ */
+static dlist_node_t* dlist_node_at(const dlist_t * const __restrict__ list, size_t data_index) {
+    dlist_node_t *iterator = NULL;
+
+    if (data_index < list->size / 2) {
+        iterator = list->head;
+
+        for (size_t iter = 0; iter < data_index; ++iter) {
+            iterator = iterator->next;
+        }
+    } else {
+        iterator = list->tail;
+
+        for (size_t iter = list->size - 1; iter > data_index; --iter) {
+            iterator = iterator->prev;
+        }
+    }
+
+    return iterator;
+}
+
+/**
+ * @brief Function to move all the nodes of other list into the list, before
+ * the node from data_index (at the end if data_index is greater or equal than
+ * the size of the list). The nodes are relinked, not copied, other list remains
+ * empty. The position is found from the closer end of the list, so O(1) at the
+ * front or at the end. Both lists must have the same data size and allocator.
+ * 
+ * @param list a double linked list object
+ * @param data_index index of the node to insert the other nodes before
+ * @param other a double linked list object to take the nodes from
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t dlist_splice(dlist_t * const __restrict__ list, size_t data_index, dlist_t * const __restrict__ other) {
+    /* Check if lists are allocated */
+    if ((NULL == list) || (NULL == other)) {
+        return SCL_NULL_DLIST;
+    }
+
+    /* The nodes keep their data inline and are freed by the allocator of their list */
+    if ((list == other) || (list->data_size != other->data_size) || (list->allocator != other->allocator)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Nothing to move */
+    if (NULL == other->head) {
+        return SCL_OK;
+    }
+
+    if (data_index >= list->size) {
+        /* Insert at the end of the list */
+        other->head->prev = list->tail;
+
+        if (NULL != list->tail) {
+            list->tail->next = other->head;
+        } else {
+            list->head = other->head;
+        }
+
+        list->tail = other->tail;
+    } else {
+        /* Insert the nodes before the node from data_index */
+        dlist_node_t * const next = dlist_node_at(list, data_index);
+
+        other->head->prev = next->prev;
+        other->tail->next = next;
+
+        if (NULL != next->prev) {
+            next->prev->next = other->head;
+        } else {
+            list->head = other->head;
+        }
+
+        next->prev = other->tail;
+    }
+
+    list->size += other->size;
+
+    other->head = other->tail = NULL;
+    other->size = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to split a list in two lists. The list keeps the nodes
+ * before data_index and the nodes from data_index to the end are moved into
+ * a new list (relinked, not copied) with the same functions, data size and
+ * allocator. The split point is found from the closer end of the list.
+ * 
+ * @param list a double linked list object
+ * @param data_index index of the first node of the new list
+ * @return dlist_t* a new list with the nodes from data_index (empty if data_index
+ * is greater or equal than the size of the list) or `NULL` if function fails
+ */
+dlist_t* dlist_split_at(dlist_t * const __restrict__ list, size_t data_index) {
+    /* Check if list is allocated */
+    if (NULL == list) {
+        errno = EINVAL;
+        perror("List to split is not allocated");
+        return NULL;
+    }
+
+    /* The nodes of the new list must be freed by the allocator of the list */
+    dlist_t *new_list = scl_malloc(list->allocator, sizeof(*new_list));
+
+    if (NULL == new_list) {
+        errno = ENOMEM;
+        perror("Not enough memory for list allocation");
+        return NULL;
+    }
+
+    new_list->allocator = list->allocator;
+    new_list->cmp = list->cmp;
+    new_list->frd = list->frd;
+    new_list->data_size = list->data_size;
+    new_list->head = new_list->tail = NULL;
+    new_list->size = 0;
+
+    /* Nothing to move */
+    if (data_index >= list->size) {
+        return new_list;
+    }
+
+    dlist_node_t * const first = dlist_node_at(list, data_index);
+
+    new_list->head = first;
+    new_list->tail = list->tail;
+    new_list->size = list->size - data_index;
+
+    list->tail = first->prev;
+    list->size = data_index;
+
+    if (NULL != first->prev) {
+        first->prev->next = NULL;
+        first->prev = NULL;
+    } else {
+        list->head = NULL;
+    }
+
+    /* Return the new list */
+    return new_list;
+}
+
 /**
  * @brief Function to filter a given double linked list object. User
  * has to provide a function that return true(1) or false(0). If
@@ -984,6 +1419,56 @@ dlist_t* dlist_filter(const dlist_t * const __restrict__ list, filter_func filte
     return filter_list;
 }
 
+/**
+ * @brief Function to filter a double linked list object in place.
+ * Every element for which the filter function does not return 1 is
+ * removed from the list and freed, in one pass over the nodes and
+ * without copying the elements that are kept, their order is not changed.
+ * 
+ * @param list a double linked list object
+ * @param filter a pointer to a filter function
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t dlist_retain(dlist_t * const __restrict__ list, filter_func filter) {
+    /* Check if input is valid */
+    if (NULL == list) {
+        return SCL_NULL_DLIST;
+    }
+
+    if (NULL == filter) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    dlist_node_t **link = &list->head;
+    dlist_node_t *last_kept = NULL;
+
+    /* Unlink the rejected nodes, link keeps the next pointer to update */
+    while (NULL != *link) {
+        dlist_node_t * const iterator = *link;
+
+        if ((NULL != iterator->data) && (1 == filter(iterator->data))) {
+            iterator->prev = last_kept;
+            last_kept = iterator;
+            link = &iterator->next;
+        } else {
+            *link = iterator->next;
+
+            /* Free content of data */
+            if ((NULL != list->frd) && (NULL != iterator->data)) {
+                list->frd(iterator->data);
+            }
+
+            dlist_free_node(list, iterator);
+            --(list->size);
+        }
+    }
+
+    list->tail = last_kept;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to traverse all list and
  * do action on all data nodes.
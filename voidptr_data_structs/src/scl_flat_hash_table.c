@@ -0,0 +1,878 @@
+/**
+ * @file scl_flat_hash_table.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_flat_hash_table.h"
+#include "./include/scl_func_types.h"
+
+#define DEFAULT_FLAT_HASH_CAPACITY 64
+#define DEFAULT_FLAT_HASH_LOAD_FACTOR 0.75
+#define DEFAULT_FLAT_HASH_CAPACITY_RATIO 2
+#define FLAT_HASH_SLOT_ALIGN sizeof(size_t)
+
+/**
+ * @brief Function to round up a size to the next multiple
+ * of the slot alignment.
+ *
+ * @param size length in bytes to align
+ * @return size_t aligned length in bytes
+ */
+static size_t flat_hash_table_align(size_t size) {
+    return (size + FLAT_HASH_SLOT_ALIGN - 1) & ~(FLAT_HASH_SLOT_ALIGN - 1);
+}
+
+/**
+ * @brief Function to compute the smallest power of two that is
+ * greater or equal than the input value.
+ *
+ * @param value value to round up
+ * @return size_t power of two greater or equal than value
+ */
+static size_t flat_hash_table_next_pow2(size_t value) {
+    size_t power = 1;
+
+    /* Double the power until it reaches the value */
+    while (power < value) {
+        power <<= 1;
+    }
+
+    return power;
+}
+
+/**
+ * @brief Function to compute the hash value of a key. The user hash
+ * is mixed so that its lower bits, used to select the home slot,
+ * depend on all the bits of the user hash.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param key pointer to a location of a value representing key of the entry
+ * @return size_t mixed hash value of the key
+ */
+static size_t flat_hash_table_hash(const flat_hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    return hash_mix(ht->hash(key));
+}
+
+/**
+ * @brief Function to get the header of one slot from
+ * a slots array.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param slots array of slots to index
+ * @param slot_index index of the slot
+ * @return flat_hash_table_slot_t* pointer to the header of the slot
+ */
+static flat_hash_table_slot_t* flat_hash_table_slot(const flat_hash_table_t * const __restrict__ ht, uint8_t * const __restrict__ slots, size_t slot_index) {
+    return (flat_hash_table_slot_t *)(slots + slot_index * ht->slot_size);
+}
+
+/**
+ * @brief Function to get the key location of one slot.
+ *
+ * @param slot pointer to the header of a slot
+ * @return uint8_t* pointer to the inline key bytes
+ */
+static uint8_t* flat_hash_table_slot_key(flat_hash_table_slot_t * const __restrict__ slot) {
+    return (uint8_t *)slot + sizeof(*slot);
+}
+
+/**
+ * @brief Function to get the data location of one slot.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param slot pointer to the header of a slot
+ * @return uint8_t* pointer to the inline data bytes
+ */
+static uint8_t* flat_hash_table_slot_data(const flat_hash_table_t * const __restrict__ ht, flat_hash_table_slot_t * const __restrict__ slot) {
+    return (uint8_t *)slot + ht->data_offset;
+}
+
+/**
+ * @brief Create a flat hash table object. Unlike the hash table object the
+ * keys and data are stored inline into one contiguous array of slots and
+ * collisions are resolved with Robin Hood linear probing, so no per-entry
+ * allocation is performed on insertion. Allocation may fail if there is not
+ * enough memory on heap, compare or hash functions are not valid.
+ *
+ * @param init_capacity initial number of slots (will be rounded up to a power of two)
+ * @param hash pointer to a function to hash the key into a size_t type (should not apply modulo)
+ * @param cmp_key pointer to a function to compare two sets of key
+ * @param cmp_dt pointer to a function to compare two sets of data
+ * @param frd_key pointer to a function to free memory allocated for the CONTENT of the key pointer
+ * @param frd_dt pointer to a function to free memory allocated for the CONTENT of the data pointer
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @return flat_hash_table_t* a new allocated flat hash table object or `NULL` (if function fails)
+ */
+flat_hash_table_t* create_flat_hash_table(size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size) {
+    /* Check if hash function and compare function are valid */
+    if ((NULL == hash) || (NULL == cmp_key) || (NULL == cmp_dt)) {
+        errno = EINVAL;
+        perror("Compare or hash functions undefined in flat hash_table");
+        return NULL;
+    }
+
+    /* Check if data and key sizes are valid */
+    if ((0 == key_size) || (0 == data_size)) {
+        errno = EINVAL;
+        perror("Key or data size are zero");
+        return NULL;
+    }
+
+    /* Check if initial capacity is valid if not set it as default value */
+    if (DEFAULT_FLAT_HASH_CAPACITY > init_capacity) {
+        init_capacity = DEFAULT_FLAT_HASH_CAPACITY;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new flat hash table object on heap */
+    flat_hash_table_t *new_hash_table = scl_malloc(allocator, sizeof(*new_hash_table));
+
+    /* Check if flat hash table was allocated successfully */
+    if (NULL != new_hash_table) {
+        new_hash_table->allocator = allocator;
+
+        /* Set function pointers of the flat hash table */
+        new_hash_table->hash = hash;
+        new_hash_table->cmp_key = cmp_key;
+        new_hash_table->cmp_dt = cmp_dt;
+        new_hash_table->frd_key = frd_key;
+        new_hash_table->frd_dt = frd_dt;
+
+        /* Compute the layout of one slot {header, key, data} */
+        new_hash_table->key_size = key_size;
+        new_hash_table->data_size = data_size;
+        new_hash_table->data_offset = flat_hash_table_align(sizeof(flat_hash_table_slot_t) + key_size);
+        new_hash_table->slot_size = flat_hash_table_align(new_hash_table->data_offset + data_size);
+
+        /* Known compare functions of the library are done inline */
+        new_hash_table->key_kind = scl_key_kind_of(cmp_key, key_size);
+
+        /* Set capacity and default size of the flat hash table */
+        new_hash_table->capacity = flat_hash_table_next_pow2(init_capacity);
+        new_hash_table->size = 0;
+        (void)SCL_STATS_RESET(new_hash_table);
+
+        /* Allocate all slots, zeroed memory means empty slots */
+        new_hash_table->slots = scl_calloc(allocator, new_hash_table->capacity, new_hash_table->slot_size);
+
+        /* Allocate the two scratch slots used to displace entries */
+        new_hash_table->swap_area = scl_malloc(allocator, 2 * new_hash_table->slot_size);
+
+        /* Check if slots were allocated successfully */
+        if ((NULL == new_hash_table->slots) || (NULL == new_hash_table->swap_area)) {
+
+            /* Slots were not allocated wipe flat hash table's memory */
+            scl_free(allocator, new_hash_table->slots);
+            scl_free(allocator, new_hash_table->swap_area);
+            scl_free(allocator, new_hash_table);
+            new_hash_table = NULL;
+
+            errno = ENOMEM;
+            perror("Not enough memory for slots of flat hash table");
+        }
+    } else {
+
+        /* Flat hash table was not allocated return `NULL` */
+        errno = ENOMEM;
+        perror("Not enough memory for flat hash table allocation");
+    }
+
+    /* Return an allocated flat hash table or `NULL` */
+    return new_hash_table;
+}
+
+/**
+ * @brief Function to free the content of the key and data
+ * of one occupied slot. The slot itself is not released because
+ * it is part of the slots array.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param slot pointer to the header of an occupied slot
+ */
+static void free_flat_hash_table_slot(const flat_hash_table_t * const __restrict__ ht, flat_hash_table_slot_t * const __restrict__ slot) {
+    /* Check if content of the data was allocated dynamically */
+    if (NULL != ht->frd_dt) {
+        ht->frd_dt(flat_hash_table_slot_data(ht, slot));
+    }
+
+    /* Check if content of the key was allocated dynamically */
+    if (NULL != ht->frd_key) {
+        ht->frd_key(flat_hash_table_slot_key(slot));
+    }
+
+    /* Mark the slot as empty */
+    slot->dist = 0;
+}
+
+/**
+ * @brief Function to delete all memory allocated for one flat hash table.
+ * Function will not automatically move flat hash table pointer to `NULL`.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_flat_hash_table(flat_hash_table_t * const __restrict__ ht) {
+    /* Check if flat hash table can be freed */
+    if (NULL != ht) {
+
+        /* Check if slots are allocated */
+        if (NULL != ht->slots) {
+
+            /* Free the content of the occupied slots if needed */
+            if ((NULL != ht->frd_key) || (NULL != ht->frd_dt)) {
+                for (size_t iter = 0; iter < ht->capacity; ++iter) {
+                    flat_hash_table_slot_t * const slot = flat_hash_table_slot(ht, ht->slots, iter);
+
+                    if (0 != slot->dist) {
+                        free_flat_hash_table_slot(ht, slot);
+                    }
+                }
+            }
+
+            /* Free memory for the slots array */
+            scl_free(ht->allocator, ht->slots);
+            ht->slots = NULL;
+        }
+
+        /* Free memory for the scratch slots */
+        scl_free(ht->allocator, ht->swap_area);
+        ht->swap_area = NULL;
+
+        /* Free memory of the flat hash table */
+        scl_free(ht->allocator, ht);
+
+        /* All good, go sleep */
+        return SCL_OK;
+    }
+
+    /* `NULL` flat hash table sent to delete */
+    return SCL_NULL_HASH_TABLE;
+}
+
+/**
+ * @brief Function to select the kind of the keys of a flat hash table, so that
+ * lookups compare the keys inline instead of calling the compare function.
+ * The kind MUST order the keys as the key compare function does. Tables
+ * created with a compare function of the library already know their kind.
+ * 
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param kind kind of the keys or SCL_KEY_GENERIC to call the compare function
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_hash_table_use_key_kind(flat_hash_table_t * const __restrict__ ht, scl_key_kind_t kind) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Keys must be wide enough for the kind */
+    if (0 == scl_key_kind_fits(kind, ht->key_size)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    ht->key_kind = kind;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place an entry into a slots array using the
+ * Robin Hood rule, an entry that is closer to its home slot gives
+ * its place to the entry that travelled more. The entry MUST NOT
+ * exist in the slots array.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param slots array of slots having ht->capacity slots
+ * @param hash full hash value of the key
+ * @param key pointer to a location of a value representing key of the entry
+ * @param data pointer to a location of a value representing data of the entry
+ * @return uint8_t* pointer to the slot where the input entry was placed
+ */
+static uint8_t* flat_hash_table_place(const flat_hash_table_t * const __restrict__ ht, uint8_t * const __restrict__ slots, size_t hash, const void *key, const void *data) {
+    /* Temporary buffers to carry displaced entries */
+    uint8_t * const carry = ht->swap_area;
+    uint8_t * const swap = ht->swap_area + ht->slot_size;
+
+    /* Build the entry to insert */
+    flat_hash_table_slot_t * const carry_slot = (flat_hash_table_slot_t *)carry;
+    carry_slot->hash = hash;
+    carry_slot->dist = 1;
+    memcpy(flat_hash_table_slot_key(carry_slot), key, ht->key_size);
+    memcpy(flat_hash_table_slot_data(ht, carry_slot), data, ht->data_size);
+
+    /* Pointer to the slot where the input entry landed */
+    uint8_t *placed = NULL;
+
+    size_t mask = ht->capacity - 1;
+    size_t slot_index = hash & mask;
+
+    /* Probe until an empty slot is found */
+    while (1) {
+        flat_hash_table_slot_t * const slot = flat_hash_table_slot(ht, slots, slot_index);
+
+        if (0 == slot->dist) {
+
+            /* Empty slot, place the carried entry */
+            memcpy(slot, carry, ht->slot_size);
+
+            if (NULL == placed) {
+                placed = (uint8_t *)slot;
+            }
+
+            return placed;
+        }
+
+        if (slot->dist < carry_slot->dist) {
+
+            /* Richer entry found, swap it with the carried one */
+            memcpy(swap, slot, ht->slot_size);
+            memcpy(slot, carry, ht->slot_size);
+            memcpy(carry, swap, ht->slot_size);
+
+            if (NULL == placed) {
+                placed = (uint8_t *)slot;
+            }
+        }
+
+        /* Go to the next slot */
+        ++(carry_slot->dist);
+        slot_index = (slot_index + 1) & mask;
+    }
+}
+
+/**
+ * @brief Function to search the slot of a key inside the flat hash table.
+ * The probing stops as soon as an entry closer to its home slot than the
+ * current probe distance is found (Robin Hood invariant).
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param hash full hash value of the key
+ * @param key pointer to a location of a value representing key of the entry
+ * @return flat_hash_table_slot_t* pointer to the slot of the key or `NULL`
+ */
+static flat_hash_table_slot_t* flat_hash_table_find_slot(const flat_hash_table_t * const __restrict__ ht, size_t hash, const void * const __restrict__ key) {
+    size_t mask = ht->capacity - 1;
+    size_t slot_index = hash & mask;
+
+    /* Probe until the Robin Hood invariant tells the key is missing */
+    SCL_STATS_ADD(ht, lookups, 1);
+
+    for (size_t dist = 1; dist <= ht->capacity; ++dist) {
+        flat_hash_table_slot_t * const slot = flat_hash_table_slot(ht, ht->slots, slot_index);
+
+        SCL_STATS_ADD(ht, probes, 1);
+
+        if (slot->dist < dist) {
+            return NULL;
+        }
+
+        /* Compare hash values first and keys just on equal hashes */
+        if (slot->hash == hash) {
+            SCL_STATS_ADD(ht, comparisons, 1);
+
+            if (0 == scl_key_compare(ht->key_kind, ht->cmp_key, ht->key_size, flat_hash_table_slot_key(slot), key)) {
+                return slot;
+            }
+        }
+
+        slot_index = (slot_index + 1) & mask;
+    }
+
+    /* Key was not found */
+    return NULL;
+}
+
+/**
+ * @brief Function to rehash a flat hash table and to double the number of
+ * slots. Entries are moved using their stored hash values, so the hash
+ * function is not called again. Function may fail if not enough memory
+ * is left on heap.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t flat_hash_table_rehash(flat_hash_table_t * const __restrict__ ht) {
+    /* Remember old capacity and compute new capacity */
+    size_t old_capacity = ht->capacity;
+    uint8_t *old_slots = ht->slots;
+
+    /* Allocate new array of slots */
+    uint8_t *new_slots = scl_calloc(ht->allocator, old_capacity * DEFAULT_FLAT_HASH_CAPACITY_RATIO, ht->slot_size);
+
+    /* Check if slots were allocated */
+    if (NULL == new_slots) {
+        errno = ENOMEM;
+        perror("Not enough memory for slots of flat hash table");
+
+        return SCL_REHASHING_FAILED;
+    }
+
+    SCL_STATS_ADD(ht, allocations, 1);
+    SCL_STATS_ADD(ht, rehashes, 1);
+
+    /* Change old slots to new slots */
+    ht->slots = new_slots;
+    ht->capacity = old_capacity * DEFAULT_FLAT_HASH_CAPACITY_RATIO;
+
+    /* Move every occupied slot into the new slots array */
+    for (size_t iter = 0; iter < old_capacity; ++iter) {
+        flat_hash_table_slot_t * const slot = flat_hash_table_slot(ht, old_slots, iter);
+
+        if (0 != slot->dist) {
+            flat_hash_table_place(ht, new_slots, slot->hash, flat_hash_table_slot_key(slot), flat_hash_table_slot_data(ht, slot));
+        }
+    }
+
+    /* Free the old slots array */
+    scl_free(ht->allocator, old_slots);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to insert a pair {key, data} into the flat hash table.
+ * The bytes of the key and data are copied inline into the slots array.
+ * If the key already exists in the table nothing is changed, as for the
+ * bucket based hash table.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_hash_table_insert(flat_hash_table_t * const __restrict__ ht, const void *key, const void *data) {
+    /* Check if flat hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if slots are allocated */
+    if (NULL == ht->slots) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data pointer is not `NULL` */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Compute the hash just once */
+    size_t hash = flat_hash_table_hash(ht, key);
+
+    /* Key already exists in the flat hash table */
+    if (NULL != flat_hash_table_find_slot(ht, hash, key)) {
+        return SCL_OK;
+    }
+
+    /* Grow the slots array before the load factor is exceeded */
+    if ((1.0 * (ht->size + 1)) / ht->capacity > DEFAULT_FLAT_HASH_LOAD_FACTOR) {
+        scl_error_t err = flat_hash_table_rehash(ht);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* Place the new entry inline */
+    flat_hash_table_place(ht, ht->slots, hash, key, data);
+
+    /* Increase flat hash table size */
+    ++(ht->size);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find the pair {key, data} from flat hash table.
+ * However function will return a pointer to memory location just
+ * for data type not for key type. The pointer stays valid until the
+ * next insertion or deletion.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return const void* pointer to memory location of the data from the slot
+ * or `NULL` is no such pair exists in the flat hash table
+ */
+const void* flat_hash_table_find_key_data(const flat_hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || (NULL == ht->slots) || (NULL == key) || (NULL == data)) {
+        return NULL;
+    }
+
+    /* Find the slot of the key */
+    flat_hash_table_slot_t * const slot = flat_hash_table_find_slot(ht, flat_hash_table_hash(ht, key), key);
+
+    if ((NULL != slot) && (0 == ht->cmp_dt(flat_hash_table_slot_data(ht, slot), data))) {
+        return flat_hash_table_slot_data(ht, slot);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to find the key from the flat hash table. However function
+ * will return a pointer to memory location just for data type. The pointer
+ * stays valid until the next insertion or deletion.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param key pointer to a location of a value representing key of a node
+ * @return const void* pointer to memory location of the data from the slot
+ * or `NULL` is no such key exists in the flat hash table
+ */
+const void* flat_hash_table_find_data(const flat_hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || (NULL == ht->slots) || (NULL == key)) {
+        return NULL;
+    }
+
+    /* Find the slot of the key */
+    flat_hash_table_slot_t * const slot = flat_hash_table_find_slot(ht, flat_hash_table_hash(ht, key), key);
+
+    /* Key was not found it means no data */
+    if (NULL == slot) {
+        return NULL;
+    }
+
+    return flat_hash_table_slot_data(ht, slot);
+}
+
+/**
+ * @brief Function to check if flat hash table contains the {key, data} pair.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return uint8_t 0 if pair {key, data} is not found in flat hash table or 1 otherwise
+ */
+uint8_t flat_hash_table_contains_key_data(const flat_hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
+    /* Pair is not in the current flat hash table */
+    if (NULL == flat_hash_table_find_key_data(ht, key, data)) {
+        return 0;
+    }
+
+    /* Pair is in the current flat hash table */
+    return 1;
+}
+
+/**
+ * @brief Function to check if flat hash table is empty or not.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @return uint8_t 0 if flat hash table is not empty or 1 otherwise
+ */
+uint8_t is_flat_hash_table_empty(const flat_hash_table_t * const __restrict__ ht) {
+    /* Flat hash table is empty */
+    if ((NULL == ht) || (NULL == ht->slots) || (0 == ht->capacity) || (0 == ht->size)) {
+        return 1;
+    }
+
+    /* Flat hash table is not empty */
+    return 0;
+}
+
+/**
+ * @brief Get the current flat hash table size.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @return size_t SIZE_MAX if flat hash table is not allocated or
+ * flat hash table's size.
+ */
+size_t get_flat_hash_table_size(const flat_hash_table_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SIZE_MAX;
+    }
+
+    return ht->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a flat hash table. The
+ * occupied slots are counted as nodes, their headers and padding as node
+ * bytes and their keys and data as payload, the empty slots are slack.
+ * 
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_hash_table_memory_usage(const flat_hash_table_t * const __restrict__ ht, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* The flat hash table object and its two scratch slots */
+    usage->object_bytes = sizeof(*ht) + 2 * ht->slot_size;
+    usage->payload_bytes = ht->size * (ht->key_size + ht->data_size);
+    usage->node_bytes = ht->size * ht->slot_size - usage->payload_bytes;
+    usage->array_bytes = 0;
+    usage->slack_bytes = (ht->capacity - ht->size) * ht->slot_size;
+    usage->nodes = ht->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the operation counters of a flat hash table, key comparisons, slot arrays allocations, rehashes and the slots visited by the searches.
+ * The counters are kept only when the library is built with SCL_STATS.
+ * 
+ * @param ht an allocated flat hash table object
+ * @param stats pointer to the counters to fill (set to zero without SCL_STATS)
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t flat_hash_table_get_stats(const flat_hash_table_t * const __restrict__ ht, scl_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return SCL_STATS_GET(ht, stats);
+}
+
+/**
+ * @brief Function to set the operation counters of a flat hash table to zero.
+ * 
+ * @param ht an allocated flat hash table object
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t flat_hash_table_reset_stats(flat_hash_table_t * const __restrict__ ht) {
+    /* Check if input data is valid */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    return SCL_STATS_RESET(ht);
+}
+
+/**
+ * @brief Get the current flat hash table capacity (number of slots).
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @return size_t SIZE_MAX if flat hash table is not allocated or
+ * flat hash table's capacity.
+ */
+size_t get_flat_hash_table_capacity(const flat_hash_table_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SIZE_MAX;
+    }
+
+    return ht->capacity;
+}
+
+/**
+ * @brief Function to remove one occupied slot from the flat hash table.
+ * The following entries are shifted backwards until an empty slot or an
+ * entry sitting in its home slot is found, so no tombstones are needed.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param slot pointer to the header of the occupied slot to remove
+ */
+static void flat_hash_table_remove_slot(flat_hash_table_t * const __restrict__ ht, flat_hash_table_slot_t * __restrict__ slot) {
+    /* Free the content of the entry */
+    free_flat_hash_table_slot(ht, slot);
+
+    size_t mask = ht->capacity - 1;
+    size_t slot_index = (size_t)((uint8_t *)slot - ht->slots) / ht->slot_size;
+
+    /* Backward shift deletion */
+    while (1) {
+        size_t next_index = (slot_index + 1) & mask;
+        flat_hash_table_slot_t * const next_slot = flat_hash_table_slot(ht, ht->slots, next_index);
+
+        /* Stop on empty slot or on entry placed in its home slot */
+        if (next_slot->dist <= 1) {
+            break;
+        }
+
+        /* Move the next entry one slot backwards */
+        memcpy(slot, next_slot, ht->slot_size);
+        --(slot->dist);
+        next_slot->dist = 0;
+
+        slot = next_slot;
+        slot_index = next_index;
+    }
+
+    /* Decrease flat hash table size */
+    --(ht->size);
+}
+
+/**
+ * @brief Function to delete one pair {key, data} from current working
+ * flat hash table if it exists, function will throw an error if pair does
+ * not exists in the flat hash table.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_hash_table_delete_key_data(flat_hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
+    /* Check if flat hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if slots are allocated */
+    if (NULL == ht->slots) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data type pointer is valid */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Check if there exists at least data to search */
+    if (0 == ht->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* Find slot to delete */
+    flat_hash_table_slot_t * const delete_slot = flat_hash_table_find_slot(ht, flat_hash_table_hash(ht, key), key);
+
+    /* Pair is not in the flat hash table */
+    if ((NULL == delete_slot) || (0 != ht->cmp_dt(flat_hash_table_slot_data(ht, delete_slot), data))) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    /* Remove the slot */
+    flat_hash_table_remove_slot(ht, delete_slot);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to delete the key from the flat hash table, if key was
+ * not found in the flat hash table an error will be thrown.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param key pointer to a location of a value representing key of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_hash_table_delete_key(flat_hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Check if flat hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if slots are allocated */
+    if (NULL == ht->slots) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if there exists at least one key to delete */
+    if (0 == ht->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* Find slot to delete */
+    flat_hash_table_slot_t * const delete_slot = flat_hash_table_find_slot(ht, flat_hash_table_hash(ht, key), key);
+
+    /* Key is not in the flat hash table */
+    if (NULL == delete_slot) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    /* Remove the slot */
+    flat_hash_table_remove_slot(ht, delete_slot);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to perform one action on every data from the flat hash
+ * table. Slots are visited in the order they are stored in memory, so the
+ * traversal is a linear scan of the slots array.
+ *
+ * @param ht pointer to an allocated flat hash table memory location
+ * @param action a pointer function to perform an action on one data
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_hash_table_traverse(const flat_hash_table_t * const __restrict__ ht, action_func action) {
+    /* Check if flat hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    /* Check if slots are allocated */
+    if (NULL == ht->slots) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Empty flat hash table */
+    if (0 == ht->size) {
+        printf("[ ]\n");
+        return SCL_OK;
+    }
+
+    /* Visit every occupied slot */
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        flat_hash_table_slot_t * const slot = flat_hash_table_slot(ht, ht->slots, iter);
+
+        if (0 != slot->dist) {
+            action(flat_hash_table_slot_data(ht, slot));
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
@@ -0,0 +1,564 @@
+/**
+ * @file scl_frozen_tree.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_frozen_tree.h"
+
+/**
+ * @brief Function to get the address of one slot of a frozen tree.
+ *
+ * @param ft an allocated frozen tree object
+ * @param slot index of the slot in Eytzinger order
+ * @return uint8_t* address of the element of the slot
+ */
+static inline uint8_t* frozen_tree_slot(const frozen_tree_t * const __restrict__ ft, size_t slot) {
+    return ft->data + slot * ft->data_size;
+}
+
+/**
+ * @brief Function to get the slot of the smallest element of a
+ * frozen tree (the leftmost slot).
+ *
+ * @param size number of elements of the tree
+ * @return size_t the first slot in ascending order or 0 if the tree is empty
+ */
+static size_t frozen_tree_first_slot(size_t size) {
+    size_t slot = (0 == size) ? 0 : 1;
+
+    while ((0 != slot) && ((slot << 1) <= size)) {
+        slot <<= 1;
+    }
+
+    return slot;
+}
+
+/**
+ * @brief Function to get the slot that follows a slot in ascending order,
+ * the leftmost slot of the right subtree or else the first ancestor
+ * reached from its left subtree. Visiting all the slots takes O(N) time.
+ *
+ * @param size number of elements of the tree
+ * @param slot a slot of the tree
+ * @return size_t the next slot in ascending order or 0 after the last one
+ */
+static size_t frozen_tree_next_slot(size_t size, size_t slot) {
+    if (((slot << 1) | 1) <= size) {
+        slot = (slot << 1) | 1;
+
+        while ((slot << 1) <= size) {
+            slot <<= 1;
+        }
+
+        return slot;
+    }
+
+    /* Climb over the right links, then over one left link */
+    while (0 != (slot & 1)) {
+        slot >>= 1;
+    }
+
+    return slot >> 1;
+}
+
+/**
+ * @brief Function to allocate an empty frozen tree object with room
+ * for size elements.
+ *
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free the content of data
+ * @param data_size length in bytes of the data data type
+ * @param size number of distinct elements of the tree
+ * @return frozen_tree_t* a new allocated frozen tree object or `NULL`
+ */
+static frozen_tree_t* frozen_tree_alloc(compare_func cmp, free_func frd, size_t data_size, size_t size) {
+    /* Check if compare function is valid */
+    if (NULL == cmp) {
+        errno = EINVAL;
+        perror("Compare function undefined for frozen tree");
+        return NULL;
+    }
+
+    /* Check if the data size of one element is valid */
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    frozen_tree_t *new_tree = scl_malloc(allocator, sizeof(*new_tree));
+
+    if (NULL == new_tree) {
+        errno = ENOMEM;
+        perror("Not enough memory for frozen tree allocation");
+        return NULL;
+    }
+
+    /* Slot 0 is not used, so the children of slot k are 2k and 2k + 1 */
+    new_tree->data = scl_malloc(allocator, (size + 1) * data_size);
+    new_tree->counts = scl_malloc(allocator, (size + 1) * sizeof(*new_tree->counts));
+
+    if ((NULL == new_tree->data) || (NULL == new_tree->counts)) {
+        scl_free(allocator, new_tree->data);
+        scl_free(allocator, new_tree->counts);
+        scl_free(allocator, new_tree);
+
+        errno = ENOMEM;
+        perror("Not enough memory for frozen tree elements");
+        return NULL;
+    }
+
+    new_tree->counts[0] = 0;
+    new_tree->cmp = cmp;
+    new_tree->frd = frd;
+    new_tree->data_size = data_size;
+    new_tree->size = size;
+    new_tree->allocator = allocator;
+
+    return new_tree;
+}
+
+/**
+ * @brief Function to create a frozen tree from an array sorted in ascending
+ * order (according to cmp) in O(N) time. Equal neighbour elements are stored
+ * once with their count. The bytes of the elements are copied, so with a
+ * frd function the content of the elements belongs to the tree. If the array
+ * is not sorted or the allocation fails `NULL` is returned.
+ *
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free the content of data
+ * @param data_size length in bytes of the data data type
+ * @param arr pointer to the first element of the sorted array
+ * @param number_of_elem number of elements of the array
+ * @return frozen_tree_t* a new allocated frozen tree object or `NULL`
+ */
+frozen_tree_t* create_frozen_tree(compare_func cmp, free_func frd, size_t data_size, const void * __restrict__ arr, size_t number_of_elem) {
+    /* Check if input is valid */
+    if (((NULL == arr) && (0 != number_of_elem)) || (NULL == cmp)) {
+        errno = EINVAL;
+        perror("Invalid input for frozen tree");
+        return NULL;
+    }
+
+    const uint8_t * const data = arr;
+    size_t size = 0;
+
+    /* Check the order of the array and count the distinct elements */
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        int32_t compare = (0 == iter) ? -1 : cmp(data + (iter - 1) * data_size, data + iter * data_size);
+
+        if (compare >= 1) {
+            errno = EINVAL;
+            perror("Array of a frozen tree is not sorted");
+            return NULL;
+        }
+
+        if (compare <= -1) {
+            ++size;
+        }
+    }
+
+    frozen_tree_t *new_tree = frozen_tree_alloc(cmp, frd, data_size, size);
+
+    if (NULL == new_tree) {
+        return NULL;
+    }
+
+    /* Fill the slots in ascending order, the slot follows the inorder walk */
+    size_t slot = 0;
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        if ((0 != slot) && (0 == cmp(frozen_tree_slot(new_tree, slot), data + iter * data_size))) {
+            ++(new_tree->counts[slot]);
+            continue;
+        }
+
+        slot = (0 == slot) ? frozen_tree_first_slot(size) : frozen_tree_next_slot(size, slot);
+
+        memcpy(frozen_tree_slot(new_tree, slot), data + iter * data_size, data_size);
+        new_tree->counts[slot] = 1;
+    }
+
+    return new_tree;
+}
+
+/**
+ * @brief Function to freeze an avl tree into a frozen tree in O(N) time.
+ * The avl tree is consumed: its elements (and the ownership of their
+ * content) move into the frozen tree and the avl tree is freed. If the
+ * allocation fails `NULL` is returned and the avl tree is not changed.
+ *
+ * @param tree an allocated avl tree object
+ * @return frozen_tree_t* a new allocated frozen tree object or `NULL`
+ */
+frozen_tree_t* freeze_avl(avl_tree_t * const __restrict__ tree) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        errno = EINVAL;
+        perror("Avl tree to freeze is not allocated");
+        return NULL;
+    }
+
+    frozen_tree_t *new_tree = frozen_tree_alloc(tree->cmp, tree->frd, tree->data_size, tree->size);
+
+    if (NULL == new_tree) {
+        return NULL;
+    }
+
+    avl_tree_iter_t iter;
+    size_t slot = frozen_tree_first_slot(new_tree->size);
+
+    for (const void *data = avl_iter_begin(tree, &iter); NULL != data; data = avl_iter_next(&iter)) {
+        memcpy(frozen_tree_slot(new_tree, slot), data, tree->data_size);
+        new_tree->counts[slot] = iter.node->count;
+
+        slot = frozen_tree_next_slot(new_tree->size, slot);
+    }
+
+    /* The content of the data belongs to the frozen tree now */
+    tree->frd = NULL;
+    free_avl(tree);
+
+    return new_tree;
+}
+
+/**
+ * @brief Function to freeze a red-black tree into a frozen tree in O(N)
+ * time. The red-black tree is consumed: its elements (and the ownership of
+ * their content) move into the frozen tree and the red-black tree is freed.
+ * If the allocation fails `NULL` is returned and the red-black tree is not
+ * changed.
+ *
+ * @param tree an allocated red-black tree object
+ * @return frozen_tree_t* a new allocated frozen tree object or `NULL`
+ */
+frozen_tree_t* freeze_rbk(rbk_tree_t * const __restrict__ tree) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        errno = EINVAL;
+        perror("Red-black tree to freeze is not allocated");
+        return NULL;
+    }
+
+    frozen_tree_t *new_tree = frozen_tree_alloc(tree->cmp, tree->frd, tree->data_size, tree->size);
+
+    if (NULL == new_tree) {
+        return NULL;
+    }
+
+    rbk_tree_iter_t iter;
+    size_t slot = frozen_tree_first_slot(new_tree->size);
+
+    for (const void *data = rbk_iter_begin(tree, &iter); NULL != data; data = rbk_iter_next(&iter)) {
+        memcpy(frozen_tree_slot(new_tree, slot), data, tree->data_size);
+        new_tree->counts[slot] = iter.node->count;
+
+        slot = frozen_tree_next_slot(new_tree->size, slot);
+    }
+
+    /* The content of the data belongs to the frozen tree now */
+    tree->frd = NULL;
+    free_rbk(tree);
+
+    return new_tree;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a frozen
+ * tree object, the content of every element is freed by the frd function
+ * provided at creation.
+ *
+ * @param ft an allocated frozen tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_frozen_tree(frozen_tree_t * const __restrict__ ft) {
+    /* Check if input is valid */
+    if (NULL == ft) {
+        return SCL_NULL_FROZEN_TREE;
+    }
+
+    if (NULL != ft->frd) {
+        for (size_t slot = 1; slot <= ft->size; ++slot) {
+            ft->frd(frozen_tree_slot(ft, slot));
+        }
+    }
+
+    scl_free(ft->allocator, ft->data);
+    scl_free(ft->allocator, ft->counts);
+    scl_free(ft->allocator, ft);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find the slot of the first element greater than or
+ * equal to data (or greater than data). The search walks down from slot 1
+ * and the next slot depends only on the comparison (no branch on the
+ * result), the slots four levels below are prefetched while comparing,
+ * because their 16 elements are stored next to each other.
+ *
+ * @param ft an allocated frozen tree object
+ * @param data pointer to an address of a generic data type
+ * @param upper 0 for the first element not smaller than data, 1 for the
+ * first element greater than data
+ * @return size_t the slot of the bound or 0 if there is no such element
+ */
+static size_t frozen_tree_bound_slot(const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data, int32_t upper) {
+    size_t slot = 1;
+
+    while (slot <= ft->size) {
+        if ((slot << 4) <= ft->size) {
+            SCL_PREFETCH(frozen_tree_slot(ft, slot << 4));
+        }
+
+        /* Go right while the element is smaller than data (or equal for upper bounds) */
+        slot = (slot << 1) | (size_t)(ft->cmp(frozen_tree_slot(ft, slot), data) < upper);
+    }
+
+    /* Undo the right turns after the last left turn, the bound is where that left turn happened */
+    while (0 != (slot & 1)) {
+        slot >>= 1;
+    }
+
+    return slot >> 1;
+}
+
+/**
+ * @brief Function to search data in a frozen tree O(log N).
+ *
+ * @param ft an allocated frozen tree object
+ * @param data pointer to an address of a generic data type
+ * @return const void* the element equal to data or `NULL` if not found
+ */
+const void* frozen_tree_find_data(const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == ft) || (NULL == data)) {
+        return NULL;
+    }
+
+    size_t slot = frozen_tree_bound_slot(ft, data, 0);
+
+    if ((0 == slot) || (0 != ft->cmp(frozen_tree_slot(ft, slot), data))) {
+        return NULL;
+    }
+
+    return frozen_tree_slot(ft, slot);
+}
+
+/**
+ * @brief Function to get how many times data was inserted into the
+ * frozen tree (or into the tree it was frozen from).
+ *
+ * @param ft an allocated frozen tree object
+ * @param data pointer to an address of a generic data type
+ * @return uint32_t the count of data or 0 if data is not found
+ */
+uint32_t frozen_tree_count(const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == ft) || (NULL == data)) {
+        return 0;
+    }
+
+    size_t slot = frozen_tree_bound_slot(ft, data, 0);
+
+    if ((0 == slot) || (0 != ft->cmp(frozen_tree_slot(ft, slot), data))) {
+        return 0;
+    }
+
+    return ft->counts[slot];
+}
+
+/**
+ * @brief Function to find the first element of a frozen tree
+ * that is not smaller than data O(log N).
+ *
+ * @param ft an allocated frozen tree object
+ * @param data pointer to an address of a generic data type
+ * @return const void* the first element greater than or equal to data or `NULL`
+ */
+const void* frozen_tree_lower_bound(const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == ft) || (NULL == data)) {
+        return NULL;
+    }
+
+    size_t slot = frozen_tree_bound_slot(ft, data, 0);
+
+    return (0 == slot) ? NULL : frozen_tree_slot(ft, slot);
+}
+
+/**
+ * @brief Function to find the first element of a frozen tree
+ * that is greater than data O(log N).
+ *
+ * @param ft an allocated frozen tree object
+ * @param data pointer to an address of a generic data type
+ * @return const void* the first element greater than data or `NULL`
+ */
+const void* frozen_tree_upper_bound(const frozen_tree_t * const __restrict__ ft, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == ft) || (NULL == data)) {
+        return NULL;
+    }
+
+    size_t slot = frozen_tree_bound_slot(ft, data, 1);
+
+    return (0 == slot) ? NULL : frozen_tree_slot(ft, slot);
+}
+
+/**
+ * @brief Function to get the smallest element of a frozen tree.
+ *
+ * @param ft an allocated frozen tree object
+ * @return const void* the smallest element or `NULL` if the tree is empty
+ */
+const void* frozen_tree_min_data(const frozen_tree_t * const __restrict__ ft) {
+    if ((NULL == ft) || (0 == ft->size)) {
+        return NULL;
+    }
+
+    return frozen_tree_slot(ft, frozen_tree_first_slot(ft->size));
+}
+
+/**
+ * @brief Function to get the greatest element of a frozen tree.
+ *
+ * @param ft an allocated frozen tree object
+ * @return const void* the greatest element or `NULL` if the tree is empty
+ */
+const void* frozen_tree_max_data(const frozen_tree_t * const __restrict__ ft) {
+    if ((NULL == ft) || (0 == ft->size)) {
+        return NULL;
+    }
+
+    size_t slot = 1;
+
+    while (((slot << 1) | 1) <= ft->size) {
+        slot = (slot << 1) | 1;
+    }
+
+    return frozen_tree_slot(ft, slot);
+}
+
+/**
+ * @brief Function to get the number of distinct elements of a frozen tree.
+ *
+ * @param ft an allocated frozen tree object
+ * @return size_t the number of elements or SIZE_MAX if ft is not allocated
+ */
+size_t get_frozen_tree_size(const frozen_tree_t * const __restrict__ ft) {
+    if (NULL == ft) {
+        return SIZE_MAX;
+    }
+
+    return ft->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a frozen tree. The elements
+ * are the payload, the counts array is counted as array bytes and the
+ * unused slot 0 of both arrays as slack.
+ *
+ * @param ft an allocated frozen tree object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t frozen_tree_memory_usage(const frozen_tree_t * const __restrict__ ft, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == ft) {
+        return SCL_NULL_FROZEN_TREE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*ft);
+    usage->node_bytes = 0;
+    usage->payload_bytes = ft->size * ft->data_size;
+    usage->array_bytes = ft->size * sizeof(*ft->counts);
+    usage->slack_bytes = ft->data_size + sizeof(*ft->counts);
+    usage->nodes = ft->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to call action for every element of a frozen tree
+ * from [lo, hi) in ascending order, O(log N + K) time for K elements.
+ * The action must not change the order of the elements.
+ *
+ * @param ft an allocated frozen tree object
+ * @param lo first element of the range
+ * @param hi element after the range
+ * @param action a pointer function to perform an action on one element
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t frozen_tree_range(const frozen_tree_t * const __restrict__ ft, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == ft) {
+        return SCL_NULL_FROZEN_TREE;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    for (size_t slot = frozen_tree_bound_slot(ft, lo, 0); (0 != slot) && (ft->cmp(frozen_tree_slot(ft, slot), hi) < 0); slot = frozen_tree_next_slot(ft->size, slot)) {
+        action(frozen_tree_slot(ft, slot));
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to call action for every element of a frozen tree in
+ * ascending order. The action must not change the order of the elements.
+ *
+ * @param ft an allocated frozen tree object
+ * @param action a pointer function to perform an action on one element
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t frozen_tree_traverse_inorder(const frozen_tree_t * const __restrict__ ft, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == ft) {
+        return SCL_NULL_FROZEN_TREE;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    for (size_t slot = frozen_tree_first_slot(ft->size); 0 != slot; slot = frozen_tree_next_slot(ft->size, slot)) {
+        action(frozen_tree_slot(ft, slot));
+    }
+
+    return SCL_OK;
+}
@@ -24,6 +24,12 @@
 
 #include "./include/scl_func_types.h"
 
+/* Secret constants used by the byte hash mixing rounds */
+#define HASH_SECRET_0 0xa0761d6478bd642fULL
+#define HASH_SECRET_1 0xe7037ed1a0b428dbULL
+#define HASH_SECRET_2 0x8ebc6af09c88c6e3ULL
+#define HASH_SECRET_3 0x589965cc75374cc3ULL
+
 /**
  * @brief Function to print one short int
  * data type. Function may fail if address
@@ -772,3 +778,420 @@ int32_t compare_string(const void * const data1, const void * const data2) {
         return strcmp(typed_data1, typed_data2);
     }
 }
+
+
+/**
+ * @brief Function to mix all bits of a 64-bit value into
+ * every bit of the result (murmur3 64-bit finalizer). A hash
+ * table that selects the bucket by masking the lower bits of
+ * a hash value may apply this function first, so that weak
+ * user hashes (for example identity hashes) still spread
+ * over all buckets
+ * 
+ * @param value value to be mixed
+ * @return size_t mixed value
+ */
+size_t hash_mix(size_t value) {
+    uint64_t mixed = (uint64_t)value;
+
+    mixed ^= mixed >> 33;
+    mixed *= 0xff51afd7ed558ccdULL;
+    mixed ^= mixed >> 33;
+    mixed *= 0xc4ceb9fe1a85ec53ULL;
+    mixed ^= mixed >> 33;
+
+    return (size_t)mixed;
+}
+
+/**
+ * @brief Function to multiply two 64-bit values into a
+ * 128-bit value and to fold the result back to 64 bits
+ * 
+ * @param value1 first 64-bit value
+ * @param value2 second 64-bit value
+ * @return uint64_t low half of the product xor-ed with the high half
+ */
+static uint64_t hash_fold_mul(uint64_t value1, uint64_t value2) {
+    __uint128_t product = (__uint128_t)value1 * value2;
+
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+}
+
+/**
+ * @brief Function to read 8 unaligned bytes
+ * 
+ * @param bytes pointer to the first byte
+ * @return uint64_t the 8 bytes as one value
+ */
+static uint64_t hash_read_8(const uint8_t * const bytes) {
+    uint64_t value = 0;
+
+    memcpy(&value, bytes, sizeof(value));
+
+    return value;
+}
+
+/**
+ * @brief Function to read 4 unaligned bytes
+ * 
+ * @param bytes pointer to the first byte
+ * @return uint64_t the 4 bytes as one value
+ */
+static uint64_t hash_read_4(const uint8_t * const bytes) {
+    uint32_t value = 0;
+
+    memcpy(&value, bytes, sizeof(value));
+
+    return (uint64_t)value;
+}
+
+/**
+ * @brief Function to hash an array of bytes. The function
+ * processes 48 bytes per round using three independent
+ * multiply-fold lanes, short inputs (up to 16 bytes) are
+ * handled without any loop
+ * 
+ * @param data pointer to the first byte of the array
+ * @param data_size number of bytes to hash
+ * @return size_t hash value of the bytes
+ */
+size_t hash_bytes(const void * const data, size_t data_size) {
+    /* Check if data is valid */
+    if ((NULL == data) && (0 != data_size)) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    const uint8_t *bytes = data;
+    uint64_t seed = hash_fold_mul(HASH_SECRET_0, HASH_SECRET_1);
+    uint64_t first = 0;
+    uint64_t second = 0;
+
+    if (data_size <= 16) {
+        if (data_size >= 4) {
+            /* Read two overlapping words from each end */
+            size_t shift = (data_size >> 3) << 2;
+
+            first = (hash_read_4(bytes) << 32) | hash_read_4(bytes + shift);
+            second = (hash_read_4(bytes + data_size - 4) << 32) | hash_read_4(bytes + data_size - 4 - shift);
+        } else if (data_size > 0) {
+            first = ((uint64_t)bytes[0] << 16) | ((uint64_t)bytes[data_size >> 1] << 8) | (uint64_t)bytes[data_size - 1];
+        }
+    } else {
+        size_t remaining = data_size;
+
+        if (remaining > 48) {
+            uint64_t lane1 = seed;
+            uint64_t lane2 = seed;
+
+            do {
+                seed = hash_fold_mul(hash_read_8(bytes) ^ HASH_SECRET_1, hash_read_8(bytes + 8) ^ seed);
+                lane1 = hash_fold_mul(hash_read_8(bytes + 16) ^ HASH_SECRET_2, hash_read_8(bytes + 24) ^ lane1);
+                lane2 = hash_fold_mul(hash_read_8(bytes + 32) ^ HASH_SECRET_3, hash_read_8(bytes + 40) ^ lane2);
+
+                bytes += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+
+            seed ^= lane1 ^ lane2;
+        }
+
+        while (remaining > 16) {
+            seed = hash_fold_mul(hash_read_8(bytes) ^ HASH_SECRET_1, hash_read_8(bytes + 8) ^ seed);
+
+            bytes += 16;
+            remaining -= 16;
+        }
+
+        /* Last 16 bytes may overlap the previous round */
+        first = hash_read_8(bytes + remaining - 16);
+        second = hash_read_8(bytes + remaining - 8);
+    }
+
+    /* Final mixing of the state */
+    __uint128_t product = (__uint128_t)(first ^ HASH_SECRET_1) * (second ^ seed);
+
+    first = (uint64_t)product;
+    second = (uint64_t)(product >> 64);
+
+    return (size_t)hash_fold_mul(first ^ HASH_SECRET_0 ^ (uint64_t)data_size, second ^ HASH_SECRET_1);
+}
+
+/**
+ * @brief Function to hash one short int
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_short_int(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)(int64_t)*(const short int * const)data);
+}
+
+/**
+ * @brief Function to hash one unsigned short int
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_ushort_int(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)*(const unsigned short int * const)data);
+}
+
+/**
+ * @brief Function to hash one unsigned int
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_uint(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)*(const unsigned int * const)data);
+}
+
+/**
+ * @brief Function to hash one int
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_int(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)(int64_t)*(const int * const)data);
+}
+
+/**
+ * @brief Function to hash one long int
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_long_int(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)(int64_t)*(const long int * const)data);
+}
+
+/**
+ * @brief Function to hash one unsigned long int
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_ulong_int(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)*(const unsigned long int * const)data);
+}
+
+/**
+ * @brief Function to hash one long long int
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_llong_int(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)(int64_t)*(const long long int * const)data);
+}
+
+/**
+ * @brief Function to hash one unsigned long long int
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_ullong_int(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)*(const unsigned long long int * const)data);
+}
+
+/**
+ * @brief Function to hash one char
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_char(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)*(const char * const)data);
+}
+
+/**
+ * @brief Function to hash one unsigned char
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_uchar(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_mix((size_t)*(const unsigned char * const)data);
+}
+
+/**
+ * @brief Function to hash one float
+ * data type. Both zero values (0.0 and -0.0)
+ * have the same hash because they compare equal.
+ * Function may fail if address of data type
+ * is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_float(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Normalize the negative zero */
+    float value = *(const float * const)data;
+
+    if (0 == value) {
+        value = 0;
+    }
+
+    /* Hash data type */
+    return hash_bytes(&value, sizeof(value));
+}
+
+/**
+ * @brief Function to hash one double
+ * data type. Both zero values (0.0 and -0.0)
+ * have the same hash because they compare equal.
+ * Function may fail if address of data type
+ * is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_double(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Normalize the negative zero */
+    double value = *(const double * const)data;
+
+    if (0 == value) {
+        value = 0;
+    }
+
+    /* Hash data type */
+    return hash_bytes(&value, sizeof(value));
+}
+
+/**
+ * @brief Function to hash one string
+ * data type. Function may fail if address
+ * of data type is not valid
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash value of the data type
+ */
+size_t hash_string(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Hash data type */
+    return hash_bytes(data, strlen((const char * const)data));
+}
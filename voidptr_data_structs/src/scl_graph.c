@@ -27,10 +27,82 @@
 #include "./include/scl_stack.h"
 #include "./include/scl_priority_queue.h"
 
+#include <math.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* Number of edges from one chunk of the edges memory pool */
+#define GRAPH_LINKS_PER_CHUNK 1024
+
+/**
+ * @brief Subroutine function to take one vertex object from the vertices
+ * memory pool of the graph and to set its default values.
+ * 
+ * @param gr pointer to an allocated graph object
+ * @return graph_vertex_t* a new vertex or `NULL` if no heap memory is left
+ */
+static graph_vertex_t* create_graph_vertex(const graph_t * const __restrict__ gr) {
+    graph_vertex_t *new_vertex = mem_pool_alloc(gr->vertex_pool);
+
+    /* Check if vertex was allocated successfully */
+    if (NULL != new_vertex) {
+        SCL_STATS_ADD(gr, allocations, 1);
+
+        /* Set default vertex values */
+        new_vertex->link = NULL;
+        new_vertex->in_link = NULL;
+        new_vertex->in_deg = 0;
+        new_vertex->out_deg = 0;
+    }
+
+    /* Return a new vertex or `NULL` */
+    return new_vertex;
+}
+
+/**
+ * @brief Subroutine function to make room in the vertices array of the
+ * graph for at least number_of_vertices vertices. The array grows at least
+ * twice, so adding vertices one by one reallocates it O(logN) times.
+ * 
+ * @param gr pointer to an allocated graph object
+ * @param number_of_vertices number of vertices the array must hold
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_grow_vertices(graph_t * const __restrict__ gr, size_t number_of_vertices) {
+    /* Check if vertices array is big enough */
+    if (number_of_vertices <= gr->capacity) {
+        return SCL_OK;
+    }
+
+    size_t new_capacity = number_of_vertices;
+
+    if ((gr->capacity <= SIZE_MAX / 2) && (2 * gr->capacity > new_capacity)) {
+        new_capacity = 2 * gr->capacity;
+    }
+
+    /* Try to realloc vertices array of the graph */
+    graph_vertex_t **try_realloc = scl_realloc(gr->allocator, gr->vertices, sizeof(*try_realloc) * new_capacity);
+
+    if (NULL == try_realloc) {
+        return SCL_REALLOC_GRAPH_VERTICES_FAIL;
+    }
+
+    gr->vertices = try_realloc;
+    gr->capacity = new_capacity;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Create a new graph object. Function may fail if the
  * number of vertices is zero, or not enough heap memory is
- * left to allocate all vertices.
+ * left to allocate all vertices. The vertices are taken from
+ * one chunk and the edges from chunks of GRAPH_LINKS_PER_CHUNK
+ * links of a memory pool.
  * 
  * @param number_of_vertices initial number of vertices to form a graph
  * @return graph_t* a new allocated graph object or `NULL` if function fails
@@ -43,117 +115,69 @@ graph_t* create_graph(size_t number_of_vertices) {
         return NULL;
     }
 
-    /* Allocate a new graph object */
-    graph_t *new_graph = malloc(sizeof(*new_graph));
-
-    /* Check if graph object was allocated successfully */
-    if (NULL != new_graph) {
-
-        /* Set default values of the graph object */
-        new_graph->size = number_of_vertices;
-
-        /* Allocate visit array of the current graph object */
-        new_graph->visit = malloc(sizeof(*new_graph->visit) * number_of_vertices);
-
-        /* Check if visit array was allocated */
-        if (NULL != new_graph->visit) {
-
-            /* Allocate vertices array of the graph object */
-            new_graph->vertices = malloc(sizeof(*new_graph->vertices) * number_of_vertices);
-
-            /* Check if vertices array was allocated */
-            if (NULL != new_graph->vertices) {
-
-                /* Set every vertex to its default value */
-                for (size_t iter = 0; iter < new_graph->size; ++iter) {
-
-                    /* Allocate a vertex node */
-                    new_graph->vertices[iter] = malloc(sizeof(*new_graph->vertices[iter]));
-
-                    /* Check if vertex was allocated successfully */
-                    if (NULL != new_graph->vertices[iter]) {
-
-                        /* Set default vertex values */
-                        new_graph->vertices[iter]->link = NULL;
-                        new_graph->vertices[iter]->in_deg = 0;
-                        new_graph->vertices[iter]->out_deg = 0;
-                    } else {
-
-                        /* Allocation of one vertex failed so free all memory */
-                        for (size_t del_iter = 0; del_iter <= iter; ++del_iter) {
-                            free(new_graph->vertices[del_iter]);
-                            new_graph->vertices[del_iter] = NULL;
-                        }
-
-                        free(new_graph->vertices);
-                        new_graph->vertices = NULL;
+    /* Check if every vertex number fits in the edges */
+    if (number_of_vertices > GRAPH_VERTEX_ID_MAX) {
+        errno = EINVAL;
+        perror("Number of vertexes of the graph does not fit in the vertex type at creation");
+        return NULL;
+    }
 
-                        free(new_graph->visit);
-                        new_graph->visit = NULL;
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
 
-                        free(new_graph);
-                        new_graph = NULL;
+    /* Allocate a new graph object */
+    graph_t *new_graph = scl_malloc(allocator, sizeof(*new_graph));
 
-                        errno = ENOMEM;
-                        perror("Not enought memory to allocate graph links");
-                    }
-                }
-            } else {
+    /* Check if graph object was allocated successfully */
+    if (NULL == new_graph) {
+        errno = ENOMEM;
+        perror("Not enough memory to allocate new graph object");
+        return NULL;
+    }
 
-                /* Allocation of the vertices array failed */
-                free(new_graph->visit);
-                new_graph->visit = NULL;
+    new_graph->allocator = allocator;
+    (void)SCL_STATS_RESET(new_graph);
 
-                free(new_graph);
-                new_graph = NULL;
+    /* Set default values of the graph object */
+    new_graph->size = number_of_vertices;
+    new_graph->capacity = number_of_vertices;
+    new_graph->tombstones = 0;
+    new_graph->has_in_edges = 0;
 
-                errno = ENOMEM;
-                perror("Not enough memory to allocate vertices of the graph");
-            }
-        } else {
+    /* Allocate vertices array and the memory pools of the graph object */
+    new_graph->vertices = scl_malloc(allocator, sizeof(*new_graph->vertices) * number_of_vertices);
+    new_graph->vertex_pool = create_mem_pool(sizeof(graph_vertex_t), 0);
+    new_graph->link_pool = create_mem_pool(sizeof(graph_link_t), GRAPH_LINKS_PER_CHUNK);
 
-            /* Allocation of the visit array failed */
-            free(new_graph);
-            new_graph = NULL;
+    /* Check if all the memory for the vertices was allocated */
+    if ((NULL == new_graph->vertices) || (NULL == new_graph->vertex_pool) || (NULL == new_graph->link_pool)
+        || (SCL_OK != mem_pool_reserve(new_graph->vertex_pool, number_of_vertices))) {
+        
+        free_mem_pool(new_graph->vertex_pool);
+        free_mem_pool(new_graph->link_pool);
 
-            errno = ENOMEM;
-            perror("Not enough memory to allocate visit vector for graph");
-        }
-    } else {
+        scl_free(allocator, new_graph->vertices);
+        scl_free(allocator, new_graph);
 
-        /* Allocation of the graph failed */
         errno = ENOMEM;
-        perror("Not enough memory to allocate new graph object");
+        perror("Not enough memory to allocate vertices of the graph");
+        return NULL;
     }
 
-    /* Return a new allocated graph object or `NULL` */
-    return new_graph;
-}
-
-/**
- * @brief Subroutine function of free_graph, to 
- * free all edges of one vertex from heap memory.
- * No graph object is needed just pointer to 
- * linked list representing the edges.
- * 
- * @param link pointer to a linked list representing the edges array
- */
-static void free_graph_link(graph_link_t *link) {
-    /* Free memory occupied by edges of one vertex */
-    while (NULL != link) {
-        graph_link_t *delete_node = link;
-
-        link = link->next;
-
-        free(delete_node);
-        delete_node = NULL;
+    /* Set every vertex to its default value, the reserved chunk holds all of them */
+    for (size_t iter = 0; iter < new_graph->size; ++iter) {
+        new_graph->vertices[iter] = create_graph_vertex(new_graph);
     }
+
+    /* Return a new allocated graph object */
+    return new_graph;
 }
 
 /**
  * @brief Function to free all memory allocated for a graph
  * object from heap memory. Function may fail if graph object
- * is `NULL`, however it will not break the program.
+ * is `NULL`, however it will not break the program. The
+ * vertices and the edges are released by whole chunks.
  * 
  * @param gr pointer to an allocated graph object
  * @return scl_error_t enum object for handling errors
@@ -162,34 +186,19 @@ scl_error_t free_graph(graph_t * const __restrict__ gr) {
     /* Check if graph pointer is valid */
     if (NULL != gr) {
 
-        /* Check if vertices array is allocated */
-        if (NULL != gr->vertices) {
-
-            /* Free memory of all vertices */
-           for (size_t iter = 0; iter < gr->size; ++iter) {
-                if (NULL != gr->vertices[iter]) {
-
-                    /* Free memory for one vertex */
-                    free_graph_link(gr->vertices[iter]->link);
+        /* Free memory of all vertices and edges */
+        free_mem_pool(gr->link_pool);
+        gr->link_pool = NULL;
 
-                    free(gr->vertices[iter]);
-                    gr->vertices[iter] = NULL;
-                }
-            }
-
-            /* Free vertices array */
-            free(gr->vertices);
-            gr->vertices = NULL;
-        }
+        free_mem_pool(gr->vertex_pool);
+        gr->vertex_pool = NULL;
 
-        /* Free visit array */
-        if (NULL != gr->visit) {
-            free(gr->visit);
-            gr->visit = NULL;
-        }
+        /* Free vertices array */
+        scl_free(gr->allocator, gr->vertices);
+        gr->vertices = NULL;
 
         /* Free graph object */
-        free(gr);
+        scl_free(gr->allocator, gr);
 
         /* All good */
         return SCL_OK;
@@ -205,24 +214,26 @@ scl_error_t free_graph(graph_t * const __restrict__ gr) {
  * or edge length is `__LBDL_MAX__` or no heap memory is
  * left for memory allocation.
  * 
+ * @param gr pointer to an allocated graph object
  * @param vertex number of the vertex to link the edge
  * @param edge_len the length of the current edge node
  * @return graph_link_t* a new allocated edge node object or `NULL`
  * if function fails
  */
-static graph_link_t* create_graph_link(size_t vertex, long double edge_len) {
+static graph_link_t* create_graph_link(const graph_t * const __restrict__ gr, size_t vertex, graph_weight_t edge_len) {
     /* Check if input data is valid */
-    if ((SIZE_MAX == vertex) || (__LDBL_MAX__ == edge_len)) {
+    if ((SIZE_MAX == vertex) || (GRAPH_WEIGHT_MAX == edge_len)) {
         errno = EINVAL;
         perror("Data input for link creation is invalid");
         return NULL;
     }
 
-    /* Allocate a new edge node */
-    graph_link_t *new_link = malloc(sizeof(*new_link));
+    /* Take a new edge node from the edges memory pool */
+    graph_link_t *new_link = mem_pool_alloc(gr->link_pool);
 
     /* Check if edge was allocated */
     if (NULL != new_link) {
+        SCL_STATS_ADD(gr, allocations, 1);
 
         /* Set edge object data */
         new_link->vertex = vertex;
@@ -239,6 +250,38 @@ static graph_link_t* create_graph_link(size_t vertex, long double edge_len) {
     return new_link;
 }
 
+/**
+ * @brief Subroutine function to unlink and free from a linked list of
+ * edges the first count edges that link the selected vertex, in one pass.
+ * 
+ * Function MUST not be used outside this file.
+ * 
+ * @param gr pointer to an allocated graph object
+ * @param head pointer to the first edge of the linked list
+ * @param vertex number of the vertex that the edges link
+ * @param count maximum number of edges to remove (SIZE_MAX for all of them)
+ * @return size_t number of removed edges
+ */
+static size_t graph_remove_links(const graph_t * const __restrict__ gr, graph_link_t ** const __restrict__ head, size_t vertex, size_t count) {
+    size_t removed = 0;
+    graph_link_t **link = head;
+
+    while ((NULL != *link) && (removed < count)) {
+        if (vertex == (*link)->vertex) {
+            graph_link_t *delete_link = *link;
+
+            *link = delete_link->next;
+            mem_pool_free(gr->link_pool, delete_link);
+            ++removed;
+        } else {
+            link = &(*link)->next;
+        }
+    }
+
+    /* Return number of removed edges */
+    return removed;
+}
+
 /**
  * @brief Function to insert one edge into the graph object or to link
  * two vertices with one edge. Function may fail if input graph object is
@@ -250,7 +293,7 @@ static graph_link_t* create_graph_link(size_t vertex, long double edge_len) {
  * @param edge_len the length of the edge that links two vertices
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t graph_insert_edge(const graph_t * const __restrict__ gr, size_t start_vertex, size_t end_vertex, long double edge_len) {
+scl_error_t graph_insert_edge(const graph_t * const __restrict__ gr, size_t start_vertex, size_t end_vertex, graph_weight_t edge_len) {
     /* Check if graph object is valid */
     if (NULL == gr) {
         return SCL_NULL_GRAPH;
@@ -272,18 +315,31 @@ scl_error_t graph_insert_edge(const graph_t * const __restrict__ gr, size_t star
     }
 
     /* Check if edge length is valid */
-    if (__LDBL_MAX__ == edge_len) {
+    if (GRAPH_WEIGHT_MAX == edge_len) {
         return SCL_INVALID_EDGE_LENGTH;
     }
 
     /* Create a new link between two vertices */
-    graph_link_t *new_vertex = create_graph_link(end_vertex, edge_len);
+    graph_link_t *new_vertex = create_graph_link(gr, end_vertex, edge_len);
 
     /* Check if allocation went successfully */
     if (NULL == new_vertex) {
         return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
     }
 
+    /* Link the in edge to end_vertex linked list of in edges */
+    if (0 != gr->has_in_edges) {
+        graph_link_t *new_in_link = create_graph_link(gr, start_vertex, edge_len);
+
+        if (NULL == new_in_link) {
+            mem_pool_free(gr->link_pool, new_vertex);
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        new_in_link->next = gr->vertices[end_vertex]->in_link;
+        gr->vertices[end_vertex]->in_link = new_in_link;
+    }
+
     /* Link edge to start_vertex linked list */
     new_vertex->next = gr->vertices[start_vertex]->link;
     gr->vertices[start_vertex]->link = new_vertex;
@@ -316,169 +372,127 @@ scl_error_t graph_insert_vertices(graph_t * const __restrict__ gr, size_t new_ve
     }
 
     /* Check if new_vertices will add nodes on graph */
-    if (0 == new_vertices) {
+    if ((0 == new_vertices) || (new_vertices > GRAPH_VERTEX_ID_MAX - gr->size)) {
         return SCL_GRAPH_INVALID_NEW_VERTICES;
     }
 
-    /* Try to realloc visit array of the graph */
-    uint8_t *try_realloc_visit = realloc(gr->visit, sizeof(*gr->visit) * (gr->size + new_vertices));
-
-    if (NULL == try_realloc_visit) {
-        return SCL_REALLOC_GRAPH_VERTICES_FAIL;
-    }
-
-    gr->visit = try_realloc_visit;
-
-    /* Try to realloc vertices array of the graph */
-    graph_vertex_t **try_realloc = realloc(gr->vertices, sizeof(*try_realloc) * (gr->size + new_vertices));
-
-    if (NULL == try_realloc) {
+    /* Make room for the new vertices in the array and in the vertices memory pool */
+    if ((SCL_OK != graph_grow_vertices(gr, gr->size + new_vertices))
+        || (SCL_OK != mem_pool_reserve(gr->vertex_pool, new_vertices))) {
         return SCL_REALLOC_GRAPH_VERTICES_FAIL;
     }
 
     /* Allocate the new created vertices and set default values */
     for (size_t iter = gr->size; iter < gr->size + new_vertices; ++iter) {
-        try_realloc[iter] = malloc(sizeof(*try_realloc[iter]));
-
-        if (NULL != try_realloc[iter]) {
-            try_realloc[iter]->link = NULL;
-            try_realloc[iter]->in_deg = 0;
-            try_realloc[iter]->out_deg = 0;
-        } else {
-            for (size_t del_iter = gr->size; del_iter <= iter; ++del_iter) {
-                free(try_realloc[del_iter]);
-                try_realloc[del_iter] = NULL;
-            }
-
-            return SCL_REALLOC_GRAPH_VERTICES_FAIL;
-        }
+        gr->vertices[iter] = create_graph_vertex(gr);
     }
 
     /* If adding new vertices went successfully update size */
     gr->size += new_vertices;
 
-    gr->vertices = try_realloc;
-
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Create the transpose graph of the selected graph. The object
- * graph sent as input has to be a valid object. Function may fail if no memory
- * is left on heap to allcoate the new transposed graph.
+ * @brief Function to insert many edges into the graph object at once, the
+ * edge iter links start_vertices[iter] to end_vertices[iter]. The result is
+ * the same as calling graph_insert_edge for every edge in order, however all
+ * the edges are checked before the first one is inserted (so on failure the
+ * graph is not changed) and their memory is taken with at most one call to
+ * the allocator.
  * 
  * @param gr a pointer to an allocated graph object
- * @return graph_t* allocated transposed graph of selected object or `NULL`
+ * @param start_vertices array of vertices that the edges start from
+ * @param end_vertices array of vertices that the edges end to
+ * @param edge_lens array of the lengths of the edges, `NULL` for edges of length 1
+ * @param number_of_edges number of edges to insert
+ * @return scl_error_t enum object for handling errors
  */
-graph_t* create_transpose_graph(const graph_t * const __restrict__ gr) {
-    /* Check if the graph object is valid */
-    if ((NULL == gr) || (0 == gr->size) || (NULL == gr->vertices)) {
-        errno = EINVAL;
-        perror("Graph sent as input in transpose function is not valid");
-
-        return NULL;
+scl_error_t graph_insert_edges_bulk(const graph_t * const __restrict__ gr, const size_t * __restrict__ start_vertices, const size_t * __restrict__ end_vertices, const graph_weight_t * __restrict__ edge_lens, size_t number_of_edges) {
+    /* Check if graph object is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
     }
 
-    /* Create a new graph */
-    graph_t *transpose_gr = create_graph(gr->size);
+    /* Check if vertices array is valid */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
 
-    /* Check if transposed graph was created */
-    if (NULL == transpose_gr) {
-        return NULL;
+    /* Check if there is something to insert */
+    if (0 == number_of_edges) {
+        return SCL_OK;
     }
 
-    scl_error_t err = SCL_OK;
+    /* Check if edges arrays are valid */
+    if ((NULL == start_vertices) || (NULL == end_vertices)) {
+        return SCL_INVALID_INPUT;
+    }
 
-    /* Invert every edges from original graph into transposed graph */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        if (NULL == gr->vertices[iter]) {
-            return NULL;
+    /* Check every edge before changing the graph */
+    for (size_t iter = 0; iter < number_of_edges; ++iter) {
+        if ((gr->size <= start_vertices[iter]) || (gr->size <= end_vertices[iter])) {
+            return SCL_VERTEX_OUT_OF_BOUND;
         }
 
-        graph_link_t *link = gr->vertices[iter]->link;
-
-        while (NULL != link) {
-            err = graph_insert_edge(transpose_gr, link->vertex, iter, link->edge_len);
-
-            if (SCL_OK != err) {
-                return NULL;
-            }
+        if ((NULL == gr->vertices[start_vertices[iter]]) || (NULL == gr->vertices[end_vertices[iter]])) {
+            return SCL_NULL_GRAPH_VERTEX;
+        }
 
-            link = link->next;
+        if ((NULL != edge_lens) && (GRAPH_WEIGHT_MAX == edge_lens[iter])) {
+            return SCL_INVALID_EDGE_LENGTH;
         }
     }
 
-    /* Return an allocated transposed graph */
-    return transpose_gr;
-}
-
-/**
- * @brief Function to print the vertices of the graph and their edges with
- * other vertices. Function may fail if one vertex os not allcoated or graph
- * object is not valid.
- * 
- * @param gr a pointer to an allocated graph object.
- * @param data_arr array of words to print the mapping of the vertices can be `NULL`
- * @return scl_error_t enum object for handling errors
- */
-scl_error_t graph_print(const graph_t * const __restrict__ gr, const uint8_t ** const data_arr) {
-    /* Check if graph pointer is valid */
-    if (NULL == gr) {
-        return SCL_NULL_GRAPH;
-    }
+    /* Take the memory of all the edges at once */
+    scl_error_t err = graph_reserve_edges(gr, number_of_edges);
 
-    /* Check if vertices array is allocated */
-    if (NULL == gr->vertices) {
-        return SCL_NULL_GRAPH_VERTICES;
+    if (SCL_OK != err) {
+        return err;
     }
 
-    /* Print vertices of the graph and their edges */
-    if (0 == gr->size) {
-        printf("[ ]\n");
-    } else {
-        for (size_t iter = 0; iter < gr->size; ++iter) {
-            if (NULL == gr->vertices[iter]) {
-                return SCL_NULL_GRAPH_VERTEX;
-            }
+    /* Link every edge in front of its start vertex linked list */
+    for (size_t iter = 0; iter < number_of_edges; ++iter) {
+        graph_vertex_t * const start = gr->vertices[start_vertices[iter]];
+        graph_link_t *new_link = mem_pool_alloc(gr->link_pool);
 
-            if (NULL != data_arr) {
-                printf("(%s) ", data_arr[iter]);
-            } else {
-                printf("(%ld) ", iter);
-            }
-
-            graph_link_t *link = gr->vertices[iter]->link;
+        new_link->vertex = end_vertices[iter];
+        new_link->edge_len = (NULL != edge_lens) ? edge_lens[iter] : 1;
+        new_link->next = start->link;
+        start->link = new_link;
 
-            while (NULL != link) {
-                if (NULL != data_arr) {
-                    printf("-> [%s] ", data_arr[link->vertex]);
-                } else {
-                    printf("-> (%ld) ", link->vertex);
-                }
+        graph_vertex_t * const end = gr->vertices[end_vertices[iter]];
 
-                link = link->next;
-            }
+        if (0 != gr->has_in_edges) {
+            graph_link_t *new_in_link = mem_pool_alloc(gr->link_pool);
 
-            printf(" -> (~)\n");
+            new_in_link->vertex = start_vertices[iter];
+            new_in_link->edge_len = new_link->edge_len;
+            new_in_link->next = end->in_link;
+            end->in_link = new_in_link;
         }
+
+        /* Update in and out degree of the vertices */
+        ++(start->out_deg);
+        ++(end->in_deg);
     }
-    
+
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function to delete one edge that links two vertices.
- * Function may fail if the graph is not valid or selected
- * edge is not in the current graph.
+ * @brief Function to prepare the graph object to hold number_of_vertices
+ * vertices, so the next graph_insert_vertices calls up to that number of
+ * vertices do not reallocate the vertices array. The number of vertices of
+ * the graph is not changed.
  * 
  * @param gr a pointer to an allocated graph object
- * @param first_vertex first vertex that edge starts from
- * @param second_vertex second vertex that edge end to
+ * @param number_of_vertices total number of vertices to have room for
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t graph_delete_edge(const graph_t * const __restrict__ gr, size_t first_vertex, size_t second_vertex) {
+scl_error_t graph_reserve_vertices(graph_t * const __restrict__ gr, size_t number_of_vertices) {
     /* Check if graph pointer is valid */
     if (NULL == gr) {
         return SCL_NULL_GRAPH;
@@ -489,127 +503,376 @@ scl_error_t graph_delete_edge(const graph_t * const __restrict__ gr, size_t firs
         return SCL_NULL_GRAPH_VERTICES;
     }
 
-    /* Check if start vertex is in the current graph */
-    if (first_vertex >= gr->size) {
-        return SCL_VERTEX_OUT_OF_BOUND;
-    }
-
-    /* Check if start vertex is allocated */
-    if (NULL == gr->vertices[first_vertex]) {
-        return SCL_NULL_GRAPH_VERTEX;
-    }
-
-    graph_link_t *delete_link = gr->vertices[first_vertex]->link;
-    graph_link_t *parent_delete_link = NULL;
-
-    /* Find selected edge from graph */
-    while ((NULL != delete_link) & (second_vertex != delete_link->vertex)) {
-        parent_delete_link = delete_link;
-        delete_link = delete_link->next;
+    /* Check if every vertex number fits in the edges */
+    if (number_of_vertices > GRAPH_VERTEX_ID_MAX) {
+        return SCL_GRAPH_INVALID_NEW_VERTICES;
     }
 
-    /* Edge was not found in the graph */
-    if (NULL == delete_link) {
-        return SCL_EDGE_NOT_FOUND;
+    /* Graph already holds enough vertices */
+    if (number_of_vertices <= gr->size) {
+        return SCL_OK;
     }
 
-    /* Update the linked list */
-    if (NULL == parent_delete_link) {
-        gr->vertices[first_vertex]->link = delete_link->next;
-    } else {
-        parent_delete_link->next = delete_link->next;
+    /* Make room in the array and in the vertices memory pool */
+    if ((SCL_OK != graph_grow_vertices(gr, number_of_vertices))
+        || (SCL_OK != mem_pool_reserve(gr->vertex_pool, number_of_vertices - gr->size))) {
+        return SCL_REALLOC_GRAPH_VERTICES_FAIL;
     }
 
-    /* Delete edge from memory */
-    delete_link->next = NULL;
-    free(delete_link);
-    delete_link = NULL;
-
-    /* Update the out degree of the start vertex */
-    --(gr->vertices[first_vertex]->out_deg);
-
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function to delete all edges that link the same two nodes.
- * This function is a bigger brother of the graph_delete_edge, however
- * an oriented graph can have more than two edges that link the same
- * two vertices so the function will delete all these edges.
+ * @brief Function to prepare the graph object to take number_of_edges new
+ * edges, so the next edge insertions up to that number of edges do not call
+ * the allocator. The memory is taken as one chunk of the edges memory pool
+ * (twice the edges if the in edges are indexed).
  * 
  * @param gr a pointer to an allocated graph object
- * @param first_vertex first vertex that edge starts from
- * @param second_vertex second vertex that edge end to
- * @return scl_error_t enum object for handling errors 
+ * @param number_of_edges number of edges to have room for
+ * @return scl_error_t enum object for handling errors
  */
-scl_error_t graph_delete_all_edges(const graph_t * const __restrict__ gr, size_t first_vertex, size_t second_vertex) {
+scl_error_t graph_reserve_edges(const graph_t * const __restrict__ gr, size_t number_of_edges) {
     /* Check if graph pointer is valid */
     if (NULL == gr) {
         return SCL_NULL_GRAPH;
     }
 
-    /* Check if vertices array is allocated */
-    if (NULL == gr->vertices) {
-        return SCL_NULL_GRAPH_VERTICES;
+    /* Indexed in edges take one more link for every edge */
+    if (0 != gr->has_in_edges) {
+        if (number_of_edges > SIZE_MAX / 2) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        number_of_edges *= 2;
     }
 
-    /* Check if start vertex is in the current graph */
-    if (first_vertex >= gr->size) {
-        return SCL_VERTEX_OUT_OF_BOUND;
+    /* Take one chunk for all the edges */
+    if (SCL_OK != mem_pool_reserve(gr->link_pool, number_of_edges)) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
     }
 
-    /* Check if start vertex is allocated */
-    if (NULL == gr->vertices[first_vertex]) {
-        return SCL_NULL_GRAPH_VERTEX;
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Subroutine function to create a graph object with the same
+ * vertices as the selected graph, the deleted vertices of the graph are
+ * deleted in the new graph as well. The new graph has no edges.
+ * 
+ * Function MUST not be used outside this file.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return graph_t* a new allocated graph object or `NULL` if function fails
+ */
+static graph_t* create_graph_like(const graph_t * const __restrict__ gr) {
+    /* Check if the graph object is valid */
+    if ((NULL == gr) || (0 == gr->size) || (NULL == gr->vertices)) {
+        errno = EINVAL;
+        perror("Graph sent as input to be copied is not valid");
+
+        return NULL;
     }
 
-    graph_link_t *delete_link = gr->vertices[first_vertex]->link;
-    graph_link_t *parent_delete_link = NULL;
+    /* Create a new graph */
+    graph_t *new_gr = create_graph(gr->size);
 
-    /* Find every occurence of the selected edge and remove them from graph */
-    while (NULL != delete_link) {
-        if (second_vertex == delete_link->vertex) {
-            if (NULL == parent_delete_link) {
-                gr->vertices[first_vertex]->link = delete_link->next;
+    /* Check if new graph was created */
+    if (NULL == new_gr) {
+        return NULL;
+    }
 
-                delete_link->next = NULL;
-                free(delete_link);
-                
-                delete_link = gr->vertices[first_vertex]->link;
-            } else {
-                parent_delete_link->next = delete_link->next;
+    /* Deleted vertices stay deleted in the new graph */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL == gr->vertices[iter]) {
+            mem_pool_free(new_gr->vertex_pool, new_gr->vertices[iter]);
+            new_gr->vertices[iter] = NULL;
+            ++(new_gr->tombstones);
+        }
+    }
 
-                delete_link->next = NULL;
-                free(delete_link);
+    /* Return the new graph */
+    return new_gr;
+}
 
-                delete_link = parent_delete_link->next;
+/**
+ * @brief Subroutine function to copy a linked list of edges into
+ * consecutive links of an array, in the same order.
+ * 
+ * Function MUST not be used outside this file.
+ * 
+ * @param link first edge of the linked list to copy
+ * @param links array of links to copy the edges into
+ * @param position index of the first free link of the array, updated
+ * @return graph_link_t* first edge of the copied linked list
+ */
+static graph_link_t* graph_copy_links(const graph_link_t * __restrict__ link, graph_link_t * const __restrict__ links, size_t * const __restrict__ position) {
+    graph_link_t *head = NULL;
+    graph_link_t **tail = &head;
+
+    while (NULL != link) {
+        graph_link_t * const new_link = &links[*position];
+
+        ++(*position);
+
+        new_link->vertex = link->vertex;
+        new_link->edge_len = link->edge_len;
+
+        *tail = new_link;
+        tail = &new_link->next;
+
+        link = link->next;
+    }
+
+    *tail = NULL;
+
+    return head;
+}
+
+/**
+ * @brief Create a copy of the selected graph object, with the same
+ * vertices (deleted ones included), the same edges in the same order and
+ * the in edges index if the graph keeps one. All the edges are taken as one
+ * array of the edges memory pool and the edges of every vertex are
+ * consecutive in it, so the copy is made in O(V + E) with O(1) allocations
+ * and it is traversed faster than a graph built edge by edge. Function may
+ * fail if no memory is left on heap.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return graph_t* allocated copy of selected object or `NULL`
+ */
+graph_t* graph_clone(const graph_t * const __restrict__ gr) {
+    /* Create a graph with the same vertices */
+    graph_t *clone_gr = create_graph_like(gr);
+
+    /* Check if clone graph was created */
+    if (NULL == clone_gr) {
+        return NULL;
+    }
+
+    clone_gr->has_in_edges = gr->has_in_edges;
+
+    /* Count all the links of the graph */
+    size_t number_of_links = 0;
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            number_of_links += gr->vertices[iter]->out_deg;
+
+            if (0 != gr->has_in_edges) {
+                number_of_links += gr->vertices[iter]->in_deg;
             }
+        }
+    }
 
-            --(gr->vertices[first_vertex]->out_deg);
-        } else {
-            parent_delete_link = delete_link;
-            delete_link = delete_link->next;
+    /* Take the memory of all the links at once */
+    graph_link_t *links = NULL;
+
+    if (0 != number_of_links) {
+        links = mem_pool_alloc_array(clone_gr->link_pool, number_of_links);
+
+        if (NULL == links) {
+            free_graph(clone_gr);
+            return NULL;
+        }
+
+        SCL_STATS_ADD(clone_gr, allocations, number_of_links);
+    }
+
+    size_t position = 0;
+
+    /* Copy the edges of every vertex next to each other */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        const graph_vertex_t * const vertex = gr->vertices[iter];
+
+        if (NULL == vertex) {
+            continue;
+        }
+
+        graph_vertex_t * const clone_vertex = clone_gr->vertices[iter];
+
+        clone_vertex->link = graph_copy_links(vertex->link, links, &position);
+        clone_vertex->in_link = graph_copy_links(vertex->in_link, links, &position);
+        clone_vertex->in_deg = vertex->in_deg;
+        clone_vertex->out_deg = vertex->out_deg;
+    }
+
+    /* Return an allocated copy of the graph */
+    return clone_gr;
+}
+
+/**
+ * @brief Create the transpose graph of the selected graph. The object
+ * graph sent as input has to be a valid object. The edges are placed by
+ * counting sort: the prefix sums of the in degrees of the vertices give
+ * where the inverted edges of every vertex start in one array of links
+ * taken from the edges memory pool. So the transpose is built in O(V + E) with O(1)
+ * allocations and the edges of every vertex are consecutive in memory. The
+ * edges of every vertex are in the order graph_insert_edge would give.
+ * A transposed graph kept next to the graph (for graph_shortest_path) stays
+ * valid while the graph does not change. Function may fail if no memory
+ * is left on heap to allcoate the new transposed graph.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return graph_t* allocated transposed graph of selected object or `NULL`
+ */
+graph_t* create_transpose_graph(const graph_t * const __restrict__ gr) {
+    /* Create a graph with the same vertices */
+    graph_t *transpose_gr = create_graph_like(gr);
+
+    /* Check if transposed graph was created */
+    if (NULL == transpose_gr) {
+        return NULL;
+    }
+
+    /* First inverted edge of every vertex, the last element is the number of edges */
+    size_t *offsets = scl_malloc(transpose_gr->allocator, sizeof(*offsets) * (gr->size + 1));
+
+    if (NULL == offsets) {
+        free_graph(transpose_gr);
+
+        errno = ENOMEM;
+        perror("Not enough memory to transpose the graph");
+        return NULL;
+    }
+
+    /* Every offset becomes the end of the inverted edges of its vertex, the vertices count their in edges */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        const size_t in_deg = (NULL != gr->vertices[iter]) ? gr->vertices[iter]->in_deg : 0;
+
+        offsets[iter] = (0 == iter) ? in_deg : offsets[iter - 1] + in_deg;
+    }
+
+    const size_t number_of_edges = offsets[gr->size - 1];
+
+    offsets[gr->size] = number_of_edges;
+
+    /* Take the memory of all the inverted edges at once */
+    graph_link_t *links = NULL;
+
+    if (0 != number_of_edges) {
+        links = mem_pool_alloc_array(transpose_gr->link_pool, number_of_edges);
+
+        if (NULL == links) {
+            scl_free(transpose_gr->allocator, offsets);
+            free_graph(transpose_gr);
+
+            return NULL;
+        }
+
+        SCL_STATS_ADD(transpose_gr, allocations, number_of_edges);
+    }
+
+    /*
+     * Place the inverted edges from the end of every vertex, so the last
+     * inverted edge is the first of its vertex and every offset becomes
+     * the start of the inverted edges of its vertex
+     */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+                graph_link_t * const new_link = &links[--(offsets[link->vertex])];
+
+                new_link->vertex = iter;
+                new_link->edge_len = link->edge_len;
+            }
+        }
+    }
+
+    /* Link the consecutive inverted edges of every vertex */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        graph_vertex_t * const vertex = transpose_gr->vertices[iter];
+
+        if (NULL == vertex) {
+            continue;
         }
+
+        const size_t first_edge = offsets[iter];
+        const size_t end_edge = offsets[iter + 1];
+
+        for (size_t edge = first_edge; edge < end_edge; ++edge) {
+            links[edge].next = (edge + 1 < end_edge) ? &links[edge + 1] : NULL;
+        }
+
+        vertex->link = (first_edge < end_edge) ? &links[first_edge] : NULL;
+        vertex->out_deg = end_edge - first_edge;
+        vertex->in_deg = gr->vertices[iter]->out_deg;
+    }
+
+    scl_free(transpose_gr->allocator, offsets);
+
+    /* Return an allocated transposed graph */
+    return transpose_gr;
+}
+
+/**
+ * @brief Function to print the vertices of the graph and their edges with
+ * other vertices, the deleted vertices are skipped. Function may fail if
+ * graph object is not valid.
+ * 
+ * @param gr a pointer to an allocated graph object.
+ * @param data_arr array of words to print the mapping of the vertices can be `NULL`
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_print(const graph_t * const __restrict__ gr, const uint8_t ** const data_arr) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
     }
 
+    /* Print vertices of the graph and their edges */
+    if (0 == gr->size) {
+        printf("[ ]\n");
+    } else {
+        for (size_t iter = 0; iter < gr->size; ++iter) {
+            if (NULL == gr->vertices[iter]) {
+                continue;
+            }
+
+            if (NULL != data_arr) {
+                printf("(%s) ", data_arr[iter]);
+            } else {
+                printf("(%ld) ", iter);
+            }
+
+            graph_link_t *link = gr->vertices[iter]->link;
+
+            while (NULL != link) {
+                if (NULL != data_arr) {
+                    printf("-> [%s] ", data_arr[link->vertex]);
+                } else {
+                    printf("-> (%zu) ", (size_t)link->vertex);
+                }
+
+                link = link->next;
+            }
+
+            printf(" -> (~)\n");
+        }
+    }
+    
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function to delete a selected vertex from the current
- * graph object. Vertices greater than selected vertex will 
- * deacrease their number by one so vertex `3` maps into the
- * vertex `2` and vertex `2` becomes `1` if vertex 1 was deleted.
- * When vertex is deleted all of its in and out edges will be removed
- * from the current working graph object.
+ * @brief Function to delete one edge that links two vertices.
+ * Function may fail if the graph is not valid or selected
+ * edge is not in the current graph.
  * 
  * @param gr a pointer to an allocated graph object
- * @param vertex selected vertex number to delet from graph
+ * @param first_vertex first vertex that edge starts from
+ * @param second_vertex second vertex that edge end to
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t graph_delete_vertex(graph_t * const __restrict__ gr, size_t vertex) {
+scl_error_t graph_delete_edge(const graph_t * const __restrict__ gr, size_t first_vertex, size_t second_vertex) {
     /* Check if graph pointer is valid */
     if (NULL == gr) {
         return SCL_NULL_GRAPH;
@@ -620,641 +883,5123 @@ scl_error_t graph_delete_vertex(graph_t * const __restrict__ gr, size_t vertex)
         return SCL_NULL_GRAPH_VERTICES;
     }
 
-    /* Check if selected vertex is from current graph */
-    if (vertex >= gr->size) {
+    /* Check if start vertex is in the current graph */
+    if (first_vertex >= gr->size) {
         return SCL_VERTEX_OUT_OF_BOUND;
     }
 
-    /* Check if selected vertex is allocated and can be removed */
-    if (NULL == gr->vertices[vertex]) {
+    /* Check if start vertex is allocated */
+    if (NULL == gr->vertices[first_vertex]) {
         return SCL_NULL_GRAPH_VERTEX;
     }
 
-    scl_error_t err = SCL_OK;
+    graph_link_t *delete_link = gr->vertices[first_vertex]->link;
+    graph_link_t *parent_delete_link = NULL;
 
-    /* Delete IN edges from the graph */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        if (iter != vertex) {
-            err = graph_delete_all_edges(gr, iter, vertex);
+    /* Find selected edge from graph */
+    while ((NULL != delete_link) && (second_vertex != delete_link->vertex)) {
+        parent_delete_link = delete_link;
+        delete_link = delete_link->next;
+    }
 
-            if (SCL_OK != err) {
-                return err;
-            }
-        }
+    /* Edge was not found in the graph */
+    if (NULL == delete_link) {
+        return SCL_EDGE_NOT_FOUND;
     }
 
-    /* Delete OUT edges of the selected vertex */
-    free_graph_link(gr->vertices[vertex]->link);
-    gr->vertices[vertex]->in_deg = gr->vertices[vertex]->out_deg = 0;
+    /* Update the linked list */
+    if (NULL == parent_delete_link) {
+        gr->vertices[first_vertex]->link = delete_link->next;
+    } else {
+        parent_delete_link->next = delete_link->next;
+    }
 
-    /* Free memory allocated for vertex */
-    free(gr->vertices[vertex]);
-    gr->vertices[vertex] = NULL;
+    graph_vertex_t * const end = gr->vertices[delete_link->vertex];
 
-    --(gr->size);
+    /* Delete edge from memory */
+    delete_link->next = NULL;
+    mem_pool_free(gr->link_pool, delete_link);
+    delete_link = NULL;
 
-    /* Try to realloc memory to reduce memory space */
-    for (size_t iter = vertex; iter < gr->size; ++iter) {
-        gr->vertices[iter] = gr->vertices[iter + 1];
+    /* Update the out degree of the start vertex and the in degree of the end vertex */
+    --(gr->vertices[first_vertex]->out_deg);
+    --(end->in_deg);
+
+    if (0 != gr->has_in_edges) {
+        graph_remove_links(gr, &end->in_link, first_vertex, 1);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to delete all edges that link the same two nodes.
+ * This function is a bigger brother of the graph_delete_edge, however
+ * an oriented graph can have more than two edges that link the same
+ * two vertices so the function will delete all these edges.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param first_vertex first vertex that edge starts from
+ * @param second_vertex second vertex that edge end to
+ * @return scl_error_t enum object for handling errors 
+ */
+scl_error_t graph_delete_all_edges(const graph_t * const __restrict__ gr, size_t first_vertex, size_t second_vertex) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if start vertex is in the current graph */
+    if (first_vertex >= gr->size) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    /* Check if start vertex is allocated */
+    if (NULL == gr->vertices[first_vertex]) {
+        return SCL_NULL_GRAPH_VERTEX;
+    }
+
+    graph_link_t *delete_link = gr->vertices[first_vertex]->link;
+    graph_link_t *parent_delete_link = NULL;
+    size_t removed = 0;
+
+    /* Find every occurence of the selected edge and remove them from graph */
+    while (NULL != delete_link) {
+        if (second_vertex == delete_link->vertex) {
+            if (NULL == parent_delete_link) {
+                gr->vertices[first_vertex]->link = delete_link->next;
+
+                delete_link->next = NULL;
+                mem_pool_free(gr->link_pool, delete_link);
+                
+                delete_link = gr->vertices[first_vertex]->link;
+            } else {
+                parent_delete_link->next = delete_link->next;
+
+                delete_link->next = NULL;
+                mem_pool_free(gr->link_pool, delete_link);
+
+                delete_link = parent_delete_link->next;
+            }
+
+            --(gr->vertices[first_vertex]->out_deg);
+            ++removed;
+        } else {
+            parent_delete_link = delete_link;
+            delete_link = delete_link->next;
+        }
+    }
+
+    /* Update the in degree and the in edges of the end vertex */
+    if (0 != removed) {
+        graph_vertex_t * const end = gr->vertices[second_vertex];
+
+        end->in_deg -= removed;
+
+        if (0 != gr->has_in_edges) {
+            graph_remove_links(gr, &end->in_link, first_vertex, removed);
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Subroutine function to remove all in and out edges of one vertex.
+ * If the in edges are indexed just the lists of the neighbour vertices are
+ * touched, otherwise the edges of every vertex are scanned, O(V + E).
+ * 
+ * Function MUST not be used outside this file.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param vertex allocated vertex to unlink from the graph
+ */
+static void graph_unlink_vertex(const graph_t * const __restrict__ gr, size_t vertex) {
+    graph_vertex_t * const current = gr->vertices[vertex];
+
+    /* Delete OUT edges, every end vertex loses one in edge */
+    for (graph_link_t *link = current->link; NULL != link;) {
+        graph_link_t *next_link = link->next;
+        graph_vertex_t * const end = gr->vertices[link->vertex];
+
+        --(end->in_deg);
+
+        if (0 != gr->has_in_edges) {
+            graph_remove_links(gr, &end->in_link, vertex, 1);
+        }
+
+        mem_pool_free(gr->link_pool, link);
+        link = next_link;
+    }
+
+    current->link = NULL;
+    current->out_deg = 0;
+
+    /* Delete IN edges from the graph */
+    if (0 != gr->has_in_edges) {
+        for (graph_link_t *link = current->in_link; NULL != link;) {
+            graph_link_t *next_link = link->next;
+            graph_vertex_t * const start = gr->vertices[link->vertex];
+
+            start->out_deg -= graph_remove_links(gr, &start->link, vertex, 1);
+
+            mem_pool_free(gr->link_pool, link);
+            link = next_link;
+        }
+
+        current->in_link = NULL;
+    } else {
+        for (size_t iter = 0; iter < gr->size; ++iter) {
+            if ((iter != vertex) && (NULL != gr->vertices[iter])) {
+                gr->vertices[iter]->out_deg -= graph_remove_links(gr, &gr->vertices[iter]->link, vertex, SIZE_MAX);
+            }
+        }
+    }
+
+    current->in_deg = 0;
+}
+
+/**
+ * @brief Function to delete a selected vertex from the current
+ * graph object. Vertices greater than selected vertex will 
+ * deacrease their number by one so vertex `3` maps into the
+ * vertex `2` and vertex `2` becomes `1` if vertex 1 was deleted.
+ * When vertex is deleted all of its in and out edges will be removed
+ * from the current working graph object.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param vertex selected vertex number to delet from graph
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_delete_vertex(graph_t * const __restrict__ gr, size_t vertex) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if selected vertex is from current graph */
+    if (vertex >= gr->size) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    /* Check if selected vertex is allocated and can be removed */
+    if (NULL == gr->vertices[vertex]) {
+        return SCL_NULL_GRAPH_VERTEX;
+    }
+
+    /* Delete IN and OUT edges of the selected vertex */
+    graph_unlink_vertex(gr, vertex);
+
+    /* Free memory allocated for vertex */
+    mem_pool_free(gr->vertex_pool, gr->vertices[vertex]);
+    gr->vertices[vertex] = NULL;
+
+    --(gr->size);
+
+    /* Try to realloc memory to reduce memory space */
+    for (size_t iter = vertex; iter < gr->size; ++iter) {
+        gr->vertices[iter] = gr->vertices[iter + 1];
+    }
+
+    graph_vertex_t **try_realloc = scl_realloc(gr->allocator, gr->vertices, sizeof(*try_realloc) * gr->size);
+
+    if (NULL == try_realloc) {
+        return SCL_REALLOC_GRAPH_VERTICES_FAIL;
+    }
+
+    gr->vertices = try_realloc;
+    gr->capacity = gr->size;
+
+    /* If reallocation went successfully update the vertices number */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL == gr->vertices[iter]) {
+            continue;
+        }
+
+        graph_link_t *link = gr->vertices[iter]->link;
+
+        while (NULL != link) {
+            if (link->vertex > vertex) {
+                --(link->vertex);
+            }
+
+            link = link->next;
+        }
+
+        for (link = gr->vertices[iter]->in_link; NULL != link; link = link->next) {
+            if (link->vertex > vertex) {
+                --(link->vertex);
+            }
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to index the in edges of every vertex, from now on every
+ * edge is linked in the list of its start vertex and in the list of in edges
+ * of its end vertex, so graph_tombstone_vertex and graph_delete_vertex remove
+ * the in edges of one vertex in O(in_deg) instead of scanning all the edges.
+ * Every edge takes one more link, the memory of all the in edges is taken
+ * as one chunk.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_index_in_edges(graph_t * const __restrict__ gr) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* In edges are already indexed */
+    if (0 != gr->has_in_edges) {
+        return SCL_OK;
+    }
+
+    size_t number_of_edges = 0;
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            number_of_edges += gr->vertices[iter]->out_deg;
+        }
+    }
+
+    /* Take one chunk for all the in edges */
+    if (SCL_OK != mem_pool_reserve(gr->link_pool, number_of_edges)) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+                graph_vertex_t * const end = gr->vertices[link->vertex];
+                graph_link_t *new_in_link = mem_pool_alloc(gr->link_pool);
+
+                new_in_link->vertex = iter;
+                new_in_link->edge_len = link->edge_len;
+                new_in_link->next = end->in_link;
+                end->in_link = new_in_link;
+            }
+        }
+    }
+
+    gr->has_in_edges = 1;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to delete a selected vertex without renumbering the other
+ * vertices. All the edges of the vertex are removed and its number stays
+ * free (`NULL` in the vertices array) until graph_compact renumbers all the
+ * vertices in one pass, the vertices array is not moved or reallocated.
+ * If the in edges are indexed by graph_index_in_edges just the edge lists of
+ * the vertex and of its neighbours are touched, otherwise all the edges of
+ * the graph are scanned.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param vertex selected vertex number to delete from graph
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_tombstone_vertex(graph_t * const __restrict__ gr, size_t vertex) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if selected vertex is from current graph */
+    if (vertex >= gr->size) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    /* Check if selected vertex is allocated and can be removed */
+    if (NULL == gr->vertices[vertex]) {
+        return SCL_NULL_GRAPH_VERTEX;
+    }
+
+    /* Delete IN and OUT edges of the selected vertex */
+    graph_unlink_vertex(gr, vertex);
+
+    /* Free memory allocated for vertex and leave its number free */
+    mem_pool_free(gr->vertex_pool, gr->vertices[vertex]);
+    gr->vertices[vertex] = NULL;
+
+    ++(gr->tombstones);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove the vertices deleted by graph_tombstone_vertex
+ * and to renumber the other vertices in one pass, O(V + E). The vertices keep
+ * their relative order, as after graph_delete_vertex. The vertices array is
+ * not reallocated, its free capacity is used by the next new vertices.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param new_vertices an array of graph size elements to save the new number
+ * of every old vertex (SIZE_MAX for the deleted ones), can be `NULL`
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_compact(graph_t * const __restrict__ gr, size_t * __restrict__ new_vertices) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Numbers do not change without deleted vertices */
+    if (0 == gr->tombstones) {
+        if (NULL != new_vertices) {
+            for (size_t iter = 0; iter < gr->size; ++iter) {
+                new_vertices[iter] = iter;
+            }
+        }
+
+        return SCL_OK;
+    }
+
+    size_t *new_numbers = new_vertices;
+
+    if (NULL == new_numbers) {
+        new_numbers = scl_malloc(gr->allocator, sizeof(*new_numbers) * gr->size);
+
+        if (NULL == new_numbers) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+    }
+
+    size_t new_size = 0;
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        new_numbers[iter] = (NULL != gr->vertices[iter]) ? new_size++ : SIZE_MAX;
+    }
+
+    /* Rename the edges and move every vertex to its new number */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        graph_vertex_t * const current = gr->vertices[iter];
+
+        if (NULL == current) {
+            continue;
+        }
+
+        for (graph_link_t *link = current->link; NULL != link; link = link->next) {
+            link->vertex = new_numbers[link->vertex];
+        }
+
+        for (graph_link_t *link = current->in_link; NULL != link; link = link->next) {
+            link->vertex = new_numbers[link->vertex];
+        }
+
+        gr->vertices[new_numbers[iter]] = current;
+    }
+
+    if (new_vertices != new_numbers) {
+        scl_free(gr->allocator, new_numbers);
+    }
+
+    gr->size = new_size;
+    gr->tombstones = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the number of vertices from the
+ * selected graph. If pointer to graph object is NULL than
+ * SIZE_MAX will be returned
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return size_t SIZE_MAX or the actual size of the graph
+ */
+size_t get_graph_size(const graph_t * const __restrict__ gr) {
+    if (NULL == gr) {
+        return SIZE_MAX;
+    }
+
+    return gr->size;
+}
+
+/**
+ * @brief Function to get the number of vertices deleted by
+ * graph_tombstone_vertex and not yet removed by graph_compact.
+ * If pointer to graph object is NULL than SIZE_MAX will be returned
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return size_t SIZE_MAX or the number of deleted vertices
+ */
+size_t get_graph_tombstones(const graph_t * const __restrict__ gr) {
+    if (NULL == gr) {
+        return SIZE_MAX;
+    }
+
+    return gr->tombstones;
+}
+
+/**
+ * @brief Function to get the memory footprint of a graph. The payload of
+ * every edge is its end vertex and its length, the rest of the edge objects
+ * and the vertex objects are counted as node bytes. The used part of the
+ * vertices array is counted as array bytes and its free capacity as slack,
+ * as the free objects of the vertex and edge pools.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_memory_usage(const graph_t * const __restrict__ gr, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    scl_memory_usage_t vertex_usage, link_usage;
+
+    scl_error_t err = mem_pool_memory_usage(gr->vertex_pool, &vertex_usage);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    err = mem_pool_memory_usage(gr->link_pool, &link_usage);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    /* Indexed in edges take one more link for every edge */
+    const size_t number_of_edges = link_usage.nodes / ((0 != gr->has_in_edges) ? 2 : 1);
+
+    usage->object_bytes = sizeof(*gr) + vertex_usage.object_bytes + link_usage.object_bytes;
+    usage->payload_bytes = number_of_edges * (sizeof(graph_vertex_id_t) + sizeof(graph_weight_t));
+    usage->node_bytes = vertex_usage.node_bytes + vertex_usage.payload_bytes + link_usage.node_bytes + link_usage.payload_bytes - usage->payload_bytes;
+    usage->array_bytes = gr->size * sizeof(*gr->vertices);
+    usage->slack_bytes = (gr->capacity - gr->size) * sizeof(*gr->vertices) + vertex_usage.slack_bytes + link_usage.slack_bytes;
+    usage->nodes = vertex_usage.nodes + number_of_edges;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the operation counters of a graph, vertex and edge allocations and the distances lowered by the shortest path algorithms.
+ * The counters are kept only when the library is built with SCL_STATS.
+ * 
+ * @param gr an allocated graph object
+ * @param stats pointer to the counters to fill (set to zero without SCL_STATS)
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t graph_get_stats(const graph_t * const __restrict__ gr, scl_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return SCL_STATS_GET(gr, stats);
+}
+
+/**
+ * @brief Function to set the operation counters of a graph to zero.
+ * 
+ * @param gr an allocated graph object
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t graph_reset_stats(graph_t * const __restrict__ gr) {
+    /* Check if input data is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    return SCL_STATS_RESET(gr);
+}
+
+/**
+ * @brief Create a traversal object to run queries on graphs of up to
+ * number_of_vertices vertices, the arrays grow when a bigger graph is traversed.
+ * Every thread that queries a graph MUST use its own traversal object.
+ * 
+ * @param number_of_vertices initial number of vertices of the traversal object
+ * @return graph_traversal_t* a new allocated traversal object or `NULL` if function fails
+ */
+graph_traversal_t* create_graph_traversal(size_t number_of_vertices) {
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new traversal object */
+    graph_traversal_t *new_traversal = scl_malloc(allocator, sizeof(*new_traversal));
+
+    /* Check if traversal object was allocated successfully */
+    if (NULL == new_traversal) {
+        errno = ENOMEM;
+        perror("Not enough memory to allocate new graph traversal object");
+        return NULL;
+    }
+
+    new_traversal->allocator = allocator;
+    new_traversal->marks = NULL;
+    new_traversal->frontier = NULL;
+    new_traversal->capacity = 0;
+    new_traversal->generation = 0;
+
+    if (number_of_vertices > 0) {
+        new_traversal->marks = scl_calloc(allocator, number_of_vertices, sizeof(*new_traversal->marks));
+        new_traversal->frontier = scl_malloc(allocator, sizeof(*new_traversal->frontier) * number_of_vertices);
+
+        if ((NULL == new_traversal->marks) || (NULL == new_traversal->frontier)) {
+            scl_free(allocator, new_traversal->marks);
+            scl_free(allocator, new_traversal->frontier);
+            scl_free(allocator, new_traversal);
+
+            errno = ENOMEM;
+            perror("Not enough memory to allocate visit marks of the graph traversal");
+            return NULL;
+        }
+
+        new_traversal->capacity = number_of_vertices;
+    }
+
+    /* Return a new allocated traversal object */
+    return new_traversal;
+}
+
+/**
+ * @brief Function to free all memory allocated for a traversal object.
+ * 
+ * @param trav pointer to an allocated traversal object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_graph_traversal(graph_traversal_t * const __restrict__ trav) {
+    /* Check if traversal object is valid */
+    if (NULL == trav) {
+        return SCL_NULL_GRAPH_TRAVERSAL;
+    }
+
+    scl_free(trav->allocator, trav->marks);
+    scl_free(trav->allocator, trav->frontier);
+    scl_free(trav->allocator, trav);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a new query with a traversal object. The arrays
+ * grow when the graph has more vertices than the traversal object and then
+ * all vertices become unvisited by increasing the generation, the marks are
+ * cleared just when the generation wraps around.
+ * 
+ * @param trav pointer to an allocated traversal object
+ * @param number_of_vertices number of vertices of the traversed graph
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_traversal_begin(graph_traversal_t * const __restrict__ trav, size_t number_of_vertices) {
+    if (number_of_vertices > trav->capacity) {
+        uint32_t *try_realloc_marks = scl_realloc(trav->allocator, trav->marks, sizeof(*try_realloc_marks) * number_of_vertices);
+
+        if (NULL == try_realloc_marks) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        trav->marks = try_realloc_marks;
+
+        /* New vertices have never been visited */
+        memset(trav->marks + trav->capacity, 0, sizeof(*trav->marks) * (number_of_vertices - trav->capacity));
+
+        size_t *try_realloc_frontier = scl_realloc(trav->allocator, trav->frontier, sizeof(*try_realloc_frontier) * number_of_vertices);
+
+        if (NULL == try_realloc_frontier) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        trav->frontier = try_realloc_frontier;
+        trav->capacity = number_of_vertices;
+    }
+
+    /* Every mark is older than the new generation, except after a wrap around */
+    if (UINT32_MAX == trav->generation) {
+        memset(trav->marks, 0, sizeof(*trav->marks) * trav->capacity);
+        trav->generation = 0;
+    }
+
+    ++(trav->generation);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if a vertex was visited by the current query.
+ * 
+ * @param trav pointer to a started traversal object
+ * @param vertex vertex to check
+ * @return uint8_t 1 if the vertex was visited or 0 otherwise
+ */
+static inline uint8_t graph_traversal_visited(const graph_traversal_t * const __restrict__ trav, size_t vertex) {
+    return (trav->generation == trav->marks[vertex]);
+}
+
+/**
+ * @brief Function to mark a vertex as visited by the current query.
+ * 
+ * @param trav pointer to a started traversal object
+ * @param vertex vertex to mark
+ */
+static inline void graph_traversal_visit(graph_traversal_t * const __restrict__ trav, size_t vertex) {
+    trav->marks[vertex] = trav->generation;
+}
+
+/**
+ * @brief Subroutine function of the breath-first-search traversals. The
+ * queue of the traversal is the frontier array of the traversal object,
+ * every vertex is pushed at most once so it never overflows.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param trav pointer to a started traversal object
+ * @param start_vertex a vertex to start the bfs
+ * @param vertex_path an array to save the path of bfs traversal can be `NULL`
+ * @param skip_start 1 if the start vertex is not saved in the path or 0 otherwise
+ * @return size_t size of the saved vertices
+ */
+static size_t graph_bfs_traverse_helper(const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path, uint8_t skip_start) {
+    size_t traversed_vex = 0;
+    size_t queue_front = 0;
+    size_t queue_back = 0;
+
+    /* Start the breath-first-search from the start vertex */
+    graph_traversal_visit(trav, start_vertex);
+    trav->frontier[queue_back++] = start_vertex;
+
+    while (queue_front < queue_back) {
+        const size_t front_vertex = trav->frontier[queue_front++];
+
+        if ((0 == skip_start) || (start_vertex != front_vertex)) {
+            if (NULL != vertex_path) {
+
+                /* Insted of adding in path variable you can perform an action */
+                vertex_path[traversed_vex] = front_vertex;
+            }
+
+            /* Increase traversed vertices size */
+            ++traversed_vex;
+        }
+
+        for (const graph_link_t *link = gr->vertices[front_vertex]->link; NULL != link; link = link->next) {
+            if (0 == graph_traversal_visited(trav, link->vertex)) {
+                graph_traversal_visit(trav, link->vertex);
+                trav->frontier[queue_back++] = link->vertex;
+            }
+        }
+    }
+
+    return traversed_vex;
+}
+
+/**
+ * @brief Function to traverse the vertices of the graph object by
+ * breath-first-search method, the visited vertices are marked in a
+ * caller owned traversal object, so the graph is not modified and many
+ * threads can traverse it at once, each one with its own traversal object.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param trav pointer to an allocated traversal object
+ * @param start_vertex a vertex to start the bfs
+ * @param vertex_path an array to save the path of bfs traversal can be `NULL`
+ * @return size_t size of the traversed vertices or 0 if function failed
+ */
+size_t graph_bfs_traverse_ctx(const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valids */
+    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == trav) || (start_vertex >= gr->size) || (NULL == gr->vertices[start_vertex])) {
+        return 0;
+    }
+
+    if (SCL_OK != graph_traversal_begin(trav, gr->size)) {
+        return 0;
+    }
+
+    /* Return the traversed vertices size */
+    return graph_bfs_traverse_helper(gr, trav, start_vertex, vertex_path, 0);
+}
+
+/**
+ * @brief Function to traverse the vertices of the graph object by
+ * breath-first-search method. Function will get as input an allocated
+ * array to save the path of bfs, if the array is `NULL` then the path
+ * will not be saved however function will return the exact size of the
+ * traversed vertices in this bfs call. A traversal object is allocated
+ * for the call, use **graph_bfs_traverse_ctx** to reuse one.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param start_vertex a vertex to start the bfs
+ * @param vertex_path an array to save the path of bfs traversal can be `NULL`
+ * @return size_t size of the traversed vertices or 0 if function failed
+ */
+size_t graph_bfs_traverse(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valids */
+    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size)) {
+        return 0;
+    }
+
+    graph_traversal_t *trav = create_graph_traversal(gr->size);
+
+    size_t traversed_vex = graph_bfs_traverse_ctx(gr, trav, start_vertex, vertex_path);
+
+    free_graph_traversal(trav);
+
+    /* Return the traversed vertices size */
+    return traversed_vex;
+}
+
+/**
+ * @brief Subroutine function for graph_dfs_traversal to 
+ * calculate recursively the depth-first-search vertices.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param trav pointer to a started traversal object
+ * @param start_vertex number of vertex to start the dfs traversal
+ * @param vertex_path an array to save dfs path can be `NULL`
+ * @param traversed_vex size of the traversed vertices in the dfs call
+ */
+static void graph_dfs_traverse_helper(const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path, size_t * __restrict__ traversed_vex) {
+    /* Visit the current vertex */
+    graph_traversal_visit(trav, start_vertex);
+
+    /* Insert vertex into the path */
+    if (NULL != vertex_path) {
+       vertex_path[*traversed_vex] = start_vertex; 
+    }
+    
+    /* Increase traversed size */
+    ++(*traversed_vex);
+
+    graph_link_t *link = gr->vertices[start_vertex]->link;
+
+    /* Visit the neighbours vertices */
+    while (NULL != link) {
+        if (0 == graph_traversal_visited(trav, link->vertex)) {
+            graph_dfs_traverse_helper(gr, trav, link->vertex, vertex_path, traversed_vex);
+        }
+
+        link = link->next;
+    }
+}
+
+/**
+ * @brief Function to traverse the vertices of the graph object by
+ * depth-first-search method, the visited vertices are marked in a
+ * caller owned traversal object (see **graph_bfs_traverse_ctx**).
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param trav pointer to an allocated traversal object
+ * @param start_vertex a vertex to start the dfs
+ * @param vertex_path an array to save the path of dfs traversal can be `NULL`
+ * @return size_t size of the traversed vertices or 0 if function failed 
+ */
+size_t graph_dfs_traverse_ctx(const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == trav) || (start_vertex >= gr->size) || (NULL == gr->vertices[start_vertex])) {
+        return 0;
+    }
+
+    if (SCL_OK != graph_traversal_begin(trav, gr->size)) {
+        return 0;
+    }
+
+    /* No vertex was traversed */
+    size_t traversed_vex = 0;
+
+    /* Call helper function the real dfs call */
+    graph_dfs_traverse_helper(gr, trav, start_vertex, vertex_path, &traversed_vex);
+
+    /* Return the size of the traversed vertices */
+    return traversed_vex;
+}
+
+/**
+ * @brief Function to traverse the vertices of the graph object by
+ * depth-first-search method. Function will get as input an allocated
+ * array to save the path of dfs, if the array is `NULL` then the path
+ * will not be saved however function will return the exact size of the
+ * traversed vertices in this dfs call. A traversal object is allocated
+ * for the call, use **graph_dfs_traverse_ctx** to reuse one.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param start_vertex a vertex to start the dfs
+ * @param vertex_path an array to save the path of dfs traversal can be `NULL`
+ * @return size_t size of the traversed vertices or 0 if function failed 
+ */
+size_t graph_dfs_traverse(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size)) {
+        return 0;
+    }
+
+    graph_traversal_t *trav = create_graph_traversal(gr->size);
+
+    size_t traversed_vex = graph_dfs_traverse_ctx(gr, trav, start_vertex, vertex_path);
+
+    free_graph_traversal(trav);
+
+    /* Return the size of the traversed vertices */
+    return traversed_vex;
+}
+
+/**
+ * @brief Function to check if a graph object has or has not a cycle.
+ * The vertices without in edges are removed one by one (Kahn's algorithm),
+ * the graph has a cycle if some vertices can never be removed. Function may
+ * fail if graph object is not valid in that case false will be returned
+ * because an invalid graph has no cycle.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return uint8_t if graph has a cycle or 0 otherwise
+ */
+uint8_t graph_has_cycle(const graph_t * const __restrict__ gr) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices)) {
+        return 0;
+    }
+
+    /* Number of not removed in edges of every vertex and the removable vertices */
+    size_t *in_edges = scl_calloc(gr->allocator, gr->size, sizeof(*in_edges));
+    size_t *removable = scl_malloc(gr->allocator, sizeof(*removable) * gr->size);
+
+    if ((NULL == in_edges) || (NULL == removable)) {
+        scl_free(gr->allocator, in_edges);
+        scl_free(gr->allocator, removable);
+        return 0;
+    }
+
+    size_t number_of_vertices = 0;
+    size_t removable_size = 0;
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            ++number_of_vertices;
+
+            for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+                ++in_edges[link->vertex];
+            }
+        }
+    }
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if ((NULL != gr->vertices[iter]) && (0 == in_edges[iter])) {
+            removable[removable_size++] = iter;
+        }
+    }
+
+    /* Remove the vertices and their out edges */
+    size_t removed = 0;
+
+    while (removed < removable_size) {
+        const size_t vertex = removable[removed++];
+
+        for (const graph_link_t *link = gr->vertices[vertex]->link; NULL != link; link = link->next) {
+            if (0 == --in_edges[link->vertex]) {
+                removable[removable_size++] = link->vertex;
+            }
+        }
+    }
+
+    scl_free(gr->allocator, in_edges);
+    scl_free(gr->allocator, removable);
+
+    /* 1 if graph has a cycle or 0 otherwise */
+    return (removed < number_of_vertices);
+}
+
+/**
+ * @brief Function to get all vertices that are resulting
+ * from the start_vertex in other words there exists a path
+ * from node X to node Y, in this case node Y will be part of
+ * past nodes. The visited vertices are marked in a caller
+ * owned traversal object.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param trav pointer to an allocated traversal object
+ * @param start_vertex a vertex to get its past vertices
+ * @param vertex_path an allocated array to save all past vertices
+ * @return size_t size of the past vertices or 0 if function failed 
+ */
+size_t graph_vertex_past_vertices_ctx(const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == trav) || (start_vertex >= gr->size) || (NULL == gr->vertices[start_vertex]) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    if (SCL_OK != graph_traversal_begin(trav, gr->size)) {
+        return 0;
+    }
+
+    /* Return number of the past vertices */
+    return graph_bfs_traverse_helper(gr, trav, start_vertex, vertex_path, 1);
+}
+
+/**
+ * @brief Function to get all vertices that are resulting
+ * from the start_vertex in other words there exists a path
+ * from node X to node Y, in this case node Y will be part of
+ * past nodes.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param start_vertex a vertex to get its past vertices
+ * @param vertex_path an allocated array to save all past vertices
+ * @return size_t size of the past vertices or 0 if function failed 
+ */
+size_t graph_vertex_past_vertices(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    graph_traversal_t *trav = create_graph_traversal(gr->size);
+
+    size_t traversed_vex = graph_vertex_past_vertices_ctx(gr, trav, start_vertex, vertex_path);
+
+    free_graph_traversal(trav);
+
+    /* Return number of the past vertices */
+    return traversed_vex;
+}
+
+/**
+ * @brief Function to get the future vertices of the selected vertex.
+ * Future vertices are the vertices that have a path ending in the selected node.
+ * The visited vertices are marked in a caller owned traversal object.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param trav pointer to an allocated traversal object
+ * @param start_vertex a vertex to get its future vertices
+ * @param vertex_path an allocated array to save all future vertices
+ * @return size_t size of the future vertices or 0 if function failed 
+ */
+size_t graph_vertex_future_vertices_ctx(const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if the graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == trav) || (start_vertex >= gr->size) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    /* Compute the transposed graph */
+    graph_t *transpose_graph = create_transpose_graph(gr);
+
+    /*
+     * Calculate the past vertices of the transposed graph
+     * that will be the future vertices of the selected graph
+     */
+    size_t traversed_vex = graph_vertex_past_vertices_ctx(transpose_graph, trav, start_vertex, vertex_path);
+
+    /* Free memory of the transposed graph */
+    free_graph(transpose_graph);
+
+    /* Return the size of the future vertices */
+    return traversed_vex;
+}
+
+/**
+ * @brief Function to get the future vertices of the selected vertex.
+ * Future vertices are the vertices that have a path ending in the selected node.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param start_vertex a vertex to get its future vertices
+ * @param vertex_path an allocated array to save all future vertices
+ * @return size_t size of the future vertices or 0 if function failed 
+ */
+size_t graph_vertex_future_vertices(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if the graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    graph_traversal_t *trav = create_graph_traversal(gr->size);
+
+    size_t traversed_vex = graph_vertex_future_vertices_ctx(gr, trav, start_vertex, vertex_path);
+
+    free_graph_traversal(trav);
+
+    /* Return the size of the future vertices */
+    return traversed_vex;
+}
+
+/**
+ * @brief Function to get the anticone vertices of the selected vertex.
+ * Anticone vertices are the vertices that do not have any path to selected
+ * vertex.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param start_vertex a vertex to get its anticone vertices
+ * @param vertex_path an allocated array to save all anticone vertices
+ * @return size_t size of the anticone vertices or 0 if function failed 
+ */
+size_t graph_vertex_anticone_vertices(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size) || (NULL == gr->vertices[start_vertex]) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    /* Allocate the past and the future vertices arrays */
+    size_t * __restrict__ past_vertices = scl_malloc(gr->allocator, sizeof(*past_vertices) * gr->size);
+    size_t * __restrict__ future_vertices = scl_malloc(gr->allocator, sizeof(*future_vertices) * gr->size);
+    graph_traversal_t *trav = create_graph_traversal(gr->size);
+
+    if ((NULL == past_vertices) || (NULL == future_vertices) || (NULL == trav)) {
+        scl_free(gr->allocator, past_vertices);
+        scl_free(gr->allocator, future_vertices);
+        free_graph_traversal(trav);
+        return 0;
+    }
+
+    /* Compute the past and future vertices of the selected vertex */
+    size_t past_size = graph_vertex_past_vertices_ctx(gr, trav, start_vertex, past_vertices);
+    size_t future_size = graph_vertex_future_vertices_ctx(gr, trav, start_vertex, future_vertices);
+    size_t traversed_size = 0;
+
+    /* Mark the past and the future vertices in a new query */
+    if (SCL_OK == graph_traversal_begin(trav, gr->size)) {
+        graph_traversal_visit(trav, start_vertex);
+
+        for (size_t iter = 0; iter < past_size; ++iter) {
+            graph_traversal_visit(trav, past_vertices[iter]);
+        }
+
+        for (size_t iter = 0; iter < future_size; ++iter) {
+            graph_traversal_visit(trav, future_vertices[iter]);
+        }
+
+        /* Every vertex that is not marked (and not deleted) is part of the anticone vertices */
+        for (size_t iter = 0; iter < gr->size; ++iter) {
+            if ((0 == graph_traversal_visited(trav, iter)) && (NULL != gr->vertices[iter])) {
+                vertex_path[traversed_size++] = iter;
+            }
+        }
+    }
+
+    scl_free(gr->allocator, past_vertices);
+    scl_free(gr->allocator, future_vertices);
+    free_graph_traversal(trav);
+
+    /* Return the size of the anticone vertices */
+    return traversed_size;
+}
+
+/**
+ * @brief Function to get the tips vertices of the graph.
+ * The tips vertices are the vertices that have the in-degree
+ * zero, but can have out-degree as bigger as they want
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param vertex_path an allocated array to save all tips vertices
+ * @return size_t size of the tips vertices or 0 if function failed 
+ */
+size_t graph_tips_vertices(const graph_t * const __restrict__ gr, size_t * __restrict__ vertex_path) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    size_t traversed_size = 0;
+
+    /* Iterate through all vertices and check their in degree */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            if (0 == gr->vertices[iter]->in_deg) {
+                vertex_path[traversed_size++] = iter;
+            }
+        }
+    }
+
+    /* Return the number of the tips vertices */
+    return traversed_size;
+}
+
+/**
+ * @brief Subroutine function to push on stack dfs traversed
+ * vertices to perform a topological sort of the graph
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param trav pointer to a started traversal object
+ * @param start_vertex vertex to perform a dfs traversa;
+ * @param stack pointer to a stack object to push vertices
+ */
+static void graph_topological_sort_helper(const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t start_vertex, sstack_t * const __restrict__ stack) {
+    /* Check if selected vertex is allocated */
+    if (NULL == gr->vertices[start_vertex]) {
+        return;
+    }
+
+    /* Visit the current selected vertex */
+    graph_traversal_visit(trav, start_vertex);
+
+    graph_link_t * link = gr->vertices[start_vertex]->link;
+
+    /* Perform a dfs call on start_index */
+    for(; link != NULL; link = link->next) {
+        if (0 == graph_traversal_visited(trav, link->vertex)) {
+            graph_topological_sort_helper(gr, trav, link->vertex, stack);
+        }
+    }
+
+    /* Push the selected vertex after dfs call */
+    stack_push(stack, &start_vertex);
+}
+
+/**
+ * @brief Function to get the topological sort of the selected graph,
+ * the visited vertices are marked in a caller owned traversal object.
+ * Function may fail if graph object is invalid. Or no heap memory is left
+ * for stack memory allocation
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param trav pointer to an allocated traversal object
+ * @param vertex_path an allocated array to save the path of topological sort
+ * @return size_t the number of the traversed vertices by topological sort
+ */
+size_t graph_topological_sort_ctx(const graph_t * const __restrict__ gr, graph_traversal_t * const __restrict__ trav, size_t * __restrict__ vertex_path) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == trav) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    if (SCL_OK != graph_traversal_begin(trav, gr->size)) {
+        return 0;
+    }
+
+    /* Create a stack subroutine for topological sort */
+    sstack_t *sort_stack = create_stack(NULL, sizeof(*vertex_path));
+
+    /* Every vertex is pushed once, so one array holds the whole stack */
+    if ((NULL == sort_stack) || (SCL_OK != stack_use_array(sort_stack, gr->size, 0))) {
+        free_stack(sort_stack);
+        return 0;
+    }
+
+    /* Perform the topological sort dfs call */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (0 == graph_traversal_visited(trav, iter)) {
+            graph_topological_sort_helper(gr, trav, iter, sort_stack);
+        }
+    }
+
+    size_t traversed_size = 0;
+    scl_error_t err = SCL_OK;
+
+    /* The topological sort of the graph is the reverse of the dfs calls */
+    while (!is_stack_empty(sort_stack)) {
+        const size_t *top_vertex = stack_top(sort_stack);
+
+        vertex_path[traversed_size++] = *top_vertex;
+
+        err = stack_pop(sort_stack);
+
+        if (SCL_OK != err) {
+            free_stack(sort_stack);
+            return traversed_size;
+        }
+    }
+
+    free_stack(sort_stack);
+
+    /*
+     * Return the number of traversed vertices,
+     * should be gr->size if everything went good
+     */
+    return traversed_size;
+}
+
+/**
+ * @brief Function to get the topological sort of the
+ * selected graph. Function may fail if graph object is invalid.
+ * Or no heap memory is left for stack memory allocation
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param vertex_path an allocated array to save the path of topological sort
+ * @return size_t the number of the traversed vertices by topological sort
+ */
+size_t graph_topological_sort(const graph_t * const __restrict__ gr, size_t * __restrict__ vertex_path) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    graph_traversal_t *trav = create_graph_traversal(gr->size);
+
+    size_t traversed_size = graph_topological_sort_ctx(gr, trav, vertex_path);
+
+    free_graph_traversal(trav);
+
+    /*
+     * Return the number of traversed vertices,
+     * should be gr->size if everything went good
+     */
+    return traversed_size;
+}
+
+/**
+ * @brief Subroutine function to append the vertices that were added to the
+ * graph after the last call at the end of the topological order, a vertex
+ * without edges can take any position.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param topo a pointer to an allocated topological order object
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_topo_order_sync(const graph_t * const __restrict__ gr, graph_topo_order_t * const __restrict__ topo) {
+    /* Deleted vertices renumber the graph, the order must be created again */
+    if (gr->size < topo->size) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (gr->size > topo->capacity) {
+        size_t new_capacity = ((topo->capacity <= SIZE_MAX / 2) && (2 * topo->capacity > gr->size)) ? 2 * topo->capacity : gr->size;
+
+        size_t *try_realloc_order = scl_realloc(topo->allocator, topo->order, sizeof(*try_realloc_order) * new_capacity);
+
+        if (NULL == try_realloc_order) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        topo->order = try_realloc_order;
+
+        size_t *try_realloc_position = scl_realloc(topo->allocator, topo->position, sizeof(*try_realloc_position) * new_capacity);
+
+        if (NULL == try_realloc_position) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        topo->position = try_realloc_position;
+        topo->capacity = new_capacity;
+    }
+
+    /* New vertices go after all the old ones */
+    for (; topo->size < gr->size; ++(topo->size)) {
+        topo->order[topo->size] = topo->size;
+        topo->position[topo->size] = topo->size;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Create a topological order object of a directed acyclic graph. The
+ * first order is computed by the Kahn algorithm in O(V + E), then every edge
+ * inserted by graph_topo_insert_edge updates it locally. Function fails if
+ * the graph has a cycle or no heap memory is left.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return graph_topo_order_t* a new topological order object or `NULL` if function fails
+ */
+graph_topo_order_t* create_graph_topo_order(const graph_t * const __restrict__ gr) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices)) {
+        errno = EINVAL;
+        perror("Graph for topological order is not allocated");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new topological order object on heap */
+    graph_topo_order_t *new_topo = scl_malloc(allocator, sizeof(*new_topo));
+
+    /* Check if topological order object was allocated */
+    if (NULL == new_topo) {
+        errno = ENOMEM;
+        perror("Not enough memory for topological order allocation");
+        return NULL;
+    }
+
+    new_topo->allocator = allocator;
+    new_topo->size = gr->size;
+    new_topo->capacity = (0 == gr->size) ? 1 : gr->size;
+    new_topo->order = scl_malloc(allocator, sizeof(*new_topo->order) * new_topo->capacity);
+    new_topo->position = scl_calloc(allocator, new_topo->capacity, sizeof(*new_topo->position));
+    new_topo->trav = create_graph_traversal(new_topo->capacity);
+
+    /* Check if the arrays were allocated */
+    if ((NULL == new_topo->order) || (NULL == new_topo->position) || (NULL == new_topo->trav)) {
+        free_graph_topo_order(new_topo);
+
+        errno = ENOMEM;
+        perror("Not enough memory for topological order arrays allocation");
+        return NULL;
+    }
+
+    /* Count the in edges of every vertex, the position array holds them for now */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+                ++(new_topo->position[link->vertex]);
+            }
+        }
+    }
+
+    /* The order array is the queue of the Kahn algorithm */
+    size_t queue_back = 0;
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (0 == new_topo->position[iter]) {
+            new_topo->order[queue_back++] = iter;
+        }
+    }
+
+    for (size_t queue_front = 0; queue_front < queue_back; ++queue_front) {
+        const size_t vertex = new_topo->order[queue_front];
+
+        if (NULL != gr->vertices[vertex]) {
+            for (const graph_link_t *link = gr->vertices[vertex]->link; NULL != link; link = link->next) {
+                if (0 == --(new_topo->position[link->vertex])) {
+                    new_topo->order[queue_back++] = link->vertex;
+                }
+            }
+        }
+    }
+
+    /* Vertices left out of the queue are on a cycle */
+    if (queue_back != gr->size) {
+        free_graph_topo_order(new_topo);
+
+        errno = EINVAL;
+        perror("Graph for topological order has a cycle");
+        return NULL;
+    }
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        new_topo->position[new_topo->order[iter]] = iter;
+    }
+
+    /* Return the new topological order object */
+    return new_topo;
+}
+
+/**
+ * @brief Function to free all memory allocated for a topological order
+ * object, the graph object is not touched.
+ * 
+ * @param topo a pointer to an allocated topological order object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_graph_topo_order(graph_topo_order_t * const __restrict__ topo) {
+    /* Check if topological order object needs to be freed */
+    if (NULL == topo) {
+        return SCL_NULL_GRAPH_TOPO_ORDER;
+    }
+
+    free_graph_traversal(topo->trav);
+    scl_free(topo->allocator, topo->order);
+    scl_free(topo->allocator, topo->position);
+    scl_free(topo->allocator, topo);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to insert one edge into a directed acyclic graph and to
+ * keep its topological order. If the end vertex is already after the start
+ * vertex nothing moves, otherwise the vertices reachable from the end vertex
+ * between the two positions are found by a search that never leaves that
+ * range and they are moved right after the start vertex, keeping their
+ * relative order (the Marchetti-Spaccamela, Nanni and Rohnert algorithm).
+ * If the search reaches the start vertex the edge would close a cycle and
+ * it is not inserted, so the graph stays acyclic without graph_has_cycle.
+ * All the edges of the graph MUST be inserted by this function while the
+ * order is in use, new vertices are added to the order automatically.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param topo a pointer to the topological order object of the graph
+ * @param start_vertex number of vertex that edge starts from
+ * @param end_vertex number of vertex that edge ends to
+ * @param edge_len the length of the edge that links two vertices
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_topo_insert_edge(const graph_t * const __restrict__ gr, graph_topo_order_t * const __restrict__ topo, size_t start_vertex, size_t end_vertex, graph_weight_t edge_len) {
+    /* Check if graph object is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if topological order object is valid */
+    if (NULL == topo) {
+        return SCL_NULL_GRAPH_TOPO_ORDER;
+    }
+
+    /* Check if vertices array is valid */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if two vertices are in the current graph object */
+    if ((gr->size <= start_vertex) || (gr->size <= end_vertex)) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    /* A loop is a cycle of one vertex */
+    if (start_vertex == end_vertex) {
+        return SCL_EDGE_MAKES_CYCLE;
+    }
+
+    scl_error_t err = graph_topo_order_sync(gr, topo);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    const size_t lower_bound = topo->position[end_vertex];
+    const size_t upper_bound = topo->position[start_vertex];
+
+    /* The edge breaks the order, move the vertices reachable from the end vertex */
+    if (lower_bound < upper_bound) {
+        graph_traversal_t * const trav = topo->trav;
+
+        err = graph_traversal_begin(trav, gr->size);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        /* Search from the end vertex just between the two positions */
+        size_t stack_size = 0;
+
+        graph_traversal_visit(trav, end_vertex);
+        trav->frontier[stack_size++] = end_vertex;
+
+        while (0 != stack_size) {
+            const size_t vertex = trav->frontier[--stack_size];
+
+            if (NULL == gr->vertices[vertex]) {
+                return SCL_NULL_GRAPH_VERTEX;
+            }
+
+            for (const graph_link_t *link = gr->vertices[vertex]->link; NULL != link; link = link->next) {
+                const size_t next_vertex = link->vertex;
+
+                /* The new edge would close a cycle */
+                if (start_vertex == next_vertex) {
+                    return SCL_EDGE_MAKES_CYCLE;
+                }
+
+                if ((topo->position[next_vertex] < upper_bound) && (0 == graph_traversal_visited(trav, next_vertex))) {
+                    graph_traversal_visit(trav, next_vertex);
+                    trav->frontier[stack_size++] = next_vertex;
+                }
+            }
+        }
+
+        /*
+         * Compact the not reached vertices of the range to its front and put
+         * the reached ones after them, the stack array collects the reached ones
+         */
+        size_t write_position = lower_bound;
+        size_t moved = 0;
+
+        for (size_t iter = lower_bound; iter <= upper_bound; ++iter) {
+            const size_t vertex = topo->order[iter];
+
+            if (0 != graph_traversal_visited(trav, vertex)) {
+                trav->frontier[moved++] = vertex;
+            } else {
+                topo->order[write_position] = vertex;
+                topo->position[vertex] = write_position++;
+            }
+        }
+
+        for (size_t iter = 0; iter < moved; ++iter) {
+            topo->order[write_position] = trav->frontier[iter];
+            topo->position[trav->frontier[iter]] = write_position++;
+        }
+    }
+
+    /* The order accepts the edge, link it in the graph */
+    return graph_insert_edge(gr, start_vertex, end_vertex, edge_len);
+}
+
+/**
+ * @brief Get the topological order kept by a topological order object, the
+ * array has one element for every vertex and changes with the next insertions.
+ * 
+ * @param topo a pointer to an allocated topological order object
+ * @return const size_t* the vertices in topological order or `NULL`
+ */
+const size_t* get_graph_topo_order(const graph_topo_order_t * const __restrict__ topo) {
+    if (NULL == topo) {
+        return NULL;
+    }
+
+    return topo->order;
+}
+
+/**
+ * @brief Get the position of one vertex in the topological order.
+ * 
+ * @param topo a pointer to an allocated topological order object
+ * @param vertex vertex to look for
+ * @return size_t position of the vertex or SIZE_MAX if input is not valid
+ */
+size_t get_graph_topo_position(const graph_topo_order_t * const __restrict__ topo, size_t vertex) {
+    if ((NULL == topo) || (vertex >= topo->size)) {
+        return SIZE_MAX;
+    }
+
+    return topo->position[vertex];
+}
+
+/**
+ * @brief Subroutine function to make room in the rows of a reachability
+ * index for all the vertices of the graph. The rows are copied into new
+ * arrays with a wider stride, the capacity grows at least twice so adding
+ * vertices one by one copies the rows O(logN) times.
+ * 
+ * Function MUST not be used outside this file.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param reach a pointer to an allocated reachability index object
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_reach_index_sync(const graph_t * const __restrict__ gr, graph_reach_index_t * const __restrict__ reach) {
+    /* Deleted vertices renumber the graph, the index must be created again */
+    if (gr->size < reach->size) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (gr->size > reach->capacity) {
+        size_t new_capacity = ((reach->capacity <= SIZE_MAX / 2) && (2 * reach->capacity > gr->size)) ? 2 * reach->capacity : gr->size;
+
+        if (new_capacity > SIZE_MAX - 63) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        const size_t new_words = (new_capacity + 63) / 64;
+
+        new_capacity = 64 * new_words;
+
+        if (new_words > SIZE_MAX / sizeof(uint64_t) / new_capacity) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        uint64_t *new_past = scl_calloc(reach->allocator, new_capacity * new_words, sizeof(*new_past));
+        uint64_t *new_future = scl_calloc(reach->allocator, new_capacity * new_words, sizeof(*new_future));
+
+        if ((NULL == new_past) || (NULL == new_future)) {
+            scl_free(reach->allocator, new_past);
+            scl_free(reach->allocator, new_future);
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        for (size_t iter = 0; iter < reach->size; ++iter) {
+            memcpy(new_past + iter * new_words, reach->past + iter * reach->words, sizeof(*new_past) * reach->words);
+            memcpy(new_future + iter * new_words, reach->future + iter * reach->words, sizeof(*new_future) * reach->words);
+        }
+
+        scl_free(reach->allocator, reach->past);
+        scl_free(reach->allocator, reach->future);
+
+        reach->past = new_past;
+        reach->future = new_future;
+        reach->words = new_words;
+        reach->capacity = new_capacity;
+    }
+
+    /* New vertices have no edges, their rows are empty */
+    reach->size = gr->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Create a reachability index object of a directed acyclic graph.
+ * The vertices are sorted by the Kahn algorithm, then the past rows are
+ * filled in reverse topological order and the future rows in topological
+ * order, every edge merging one row into another in O(V / 64). Function
+ * fails if the graph has a cycle or no heap memory is left.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return graph_reach_index_t* a new reachability index object or `NULL` if function fails
+ */
+graph_reach_index_t* create_graph_reach_index(const graph_t * const __restrict__ gr) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices)) {
+        errno = EINVAL;
+        perror("Graph for reachability index is not allocated");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new reachability index object on heap */
+    graph_reach_index_t *new_reach = scl_malloc(allocator, sizeof(*new_reach));
+
+    /* Check if reachability index object was allocated */
+    if (NULL == new_reach) {
+        errno = ENOMEM;
+        perror("Not enough memory for reachability index allocation");
+        return NULL;
+    }
+
+    new_reach->allocator = allocator;
+    new_reach->past = NULL;
+    new_reach->future = NULL;
+    new_reach->words = 0;
+    new_reach->size = 0;
+    new_reach->capacity = 0;
+
+    /* Allocate the rows, the in edges counters and the queue of the Kahn algorithm */
+    size_t *in_edges = scl_calloc(allocator, (0 == gr->size) ? 1 : gr->size, sizeof(*in_edges));
+    size_t *order = scl_malloc(allocator, sizeof(*order) * ((0 == gr->size) ? 1 : gr->size));
+
+    if ((NULL == in_edges) || (NULL == order) || (SCL_OK != graph_reach_index_sync(gr, new_reach))) {
+        scl_free(allocator, in_edges);
+        scl_free(allocator, order);
+        free_graph_reach_index(new_reach);
+
+        errno = ENOMEM;
+        perror("Not enough memory for reachability index rows allocation");
+        return NULL;
+    }
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+                ++in_edges[link->vertex];
+            }
+        }
+    }
+
+    size_t queue_back = 0;
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (0 == in_edges[iter]) {
+            order[queue_back++] = iter;
+        }
+    }
+
+    for (size_t queue_front = 0; queue_front < queue_back; ++queue_front) {
+        const size_t vertex = order[queue_front];
+
+        if (NULL != gr->vertices[vertex]) {
+            for (const graph_link_t *link = gr->vertices[vertex]->link; NULL != link; link = link->next) {
+                if (0 == --in_edges[link->vertex]) {
+                    order[queue_back++] = link->vertex;
+                }
+            }
+        }
+    }
+
+    scl_free(allocator, in_edges);
+
+    /* Vertices left out of the queue are on a cycle */
+    if (queue_back != gr->size) {
+        scl_free(allocator, order);
+        free_graph_reach_index(new_reach);
+
+        errno = EINVAL;
+        perror("Graph for reachability index has a cycle");
+        return NULL;
+    }
+
+    const size_t words = new_reach->words;
+
+    /* The past of a vertex is the past of its end vertices and the end vertices */
+    for (size_t iter = gr->size; iter > 0; --iter) {
+        const size_t vertex = order[iter - 1];
+
+        if (NULL != gr->vertices[vertex]) {
+            uint64_t * const row = new_reach->past + vertex * words;
+
+            for (const graph_link_t *link = gr->vertices[vertex]->link; NULL != link; link = link->next) {
+                const uint64_t * const next_row = new_reach->past + link->vertex * words;
+
+                for (size_t word = 0; word < words; ++word) {
+                    row[word] |= next_row[word];
+                }
+
+                row[link->vertex / 64] |= (uint64_t)1 << (link->vertex % 64);
+            }
+        }
+    }
+
+    /* The future of a vertex is the future of its start vertices and the start vertices */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        const size_t vertex = order[iter];
+
+        if (NULL != gr->vertices[vertex]) {
+            const uint64_t * const row = new_reach->future + vertex * words;
+
+            for (const graph_link_t *link = gr->vertices[vertex]->link; NULL != link; link = link->next) {
+                uint64_t * const next_row = new_reach->future + link->vertex * words;
+
+                for (size_t word = 0; word < words; ++word) {
+                    next_row[word] |= row[word];
+                }
+
+                next_row[vertex / 64] |= (uint64_t)1 << (vertex % 64);
+            }
+        }
+    }
+
+    scl_free(allocator, order);
+
+    /* Return the new reachability index object */
+    return new_reach;
+}
+
+/**
+ * @brief Function to free all memory allocated for a reachability index
+ * object, the graph object is not touched.
+ * 
+ * @param reach a pointer to an allocated reachability index object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_graph_reach_index(graph_reach_index_t * const __restrict__ reach) {
+    /* Check if reachability index object needs to be freed */
+    if (NULL == reach) {
+        return SCL_NULL_GRAPH_REACH_INDEX;
+    }
+
+    scl_free(reach->allocator, reach->past);
+    scl_free(reach->allocator, reach->future);
+    scl_free(reach->allocator, reach);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Subroutine function to merge one row and its own vertex into the
+ * row of a vertex and into the rows of all vertices from an owners row.
+ * A row already holding the source vertex holds all its row, because the
+ * paths are transitive, so it is skipped, and just the not empty words of
+ * the source row are merged (a new vertex of a growing DAG has one bit).
+ * 
+ * Function MUST not be used outside this file.
+ * 
+ * @param rows past or future rows of a reachability index
+ * @param words number of 64 bits words of every row
+ * @param owners row with the other vertices whose rows are merged
+ * @param owner_vertex vertex whose row is merged
+ * @param source row to merge, not changed by the merge
+ * @param source_vertex vertex of the source row, merged as well
+ */
+static void graph_reach_merge_rows(uint64_t * const rows, size_t words, const uint64_t * const owners, size_t owner_vertex, const uint64_t * const source, size_t source_vertex) {
+    const uint64_t source_bit = (uint64_t)1 << (source_vertex % 64);
+    const size_t source_word = source_vertex / 64;
+
+    /* Merge just the words from the first to the last not empty word of the source row */
+    size_t first_word = 0;
+    size_t last_word = words;
+
+    while ((first_word < words) && (0 == source[first_word])) {
+        ++first_word;
+    }
+
+    while ((last_word > first_word) && (0 == source[last_word - 1])) {
+        --last_word;
+    }
+
+    for (size_t word = 0; word <= words; ++word) {
+        /* The owner vertex goes after the vertices of the owners row */
+        uint64_t bits = (word < words) ? owners[word] : 1;
+
+        while (0 != bits) {
+            const size_t vertex = (word < words) ? 64 * word + (size_t)__builtin_ctzll(bits) : owner_vertex;
+            uint64_t * const row = rows + vertex * words;
+
+            bits &= bits - 1;
+
+            if (0 != (row[source_word] & source_bit)) {
+                continue;
+            }
+
+            for (size_t iter = first_word; iter < last_word; ++iter) {
+                row[iter] |= source[iter];
+            }
+
+            row[source_word] |= source_bit;
+        }
+    }
+}
+
+/**
+ * @brief Function to insert one edge into a directed acyclic graph and to
+ * keep its reachability index. If the end vertex is already in the past of
+ * the start vertex no row changes, otherwise the past of the end vertex (and
+ * the end vertex) is merged into the past rows of the start vertex and its
+ * future vertices, and the same way the future rows of the end vertex and
+ * its past vertices are updated, O((|past| + |future|) * V / 64). If the
+ * start vertex is in the past of the end vertex the edge would close a cycle
+ * and it is not inserted. All the edges of the graph MUST be inserted by
+ * this function while the index is in use, new vertices are added to the
+ * index automatically.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param reach a pointer to the reachability index object of the graph
+ * @param start_vertex number of vertex that edge starts from
+ * @param end_vertex number of vertex that edge ends to
+ * @param edge_len the length of the edge that links two vertices
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_reach_insert_edge(const graph_t * const __restrict__ gr, graph_reach_index_t * const __restrict__ reach, size_t start_vertex, size_t end_vertex, graph_weight_t edge_len) {
+    /* Check if graph object is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if reachability index object is valid */
+    if (NULL == reach) {
+        return SCL_NULL_GRAPH_REACH_INDEX;
+    }
+
+    /* Check if vertices array is valid */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if two vertices are in the current graph object */
+    if ((gr->size <= start_vertex) || (gr->size <= end_vertex)) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    /* A loop is a cycle of one vertex */
+    if (start_vertex == end_vertex) {
+        return SCL_EDGE_MAKES_CYCLE;
+    }
+
+    scl_error_t err = graph_reach_index_sync(gr, reach);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    const size_t words = reach->words;
+    uint64_t * const past = reach->past;
+    uint64_t * const future = reach->future;
+
+    /* The new edge would close a cycle */
+    if (0 != (past[end_vertex * words + start_vertex / 64] & ((uint64_t)1 << (start_vertex % 64)))) {
+        return SCL_EDGE_MAKES_CYCLE;
+    }
+
+    /* Link the edge in the graph before touching the rows */
+    err = graph_insert_edge(gr, start_vertex, end_vertex, edge_len);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    /* The end vertex was already reachable, all the paths stay the same */
+    if (0 != (past[start_vertex * words + end_vertex / 64] & ((uint64_t)1 << (end_vertex % 64)))) {
+        return SCL_OK;
+    }
+
+    /*
+     * The past row of the end vertex and the future row of the start vertex
+     * are not changed by the merges, a vertex cannot be in both of them
+     */
+    graph_reach_merge_rows(past, words, future + start_vertex * words, start_vertex, past + end_vertex * words, end_vertex);
+    graph_reach_merge_rows(future, words, past + end_vertex * words, end_vertex, future + start_vertex * words, start_vertex);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if one vertex is in the past of another vertex
+ * of the indexed graph, in other words if there is a path from vertex to
+ * other_vertex. The check reads one bit, O(1).
+ * 
+ * @param reach a pointer to an allocated reachability index object
+ * @param vertex vertex that the path starts from
+ * @param other_vertex vertex that the path ends to
+ * @return uint8_t 1 if other_vertex is in the past of vertex or 0 otherwise
+ */
+uint8_t graph_reach_is_past(const graph_reach_index_t * const __restrict__ reach, size_t vertex, size_t other_vertex) {
+    /* Check if input data is valid */
+    if ((NULL == reach) || (vertex >= reach->size) || (other_vertex >= reach->size)) {
+        return 0;
+    }
+
+    return (0 != (reach->past[vertex * reach->words + other_vertex / 64] & ((uint64_t)1 << (other_vertex % 64))));
+}
+
+/**
+ * @brief Function to check if one vertex is in the future of another vertex
+ * of the indexed graph, in other words if there is a path from other_vertex
+ * to vertex. The check reads one bit, O(1).
+ * 
+ * @param reach a pointer to an allocated reachability index object
+ * @param vertex vertex that the path ends to
+ * @param other_vertex vertex that the path starts from
+ * @return uint8_t 1 if other_vertex is in the future of vertex or 0 otherwise
+ */
+uint8_t graph_reach_is_future(const graph_reach_index_t * const __restrict__ reach, size_t vertex, size_t other_vertex) {
+    /* Check if input data is valid */
+    if ((NULL == reach) || (vertex >= reach->size) || (other_vertex >= reach->size)) {
+        return 0;
+    }
+
+    return (0 != (reach->future[vertex * reach->words + other_vertex / 64] & ((uint64_t)1 << (other_vertex % 64))));
+}
+
+/**
+ * @brief Subroutine function to save the vertices of one row in increasing
+ * order, O(V / 64 + number of vertices).
+ * 
+ * Function MUST not be used outside this file.
+ * 
+ * @param row past or future row of a reachability index
+ * @param words number of 64 bits words of the row
+ * @param vertex_path an allocated array to save the vertices
+ * @return size_t number of saved vertices
+ */
+static size_t graph_reach_row_vertices(const uint64_t * const __restrict__ row, size_t words, size_t * __restrict__ vertex_path) {
+    size_t traversed_vex = 0;
+
+    for (size_t word = 0; word < words; ++word) {
+        for (uint64_t bits = row[word]; 0 != bits; bits &= bits - 1) {
+            vertex_path[traversed_vex++] = 64 * word + (size_t)__builtin_ctzll(bits);
+        }
+    }
+
+    /* Return number of saved vertices */
+    return traversed_vex;
+}
+
+/**
+ * @brief Function to get the past vertices of the selected vertex from the
+ * reachability index, the same vertices as graph_vertex_past_vertices in
+ * increasing order without traversing the graph.
+ * 
+ * @param gr a pointer to the allocated graph object of the index
+ * @param reach a pointer to an allocated reachability index object
+ * @param start_vertex a vertex to get its past vertices
+ * @param vertex_path an allocated array to save all past vertices
+ * @return size_t size of the past vertices or 0 if function failed
+ */
+size_t graph_reach_past_vertices(const graph_t * const __restrict__ gr, const graph_reach_index_t * const __restrict__ reach, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valid */
+    if ((NULL == gr) || (NULL == reach) || (start_vertex >= gr->size) || (NULL == gr->vertices[start_vertex]) || (gr->size < reach->size) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    /* Vertices added after the last insertion have no edges */
+    if (start_vertex >= reach->size) {
+        return 0;
+    }
+
+    /* Return number of the past vertices */
+    return graph_reach_row_vertices(reach->past + start_vertex * reach->words, reach->words, vertex_path);
+}
+
+/**
+ * @brief Function to get the future vertices of the selected vertex from the
+ * reachability index, the same vertices as graph_vertex_future_vertices in
+ * increasing order without building the transposed graph.
+ * 
+ * @param gr a pointer to the allocated graph object of the index
+ * @param reach a pointer to an allocated reachability index object
+ * @param start_vertex a vertex to get its future vertices
+ * @param vertex_path an allocated array to save all future vertices
+ * @return size_t size of the future vertices or 0 if function failed
+ */
+size_t graph_reach_future_vertices(const graph_t * const __restrict__ gr, const graph_reach_index_t * const __restrict__ reach, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valid */
+    if ((NULL == gr) || (NULL == reach) || (start_vertex >= gr->size) || (NULL == gr->vertices[start_vertex]) || (gr->size < reach->size) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    /* Vertices added after the last insertion have no edges */
+    if (start_vertex >= reach->size) {
+        return 0;
+    }
+
+    /* Return number of the future vertices */
+    return graph_reach_row_vertices(reach->future + start_vertex * reach->words, reach->words, vertex_path);
+}
+
+/**
+ * @brief Function to get the anticone vertices of the selected vertex from
+ * the reachability index, the vertices that are neither in its past nor in
+ * its future, in increasing order. The two rows are combined word by word,
+ * so no traversal and no allocation is done.
+ * 
+ * @param gr a pointer to the allocated graph object of the index
+ * @param reach a pointer to an allocated reachability index object
+ * @param start_vertex a vertex to get its anticone vertices
+ * @param vertex_path an allocated array to save all anticone vertices
+ * @return size_t size of the anticone vertices or 0 if function failed
+ */
+size_t graph_reach_anticone_vertices(const graph_t * const __restrict__ gr, const graph_reach_index_t * const __restrict__ reach, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valid */
+    if ((NULL == gr) || (NULL == reach) || (start_vertex >= gr->size) || (NULL == gr->vertices[start_vertex]) || (gr->size < reach->size) || (NULL == vertex_path)) {
+        return 0;
+    }
+
+    const uint64_t *past = NULL;
+    const uint64_t *future = NULL;
+
+    /* Vertices added after the last insertion have empty rows */
+    if (start_vertex < reach->size) {
+        past = reach->past + start_vertex * reach->words;
+        future = reach->future + start_vertex * reach->words;
+    }
+
+    size_t traversed_size = 0;
+
+    for (size_t word = 0; 64 * word < gr->size; ++word) {
+        uint64_t bits = ~(uint64_t)0;
+
+        if ((NULL != past) && (word < reach->words)) {
+            bits = ~(past[word] | future[word]);
+        }
+
+        /* Drop the bits after the last vertex */
+        if (gr->size - 64 * word < 64) {
+            bits &= ((uint64_t)1 << (gr->size - 64 * word)) - 1;
+        }
+
+        if (start_vertex / 64 == word) {
+            bits &= ~((uint64_t)1 << (start_vertex % 64));
+        }
+
+        for (; 0 != bits; bits &= bits - 1) {
+            const size_t vertex = 64 * word + (size_t)__builtin_ctzll(bits);
+
+            /* Deleted vertices are not part of any anticone */
+            if (NULL != gr->vertices[vertex]) {
+                vertex_path[traversed_size++] = vertex;
+            }
+        }
+    }
+
+    /* Return the size of the anticone vertices */
+    return traversed_size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a reachability index, the
+ * used part of the rows is counted as array bytes and the rows of the free
+ * capacity as slack.
+ * 
+ * @param reach a pointer to an allocated reachability index object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_reach_memory_usage(const graph_reach_index_t * const __restrict__ reach, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == reach) {
+        return SCL_NULL_GRAPH_REACH_INDEX;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*reach);
+    usage->node_bytes = 0;
+    usage->payload_bytes = 0;
+    usage->array_bytes = 2 * reach->size * reach->words * sizeof(*reach->past);
+    usage->slack_bytes = 2 * (reach->capacity - reach->size) * reach->words * sizeof(*reach->past);
+    usage->nodes = reach->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Compare function to create a min priority queue of distances.
+ * 
+ * @param elem1 constant pointer to first distance to compare
+ * @param elem2 constant pointer to second distance to compare
+ * @return int32_t 1 if elem1 < elem2, -1 if elem1 > elem2, 0 if elem1 == elem2
+ */
+static int32_t min_heap_cmp_func(const void * const elem1, const void * const elem2) {
+    if ((NULL != elem1) && (NULL != elem2)) {
+        const graph_weight_t * const f_elem1 = elem1;
+        const graph_weight_t * const f_elem2 = elem2;
+
+        if (*f_elem1 > *f_elem2) {
+            return -1;
+        } else if (*f_elem1 < *f_elem2) {
+            return 1;
+        } else {
+            return 0;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Function to compute the minimum distances starting
+ * from selected vertex to all other graph vertices.
+ * If the selected vertex has no path to another vertex the
+ * distance will be GRAPH_WEIGHT_MAX. The distances will be computed
+ * by dijkstra method, so graphs with negative cycles will fail.
+ * The parent path array can be `NULL`.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param start_vertex vertex to compute the distances beginning from it
+ * @param vertex_dists an allocated array with all distances beginning from start_vertex
+ * @param vertex_parents an array with vertices showing the minimum path from
+ * start_vertex to any other vertex
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_dijkstra(const graph_t * const __restrict__ gr, size_t start_vertex, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if distances array is allocated */
+    if (NULL == vertex_dists) {
+        return SCL_NULL_VERTICES_DISTANCES;
+    }
+
+    /* Check if start vertex is in the graph */
+    if (start_vertex >= gr->size) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    if (NULL != vertex_parents) {
+        for (size_t iter = 0; iter < gr->size; ++iter) {
+            vertex_parents[iter] = SIZE_MAX;
+        }
+
+        vertex_parents[start_vertex] = -1;
+    }
+
+    /* Set default values */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        vertex_dists[iter] = GRAPH_WEIGHT_MAX;
+    }
+
+    vertex_dists[start_vertex] = 0;
+
+    /* Create the min heap indexed by the vertices */
+    indexed_priority_queue_t *min_heap = create_indexed_priority_queue(gr->size, &min_heap_cmp_func, NULL, sizeof(*vertex_dists));
+
+    if (NULL == min_heap) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    scl_error_t err = SCL_OK;
+
+    /* Insert every vertex with its default distance */
+    for (size_t iter = 0; (iter < gr->size) && (SCL_OK == err); ++iter) {
+        err = indexed_pri_queue_push(min_heap, iter, &vertex_dists[iter]);
+    }
+
+    if (SCL_OK != err) {
+        free_indexed_priority_queue(min_heap);
+
+        return err;
+    }
+
+    /* Perform the dijkstra's algorithm */
+    while (!is_indexed_priq_empty(min_heap)) {
+
+        /* Get the vertex with the minimum distance */
+        size_t min_dist_vertex = indexed_pri_queue_top(min_heap);
+
+        err = indexed_pri_queue_pop(min_heap);
+
+        if (SCL_OK != err) {
+            free_indexed_priority_queue(min_heap);
+
+            return err;
+        }
+
+        if (NULL == gr->vertices[min_dist_vertex]) {
+            free_indexed_priority_queue(min_heap);
+
+            return SCL_NULL_GRAPH_VERTEX;
+        }
+
+        graph_link_t *link = gr->vertices[min_dist_vertex]->link;
+
+        /* Iterate through edges of the current minimum vertex */
+        for (; link != NULL; link = link->next) {
+
+            /* Update destination vertex distance if any improvement can be done */
+            if ((0 != indexed_pri_queue_contains(min_heap, link->vertex)) &&
+                (vertex_dists[min_dist_vertex] != GRAPH_WEIGHT_MAX) &&
+                (link->edge_len + vertex_dists[min_dist_vertex] < vertex_dists[link->vertex])) {
+                if (NULL != vertex_parents) {
+                    vertex_parents[link->vertex] = min_dist_vertex;
+                }
+
+                vertex_dists[link->vertex] = vertex_dists[min_dist_vertex] + link->edge_len;
+                SCL_STATS_ADD(gr, relaxations, 1);
+
+                /* Move the vertex up in O(log V) */
+                err = indexed_pri_queue_change_priority(min_heap, link->vertex, &vertex_dists[link->vertex]);
+
+                if (SCL_OK != err) {
+                    free_indexed_priority_queue(min_heap);
+
+                    return err;
+                }
+            }
+        }
+    }
+
+    /* Free priority queue and return SCL_OK */
+    return free_indexed_priority_queue(min_heap);
+}
+
+/**
+ * @brief Function to compute the minimum distances starting from
+ * selected vertex to all other graph vertices, for graphs whose edges
+ * have non-negative integer lengths. The distances are kept as `uint64_t`
+ * keys of a radix heap, so no `graph_weight_t` is compared and a vertex
+ * is pushed again (instead of moved) when its distance improves, which
+ * makes every heap operation amortized O(log C), C being the largest edge
+ * length. If the search meets a length that is negative, fractional or
+ * not lower than 2^64, or a distance that does not fit in 64 bits, the
+ * distances are computed again by graph_dijkstra. The output is the same
+ * as the output of graph_dijkstra and the parent path array can be `NULL`.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param start_vertex vertex to compute the distances beginning from it
+ * @param vertex_dists an allocated array with all distances beginning from start_vertex
+ * @param vertex_parents an array with vertices showing the minimum path from
+ * start_vertex to any other vertex
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_dijkstra_radix(const graph_t * const __restrict__ gr, size_t start_vertex, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if distances array is allocated */
+    if (NULL == vertex_dists) {
+        return SCL_NULL_VERTICES_DISTANCES;
+    }
+
+    /* Check if start vertex is in the graph */
+    if (start_vertex >= gr->size) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    if (NULL == gr->vertices[start_vertex]) {
+        return SCL_NULL_GRAPH_VERTEX;
+    }
+
+    /* Distances of the vertices, UINT64_MAX for the vertices not reached yet */
+    uint64_t *keys = scl_malloc(gr->allocator, sizeof(*keys) * gr->size);
+
+    if (NULL == keys) {
+        errno = ENOMEM;
+        perror("Not enough memory for radix dijkstra distances");
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    radix_heap_t *min_heap = create_radix_heap(NULL, sizeof(start_vertex));
+
+    if (NULL == min_heap) {
+        scl_free(gr->allocator, keys);
+
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL != vertex_parents) {
+        for (size_t iter = 0; iter < gr->size; ++iter) {
+            vertex_parents[iter] = SIZE_MAX;
+        }
+
+        vertex_parents[start_vertex] = -1;
+    }
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        keys[iter] = UINT64_MAX;
+    }
+
+    keys[start_vertex] = 0;
+
+    scl_error_t err = radix_heap_push(min_heap, 0, &start_vertex);
+    uint8_t integral = 1;
+
+    /* Perform the dijkstra's algorithm */
+    while ((SCL_OK == err) && (0 != integral) && (0 == is_radix_heap_empty(min_heap))) {
+        uint64_t min_dist = 0;
+        size_t min_dist_vertex = 0;
+
+        err = radix_heap_pop(min_heap, &min_dist, &min_dist_vertex);
+
+        /* The vertex was pushed again with a lower distance */
+        if ((SCL_OK != err) || (min_dist != keys[min_dist_vertex])) {
+            continue;
+        }
+
+        /* Iterate through edges of the current minimum vertex */
+        for (const graph_link_t *link = gr->vertices[min_dist_vertex]->link; link != NULL; link = link->next) {
+            const graph_weight_t edge_len = link->edge_len;
+
+            if (!(edge_len >= 0) || !(edge_len < 0x1p64L) || ((graph_weight_t)(uint64_t)edge_len != edge_len)) {
+                integral = 0;
+                break;
+            }
+
+            const uint64_t new_dist = min_dist + (uint64_t)edge_len;
+
+            if (new_dist < min_dist) {
+                integral = 0;
+                break;
+            }
+
+            /* Update destination vertex distance if any improvement can be done */
+            if (new_dist < keys[link->vertex]) {
+                if (NULL != vertex_parents) {
+                    vertex_parents[link->vertex] = min_dist_vertex;
+                }
+
+                keys[link->vertex] = new_dist;
+                SCL_STATS_ADD(gr, relaxations, 1);
+
+                err = radix_heap_push(min_heap, new_dist, &link->vertex);
+
+                if (SCL_OK != err) {
+                    break;
+                }
+            }
+        }
+    }
+
+    free_radix_heap(min_heap);
+
+    /* Lengths are not integers, use the comparison heap */
+    if ((SCL_OK == err) && (0 == integral)) {
+        scl_free(gr->allocator, keys);
+
+        return graph_dijkstra(gr, start_vertex, vertex_dists, vertex_parents);
+    }
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        vertex_dists[iter] = (UINT64_MAX == keys[iter]) ? GRAPH_WEIGHT_MAX : (graph_weight_t)keys[iter];
+    }
+
+    scl_free(gr->allocator, keys);
+
+    return err;
+}
+
+/**
+ * @brief Function to compute the minimum cost spanning tree
+ * of the selected graph where the root of the spanning tree
+ * is the start_index vertex. 
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param start_vertex vertex to start to compute the spanning tree
+ * @param vertex_dists an allocated array with all distances beginning from start_vertex
+ * @param vertex_parents an allocated array with vertices showing the minimum cost spanning tree
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_prim(const graph_t * const __restrict__ gr, size_t start_index, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if distances array is allocated */
+    if (NULL == vertex_dists) {
+        return SCL_NULL_VERTICES_DISTANCES;
+    }
+
+    /* Check if parents array is allocated */
+    if (NULL == vertex_parents) {
+        return SCL_NULL_VERTICES_PARENTS;
+    }
+
+    /* Check if start vertex is in the graph */
+    if (start_index >= gr->size) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    /* Set default values */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        vertex_dists[iter] = GRAPH_WEIGHT_MAX;
+        vertex_parents[iter] = SIZE_MAX;
+    }
+
+    vertex_parents[start_index] = -1;
+    vertex_dists[start_index] = 0;
+
+    /* Create the min heap indexed by the vertices */
+    indexed_priority_queue_t *min_heap = create_indexed_priority_queue(gr->size, &min_heap_cmp_func, NULL, sizeof(*vertex_dists));
+
+    if (NULL == min_heap) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    scl_error_t err = SCL_OK;
+
+    /* Insert every vertex with its default distance */
+    for (size_t iter = 0; (iter < gr->size) && (SCL_OK == err); ++iter) {
+        err = indexed_pri_queue_push(min_heap, iter, &vertex_dists[iter]);
+    }
+
+    if (SCL_OK != err) {
+        free_indexed_priority_queue(min_heap);
+
+        return err;
+    }
+
+    /* Perform the prim's algorithm */
+    while (!is_indexed_priq_empty(min_heap)) {
+
+        /* Get the vertex with the minimum distance */
+        size_t min_dist_vertex = indexed_pri_queue_top(min_heap);
+
+        err = indexed_pri_queue_pop(min_heap);
+
+        if (SCL_OK != err) {
+            free_indexed_priority_queue(min_heap);
+
+            return err;
+        }
+
+        if (NULL == gr->vertices[min_dist_vertex]) {
+            free_indexed_priority_queue(min_heap);
+
+            return SCL_NULL_GRAPH_VERTEX;
+        }
+
+        graph_link_t *link = gr->vertices[min_dist_vertex]->link;
+
+        /* Iterate through edges of the current minimum vertex */
+        for (; link != NULL; link = link->next) {
+
+            /* Update destination vertex distance if any improvement can be done */
+            if ((0 != indexed_pri_queue_contains(min_heap, link->vertex)) &&
+                (vertex_dists[min_dist_vertex] != GRAPH_WEIGHT_MAX) &&
+                (link->edge_len < vertex_dists[link->vertex])) {
+
+                vertex_parents[link->vertex] = min_dist_vertex;
+                vertex_dists[link->vertex] = link->edge_len;
+
+                /* Move the vertex up in O(log V) */
+                err = indexed_pri_queue_change_priority(min_heap, link->vertex, &vertex_dists[link->vertex]);
+
+                if (SCL_OK != err) {
+                    free_indexed_priority_queue(min_heap);
+
+                    return err;
+                }
+            }
+        }
+    }
+
+    /* Free priority queue and return SCL_OK */
+    return free_indexed_priority_queue(min_heap);
+}
+
+/**
+ * @brief Function to calculate a matrix of minimum distances between
+ * any two vertices if no path exists between two vertices than
+ * GRAPH_WEIGHT_MAX will be calculated.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param vertices_dists an allocated matrix of gr->size X gr->size dimension
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_floyd_warshall(const graph_t * const __restrict__ gr, graph_weight_t ** __restrict__ vertices_dists) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if vertices distances matrix is allocated */
+    if (NULL == vertices_dists) {
+        return SCL_NULL_PATH_MATRIX;
+    }
+
+    /* Set default values of the distances matrix */
+    for (size_t iter_i = 0; iter_i < gr->size; ++iter_i) {
+        for (size_t iter_j = 0; iter_j < gr->size; ++iter_j) {
+            vertices_dists[iter_i][iter_j] = GRAPH_WEIGHT_MAX;
+        }
+    }
+
+    /* Set the initial edge length between two vertices */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL == gr->vertices[iter]) {
+            continue;
+        }
+
+        graph_link_t *link = gr->vertices[iter]->link;
+
+        for (; link != NULL; link = link->next) {
+            vertices_dists[iter][link->vertex] = link->edge_len;
+        }
+    }
+
+    /* Calculate the minimum distances between any two nodes */
+    for (size_t iter_k = 0; iter_k < gr->size; ++iter_k) {
+        for (size_t iter_i = 0; iter_i < gr->size; ++iter_i) {
+            for (size_t iter_j = 0; iter_j < gr->size; ++iter_j) {
+                /* Paths through a not reached vertex are skipped, so integer weights do not overflow */
+                if ((GRAPH_WEIGHT_MAX != vertices_dists[iter_i][iter_k]) && (GRAPH_WEIGHT_MAX != vertices_dists[iter_k][iter_j]) &&
+                    (vertices_dists[iter_i][iter_k] + vertices_dists[iter_k][iter_j] < vertices_dists[iter_i][iter_j])) {
+                    vertices_dists[iter_i][iter_j] = vertices_dists[iter_i][iter_k] + vertices_dists[iter_k][iter_j];
+                    SCL_STATS_ADD(gr, relaxations, 1);
+                }
+            }
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Number of vertices of one side of a tile of the blocked Floyd-Warshall,
+ * three tiles of doubles (96 KiB) fit in the L2 cache of most processors and the
+ * rows of full tiles have a constant length, so the compiler vectorizes them
+ * 
+ */
+#define GRAPH_FLOYD_WARSHALL_BLOCK 64
+
+/**
+ * @brief State of one blocked Floyd-Warshall shared by the tasks of every phase
+ * 
+ */
+typedef struct graph_floyd_warshall_s {
+    void *dists;                                            /* Row-major distances matrix (double or float) */
+    size_t size;                                            /* Number of vertices (rows and columns) */
+    size_t number_of_blocks;                                /* Number of tiles of one row of tiles */
+    size_t block;                                           /* Index of the tiles holding the current middle vertices */
+    void (*tile)(const struct graph_floyd_warshall_s * const __restrict__ fw, size_t row_block, size_t col_block);
+} graph_floyd_warshall_t;
+
+/**
+ * @brief Relaxes one row of a tile through one middle vertex, the two rows
+ * are never the same (a row does not get shorter through its own vertex).
+ * 
+ * @param row pointer to the first distance of the tile row
+ * @param middle_row pointer to the first distance of the middle vertex row (same columns)
+ * @param dist distance from the row vertex to the middle vertex
+ * @param length number of columns of the tile
+ */
+static inline void graph_floyd_warshall_row_double(double * __restrict__ row, const double * __restrict__ middle_row, double dist, size_t length) {
+    if (GRAPH_FLOYD_WARSHALL_BLOCK == length) {
+        for (size_t iter = 0; iter < GRAPH_FLOYD_WARSHALL_BLOCK; ++iter) {
+            double new_dist = dist + middle_row[iter];
+            row[iter] = (new_dist < row[iter]) ? new_dist : row[iter];
+        }
+    } else {
+        for (size_t iter = 0; iter < length; ++iter) {
+            double new_dist = dist + middle_row[iter];
+            row[iter] = (new_dist < row[iter]) ? new_dist : row[iter];
+        }
+    }
+}
+
+/**
+ * @brief Relaxes one row of a tile through one middle vertex, the two rows
+ * are never the same (a row does not get shorter through its own vertex).
+ * 
+ * @param row pointer to the first distance of the tile row
+ * @param middle_row pointer to the first distance of the middle vertex row (same columns)
+ * @param dist distance from the row vertex to the middle vertex
+ * @param length number of columns of the tile
+ */
+static inline void graph_floyd_warshall_row_float(float * __restrict__ row, const float * __restrict__ middle_row, float dist, size_t length) {
+    if (GRAPH_FLOYD_WARSHALL_BLOCK == length) {
+        for (size_t iter = 0; iter < GRAPH_FLOYD_WARSHALL_BLOCK; ++iter) {
+            float new_dist = dist + middle_row[iter];
+            row[iter] = (new_dist < row[iter]) ? new_dist : row[iter];
+        }
+    } else {
+        for (size_t iter = 0; iter < length; ++iter) {
+            float new_dist = dist + middle_row[iter];
+            row[iter] = (new_dist < row[iter]) ? new_dist : row[iter];
+        }
+    }
+}
+
+/**
+ * @brief Relaxes the paths of one tile of a double matrix through
+ * every middle vertex of the current block of the blocked Floyd-Warshall.
+ * 
+ * @param fw pointer to the Floyd-Warshall state
+ * @param row_block index of the row of the tile
+ * @param col_block index of the column of the tile
+ */
+static void graph_floyd_warshall_tile_double(const graph_floyd_warshall_t * const __restrict__ fw, size_t row_block, size_t col_block) {
+    double *dists = fw->dists;
+
+    const size_t first_row = row_block * GRAPH_FLOYD_WARSHALL_BLOCK;
+    const size_t last_row = (first_row + GRAPH_FLOYD_WARSHALL_BLOCK < fw->size) ? (first_row + GRAPH_FLOYD_WARSHALL_BLOCK) : fw->size;
+    const size_t first_col = col_block * GRAPH_FLOYD_WARSHALL_BLOCK;
+    const size_t length = ((first_col + GRAPH_FLOYD_WARSHALL_BLOCK < fw->size) ? (first_col + GRAPH_FLOYD_WARSHALL_BLOCK) : fw->size) - first_col;
+    const size_t first_middle = fw->block * GRAPH_FLOYD_WARSHALL_BLOCK;
+    const size_t last_middle = (first_middle + GRAPH_FLOYD_WARSHALL_BLOCK < fw->size) ? (first_middle + GRAPH_FLOYD_WARSHALL_BLOCK) : fw->size;
+
+    for (size_t middle = first_middle; middle < last_middle; ++middle) {
+        const double *middle_row = dists + middle * fw->size + first_col;
+
+        for (size_t iter = first_row; iter < last_row; ++iter) {
+            double dist = dists[iter * fw->size + middle];
+
+            if ((iter != middle) && (INFINITY != dist)) {
+                graph_floyd_warshall_row_double(dists + iter * fw->size + first_col, middle_row, dist, length);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Relaxes the paths of one tile of a float matrix through
+ * every middle vertex of the current block of the blocked Floyd-Warshall.
+ * 
+ * @param fw pointer to the Floyd-Warshall state
+ * @param row_block index of the row of the tile
+ * @param col_block index of the column of the tile
+ */
+static void graph_floyd_warshall_tile_float(const graph_floyd_warshall_t * const __restrict__ fw, size_t row_block, size_t col_block) {
+    float *dists = fw->dists;
+
+    const size_t first_row = row_block * GRAPH_FLOYD_WARSHALL_BLOCK;
+    const size_t last_row = (first_row + GRAPH_FLOYD_WARSHALL_BLOCK < fw->size) ? (first_row + GRAPH_FLOYD_WARSHALL_BLOCK) : fw->size;
+    const size_t first_col = col_block * GRAPH_FLOYD_WARSHALL_BLOCK;
+    const size_t length = ((first_col + GRAPH_FLOYD_WARSHALL_BLOCK < fw->size) ? (first_col + GRAPH_FLOYD_WARSHALL_BLOCK) : fw->size) - first_col;
+    const size_t first_middle = fw->block * GRAPH_FLOYD_WARSHALL_BLOCK;
+    const size_t last_middle = (first_middle + GRAPH_FLOYD_WARSHALL_BLOCK < fw->size) ? (first_middle + GRAPH_FLOYD_WARSHALL_BLOCK) : fw->size;
+
+    for (size_t middle = first_middle; middle < last_middle; ++middle) {
+        const float *middle_row = dists + middle * fw->size + first_col;
+
+        for (size_t iter = first_row; iter < last_row; ++iter) {
+            float dist = dists[iter * fw->size + middle];
+
+            if ((iter != middle) && (INFINITY != dist)) {
+                graph_floyd_warshall_row_float(dists + iter * fw->size + first_col, middle_row, dist, length);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Task of the second phase, relaxes one tile from the row
+ * or from the column of tiles of the current block.
+ * 
+ * @param arg pointer to the Floyd-Warshall state
+ * @param task index of the task
+ */
+static void graph_floyd_warshall_cross_task(void * const arg, size_t task) {
+    const graph_floyd_warshall_t *fw = arg;
+
+    if (task < fw->number_of_blocks) {
+        if (task != fw->block) {
+            fw->tile(fw, fw->block, task);
+        }
+    } else if (task - fw->number_of_blocks != fw->block) {
+        fw->tile(fw, task - fw->number_of_blocks, fw->block);
+    }
+}
+
+/**
+ * @brief Task of the third phase, relaxes all the tiles of one row of
+ * tiles that are not in the row or in the column of the current block.
+ * 
+ * @param arg pointer to the Floyd-Warshall state
+ * @param task index of the task (row of tiles)
+ */
+static void graph_floyd_warshall_rest_task(void * const arg, size_t task) {
+    const graph_floyd_warshall_t *fw = arg;
+
+    if (task == fw->block) {
+        return;
+    }
+
+    for (size_t col_block = 0; col_block < fw->number_of_blocks; ++col_block) {
+        if (col_block != fw->block) {
+            fw->tile(fw, task, col_block);
+        }
+    }
+}
+
+/**
+ * @brief Runs the tasks of one phase on the thread pool or on the calling thread.
+ * 
+ * @param fw pointer to the Floyd-Warshall state
+ * @param pool pointer to a thread pool or `NULL`
+ * @param task function running one task
+ * @param number_of_tasks number of tasks of the phase
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_floyd_warshall_phase(graph_floyd_warshall_t * const __restrict__ fw, thread_pool_t * const __restrict__ pool, thread_pool_task_func task, size_t number_of_tasks) {
+    if (NULL != pool) {
+        return thread_pool_run(pool, task, fw, number_of_tasks);
+    }
+
+    for (size_t iter = 0; iter < number_of_tasks; ++iter) {
+        task(fw, iter);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Runs the blocked Floyd-Warshall, for every block of middle vertices
+ * the diagonal tile is relaxed first, then the tiles from its row and column
+ * (they need just the diagonal tile) and then all the other tiles (they need
+ * just one tile of the row and one tile of the column), so the tiles of the
+ * last two phases are independent and may be relaxed by many threads.
+ * 
+ * @param fw pointer to the Floyd-Warshall state
+ * @param pool pointer to a thread pool or `NULL`
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_floyd_warshall_blocked(graph_floyd_warshall_t * const __restrict__ fw, thread_pool_t * const __restrict__ pool) {
+    scl_error_t err = SCL_OK;
+
+    fw->number_of_blocks = (fw->size + GRAPH_FLOYD_WARSHALL_BLOCK - 1) / GRAPH_FLOYD_WARSHALL_BLOCK;
+
+    for (fw->block = 0; fw->block < fw->number_of_blocks; ++(fw->block)) {
+        fw->tile(fw, fw->block, fw->block);
+
+        err = graph_floyd_warshall_phase(fw, pool, &graph_floyd_warshall_cross_task, 2 * fw->number_of_blocks);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        err = graph_floyd_warshall_phase(fw, pool, &graph_floyd_warshall_rest_task, fw->number_of_blocks);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to calculate a matrix of minimum distances between any two
+ * vertices on a contiguous row-major matrix of doubles (the distance from
+ * vertex `i` to vertex `j` is `vertices_dists[i * size + j]`), if no path exists
+ * between two vertices than INFINITY will be calculated. The matrix is relaxed
+ * in tiles that stay in the cache and are vectorized by the compiler, and the
+ * tiles are spread on the threads of the pool.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param pool a pointer to an allocated thread pool or `NULL` to run on the calling thread
+ * @param vertices_dists an allocated array of gr->size * gr->size elements
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_floyd_warshall_double(const graph_t * const __restrict__ gr, thread_pool_t * const __restrict__ pool, double * __restrict__ vertices_dists) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if vertices distances matrix is allocated */
+    if (NULL == vertices_dists) {
+        return SCL_NULL_PATH_MATRIX;
+    }
+
+    /* Set default values of the distances matrix */
+    for (size_t iter = 0; iter < gr->size * gr->size; ++iter) {
+        vertices_dists[iter] = INFINITY;
+    }
+
+    /* Set the initial edge length between two vertices (the shortest one of parallel edges) */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL == gr->vertices[iter]) {
+            continue;
+        }
+
+        for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+            double edge_len = (double)link->edge_len;
+            double *dist = &vertices_dists[iter * gr->size + link->vertex];
+
+            if (edge_len < *dist) {
+                *dist = edge_len;
+            }
+        }
+    }
+
+    graph_floyd_warshall_t fw = { vertices_dists, gr->size, 0, 0, &graph_floyd_warshall_tile_double };
+
+    /* Calculate the minimum distances between any two nodes */
+    return graph_floyd_warshall_blocked(&fw, pool);
+}
+
+/**
+ * @brief Function to calculate a matrix of minimum distances between any two
+ * vertices on a contiguous row-major matrix of floats (the distance from
+ * vertex `i` to vertex `j` is `vertices_dists[i * size + j]`), if no path exists
+ * between two vertices than INFINITY will be calculated. Same algorithm as
+ * **graph_floyd_warshall_double**, a vector holds two times more floats.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param pool a pointer to an allocated thread pool or `NULL` to run on the calling thread
+ * @param vertices_dists an allocated array of gr->size * gr->size elements
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_floyd_warshall_float(const graph_t * const __restrict__ gr, thread_pool_t * const __restrict__ pool, float * __restrict__ vertices_dists) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
+
+    /* Check if vertices distances matrix is allocated */
+    if (NULL == vertices_dists) {
+        return SCL_NULL_PATH_MATRIX;
+    }
+
+    /* Set default values of the distances matrix */
+    for (size_t iter = 0; iter < gr->size * gr->size; ++iter) {
+        vertices_dists[iter] = INFINITY;
+    }
+
+    /* Set the initial edge length between two vertices (the shortest one of parallel edges) */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL == gr->vertices[iter]) {
+            continue;
+        }
+
+        for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+            float edge_len = (float)link->edge_len;
+            float *dist = &vertices_dists[iter * gr->size + link->vertex];
+
+            if (edge_len < *dist) {
+                *dist = edge_len;
+            }
+        }
+    }
+
+    graph_floyd_warshall_t fw = { vertices_dists, gr->size, 0, 0, &graph_floyd_warshall_tile_float };
+
+    /* Calculate the minimum distances between any two nodes */
+    return graph_floyd_warshall_blocked(&fw, pool);
+}
+
+/**
+ * @brief Check if the oriented graph object is strongly connected.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return uint8_t 1 if graph is strongly connected or 0 otherwise
+ */
+uint8_t graph_is_strongly_connected(const graph_t * const __restrict__ gr) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices)) {
+        return 0;
+    }
+
+    graph_traversal_t *trav = create_graph_traversal(gr->size);
+
+    if (NULL == trav) {
+        return 0;
+    }
+
+    /* Check the size of the dfs traversal */
+    size_t dfs_size = graph_dfs_traverse_ctx(gr, trav, 0, NULL);
+
+    /* If all vertices were not traversed that graph is not sc */
+    if (dfs_size != gr->size) {
+        free_graph_traversal(trav);
+        return 0;
+    }
+
+    /* Compute the transposed graph */
+    graph_t *transpose_gr = create_transpose_graph(gr);
+
+    /* Check if transposed graph is valid */
+    if ((NULL == transpose_gr) || (NULL == transpose_gr->vertices)) {
+        free_graph(transpose_gr);
+        free_graph_traversal(trav);
+        return 0;
+    }
+
+    /* Check the size of the dfs traversal of the travsposed graph */
+    dfs_size = graph_dfs_traverse_ctx(transpose_gr, trav, 0, NULL);
+
+    free_graph(transpose_gr);
+    free_graph_traversal(trav);
+
+    /* If all vertices were not traversed in the transposed graph than it is not sc*/
+    if (dfs_size != gr->size) {
+        return 0;
+    }
+
+    /* The graph object is strongly connected */
+    return 1;
+}
+
+/**
+ * @brief Frame of the iterative Tarjan depth-first-search
+ * 
+ */
+typedef struct graph_tarjan_frame_s {
+    size_t vertex;                                          /* Vertex whose edges are searched */
+    const graph_link_t *link;                               /* Next edge of the vertex to search */
+} graph_tarjan_frame_t;
+
+/**
+ * @brief Function to calculate the strongly connected components of a graph
+ * object by the Tarjan algorithm. The depth-first-search keeps its frames in an
+ * array instead of the call stack, so deep graphs do not overflow the stack, and
+ * the result is stored in flat arrays, so the function runs in O(V + E) time and
+ * memory whatever the number of components is.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return graph_scc_t* a new allocated strongly connected components object
+ * or `NULL` if function fails
+ */
+graph_scc_t* graph_tarjan_scc(const graph_t * const __restrict__ gr) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices)) {
+        errno = EINVAL;
+        perror("Graph object is not allocated for strongly connected components");
+        return NULL;
+    }
+
+    const scl_allocator_t *allocator = gr->allocator;
+
+    graph_scc_t *new_scc = scl_malloc(allocator, sizeof(*new_scc));
+
+    if (NULL == new_scc) {
+        errno = ENOMEM;
+        perror("Not enough memory for strongly connected components allocation");
+        return NULL;
+    }
+
+    new_scc->allocator = allocator;
+    new_scc->size = gr->size;
+    new_scc->number_of_components = 0;
+
+    new_scc->component = scl_malloc(allocator, sizeof(*new_scc->component) * (gr->size + 1));
+    new_scc->offsets = scl_malloc(allocator, sizeof(*new_scc->offsets) * (gr->size + 1));
+    new_scc->members = scl_malloc(allocator, sizeof(*new_scc->members) * (gr->size + 1));
+
+    /* Discovery index, lowest reachable index and stack of the search */
+    size_t *index = scl_malloc(allocator, sizeof(*index) * (gr->size + 1));
+    size_t *low_link = scl_malloc(allocator, sizeof(*low_link) * (gr->size + 1));
+    size_t *stack = scl_malloc(allocator, sizeof(*stack) * (gr->size + 1));
+    graph_tarjan_frame_t *frames = scl_malloc(allocator, sizeof(*frames) * (gr->size + 1));
+
+    if ((NULL == new_scc->component) || (NULL == new_scc->offsets) || (NULL == new_scc->members) ||
+        (NULL == index) || (NULL == low_link) || (NULL == stack) || (NULL == frames)) {
+        scl_free(allocator, index);
+        scl_free(allocator, low_link);
+        scl_free(allocator, stack);
+        scl_free(allocator, frames);
+        free_graph_scc(new_scc);
+
+        errno = ENOMEM;
+        perror("Not enough memory for strongly connected components arrays allocation");
+        return NULL;
+    }
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        index[iter] = SIZE_MAX;
+        new_scc->component[iter] = SIZE_MAX;
+    }
+
+    size_t next_index = 0;
+    size_t stack_size = 0;
+    size_t number_of_members = 0;
+
+    new_scc->offsets[0] = 0;
+
+    for (size_t root = 0; root < gr->size; ++root) {
+        if (SIZE_MAX != index[root]) {
+            continue;
+        }
+
+        size_t number_of_frames = 0;
+
+        /* Discover the root vertex */
+        index[root] = low_link[root] = next_index++;
+        stack[stack_size++] = root;
+        frames[number_of_frames].vertex = root;
+        frames[number_of_frames].link = (NULL != gr->vertices[root]) ? gr->vertices[root]->link : NULL;
+        ++number_of_frames;
+
+        while (0 != number_of_frames) {
+            graph_tarjan_frame_t *frame = &frames[number_of_frames - 1];
+            const size_t vertex = frame->vertex;
+
+            if (NULL != frame->link) {
+                const size_t next_vertex = frame->link->vertex;
+
+                frame->link = frame->link->next;
+
+                if (SIZE_MAX == index[next_vertex]) {
+
+                    /* Discover the next vertex and search its edges first */
+                    index[next_vertex] = low_link[next_vertex] = next_index++;
+                    stack[stack_size++] = next_vertex;
+                    frames[number_of_frames].vertex = next_vertex;
+                    frames[number_of_frames].link = (NULL != gr->vertices[next_vertex]) ? gr->vertices[next_vertex]->link : NULL;
+                    ++number_of_frames;
+                } else if ((SIZE_MAX == new_scc->component[next_vertex]) && (index[next_vertex] < low_link[vertex])) {
+
+                    /* The next vertex is still on the stack */
+                    low_link[vertex] = index[next_vertex];
+                }
+
+                continue;
+            }
+
+            /* All edges of the vertex are searched, check if it is the root of a component */
+            --number_of_frames;
+
+            if (low_link[vertex] == index[vertex]) {
+                size_t member = SIZE_MAX;
+
+                do {
+                    member = stack[--stack_size];
+                    new_scc->component[member] = new_scc->number_of_components;
+                    new_scc->members[number_of_members++] = member;
+                } while (member != vertex);
+
+                ++(new_scc->number_of_components);
+                new_scc->offsets[new_scc->number_of_components] = number_of_members;
+            }
+
+            /* Pass the lowest index to the parent vertex */
+            if (0 != number_of_frames) {
+                const size_t parent = frames[number_of_frames - 1].vertex;
+
+                if (low_link[vertex] < low_link[parent]) {
+                    low_link[parent] = low_link[vertex];
+                }
+            }
+        }
+    }
+
+    scl_free(allocator, index);
+    scl_free(allocator, low_link);
+    scl_free(allocator, stack);
+    scl_free(allocator, frames);
+
+    /* Return the strongly connected components */
+    return new_scc;
+}
+
+/**
+ * @brief Function to free all memory allocated for a strongly connected components object.
+ * 
+ * @param scc pointer to an allocated strongly connected components object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_graph_scc(graph_scc_t * const __restrict__ scc) {
+    /* Check if strongly connected components object is valid */
+    if (NULL == scc) {
+        return SCL_NULL_GRAPH_SCC;
+    }
+
+    scl_free(scc->allocator, scc->component);
+    scl_free(scc->allocator, scc->offsets);
+    scl_free(scc->allocator, scc->members);
+    scl_free(scc->allocator, scc);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to calculate all the strongly connected components from the graph.
+ * Function will return a matrix of vertices that will calculate every strongly connected
+ * components. The number_of_scc will show the number of strongly connected components.
+ * In the matrix the first cell from every row will be the number of the vertices from a
+ * strongly connected component. The components are computed by **graph_tarjan_scc**
+ * and the rows are in topological order, every row is allocated for its own vertices.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param number_of_scc pointer to location of the number of strongly connected components
+ * @return size_t** matrix containing on every row the vertices from a strongly connected
+ * component or NULL if function fails
+ */
+size_t** graph_strongly_connected_components(const graph_t * const __restrict__ gr, size_t *number_of_scc) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == number_of_scc)) {
+        return NULL;
+    }
+
+    *number_of_scc = 0;
+
+    graph_scc_t *scc = graph_tarjan_scc(gr);
+
+    if (NULL == scc) {
+        return NULL;
+    }
+
+    /* No strongly connected component */
+    if (0 == scc->number_of_components) {
+        free_graph_scc(scc);
+        return NULL;
+    }
+
+    size_t **scc_paths = malloc(sizeof(*scc_paths) * scc->number_of_components);
+
+    if (NULL == scc_paths) {
+        free_graph_scc(scc);
+        return NULL;
+    }
+
+    /* Tarjan numbers the components in reverse topological order */
+    for (size_t iter = scc->number_of_components; iter > 0; --iter) {
+        const size_t first = scc->offsets[iter - 1];
+        const size_t members = scc->offsets[iter] - first;
+
+        size_t *scc_path = malloc(sizeof(*scc_path) * (members + 1));
+
+        if (NULL == scc_path) {
+            break;
+        }
+
+        scc_path[0] = members;
+        memcpy(scc_path + 1, scc->members + first, sizeof(*scc_path) * members);
+
+        scc_paths[(*number_of_scc)++] = scc_path;
+    }
+
+    free_graph_scc(scc);
+
+    if (0 == *number_of_scc) {
+        free(scc_paths);
+        scc_paths = NULL;
+    }
+
+    /* Return the matrix of the strongly connected components */
+    return scc_paths;
+}
+
+/**
+ * @brief Function to build an immutable Compressed Sparse Row snapshot
+ * of a graph object. The edges of every vertex are copied into contiguous
+ * arrays in the same order as in the graph object, so the algorithms run
+ * on the snapshot visit the vertices in the same order as on the graph.
+ * Later changes of the graph object are not seen by the snapshot.
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @return graph_csr_t* a new allocated graph CSR snapshot or `NULL` if function fails
+ */
+graph_csr_t* graph_to_csr(const graph_t * const __restrict__ gr) {
+    /* Check if graph object is valid */
+    if ((NULL == gr) || (NULL == gr->vertices)) {
+        errno = EINVAL;
+        perror("Graph for CSR snapshot is not allocated");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new graph CSR snapshot on heap */
+    graph_csr_t *new_csr = scl_malloc(allocator, sizeof(*new_csr));
+
+    /* Check if graph CSR snapshot was allocated */
+    if (NULL == new_csr) {
+        errno = ENOMEM;
+        perror("Not enough memory for graph CSR snapshot allocation");
+        return NULL;
+    }
+
+    new_csr->allocator = allocator;
+    (void)SCL_STATS_RESET(new_csr);
+    new_csr->size = gr->size;
+    new_csr->number_of_edges = 0;
+    new_csr->in_offsets = NULL;
+    new_csr->sources = NULL;
+    new_csr->mapping = NULL;
+    new_csr->mapping_size = 0;
+
+    /* Count the edges of the graph */
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        if (NULL != gr->vertices[iter]) {
+            for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+                ++(new_csr->number_of_edges);
+            }
+        }
+    }
+
+    /* Allocate the arrays of the snapshot (at least one edge slot, so no allocation has zero size) */
+    size_t edge_slots = (0 == new_csr->number_of_edges) ? 1 : new_csr->number_of_edges;
+
+    new_csr->offsets = scl_malloc(allocator, sizeof(*new_csr->offsets) * (gr->size + 1));
+    new_csr->targets = scl_malloc(allocator, sizeof(*new_csr->targets) * edge_slots);
+    new_csr->weights = scl_malloc(allocator, sizeof(*new_csr->weights) * edge_slots);
+
+    /* Check if the arrays were allocated */
+    if ((NULL == new_csr->offsets) || (NULL == new_csr->targets) || (NULL == new_csr->weights)) {
+        free_graph_csr(new_csr);
+
+        errno = ENOMEM;
+        perror("Not enough memory for graph CSR snapshot arrays allocation");
+        return NULL;
+    }
+
+    /* Copy the edges of every vertex one after another */
+    size_t edge_index = 0;
+
+    for (size_t iter = 0; iter < gr->size; ++iter) {
+        new_csr->offsets[iter] = edge_index;
+
+        if (NULL != gr->vertices[iter]) {
+            for (const graph_link_t *link = gr->vertices[iter]->link; NULL != link; link = link->next) {
+                new_csr->targets[edge_index] = link->vertex;
+                new_csr->weights[edge_index] = link->edge_len;
+
+                ++edge_index;
+            }
+        }
+    }
+
+    new_csr->offsets[gr->size] = edge_index;
+
+    /* Return the new graph CSR snapshot */
+    return new_csr;
+}
+
+/**
+ * @brief Function to build a Compressed Sparse Row snapshot straight from
+ * an edge list, without building a graph object first. The edges are
+ * grouped by their start vertex by a counting sort in O(N + M) time and
+ * the snapshot is the same as graph_to_csr of a graph that got the same
+ * edges by graph_insert_edges_bulk.
+ * 
+ * @param number_of_vertices number of vertices of the snapshot
+ * @param start_vertices array of vertices that the edges start from
+ * @param end_vertices array of vertices that the edges end to
+ * @param edge_lens array of the lengths of the edges, `NULL` for edges of length 1
+ * @param number_of_edges number of edges of the snapshot
+ * @return graph_csr_t* a new allocated graph CSR snapshot or `NULL` if function fails
+ */
+graph_csr_t* graph_csr_from_edges(size_t number_of_vertices, const size_t * __restrict__ start_vertices, const size_t * __restrict__ end_vertices, const graph_weight_t * __restrict__ edge_lens, size_t number_of_edges) {
+    /* Check if input data is valid */
+    if ((0 == number_of_vertices) || (number_of_vertices > GRAPH_VERTEX_ID_MAX)
+        || ((0 != number_of_edges) && ((NULL == start_vertices) || (NULL == end_vertices)))) {
+        errno = EINVAL;
+        perror("Edge list for CSR snapshot is not valid");
+        return NULL;
+    }
+
+    /* Check every edge before allocating the snapshot */
+    for (size_t iter = 0; iter < number_of_edges; ++iter) {
+        if ((start_vertices[iter] >= number_of_vertices) || (end_vertices[iter] >= number_of_vertices)
+            || ((NULL != edge_lens) && (GRAPH_WEIGHT_MAX == edge_lens[iter]))) {
+            errno = EINVAL;
+            perror("Edge from the list for CSR snapshot is not valid");
+            return NULL;
+        }
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new graph CSR snapshot on heap */
+    graph_csr_t *new_csr = scl_malloc(allocator, sizeof(*new_csr));
+
+    /* Check if graph CSR snapshot was allocated */
+    if (NULL == new_csr) {
+        errno = ENOMEM;
+        perror("Not enough memory for graph CSR snapshot allocation");
+        return NULL;
+    }
+
+    new_csr->allocator = allocator;
+    (void)SCL_STATS_RESET(new_csr);
+    new_csr->size = number_of_vertices;
+    new_csr->number_of_edges = number_of_edges;
+    new_csr->in_offsets = NULL;
+    new_csr->sources = NULL;
+    new_csr->mapping = NULL;
+    new_csr->mapping_size = 0;
+
+    /* Allocate the arrays of the snapshot (at least one edge slot, so no allocation has zero size) */
+    size_t edge_slots = (0 == number_of_edges) ? 1 : number_of_edges;
+
+    new_csr->offsets = scl_calloc(allocator, number_of_vertices + 1, sizeof(*new_csr->offsets));
+    new_csr->targets = scl_malloc(allocator, sizeof(*new_csr->targets) * edge_slots);
+    new_csr->weights = scl_malloc(allocator, sizeof(*new_csr->weights) * edge_slots);
+
+    /* Check if the arrays were allocated */
+    if ((NULL == new_csr->offsets) || (NULL == new_csr->targets) || (NULL == new_csr->weights)) {
+        free_graph_csr(new_csr);
+
+        errno = ENOMEM;
+        perror("Not enough memory for graph CSR snapshot arrays allocation");
+        return NULL;
+    }
+
+    /* Count the edges of every vertex and turn the counts into end offsets */
+    for (size_t iter = 0; iter < number_of_edges; ++iter) {
+        ++(new_csr->offsets[start_vertices[iter] + 1]);
+    }
+
+    for (size_t iter = 0; iter < number_of_vertices; ++iter) {
+        new_csr->offsets[iter + 1] += new_csr->offsets[iter];
+    }
+
+    /*
+     * Fill every row from its end, so the last inserted edge comes first as in
+     * the linked lists of a graph object, every row ends at its start offset
+     */
+    for (size_t iter = 0; iter < number_of_edges; ++iter) {
+        size_t edge_index = --(new_csr->offsets[start_vertices[iter] + 1]);
+
+        new_csr->targets[edge_index] = end_vertices[iter];
+        new_csr->weights[edge_index] = (NULL != edge_lens) ? edge_lens[iter] : 1;
+    }
+
+    /* Shift the offsets back to the first edge of every vertex */
+    for (size_t iter = 0; iter < number_of_vertices; ++iter) {
+        new_csr->offsets[iter] = new_csr->offsets[iter + 1];
+    }
+
+    new_csr->offsets[number_of_vertices] = number_of_edges;
+
+    /* Return the new graph CSR snapshot */
+    return new_csr;
+}
+
+/**
+ * @brief Function to free all memory allocated for a graph CSR snapshot.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_graph_csr(graph_csr_t * const __restrict__ csr) {
+    /* Check if graph CSR snapshot needs to be freed */
+    if (NULL == csr) {
+        return SCL_NULL_GRAPH_CSR;
+    }
+
+    if (NULL != csr->mapping) {
+        const uint8_t *mapping_begin = csr->mapping;
+        const uint8_t *mapping_end = mapping_begin + csr->mapping_size;
+
+        /* In edges indexed after the load are on heap */
+        if (((const uint8_t *)csr->in_offsets < mapping_begin) || ((const uint8_t *)csr->in_offsets >= mapping_end)) {
+            scl_free(csr->allocator, csr->in_offsets);
+            scl_free(csr->allocator, csr->sources);
+        }
+
+        /* Every other array lives in the mapping of the file */
+        munmap(csr->mapping, csr->mapping_size);
+    } else {
+        scl_free(csr->allocator, csr->offsets);
+        scl_free(csr->allocator, csr->targets);
+        scl_free(csr->allocator, csr->weights);
+        scl_free(csr->allocator, csr->in_offsets);
+        scl_free(csr->allocator, csr->sources);
+    }
+
+    scl_free(csr->allocator, csr);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Offsets in bytes of the arrays of a graph file and of its end.
+ * 
+ */
+typedef struct graph_file_layout_s {
+    size_t offsets;                                         /* Offset of the offsets array */
+    size_t targets;                                         /* Offset of the targets array */
+    size_t weights;                                         /* Offset of the weights array */
+    size_t in_offsets;                                      /* Offset of the in_offsets array */
+    size_t sources;                                         /* Offset of the sources array */
+    size_t end;                                             /* Length in bytes of the whole file */
+} graph_file_layout_t;
+
+/**
+ * @brief Subroutine function to get the length in bytes of one array of a
+ * graph file. Every array takes at least one element and is padded up to a
+ * multiple of GRAPH_FILE_ALIGN, so every array starts strictly inside the file.
+ * 
+ * @param number_of_elem number of elements of the array
+ * @param elem_size length in bytes of one element
+ * @return size_t length in bytes of the array in the file
+ */
+static inline size_t graph_file_section(size_t number_of_elem, size_t elem_size) {
+    size_t bytes = ((0 == number_of_elem) ? 1 : number_of_elem) * elem_size;
+
+    return (bytes + GRAPH_FILE_ALIGN - 1) / GRAPH_FILE_ALIGN * GRAPH_FILE_ALIGN;
+}
+
+/**
+ * @brief Subroutine function to compute the layout of a graph file from
+ * the number of vertices and edges. Function fails if the file would not
+ * fit in the address space.
+ * 
+ * @param size number of vertices
+ * @param number_of_edges number of edges
+ * @param has_in_edges 1 if the in edges are stored
+ * @param layout pointer to the layout to fill
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_file_layout(uint64_t size, uint64_t number_of_edges, uint8_t has_in_edges, graph_file_layout_t * const __restrict__ layout) {
+    /* Every section must fit in size_t even after all of them are added */
+    if ((size >= SIZE_MAX / (4 * sizeof(size_t))) || (number_of_edges >= SIZE_MAX / (4 * (sizeof(graph_weight_t) + 2 * sizeof(graph_vertex_id_t))))) {
+        return SCL_INVALID_INPUT;
+    }
+
+    layout->offsets = graph_file_section(1, sizeof(graph_file_header_t));
+    layout->targets = layout->offsets + graph_file_section(size + 1, sizeof(size_t));
+    layout->weights = layout->targets + graph_file_section(number_of_edges, sizeof(graph_vertex_id_t));
+    layout->in_offsets = layout->weights + graph_file_section(number_of_edges, sizeof(graph_weight_t));
+    layout->sources = layout->in_offsets;
+    layout->end = layout->in_offsets;
+
+    if (0 != has_in_edges) {
+        layout->sources = layout->in_offsets + graph_file_section(size + 1, sizeof(size_t));
+        layout->end = layout->sources + graph_file_section(number_of_edges, sizeof(graph_vertex_id_t));
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Subroutine function of graph_csr_save to write one array
+ * followed by zero bytes up to the length of its section.
+ * 
+ * @param file pointer to an opened file
+ * @param data pointer to the array to write
+ * @param bytes length in bytes of the array
+ * @param section_bytes length in bytes of the section of the array
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_file_write(FILE * const __restrict__ file, const void * const __restrict__ data, size_t bytes, size_t section_bytes) {
+    static const uint8_t zeros[GRAPH_FILE_ALIGN] = { 0 };
+
+    if ((0 != bytes) && (1 != fwrite(data, bytes, 1, file))) {
+        return SCL_GRAPH_FILE_IO_FAIL;
+    }
+
+    /* Pad the section with zeros */
+    for (size_t padding = section_bytes - bytes; 0 != padding;) {
+        size_t chunk = (padding < sizeof(zeros)) ? padding : sizeof(zeros);
+
+        if (1 != fwrite(zeros, chunk, 1, file)) {
+            return SCL_GRAPH_FILE_IO_FAIL;
+        }
+
+        padding -= chunk;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to write a graph CSR snapshot into a binary file, a
+ * header followed by the arrays of the snapshot (with the in edges if they
+ * were indexed), so graph_load_mmap can use the file without parsing it.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @param path path of the file to create or overwrite
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_csr_save(const graph_csr_t * const __restrict__ csr, const char * const __restrict__ path) {
+    /* Check if graph CSR snapshot is valid */
+    if (NULL == csr) {
+        return SCL_NULL_GRAPH_CSR;
+    }
+
+    /* Check if path is valid */
+    if (NULL == path) {
+        return SCL_INVALID_INPUT;
+    }
+
+    graph_file_header_t header;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic));
+    header.version = GRAPH_FILE_VERSION;
+    header.byte_order = 0x01020304;
+    header.offset_size = sizeof(size_t);
+    header.vertex_size = sizeof(graph_vertex_id_t);
+    header.weight_size = sizeof(graph_weight_t);
+    header.has_in_edges = (NULL != csr->in_offsets);
+    header.size = csr->size;
+    header.number_of_edges = csr->number_of_edges;
+
+    graph_file_layout_t layout;
+
+    if (SCL_OK != graph_file_layout(header.size, header.number_of_edges, (uint8_t)header.has_in_edges, &layout)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    FILE *file = fopen(path, "wb");
+
+    if (NULL == file) {
+        return SCL_GRAPH_FILE_IO_FAIL;
+    }
+
+    const size_t edges = csr->number_of_edges;
+
+    /* Write the header and every array in its section */
+    scl_error_t err = graph_file_write(file, &header, sizeof(header), layout.offsets);
+
+    if (SCL_OK == err) {
+        err = graph_file_write(file, csr->offsets, sizeof(*csr->offsets) * (csr->size + 1), layout.targets - layout.offsets);
+    }
+
+    if (SCL_OK == err) {
+        err = graph_file_write(file, csr->targets, sizeof(*csr->targets) * edges, layout.weights - layout.targets);
+    }
+
+    if (SCL_OK == err) {
+        err = graph_file_write(file, csr->weights, sizeof(*csr->weights) * edges, layout.in_offsets - layout.weights);
+    }
+
+    if ((SCL_OK == err) && (0 != header.has_in_edges)) {
+        err = graph_file_write(file, csr->in_offsets, sizeof(*csr->in_offsets) * (csr->size + 1), layout.sources - layout.in_offsets);
+
+        if (SCL_OK == err) {
+            err = graph_file_write(file, csr->sources, sizeof(*csr->sources) * edges, layout.end - layout.sources);
+        }
+    }
+
+    /* Closing flushes the buffered bytes, so it may fail too */
+    if ((0 != fclose(file)) && (SCL_OK == err)) {
+        err = SCL_GRAPH_FILE_IO_FAIL;
+    }
+
+    return err;
+}
+
+/**
+ * @brief Function to write a graph object into a binary file, the file
+ * holds the CSR snapshot of the graph (see graph_csr_save).
+ * 
+ * @param gr a pointer to an allocated graph object
+ * @param path path of the file to create or overwrite
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_save(const graph_t * const __restrict__ gr, const char * const __restrict__ path) {
+    /* Check if graph object is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
+
+    graph_csr_t *csr = graph_to_csr(gr);
+
+    if (NULL == csr) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    scl_error_t err = graph_csr_save(csr, path);
+
+    free_graph_csr(csr);
+
+    return err;
+}
+
+/**
+ * @brief Function to load a graph file written by graph_save or
+ * graph_csr_save as a CSR snapshot without copying it. The file is mapped
+ * read-only and the arrays of the snapshot point into the mapping, so the
+ * pages are read from disk just when the algorithms touch them and many
+ * processes loading the same file share the page cache. The header and the
+ * first and the last offsets are checked, the edges are trusted.
+ * 
+ * @param path path of the graph file
+ * @return graph_csr_t* a new graph CSR snapshot or `NULL` if function fails
+ */
+graph_csr_t* graph_load_mmap(const char * const __restrict__ path) {
+    /* Check if path is valid */
+    if (NULL == path) {
+        errno = EINVAL;
+        perror("Path of the graph file is NULL");
+        return NULL;
+    }
+
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        perror("Graph file could not be opened");
+        return NULL;
+    }
+
+    struct stat file_stat;
+
+    if ((0 != fstat(fd, &file_stat)) || ((uintmax_t)file_stat.st_size < sizeof(graph_file_header_t)) || ((uintmax_t)file_stat.st_size > SIZE_MAX)) {
+        close(fd);
+
+        errno = EINVAL;
+        perror("Graph file is too short");
+        return NULL;
+    }
+
+    const size_t mapping_size = (size_t)file_stat.st_size;
+    void *mapping = mmap(NULL, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    /* The mapping stays valid after the file is closed */
+    close(fd);
+
+    if (MAP_FAILED == mapping) {
+        perror("Graph file could not be mapped");
+        return NULL;
+    }
+
+    const uint8_t *base = mapping;
+    const graph_file_header_t *header = mapping;
+    graph_file_layout_t layout;
+
+    /* Check if the file was written by a compatible program */
+    if ((0 != memcmp(header->magic, GRAPH_FILE_MAGIC, sizeof(header->magic))) || (GRAPH_FILE_VERSION != header->version)
+        || (0x01020304 != header->byte_order) || (sizeof(size_t) != header->offset_size)
+        || (sizeof(graph_vertex_id_t) != header->vertex_size) || (sizeof(graph_weight_t) != header->weight_size)
+        || (header->size > GRAPH_VERTEX_ID_MAX) || (header->has_in_edges > 1)
+        || (SCL_OK != graph_file_layout(header->size, header->number_of_edges, (uint8_t)header->has_in_edges, &layout))
+        || (layout.end > mapping_size)) {
+        munmap(mapping, mapping_size);
+
+        errno = EINVAL;
+        perror("Graph file is not valid or was written with other graph types");
+        return NULL;
+    }
+
+    const size_t *offsets = (const size_t *)(base + layout.offsets);
+    const size_t *in_offsets = (const size_t *)(base + layout.in_offsets);
+
+    /* Check if the offsets cover all the edges */
+    if ((0 != offsets[0]) || (header->number_of_edges != offsets[header->size])
+        || ((0 != header->has_in_edges) && ((0 != in_offsets[0]) || (header->number_of_edges != in_offsets[header->size])))) {
+        munmap(mapping, mapping_size);
+
+        errno = EINVAL;
+        perror("Graph file offsets are not valid");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new graph CSR snapshot on heap */
+    graph_csr_t *new_csr = scl_malloc(allocator, sizeof(*new_csr));
+
+    /* Check if graph CSR snapshot was allocated */
+    if (NULL == new_csr) {
+        munmap(mapping, mapping_size);
+
+        errno = ENOMEM;
+        perror("Not enough memory for graph CSR snapshot allocation");
+        return NULL;
+    }
+
+    /* The arrays are read-only, the snapshot functions never write them */
+    new_csr->allocator = allocator;
+    (void)SCL_STATS_RESET(new_csr);
+    new_csr->size = header->size;
+    new_csr->number_of_edges = header->number_of_edges;
+    new_csr->offsets = (size_t *)(base + layout.offsets);
+    new_csr->targets = (graph_vertex_id_t *)(base + layout.targets);
+    new_csr->weights = (graph_weight_t *)(base + layout.weights);
+    new_csr->in_offsets = NULL;
+    new_csr->sources = NULL;
+
+    if (0 != header->has_in_edges) {
+        new_csr->in_offsets = (size_t *)(base + layout.in_offsets);
+        new_csr->sources = (graph_vertex_id_t *)(base + layout.sources);
+    }
+
+    new_csr->mapping = mapping;
+    new_csr->mapping_size = mapping_size;
+
+    /* Return the new graph CSR snapshot */
+    return new_csr;
+}
+
+/**
+ * @brief Get the number of vertices of a graph CSR snapshot.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @return size_t number of vertices or SIZE_MAX if snapshot is not allocated
+ */
+size_t get_graph_csr_size(const graph_csr_t * const __restrict__ csr) {
+    if (NULL == csr) {
+        return SIZE_MAX;
+    }
+
+    return csr->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a graph CSR snapshot. The
+ * end vertices and the lengths of the edges are the payload, the offsets
+ * (and the in edges index if it was built) are counted as array bytes. The
+ * arrays of a snapshot loaded from a file are inside the file mapping, the
+ * rest of the mapping (its header and padding) is counted as slack.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_csr_memory_usage(const graph_csr_t * const __restrict__ csr, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == csr) {
+        return SCL_NULL_GRAPH_CSR;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Empty snapshots keep one edge slot */
+    const size_t edge_slots = (0 == csr->number_of_edges) ? 1 : csr->number_of_edges;
+
+    usage->object_bytes = sizeof(*csr);
+    usage->node_bytes = 0;
+    usage->payload_bytes = csr->number_of_edges * (sizeof(*csr->targets) + sizeof(*csr->weights));
+    usage->array_bytes = (csr->size + 1) * sizeof(*csr->offsets);
+    usage->slack_bytes = (edge_slots - csr->number_of_edges) * (sizeof(*csr->targets) + sizeof(*csr->weights));
+    usage->nodes = csr->number_of_edges;
+
+    if (NULL != csr->in_offsets) {
+        usage->array_bytes += (csr->size + 1) * sizeof(*csr->in_offsets) + edge_slots * sizeof(*csr->sources);
+    }
+
+    /* The arrays of a loaded snapshot are parts of the mapping */
+    if (NULL != csr->mapping) {
+        const size_t arrays_size = usage->payload_bytes + usage->array_bytes + usage->slack_bytes;
+
+        usage->slack_bytes += (csr->mapping_size > arrays_size) ? (csr->mapping_size - arrays_size) : 0;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the operation counters of a graph CSR snapshot, the distances lowered by graph_csr_dijkstra.
+ * The counters are kept only when the library is built with SCL_STATS.
+ * 
+ * @param csr an allocated graph CSR snapshot object
+ * @param stats pointer to the counters to fill (set to zero without SCL_STATS)
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t graph_csr_get_stats(const graph_csr_t * const __restrict__ csr, scl_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == csr) {
+        return SCL_NULL_GRAPH_CSR;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return SCL_STATS_GET(csr, stats);
+}
+
+/**
+ * @brief Function to set the operation counters of a graph CSR snapshot to zero.
+ * 
+ * @param csr an allocated graph CSR snapshot object
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t graph_csr_reset_stats(graph_csr_t * const __restrict__ csr) {
+    /* Check if input data is valid */
+    if (NULL == csr) {
+        return SCL_NULL_GRAPH_CSR;
+    }
+
+    return SCL_STATS_RESET(csr);
+}
+
+/**
+ * @brief Get the number of edges of a graph CSR snapshot.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @return size_t number of edges or SIZE_MAX if snapshot is not allocated
+ */
+size_t get_graph_csr_edges(const graph_csr_t * const __restrict__ csr) {
+    if (NULL == csr) {
+        return SIZE_MAX;
+    }
+
+    return csr->number_of_edges;
+}
+
+/**
+ * @brief Function to traverse the vertices of a graph CSR snapshot by
+ * breath-first-search method, the vertices are visited in the same order
+ * as graph_bfs_traverse visits them on the original graph. The snapshot is
+ * not modified, so many threads can traverse the same snapshot at once.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @param start_vertex a vertex to start the bfs
+ * @param vertex_path an array to save the path of bfs traversal can be `NULL`
+ * @return size_t size of the traversed vertices or 0 if function failed
+ */
+size_t graph_csr_bfs_traverse(const graph_csr_t * const __restrict__ csr, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valid */
+    if ((NULL == csr) || (start_vertex >= csr->size)) {
+        return 0;
+    }
+
+    /* Every vertex enters the queue once, so the path array can be the queue itself */
+    size_t *bfs_queue = vertex_path;
+
+    if (NULL == bfs_queue) {
+        bfs_queue = scl_malloc(csr->allocator, sizeof(*bfs_queue) * csr->size);
+    }
+
+    uint8_t *visit = scl_calloc(csr->allocator, csr->size, sizeof(*visit));
+
+    if ((NULL == bfs_queue) || (NULL == visit)) {
+        if (vertex_path != bfs_queue) {
+            scl_free(csr->allocator, bfs_queue);
+        }
+
+        scl_free(csr->allocator, visit);
+        return 0;
+    }
+
+    size_t queue_front = 0;
+    size_t queue_back = 0;
+
+    /* Start the breath-first-search from the start vertex */
+    visit[start_vertex] = 1;
+    bfs_queue[queue_back++] = start_vertex;
+
+    while (queue_front < queue_back) {
+        const size_t front_vertex = bfs_queue[queue_front++];
+
+        for (size_t iter = csr->offsets[front_vertex]; iter < csr->offsets[front_vertex + 1]; ++iter) {
+            const size_t next_vertex = csr->targets[iter];
+
+            if (0 == visit[next_vertex]) {
+                visit[next_vertex] = 1;
+                bfs_queue[queue_back++] = next_vertex;
+            }
+        }
+    }
+
+    if (vertex_path != bfs_queue) {
+        scl_free(csr->allocator, bfs_queue);
+    }
+
+    scl_free(csr->allocator, visit);
+
+    /* Return the traversed vertices size */
+    return queue_back;
+}
+
+/**
+ * @brief Function to traverse the vertices of a graph CSR snapshot by
+ * depth-first-search method, the vertices are visited in the same order
+ * as graph_dfs_traverse visits them on the original graph. An explicit
+ * stack is used instead of recursion, so deep graphs do not overflow the
+ * call stack.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @param start_vertex a vertex to start the dfs
+ * @param vertex_path an array to save the path of dfs traversal can be `NULL`
+ * @return size_t size of the traversed vertices or 0 if function failed
+ */
+size_t graph_csr_dfs_traverse(const graph_csr_t * const __restrict__ csr, size_t start_vertex, size_t * __restrict__ vertex_path) {
+    /* Check if input data is valid */
+    if ((NULL == csr) || (start_vertex >= csr->size)) {
+        return 0;
+    }
+
+    /* Every stack frame holds a vertex and the index of its next edge to visit */
+    size_t *stack_vertex = scl_malloc(csr->allocator, sizeof(*stack_vertex) * csr->size);
+    size_t *stack_edge = scl_malloc(csr->allocator, sizeof(*stack_edge) * csr->size);
+    uint8_t *visit = scl_calloc(csr->allocator, csr->size, sizeof(*visit));
+
+    if ((NULL == stack_vertex) || (NULL == stack_edge) || (NULL == visit)) {
+        scl_free(csr->allocator, stack_vertex);
+        scl_free(csr->allocator, stack_edge);
+        scl_free(csr->allocator, visit);
+        return 0;
+    }
+
+    size_t traversed_vex = 0;
+    size_t stack_size = 0;
+
+    /* Visit the start vertex */
+    visit[start_vertex] = 1;
+
+    if (NULL != vertex_path) {
+        vertex_path[traversed_vex] = start_vertex;
+    }
+
+    ++traversed_vex;
+
+    stack_vertex[stack_size] = start_vertex;
+    stack_edge[stack_size] = csr->offsets[start_vertex];
+    ++stack_size;
+
+    while (0 != stack_size) {
+        const size_t top_vertex = stack_vertex[stack_size - 1];
+
+        /* All neighbours of the top vertex were visited */
+        if (stack_edge[stack_size - 1] == csr->offsets[top_vertex + 1]) {
+            --stack_size;
+            continue;
+        }
+
+        const size_t next_vertex = csr->targets[stack_edge[stack_size - 1]++];
+
+        /* Go deeper into an unvisited neighbour */
+        if (0 == visit[next_vertex]) {
+            visit[next_vertex] = 1;
+
+            if (NULL != vertex_path) {
+                vertex_path[traversed_vex] = next_vertex;
+            }
+
+            ++traversed_vex;
+
+            stack_vertex[stack_size] = next_vertex;
+            stack_edge[stack_size] = csr->offsets[next_vertex];
+            ++stack_size;
+        }
+    }
+
+    scl_free(csr->allocator, stack_vertex);
+    scl_free(csr->allocator, stack_edge);
+    scl_free(csr->allocator, visit);
+
+    /* Return the size of the traversed vertices */
+    return traversed_vex;
+}
+
+/**
+ * @brief Helper function for the dijkstra searches to move a vertex up
+ * in the min heap of distances until its parent is not greater.
+ * 
+ * @param heap array of vertices ordered as a min heap by their distances
+ * @param heap_pos position of every vertex in the heap
+ * @param vertex_dists distances of the vertices
+ * @param heap_index position of the vertex to move up
+ */
+static void graph_csr_heap_sift_up(size_t * const __restrict__ heap, size_t * const __restrict__ heap_pos, const graph_weight_t * const __restrict__ vertex_dists, size_t heap_index) {
+    const size_t vertex = heap[heap_index];
+
+    while (0 != heap_index) {
+        const size_t parent_index = (heap_index - 1) / 2;
+
+        if (vertex_dists[heap[parent_index]] <= vertex_dists[vertex]) {
+            break;
+        }
+
+        heap[heap_index] = heap[parent_index];
+        heap_pos[heap[heap_index]] = heap_index;
+        heap_index = parent_index;
+    }
+
+    heap[heap_index] = vertex;
+    heap_pos[vertex] = heap_index;
+}
+
+/**
+ * @brief Helper function for the dijkstra searches to move a vertex down
+ * in the min heap of distances until none of its children is smaller.
+ * 
+ * @param heap array of vertices ordered as a min heap by their distances
+ * @param heap_pos position of every vertex in the heap
+ * @param vertex_dists distances of the vertices
+ * @param heap_size number of vertices in the heap
+ * @param heap_index position of the vertex to move down
+ */
+static void graph_csr_heap_sift_down(size_t * const __restrict__ heap, size_t * const __restrict__ heap_pos, const graph_weight_t * const __restrict__ vertex_dists, size_t heap_size, size_t heap_index) {
+    const size_t vertex = heap[heap_index];
+
+    for (;;) {
+        size_t child_index = 2 * heap_index + 1;
+
+        if (child_index >= heap_size) {
+            break;
+        }
+
+        /* Select the smaller child */
+        if ((child_index + 1 < heap_size) && (vertex_dists[heap[child_index + 1]] < vertex_dists[heap[child_index]])) {
+            ++child_index;
+        }
+
+        if (vertex_dists[vertex] <= vertex_dists[heap[child_index]]) {
+            break;
+        }
+
+        heap[heap_index] = heap[child_index];
+        heap_pos[heap[heap_index]] = heap_index;
+        heap_index = child_index;
+    }
+
+    heap[heap_index] = vertex;
+    heap_pos[vertex] = heap_index;
+}
+
+/**
+ * @brief Function to compute the minimum distances starting from selected
+ * vertex to all other vertices of a graph CSR snapshot, by dijkstra method.
+ * If the selected vertex has no path to another vertex the distance will be
+ * GRAPH_WEIGHT_MAX. The vertices are kept in an indexed min heap, so updating a
+ * distance is O(log V) and the whole call is O((V + E) log V).
+ * The parent path array can be `NULL`.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @param start_vertex vertex to compute the distances beginning from it
+ * @param vertex_dists an allocated array with all distances beginning from start_vertex
+ * @param vertex_parents an array with vertices showing the minimum path from
+ * start_vertex to any other vertex
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_csr_dijkstra(const graph_csr_t * const __restrict__ csr, size_t start_vertex, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents) {
+    /* Check if graph CSR snapshot is valid */
+    if (NULL == csr) {
+        return SCL_NULL_GRAPH_CSR;
+    }
+
+    /* Check if distances array is allocated */
+    if (NULL == vertex_dists) {
+        return SCL_NULL_VERTICES_DISTANCES;
+    }
+
+    /* Check if start vertex is in the snapshot */
+    if (start_vertex >= csr->size) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
+
+    /* Position of every vertex in the heap, or one of the two marks below */
+    const size_t not_discovered = SIZE_MAX;
+    const size_t settled = SIZE_MAX - 1;
+
+    size_t *heap = scl_malloc(csr->allocator, sizeof(*heap) * csr->size);
+    size_t *heap_pos = scl_malloc(csr->allocator, sizeof(*heap_pos) * csr->size);
+
+    if ((NULL == heap) || (NULL == heap_pos)) {
+        scl_free(csr->allocator, heap);
+        scl_free(csr->allocator, heap_pos);
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* Set default values */
+    for (size_t iter = 0; iter < csr->size; ++iter) {
+        vertex_dists[iter] = GRAPH_WEIGHT_MAX;
+        heap_pos[iter] = not_discovered;
+
+        if (NULL != vertex_parents) {
+            vertex_parents[iter] = SIZE_MAX;
+        }
+    }
+
+    vertex_dists[start_vertex] = 0;
+
+    size_t heap_size = 1;
+
+    heap[0] = start_vertex;
+    heap_pos[start_vertex] = 0;
+
+    /* Perform the dijkstra's algorithm */
+    while (0 != heap_size) {
+
+        /* Extract the vertex with the minimum distance */
+        const size_t min_dist_vertex = heap[0];
+
+        heap_pos[min_dist_vertex] = settled;
+
+        if (0 != --heap_size) {
+            heap[0] = heap[heap_size];
+            graph_csr_heap_sift_down(heap, heap_pos, vertex_dists, heap_size, 0);
+        }
+
+        /* Relax the edges of the current minimum vertex */
+        for (size_t iter = csr->offsets[min_dist_vertex]; iter < csr->offsets[min_dist_vertex + 1]; ++iter) {
+            const size_t next_vertex = csr->targets[iter];
+            const graph_weight_t new_dist = vertex_dists[min_dist_vertex] + csr->weights[iter];
+
+            if ((settled == heap_pos[next_vertex]) || (new_dist >= vertex_dists[next_vertex])) {
+                continue;
+            }
+
+            vertex_dists[next_vertex] = new_dist;
+            SCL_STATS_ADD(csr, relaxations, 1);
+
+            if (NULL != vertex_parents) {
+                vertex_parents[next_vertex] = min_dist_vertex;
+            }
+
+            /* Insert the new discovered vertex or move it up */
+            if (not_discovered == heap_pos[next_vertex]) {
+                heap[heap_size] = next_vertex;
+                graph_csr_heap_sift_up(heap, heap_pos, vertex_dists, heap_size);
+                ++heap_size;
+            } else {
+                graph_csr_heap_sift_up(heap, heap_pos, vertex_dists, heap_pos[next_vertex]);
+            }
+        }
+    }
+
+    scl_free(csr->allocator, heap);
+    scl_free(csr->allocator, heap_pos);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to add the in edges to a graph CSR snapshot. The in edges
+ * of vertex `v` are `sources[in_offsets[v]]` up to (without) `sources[in_offsets[v + 1]]`,
+ * they are needed by the bottom-up steps of **graph_csr_parallel_bfs**. The
+ * function changes the snapshot, so call it before the snapshot is shared
+ * between threads. Calling it again does nothing.
+ * 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t graph_csr_index_in_edges(graph_csr_t * const __restrict__ csr) {
+    /* Check if graph CSR snapshot is valid */
+    if (NULL == csr) {
+        return SCL_NULL_GRAPH_CSR;
     }
 
-    uint8_t *try_realloc_visit = realloc(gr->visit, sizeof(*gr->visit) * gr->size);
-
-    if (NULL == try_realloc_visit) {
-        return SCL_REALLOC_GRAPH_VERTICES_FAIL;
+    /* In edges are already indexed */
+    if (NULL != csr->in_offsets) {
+        return SCL_OK;
     }
 
-    gr->visit = try_realloc_visit;
+    size_t *in_offsets = scl_calloc(csr->allocator, csr->size + 1, sizeof(*in_offsets));
+    graph_vertex_id_t *sources = scl_malloc(csr->allocator, sizeof(*sources) * ((0 == csr->number_of_edges) ? 1 : csr->number_of_edges));
 
-    graph_vertex_t **try_realloc = realloc(gr->vertices, sizeof(*try_realloc) * gr->size);
+    if ((NULL == in_offsets) || (NULL == sources)) {
+        scl_free(csr->allocator, in_offsets);
+        scl_free(csr->allocator, sources);
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
 
-    if (NULL == try_realloc) {
-        return SCL_REALLOC_GRAPH_VERTICES_FAIL;
+    /* Count the in edges of every vertex and turn the counts into offsets */
+    for (size_t iter = 0; iter < csr->number_of_edges; ++iter) {
+        ++in_offsets[csr->targets[iter] + 1];
     }
 
-    gr->vertices = try_realloc;
+    for (size_t iter = 0; iter < csr->size; ++iter) {
+        in_offsets[iter + 1] += in_offsets[iter];
+    }
 
-    /* If reallocation went successfully update the vertices number */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        if (NULL == gr->vertices[iter]) {
-            return SCL_NULL_GRAPH_VERTEX;
+    /* Place the start vertex of every edge, the sources of every vertex stay in increasing order */
+    for (size_t vertex = 0; vertex < csr->size; ++vertex) {
+        for (size_t iter = csr->offsets[vertex]; iter < csr->offsets[vertex + 1]; ++iter) {
+            sources[in_offsets[csr->targets[iter]]++] = vertex;
         }
+    }
 
-        graph_link_t *link = gr->vertices[iter]->link;
+    /* The placement moved every offset to the next vertex, shift them back */
+    for (size_t iter = csr->size; iter > 0; --iter) {
+        in_offsets[iter] = in_offsets[iter - 1];
+    }
 
-        while (NULL != link) {
-            if (link->vertex > vertex) {
-                --(link->vertex);
-            }
+    in_offsets[0] = 0;
 
-            link = link->next;
-        }
-    }
+    csr->in_offsets = in_offsets;
+    csr->sources = sources;
 
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function to get the number of vertices from the
- * selected graph. If pointer to graph object is NULL than
- * SIZE_MAX will be returned
+ * @brief The parallel bfs goes bottom-up when the edges of the frontier are
+ * more than the in edges of the unvisited vertices divided by this factor
  * 
- * @param gr a pointer to an allocated graph object
- * @return size_t SIZE_MAX or the actual size of the graph
  */
-size_t get_graph_size(const graph_t * const __restrict__ gr) {
-    if (NULL == gr) {
-        return SIZE_MAX;
-    }
+#define GRAPH_PARALLEL_BFS_ALPHA 14
 
-    return gr->size;
-}
+/**
+ * @brief The parallel bfs goes back top-down when the frontier has less
+ * vertices than the vertices of the graph divided by this factor
+ * 
+ */
+#define GRAPH_PARALLEL_BFS_BETA 24
 
 /**
- * @brief Function to traverse the vertices of the graph object by
- * breath-first-search method. Function will get as input an allocated
- * array to save the path of bfs, if the array is `NULL` then the path
- * will not be saved however function will return the exact size of the
- * traversed vertices in this bfs call.
+ * @brief Number of tasks of every thread in one step of the parallel bfs
  * 
- * @param gr a pointer to an allocated graph object
- * @param start_vertex a vertex to start the bfs
- * @param vertex_path an array to save the path of bfs traversal can be `NULL`
- * @return size_t size of the traversed vertices or 0 if function failed
  */
-size_t graph_bfs_traverse(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
-    /* Check if input data is valids */
-    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size)) {
-        return 0;
+#define GRAPH_PARALLEL_BFS_TASKS_PER_THREAD 8
+
+/**
+ * @brief Number of vertices found by a top-down task before they are
+ * moved into the next frontier with one atomic operation
+ * 
+ */
+#define GRAPH_PARALLEL_BFS_BUFFER 256
+
+/**
+ * @brief Counters of the vertices found by one task of the parallel bfs
+ * 
+ */
+typedef struct graph_parallel_bfs_count_s {
+    size_t vertices;                                        /* Number of vertices found by the task */
+    size_t out_edges;                                       /* Number of out edges of the found vertices */
+    size_t in_edges;                                        /* Number of in edges of the found vertices */
+} graph_parallel_bfs_count_t;
+
+/**
+ * @brief State of one parallel bfs shared by all the tasks of every step
+ * 
+ */
+typedef struct graph_parallel_bfs_s {
+    const graph_csr_t *csr;                                 /* Traversed graph CSR snapshot */
+    size_t *vertex_levels;                                  /* Level of every vertex, SIZE_MAX if not reached */
+    _Atomic uint64_t *visited;                              /* Bitmap of the reached vertices */
+    uint64_t *frontier_bits;                                /* Bitmap of the frontier (bottom-up steps) */
+    uint64_t *next_bits;                                    /* Bitmap of the next frontier (bottom-up steps) */
+    size_t *frontier;                                       /* Queue of the frontier (top-down steps) */
+    size_t *next_frontier;                                  /* Queue of the next frontier (top-down steps) */
+    size_t frontier_size;                                   /* Number of vertices of the frontier */
+    _Atomic size_t next_size;                               /* Number of vertices of the next frontier queue */
+    size_t level;                                           /* Level of the frontier */
+    size_t number_of_words;                                 /* Number of words of every bitmap */
+    size_t number_of_tasks;                                 /* Number of tasks of every step */
+    graph_parallel_bfs_count_t *counts;                     /* Counters of every task */
+} graph_parallel_bfs_t;
+
+/**
+ * @brief Task clearing one range of words of the visited bitmap
+ * and one range of vertices of the levels array.
+ * 
+ * @param arg pointer to the parallel bfs state
+ * @param task index of the task
+ */
+static void graph_parallel_bfs_clear_task(void * const arg, size_t task) {
+    graph_parallel_bfs_t *bfs = arg;
+
+    const size_t words_per_task = (bfs->number_of_words + bfs->number_of_tasks - 1) / bfs->number_of_tasks;
+    const size_t first_word = task * words_per_task;
+    const size_t last_word = (first_word + words_per_task < bfs->number_of_words) ? (first_word + words_per_task) : bfs->number_of_words;
+
+    for (size_t word = first_word; word < last_word; ++word) {
+        atomic_store_explicit(&bfs->visited[word], 0, memory_order_relaxed);
     }
 
-    /* No vertex was traversed */
-    size_t traversed_vex = 0;
+    const size_t last_vertex = (64 * last_word < bfs->csr->size) ? (64 * last_word) : bfs->csr->size;
 
-    /* Set all vertices as unvisited */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        gr->visit[iter] = 0;
+    for (size_t vertex = 64 * first_word; vertex < last_vertex; ++vertex) {
+        bfs->vertex_levels[vertex] = SIZE_MAX;
     }
+}
 
-    /* Create the bfs traversal queue */
-    queue_t *bfs_queue = create_queue(NULL, sizeof(*vertex_path));
+/**
+ * @brief Task of a top-down step, goes through the out edges of one slice of
+ * the frontier queue and claims every unvisited end vertex by an atomic or on
+ * the visited bitmap, so every vertex is added to the next frontier just once.
+ * 
+ * @param arg pointer to the parallel bfs state
+ * @param task index of the task
+ */
+static void graph_parallel_bfs_top_down_task(void * const arg, size_t task) {
+    graph_parallel_bfs_t *bfs = arg;
+    const graph_csr_t *csr = bfs->csr;
+    graph_parallel_bfs_count_t *count = &bfs->counts[task];
 
-    if (NULL != bfs_queue) {
-        
-        /* Start the breath-first-search from the start vertex */
+    const size_t first = bfs->frontier_size / bfs->number_of_tasks * task + ((task < bfs->frontier_size % bfs->number_of_tasks) ? task : bfs->frontier_size % bfs->number_of_tasks);
+    const size_t last = first + bfs->frontier_size / bfs->number_of_tasks + ((task < bfs->frontier_size % bfs->number_of_tasks) ? 1 : 0);
 
-        gr->visit[start_vertex] = 1;
+    size_t buffer[GRAPH_PARALLEL_BFS_BUFFER];
+    size_t buffer_size = 0;
 
-        if (SCL_OK != queue_push(bfs_queue, &start_vertex)) {
-            free_queue(bfs_queue);
-            return 0;
-        }
+    count->vertices = count->out_edges = count->in_edges = 0;
 
-        while (!is_queue_empty(bfs_queue)) {
-            const size_t *front_vertex = queue_front(bfs_queue);
+    for (size_t iter = first; iter < last; ++iter) {
+        const size_t vertex = bfs->frontier[iter];
 
-            
-            if (NULL != vertex_path) {
-                
-                /* Insted of adding in path variable you can perform an action */
-                vertex_path[traversed_vex] = *front_vertex; 
+        for (size_t edge = csr->offsets[vertex]; edge < csr->offsets[vertex + 1]; ++edge) {
+            const size_t next_vertex = csr->targets[edge];
+            const uint64_t bit = (uint64_t)1 << (next_vertex & 63);
+            _Atomic uint64_t *word = &bfs->visited[next_vertex >> 6];
+
+            /* Read first, most end vertices of a big frontier are already visited */
+            if ((0 != (atomic_load_explicit(word, memory_order_relaxed) & bit)) ||
+                (0 != (atomic_fetch_or_explicit(word, bit, memory_order_relaxed) & bit))) {
+                continue;
             }
 
-            /* Increase traversed vertices size */
-            ++traversed_vex;
+            bfs->vertex_levels[next_vertex] = bfs->level + 1;
 
-            if (SCL_OK != queue_pop(bfs_queue)) {
-                free_queue(bfs_queue);
-                return 0;
-            }
+            ++(count->vertices);
+            count->out_edges += csr->offsets[next_vertex + 1] - csr->offsets[next_vertex];
 
-            graph_link_t *link = gr->vertices[*front_vertex]->link;
+            if (NULL != csr->in_offsets) {
+                count->in_edges += csr->in_offsets[next_vertex + 1] - csr->in_offsets[next_vertex];
+            }
 
-            while (NULL != link) {
-                if (0 == gr->visit[link->vertex]) {
-                    gr->visit[link->vertex] = 1;
+            buffer[buffer_size++] = next_vertex;
 
-                    if (SCL_OK != queue_push(bfs_queue, &link->vertex)) {
-                        free_queue(bfs_queue);
-                        return 0;
-                    }
-                }
+            if (GRAPH_PARALLEL_BFS_BUFFER == buffer_size) {
+                const size_t position = atomic_fetch_add_explicit(&bfs->next_size, buffer_size, memory_order_relaxed);
 
-                link = link->next;
+                memcpy(bfs->next_frontier + position, buffer, sizeof(*buffer) * buffer_size);
+                buffer_size = 0;
             }
         }
-
-        free_queue(bfs_queue);
     }
 
-    /* Return the traversed vertices size */
-    return traversed_vex;
+    if (buffer_size > 0) {
+        const size_t position = atomic_fetch_add_explicit(&bfs->next_size, buffer_size, memory_order_relaxed);
+
+        memcpy(bfs->next_frontier + position, buffer, sizeof(*buffer) * buffer_size);
+    }
 }
 
 /**
- * @brief Subroutine function for graph_dfs_traversal to 
- * calculate recursively the depth-first-search vertices.
+ * @brief Task of a bottom-up step, every unvisited vertex of one range of
+ * words looks for one in edge from the frontier bitmap and stops at the
+ * first one. Every word of the bitmaps is written by just one task.
  * 
- * @param gr a pointer to an allocated graph object
- * @param start_vertex number of vertex to start the dfs traversal
- * @param vertex_path an array to save dfs path can be `NULL`
- * @param traversed_vex size of the traversed vertices in the dfs call
+ * @param arg pointer to the parallel bfs state
+ * @param task index of the task
  */
-static void graph_dfs_traverse_helper(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path, size_t * __restrict__ traversed_vex) {
-    /* Visit the current vertex */
-    gr->visit[start_vertex] = 1;
+static void graph_parallel_bfs_bottom_up_task(void * const arg, size_t task) {
+    graph_parallel_bfs_t *bfs = arg;
+    const graph_csr_t *csr = bfs->csr;
+    graph_parallel_bfs_count_t *count = &bfs->counts[task];
 
-    /* Insert vertex into the path */
-    if (NULL != vertex_path) {
-       vertex_path[*traversed_vex] = start_vertex; 
-    }
-    
-    /* Increase traversed size */
-    ++(*traversed_vex);
+    const size_t words_per_task = (bfs->number_of_words + bfs->number_of_tasks - 1) / bfs->number_of_tasks;
+    const size_t first_word = task * words_per_task;
+    const size_t last_word = (first_word + words_per_task < bfs->number_of_words) ? (first_word + words_per_task) : bfs->number_of_words;
 
-    graph_link_t *link = gr->vertices[start_vertex]->link;
+    count->vertices = count->out_edges = count->in_edges = 0;
 
-    /* Visit the neighbours vertices */
-    while (NULL != link) {
-        if (0 == gr->visit[link->vertex]) {
-            graph_dfs_traverse_helper(gr, link->vertex, vertex_path, traversed_vex);
+    for (size_t word = first_word; word < last_word; ++word) {
+        uint64_t visited = atomic_load_explicit(&bfs->visited[word], memory_order_relaxed);
+        uint64_t next = 0;
+
+        const size_t last_vertex = (64 * word + 64 < csr->size) ? (64 * word + 64) : csr->size;
+
+        for (size_t vertex = 64 * word; vertex < last_vertex; ++vertex) {
+            const uint64_t bit = (uint64_t)1 << (vertex & 63);
+
+            if (0 != (visited & bit)) {
+                continue;
+            }
+
+            for (size_t edge = csr->in_offsets[vertex]; edge < csr->in_offsets[vertex + 1]; ++edge) {
+                const size_t prev_vertex = csr->sources[edge];
+
+                if (0 != (bfs->frontier_bits[prev_vertex >> 6] & ((uint64_t)1 << (prev_vertex & 63)))) {
+                    bfs->vertex_levels[vertex] = bfs->level + 1;
+
+                    visited |= bit;
+                    next |= bit;
+
+                    ++(count->vertices);
+                    count->out_edges += csr->offsets[vertex + 1] - csr->offsets[vertex];
+                    count->in_edges += csr->in_offsets[vertex + 1] - csr->in_offsets[vertex];
+
+                    break;
+                }
+            }
         }
 
-        link = link->next;
+        atomic_store_explicit(&bfs->visited[word], visited, memory_order_relaxed);
+        bfs->next_bits[word] = next;
     }
 }
 
 /**
- * @brief Function to traverse the vertices of the graph object by
- * depth-first-search method. Function will get as input an allocated
- * array to save the path of dfs, if the array is `NULL` then the path
- * will not be saved however function will return the exact size of the
- * traversed vertices in this dfs call.
+ * @brief Function to compute the levels of a breath-first-search on a graph
+ * CSR snapshot on all threads of a thread pool. Small frontiers are expanded
+ * top-down (the out edges of the frontier claim their end vertices in an atomic
+ * visited bitmap) and, if the in edges are indexed (see **graph_csr_index_in_edges**),
+ * big frontiers of small-world graphs are expanded bottom-up (every unvisited vertex
+ * looks for one in edge from the frontier bitmap and stops at the first), which
+ * skips most edges of the biggest levels. The level of every vertex is the same as
+ * the number of edges of the shortest path from start_vertex, so the result does
+ * not depend on the number of threads. The snapshot is not modified.
  * 
- * @param gr a pointer to an allocated graph object
- * @param start_vertex a vertex to start the dfs
- * @param vertex_path an array to save the path of dfs traversal can be `NULL`
- * @return size_t size of the traversed vertices or 0 if function failed 
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @param pool a pointer to an allocated thread pool or `NULL` to run on the calling thread
+ * @param start_vertex a vertex to start the bfs
+ * @param vertex_levels an allocated array of csr->size elements to save the level of every
+ * vertex, the start vertex has level 0 and the not reached vertices have level SIZE_MAX
+ * @return size_t number of reached vertices or 0 if function failed
  */
-size_t graph_dfs_traverse(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
+size_t graph_csr_parallel_bfs(const graph_csr_t * const __restrict__ csr, thread_pool_t * const __restrict__ pool, size_t start_vertex, size_t * __restrict__ vertex_levels) {
     /* Check if input data is valid */
-    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size)) {
+    if ((NULL == csr) || (start_vertex >= csr->size) || (NULL == vertex_levels)) {
         return 0;
     }
 
-    /* No vertex was traversed */
-    size_t traversed_vex = 0;
+    graph_parallel_bfs_t bfs;
 
-    /* Set every vertex as unvisited */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        gr->visit[iter] = 0;
-    }
+    bfs.csr = csr;
+    bfs.vertex_levels = vertex_levels;
+    bfs.number_of_words = (csr->size + 63) / 64;
+    bfs.number_of_tasks = ((NULL == pool) ? 1 : get_thread_pool_threads(pool)) * GRAPH_PARALLEL_BFS_TASKS_PER_THREAD;
+    bfs.level = 0;
 
-    /* Call helper function the real dfs call */
-    graph_dfs_traverse_helper(gr, start_vertex, vertex_path, &traversed_vex);
+    const uint8_t can_bottom_up = (NULL != csr->in_offsets);
 
-    /* Return the size of the traversed vertices */
-    return traversed_vex;
-}
+    bfs.visited = scl_malloc(csr->allocator, sizeof(*bfs.visited) * bfs.number_of_words);
+    bfs.frontier = scl_malloc(csr->allocator, sizeof(*bfs.frontier) * csr->size);
+    bfs.next_frontier = scl_malloc(csr->allocator, sizeof(*bfs.next_frontier) * csr->size);
+    bfs.counts = scl_malloc(csr->allocator, sizeof(*bfs.counts) * bfs.number_of_tasks);
+    bfs.frontier_bits = NULL;
+    bfs.next_bits = NULL;
 
-/**
- * @brief Subroutine function of the graph_has_cycle to perform
- * a special dfs traversal of the graph and to find if graph has or
- * not a cycle.
- * 
- * @param gr a pointer to an allocated graph object
- * @param start_vertex first vertex to check if it forms a cycle
- * @param current_vertex current working vertex of the dfs traversal
- * @return uint8_t 1 if graph has a cycle starting from start_vertex or 0 otherwise
- */
-static uint8_t graph_has_cycle_helper(const graph_t * const __restrict__ gr, size_t start_vertex, size_t current_vertex) {
-    /* All vertices were visited and start vertex is the last visited vertex */
-    if ((1 == gr->visit[start_vertex]) && (start_vertex == current_vertex)) {
-        return 1;
+    if (1 == can_bottom_up) {
+        bfs.frontier_bits = scl_malloc(csr->allocator, sizeof(*bfs.frontier_bits) * bfs.number_of_words);
+        bfs.next_bits = scl_malloc(csr->allocator, sizeof(*bfs.next_bits) * bfs.number_of_words);
     }
 
-    /* All vertices were visited and no cycle was found */
-    if (1 == gr->visit[current_vertex]) {
-        return 0;
+    size_t reached = 0;
+
+    if ((NULL == bfs.visited) || (NULL == bfs.frontier) || (NULL == bfs.next_frontier) || (NULL == bfs.counts) ||
+        ((1 == can_bottom_up) && ((NULL == bfs.frontier_bits) || (NULL == bfs.next_bits)))) {
+        goto free_bfs;
     }
 
-    graph_link_t *link = gr->vertices[current_vertex]->link;
+    /* Every step is run on the thread pool or on the calling thread */
+    #define GRAPH_PARALLEL_BFS_STEP(step)                                                           \
+        do {                                                                                        \
+            if (NULL != pool) {                                                                     \
+                thread_pool_run(pool, (step), &bfs, bfs.number_of_tasks);                           \
+            } else {                                                                                \
+                for (size_t task = 0; task < bfs.number_of_tasks; ++task) {                         \
+                    (step)(&bfs, task);                                                             \
+                }                                                                                   \
+            }                                                                                       \
+        } while (0)
+
+    GRAPH_PARALLEL_BFS_STEP(&graph_parallel_bfs_clear_task);
+
+    /* Start the breath-first-search from the start vertex */
+    atomic_store_explicit(&bfs.visited[start_vertex >> 6], (uint64_t)1 << (start_vertex & 63), memory_order_relaxed);
+    vertex_levels[start_vertex] = 0;
+
+    bfs.frontier[0] = start_vertex;
+    bfs.frontier_size = 1;
+    reached = 1;
+
+    size_t frontier_edges = csr->offsets[start_vertex + 1] - csr->offsets[start_vertex];
+    size_t unvisited_edges = csr->number_of_edges;
+
+    if (1 == can_bottom_up) {
+        unvisited_edges -= csr->in_offsets[start_vertex + 1] - csr->in_offsets[start_vertex];
+    }
 
-    int has_cycle = 0;
+    uint8_t bottom_up = 0;
 
-    /* Perform the dfs call */
-    while ((NULL != link) && (0 == has_cycle)) {
+    while (bfs.frontier_size > 0) {
 
-        has_cycle = graph_has_cycle_helper(gr, start_vertex, link->vertex);
+        /* Switch the direction of the step (frontier queue <-> frontier bitmap) */
+        if ((0 == bottom_up) && (1 == can_bottom_up) && (frontier_edges > unvisited_edges / GRAPH_PARALLEL_BFS_ALPHA)) {
+            memset(bfs.frontier_bits, 0, sizeof(*bfs.frontier_bits) * bfs.number_of_words);
 
-        link = link->next;
-    }
+            for (size_t iter = 0; iter < bfs.frontier_size; ++iter) {
+                bfs.frontier_bits[bfs.frontier[iter] >> 6] |= (uint64_t)1 << (bfs.frontier[iter] & 63);
+            }
 
-    /* Return if graph has or not a cycle */
-    return has_cycle;
-}
+            bottom_up = 1;
+        } else if ((1 == bottom_up) && (bfs.frontier_size < csr->size / GRAPH_PARALLEL_BFS_BETA)) {
+            size_t frontier_size = 0;
 
-/**
- * @brief Function to check if a graph object has or has not a cycle.
- * Function may fail if graph object is not valid in that case false will
- * be returned because an invalid graph has no cycle.
- * 
- * @param gr a pointer to an allocated graph object
- * @return uint8_t if graph has a cycle or 0 otherwise
- */
-uint8_t graph_has_cycle(const graph_t * const __restrict__ gr) {
-    /* Check if graph object is valid */
-    if ((NULL == gr) || (NULL == gr->visit) || (NULL == gr->vertices)) {
-        return 0;
-    }
+            for (size_t word = 0; word < bfs.number_of_words; ++word) {
+                for (uint64_t bits = bfs.frontier_bits[word]; 0 != bits; bits &= bits - 1) {
+                    bfs.frontier[frontier_size++] = 64 * word + (size_t)__builtin_ctzll(bits);
+                }
+            }
+
+            bfs.frontier_size = frontier_size;
+            bottom_up = 0;
+        }
 
-    uint8_t has_cycle = 0;
+        atomic_store_explicit(&bfs.next_size, 0, memory_order_relaxed);
 
-    /* Traverse every vertex by dfs method and check if it has a cycle */
-    for (size_t iter = 0; (iter < gr->size) && (0 == has_cycle); ++iter) {
-        
-        /* Reset the visit array */
-        for (size_t make_zero = 0; make_zero < gr->size; ++make_zero) {
-            gr->visit[make_zero] = 0;
+        if (1 == bottom_up) {
+            GRAPH_PARALLEL_BFS_STEP(&graph_parallel_bfs_bottom_up_task);
+
+            uint64_t *temp = bfs.frontier_bits;
+            bfs.frontier_bits = bfs.next_bits;
+            bfs.next_bits = temp;
+        } else {
+            GRAPH_PARALLEL_BFS_STEP(&graph_parallel_bfs_top_down_task);
+
+            size_t *temp = bfs.frontier;
+            bfs.frontier = bfs.next_frontier;
+            bfs.next_frontier = temp;
         }
-        
-        /* Check if graph has a cycle */
-        has_cycle = graph_has_cycle_helper(gr, iter, iter);
+
+        /* Sum the counters of all tasks */
+        bfs.frontier_size = 0;
+        frontier_edges = 0;
+
+        for (size_t task = 0; task < bfs.number_of_tasks; ++task) {
+            bfs.frontier_size += bfs.counts[task].vertices;
+            frontier_edges += bfs.counts[task].out_edges;
+            unvisited_edges -= bfs.counts[task].in_edges;
+        }
+
+        reached += bfs.frontier_size;
+        ++(bfs.level);
     }
 
-    /* 1 if graph has a cycle or 0 otherwise */
-    return has_cycle;
+    #undef GRAPH_PARALLEL_BFS_STEP
+
+free_bfs:
+    scl_free(csr->allocator, bfs.visited);
+    scl_free(csr->allocator, bfs.frontier);
+    scl_free(csr->allocator, bfs.next_frontier);
+    scl_free(csr->allocator, bfs.counts);
+    scl_free(csr->allocator, bfs.frontier_bits);
+    scl_free(csr->allocator, bfs.next_bits);
+
+    /* Return the number of reached vertices */
+    return reached;
 }
 
 /**
- * @brief Function to get all vertices that are resulting
- * from the start_vertex in other words there exists a path
- * from node X to node Y, in this case node Y will be part of
- * past nodes.
+ * @brief Function to grow all the arrays of a path query object.
  * 
- * @param gr a pointer to an allocated graph object
- * @param start_vertex a vertex to get its past vertices
- * @param vertex_path an allocated array to save all past vertices
- * @return size_t size of the past vertices or 0 if function failed 
+ * @param query pointer to an allocated path query object
+ * @param number_of_vertices new number of vertices of the arrays
+ * @return scl_error_t enum object for handling errors
  */
-size_t graph_vertex_past_vertices(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
-    /* Check if graph object is valid */
-    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size) || (NULL == vertex_path)) {
-        return 0;
-    }
+static scl_error_t graph_path_query_reserve(graph_path_query_t * const __restrict__ query, size_t number_of_vertices) {
+    for (size_t dir = 0; dir < 2; ++dir) {
+        uint32_t *try_realloc_marks = scl_realloc(query->allocator, query->marks[dir], sizeof(*try_realloc_marks) * number_of_vertices);
 
-    size_t traversed_vex = 0;
+        if (NULL == try_realloc_marks) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
 
-    /* Reset the visit array */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        gr->visit[iter] = 0;
-    }
+        query->marks[dir] = try_realloc_marks;
 
-    /* Create the bfs queue to find past nodes */
-    queue_t *bfs_queue = create_queue(NULL, sizeof(*vertex_path));
+        /* New vertices have never been reached */
+        memset(query->marks[dir] + query->capacity, 0, sizeof(*query->marks[dir]) * (number_of_vertices - query->capacity));
 
-    if (NULL != bfs_queue) {
-        gr->visit[start_vertex] = 1;
+        graph_weight_t *try_realloc_dists = scl_realloc(query->allocator, query->dists[dir], sizeof(*try_realloc_dists) * number_of_vertices);
 
-        if (SCL_OK != queue_push(bfs_queue, &start_vertex)) {
-            free_queue(bfs_queue);
-            return 0;
+        if (NULL == try_realloc_dists) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
         }
 
-        /* Start the bfs traversal */
-        while (!is_queue_empty(bfs_queue)) {
-            const size_t *front_vertex = queue_front(bfs_queue);
+        query->dists[dir] = try_realloc_dists;
 
-            /* Add node to past nodes */
-            if (start_vertex != *front_vertex) {
-                vertex_path[traversed_vex++] = *front_vertex;
-            }
+        size_t *try_realloc_parents = scl_realloc(query->allocator, query->parents[dir], sizeof(*try_realloc_parents) * number_of_vertices);
 
-            if (SCL_OK != queue_pop(bfs_queue)) {
-                free_queue(bfs_queue);
-                return 0;
-            }
+        if (NULL == try_realloc_parents) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
 
-            graph_link_t *link = gr->vertices[*front_vertex]->link;
+        query->parents[dir] = try_realloc_parents;
 
-            while (NULL != link) {
-                if (0 == gr->visit[link->vertex]) {
-                    gr->visit[link->vertex] = 1;
+        size_t *try_realloc_heap = scl_realloc(query->allocator, query->heaps[dir], sizeof(*try_realloc_heap) * number_of_vertices);
 
-                    if (SCL_OK != queue_push(bfs_queue, &link->vertex)) {
-                        free_queue(bfs_queue);
-                        return 0;
-                    }
-                }
+        if (NULL == try_realloc_heap) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
 
-                link = link->next;
-            }
+        query->heaps[dir] = try_realloc_heap;
+
+        size_t *try_realloc_heap_pos = scl_realloc(query->allocator, query->heap_pos[dir], sizeof(*try_realloc_heap_pos) * number_of_vertices);
+
+        if (NULL == try_realloc_heap_pos) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
         }
 
-        free_queue(bfs_queue);
+        query->heap_pos[dir] = try_realloc_heap_pos;
     }
 
-    /* Return number of the past vertices */
-    return traversed_vex;
+    query->capacity = number_of_vertices;
+
+    /* All good */
+    return SCL_OK;
 }
 
 /**
- * @brief Function to get the future vertices of the selected vertex.
- * Future vertices are the vertices that have a path ending in the selected node.
+ * @brief Function to allocate a path query object for the point-to-point
+ * shortest path functions, the arrays grow by themselves if a bigger
+ * graph is queried. Every thread uses its own path query object.
  * 
- * @param gr a pointer to an allocated graph object
- * @param start_vertex a vertex to get its future vertices
- * @param vertex_path an allocated array to save all future vertices
- * @return size_t size of the future vertices or 0 if function failed 
+ * @param number_of_vertices initial number of vertices of the arrays, can be 0
+ * @return graph_path_query_t* a new allocated path query object or `NULL` if function fails
  */
-size_t graph_vertex_future_vertices(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
-    /* Check if the graph object is valid */
-    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size) || (NULL == vertex_path)) {
-        return 0;
+graph_path_query_t* create_graph_path_query(size_t number_of_vertices) {
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    graph_path_query_t *new_query = scl_malloc(allocator, sizeof(*new_query));
+
+    if (NULL == new_query) {
+        errno = ENOMEM;
+        perror("Not enough memory for graph path query allocation");
+        return NULL;
+    }
+
+    new_query->allocator = allocator;
+    new_query->capacity = 0;
+    new_query->generation = 0;
+
+    for (size_t dir = 0; dir < 2; ++dir) {
+        new_query->marks[dir] = NULL;
+        new_query->dists[dir] = NULL;
+        new_query->parents[dir] = NULL;
+        new_query->heaps[dir] = NULL;
+        new_query->heap_pos[dir] = NULL;
+        new_query->heap_sizes[dir] = 0;
+    }
+
+    if ((number_of_vertices > 0) && (SCL_OK != graph_path_query_reserve(new_query, number_of_vertices))) {
+        free_graph_path_query(new_query);
+
+        errno = ENOMEM;
+        perror("Not enough memory to allocate arrays of the graph path query");
+        return NULL;
+    }
+
+    /* Return a new allocated path query object */
+    return new_query;
+}
+
+/**
+ * @brief Function to free all memory allocated for a path query object.
+ * 
+ * @param query pointer to an allocated path query object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_graph_path_query(graph_path_query_t * const __restrict__ query) {
+    /* Check if path query object is valid */
+    if (NULL == query) {
+        return SCL_NULL_GRAPH_PATH_QUERY;
+    }
+
+    for (size_t dir = 0; dir < 2; ++dir) {
+        scl_free(query->allocator, query->marks[dir]);
+        scl_free(query->allocator, query->dists[dir]);
+        scl_free(query->allocator, query->parents[dir]);
+        scl_free(query->allocator, query->heaps[dir]);
+        scl_free(query->allocator, query->heap_pos[dir]);
+    }
+
+    scl_free(query->allocator, query);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a new query with a path query object, every
+ * vertex becomes not reached by increasing the generation.
+ * 
+ * @param query pointer to an allocated path query object
+ * @param number_of_vertices number of vertices of the queried graph
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_path_query_begin(graph_path_query_t * const __restrict__ query, size_t number_of_vertices) {
+    if (number_of_vertices > query->capacity) {
+        scl_error_t err = graph_path_query_reserve(query, number_of_vertices);
+
+        if (SCL_OK != err) {
+            return err;
+        }
     }
 
-    /* Compute the transposed graph */
-    graph_t *transpose_graph = create_transpose_graph(gr);
+    /* Every mark is older than the new generation, except after a wrap around */
+    if (UINT32_MAX == query->generation) {
+        memset(query->marks[0], 0, sizeof(*query->marks[0]) * query->capacity);
+        memset(query->marks[1], 0, sizeof(*query->marks[1]) * query->capacity);
+        query->generation = 0;
+    }
 
-    /*
-     * Calculate the past vertices of the transposed graph
-     * that will be the future vertices of the selected graph
-     */
-    size_t traversed_vex = graph_vertex_past_vertices(transpose_graph, start_vertex, vertex_path);
+    ++(query->generation);
 
-    /* Free memory of the transposed graph */
-    free_graph(transpose_graph);
+    query->heap_sizes[0] = 0;
+    query->heap_sizes[1] = 0;
 
-    /* Return the size of the future vertices */
-    return traversed_vex;
+    /* All good */
+    return SCL_OK;
 }
 
 /**
- * @brief Function to get the anticone vertices of the selected vertex.
- * Anticone vertices are the vertices that do not have any path to selected
- * vertex.
+ * @brief Position in the heap of a settled vertex of a path query
  * 
- * @param gr a pointer to an allocated graph object
- * @param start_vertex a vertex to get its anticone vertices
- * @param vertex_path an allocated array to save all anticone vertices
- * @return size_t size of the anticone vertices or 0 if function failed 
  */
-size_t graph_vertex_anticone_vertices(const graph_t * const __restrict__ gr, size_t start_vertex, size_t * __restrict__ vertex_path) {
-    /* Check if graph object is valid */
-    if ((NULL == gr) || (NULL == gr->vertices) || (start_vertex >= gr->size) || (NULL == vertex_path)) {
-        return 0;
-    }
+#define GRAPH_PATH_QUERY_SETTLED SIZE_MAX
 
-    /* Allocate the past vertices array */
-    size_t * __restrict__ past_vertices = malloc(sizeof(*past_vertices) * gr->size);
+/**
+ * @brief Function to check if a vertex was reached by one search of the current query.
+ * 
+ * @param query pointer to a started path query object
+ * @param dir index of the search (0 from the start vertex, 1 from the end vertex)
+ * @param vertex vertex to check
+ * @return uint8_t 1 if the vertex was reached or 0 otherwise
+ */
+static inline uint8_t graph_path_query_reached(const graph_path_query_t * const __restrict__ query, size_t dir, size_t vertex) {
+    return (query->generation == query->marks[dir][vertex]);
+}
 
-    if (NULL == past_vertices) {
-        return 0;
+/**
+ * @brief Function to set the key of a vertex of one search (the key must not be greater
+ * than its previous key), a vertex not reached yet or already settled is inserted in
+ * the heap and a vertex from the heap is moved up.
+ * 
+ * @param query pointer to a started path query object
+ * @param dir index of the search and of its heap
+ * @param keys keys of the heap (the distances or the A* estimates)
+ * @param vertex reached vertex
+ * @param key new key of the vertex
+ */
+static void graph_path_query_update(graph_path_query_t * const __restrict__ query, size_t dir, graph_weight_t * const __restrict__ keys, size_t vertex, graph_weight_t key) {
+    if (0 == graph_path_query_reached(query, dir, vertex)) {
+        query->marks[dir][vertex] = query->generation;
+        query->heap_pos[dir][vertex] = GRAPH_PATH_QUERY_SETTLED;
     }
 
-    /* Allocate the future vertices array */
-    size_t * __restrict__ future_vertices = malloc(sizeof(*future_vertices) * gr->size);
+    keys[vertex] = key;
 
-    if (NULL == future_vertices) {
-        free(past_vertices);
-        return 0;
+    if (GRAPH_PATH_QUERY_SETTLED == query->heap_pos[dir][vertex]) {
+        query->heaps[dir][query->heap_sizes[dir]] = vertex;
+        graph_csr_heap_sift_up(query->heaps[dir], query->heap_pos[dir], keys, query->heap_sizes[dir]);
+        ++(query->heap_sizes[dir]);
+    } else {
+        graph_csr_heap_sift_up(query->heaps[dir], query->heap_pos[dir], keys, query->heap_pos[dir][vertex]);
     }
+}
 
-    /* Compute the past and future vertices of the selected vertex */
-    size_t past_size = graph_vertex_past_vertices(gr, start_vertex, past_vertices);
-    size_t future_size = graph_vertex_future_vertices(gr, start_vertex, future_vertices);
-    size_t traversed_size = 0;
-
-    /*
-     * Iterate through all vertices and if current vertex
-     * is not in the past or future vertices than the vertex
-     * is part of the anticone vertices
-     */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        uint8_t node_is_anticone = 1;
-
-        for (size_t iter_i = 0; (iter_i < past_size) && (1 == node_is_anticone); ++iter_i) {
-            if (iter == past_vertices[iter_i]) {
-                node_is_anticone = 0;
-            }
-        }
+/**
+ * @brief Function to remove the vertex with the minimum key from the heap of one search.
+ * 
+ * @param query pointer to a started path query object
+ * @param dir index of the search and of its heap
+ * @param keys keys of the heap (the distances or the A* estimates)
+ * @return size_t the settled vertex
+ */
+static size_t graph_path_query_pop(graph_path_query_t * const __restrict__ query, size_t dir, const graph_weight_t * const __restrict__ keys) {
+    size_t *heap = query->heaps[dir];
+    const size_t vertex = heap[0];
 
-        for (size_t iter_i = 0; (iter_i < future_size) && (1 == node_is_anticone); ++iter_i) {
-            if (iter == future_vertices[iter_i]) {
-                node_is_anticone = 0;
-            }
-        }
+    query->heap_pos[dir][vertex] = GRAPH_PATH_QUERY_SETTLED;
 
-        if ((1 == node_is_anticone) && (start_vertex != iter)) {
-            vertex_path[traversed_size++] = iter;
-        }
+    if (0 != --(query->heap_sizes[dir])) {
+        heap[0] = heap[query->heap_sizes[dir]];
+        graph_csr_heap_sift_down(heap, query->heap_pos[dir], keys, query->heap_sizes[dir], 0);
     }
 
-    /* Return the size of the anticone vertices */
-    return traversed_size;
+    return vertex;
 }
 
 /**
- * @brief Function to get the tips vertices of the graph.
- * The tips vertices are the vertices that have the in-degree
- * zero, but can have out-degree as bigger as they want
+ * @brief Function to write the path found by a query, the vertices from the start
+ * vertex to the meeting vertex follow the parents of the forward search (in reverse)
+ * and the vertices after it follow the parents of the backward search.
  * 
- * @param gr a pointer to an allocated graph object
- * @param vertex_path an allocated array to save all tips vertices
- * @return size_t size of the tips vertices or 0 if function failed 
+ * @param query pointer to a path query object after a search
+ * @param meet_vertex vertex where the two searches met (the end vertex for one search)
+ * @param backward 1 if the backward search parents are used after the meeting vertex
+ * @param vertex_path an array to save the path or `NULL`
+ * @return size_t number of vertices of the path
  */
-size_t graph_tips_vertices(const graph_t * const __restrict__ gr, size_t * __restrict__ vertex_path) {
-    /* Check if graph object is valid */
-    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == vertex_path)) {
-        return 0;
+static size_t graph_path_query_path(const graph_path_query_t * const __restrict__ query, size_t meet_vertex, uint8_t backward, size_t * __restrict__ vertex_path) {
+    size_t path_size = 0;
+
+    /* Count the vertices up to the meeting vertex */
+    for (size_t vertex = meet_vertex; SIZE_MAX != vertex; vertex = query->parents[0][vertex]) {
+        ++path_size;
     }
 
-    size_t traversed_size = 0;
+    if (NULL != vertex_path) {
+        size_t path_index = path_size;
 
-    /* Iterate through all vertices and check their in degree */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        if (NULL != gr->vertices[iter]) {
-            if (0 == gr->vertices[iter]->in_deg) {
-                vertex_path[traversed_size++] = iter;
+        for (size_t vertex = meet_vertex; SIZE_MAX != vertex; vertex = query->parents[0][vertex]) {
+            vertex_path[--path_index] = vertex;
+        }
+    }
+
+    if (1 == backward) {
+        for (size_t vertex = query->parents[1][meet_vertex]; SIZE_MAX != vertex; vertex = query->parents[1][vertex]) {
+            if (NULL != vertex_path) {
+                vertex_path[path_size] = vertex;
             }
+
+            ++path_size;
         }
     }
 
-    /* Return the number of the tips vertices */
-    return traversed_size;
+    return path_size;
 }
 
 /**
- * @brief Subroutine function to push on stack dfs traversed
- * vertices to perform a topological sort of the graph
+ * @brief Function to compute the shortest path between two vertices with a
+ * caller owned path query object. If the transposed graph is given it runs a
+ * bidirectional dijkstra: one search from the start vertex on the graph and one
+ * from the end vertex on the transposed graph, the search with the smaller heap
+ * goes on and the query stops as soon as the two smallest distances of the heaps
+ * add up to the best path found, so both searches stay around their vertices.
+ * With a `NULL` transposed graph a dijkstra search from the start vertex stops
+ * when the end vertex is settled. Only the reached vertices are touched, so
+ * many queries on a big graph are fast. Negative edges are not supported.
  * 
  * @param gr a pointer to an allocated graph object
- * @param start_vertex vertex to perform a dfs traversa;
- * @param stack pointer to a stack object to push vertices
+ * @param transpose_gr the transposed graph (see **create_transpose_graph**) or `NULL`
+ * @param query a pointer to an allocated path query object
+ * @param start_vertex the first vertex of the path
+ * @param end_vertex the last vertex of the path
+ * @param path_dist pointer to save the length of the path (GRAPH_WEIGHT_MAX if there is none)
+ * @param vertex_path an array of gr->size elements to save the vertices of the path from
+ * start_vertex to end_vertex or `NULL`
+ * @param path_size pointer to save the number of vertices of the path (0 if there is none) or `NULL`
+ * @return scl_error_t enum object for handling errors
  */
-static void graph_topological_sort_helper(const graph_t * const __restrict__ gr, size_t start_vertex, sstack_t * const __restrict__ stack) {
-    /* Check if selected vertex is allocated */
-    if (NULL == gr->vertices[start_vertex]) {
-        return;
+scl_error_t graph_shortest_path_ctx(const graph_t * const __restrict__ gr, const graph_t * const __restrict__ transpose_gr, graph_path_query_t * const __restrict__ query, size_t start_vertex, size_t end_vertex, graph_weight_t * __restrict__ path_dist, size_t * __restrict__ vertex_path, size_t * __restrict__ path_size) {
+    /* Check if graph pointer is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
     }
 
-    /* Visit the current selected vertex */
-    gr->visit[start_vertex] = 1;
+    /* Check if vertices array is allocated */
+    if (NULL == gr->vertices) {
+        return SCL_NULL_GRAPH_VERTICES;
+    }
 
-    graph_link_t * link = gr->vertices[start_vertex]->link;
+    /* Check if path query object is valid */
+    if (NULL == query) {
+        return SCL_NULL_GRAPH_PATH_QUERY;
+    }
 
-    /* Perform a dfs call on start_index */
-    for(; link != NULL; link = link->next) {
-        if (0 == gr->visit[link->vertex]) {
-            graph_topological_sort_helper(gr, link->vertex, stack);
-        }
+    /* Check if the distance can be returned */
+    if (NULL == path_dist) {
+        return SCL_NULL_VERTICES_DISTANCES;
     }
 
-    /* Push the selected vertex after dfs call */
-    stack_push(stack, &start_vertex);
-}
+    /* Check if the vertices are in the graph */
+    if ((start_vertex >= gr->size) || (end_vertex >= gr->size)) {
+        return SCL_VERTEX_OUT_OF_BOUND;
+    }
 
-/**
- * @brief Function to get the topological sort of the
- * selected graph. Function may fail if graph object is invalid.
- * Or no heap memory is left for stack memory allocation
- * 
- * @param gr a pointer to an allocated graph object
- * @param vertex_path an allocated array to save the path of topological sort
- * @return size_t the number of the traversed vertices by topological sort
- */
-size_t graph_topological_sort(const graph_t * const __restrict__ gr, size_t * __restrict__ vertex_path) {
-    /* Check if graph object is valid */
-    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == gr->visit) || (NULL == vertex_path)) {
-        return 0;
+    /* Check if the transposed graph matches the graph */
+    if ((NULL != transpose_gr) && ((NULL == transpose_gr->vertices) || (gr->size != transpose_gr->size))) {
+        return SCL_INVALID_INPUT;
     }
 
-    /* Create a stack subroutine for topological sort */
-    sstack_t *sort_stack = create_stack(NULL, sizeof(*vertex_path));
+    scl_error_t err = graph_path_query_begin(query, gr->size);
 
-    if (NULL == sort_stack) {
-        return 0;
+    if (SCL_OK != err) {
+        return err;
     }
 
-    /* Reset the visit array */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        gr->visit[iter] = 0;
-    }
+    const graph_t *graphs[2] = { gr, transpose_gr };
+    graph_weight_t best_dist = GRAPH_WEIGHT_MAX;
+    size_t meet_vertex = SIZE_MAX;
 
-    /* Perform the topological sort dfs call */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        if (0 == gr->visit[iter]) {
-            graph_topological_sort_helper(gr, iter, sort_stack);
+    graph_path_query_update(query, 0, query->dists[0], start_vertex, 0);
+    query->parents[0][start_vertex] = SIZE_MAX;
+
+    if (NULL != transpose_gr) {
+        graph_path_query_update(query, 1, query->dists[1], end_vertex, 0);
+        query->parents[1][end_vertex] = SIZE_MAX;
+
+        if (start_vertex == end_vertex) {
+            best_dist = 0;
+            meet_vertex = start_vertex;
         }
     }
 
-    size_t traversed_size = 0;
-    scl_error_t err = SCL_OK;
+    while (0 != query->heap_sizes[0]) {
+        size_t dir = 0;
 
-    /* The topological sort of the graph is the reverse of the dfs calls */
-    while (!is_stack_empty(sort_stack)) {
-        const size_t *top_vertex = stack_top(sort_stack);
+        if (NULL != transpose_gr) {
+            /* One search settled all its vertices, the best path is final */
+            if (0 == query->heap_sizes[1]) {
+                break;
+            }
 
-        vertex_path[traversed_size++] = *top_vertex;
+            /* No path through the not settled vertices is shorter */
+            if ((GRAPH_WEIGHT_MAX != best_dist) &&
+                (query->dists[0][query->heaps[0][0]] + query->dists[1][query->heaps[1][0]] >= best_dist)) {
+                break;
+            }
 
-        err = stack_pop(sort_stack);
+            dir = (query->heap_sizes[1] < query->heap_sizes[0]) ? 1 : 0;
+        }
 
-        if (SCL_OK != err) {
-            free_stack(sort_stack);
-            return traversed_size;
+        const size_t vertex = graph_path_query_pop(query, dir, query->dists[dir]);
+
+        /* Dijkstra from the start vertex settled the end vertex */
+        if ((NULL == transpose_gr) && (end_vertex == vertex)) {
+            best_dist = query->dists[0][vertex];
+            meet_vertex = vertex;
+            break;
+        }
+
+        if (NULL == graphs[dir]->vertices[vertex]) {
+            return SCL_NULL_GRAPH_VERTEX;
+        }
+
+        /* Relax the edges of the settled vertex */
+        for (const graph_link_t *link = graphs[dir]->vertices[vertex]->link; NULL != link; link = link->next) {
+            const size_t next_vertex = link->vertex;
+            const graph_weight_t new_dist = query->dists[dir][vertex] + link->edge_len;
+
+            if ((0 == graph_path_query_reached(query, dir, next_vertex)) || (new_dist < query->dists[dir][next_vertex])) {
+                graph_path_query_update(query, dir, query->dists[dir], next_vertex, new_dist);
+                query->parents[dir][next_vertex] = vertex;
+                SCL_STATS_ADD(gr, relaxations, 1);
+            }
+
+            /* The two searches met, check the path through the edge */
+            if ((NULL != transpose_gr) && (1 == graph_path_query_reached(query, 1 - dir, next_vertex)) &&
+                (new_dist + query->dists[1 - dir][next_vertex] < best_dist)) {
+                best_dist = new_dist + query->dists[1 - dir][next_vertex];
+                meet_vertex = next_vertex;
+            }
         }
     }
 
-    free_stack(sort_stack);
+    *path_dist = best_dist;
 
-    /*
-     * Return the number of traversed vertices,
-     * should be gr->size if everything went good
-     */
-    return traversed_size;
+    size_t new_path_size = 0;
+
+    if (SIZE_MAX != meet_vertex) {
+        new_path_size = graph_path_query_path(query, meet_vertex, (NULL != transpose_gr), vertex_path);
+    }
+
+    if (NULL != path_size) {
+        *path_size = new_path_size;
+    }
+
+    /* All good */
+    return SCL_OK;
 }
 
 /**
- * @brief Compare function to create a min priority queue.
+ * @brief Function to compute the shortest path between two vertices, with
+ * a temporary path query object (see **graph_shortest_path_ctx**).
  * 
- * @param elem1 constant pointer to first element to compare
- * @param elem2 constant pointer to second element to compare
- * @return int32_t 1 if elem1 < elem2, -1 if elem1 > elem2, 0 if elem1 == elem2
+ * @param gr a pointer to an allocated graph object
+ * @param transpose_gr the transposed graph (see **create_transpose_graph**) or `NULL`
+ * @param start_vertex the first vertex of the path
+ * @param end_vertex the last vertex of the path
+ * @param path_dist pointer to save the length of the path (GRAPH_WEIGHT_MAX if there is none)
+ * @param vertex_path an array of gr->size elements to save the vertices of the path from
+ * start_vertex to end_vertex or `NULL`
+ * @param path_size pointer to save the number of vertices of the path (0 if there is none) or `NULL`
+ * @return scl_error_t enum object for handling errors
  */
-static int32_t min_heap_cmp_func(const void * const elem1, const void * const elem2) {
-    if ((NULL != elem1) && (NULL != elem2)) {
-        const size_t * const f_elem1 = elem1;
-        const size_t * const f_elem2 = elem2;
+scl_error_t graph_shortest_path(const graph_t * const __restrict__ gr, const graph_t * const __restrict__ transpose_gr, size_t start_vertex, size_t end_vertex, graph_weight_t * __restrict__ path_dist, size_t * __restrict__ vertex_path, size_t * __restrict__ path_size) {
+    /* Check if graph object is valid */
+    if (NULL == gr) {
+        return SCL_NULL_GRAPH;
+    }
 
-        if (*f_elem1 > *f_elem2) {
-            return -1;
-        } else if (*f_elem1 < *f_elem2) {
-            return 1;
-        } else {
-            return 0;
-        }
+    graph_path_query_t *query = create_graph_path_query(gr->size);
+
+    if (NULL == query) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
     }
 
-    return 0;
-} 
+    scl_error_t err = graph_shortest_path_ctx(gr, transpose_gr, query, start_vertex, end_vertex, path_dist, vertex_path, path_size);
+
+    free_graph_path_query(query);
+
+    return err;
+}
 
 /**
- * @brief Function to compute the minimum distances starting
- * from selected vertex to all other graph vertices.
- * If the selected vertex has no path to another vertex the
- * distance will be __LDBL_MAX__. The distances will be computed
- * by dijkstra method, so graphs with negative cycles will fail.
- * The parent path array can be `NULL`.
+ * @brief Function to compute the shortest path between two vertices by the
+ * A* search with a caller owned path query object. The vertices are settled in
+ * the order of their distance from the start vertex plus the heuristic estimate
+ * to the end vertex, so with a good heuristic just the vertices around the path
+ * are settled, and the search stops when the end vertex is settled. The heuristic
+ * must not overestimate the distance to the end vertex (vertices whose distance
+ * gets shorter after they were settled are searched again). A `NULL` heuristic
+ * is zero for every vertex, the same as a dijkstra search stopping at the end vertex.
  * 
  * @param gr a pointer to an allocated graph object
- * @param start_vertex vertex to compute the distances beginning from it
- * @param vertex_dists an allocated array with all distances beginning from start_vertex
- * @param vertex_parents an array with vertices showing the minimum path from
- * start_vertex to any other vertex
+ * @param query a pointer to an allocated path query object
+ * @param start_vertex the first vertex of the path
+ * @param end_vertex the last vertex of the path
+ * @param heuristic a lower bound of the distance from a vertex to the end vertex or `NULL`
+ * @param arg argument passed to every call of the heuristic
+ * @param path_dist pointer to save the length of the path (GRAPH_WEIGHT_MAX if there is none)
+ * @param vertex_path an array of gr->size elements to save the vertices of the path from
+ * start_vertex to end_vertex or `NULL`
+ * @param path_size pointer to save the number of vertices of the path (0 if there is none) or `NULL`
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t graph_dijkstra(const graph_t * const __restrict__ gr, size_t start_vertex, long double * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents) {
+scl_error_t graph_astar_ctx(const graph_t * const __restrict__ gr, graph_path_query_t * const __restrict__ query, size_t start_vertex, size_t end_vertex, graph_heuristic_func heuristic, void * const arg, graph_weight_t * __restrict__ path_dist, size_t * __restrict__ vertex_path, size_t * __restrict__ path_size) {
     /* Check if graph pointer is valid */
     if (NULL == gr) {
         return SCL_NULL_GRAPH;
@@ -1265,445 +6010,609 @@ scl_error_t graph_dijkstra(const graph_t * const __restrict__ gr, size_t start_v
         return SCL_NULL_GRAPH_VERTICES;
     }
 
-    /* Check if distances array is allocated */
-    if (NULL == vertex_dists) {
-        return SCL_NULL_VERTICES_DISTANCES;
+    /* Check if path query object is valid */
+    if (NULL == query) {
+        return SCL_NULL_GRAPH_PATH_QUERY;
     }
 
-    /* Allocate a vertices array to heapify the min heap */
-    size_t *vertices = malloc(sizeof(*vertices) * gr->size);
-
-    if (NULL == vertices) {
-        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    /* Check if the distance can be returned */
+    if (NULL == path_dist) {
+        return SCL_NULL_VERTICES_DISTANCES;
     }
 
-    if (NULL != vertex_parents) {
-        for (size_t iter = 0; iter < gr->size; ++iter) {
-            vertex_parents[iter] = SIZE_MAX;
-        }
-
-        vertex_parents[start_vertex] = -1;
+    /* Check if the vertices are in the graph */
+    if ((start_vertex >= gr->size) || (end_vertex >= gr->size)) {
+        return SCL_VERTEX_OUT_OF_BOUND;
     }
 
-    /* Set default values */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        vertices[iter] = iter;
-        vertex_dists[iter] = __LDBL_MAX__;
+    scl_error_t err = graph_path_query_begin(query, gr->size);
+
+    if (SCL_OK != err) {
+        return err;
     }
 
-    vertex_dists[start_vertex] = 0;
+    /* The distances are kept by the first search and the heap is ordered by the estimates */
+    graph_weight_t *dists = query->dists[0];
+    graph_weight_t *estimates = query->dists[1];
 
-    /* Create the min heap priority queue */
-    priority_queue_t *min_heap = create_priority_queue(gr->size, &min_heap_cmp_func, &min_heap_cmp_func, NULL, NULL, sizeof(*vertex_dists), sizeof(*vertices));
+    graph_path_query_update(query, 0, estimates, start_vertex, (NULL != heuristic) ? heuristic(start_vertex, end_vertex, arg) : 0);
+    dists[start_vertex] = 0;
+    query->parents[0][start_vertex] = SIZE_MAX;
 
-    if (NULL == min_heap) {
-        free(vertices);
+    *path_dist = GRAPH_WEIGHT_MAX;
 
-        return SCL_NULL_PRIORITY_QUEUE;
+    if (NULL != path_size) {
+        *path_size = 0;
     }
 
-    /* Heapify the vertices and the default distances */
-    scl_error_t err = heapify(min_heap, vertices, vertex_dists);
-    free(vertices);
-
-    if (SCL_OK != err) {
-        free_priority_queue(min_heap);
-
-        return err;
-    }
+    while (0 != query->heap_sizes[0]) {
+        const size_t vertex = graph_path_query_pop(query, 0, estimates);
 
-    /* Perform the dijkstra's algorithm */
-    while (!is_priq_empty(min_heap)) {
+        /* The end vertex is settled, its distance is final */
+        if (end_vertex == vertex) {
+            *path_dist = dists[vertex];
 
-        /* Get the vertex with the minimum distance */
-        size_t min_dist_vertex = *(size_t *)pri_queue_top(min_heap);
-        
-        err = pri_queue_pop(min_heap);
+            size_t new_path_size = graph_path_query_path(query, vertex, 0, vertex_path);
 
-        if (SCL_OK != err) {
-            free_priority_queue(min_heap);
+            if (NULL != path_size) {
+                *path_size = new_path_size;
+            }
 
-            return err;
+            break;
         }
 
-        if (NULL == gr->vertices[min_dist_vertex]) {
-            free_priority_queue(min_heap);
-
+        if (NULL == gr->vertices[vertex]) {
             return SCL_NULL_GRAPH_VERTEX;
         }
 
-        graph_link_t *link = gr->vertices[min_dist_vertex]->link;
-
-        /* Iterate through edges of the current minimum vertex */
-        for (; link != NULL; link = link->next) {
-            size_t vertex_heap_index = pri_find_data_index(min_heap, &link->vertex);
-
-            /* Update destination vertex distance if any improvement can be done */
-            if ((SIZE_MAX != vertex_heap_index) &&
-                (vertex_dists[min_dist_vertex] != __LDBL_MAX__) &&
-                (link->edge_len + vertex_dists[min_dist_vertex] < vertex_dists[link->vertex])) {
-                if (NULL != vertex_parents) {
-                    vertex_parents[link->vertex] = min_dist_vertex;
-                }
-
-                vertex_dists[link->vertex] = vertex_dists[min_dist_vertex] + link->edge_len;
+        /* Relax the edges of the settled vertex */
+        for (const graph_link_t *link = gr->vertices[vertex]->link; NULL != link; link = link->next) {
+            const size_t next_vertex = link->vertex;
+            const graph_weight_t new_dist = dists[vertex] + link->edge_len;
 
-                err = change_node_priority(min_heap, pri_find_data_index(min_heap, &link->vertex), &vertex_dists[link->vertex]);
+            if ((1 == graph_path_query_reached(query, 0, next_vertex)) && (new_dist >= dists[next_vertex])) {
+                continue;
+            }
 
-                if (SCL_OK != err) {
-                    free_priority_queue(min_heap);
+            /* The estimate of a reached vertex gets smaller with its distance, the heuristic is the same */
+            graph_path_query_update(query, 0, estimates, next_vertex, new_dist + ((NULL != heuristic) ? heuristic(next_vertex, end_vertex, arg) : 0));
 
-                    return err;
-                }
-            }
+            dists[next_vertex] = new_dist;
+            query->parents[0][next_vertex] = vertex;
+            SCL_STATS_ADD(gr, relaxations, 1);
         }
     }
 
-    /* Free priority queue and return SCL_OK */
-    return free_priority_queue(min_heap);
+    /* All good */
+    return SCL_OK;
 }
 
-/**
- * @brief Function to compute the minimum cost spanning tree
- * of the selected graph where the root of the spanning tree
- * is the start_index vertex. 
+/**
+ * @brief Function to compute the shortest path between two vertices by the A*
+ * search, with a temporary path query object (see **graph_astar_ctx**).
  * 
  * @param gr a pointer to an allocated graph object
- * @param start_vertex vertex to start to compute the spanning tree
- * @param vertex_dists an allocated array with all distances beginning from start_vertex
- * @param vertex_parents an allocated array with vertices showing the minimum cost spanning tree
+ * @param start_vertex the first vertex of the path
+ * @param end_vertex the last vertex of the path
+ * @param heuristic a lower bound of the distance from a vertex to the end vertex or `NULL`
+ * @param arg argument passed to every call of the heuristic
+ * @param path_dist pointer to save the length of the path (GRAPH_WEIGHT_MAX if there is none)
+ * @param vertex_path an array of gr->size elements to save the vertices of the path from
+ * start_vertex to end_vertex or `NULL`
+ * @param path_size pointer to save the number of vertices of the path (0 if there is none) or `NULL`
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t graph_prim(const graph_t * const __restrict__ gr, size_t start_index, long double * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents) {
-    /* Check if graph pointer is valid */
+scl_error_t graph_astar(const graph_t * const __restrict__ gr, size_t start_vertex, size_t end_vertex, graph_heuristic_func heuristic, void * const arg, graph_weight_t * __restrict__ path_dist, size_t * __restrict__ vertex_path, size_t * __restrict__ path_size) {
+    /* Check if graph object is valid */
     if (NULL == gr) {
         return SCL_NULL_GRAPH;
     }
 
-    /* Check if vertices array is allocated */
-    if (NULL == gr->vertices) {
-        return SCL_NULL_GRAPH_VERTICES;
-    }
+    graph_path_query_t *query = create_graph_path_query(gr->size);
 
-    /* Check if distances array is allocated */
-    if (NULL == vertex_dists) {
-        return SCL_NULL_VERTICES_DISTANCES;
+    if (NULL == query) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
     }
 
-    /* Check if parents array is allocated */
-    if (NULL == vertex_parents) {
-        return SCL_NULL_VERTICES_PARENTS;
-    }
+    scl_error_t err = graph_astar_ctx(gr, query, start_vertex, end_vertex, heuristic, arg, path_dist, vertex_path, path_size);
 
-    /* Allocate a vertices array to heapify the min heap */
-    size_t *vertices = malloc(sizeof(*vertices) * gr->size);
+    free_graph_path_query(query);
 
-    if (NULL == vertices) {
-        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
-    }
+    return err;
+}
 
-    /* Set default values */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        vertices[iter] = iter;
-        vertex_dists[iter] = __LDBL_MAX__;
-        vertex_parents[iter] = SIZE_MAX;
-    }
+/**
+ * @brief Maximum number of buckets of the delta-stepping, if the longest edge
+ * needs more buckets of delta width the delta is made bigger
+ * 
+ */
+#define GRAPH_DELTA_STEPPING_MAX_BUCKETS 65536
 
-    vertex_parents[start_index] = -1;
-    vertex_dists[start_index] = 0;
+/**
+ * @brief Growable array of vertices of the delta-stepping
+ * 
+ */
+typedef struct graph_delta_vertices_s {
+    size_t *data;                                           /* Vertices of the array */
+    size_t size;                                            /* Number of vertices */
+    size_t capacity;                                        /* Number of allocated vertices */
+} graph_delta_vertices_t;
 
-    /* Create the min heap priority queue */
-    priority_queue_t *min_heap = create_priority_queue(gr->size, &min_heap_cmp_func, &min_heap_cmp_func, NULL, NULL, sizeof(*vertex_dists), sizeof(*vertices));
+/**
+ * @brief One relaxation of an edge, sent to the task owning the end vertex
+ * 
+ */
+typedef struct graph_delta_request_s {
+    size_t vertex;                                          /* End vertex of the relaxed edge */
+    size_t parent;                                          /* Start vertex of the relaxed edge */
+    graph_weight_t dist;                                    /* Distance of the end vertex through the edge */
+} graph_delta_request_t;
 
-    if (NULL == min_heap) {
-        free(vertices);
+/**
+ * @brief Growable array of relaxations of the delta-stepping
+ * 
+ */
+typedef struct graph_delta_requests_s {
+    graph_delta_request_t *data;                            /* Relaxations of the array */
+    size_t size;                                            /* Number of relaxations */
+    size_t capacity;                                        /* Number of allocated relaxations */
+} graph_delta_requests_t;
 
-        return SCL_NULL_PRIORITY_QUEUE;
-    }
+/**
+ * @brief State of one delta-stepping shared by the tasks of every phase. The
+ * vertices are split in ranges and every task owns one range: it is the only
+ * one writing the distances, parents and buckets of its vertices, so the
+ * phases need no locks. Task `t` sends the relaxations of the edges ending
+ * in range `o` into requests[t * number_of_tasks + o].
+ * 
+ */
+typedef struct graph_delta_stepping_s {
+    const graph_csr_t *csr;                                 /* Searched graph CSR snapshot */
+    graph_weight_t *vertex_dists;                           /* Tentative distances of the vertices */
+    size_t *vertex_parents;                                 /* Parents of the vertices or `NULL` */
+    graph_weight_t delta;                                   /* Width of one bucket of distances */
+    size_t number_of_tasks;                                 /* Number of tasks (and vertex ranges) */
+    size_t range_size;                                      /* Number of vertices of one range */
+    size_t number_of_buckets;                               /* Number of buckets of the cyclic bucket array */
+    size_t bucket;                                          /* Index of the current bucket */
+    uint8_t heavy;                                          /* 1 if the heavy edges are relaxed, 0 for light edges */
+    size_t *bucket_of;                                      /* Bucket holding every vertex or SIZE_MAX */
+    size_t *settled_in;                                     /* Bucket that removed every vertex last or SIZE_MAX */
+    graph_delta_vertices_t *buckets;                        /* Cyclic buckets of every range (number_of_buckets per task) */
+    graph_delta_vertices_t *frontiers;                      /* Vertices of every range removed from the current bucket by the last phase */
+    graph_delta_vertices_t *settled;                        /* Vertices of every range removed from the current bucket */
+    graph_delta_requests_t *requests;                       /* Relaxations from every task to every range */
+    uint8_t *failed;                                        /* 1 for every task that could not grow an array */
+} graph_delta_stepping_t;
 
-    /* Heapify the vertices and the default distances */
-    scl_error_t err = heapify(min_heap, vertices, vertex_dists);
-    free(vertices);
+/**
+ * @brief Function to append one vertex to a growable array of the delta-stepping.
+ * 
+ * @param allocator allocator of the graph CSR snapshot
+ * @param vertices pointer to a growable array of vertices
+ * @param vertex vertex to append
+ * @return uint8_t 1 if the vertex was appended or 0 if no memory is left
+ */
+static uint8_t graph_delta_push_vertex(const scl_allocator_t * const __restrict__ allocator, graph_delta_vertices_t * const __restrict__ vertices, size_t vertex) {
+    if (vertices->size == vertices->capacity) {
+        size_t new_capacity = (0 == vertices->capacity) ? 16 : (2 * vertices->capacity);
+        size_t *try_realloc = scl_realloc(allocator, vertices->data, sizeof(*try_realloc) * new_capacity);
 
-    if (SCL_OK != err) {
-        free_priority_queue(min_heap);
+        if (NULL == try_realloc) {
+            return 0;
+        }
 
-        return err;
+        vertices->data = try_realloc;
+        vertices->capacity = new_capacity;
     }
 
-    /* Perform the prim's algorithm */
-    while (!is_priq_empty(min_heap)) {
+    vertices->data[(vertices->size)++] = vertex;
 
-        /* Get the vertex with the minimum distance */
-        size_t min_dist_vertex = *(size_t *)pri_queue_top(min_heap);
-        
-        err = pri_queue_pop(min_heap);
+    return 1;
+}
 
-        if (SCL_OK != err) {
-            free_priority_queue(min_heap);
+/**
+ * @brief Function to append one relaxation to a growable array of the delta-stepping.
+ * 
+ * @param allocator allocator of the graph CSR snapshot
+ * @param requests pointer to a growable array of relaxations
+ * @param vertex end vertex of the relaxed edge
+ * @param parent start vertex of the relaxed edge
+ * @param dist distance of the end vertex through the edge
+ * @return uint8_t 1 if the relaxation was appended or 0 if no memory is left
+ */
+static uint8_t graph_delta_push_request(const scl_allocator_t * const __restrict__ allocator, graph_delta_requests_t * const __restrict__ requests, size_t vertex, size_t parent, graph_weight_t dist) {
+    if (requests->size == requests->capacity) {
+        size_t new_capacity = (0 == requests->capacity) ? 16 : (2 * requests->capacity);
+        graph_delta_request_t *try_realloc = scl_realloc(allocator, requests->data, sizeof(*try_realloc) * new_capacity);
 
-            return err;
+        if (NULL == try_realloc) {
+            return 0;
         }
 
-        if (NULL == gr->vertices[min_dist_vertex]) {
-            free_priority_queue(min_heap);
+        requests->data = try_realloc;
+        requests->capacity = new_capacity;
+    }
 
-            return SCL_NULL_GRAPH_VERTEX;
-        }
+    graph_delta_request_t *request = &requests->data[(requests->size)++];
 
-        graph_link_t *link = gr->vertices[min_dist_vertex]->link;
+    request->vertex = vertex;
+    request->parent = parent;
+    request->dist = dist;
 
-        /* Iterate through edges of the current minimum vertex */
-        for (; link != NULL; link = link->next) {
-            size_t vertex_heap_index = pri_find_data_index(min_heap, &link->vertex);
+    return 1;
+}
 
-            /* Update destination vertex distance if any improvement can be done */
-            if ((SIZE_MAX != vertex_heap_index) &&
-                (vertex_dists[min_dist_vertex] != __LDBL_MAX__) &&
-                (link->edge_len < vertex_dists[link->vertex])) {
+/**
+ * @brief Task removing the vertices of one range from the current bucket, they
+ * become the frontier of the next light phase. Vertices moved to another bucket
+ * after they were inserted are skipped.
+ * 
+ * @param arg pointer to the delta-stepping state
+ * @param task index of the task (range of vertices)
+ */
+static void graph_delta_collect_task(void * const arg, size_t task) {
+    graph_delta_stepping_t *ds = arg;
+    graph_delta_vertices_t *bucket = &ds->buckets[task * ds->number_of_buckets + ds->bucket % ds->number_of_buckets];
+    graph_delta_vertices_t *frontier = &ds->frontiers[task];
 
-                vertex_parents[link->vertex] = min_dist_vertex;
-                vertex_dists[link->vertex] = link->edge_len;
+    frontier->size = 0;
 
-                err = change_node_priority(min_heap, pri_find_data_index(min_heap, &link->vertex), &vertex_dists[link->vertex]);
+    for (size_t iter = 0; iter < bucket->size; ++iter) {
+        const size_t vertex = bucket->data[iter];
 
-                if (SCL_OK != err) {
-                    free_priority_queue(min_heap);
+        if (ds->bucket != ds->bucket_of[vertex]) {
+            continue;
+        }
 
-                    return err;
-                }
+        ds->bucket_of[vertex] = SIZE_MAX;
+
+        if (0 == graph_delta_push_vertex(ds->csr->allocator, frontier, vertex)) {
+            ds->failed[task] = 1;
+            return;
+        }
+
+        /* Remember the vertex once for the heavy edges of the bucket */
+        if (ds->bucket != ds->settled_in[vertex]) {
+            ds->settled_in[vertex] = ds->bucket;
+
+            if (0 == graph_delta_push_vertex(ds->csr->allocator, &ds->settled[task], vertex)) {
+                ds->failed[task] = 1;
+                return;
             }
         }
     }
 
-    /* Free priority queue and return SCL_OK */
-    return free_priority_queue(min_heap);
+    bucket->size = 0;
 }
 
 /**
- * @brief Function to calculate a matrix of minimum distances between
- * any two vertices if no path exists between two vertices than
- * __LDBL_MAX__ will be calculated.
+ * @brief Task relaxing the light edges (not longer than delta) of the frontier
+ * of one range, or the heavy edges of all vertices removed from the current bucket,
+ * the relaxations are sent to the tasks owning the end vertices.
  * 
- * @param gr a pointer to an allocated graph object
- * @param vertices_dists an allocated matrix of gr->size X gr->size dimension
- * @return scl_error_t enum object for handling errors
+ * @param arg pointer to the delta-stepping state
+ * @param task index of the task (range of vertices)
  */
-scl_error_t graph_floyd_warshall(const graph_t * const __restrict__ gr, long double ** __restrict__ vertices_dists) {
-    /* Check if graph pointer is valid */
-    if (NULL == gr) {
-        return SCL_NULL_GRAPH;
-    }
+static void graph_delta_relax_task(void * const arg, size_t task) {
+    graph_delta_stepping_t *ds = arg;
+    const graph_csr_t *csr = ds->csr;
+    const graph_delta_vertices_t *vertices = (1 == ds->heavy) ? &ds->settled[task] : &ds->frontiers[task];
 
-    /* Check if vertices array is allocated */
-    if (NULL == gr->vertices) {
-        return SCL_NULL_GRAPH_VERTICES;
-    }
+    for (size_t iter = 0; iter < vertices->size; ++iter) {
+        const size_t vertex = vertices->data[iter];
+        const graph_weight_t dist = ds->vertex_dists[vertex];
 
-    /* Check if vertices distances matrix is allocated */
-    if (NULL == vertices_dists) {
-        return SCL_NULL_PATH_MATRIX;
-    }
+        for (size_t edge = csr->offsets[vertex]; edge < csr->offsets[vertex + 1]; ++edge) {
+            const graph_weight_t edge_len = csr->weights[edge];
 
-    /* Set default values of the distances matrix */
-    for (size_t iter_i = 0; iter_i < gr->size; ++iter_i) {
-        for (size_t iter_j = 0; iter_j < gr->size; ++iter_j) {
-            vertices_dists[iter_i][iter_j] = __LDBL_MAX__;
-        }
-    }
+            if ((edge_len > ds->delta) != (1 == ds->heavy)) {
+                continue;
+            }
 
-    /* Set the initial edge length between two vertices */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        if (NULL == gr->vertices[iter]) {
-            return SCL_NULL_GRAPH_VERTEX;
-        }
+            const size_t next_vertex = csr->targets[edge];
+            const graph_weight_t new_dist = dist + edge_len;
 
-        graph_link_t *link = gr->vertices[iter]->link;
+            /* Skip the relaxations that cannot improve, the distance is read before the apply phase */
+            if (new_dist >= ds->vertex_dists[next_vertex]) {
+                continue;
+            }
 
-        for (; link != NULL; link = link->next) {
-            vertices_dists[iter][link->vertex] = link->edge_len;
-        }
-    }
+            graph_delta_requests_t *requests = &ds->requests[task * ds->number_of_tasks + next_vertex / ds->range_size];
 
-    /* Calculate the minimum distances between any two nodes */
-    for (size_t iter_k = 0; iter_k < gr->size; ++iter_k) {
-        for (size_t iter_i = 0; iter_i < gr->size; ++iter_i) {
-            for (size_t iter_j = 0; iter_j < gr->size; ++iter_j) {
-                if (vertices_dists[iter_i][iter_k] + vertices_dists[iter_k][iter_j] < vertices_dists[iter_i][iter_j]) {
-                    vertices_dists[iter_i][iter_j] = vertices_dists[iter_i][iter_k] + vertices_dists[iter_k][iter_j];
-                }
+            if (0 == graph_delta_push_request(csr->allocator, requests, next_vertex, vertex, new_dist)) {
+                ds->failed[task] = 1;
+                return;
             }
         }
     }
-
-    /* All good */
-    return SCL_OK;
 }
 
 /**
- * @brief Check if the oriented graph object is strongly connected.
+ * @brief Task applying the relaxations sent to one range of vertices, the improved
+ * vertices are moved in the bucket of their new distance.
  * 
- * @param gr a pointer to an allocated graph object
- * @return uint8_t 1 if graph is strongly connected or 0 otherwise
+ * @param arg pointer to the delta-stepping state
+ * @param task index of the task (range of vertices)
  */
-uint8_t graph_is_strongly_connected(const graph_t * const __restrict__ gr) {
-    /* Check if graph object is valid */
-    if ((NULL == gr) || (NULL == gr->visit) || (NULL == gr->vertices)) {
-        return 0;
-    }
+static void graph_delta_apply_task(void * const arg, size_t task) {
+    graph_delta_stepping_t *ds = arg;
 
-    /* Check the size of the dfs traversal */
-    size_t dfs_size = graph_dfs_traverse(gr, 0, NULL);
+    for (size_t sender = 0; sender < ds->number_of_tasks; ++sender) {
+        graph_delta_requests_t *requests = &ds->requests[sender * ds->number_of_tasks + task];
 
-    /* If all vertices were not traversed that graph is not sc */
-    if (dfs_size != gr->size) {
-        return 0;
-    }
+        for (size_t iter = 0; iter < requests->size; ++iter) {
+            const graph_delta_request_t *request = &requests->data[iter];
 
-    /* Compute the transposed graph */
-    graph_t *transpose_gr = create_transpose_graph(gr);
+            if (request->dist >= ds->vertex_dists[request->vertex]) {
+                continue;
+            }
 
-    /* Check if transposed graph is valid */
-    if ((NULL == transpose_gr) || (NULL == transpose_gr->visit) || (NULL == transpose_gr->vertices)) {
-        return 0;
+            ds->vertex_dists[request->vertex] = request->dist;
+
+            if (NULL != ds->vertex_parents) {
+                ds->vertex_parents[request->vertex] = request->parent;
+            }
+
+            const size_t bucket = (size_t)(request->dist / ds->delta);
+
+            if (bucket != ds->bucket_of[request->vertex]) {
+                ds->bucket_of[request->vertex] = bucket;
+
+                if (0 == graph_delta_push_vertex(ds->csr->allocator, &ds->buckets[task * ds->number_of_buckets + bucket % ds->number_of_buckets], request->vertex)) {
+                    ds->failed[task] = 1;
+                    return;
+                }
+            }
+        }
+
+        requests->size = 0;
     }
+}
 
-    /* Check the size of the dfs traversal of the travsposed graph */
-    dfs_size = graph_dfs_traverse(transpose_gr, 0, NULL);
+/**
+ * @brief Runs the tasks of one phase of the delta-stepping on the thread pool or on
+ * the calling thread and checks if every task had enough memory.
+ * 
+ * @param ds pointer to the delta-stepping state
+ * @param pool pointer to a thread pool or `NULL`
+ * @param task function running one task
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t graph_delta_phase(graph_delta_stepping_t * const __restrict__ ds, thread_pool_t * const __restrict__ pool, thread_pool_task_func task) {
+    if (NULL != pool) {
+        scl_error_t err = thread_pool_run(pool, task, ds, ds->number_of_tasks);
 
-    free_graph(transpose_gr);
+        if (SCL_OK != err) {
+            return err;
+        }
+    } else {
+        for (size_t iter = 0; iter < ds->number_of_tasks; ++iter) {
+            task(ds, iter);
+        }
+    }
 
-    /* If all vertices were not traversed in the transposed graph than it is not sc*/
-    if (dfs_size != gr->size) {
-        return 0;
+    for (size_t iter = 0; iter < ds->number_of_tasks; ++iter) {
+        if (1 == ds->failed[iter]) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
     }
 
-    /* The graph object is strongly connected */
-    return 1;
+    /* All good */
+    return SCL_OK;
 }
 
 /**
- * @brief Function to calculate all the strongly connected components from the graph.
- * Function will return a matrix of vertices that will calculate every strongly connected
- * components. The number_of_scc will show the number of strongly connected components.
- * In the matrix the first cell from every row will be the number of the vertices from a
- * strongly connected component.
+ * @brief Function to compute the minimum distances starting from selected vertex
+ * to all other vertices of a graph CSR snapshot by delta-stepping on all threads of
+ * a thread pool. The tentative distances are grouped in buckets of delta width and
+ * the buckets are settled in increasing order: the edges not longer than delta are
+ * relaxed again and again from the vertices entering the current bucket, and the
+ * longer edges just once, when the bucket is empty. All vertices of the bucket are
+ * relaxed in parallel. A small delta settles few vertices at once (as dijkstra), a
+ * big one relaxes edges many times (as Bellman-Ford). If the selected vertex has no
+ * path to another vertex the distance will be GRAPH_WEIGHT_MAX, the distances are
+ * the same as the ones of **graph_csr_dijkstra** and the parents form a tree of
+ * shortest paths (on equal paths the parent may differ). Negative edges are not supported.
  * 
- * @param gr a pointer to an allocated graph object
- * @param number_of_scc pointer to location of the number of strongly connected components
- * @return size_t** matrix containing on every row the vertices from a strongly connected
- * component or NULL if function fails
+ * @param csr a pointer to an allocated graph CSR snapshot
+ * @param pool a pointer to an allocated thread pool or `NULL` to run on the calling thread
+ * @param start_vertex vertex to compute the distances beginning from it
+ * @param delta width of the buckets, 0 (or less) to use the longest edge divided by the average out degree
+ * @param vertex_dists an allocated array with all distances beginning from start_vertex
+ * @param vertex_parents an array with vertices showing the minimum path from
+ * start_vertex to any other vertex or `NULL`
+ * @return scl_error_t enum object for handling errors
  */
-size_t** graph_strongly_connected_components(const graph_t * const __restrict__ gr, size_t *number_of_scc) {
-    /* Check if graph object is valid */
-    if ((NULL == gr) || (NULL == gr->vertices) || (NULL == gr->visit) || (NULL == number_of_scc)) {
-        return NULL;
+scl_error_t graph_csr_delta_stepping(const graph_csr_t * const __restrict__ csr, thread_pool_t * const __restrict__ pool, size_t start_vertex, graph_weight_t delta, graph_weight_t * __restrict__ vertex_dists, size_t * __restrict__ vertex_parents) {
+    /* Check if graph CSR snapshot is valid */
+    if (NULL == csr) {
+        return SCL_NULL_GRAPH_CSR;
     }
 
-    /* Create the subroutine stack for strongly connected components */
-    sstack_t *scc_stack = create_stack(NULL, sizeof(size_t));
-
-    if (NULL == scc_stack) {
-        return NULL;
+    /* Check if distances array is allocated */
+    if (NULL == vertex_dists) {
+        return SCL_NULL_VERTICES_DISTANCES;
     }
 
-    /* Reset the visit array of the graph */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        gr->visit[iter] = 0;
+    /* Check if start vertex is in the snapshot */
+    if (start_vertex >= csr->size) {
+        return SCL_VERTEX_OUT_OF_BOUND;
     }
 
-    /* Compute the topological sort stack of the graph */
-    for (size_t iter = 0; iter < gr->size; ++iter) {
-        if (0 == gr->visit[iter]) {
-            graph_topological_sort_helper(gr, iter, scc_stack);
+    /* Find the longest edge, negative edges cannot be settled by buckets */
+    graph_weight_t max_edge_len = 0;
+
+    for (size_t iter = 0; iter < csr->number_of_edges; ++iter) {
+        if (csr->weights[iter] < 0) {
+            return SCL_INVALID_EDGE_LENGTH;
+        }
+
+        if (csr->weights[iter] > max_edge_len) {
+            max_edge_len = csr->weights[iter];
         }
     }
 
-    /* Create the transposed graph of the graph object */
-    graph_t *transpose_gr = create_transpose_graph(gr);
+    if (delta <= 0) {
+        delta = max_edge_len / (graph_weight_t)((csr->number_of_edges + csr->size - 1) / csr->size + 1);
+    }
 
-    if ((NULL == transpose_gr) || (NULL == transpose_gr->visit)) {
-        free_stack(scc_stack);
+    if (max_edge_len / delta > (graph_weight_t)(GRAPH_DELTA_STEPPING_MAX_BUCKETS - 2)) {
+        delta = max_edge_len / (graph_weight_t)(GRAPH_DELTA_STEPPING_MAX_BUCKETS - 2);
+    }
 
-        return NULL;
+    /* Integer weights may round the delta down to zero */
+    if (delta <= 0) {
+        delta = 1;
     }
 
-    /* Reset the visit array of the transposed graph */
-    for (size_t iter = 0; iter < transpose_gr->size; ++iter) {
-        transpose_gr->visit[iter] = 0;
+    graph_delta_stepping_t ds;
+
+    ds.csr = csr;
+    ds.vertex_dists = vertex_dists;
+    ds.vertex_parents = vertex_parents;
+    ds.delta = delta;
+    ds.number_of_tasks = (NULL == pool) ? 1 : get_thread_pool_threads(pool);
+    ds.range_size = (csr->size + ds.number_of_tasks - 1) / ds.number_of_tasks;
+
+    /* A tentative distance is less than the current bucket plus the longest edge */
+    ds.number_of_buckets = (size_t)(max_edge_len / delta) + 2;
+    ds.bucket = 0;
+    ds.heavy = 0;
+
+    ds.bucket_of = scl_malloc(csr->allocator, sizeof(*ds.bucket_of) * csr->size);
+    ds.settled_in = scl_malloc(csr->allocator, sizeof(*ds.settled_in) * csr->size);
+    ds.buckets = scl_calloc(csr->allocator, ds.number_of_tasks * ds.number_of_buckets, sizeof(*ds.buckets));
+    ds.frontiers = scl_calloc(csr->allocator, ds.number_of_tasks, sizeof(*ds.frontiers));
+    ds.settled = scl_calloc(csr->allocator, ds.number_of_tasks, sizeof(*ds.settled));
+    ds.requests = scl_calloc(csr->allocator, ds.number_of_tasks * ds.number_of_tasks, sizeof(*ds.requests));
+    ds.failed = scl_calloc(csr->allocator, ds.number_of_tasks, sizeof(*ds.failed));
+
+    scl_error_t err = SCL_OK;
+
+    if ((NULL == ds.bucket_of) || (NULL == ds.settled_in) || (NULL == ds.buckets) || (NULL == ds.frontiers) ||
+        (NULL == ds.settled) || (NULL == ds.requests) || (NULL == ds.failed)) {
+        err = SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        goto free_delta_stepping;
     }
 
-    *number_of_scc = 0;
-    size_t **scc_paths = NULL;
+    /* Set default values */
+    for (size_t iter = 0; iter < csr->size; ++iter) {
+        vertex_dists[iter] = GRAPH_WEIGHT_MAX;
+        ds.bucket_of[iter] = SIZE_MAX;
+        ds.settled_in[iter] = SIZE_MAX;
 
-    /* Compute the strongly connected components */
-    while (!is_stack_empty(scc_stack)) {
+        if (NULL != vertex_parents) {
+            vertex_parents[iter] = SIZE_MAX;
+        }
+    }
 
-        /* Get the top vertex from stack subroutine */
-        size_t top_vertex = *(size_t *)stack_top(scc_stack);
+    vertex_dists[start_vertex] = 0;
+    ds.bucket_of[start_vertex] = 0;
 
-        stack_pop(scc_stack);
+    if (0 == graph_delta_push_vertex(csr->allocator, &ds.buckets[(start_vertex / ds.range_size) * ds.number_of_buckets], start_vertex)) {
+        err = SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        goto free_delta_stepping;
+    }
 
-        /* Check if current selected vertex is not of another strongly connected component */
-        if (0 == transpose_gr->visit[top_vertex]) {
-            if (0 == *number_of_scc) {
+    for (;;) {
+        /* Relax the light edges until no vertex enters the current bucket */
+        for (;;) {
+            err = graph_delta_phase(&ds, pool, &graph_delta_collect_task);
 
-                /* Allocate first slot for strongly connected component */
-                scc_paths = malloc(sizeof(*scc_paths));
+            if (SCL_OK != err) {
+                goto free_delta_stepping;
+            }
 
-                if (NULL == scc_paths) {
-                    free_stack(scc_stack);
-                    free_graph(transpose_gr);
+            size_t frontier_size = 0;
 
-                    return NULL;
-                }
-            } else {
+            for (size_t iter = 0; iter < ds.number_of_tasks; ++iter) {
+                frontier_size += ds.frontiers[iter].size;
+            }
 
-                /* Add one more slot for strongly connected component */
-                size_t **try_realloc = realloc(scc_paths, sizeof(*try_realloc) * (*number_of_scc + 1));
+            if (0 == frontier_size) {
+                break;
+            }
 
-                if (NULL == try_realloc) {
-                    free_stack(scc_stack);
-                    free_graph(transpose_gr);
+            ds.heavy = 0;
 
-                    return scc_paths;
-                }
+            err = graph_delta_phase(&ds, pool, &graph_delta_relax_task);
 
-                scc_paths = try_realloc;
+            if (SCL_OK == err) {
+                err = graph_delta_phase(&ds, pool, &graph_delta_apply_task);
             }
 
-            /* Allocate the array for strongly connected component */
-            scc_paths[*number_of_scc] = malloc(sizeof(*scc_paths[*number_of_scc]) * (gr->size + 1));
+            if (SCL_OK != err) {
+                goto free_delta_stepping;
+            }
+        }
+
+        /* Relax the heavy edges of the bucket once, they end in later buckets */
+        ds.heavy = 1;
 
-            if (NULL != scc_paths[*number_of_scc]) {
+        err = graph_delta_phase(&ds, pool, &graph_delta_relax_task);
 
-                /* Traverse the graph starting from top_vertex node to find the strongly connected components */
-                scc_paths[*number_of_scc][0] = 0;
+        if (SCL_OK == err) {
+            err = graph_delta_phase(&ds, pool, &graph_delta_apply_task);
+        }
 
-                graph_dfs_traverse_helper(transpose_gr, top_vertex, scc_paths[*number_of_scc] + 1, &scc_paths[*number_of_scc][0]);
+        if (SCL_OK != err) {
+            goto free_delta_stepping;
+        }
 
-                /* Increase the number of scc */
-                ++(*number_of_scc);
-            } else {
+        for (size_t iter = 0; iter < ds.number_of_tasks; ++iter) {
+            ds.settled[iter].size = 0;
+        }
 
-                /* Could not allocate the memory for strongly connected component */
-                free_stack(scc_stack);
-                free_graph(transpose_gr);
+        /* Find the next bucket holding some vertices */
+        size_t next_bucket = 0;
 
-                return scc_paths;
+        for (size_t step = 1; (0 == next_bucket) && (step < ds.number_of_buckets); ++step) {
+            for (size_t iter = 0; iter < ds.number_of_tasks; ++iter) {
+                if (0 != ds.buckets[iter * ds.number_of_buckets + (ds.bucket + step) % ds.number_of_buckets].size) {
+                    next_bucket = ds.bucket + step;
+                    break;
+                }
             }
         }
+
+        if (0 == next_bucket) {
+            break;
+        }
+
+        ds.bucket = next_bucket;
     }
 
-    /* No strongly connected component */
-    if ((0 == *number_of_scc) && (NULL != scc_paths)) {
-        free(scc_paths);
-        scc_paths = NULL;
+free_delta_stepping:
+    if (NULL != ds.buckets) {
+        for (size_t iter = 0; iter < ds.number_of_tasks * ds.number_of_buckets; ++iter) {
+            scl_free(csr->allocator, ds.buckets[iter].data);
+        }
     }
 
-    free_graph(transpose_gr);
-    free_stack(scc_stack);
+    if (NULL != ds.requests) {
+        for (size_t iter = 0; iter < ds.number_of_tasks * ds.number_of_tasks; ++iter) {
+            scl_free(csr->allocator, ds.requests[iter].data);
+        }
+    }
 
-    /* Return the matrix of the strongly connected components */
-    return scc_paths;
+    for (size_t iter = 0; iter < ds.number_of_tasks; ++iter) {
+        if (NULL != ds.frontiers) {
+            scl_free(csr->allocator, ds.frontiers[iter].data);
+        }
+
+        if (NULL != ds.settled) {
+            scl_free(csr->allocator, ds.settled[iter].data);
+        }
+    }
+
+    scl_free(csr->allocator, ds.bucket_of);
+    scl_free(csr->allocator, ds.settled_in);
+    scl_free(csr->allocator, ds.buckets);
+    scl_free(csr->allocator, ds.frontiers);
+    scl_free(csr->allocator, ds.settled);
+    scl_free(csr->allocator, ds.requests);
+    scl_free(csr->allocator, ds.failed);
+
+    return err;
 }
@@ -24,16 +24,53 @@
 
 #include "./include/scl_hash_table.h"
 #include "./include/scl_queue.h"
+#include "./include/scl_func_types.h"
 
-#define DEFAULT_HASH_CAPACITY 50
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define DEFAULT_HASH_CAPACITY 64
 #define DEFAULT_HASH_LOAD_FACTOR 0.75
 #define DEFAULT_HASH_CAPACITY_RATIO 2
 
+/**
+ * @brief Function to compute the smallest power of two that is
+ * greater or equal than the input value.
+ * 
+ * @param value value to round up
+ * @return size_t power of two greater or equal than value
+ */
+static size_t hash_table_next_pow2(size_t value) {
+    size_t power = 1;
+
+    /* Double the power until it reaches the value */
+    while (power < value) {
+        power <<= 1;
+    }
+
+    return power;
+}
+
+/**
+ * @brief Function to select the bucket of a hash value. The capacity
+ * is always a power of two, so the bucket is selected by masking the
+ * lower bits of the mixed hash value instead of a modulo division.
+ * 
+ * @param key_hash hash value of a key computed by the user hash function
+ * @param capacity number of buckets (power of two)
+ * @return size_t index of the bucket
+ */
+static size_t hash_table_bucket_index(size_t key_hash, size_t capacity) {
+    return hash_mix(key_hash) & (capacity - 1);
+}
+
 /**
  * @brief Create a hash table object. Allocation may fail if there is not enough
  * memory on heap, compare or hash functions are not valid.
  * 
- * @param init_capacity initial capacity for the hash table (should be >= |All data| * 0.75)
+ * @param init_capacity initial capacity for the hash table (should be >= |All data| * 0.75), rounded up to a power of two
  * @param hash pointer to a function to hash the key into a size_t type (should not apply modulo)
  * @param cmp_key pointer to a function to compare two sets of key
  * @param cmp_dt pointer to a function to compare two sets of data
@@ -63,11 +100,18 @@ hash_table_t* create_hash_table(size_t init_capacity, hash_func hash, compare_fu
         init_capacity = DEFAULT_HASH_CAPACITY;
     }
 
+    /* Buckets are selected by masking, capacity must be a power of two */
+    init_capacity = hash_table_next_pow2(init_capacity);
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new hash table object on heap */
-    hash_table_t *new_hash_table = malloc(sizeof(*new_hash_table));
+    hash_table_t *new_hash_table = scl_malloc(allocator, sizeof(*new_hash_table));
 
     /* Check if hash table was allocated successfully */
     if (NULL != new_hash_table) {
+        new_hash_table->allocator = allocator;
 
         /* Set function pointers of the hash table */
         new_hash_table->hash = hash;
@@ -80,10 +124,31 @@ hash_table_t* create_hash_table(size_t init_capacity, hash_func hash, compare_fu
         new_hash_table->key_size = key_size;
         new_hash_table->data_size = data_size;
         new_hash_table->capacity = init_capacity;
+
+        /* Known compare functions of the library are done inline */
+        new_hash_table->key_kind = scl_key_kind_of(cmp_key, key_size);
         new_hash_table->size = 0;
 
+        /* No rehash is in progress and rehashing is done at once */
+        new_hash_table->old_buckets = NULL;
+        new_hash_table->old_capacity = 0;
+        new_hash_table->rehash_index = 0;
+        new_hash_table->rehash_step = 0;
+
+        /* Nodes are allocated one by one */
+        new_hash_table->node_pool = NULL;
+
+        /* Every search walks its bucket */
+        new_hash_table->filter = NULL;
+
+        /* The skew of the buckets is not watched */
+        new_hash_table->skew_warn = NULL;
+        new_hash_table->skew_arg = NULL;
+        new_hash_table->skew_threshold = 0;
+        (void)SCL_STATS_RESET(new_hash_table);
+
         /* Create the black hole node */
-        new_hash_table->nil = malloc(sizeof(*new_hash_table->nil));
+        new_hash_table->nil = scl_malloc(allocator, sizeof(*new_hash_table->nil));
 
         /* Check if black hole node was created */
         if (NULL != new_hash_table->nil) {
@@ -93,11 +158,12 @@ hash_table_t* create_hash_table(size_t init_capacity, hash_func hash, compare_fu
             new_hash_table->nil->data = NULL;
             new_hash_table->nil->color = HASH_BLACK;
             new_hash_table->nil->count = 1;
+            new_hash_table->nil->hash = 0;
             new_hash_table->nil->left = new_hash_table->nil->right = new_hash_table->nil;
             new_hash_table->nil->parent = new_hash_table->nil;
 
             /* Allocate all buckets from hash table */
-            new_hash_table->buckets = malloc(sizeof(*new_hash_table->buckets) * init_capacity);
+            new_hash_table->buckets = scl_malloc(allocator, sizeof(*new_hash_table->buckets) * init_capacity);
 
             /* Check if buckets were allocated successfully */
             if (NULL != new_hash_table->buckets) {
@@ -109,8 +175,8 @@ hash_table_t* create_hash_table(size_t init_capacity, hash_func hash, compare_fu
             } else {
 
                 /* Trees were not allocated wipe hash table's memory */
-                free(new_hash_table->nil);
-                free(new_hash_table);
+                scl_free(allocator, new_hash_table->nil);
+                scl_free(allocator, new_hash_table);
                 new_hash_table = NULL;
 
                 errno = ENOMEM;
@@ -119,7 +185,7 @@ hash_table_t* create_hash_table(size_t init_capacity, hash_func hash, compare_fu
         } else {
 
             /* Black hole node was not allocated wipe hash table's mempry */
-            free(new_hash_table);
+            scl_free(allocator, new_hash_table);
             new_hash_table = NULL;
 
             errno = ENOMEM;
@@ -152,11 +218,6 @@ static void free_hash_table_node(const hash_table_t * const __restrict__ ht, has
             ht->frd_dt((*free_node)->data);
         }
 
-        /* Free data pointer of the node */
-        if (NULL != (*free_node)->data) {
-            free((*free_node)->data);
-        }
-
         /* Point to default value */
         (*free_node)->data = NULL;
 
@@ -165,17 +226,16 @@ static void free_hash_table_node(const hash_table_t * const __restrict__ ht, has
             ht->frd_key((*free_node)->key);
         }
 
-        /* Free key pointer of the node */
-        if (NULL != (*free_node)->key) {
-            free((*free_node)->key);
-        }
-
         /* Point to default value */
         (*free_node)->key = NULL;
 
-        /* Free hash table node from heap */
+        /* Free hash table node from heap or give it back to the node pool */
         if (ht->nil != *free_node) {
-            free(*free_node);
+            if (NULL != ht->node_pool) {
+                mem_pool_free(ht->node_pool, *free_node);
+            } else {
+                scl_free(ht->allocator, *free_node);
+            }
         }
 
         /* Point to default value */
@@ -185,25 +245,42 @@ static void free_hash_table_node(const hash_table_t * const __restrict__ ht, has
 
 /**
  * @brief Helper function to delete all nodes from a
- * hash table bucket.
+ * hash table bucket. The nodes are freed without recursion, the
+ * left child of the current node is rotated up until the node has
+ * no left child, then the node is freed and its right child becomes
+ * the current node.
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param bucket address of a pointer to a memory location of a hash table node to delete
  */
 static void free_hash_table_helper(const hash_table_t * const __restrict__ ht, hash_table_node_t ** const __restrict__ bucket) {
-    /* Check if node can be freed */
-    if ((NULL == bucket) || (ht->nil == *bucket)) {
+    /* Check if bucket is valid */
+    if (NULL == bucket) {
         return;
     }
 
-    /* Free left node child */
-    free_hash_table_helper(ht, &(*bucket)->left);
+    hash_table_node_t *iterator = *bucket;
+
+    while (ht->nil != iterator) {
+        if (ht->nil != iterator->left) {
+
+            /* Rotate the left child up, the bucket becomes a right chain */
+            hash_table_node_t *left_node = iterator->left;
+
+            iterator->left = left_node->right;
+            left_node->right = iterator;
+            iterator = left_node;
+        } else {
+            hash_table_node_t *right_node = iterator->right;
+
+            /* Free current working node */
+            free_hash_table_node(ht, &iterator);
 
-    /* Free right node child */
-    free_hash_table_helper(ht, &(*bucket)->right);
+            iterator = right_node;
+        }
+    }
 
-    /* Free current working node */
-    free_hash_table_node(ht, bucket);
+    *bucket = ht->nil;
 }
 
 /**
@@ -220,22 +297,47 @@ scl_error_t free_hash_table(hash_table_t * const __restrict__ ht) {
         /* Check if hash table roots are allocated */
         if (NULL != ht->buckets) {
 
+            /* Pooled nodes without key or data content are released with their chunks */
+            uint8_t visit_nodes = ((NULL == ht->node_pool) || (NULL != ht->frd_key) || (NULL != ht->frd_dt));
+
             /* Free every tree from the hash table */
-            for (size_t iter = 0; iter < ht->capacity; ++iter) {
+            for (size_t iter = 0; (iter < ht->capacity) && (0 != visit_nodes); ++iter) {
                 free_hash_table_helper(ht, &ht->buckets[iter]);
             }
 
+            /* Free the buckets that were not moved by an incremental rehash */
+            if (NULL != ht->old_buckets) {
+                for (size_t iter = 0; (iter < ht->old_capacity) && (0 != visit_nodes); ++iter) {
+                    free_hash_table_helper(ht, &ht->old_buckets[iter]);
+                }
+
+                scl_free(ht->allocator, ht->old_buckets);
+                ht->old_buckets = NULL;
+            }
+
+            /* Free all chunks of the node pool at once */
+            if (NULL != ht->node_pool) {
+                free_mem_pool(ht->node_pool);
+                ht->node_pool = NULL;
+            }
+
             /* Free memory for the black hole node */
-            free(ht->nil);
+            scl_free(ht->allocator, ht->nil);
             ht->nil = NULL;
 
             /* Free memory for roots array */
-            free(ht->buckets);
+            scl_free(ht->allocator, ht->buckets);
             ht->buckets = NULL;
         }
 
+        /* Free the filter of the keys */
+        if (NULL != ht->filter) {
+            free_bloom_filter(ht->filter);
+            ht->filter = NULL;
+        }
+
         /* Free memory of the hash table */
-        free(ht);
+        scl_free(ht->allocator, ht);
 
         /* All good, go sleep */
         return SCL_OK;
@@ -246,83 +348,341 @@ scl_error_t free_hash_table(hash_table_t * const __restrict__ ht) {
 }
 
 /**
- * @brief Create a hash table node object. Allocation may fail if address of data
- * or key pointers are `NULL` or if not enough memory is left on the heap zone.
+ * @brief Function to make the hash table allocate its nodes from a node pool.
+ * Every node, its key and its data are stored in one object of the pool, the
+ * objects are taken from contiguous chunks and are reused through a free list,
+ * and free_hash_table releases whole chunks (without visiting the nodes if no
+ * free functions were provided). The hash table must be empty.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of the hash
- * @param data pointer to a location of a value representing data of a node
- * @return hash_table_node_t* a new allocated hash table node object or `nil`
+ * @param nodes_per_chunk number of nodes from one chunk of the pool (0 for default)
+ * @return scl_error_t enum object for handling errors
  */
-static hash_table_node_t* create_hash_table_node(const hash_table_t * const __restrict__ ht, const void *key, const void *data) {
-    /* Check if data and key pointer are not `NULL` */
-    if ((NULL == data) || (NULL == key)) {
+scl_error_t hash_table_use_node_pool(hash_table_t * const __restrict__ ht, size_t nodes_per_chunk) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Nodes allocated on the heap cannot be moved into a pool */
+    if (0 != ht->size) {
+        return SCL_NOT_EMPTY_OBJECT_FOR_POOL;
+    }
+
+    /* Hash table already uses a node pool */
+    if (NULL != ht->node_pool) {
+        return SCL_OK;
+    }
+
+    /* The pool takes its chunks from the allocator of the object */
+    const scl_allocator_t *thread_allocator = scl_get_allocator();
+
+    scl_set_allocator(ht->allocator);
+
+    /* One object of the pool holds the node, its key and its data */
+    ht->node_pool = create_mem_pool(SCL_ALIGN_SIZE(sizeof(hash_table_node_t)) + SCL_ALIGN_SIZE(ht->key_size) + ht->data_size, nodes_per_chunk);
+    scl_set_allocator(thread_allocator);
+
+    /* Check if node pool was allocated successfully */
+    if (NULL == ht->node_pool) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to select the kind of the keys of a hash table, so that
+ * lookups compare the keys inline instead of calling the compare function.
+ * The kind MUST order the keys as the key compare function does. Tables
+ * created with a compare function of the library already know their kind.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param kind kind of the keys or SCL_KEY_GENERIC to call the compare function
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_use_key_kind(hash_table_t * const __restrict__ ht, scl_key_kind_t kind) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Keys must be wide enough for the kind */
+    if (0 == scl_key_kind_fits(kind, ht->key_size)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    ht->key_kind = kind;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the first node of a bucket in order.
+ * Function MUST not be used outside this file.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket root of the bucket
+ * @return const hash_table_node_t* leftmost node of the bucket or `nil` if bucket is empty
+ */
+static const hash_table_node_t* hash_table_bucket_first(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket) {
+    const hash_table_node_t *iterator = bucket;
+
+    if (ht->nil == iterator) {
         return ht->nil;
     }
 
-    /* Allocate a new hash table node */
-    hash_table_node_t *new_node = malloc(sizeof(*new_node));
+    while (ht->nil != iterator->left) {
+        iterator = iterator->left;
+    }
 
-    /* Check if node was allocated successfully */
-    if (NULL != new_node) {
+    return iterator;
+}
 
-        /* Set default values of one node */
-        new_node->left = new_node->right = ht->nil;
-        new_node->parent = ht->nil;
-        new_node->count = 1;
-        new_node->color = HASH_RED;
+/**
+ * @brief Function to get the next node of a bucket in order, through the
+ * parent links, without recursion. Function MUST not be used outside this file.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket root of the bucket
+ * @param iterator current node of the bucket (not `nil`)
+ * @return const hash_table_node_t* next node of the bucket or `nil` after the last one
+ */
+static const hash_table_node_t* hash_table_bucket_next(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, const hash_table_node_t *iterator) {
+    if (ht->nil != iterator->right) {
 
-        /* Allocate memory for data value */
-        new_node->data = malloc(ht->data_size);
+        /* The next node is the leftmost node of the right sub-tree */
+        return hash_table_bucket_first(ht, iterator->right);
+    }
 
-        /* Check if data memory was allocated */
-        if (NULL != new_node->data) {
+    /* The next node is the first ancestor reached from its left sub-tree */
+    while ((bucket != iterator) && (iterator->parent->right == iterator)) {
+        iterator = iterator->parent;
+    }
 
-            /* 
-             * Copy all bytes from data pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->data, data, ht->data_size);
-        } else {
+    return (bucket == iterator) ? ht->nil : iterator->parent;
+}
 
-            /* Data memory was not allocated wipe node's memory */
-            free(new_node);
-            new_node = ht->nil;
+/**
+ * @brief Function to add the hashes of every key of a hash table to a
+ * bloom filter, from the buckets and from the old buckets of an incremental
+ * rehash. Function MUST not be used outside this file.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param filter pointer to an allocated bloom filter
+ */
+static void hash_table_fill_bloom_filter(const hash_table_t * const __restrict__ ht, bloom_filter_t * const __restrict__ filter) {
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        const hash_table_node_t * const bucket = ht->buckets[iter];
 
-            errno = ENOMEM;
-            perror("Not enough memory for node hash table data allocation");
+        for (const hash_table_node_t *node = hash_table_bucket_first(ht, bucket); ht->nil != node; node = hash_table_bucket_next(ht, bucket, node)) {
+            bloom_filter_add_hash(filter, node->hash);
         }
+    }
 
-        /* Allocate memory for key value */
-        new_node->key = malloc(ht->key_size);
+    if (NULL != ht->old_buckets) {
+        for (size_t iter = 0; iter < ht->old_capacity; ++iter) {
+            const hash_table_node_t * const bucket = ht->old_buckets[iter];
 
-        /* Check if key memory was allocated */
-        if (NULL != new_node->key) {
+            for (const hash_table_node_t *node = hash_table_bucket_first(ht, bucket); ht->nil != node; node = hash_table_bucket_next(ht, bucket, node)) {
+                bloom_filter_add_hash(filter, node->hash);
+            }
+        }
+    }
+}
 
-            /* 
-             * Copy all bytes from key pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->key, key, ht->key_size);
-        } else {
+/**
+ * @brief Function to create a new bloom filter of a hash table sized for
+ * twice its keys, filled with all its keys. Function MUST not be used outside this file.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bits_per_key number of bits of the filter for every key
+ * @return bloom_filter_t* new filter or `NULL` if allocation failed
+ */
+static bloom_filter_t* hash_table_build_bloom_filter(const hash_table_t * const __restrict__ ht, size_t bits_per_key) {
+    /* The filter takes its blocks from the allocator of the object */
+    const scl_allocator_t *thread_allocator = scl_get_allocator();
+
+    scl_set_allocator(ht->allocator);
+
+    bloom_filter_t * const filter = create_bloom_filter(2 * ht->size, bits_per_key);
+    scl_set_allocator(thread_allocator);
+
+    if (NULL != filter) {
+        hash_table_fill_bloom_filter(ht, filter);
+    }
+
+    return filter;
+}
+
+/**
+ * @brief Function to rebuild the bloom filter of a hash table if too many
+ * keys were removed or added since it was built (see bloom_filter_needs_rebuild).
+ * If the new filter cannot be allocated the old one is kept, it still holds
+ * every key. Function MUST not be used outside this file.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ */
+static void hash_table_refresh_bloom_filter(hash_table_t * const __restrict__ ht) {
+    if (0 == bloom_filter_needs_rebuild(ht->filter, ht->size)) {
+        return;
+    }
+
+    bloom_filter_t * const filter = hash_table_build_bloom_filter(ht, ht->filter->bits_per_key);
+
+    if (NULL != filter) {
+        free_bloom_filter(ht->filter);
+        ht->filter = filter;
+    }
+}
+
+/**
+ * @brief Function to put a blocked bloom filter of the key hashes in front
+ * of the searches of a hash table. Every inserted key is added to the filter
+ * and a search of a key rejected by the filter returns at once, after reading
+ * one cache line, without visiting its bucket. Removed keys stay in the filter
+ * until it is rebuilt, which is done by itself when more than half of its keys
+ * were removed or when it holds more keys than it was sized for.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bits_per_key number of bits of the filter for every key (10 give about
+ * 1% false positives), 0 to remove the filter
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_use_bloom_filter(hash_table_t * const __restrict__ ht, size_t bits_per_key) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    bloom_filter_t *filter = NULL;
 
-            /* Key memory was not allocated wipe node's memory */
-            free(new_node->data);
-            new_node->data = NULL;
+    if (0 != bits_per_key) {
+        filter = hash_table_build_bloom_filter(ht, bits_per_key);
 
-            free(new_node);
-            new_node = ht->nil;
+        /* Check if bloom filter was allocated successfully */
+        if (NULL == filter) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
         }
-    } else {
+    }
+
+    if (NULL != ht->filter) {
+        free_bloom_filter(ht->filter);
+    }
+
+    ht->filter = filter;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to rebuild the bloom filter of a hash table from its
+ * keys now, so the removed keys stop passing the filter.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_rebuild_bloom_filter(hash_table_t * const __restrict__ ht) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table uses a bloom filter */
+    if (NULL == ht->filter) {
+        return SCL_NULL_BLOOM_FILTER;
+    }
+
+    return hash_table_use_bloom_filter(ht, ht->filter->bits_per_key);
+}
+
+/**
+ * @brief Function to compare one hash table node with a {hash, key} pair.
+ * The nodes of one bucket are ordered by their cached hash values first,
+ * so the compare function of the keys is called just on equal hashes.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param node pointer to a hash table node (not `nil`)
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of the hash
+ * @return int32_t 1 if node is greater than the pair, -1 if node is less
+ * than the pair, 0 if node has the same key as the pair
+ */
+static int32_t hash_table_compare_node(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ node, size_t key_hash, const void * const __restrict__ key) {
+    /* Compare the cached hash values first */
+    if (node->hash > key_hash) {
+        return 1;
+    } else if (node->hash < key_hash) {
+        return -1;
+    }
+
+    /* Same hash value, compare the keys */
+    SCL_STATS_ADD(ht, comparisons, 1);
+
+    return scl_key_compare(ht->key_kind, ht->cmp_key, ht->key_size, node->key, key);
+}
+
+/**
+ * @brief Create a hash table node object. Allocation may fail if address of data
+ * or key pointers are `NULL` or if not enough memory is left on the heap zone.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return hash_table_node_t* a new allocated hash table node object or `nil`
+ */
+static hash_table_node_t* create_hash_table_node(const hash_table_t * const __restrict__ ht, size_t key_hash, const void *key, const void *data) {
+    /* Check if data and key pointer are not `NULL` */
+    if ((NULL == data) || (NULL == key)) {
+        return ht->nil;
+    }
 
-        /* Node memory was not allocated, set default value */
-        new_node = ht->nil;
+    /* Allocate a new hash table node from the node pool or on the heap */
+    hash_table_node_t *new_node = NULL;
 
+    if (NULL != ht->node_pool) {
+        new_node = mem_pool_alloc(ht->node_pool);
+    } else {
+        new_node = scl_malloc(ht->allocator, SCL_ALIGN_SIZE(sizeof(*new_node)) + SCL_ALIGN_SIZE(ht->key_size) + ht->data_size);
+    }
+
+    /* Check if node was allocated successfully */
+    if (NULL == new_node) {
         errno = ENOMEM;
         perror("Not enough memory for node hash table allocation");
+        return ht->nil;
     }
 
-    /* Return an allocated hash table node object or `nil` */
+    SCL_STATS_ADD(ht, allocations, 1);
+
+    /* Set default values of one node */
+    new_node->left = new_node->right = ht->nil;
+    new_node->parent = ht->nil;
+    new_node->count = 1;
+    new_node->color = HASH_RED;
+    new_node->hash = key_hash;
+
+    /* The key and the data are stored inline, right after the node, in the same block */
+    new_node->key = (uint8_t *)new_node + SCL_ALIGN_SIZE(sizeof(*new_node));
+    new_node->data = (uint8_t *)new_node->key + SCL_ALIGN_SIZE(ht->key_size);
+
+    /* 
+     * Copy all bytes from key and data pointers
+     * to memory allocated for the node
+     */
+    memcpy(new_node->key, key, ht->key_size);
+    memcpy(new_node->data, data, ht->data_size);
+
+    /* Return an allocated hash table node object */
     return new_node;
 }
 
@@ -366,6 +726,8 @@ static void hash_table_rotate_left(const hash_table_t * const __restrict__ ht, s
         return;
     }
 
+    SCL_STATS_ADD(ht, rotations, 1);
+
     /* Set new rotated sub-root */
     hash_table_node_t * const rotate_node = fix_node->right;
 
@@ -388,7 +750,7 @@ static void hash_table_rotate_left(const hash_table_t * const __restrict__ ht, s
 
     /* Update new sub-root links to the rest of the tree */
     if (ht->nil != rotate_node->parent) {
-        if (ht->cmp_key(rotate_node->key, rotate_node->parent->key) >= 1) {
+        if (hash_table_compare_node(ht, rotate_node, rotate_node->parent->hash, rotate_node->parent->key) >= 1) {
             rotate_node->parent->right = rotate_node;
         } else {
             rotate_node->parent->left = rotate_node;
@@ -419,6 +781,8 @@ static void hash_table_rotate_right(const hash_table_t * const __restrict__ ht,
         return;
     }
 
+    SCL_STATS_ADD(ht, rotations, 1);
+
     /* Set new rotated sub-root */
     hash_table_node_t * const rotate_node = fix_node->left;
 
@@ -441,7 +805,7 @@ static void hash_table_rotate_right(const hash_table_t * const __restrict__ ht,
 
     /* Update new sub-root links to the rest of tree */
     if (ht->nil != rotate_node->parent) {
-        if (ht->cmp_key(rotate_node->key, rotate_node->parent->key) >= 1) {
+        if (hash_table_compare_node(ht, rotate_node, rotate_node->parent->hash, rotate_node->parent->key) >= 1) {
             rotate_node->parent->right = rotate_node;
         } else {
             rotate_node->parent->left = rotate_node;
@@ -578,148 +942,279 @@ static scl_error_t hash_table_insert_fix_node_up(const hash_table_t * const __re
 }
 
 /**
- * @brief Function to rehash a hash table and to double the capacity
- * of the table (double number of bucket). Function may fail
- * if hash table is not allocated or has `NULL` buckets or not enough
- * memory is left on heap to allocate new red black trees.
- * 
- * @param ht pointer to an allocated hash table memory location
- * @return scl_error_t enum object for handling errors
- */
-static scl_error_t hash_table_rehash(hash_table_t * const __restrict__ ht);
-
-/**
- * @brief 
+ * @brief Function to link an already allocated hash table node into
+ * the current buckets array. The node is not copied, just its links
+ * are updated, so no memory is allocated. The key of the node MUST NOT
+ * exist in the current buckets array.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of the hash
- * @param data pointer to a location of a value representing data of a node
+ * @param link_node pointer to a hash table node with no links
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_insert(hash_table_t * const __restrict__ ht, const void *key, const void *data) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
-    }
-
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
-    }
-
-    /* Check if key pointer is not `NULL` */
-    if (NULL == key) {
-        return SCL_INVALID_KEY;
-    }
-
-    /* Check if data pointer is not `NULL` */
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
-    }
-
-    /* Compute index of the current working tree */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+static scl_error_t hash_table_link_node(const hash_table_t * const __restrict__ ht, hash_table_node_t * const __restrict__ link_node) {
+    /* Compute index of the destination bucket */
+    size_t bucket_index = hash_table_bucket_index(link_node->hash, ht->capacity);
 
     /* Set iterator pointers */
     hash_table_node_t *iterator = ht->buckets[bucket_index];
     hash_table_node_t *parent_iterator = ht->nil;
 
-    /* Find a valid position for insertion */
+    /* Find a valid position for the node */
     while (ht->nil != iterator) {
         parent_iterator = iterator;
 
-        if (ht->cmp_key(iterator->key, key) >= 1) {
+        if (hash_table_compare_node(ht, iterator, link_node->hash, link_node->key) >= 1) {
             iterator = iterator->left;
-        } else if (ht->cmp_key(iterator->key, key) <= -1) {
-            iterator = iterator->right;
         } else {
+            iterator = iterator->right;
+        }
+    }
 
-            /*
-             * Node already exists in current red-black tree
-             * increment count value of node
-             */
-            ++(iterator->count);
-            return 0;
+    /* Reset the node as a new red leaf */
+    link_node->left = link_node->right = ht->nil;
+    link_node->parent = parent_iterator;
+    link_node->color = HASH_RED;
+
+    if (ht->nil != parent_iterator) {
+
+        /* Update children links */
+        if (hash_table_compare_node(ht, parent_iterator, link_node->hash, link_node->key) >= 1) {
+            parent_iterator->left = link_node;
+        } else {
+            parent_iterator->right = link_node;
         }
+
+        /* Fix the bucket */
+        return hash_table_insert_fix_node_up(ht, bucket_index, link_node);
     }
 
-    /* Create a new bucket node object */
-    hash_table_node_t *new_node = create_hash_table_node(ht, key, data);
+    /* Linked node is root node */
+    ht->buckets[bucket_index] = link_node;
+    link_node->color = HASH_BLACK;
 
-    /* Check if new bucket(hash table) node was created */
-    if (ht->nil == new_node) {
-        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
-    }
-    
-    scl_error_t err = SCL_OK;
+    /* All good */
+    return SCL_OK;
+}
 
-    if (ht->nil != parent_iterator) {
+/**
+ * @brief Subroutine function of hash_table rehash, to traverse all
+ * nodes from an old bucket as in a red black tree and to move all nodes
+ * into the new buckets. The left child of the current node is rotated
+ * up until the node has no left child, then the node is relinked, so
+ * the old tree links are read before being overwritten and no recursion
+ * is needed.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to current hash table(red black tree) node to move
+ */
+static void hash_table_rehash_helper(const hash_table_t * const __restrict__ ht, hash_table_node_t * const __restrict__ bucket) {
+    hash_table_node_t *iterator = bucket;
 
-        /* Update parent links */
-        new_node->parent = parent_iterator;
+    while (ht->nil != iterator) {
+        if (ht->nil != iterator->left) {
 
-        /* Update children links */
-        if (ht->cmp_key(parent_iterator->key, new_node->key) >= 1) {
-            parent_iterator->left = new_node;
+            /* Rotate the left child up, the old bucket becomes a right chain */
+            hash_table_node_t *left_node = iterator->left;
+
+            iterator->left = left_node->right;
+            left_node->right = iterator;
+            iterator = left_node;
         } else {
-            parent_iterator->right = new_node;
+            hash_table_node_t *right_node = iterator->right;
+
+            /* Relink current node into the new buckets */
+            hash_table_link_node(ht, iterator);
+
+            iterator = right_node;
         }
+    }
+}
 
-        /* Fix the bucket */
-        err = hash_table_insert_fix_node_up(ht, bucket_index, new_node);
+/**
+ * @brief Function to move one old bucket into the new buckets array,
+ * the old bucket will point to black hole node after moving.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param old_index index of the old bucket to move
+ */
+static void hash_table_rehash_bucket(const hash_table_t * const __restrict__ ht, size_t old_index) {
+    /* Check if old bucket still has nodes */
+    if (ht->nil != ht->old_buckets[old_index]) {
+        hash_table_rehash_helper(ht, ht->old_buckets[old_index]);
+        ht->old_buckets[old_index] = ht->nil;
+    }
+}
+
+/**
+ * @brief Subroutine function of hash_table_stats, to add the probe lengths
+ * of all nodes of one bucket tree to the histogram. MUST not be used outside this file.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param node pointer to current hash table node of the bucket tree
+ * @param probe_length number of nodes visited by a search ending at node
+ * @param stats pointer to the distribution to fill
+ * @param total_probes pointer to the sum of the probe lengths of all keys
+ * @return size_t number of nodes of the subtree rooted at node
+ */
+static size_t hash_table_stats_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ node, size_t probe_length, hash_table_stats_t * const __restrict__ stats, size_t * const __restrict__ total_probes) {
+    /* Check if node can be counted */
+    if (ht->nil == node) {
+        return 0;
+    }
+
+    /* Longer probes than the histogram are gathered in the last entry */
+    if (probe_length < HASH_TABLE_PROBE_HISTOGRAM_SIZE) {
+        ++(stats->probe_histogram[probe_length - 1]);
     } else {
+        ++(stats->probe_histogram[HASH_TABLE_PROBE_HISTOGRAM_SIZE - 1]);
+    }
 
-        /* Created node is root node */
-        ht->buckets[bucket_index] = new_node;
-        new_node->color = HASH_BLACK;
+    if (probe_length > stats->max_probe_length) {
+        stats->max_probe_length = probe_length;
     }
 
-    /* Increase hash table size */
-    ++(ht->size);
+    *total_probes += probe_length;
 
-    /* Check if has table needs to be rehashed */
-    if (1 == hash_table_need_to_rehash(ht)) {
-        return hash_table_rehash(ht);
+    /* Count current node and the nodes of both subtrees */
+    return 1 + hash_table_stats_helper(ht, node->left, probe_length + 1, stats, total_probes)
+             + hash_table_stats_helper(ht, node->right, probe_length + 1, stats, total_probes);
+}
+
+/**
+ * @brief Function to compute the distribution of the keys of a hash table.
+ * During an incremental rehash every old bucket that was not moved yet is
+ * counted as one more bucket. MUST not be used outside this file.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param stats pointer to the distribution to fill
+ */
+static void hash_table_stats_compute(const hash_table_t * const __restrict__ ht, hash_table_stats_t * const __restrict__ stats) {
+    memset(stats, 0, sizeof(*stats));
+
+    size_t total_probes = 0;
+    size_t total_keys = 0;
+
+    /* Walk the new buckets first, then the old ones */
+    hash_table_node_t * const * const arrays[2] = { ht->buckets, ht->old_buckets };
+    const size_t capacities[2] = { ht->capacity, (NULL != ht->old_buckets) ? ht->old_capacity : 0 };
+
+    for (size_t array = 0; array < 2; ++array) {
+        for (size_t iter = 0; iter < capacities[array]; ++iter) {
+            size_t bucket_size = hash_table_stats_helper(ht, arrays[array][iter], 1, stats, &total_probes);
+
+            if (0 != bucket_size) {
+                ++(stats->used_buckets);
+                total_keys += bucket_size;
+            }
+
+            if (bucket_size > stats->max_bucket_size) {
+                stats->max_bucket_size = bucket_size;
+            }
+        }
     }
 
-    /* Insertion in hash table went successfully, or not */
-    return err;
+    /* An empty table has no mean */
+    if ((0 == total_keys) || (0 == ht->capacity)) {
+        return;
+    }
+
+    stats->load_factor = (double)total_keys / (double)ht->capacity;
+    stats->mean_bucket_size = (double)total_keys / (double)stats->used_buckets;
+    stats->mean_probe_length = (double)total_probes / (double)total_keys;
+    stats->skew = (double)stats->max_bucket_size / (stats->load_factor + 1.0);
 }
 
 /**
- * @brief Subroutine function of hash_table rehash, to traverse all
- * nodes from a bucket as in a red black tree and to insert all nodes
- * into the new buckets.
+ * @brief Function to call the skew warning of a hash table if the skew
+ * of its buckets is greater than the selected threshold. MUST not be used
+ * outside this file.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param bucket pointer to current working hash table(red black tree) node to re-insert
+ * @param stats pointer to the distribution of the keys of the hash table
  */
-static void hash_table_rehash_helper(hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket) {
-    /* Check if current root can be inserted */
-    if (ht->nil == bucket) {
+static void hash_table_check_skew(const hash_table_t * const __restrict__ ht, const hash_table_stats_t * const __restrict__ stats) {
+    if ((NULL != ht->skew_warn) && (stats->skew > ht->skew_threshold)) {
+        ht->skew_warn(ht, stats, ht->skew_arg);
+    }
+}
+
+/**
+ * @brief Function to move a bounded number of old buckets into the
+ * new buckets array. When all old buckets are moved, the old array
+ * is released and the rehash process is finished.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param steps maximum number of old buckets to move
+ */
+static void hash_table_rehash_step(hash_table_t * const __restrict__ ht, size_t steps) {
+    /* Check if a rehash is in progress */
+    if (NULL == ht->old_buckets) {
         return;
     }
 
-    /* Reinsert current node into the hash table */
-    hash_table_insert(ht, bucket->key, bucket->data);
+    /* Move at most steps buckets */
+    while ((0 != steps) && (ht->rehash_index < ht->old_capacity)) {
+        hash_table_rehash_bucket(ht, ht->rehash_index);
 
-    /* Reinsert left node child */
-    hash_table_rehash_helper(ht, bucket->left);
-    
-    /* Reinsert right node child */
-    hash_table_rehash_helper(ht, bucket->right);
+        ++(ht->rehash_index);
+        --steps;
+    }
+
+    /* All old buckets were moved, release the old array */
+    if (ht->rehash_index >= ht->old_capacity) {
+        scl_free(ht->allocator, ht->old_buckets);
+
+        ht->old_buckets = NULL;
+        ht->old_capacity = 0;
+        ht->rehash_index = 0;
+
+        /* Check the spread of the keys once per rehash, while the cost is paid anyway */
+        if (NULL != ht->skew_warn) {
+            hash_table_stats_t stats;
+
+            hash_table_stats_compute(ht, &stats);
+            hash_table_check_skew(ht, &stats);
+        }
+    }
 }
 
 /**
- * @brief Function to rehash a hash table and to double the capacity
- * of the table (double number of red black trees). Function may fail
- * if hash table is not allocated or has NULL trees or not enough
- * memory is left on heap to allocate new red black trees.
+ * @brief Function to prepare a hash table for an operation on a key with
+ * a known hash value. If an incremental rehash is in progress the old bucket
+ * of the key is moved first, so the key can be searched just in the new
+ * buckets, and then rehash_step more old buckets are moved.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key_hash hash value of the key
+ */
+static void hash_table_rehash_hash(hash_table_t * const __restrict__ ht, size_t key_hash) {
+    /* Check if a rehash is in progress */
+    if (NULL == ht->old_buckets) {
+        return;
+    }
+
+    /* Move the old bucket of the key */
+    hash_table_rehash_bucket(ht, hash_table_bucket_index(key_hash, ht->old_capacity));
+
+    /* Pay a bounded part of the rehash */
+    hash_table_rehash_step(ht, ht->rehash_step);
+}
+
+/**
+ * @brief Function to change the number of buckets of a hash table.
+ * Nodes are moved into the new buckets without copying their key and
+ * data. If the incremental mode is off or move_all is set all buckets
+ * are moved at once, otherwise the old buckets are kept alive and moved
+ * by the next operations. Function may fail if hash table is not allocated
+ * or has NULL trees or not enough memory is left on heap to allocate new
+ * red black trees.
  * 
  * @param ht pointer to an allocated hash table memory location
+ * @param new_capacity number of buckets of the new buckets array
+ * @param move_all 1 if all buckets must be moved now, 0 otherwise
  * @return scl_error_t enum object for handling errors
  */
-static scl_error_t hash_table_rehash(hash_table_t * const __restrict__ ht) {
+static scl_error_t hash_table_resize(hash_table_t * const __restrict__ ht, size_t new_capacity, uint8_t move_all) {
     /* Check if hash table is allocated */
     if (NULL == ht) {
         return SCL_NULL_HASH_TABLE;
@@ -735,941 +1230,2254 @@ static scl_error_t hash_table_rehash(hash_table_t * const __restrict__ ht) {
         return SCL_NULL_HASH_FUNCTION;
     }
 
-    /* Remember old capacity and compute new capacity */
-    size_t old_capacity = ht->capacity;
-    ht->capacity *= DEFAULT_HASH_CAPACITY_RATIO;
+    /* Finish the previous rehash before starting a new one */
+    hash_table_rehash_step(ht, SIZE_MAX);
+
+    /* Buckets are selected by masking, capacity must be a power of two */
+    new_capacity = hash_table_next_pow2(new_capacity);
 
     /* Allocate new array of tree roots */
-    hash_table_node_t **new_buckets = malloc(sizeof(*new_buckets) * ht->capacity);
+    hash_table_node_t **new_buckets = scl_malloc(ht->allocator, sizeof(*new_buckets) * new_capacity);
 
     /* Check if roots were allocated */
     if (NULL == new_buckets) {
-        ht->capacity = old_capacity;
-
         errno = ENOMEM;
         perror("Not enough memory for buckets of hash table");
 
         return SCL_REHASHING_FAILED;
     }
 
-    /* Change old roots pointer to new roots pointer */
-    hash_table_node_t **old_buckets = ht->buckets;
-    ht->buckets = new_buckets;
-
     /* Set all buckets to black hole node */
-    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+    for (size_t iter = 0; iter < new_capacity; ++iter) {
         new_buckets[iter] = ht->nil;
     }
 
-    /* Set size of the hash table as default */
-    ht->size = 0;
+    SCL_STATS_ADD(ht, allocations, 1);
+    SCL_STATS_ADD(ht, rehashes, 1);
 
-    /* 
-     * Insert one bucket at a time in the new allocated trees
-     * and delete one bucket at a time from old roots pointer
-     */
-    for (size_t iter = 0; iter < old_capacity; ++iter) {
-        if (ht->nil != old_buckets[iter]) {
-            hash_table_rehash_helper(ht, old_buckets[iter]);
-            free_hash_table_helper(ht, &old_buckets[iter]);
-        }
-    }
+    /* Keep the old buckets alive until they are moved */
+    ht->old_buckets = ht->buckets;
+    ht->old_capacity = ht->capacity;
+    ht->rehash_index = 0;
+
+    /* Change old roots pointer to new roots pointer */
+    ht->buckets = new_buckets;
+    ht->capacity = new_capacity;
 
-    /* Free pointer of the old roots pointer */
-    free(old_buckets);
-    old_buckets = NULL;
+    /* Move every bucket now if incremental mode is not set */
+    if ((0 == ht->rehash_step) || (0 != move_all)) {
+        hash_table_rehash_step(ht, SIZE_MAX);
+    }
 
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Subroutine function to search one node having as node value
- * current key specified in input. If no key is found function will
- * return a pointer to the black hole node.
+ * @brief Function to rehash a hash table and to double the capacity
+ * of the table (double number of red black trees). See hash_table_resize
+ * function.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param bucket_index index of the working red black tree from hash table
- * @param data pointer to a location of a value representing data of a node
- * @return hash_table_node_t* an allocated hash table node object containing
- * desired data or `nil` id such data does not exists in the current tree
+ * @return scl_error_t enum object for handling errors
  */
-static hash_table_node_t* hash_table_find_node(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
-    /* Check if input data is valid */
-    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key)) {
-        return ht->nil;
-    }
-
-    /* Make sure that current working tree exists */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
-
-    /* Set iterator pointer */
-    hash_table_node_t *iterator = ht->buckets[bucket_index];
-
-    /* Search for input data (void *data) in all tree */
-    while (ht->nil != iterator) {
-        if (ht->cmp_key(iterator->key, key) <= -1) {
-            iterator = iterator->right;
-        } else if (ht->cmp_key(iterator->key, key) >= 1) {
-            iterator = iterator->left;
-        } else {
-            return iterator;
-        }
+static scl_error_t hash_table_rehash(hash_table_t * const __restrict__ ht) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
     }
 
-    /* Data was not found */
-    return ht->nil;
+    return hash_table_resize(ht, ht->capacity * DEFAULT_HASH_CAPACITY_RATIO, 0);
 }
 
 /**
- * @brief Function to find the pair {key, data} from hash table.
- * However function will return a pointer to memory location just
- * for data type not for key type.
+ * @brief Function to reserve enough buckets for a hash table to hold
+ * number_of_keys keys without exceeding the load factor, so no rehash
+ * will happen while inserting them. All the nodes are moved at once into
+ * the new buckets. If the hash table has already enough buckets nothing
+ * is changed.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of the hash
- * @param data pointer to a location of a value representing data of a node
- * @return const void* pointer to memory location of the data pointer from the input
- * or `NULL` is no such data exists in the hash tree
+ * @param number_of_keys total number of keys the hash table should hold
+ * @return scl_error_t enum object for handling errors
  */
-const void* hash_table_find_key_data(const hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
-    /* Check if input data is valid */
-    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key) || (NULL == data)) {
-        return NULL;
+scl_error_t hash_table_reserve(hash_table_t * const __restrict__ ht, size_t number_of_keys) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
     }
 
-    /* Get the node data or `NULL` if node is `nil` */
-    const void * const search_data = hash_table_find_node(ht, key)->data;
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
 
-    if (ht->cmp_dt(search_data, data) == 0) {
-        return search_data;
+    /* Compute the number of buckets needed by the load factor */
+    size_t new_capacity = (size_t)(number_of_keys / DEFAULT_HASH_LOAD_FACTOR) + 1;
+
+    /* Hash table is big enough */
+    if (new_capacity <= ht->capacity) {
+        return SCL_OK;
     }
 
-    return NULL;
+    /* Resize the buckets array once */
+    return hash_table_resize(ht, new_capacity, 1);
 }
 
 /**
- * @brief Function to find first occurence of the key node 
- * from hash table. However function will return a pointer to memory
- * location just for data type.
+ * @brief Function to set the incremental rehash mode of a hash table.
+ * When mode is set, the rehash will allocate the new buckets but will
+ * move just buckets_per_step old buckets on every insertion or deletion,
+ * so no single operation will pay for the entire rehash. Setting the
+ * value to zero returns to the default mode, where all buckets are moved
+ * at once.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of a node
- * @return const void* pointer to memory location of the data pointer
- * or `NULL` is no such key exists in the hash tree
+ * @param buckets_per_step number of old buckets to move on every operation
+ * @return scl_error_t enum object for handling errors
  */
-const void* hash_table_find_data(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
-    /* Check if input data is valid */
-    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key)) {
-        return NULL;
+scl_error_t hash_table_set_incremental_rehash(hash_table_t * const __restrict__ ht, size_t buckets_per_step) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
     }
 
-    /* Key was not found it means no data */
-    return hash_table_find_node(ht, key)->data;
-}
+    /* Set the new rehash step */
+    ht->rehash_step = buckets_per_step;
 
-/**
- * @brief Function to check if hash table contains the {key, data} pair. 
- * 
- * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of the hash
- * @param data pointer to a location of a value representing data of a node
- * @return uint8_t 0 if pair {key, data} is not found in hash table or 1 otherwise
- */
-uint8_t hash_table_contains_key_data(const hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
-    /* Pair is not in the current hash table */
-    if (NULL == hash_table_find_key_data(ht, key, data)) {
-        return 0;
+    /* Default mode cannot have a pending rehash */
+    if (0 == buckets_per_step) {
+        hash_table_rehash_step(ht, SIZE_MAX);
     }
 
-    /* Pair is in the current hash table */
-    return 1;
+    /* All good */
+    return SCL_OK;
 }
 
 /**
- * @brief Function to check if hash table is empty or not.
+ * @brief Function to move all old buckets left by an incremental rehash.
+ * Function may be called in idle moments or before a bucket traversal.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @return uint8_t 0 if hash table is not empty or 1 otherwise
+ * @return scl_error_t enum object for handling errors
  */
-uint8_t is_hash_table_empty(const hash_table_t * const __restrict__ ht) {
-    /* Hash table is empty */
-    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->capacity) || (0 == ht->size)) {
-        return 1;
+scl_error_t hash_table_finish_rehash(hash_table_t * const __restrict__ ht) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
     }
 
-    /* Hash table is not empty */
-    return 0;
+    /* Move all the remaining buckets */
+    hash_table_rehash_step(ht, SIZE_MAX);
+
+    /* All good */
+    return SCL_OK;
 }
 
 /**
- * @brief Function to check if hash table bucket according to key
- * type value is empty or not.
+ * @brief Function to check if an incremental rehash is in progress.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of the hash
- * @return uint8_t 0 if hash table bucket is not empty or 1 otherwise
+ * @return uint8_t 1 if old buckets are still waiting to be moved or 0 otherwise
  */
-uint8_t is_hash_table_bucket_key_empty(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
-    /* Compute the curent bucket index */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
-
-    /* Hast table bucket is empty */
-    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->capacity) || 
-        (0 == ht->size) || (ht->nil == ht->buckets[bucket_index])) {
-        return 1;
+uint8_t is_hash_table_rehashing(const hash_table_t * const __restrict__ ht) {
+    /* Check if old buckets exist */
+    if ((NULL == ht) || (NULL == ht->old_buckets)) {
+        return 0;
     }
 
-    /* Hash table bucket is not empty */
-    return 0;
+    /* Rehash is in progress */
+    return 1;
 }
 
 /**
- * @brief Get the current hash table size.
+ * @brief Helper function to insert a pair {key, data} into the hash table
+ * when the hash value of the key is already computed. Input is considered
+ * valid.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @return size_t SIZE_MAX if hash table is not allocated or
- * hash table's size.
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
  */
-size_t get_hash_table_size(const hash_table_t * const __restrict__ ht) {
-    if (NULL == ht) {
-        return SIZE_MAX;
-    }
+static scl_error_t hash_table_insert_hashed(hash_table_t * const __restrict__ ht, size_t key_hash, const void *key, const void *data) {
+    /* Move the pending old bucket of the key */
+    hash_table_rehash_hash(ht, key_hash);
 
-    return ht->size;
-}
+    /* Compute index of the current working tree */
+    size_t bucket_index = hash_table_bucket_index(key_hash, ht->capacity);
 
-/**
- * @brief Get the current hash table capacity.
- * 
- * @param ht pointer to an allocated hash table memory location
- * @return size_t SIZE_MAX if hash table is not allocated or
- * hash table's capacity.
- */
-size_t get_hash_table_capacity(const hash_table_t * const __restrict__ ht) {
-    if (NULL == ht) {
-        return SIZE_MAX;
-    }
+    /* Set iterator pointers */
+    hash_table_node_t *iterator = ht->buckets[bucket_index];
+    hash_table_node_t *parent_iterator = ht->nil;
 
-    return ht->capacity;
-}
+    /* Find a valid position for insertion */
+    SCL_STATS_ADD(ht, lookups, 1);
 
-/**
- * @brief Helper function to compute the size of one bucket
- * according to key type value.
- * 
- * @param ht pointer to an allocated hash table memory location
- * @param bucket pointer to current hash table node to start counting size
- * @return size_t size of one bucket(red black tree) from hash table
- */
-static size_t hash_table_count_bucket_elements_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket) {
-    /* Check if node can be counted */
-    if (ht->nil == bucket) {
-        return 0;
+    while (ht->nil != iterator) {
+        parent_iterator = iterator;
+
+        SCL_STATS_ADD(ht, probes, 1);
+        int32_t compare_result = hash_table_compare_node(ht, iterator, key_hash, key);
+
+        if (compare_result >= 1) {
+            iterator = iterator->left;
+        } else if (compare_result <= -1) {
+            iterator = iterator->right;
+        } else {
+
+            /*
+             * Node already exists in current red-black tree
+             * increment count value of node
+             */
+            ++(iterator->count);
+            return 0;
+        }
     }
 
-    /* Count current node */
-    size_t total_nodes = 1;
+    /* Create a new bucket node object */
+    hash_table_node_t *new_node = create_hash_table_node(ht, key_hash, key, data);
 
-    /* Count nodes from left subtree */
-    total_nodes += hash_table_count_bucket_elements_helper(ht, bucket->left);
+    /* Check if new bucket(hash table) node was created */
+    if (ht->nil == new_node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
     
-    /* Count nodes from right subtree */
-    total_nodes += hash_table_count_bucket_elements_helper(ht, bucket->right);
+    scl_error_t err = SCL_OK;
 
-    /* Return total count of the all tree(bucket) */
-    return total_nodes;
+    if (ht->nil != parent_iterator) {
+
+        /* Update parent links */
+        new_node->parent = parent_iterator;
+
+        /* Update children links */
+        if (hash_table_compare_node(ht, parent_iterator, key_hash, key) >= 1) {
+            parent_iterator->left = new_node;
+        } else {
+            parent_iterator->right = new_node;
+        }
+
+        /* Fix the bucket */
+        err = hash_table_insert_fix_node_up(ht, bucket_index, new_node);
+    } else {
+
+        /* Created node is root node */
+        ht->buckets[bucket_index] = new_node;
+        new_node->color = HASH_BLACK;
+    }
+
+    /* Increase hash table size */
+    ++(ht->size);
+
+    /* Searches of the new key must pass the filter */
+    if (NULL != ht->filter) {
+        bloom_filter_add_hash(ht->filter, key_hash);
+        hash_table_refresh_bloom_filter(ht);
+    }
+
+    /* Check if has table needs to be rehashed */
+    if (1 == hash_table_need_to_rehash(ht)) {
+        return hash_table_rehash(ht);
+    }
+
+    /* Insertion in hash table went successfully, or not */
+    return err;
 }
 
 /**
- * @brief Function to compute the size of one bucket according to key type
- * value. Bucket index is computed with hashing function of the current
- * hast table.
+ * @brief Function to insert a pair {key, data} into the hash table. The bytes
+ * of the key and data are copied into a new hash table node. If the key
+ * already exists in the table just the counter of the node is increased.
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param key pointer to a location of a value representing key of the hash
- * @return size_t SIZE_MAX if hash table is not valid or size of desired bucket
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
  */
-size_t hash_table_count_bucket_elements(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
-    /* Check if input data is valid */
-    if ((NULL == ht) || (NULL == ht->buckets)) {
-        return SIZE_MAX;
+scl_error_t hash_table_insert(hash_table_t * const __restrict__ ht, const void *key, const void *data) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Compute the bucket index */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
 
-    /* Compute the size of the bucket */
-    return hash_table_count_bucket_elements_helper(ht, ht->buckets[bucket_index]);
+    /* Check if data pointer is not `NULL` */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Insert the pair using the hash of the key */
+    return hash_table_insert_hashed(ht, ht->hash(key), key, data);
 }
 
 /**
- * @brief Function to find minimum node from a bucket(red black tree) starting
- * from root(subtree), this function is a subroutine to delete data from a hash
- * table bucket.
+ * @brief Function to insert a pair {key, data} into the hash table when
+ * the hash value of the key is already known, so the key is not hashed
+ * again. The key_hash MUST be the value returned by the hash function of
+ * the hash table for the key. See hash_table_insert function.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param bucket pointer to current hash table node to start finding minimum node
- * @return hash_table_node_t* pointer to minimum node starting from root subtree
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
  */
-static hash_table_node_t* hash_table_root_min_node(const hash_table_t * const __restrict__ ht, hash_table_node_t * __restrict__ bucket) {
-    /* Check if root node has minimum */
-    if (ht->nil != bucket) {
+scl_error_t hash_table_insert_with_hash(hash_table_t * const __restrict__ ht, size_t key_hash, const void *key, const void *data) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
 
-        /* Find minimum node starting from root */
-        while (ht->nil != bucket->left) {
-            bucket = bucket->left;
-        }
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Return minimum node */
-    return bucket;
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data pointer is not `NULL` */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Insert the pair using the known hash of the key */
+    return hash_table_insert_hashed(ht, key_hash, key, data);
 }
 
 /**
- * @brief Function to swap two nodes from a hash table bucket.
- * This function MUST NOT be used by users, because it will
- * break the proprety of red-black tree, it is a subroutine
- * program of delete function to change data of the current node
- * with its inorder successor.
+ * @brief Function to insert count pairs {key, data} into the hash table at once.
+ * The buckets array is resized just once to hold all the keys, then all the
+ * keys are hashed in a single pass and the pairs are inserted grouped by their
+ * bucket, so every bucket tree is walked while it is still in cache.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param bucket_index index of the working red black tree from hash table
- * @param dest_node hash table node object to rewrite data bytes from src_node
- * @param src_node hash table node object to copy data bytes
+ * @param keys contiguous array of count keys, each of key_size bytes
+ * @param datas contiguous array of count datas, each of data_size bytes
+ * @param count number of pairs to insert
  * @return scl_error_t enum object for handling errors
  */
-static scl_error_t hash_table_swap_nodes(const hash_table_t * const __restrict__ ht, size_t bucket_index, hash_table_node_t * __restrict__ const dest_node, hash_table_node_t * __restrict__ const src_node) {
-    /* Check if swap is posible */
-    if ((ht->nil == dest_node) || (ht->nil == src_node)) {
-        return SCL_CANNOT_SWAP_DATA;
+scl_error_t hash_table_insert_bulk(hash_table_t * const __restrict__ ht, const void *keys, const void *datas, size_t count) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
     }
 
-    /* Change color of nodes */
-    hash_table_node_color_t temp_color = dest_node->color;
-    dest_node->color = src_node->color;
-    src_node->color = temp_color;
-
-    /* Interchange the right child */
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
 
-    hash_table_node_t *temp = dest_node->right;
+    /* Check if key pointer is not `NULL` */
+    if (NULL == keys) {
+        return SCL_INVALID_KEY;
+    }
 
-    dest_node->right = src_node->right;
+    /* Check if data pointer is not `NULL` */
+    if (NULL == datas) {
+        return SCL_INVALID_DATA;
+    }
 
-    if (ht->nil != dest_node->right) {
-        dest_node->right->parent = dest_node;
+    /* Nothing to insert */
+    if (0 == count) {
+        return SCL_OK;
     }
 
-    src_node->right = temp;
+    /* Size the buckets array once for all the keys */
+    scl_error_t err = hash_table_reserve(ht, ht->size + count);
 
-    if (ht->nil != src_node->right) {
-        src_node->right->parent = src_node;
+    if (SCL_OK != err) {
+        return err;
     }
 
-    /* Interchange the left child */
+    const uint8_t * const typed_keys = keys;
+    const uint8_t * const typed_datas = datas;
 
-    temp = dest_node->left;
+    /* Allocate the hashes of the keys and the insertion order */
+    size_t *hashes = scl_malloc(ht->allocator, sizeof(*hashes) * count);
+    size_t *order = scl_malloc(ht->allocator, sizeof(*order) * count);
+    size_t *bucket_start = scl_calloc(ht->allocator, ht->capacity + 1, sizeof(*bucket_start));
 
-    dest_node->left = src_node->left;
+    /* Not enough memory to group the keys, insert them one by one */
+    if ((NULL == hashes) || (NULL == order) || (NULL == bucket_start)) {
+        scl_free(ht->allocator, hashes);
+        scl_free(ht->allocator, order);
+        scl_free(ht->allocator, bucket_start);
 
-    if (ht->nil != dest_node->left) {
-        dest_node->left->parent = dest_node;
-    }
+        for (size_t iter = 0; iter < count; ++iter) {
+            err = hash_table_insert(ht, typed_keys + iter * ht->key_size, typed_datas + iter * ht->data_size);
 
-    src_node->left = temp;
+            if (SCL_OK != err) {
+                return err;
+            }
+        }
 
-    if (ht->nil != src_node->left) {
-        src_node->left->parent = src_node;
+        return SCL_OK;
     }
 
-    /* Interchange parents of the two nodes */
-
-    temp = dest_node->parent;
+    /* Hash all the keys and count the keys of every bucket */
+    for (size_t iter = 0; iter < count; ++iter) {
+        hashes[iter] = ht->hash(typed_keys + iter * ht->key_size);
+        ++(bucket_start[hash_table_bucket_index(hashes[iter], ht->capacity) + 1]);
+    }
 
-    dest_node->parent = src_node->parent;
+    /* Compute where every bucket group starts */
+    for (size_t iter = 1; iter <= ht->capacity; ++iter) {
+        bucket_start[iter] += bucket_start[iter - 1];
+    }
 
-    if (ht->nil != dest_node->parent) {
-        if (dest_node->parent->left == src_node) {
-            dest_node->parent->left = dest_node;
-        } else {
-            dest_node->parent->right = dest_node;
-        }
-    } else {
-        ht->buckets[bucket_index] = dest_node;
+    /* Group the keys by their bucket, keeping their input order */
+    for (size_t iter = 0; iter < count; ++iter) {
+        order[(bucket_start[hash_table_bucket_index(hashes[iter], ht->capacity)])++] = iter;
     }
 
-    src_node->parent = temp;
+    scl_free(ht->allocator, bucket_start);
 
-    if (ht->nil != src_node->parent) {
-        if (src_node->parent->left == dest_node) {
-            src_node->parent->left = src_node;
-        } else {
-            src_node->parent->right = src_node;
-        }
-    } else {
-        ht->buckets[bucket_index] = src_node;
+    /* Insert pairs bucket by bucket */
+    for (size_t iter = 0; (iter < count) && (SCL_OK == err); ++iter) {
+        size_t pair_index = order[iter];
+
+        err = hash_table_insert_hashed(ht, hashes[pair_index], typed_keys + pair_index * ht->key_size, typed_datas + pair_index * ht->data_size);
     }
 
-    /* All good */
-    return SCL_OK;
+    scl_free(ht->allocator, hashes);
+    scl_free(ht->allocator, order);
+
+    /* Insertion went successfully, or not */
+    return err;
 }
 
 /**
- * @brief Subroutine function to fix one bucket after one node was deleted from
- * the same bucket, the bucket will be fixed as a red black tree.
+ * @brief Subroutine function to search one node having as node value
+ * current key specified in input. If no key is found function will
+ * return a pointer to the black hole node. Input is considered valid.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param bucket_index index of the working red black tree(bucket) from hash table
- * to fix after deletion of one hash table node
- * @param fix_node pointer to a hash table node (red black node) to start fixing
- * @param parent_fix_node parent pointer to a hash table node (red black node) to start fixing
- * @return scl_error_t enum object for handling errors
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of the hash
+ * @return hash_table_node_t* an allocated hash table node object containing
+ * desired key or `nil` id such key does not exists in the hash table
  */
-static scl_error_t hash_table_delete_fix_node_up(const hash_table_t * const __restrict__ ht, size_t bucket_index, hash_table_node_t *fix_node, hash_table_node_t *parent_fix_node) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
+static hash_table_node_t* hash_table_find_node_hashed(const hash_table_t * const __restrict__ ht, size_t key_hash, const void * const __restrict__ key) {
+    /* A key rejected by the filter is surely missing */
+    if (0 == bloom_filter_may_contain_hash(ht->filter, key_hash)) {
+        return ht->nil;
     }
 
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
+    /* Set iterator pointer */
+    hash_table_node_t *iterator = ht->buckets[hash_table_bucket_index(key_hash, ht->capacity)];
+
+    /*
+     * During an incremental rehash a key that was not moved
+     * yet can be found just in its old bucket
+     */
+    if ((NULL != ht->old_buckets) && (ht->nil != ht->old_buckets[hash_table_bucket_index(key_hash, ht->old_capacity)])) {
+        iterator = ht->old_buckets[hash_table_bucket_index(key_hash, ht->old_capacity)];
     }
 
-    /* Check if fixing is needed */
-    if (ht->nil == parent_fix_node) {
-        return SCL_FIXING_NULL_TREE_NODE;
+    /* Search for input key in all tree */
+    SCL_STATS_ADD(ht, lookups, 1);
+
+    while (ht->nil != iterator) {
+        SCL_STATS_ADD(ht, probes, 1);
+        int32_t compare_result = hash_table_compare_node(ht, iterator, key_hash, key);
+
+        if (compare_result <= -1) {
+            iterator = iterator->right;
+        } else if (compare_result >= 1) {
+            iterator = iterator->left;
+        } else {
+            return iterator;
+        }
+    }
+
+    /* Key was not found */
+    return ht->nil;
+}
+
+/**
+ * @brief Subroutine function to search one node having as node value
+ * current key specified in input. If no key is found function will
+ * return a pointer to the black hole node.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return hash_table_node_t* an allocated hash table node object containing
+ * desired key or `nil` id such key does not exists in the hash table
+ */
+static hash_table_node_t* hash_table_find_node(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key)) {
+        return ht->nil;
+    }
+
+    /* Compute the hash of the key just once */
+    return hash_table_find_node_hashed(ht, ht->hash(key), key);
+}
+
+/**
+ * @brief Function to find the pair {key, data} from hash table.
+ * However function will return a pointer to memory location just
+ * for data type not for key type.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return const void* pointer to memory location of the data pointer from the input
+ * or `NULL` is no such data exists in the hash tree
+ */
+const void* hash_table_find_key_data(const hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key) || (NULL == data)) {
+        return NULL;
+    }
+
+    /* Get the node data or `NULL` if node is `nil` */
+    const void * const search_data = hash_table_find_node(ht, key)->data;
+
+    if (ht->cmp_dt(search_data, data) == 0) {
+        return search_data;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to find first occurence of the key node 
+ * from hash table. However function will return a pointer to memory
+ * location just for data type.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of a node
+ * @return const void* pointer to memory location of the data pointer
+ * or `NULL` is no such key exists in the hash tree
+ */
+const void* hash_table_find_data(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key)) {
+        return NULL;
+    }
+
+    /* Key was not found it means no data */
+    return hash_table_find_node(ht, key)->data;
+}
+
+/**
+ * @brief Function to find the data of a key when the hash value of the
+ * key is already known, so the key is not hashed again. The key_hash MUST
+ * be the value returned by the hash function of the hash table for the key.
+ * See hash_table_find_data function.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of a node
+ * @return const void* pointer to memory location of the data pointer
+ * or `NULL` is no such key exists in the hash tree
+ */
+const void* hash_table_find_data_with_hash(const hash_table_t * const __restrict__ ht, size_t key_hash, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key)) {
+        return NULL;
+    }
+
+    /* Key was not found it means no data */
+    return hash_table_find_node_hashed(ht, key_hash, key)->data;
+}
+
+/* Number of keys searched together by hash_table_find_batch */
+#define HASH_TABLE_BATCH_KEYS 16
+
+/**
+ * @brief Function to find the data of many keys at once. The keys are
+ * searched in groups of HASH_TABLE_BATCH_KEYS: all the keys of a group are
+ * hashed first and their bucket slots are prefetched, then the roots of the
+ * buckets are loaded and prefetched and the trees of the group are walked
+ * one level per round, prefetching the next node of every key. The cache
+ * misses of the keys of a group overlap instead of adding up, the results
+ * are the same as calling **hash_table_find_data** for every key.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param keys array of count keys, every key has key_size bytes
+ * @param count number of keys to search
+ * @param results array of count pointers, filled with the data of every
+ * key or `NULL` if the key is not in the hash table
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_find_batch(const hash_table_t * const __restrict__ ht, const void * const __restrict__ keys, size_t count, const void ** const __restrict__ results) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if the keys and the results are valid */
+    if (NULL == keys) {
+        return SCL_INVALID_KEY;
+    }
+
+    if (NULL == results) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const uint8_t * const typed_keys = keys;
+    hash_table_node_t *iterators[HASH_TABLE_BATCH_KEYS];
+    size_t hashes[HASH_TABLE_BATCH_KEYS];
+
+    for (size_t group = 0; group < count; group += HASH_TABLE_BATCH_KEYS) {
+        const size_t group_keys = (count - group < HASH_TABLE_BATCH_KEYS) ? (count - group) : HASH_TABLE_BATCH_KEYS;
+        const uint8_t * const group_key = typed_keys + group * ht->key_size;
+        const void ** const group_result = results + group;
+
+        /* Hash all the keys of the group and prefetch their bucket slots */
+        for (size_t iter = 0; iter < group_keys; ++iter) {
+            hashes[iter] = ht->hash(group_key + iter * ht->key_size);
+            iterators[iter] = NULL;
+
+            /* A key rejected by the filter is surely missing, its bucket is not loaded */
+            if (0 == bloom_filter_may_contain_hash(ht->filter, hashes[iter])) {
+                iterators[iter] = ht->nil;
+                continue;
+            }
+
+            SCL_PREFETCH(&ht->buckets[hash_table_bucket_index(hashes[iter], ht->capacity)]);
+
+            if (NULL != ht->old_buckets) {
+                SCL_PREFETCH(&ht->old_buckets[hash_table_bucket_index(hashes[iter], ht->old_capacity)]);
+            }
+        }
+
+        /* Load the roots of the buckets and prefetch them */
+        for (size_t iter = 0; iter < group_keys; ++iter) {
+            if (ht->nil == iterators[iter]) {
+                continue;
+            }
+
+            hash_table_node_t *iterator = ht->buckets[hash_table_bucket_index(hashes[iter], ht->capacity)];
+
+            /* A key that was not moved yet by the incremental rehash is in its old bucket */
+            if ((NULL != ht->old_buckets) && (ht->nil != ht->old_buckets[hash_table_bucket_index(hashes[iter], ht->old_capacity)])) {
+                iterator = ht->old_buckets[hash_table_bucket_index(hashes[iter], ht->old_capacity)];
+            }
+
+            SCL_PREFETCH(iterator);
+            SCL_STATS_ADD(ht, lookups, 1);
+
+            iterators[iter] = iterator;
+        }
+
+        /* Walk the trees of the group one level per round, `NULL` marks a finished search */
+        size_t pending_keys = group_keys;
+
+        while (pending_keys > 0) {
+            pending_keys = 0;
+
+            for (size_t iter = 0; iter < group_keys; ++iter) {
+                hash_table_node_t *iterator = iterators[iter];
+
+                if (NULL == iterator) {
+                    continue;
+                }
+
+                /* Key was not found it means no data */
+                if (ht->nil == iterator) {
+                    group_result[iter] = NULL;
+                    iterators[iter] = NULL;
+                    continue;
+                }
+
+                SCL_STATS_ADD(ht, probes, 1);
+                int32_t compare_result = hash_table_compare_node(ht, iterator, hashes[iter], group_key + iter * ht->key_size);
+
+                if (0 == compare_result) {
+                    group_result[iter] = iterator->data;
+                    iterators[iter] = NULL;
+                    continue;
+                }
+
+                iterator = (compare_result <= -1) ? iterator->right : iterator->left;
+
+                SCL_PREFETCH(iterator);
+
+                iterators[iter] = iterator;
+                ++pending_keys;
+            }
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if hash table contains the {key, data} pair. 
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return uint8_t 0 if pair {key, data} is not found in hash table or 1 otherwise
+ */
+uint8_t hash_table_contains_key_data(const hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
+    /* Pair is not in the current hash table */
+    if (NULL == hash_table_find_key_data(ht, key, data)) {
+        return 0;
+    }
+
+    /* Pair is in the current hash table */
+    return 1;
+}
+
+/**
+ * @brief Function to check if hash table is empty or not.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @return uint8_t 0 if hash table is not empty or 1 otherwise
+ */
+uint8_t is_hash_table_empty(const hash_table_t * const __restrict__ ht) {
+    /* Hash table is empty */
+    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->capacity) || (0 == ht->size)) {
+        return 1;
+    }
+
+    /* Hash table is not empty */
+    return 0;
+}
+
+/**
+ * @brief Function to check if hash table bucket according to key
+ * type value is empty or not.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return uint8_t 0 if hash table bucket is not empty or 1 otherwise
+ */
+uint8_t is_hash_table_bucket_key_empty(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Hast table bucket is empty */
+    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->capacity) || 
+        (0 == ht->size) || (0 == hash_table_count_bucket_elements(ht, key))) {
+        return 1;
+    }
+
+    /* Hash table bucket is not empty */
+    return 0;
+}
+
+/**
+ * @brief Get the current hash table size.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @return size_t SIZE_MAX if hash table is not allocated or
+ * hash table's size.
+ */
+size_t get_hash_table_size(const hash_table_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SIZE_MAX;
+    }
+
+    return ht->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a hash table. Every node
+ * holds its key and its data inline, so the node bytes are the per node
+ * overhead (tree links, cached hash, counters and padding) and the payload
+ * is size * (key_size + data_size). The buckets arrays (and the old buckets
+ * during an incremental rehash) are counted as array bytes.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_memory_usage(const hash_table_t * const __restrict__ ht, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* The hash table object and its black hole node */
+    usage->object_bytes = sizeof(*ht) + sizeof(*ht->nil);
+    usage->payload_bytes = ht->size * (ht->key_size + ht->data_size);
+    usage->array_bytes = ht->capacity * sizeof(*ht->buckets);
+    usage->nodes = ht->size;
+
+    if (NULL != ht->old_buckets) {
+        usage->array_bytes += ht->old_capacity * sizeof(*ht->old_buckets);
+    }
+
+    if (NULL != ht->filter) {
+        scl_memory_usage_t filter_usage;
+        bloom_filter_memory_usage(ht->filter, &filter_usage);
+
+        usage->object_bytes += filter_usage.object_bytes;
+        usage->array_bytes += filter_usage.array_bytes;
+    }
+
+    if (NULL != ht->node_pool) {
+        scl_memory_usage_t pool_usage;
+        mem_pool_memory_usage(ht->node_pool, &pool_usage);
+
+        /* Every node fills one object of the pool, the rest of the object is overhead */
+        usage->object_bytes += pool_usage.object_bytes;
+        usage->node_bytes = pool_usage.node_bytes + pool_usage.payload_bytes - usage->payload_bytes;
+        usage->slack_bytes = pool_usage.slack_bytes;
+    } else {
+        usage->node_bytes = ht->size * (SCL_ALIGN_SIZE(sizeof(*ht->nil)) + SCL_ALIGN_SIZE(ht->key_size) - ht->key_size);
+        usage->slack_bytes = 0;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the operation counters of a hash table, key comparisons, allocations, rotations of the buckets, rehashes and the nodes visited by the searches.
+ * The counters are kept only when the library is built with SCL_STATS.
+ * 
+ * @param ht an allocated hash table object
+ * @param stats pointer to the counters to fill (set to zero without SCL_STATS)
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t hash_table_get_stats(const hash_table_t * const __restrict__ ht, scl_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return SCL_STATS_GET(ht, stats);
+}
+
+/**
+ * @brief Function to set the operation counters of a hash table to zero.
+ * 
+ * @param ht an allocated hash table object
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t hash_table_reset_stats(hash_table_t * const __restrict__ ht) {
+    /* Check if input data is valid */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    return SCL_STATS_RESET(ht);
+}
+
+/**
+ * @brief Function to get the distribution of the keys of a hash table over
+ * its buckets in O(N): the load factor, the size of the largest and of the
+ * mean used bucket, and a histogram of the probe lengths of the keys. A hash
+ * function sending many keys to few buckets shows a skew much greater than 1.
+ * If a skew warning is set and the skew crosses its threshold, the warning
+ * function is called before returning.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param stats pointer to the distribution to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_stats(const hash_table_t * const __restrict__ ht, hash_table_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    hash_table_stats_compute(ht, stats);
+    hash_table_check_skew(ht, stats);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to watch the spread of the keys of a hash table. After
+ * every rehash (and on every call of hash_table_stats) the skew of the
+ * buckets is computed and warn is called if it is greater than threshold,
+ * so a bad hash function is noticed before the buckets turn into deep
+ * trees. A uniform hash keeps the skew below 8 up to millions of keys.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param threshold greatest accepted skew (greater than 0)
+ * @param warn function called with the distribution of the keys (`NULL` to stop watching)
+ * @param arg user argument sent to warn
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_set_skew_warning(hash_table_t * const __restrict__ ht, double threshold, hash_table_skew_func warn, void * const arg) {
+    /* Check if input data is valid */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if ((NULL != warn) && !(threshold > 0)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    ht->skew_warn = warn;
+    ht->skew_arg = arg;
+    ht->skew_threshold = (NULL != warn) ? threshold : 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the current hash table capacity.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @return size_t SIZE_MAX if hash table is not allocated or
+ * hash table's capacity.
+ */
+size_t get_hash_table_capacity(const hash_table_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SIZE_MAX;
+    }
+
+    return ht->capacity;
+}
+
+/**
+ * @brief Helper function to compute the size of one bucket
+ * according to key type value.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to current hash table node to start counting size
+ * @return size_t size of one bucket(red black tree) from hash table
+ */
+static size_t hash_table_count_bucket_elements_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket) {
+    /* Check if node can be counted */
+    if (ht->nil == bucket) {
+        return 0;
+    }
+
+    /* Count current node */
+    size_t total_nodes = 1;
+
+    /* Count nodes from left subtree */
+    total_nodes += hash_table_count_bucket_elements_helper(ht, bucket->left);
+    
+    /* Count nodes from right subtree */
+    total_nodes += hash_table_count_bucket_elements_helper(ht, bucket->right);
+
+    /* Return total count of the all tree(bucket) */
+    return total_nodes;
+}
+
+/**
+ * @brief Helper function to count the nodes of an old bucket that
+ * will be moved into the selected new bucket by an incremental rehash.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to current old hash table node to start counting
+ * @param bucket_index index of the new bucket
+ * @return size_t number of nodes that belong to the new bucket
+ */
+static size_t hash_table_count_pending_elements_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, size_t bucket_index) {
+    /* Check if node can be counted */
+    if (ht->nil == bucket) {
+        return 0;
+    }
+
+    /* Count current node if it belongs to the new bucket */
+    size_t total_nodes = (hash_table_bucket_index(bucket->hash, ht->capacity) == bucket_index);
+
+    /* Count nodes from left and right subtrees */
+    total_nodes += hash_table_count_pending_elements_helper(ht, bucket->left, bucket_index);
+    total_nodes += hash_table_count_pending_elements_helper(ht, bucket->right, bucket_index);
+
+    return total_nodes;
+}
+
+/**
+ * @brief Function to compute the size of one bucket according to key type
+ * value. Bucket index is computed with hashing function of the current
+ * hast table.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return size_t SIZE_MAX if hash table is not valid or size of desired bucket
+ */
+size_t hash_table_count_bucket_elements(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || (NULL == ht->buckets)) {
+        return SIZE_MAX;
+    }
+
+    /* Compute the hash of the key */
+    size_t key_hash = ht->hash(key);
+    size_t bucket_index = hash_table_bucket_index(key_hash, ht->capacity);
+
+    /* Compute the size of the bucket */
+    size_t total_nodes = hash_table_count_bucket_elements_helper(ht, ht->buckets[bucket_index]);
+
+    /* Count the nodes still waiting in the old bucket */
+    if (NULL != ht->old_buckets) {
+        total_nodes += hash_table_count_pending_elements_helper(ht, ht->old_buckets[hash_table_bucket_index(key_hash, ht->old_capacity)], bucket_index);
+    }
+
+    return total_nodes;
+}
+
+/**
+ * @brief Function to find minimum node from a bucket(red black tree) starting
+ * from root(subtree), this function is a subroutine to delete data from a hash
+ * table bucket.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to current hash table node to start finding minimum node
+ * @return hash_table_node_t* pointer to minimum node starting from root subtree
+ */
+static hash_table_node_t* hash_table_root_min_node(const hash_table_t * const __restrict__ ht, hash_table_node_t * __restrict__ bucket) {
+    /* Check if root node has minimum */
+    if (ht->nil != bucket) {
+
+        /* Find minimum node starting from root */
+        while (ht->nil != bucket->left) {
+            bucket = bucket->left;
+        }
+    }
+
+    /* Return minimum node */
+    return bucket;
+}
+
+/**
+ * @brief Function to swap two nodes from a hash table bucket.
+ * This function MUST NOT be used by users, because it will
+ * break the proprety of red-black tree, it is a subroutine
+ * program of delete function to change data of the current node
+ * with its inorder successor.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket_index index of the working red black tree from hash table
+ * @param dest_node hash table node object to rewrite data bytes from src_node
+ * @param src_node hash table node object to copy data bytes
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_swap_nodes(const hash_table_t * const __restrict__ ht, size_t bucket_index, hash_table_node_t * __restrict__ const dest_node, hash_table_node_t * __restrict__ const src_node) {
+    /* Check if swap is posible */
+    if ((ht->nil == dest_node) || (ht->nil == src_node)) {
+        return SCL_CANNOT_SWAP_DATA;
+    }
+
+    /* Change color of nodes */
+    hash_table_node_color_t temp_color = dest_node->color;
+    dest_node->color = src_node->color;
+    src_node->color = temp_color;
+
+    /* Source node is the right child of the destination node */
+    if (dest_node->right == src_node) {
+        hash_table_node_t *dest_left = dest_node->left;
+        hash_table_node_t *dest_parent = dest_node->parent;
+
+        /* Destination node takes the children of the source node */
+        dest_node->left = src_node->left;
+        dest_node->right = src_node->right;
+        dest_node->parent = src_node;
+
+        if (ht->nil != dest_node->left) {
+            dest_node->left->parent = dest_node;
+        }
+
+        if (ht->nil != dest_node->right) {
+            dest_node->right->parent = dest_node;
+        }
+
+        /* Source node takes the place of the destination node */
+        src_node->left = dest_left;
+        src_node->right = dest_node;
+        src_node->parent = dest_parent;
+
+        if (ht->nil != src_node->left) {
+            src_node->left->parent = src_node;
+        }
+
+        if (ht->nil != dest_parent) {
+            if (dest_parent->left == dest_node) {
+                dest_parent->left = src_node;
+            } else {
+                dest_parent->right = src_node;
+            }
+        } else {
+            ht->buckets[bucket_index] = src_node;
+        }
+
+        /* All good */
+        return SCL_OK;
+    }
+
+    /* Interchange the right child */
+
+    hash_table_node_t *temp = dest_node->right;
+
+    dest_node->right = src_node->right;
+
+    if (ht->nil != dest_node->right) {
+        dest_node->right->parent = dest_node;
+    }
+
+    src_node->right = temp;
+
+    if (ht->nil != src_node->right) {
+        src_node->right->parent = src_node;
+    }
+
+    /* Interchange the left child */
+
+    temp = dest_node->left;
+
+    dest_node->left = src_node->left;
+
+    if (ht->nil != dest_node->left) {
+        dest_node->left->parent = dest_node;
+    }
+
+    src_node->left = temp;
+
+    if (ht->nil != src_node->left) {
+        src_node->left->parent = src_node;
+    }
+
+    /* Interchange parents of the two nodes */
+
+    temp = dest_node->parent;
+
+    dest_node->parent = src_node->parent;
+
+    if (ht->nil != dest_node->parent) {
+        if (dest_node->parent->left == src_node) {
+            dest_node->parent->left = dest_node;
+        } else {
+            dest_node->parent->right = dest_node;
+        }
+    } else {
+        ht->buckets[bucket_index] = dest_node;
+    }
+
+    src_node->parent = temp;
+
+    if (ht->nil != src_node->parent) {
+        if (src_node->parent->left == dest_node) {
+            src_node->parent->left = src_node;
+        } else {
+            src_node->parent->right = src_node;
+        }
+    } else {
+        ht->buckets[bucket_index] = src_node;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Subroutine function to fix one bucket after one node was deleted from
+ * the same bucket, the bucket will be fixed as a red black tree.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket_index index of the working red black tree(bucket) from hash table
+ * to fix after deletion of one hash table node
+ * @param fix_node pointer to a hash table node (red black node) to start fixing
+ * @param parent_fix_node parent pointer to a hash table node (red black node) to start fixing
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_delete_fix_node_up(const hash_table_t * const __restrict__ ht, size_t bucket_index, hash_table_node_t *fix_node, hash_table_node_t *parent_fix_node) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Deleted node was the root, just make sure the new root is black */
+    if (ht->nil == parent_fix_node) {
+        ht->buckets[bucket_index]->color = HASH_BLACK;
+        return SCL_OK;
+    }
+
+    /* Set the brother of the double black node */
+    hash_table_node_t *brother_node = ht->nil;
+
+    /* Fix the red-black tree(bucket) */
+    while ((ht->buckets[bucket_index] != fix_node) && (HASH_BLACK == fix_node->color)) {
+        if (parent_fix_node->left == fix_node) {
+
+            /* Double black node is a left child */
+
+            /* Find the brother node */
+            brother_node = parent_fix_node->right;
+
+            if (HASH_RED == brother_node->color) {
+
+                /* Case 1: brother is a red node */
+
+                /* Recolor the nodes */
+                brother_node->color = HASH_BLACK;
+                parent_fix_node->color = HASH_RED;
+
+                /* Rotate the parent to the left */
+                hash_table_rotate_left(ht, bucket_index, parent_fix_node);
+
+                /* Update the brother node */
+                brother_node = parent_fix_node->right;
+            }
+
+            if ((HASH_BLACK == brother_node->left->color) && (HASH_BLACK == brother_node->right->color)) {
+
+                /* Case 2: brother is a black node and its children are black */
+
+                /* Recolor the brother node */
+                brother_node->color = HASH_RED;
+
+                /* Propagate the double black problem in higher hierarchy */
+                fix_node = parent_fix_node;
+                parent_fix_node = fix_node->parent;
+            } else {
+                if (HASH_BLACK == brother_node->right->color) {
+
+                    /* Case 3: brother node is black, left child is red and right is black */
+
+                    /* Recolor nodes */
+                    brother_node->left->color = HASH_BLACK;
+                    brother_node->color = HASH_RED;
+
+                    /* Rotate brother to the right */
+                    hash_table_rotate_right(ht, bucket_index, brother_node);
+                    
+                    /* Update the new brother */
+                    brother_node = parent_fix_node->right;
+                }
+
+                /* Case 4: brother node is black and right child is red */
+
+                /* Recolor the nodes */
+                brother_node->color = parent_fix_node->color;
+                parent_fix_node->color = HASH_BLACK;
+                brother_node->right->color = HASH_BLACK;
+
+                /* Rotate parent node to left */
+                hash_table_rotate_left(ht, bucket_index, parent_fix_node);
+
+                /* Tree(bucket) is fixed */
+                fix_node = ht->buckets[bucket_index];
+            }
+        } else {
+
+            /* Double black node is a right child */
+
+            /* Find the brother node */
+            brother_node = parent_fix_node->left;
+
+            if (HASH_RED == brother_node->color) {
+
+                /* Case 1: brother is a red node */
+
+                /* Recolor the nodes */
+                brother_node->color = HASH_BLACK;
+                parent_fix_node->color = HASH_RED;
+
+                /* Rotate the parent to the right */
+                hash_table_rotate_right(ht, bucket_index, parent_fix_node);
+
+                /* Update the brother node */
+                brother_node = parent_fix_node->left;
+            }
+
+            if ((HASH_BLACK == brother_node->right->color) && (HASH_BLACK == brother_node->left->color)) {
+
+                /* Case 2: brother is a black node and its children are black */
+
+                /* Recolor the brother node */
+                brother_node->color = HASH_RED;
+
+                /* Propagate the double black problem in higher hierarchy */
+                fix_node = parent_fix_node;
+                parent_fix_node = fix_node->parent;
+            } else {
+                if (HASH_BLACK == brother_node->left->color) {
+
+                    /* Case 3: brother node is black, right child is red and left is black */
+
+                    /* Recolor nodes */
+                    brother_node->right->color = HASH_BLACK;
+                    brother_node->color = HASH_RED;
+
+                    /* Rotate brother to the left */
+                    hash_table_rotate_left(ht, bucket_index, brother_node);
+
+                    /* Update the new brother */
+                    brother_node = parent_fix_node->left;
+                }
+
+                /* Case 4: brother node is black and right child is red */
+
+                /* Recolor the nodes */
+                brother_node->color = parent_fix_node->color;
+                parent_fix_node->color = HASH_BLACK;
+                brother_node->left->color = HASH_BLACK;
+
+                /* Rotate parent node to right */
+                hash_table_rotate_right(ht, bucket_index, parent_fix_node);
+
+                /* Tree(Bucket) is fixed */
+                fix_node = ht->buckets[bucket_index];
+            }
+        }
+    }
+
+    /* Recolor the root(first node from bucket) as BLACK */
+    fix_node->color = HASH_BLACK;
+
+    /* All good, go to sleep */
+    return SCL_OK;
+}
+
+/**
+ * @brief Helper function to remove one node from its bucket and to fix
+ * the red black tree of the bucket. The node MUST be in the new buckets
+ * array (the old bucket of its key is moved before).
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket_index index of the bucket of the node
+ * @param delete_node pointer to the hash table node to remove
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_delete_node(hash_table_t * __restrict__ const ht, size_t bucket_index, hash_table_node_t *delete_node) {
+    /* Node has two children swap with it's inorder successor and delete successor */
+    if ((ht->nil != delete_node->left) && (ht->nil != delete_node->right)) {
+
+        /* Find a replacement for selected node */
+        hash_table_node_t *delete_succecessor = hash_table_root_min_node(ht, delete_node->right);
+                
+        /* Replace the selected red-black(hash table) node and remove the dublicate */
+        scl_error_t err = hash_table_swap_nodes(ht, bucket_index, delete_node, delete_succecessor);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* Variable to check if fixing is needed */
+    uint8_t need_fixing_tree = 1;
+
+    /* Set the child of the deleted node */
+    hash_table_node_t *delete_node_child = ht->nil;
+
+    /* Delete node has only one child */
+    if (ht->nil != delete_node->left) {
+        delete_node_child = delete_node->left;
+
+        /* Check if deletion will not make a double black exception */
+        if ((HASH_RED == delete_node_child->color) && (HASH_BLACK == delete_node->color)) {
+            need_fixing_tree = 0;
+
+            /* Recolor red node into a red one */
+            delete_node_child->color = HASH_BLACK;
+        }
+
+        /* Update child with it's grandparent */
+        delete_node_child->parent = delete_node->parent;
+
+        /* Update grandparent with it's grandchild */
+        if (ht->nil != delete_node->parent) {
+            if (delete_node->parent->right == delete_node) {
+                delete_node->parent->right = delete_node_child;
+            } else {
+                delete_node->parent->left = delete_node_child;
+            }
+        } else {
+
+            /*
+             * Selected node was root
+             * Update a new root
+             */            
+            ht->buckets[bucket_index] = delete_node_child;
+        }
+    } else if (ht->nil != delete_node->right) {
+        delete_node_child = delete_node->right;
+
+        /* Check if deletion will not make a double black exception */
+        if ((HASH_RED == delete_node_child->color) && (HASH_BLACK == delete_node->color)) {
+            need_fixing_tree = 0;
+
+            /* Recolor red node into a red one */
+            delete_node_child->color = HASH_BLACK;
+        }
+
+        /* Update child with it's grandparent */
+        delete_node_child->parent = delete_node->parent;
+
+        /* Update grandparent with it's grandchild */
+        if (ht->nil != delete_node->parent) {
+            if (delete_node->parent->right == delete_node) {
+                delete_node->parent->right = delete_node_child;
+            } else {
+                delete_node->parent->left = delete_node_child;
+            }
+        } else {
+
+            /*
+             * Selected node was root
+             * Update a new root
+             */
+            ht->buckets[bucket_index] = delete_node_child;
+        }
+    } else {
+
+        /* Check if deletion will not make a double black exception */ 
+        if (HASH_RED == delete_node->color) {
+            need_fixing_tree = 0;
+        }
+
+        // Update parent's links to nil node
+        if (ht->nil != delete_node->parent) {
+            if (delete_node->parent->right == delete_node) {
+                delete_node->parent->right = ht->nil;
+            } else {
+                delete_node->parent->left = ht->nil;
+            }
+        } else {
+
+            /*
+             * Selected node was root
+             * Update a new root
+             */
+            ht->buckets[bucket_index] = ht->nil;
+        }
+    }
+
+    hash_table_node_t *parent_delete_node = delete_node->parent;
+
+    /* Free node memory from hash table */
+    free_hash_table_node(ht, &delete_node);
+
+    /* Deacrease tree size  */
+    --(ht->size);
+
+    scl_error_t err = SCL_OK;
+
+    /* Check if fixing is needed */
+    if (0 != need_fixing_tree) {
+        err = hash_table_delete_fix_node_up(ht, bucket_index, delete_node_child, parent_delete_node);
+    }
+
+    /* Rebuild the filter once half of its keys are removed */
+    hash_table_refresh_bloom_filter(ht);
+
+    /* Deletion went successfully, or not */
+    return err;
+}
+
+/**
+ * @brief Helper function to delete one pair {key, data} when the hash value
+ * of the key is already computed. Input is considered valid.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_delete_key_data_hashed(hash_table_t * __restrict__ const ht, size_t key_hash, const void * const key, const void * const data) {
+    /* Move the pending old bucket of the key */
+    hash_table_rehash_hash(ht, key_hash);
+
+    /* Compute the bucket index to insert pair */
+    size_t bucket_index = hash_table_bucket_index(key_hash, ht->capacity);
+
+    /* Check if there exists at least data to search */
+    if (ht->nil == ht->buckets[bucket_index]) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* Find node to delete */
+    hash_table_node_t *delete_node = hash_table_find_node_hashed(ht, key_hash, key);
+
+    /* Delete node is not in the current working bucket */
+    if ((ht->nil == delete_node) || (0 != ht->cmp_dt(delete_node->data, data))) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    /* Remove the node from the bucket */
+    return hash_table_delete_node(ht, bucket_index, delete_node);
+}
+
+/**
+ * @brief Function to delete one pair {key, data} from current working
+ * hash table if it exists, function will throw an error if pair does not
+ * exists in the hash table.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_delete_key_data(hash_table_t * __restrict__ const ht, const void * const key, const void * const data) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table buckets are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data type pointer is valid */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Delete the pair using the hash of the key */
+    return hash_table_delete_key_data_hashed(ht, ht->hash(key), key, data);
+}
+
+/**
+ * @brief Function to delete one pair {key, data} when the hash value of the
+ * key is already known, so the key is not hashed again. The key_hash MUST be
+ * the value returned by the hash function of the hash table for the key.
+ * See hash_table_delete_key_data function.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_delete_key_data_with_hash(hash_table_t * __restrict__ const ht, size_t key_hash, const void * const key, const void * const data) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table buckets are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data type pointer is valid */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Delete the pair using the known hash */
+    return hash_table_delete_key_data_hashed(ht, key_hash, key, data);
+}
+
+/**
+ * @brief Function to delete one bucket from hash table
+ * correspondent to hash function of the key data type value.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_delete_hash(hash_table_t * __restrict__ const ht, const void * const __restrict__ key) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Compute the hash of the key just once */
+    size_t key_hash = ht->hash(key);
+
+    /* Move the pending old bucket of the key */
+    hash_table_rehash_hash(ht, key_hash);
+
+    /* Compute bucket index of the key data value */
+    size_t bucket_index = hash_table_bucket_index(key_hash, ht->capacity);
+
+    /* Check if we can delete at least one data from bucket */
+    if (ht->nil == ht->buckets[bucket_index]) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
     }
 
-    /* Set the brother of the double black node */
-    hash_table_node_t *brother_node = ht->nil;
+    /* Compute the size of the selected bucket */
+    size_t delete_size = hash_table_count_bucket_elements(ht, key);
 
-    /* Fix the red-black tree(bucket) */
-    while ((ht->buckets[bucket_index] != fix_node) && (HASH_BLACK == fix_node->color)) {
-        if (parent_fix_node->left == fix_node) {
+    /* The size of the selected bucket was not computed well */
+    if (SIZE_MAX == delete_size) {
+        return SCL_INVALID_INPUT;
+    }
 
-            /* Double black node is a left child */
+    /* Update the size of the hash */
+    ht->size -= delete_size;
 
-            /* Find the brother node */
-            brother_node = parent_fix_node->right;
+    /* Free entire bucket from memory */
+    free_hash_table_helper(ht, &ht->buckets[bucket_index]);
 
-            if (HASH_RED == brother_node->color) {
+    /* All good */
+    return SCL_OK;
+}
 
-                /* Case 1: brother is a red node */
+/**
+ * @brief Helper function to delete the first occurence of the key type value
+ * when the hash value of the key is already computed. Input is considered
+ * valid.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of a node
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_delete_key_hashed(hash_table_t * __restrict__ const ht, size_t key_hash, const void * const __restrict__ key) {
+    /* Move the pending old bucket of the key */
+    hash_table_rehash_hash(ht, key_hash);
 
-                /* Recolor the nodes */
-                brother_node->color = HASH_BLACK;
-                parent_fix_node->color = HASH_RED;
+    /* Find node to delete */
+    hash_table_node_t *delete_node = hash_table_find_node_hashed(ht, key_hash, key);
 
-                /* Rotate the parent to the left */
-                hash_table_rotate_left(ht, bucket_index, parent_fix_node);
+    /* Delete node is not in the current working bucket */
+    if (ht->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
 
-                /* Update the brother node */
-                brother_node = parent_fix_node->right;
-            }
+    /* Remove the node from the bucket */
+    return hash_table_delete_node(ht, hash_table_bucket_index(key_hash, ht->capacity), delete_node);
+}
 
-            if ((HASH_BLACK == brother_node->left->color) && (HASH_BLACK == brother_node->right->color)) {
+/**
+ * @brief Function to delete the first occurence of the key type value
+ * from the hash table, if data was not found in the hash table an error will
+ * be thrown.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_delete_key(hash_table_t * __restrict__ const ht, const void * const __restrict__ key) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
 
-                /* Case 2: brother is a black node and its children are black */
+    /* Check if has table buckets are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
 
-                /* Recolor the brother node */
-                brother_node->color = HASH_RED;
+    /* Check if data type value pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
 
-                /* Propagate the double black problem in higher hierarchy */
-                fix_node = parent_fix_node;
-            } else {
-                if (HASH_BLACK == brother_node->right->color) {
+    /* Delete the key using its hash */
+    return hash_table_delete_key_hashed(ht, ht->hash(key), key);
+}
 
-                    /* Case 3: brother node is black, left child is red and right is black */
+/**
+ * @brief Function to delete the first occurence of the key type value
+ * when the hash value of the key is already known, so the key is not hashed
+ * again. The key_hash MUST be the value returned by the hash function of the
+ * hash table for the key. See hash_table_delete_key function.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key_hash hash value of the key
+ * @param key pointer to a location of a value representing key of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_delete_key_with_hash(hash_table_t * __restrict__ const ht, size_t key_hash, const void * const __restrict__ key) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
 
-                    /* Recolor nodes */
-                    brother_node->left->color = HASH_BLACK;
-                    brother_node->color = HASH_RED;
+    /* Check if has table buckets are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
 
-                    /* Rotate brother to the right */
-                    hash_table_rotate_right(ht, bucket_index, brother_node);
-                    
-                    /* Update the new brother */
-                    brother_node = parent_fix_node->right;
-                }
+    /* Check if data type value pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
 
-                /* Case 4: brother node is black and right child is red */
+    /* Delete the key using the known hash */
+    return hash_table_delete_key_hashed(ht, key_hash, key);
+}
 
-                /* Recolor the nodes */
-                brother_node->color = parent_fix_node->color;
-                parent_fix_node->color = HASH_BLACK;
-                brother_node->right->color = HASH_BLACK;
+/**
+ * @brief Helper function for hash_table_bucket_traverse_inorder function.
+ * This method will iterate through all nodes by Left-Root-Right
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket starting point of the red-black tree(bucket) traversal
+ * @param action a pointer function to perform an action on one hash table node object
+ */
+static void hash_table_bucket_traverse_inorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
+    /* Check if current working node is not `nil` */
+    if (ht->nil == bucket) {
+        return;
+    }
 
-                /* Rotate parent node to left */
-                hash_table_rotate_left(ht, bucket_index, parent_fix_node);
+    const hash_table_node_t *iterator = bucket;
 
-                /* Tree(bucket) is fixed */
-                fix_node = ht->buckets[bucket_index];
+    while (ht->nil != iterator->left) {
+        iterator = iterator->left;
+    }
+
+    while (ht->nil != iterator) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (ht->nil != iterator->right) {
+
+            /* The next node is the leftmost node of the right sub-tree */
+            iterator = iterator->right;
+
+            while (ht->nil != iterator->left) {
+                iterator = iterator->left;
             }
         } else {
 
-            /* Double black node is a right child */
+            /* The next node is the first ancestor reached from its left sub-tree */
+            while ((bucket != iterator) && (iterator->parent->right == iterator)) {
+                iterator = iterator->parent;
+            }
 
-            /* Find the brother node */
-            brother_node = parent_fix_node->left;
+            iterator = (bucket == iterator) ? ht->nil : iterator->parent;
+        }
+    }
+}
 
-            if (HASH_RED == brother_node->color) {
+/**
+ * @brief Function to perform one action on one bucket, according
+ * to bucket_index. Usually action will be a printing function, however
+ * you can define a map function to map every node data to another
+ * node data (the mapping proccess has to be injective to preserve the
+ * red black tree proprety).
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket_index index of the working red black tree(bucket) from hash table
+ * @param action a pointer function to perform an action on one hash table node object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_bucket_traverse_inorder(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
 
-                /* Case 1: brother is a red node */
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
 
-                /* Recolor the nodes */
-                brother_node->color = HASH_BLACK;
-                parent_fix_node->color = HASH_RED;
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
 
-                /* Rotate the parent to the right */
-                hash_table_rotate_right(ht, bucket_index, parent_fix_node);
+    /* Make sure that bucket index does not exceed hash capacity */
+    bucket_index = bucket_index & (ht->capacity - 1);
 
-                /* Update the brother node */
-                brother_node = parent_fix_node->left;
-            }
+    printf("(%ld): ", bucket_index);
 
-            if ((HASH_BLACK == brother_node->right->color) && (HASH_BLACK == brother_node->left->color)) {
+    if (ht->nil == ht->buckets[bucket_index]) {
 
-                /* Case 2: brother is a black node and its children are black */
+        /* Tree(Bucket) is empty no node to traverse */
+        printf("(Null)");
+    }
+    else {
 
-                /* Recolor the brother node */
-                brother_node->color = HASH_RED;
+        /* Call helper function and traverse all nodes */
+        hash_table_bucket_traverse_inorder_helper(ht, ht->buckets[bucket_index], action);
+    }
 
-                /* Propagate the double black problem in higher hierarchy */
-                fix_node = parent_fix_node;
-            } else {
-                if (HASH_BLACK == brother_node->left->color) {
+    /* All good */
+    return SCL_OK;
+}
 
-                    /* Case 3: brother node is black, right child is red and left is black */
+/**
+ * @brief Function to perform one action on entire hash table, according
+ * to bucket_index. Usually action will be a printing function, however
+ * you can define a map function to map every node data to another
+ * node data (the mapping proccess has to be injective to preserve the
+ * red black tree proprety).
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param action a pointer function to perform an action on one hash table node object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_traverse_inorder(const hash_table_t * const __restrict__ ht, action_func action) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
 
-                    /* Recolor nodes */
-                    brother_node->right->color = HASH_BLACK;
-                    brother_node->color = HASH_RED;
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
 
-                    /* Rotate brother to the left */
-                    hash_table_rotate_left(ht, bucket_index, brother_node);
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
 
-                    /* Update the new brother */
-                    brother_node = parent_fix_node->left;
-                }
+    /* Traverse every bucket and perform actions */
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        
+        /* Perform action on one bucket */
+        scl_error_t err = hash_table_bucket_traverse_inorder(ht, iter, action);
+        
+        printf("\n");
+
+        /* Something went wrong exit the function */
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* Traverse the old buckets that were not moved yet */
+    if (NULL != ht->old_buckets) {
+        for (size_t iter = 0; iter < ht->old_capacity; ++iter) {
+            if (ht->nil != ht->old_buckets[iter]) {
+                printf("(old %ld): ", iter);
+
+                /* Perform action on one old bucket */
+                hash_table_bucket_traverse_inorder_helper(ht, ht->old_buckets[iter], action);
+
+                printf("\n");
+            }
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Helper function for hash_table_bucket_traverse_preorder function.
+ * This method will iterate through all nodes by Root-Left-Right
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket starting point of the red-black tree(bucket) traversal
+ * @param action a pointer function to perform an action on one hash table node object
+ */
+static void hash_table_bucket_traverse_preorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
+    const hash_table_node_t *iterator = bucket;
 
-                /* Case 4: brother node is black and right child is red */
+    while (ht->nil != iterator) {
 
-                /* Recolor the nodes */
-                brother_node->color = parent_fix_node->color;
-                parent_fix_node->color = HASH_BLACK;
-                brother_node->left->color = HASH_BLACK;
+        /* Call action function */
+        action(iterator->data);
 
-                /* Rotate parent node to right */
-                hash_table_rotate_right(ht, bucket_index, parent_fix_node);
+        if (ht->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (ht->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
 
-                /* Tree(Bucket) is fixed */
-                fix_node = ht->buckets[bucket_index];
+            /* Climb to the first ancestor with a right sub-tree not visited yet */
+            while ((bucket != iterator) && ((iterator->parent->right == iterator) || (ht->nil == iterator->parent->right))) {
+                iterator = iterator->parent;
             }
+
+            iterator = (bucket == iterator) ? ht->nil : iterator->parent->right;
         }
     }
-
-    /* Recolor the root(first node from bucket) as BLACK */
-    fix_node->color = HASH_BLACK;
-
-    /* All good, go to sleep */
-    return SCL_OK;
 }
 
 /**
- * @brief Function to delete one pair {key, data} from current working
- * hash table if it exists, function will throw an error if pair does not
- * exists in the hash table.
+ * @brief Function to perform one action on one bucket, according
+ * to bucket_index. Usually action will be a printing function, however
+ * you can define a map function to map every node data to another
+ * node data (the mapping proccess has to be injective to preserve the
+ * red black tree proprety).
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of the hash
- * @param data pointer to a location of a value representing data of a node
+ * @param bucket_index index of the working red black tree(bucket) from hash table
+ * @param action a pointer function to perform an action on one hash table node object
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_delete_key_data(hash_table_t * __restrict__ const ht, const void * const key, const void * const data) {
+scl_error_t hash_table_bucket_traverse_preorder(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
     /* Check if hash table is allocated */
     if (NULL == ht) {
         return SCL_NULL_HASH_TABLE;
     }
 
-    /* Check if hash table buckets are allocated */
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    /* Check if hash table roots are allocated */
     if (NULL == ht->buckets) {
         return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Check if key type pointer is valid */
-    if (NULL == key) {
-        return SCL_INVALID_KEY;
+    /* Make sure that bucket index does not exceed hash capacity */
+    bucket_index = bucket_index & (ht->capacity - 1);
+
+    printf("(%ld): ", bucket_index);
+
+    if (ht->nil == ht->buckets[bucket_index]) {
+
+        /* Tree(Bucket) is empty no node to traverse */
+        printf("(Null)");
     }
+    else {
 
-    /* Check if data type pointer is valid */
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
+        /* Call helper function and traverse all nodes */
+        hash_table_bucket_traverse_preorder_helper(ht, ht->buckets[bucket_index], action);
     }
 
-    /* Compute the bucket index to insert pair */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    /* All good */
+    return SCL_OK;
+}
 
-    /* Check if there exists at least data to search */
-    if (ht->nil == ht->buckets[bucket_index]) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
+/**
+ * @brief Function to perform one action on entire hash table, according
+ * to bucket_index. Usually action will be a printing function, however
+ * you can define a map function to map every node data to another
+ * node data (the mapping proccess has to be injective to preserve the
+ * red black tree proprety).
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param action a pointer function to perform an action on one hash table node object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_traverse_preorder(const hash_table_t * const __restrict__ ht, action_func action) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
     }
 
-    /* Find node to delete */
-    hash_table_node_t *delete_node = hash_table_find_node(ht, key);
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
 
-    /* Delete node is not in the current working bucket */
-    if ((ht->nil == delete_node) || (0 != ht->cmp_dt(delete_node->data, data))) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Node has two children swap with it's inorder successor and delete successor */
-    if ((ht->nil != delete_node->left) && (ht->nil != delete_node->right)) {
+    /* Traverse every bucket and perform actions */
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
 
-        /* Find a replacement for selected node */
-        hash_table_node_t *delete_succecessor = hash_table_root_min_node(ht, delete_node->right);
-                
-        /* Replace the selected red-black(hash table) node and remove the dublicate */
-        scl_error_t err = hash_table_swap_nodes(ht, bucket_index, delete_node, delete_succecessor);
+        /* Perform action on one bucket */
+        scl_error_t err = hash_table_bucket_traverse_preorder(ht, iter, action);
+
+        printf("\n");
 
+        /* Something went wrong exit the function */
         if (SCL_OK != err) {
             return err;
         }
     }
 
-    /* Variable to check if fixing is needed */
-    uint8_t need_fixing_tree = 1;
-
-    /* Set the child of the deleted node */
-    hash_table_node_t *delete_node_child = ht->nil;
-
-    /* Delete node has only one child */
-    if (ht->nil != delete_node->left) {
-        delete_node_child = delete_node->left;
+    /* Traverse the old buckets that were not moved yet */
+    if (NULL != ht->old_buckets) {
+        for (size_t iter = 0; iter < ht->old_capacity; ++iter) {
+            if (ht->nil != ht->old_buckets[iter]) {
+                printf("(old %ld): ", iter);
 
-        /* Check if deletion will not make a double black exception */
-        if ((HASH_RED == delete_node_child->color) && (HASH_BLACK == delete_node->color)) {
-            need_fixing_tree = 0;
+                /* Perform action on one old bucket */
+                hash_table_bucket_traverse_preorder_helper(ht, ht->old_buckets[iter], action);
 
-            /* Recolor red node into a red one */
-            delete_node_child->color = HASH_BLACK;
+                printf("\n");
+            }
         }
+    }
 
-        /* Update child with it's grandparent */
-        delete_node_child->parent = delete_node->parent;
+    /* All good */
+    return SCL_OK;
+}
 
-        /* Update grandparent with it's grandchild */
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = delete_node_child;
-            } else {
-                delete_node->parent->left = delete_node_child;
-            }
+/**
+ * @brief Helper function to find the first node of a subtree in
+ * postorder (the deepest node reached by going left whenever possible).
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket root of a subtree
+ * @return const hash_table_node_t* the first node of the subtree in postorder
+ */
+static const hash_table_node_t* hash_table_bucket_traverse_postorder_first(const hash_table_t * const __restrict__ ht, const hash_table_node_t *bucket) {
+    while (1) {
+        if (ht->nil != bucket->left) {
+            bucket = bucket->left;
+        } else if (ht->nil != bucket->right) {
+            bucket = bucket->right;
         } else {
-
-            /*
-             * Selected node was root
-             * Update a new root
-             */            
-            ht->buckets[bucket_index] = delete_node_child;
+            return bucket;
         }
-    } else if (ht->nil != delete_node->right) {
-        delete_node_child = delete_node->right;
+    }
+}
 
-        /* Check if deletion will not make a double black exception */
-        if ((HASH_RED == delete_node_child->color) && (HASH_BLACK == delete_node->color)) {
-            need_fixing_tree = 0;
+/**
+ * @brief Helper function for hash_table_bucket_traverse_postorder function.
+ * This method will iterate through all nodes by Left-Right-Root
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket starting point of the red-black tree(bucket) traversal
+ * @param action a pointer function to perform an action on one hash table node object
+ */
+static void hash_table_bucket_traverse_postorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
+    /* Check if current working node is not `nil` */
+    if (ht->nil == bucket) {
+        return;
+    }
 
-            /* Recolor red node into a red one */
-            delete_node_child->color = HASH_BLACK;
-        }
+    const hash_table_node_t *iterator = hash_table_bucket_traverse_postorder_first(ht, bucket);
 
-        /* Update child with it's grandparent */
-        delete_node_child->parent = delete_node->parent;
+    while (1) {
 
-        /* Update grandparent with it's grandchild */
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = delete_node_child;
-            } else {
-                delete_node->parent->left = delete_node_child;
-            }
-        } else {
+        /* Call action function */
+        action(iterator->data);
 
-            /*
-             * Selected node was root
-             * Update a new root
-             */
-            ht->buckets[bucket_index] = delete_node_child;
+        if (bucket == iterator) {
+            break;
         }
-    } else {
 
-        /* Check if deletion will not make a double black exception */ 
-        if (HASH_RED == delete_node->color) {
-            need_fixing_tree = 0;
-        }
+        /* After a left child comes the right sub-tree of the parent, then the parent */
+        const hash_table_node_t *parent = iterator->parent;
 
-        // Update parent's links to nil node
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = ht->nil;
-            } else {
-                delete_node->parent->left = ht->nil;
-            }
+        if ((parent->left == iterator) && (ht->nil != parent->right)) {
+            iterator = hash_table_bucket_traverse_postorder_first(ht, parent->right);
         } else {
-
-            /*
-             * Selected node was root
-             * Update a new root
-             */
-            ht->buckets[bucket_index] = ht->nil;
+            iterator = parent;
         }
     }
-
-    hash_table_node_t *parent_delete_node = delete_node->parent;
-
-    /* Free node memory from hash table */
-    free_hash_table_node(ht, &delete_node);
-
-    /* Deacrease tree size  */
-    --(ht->size);
-
-    /* Check if fixing is needed */
-    if (0 != need_fixing_tree) {
-        return hash_table_delete_fix_node_up(ht, bucket_index, delete_node_child, parent_delete_node);
-    }
-
-    /* Deletion went successfully */
-    return SCL_OK;
 }
 
 /**
- * @brief Function to delete one bucket from hash table
- * correspondent to hash function of the key data type value.
+ * @brief Function to perform one action on one bucket, according
+ * to bucket_index. Usually action will be a printing function, however
+ * you can define a map function to map every node data to another
+ * node data (the mapping proccess has to be injective to preserve the
+ * red black tree proprety).
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of the hash
+ * @param bucket_index index of the working red black tree(bucket) from hash table
+ * @param action a pointer function to perform an action on one hash table node object
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_delete_hash(hash_table_t * __restrict__ const ht, const void * const __restrict__ key) {
+scl_error_t hash_table_bucket_traverse_postorder(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
     /* Check if hash table is allocated */
     if (NULL == ht) {
         return SCL_NULL_HASH_TABLE;
     }
 
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
     /* Check if hash table roots are allocated */
     if (NULL == ht->buckets) {
         return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Check if key type pointer is valid */
-    if (NULL == key) {
-        return SCL_INVALID_KEY;
-    }
+    /* Make sure that bucket index does not exceed hash capacity */
+    bucket_index = bucket_index & (ht->capacity - 1);
 
-    /* Compute bucket index of the key data value */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    printf("(%ld): ", bucket_index);
 
-    /* Check if we can delete at least one data from bucket */
     if (ht->nil == ht->buckets[bucket_index]) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
-    }
-
-    /* Compute the size of the selected bucket */
-    size_t delete_size = hash_table_count_bucket_elements(ht, key);
 
-    /* The size of the selected bucket was not computed well */
-    if (SIZE_MAX == delete_size) {
-        return SCL_INVALID_INPUT;
+        /* Tree(Bucket) is empty no node to traverse */
+        printf("(Null)");
     }
+    else {
 
-    /* Update the size of the hash */
-    ht->size -= delete_size;
-
-    /* Free entire bucket from memory */
-    free_hash_table_helper(ht, &ht->buckets[bucket_index]);
+        /* Call helper function and traverse all nodes */
+        hash_table_bucket_traverse_postorder_helper(ht, ht->buckets[bucket_index], action);
+    }
 
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function to delete the first occurence of the key type value
- * from the hash table, if data was not found in the hash table an error will
- * be thrown.
+ * @brief Function to perform one action on entire hash table, according
+ * to bucket_index. Usually action will be a printing function, however
+ * you can define a map function to map every node data to another
+ * node data (the mapping proccess has to be injective to preserve the
+ * red black tree proprety).
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of a node
+ * @param action a pointer function to perform an action on one hash table node object
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_delete_key(hash_table_t * __restrict__ const ht, const void * const __restrict__ key) {
+scl_error_t hash_table_traverse_postorder(const hash_table_t * const __restrict__ ht, action_func action) {
     /* Check if hash table is allocated */
     if (NULL == ht) {
         return SCL_NULL_HASH_TABLE;
     }
 
-    /* Check if has table buckets are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
     }
 
-    /* Check if data type value pointer is valid */
-    if (NULL == key) {
-        return SCL_INVALID_KEY;
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Set delete node and bucket index ad default values */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
-    hash_table_node_t *delete_node = hash_table_find_node(ht, key);
-
-    /* Delete node is not in the current working bucket */
-    if (ht->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
+    /* Traverse every bucket and perform actions */
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
 
-    /* Node has two children swap with it's inorder successor and delete successor */
-    if ((ht->nil != delete_node->left) && (ht->nil != delete_node->right)) {
+        /* Perform action on one bucket */
+        scl_error_t err = hash_table_bucket_traverse_postorder(ht, iter, action);
 
-        /* Find a replacement for selected node */
-        hash_table_node_t *delete_succecessor = hash_table_root_min_node(ht, delete_node->right);
-                
-        /* Replace the selected red-black node and remove the dublicate */
-        scl_error_t err = hash_table_swap_nodes(ht, bucket_index, delete_node, delete_succecessor);
+        printf("\n");
 
+        /* Something went wrong exit the function */
         if (SCL_OK != err) {
             return err;
         }
     }
 
-    /* Variable to check if fixing is needed */
-    uint8_t need_fixing_tree = 1;
+    /* Traverse the old buckets that were not moved yet */
+    if (NULL != ht->old_buckets) {
+        for (size_t iter = 0; iter < ht->old_capacity; ++iter) {
+            if (ht->nil != ht->old_buckets[iter]) {
+                printf("(old %ld): ", iter);
 
-    /* Set the child of the deleted node */
-    hash_table_node_t *delete_node_child = ht->nil;
+                /* Perform action on one old bucket */
+                hash_table_bucket_traverse_postorder_helper(ht, ht->old_buckets[iter], action);
 
-    /* Delete node has only one child */
-    if (ht->nil != delete_node->left) {
-        delete_node_child = delete_node->left;
+                printf("\n");
+            }
+        }
+    }
 
-        /* Check if deletion will not make a double black exception */
-        if ((HASH_RED == delete_node_child->color) && (HASH_BLACK == delete_node->color)) {
-            need_fixing_tree = 0;
+    /* All good */
+    return SCL_OK;
+}
 
-            /* Recolor red node into a red one */
-            delete_node_child->color = HASH_BLACK;
-        }
+/**
+ * @brief Subroutine function for hash_table_bucket_traverse_level.
+ * This method will iterate through all nodes of a bucket level by
+ * level using a queue.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket starting point of the red-black tree(bucket) traversal
+ * @param action a pointer function to perform an action on one hash table node object
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_bucket_traverse_level_helper(const hash_table_t * const __restrict__ ht, hash_table_node_t * const bucket, action_func action) {
+    /* Create a queue for bfs tree(bucket) traversal */
+    queue_t * const level_queue = create_queue(NULL, sizeof(bucket));
 
-        /* Update child with it's grandparent */
-        delete_node_child->parent = delete_node->parent;
+    /* Check if queue was created successfully */
+    if (NULL != level_queue) {
 
-        /* Update grandparent with it's grandchild */
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = delete_node_child;
-            } else {
-                delete_node->parent->left = delete_node_child;
-            }
-        } else {
+        /* Nodes go through a ring buffer, if it cannot be allocated the queue stays linked */
+        queue_use_ring(level_queue, 0);
 
-            /*
-             * Selected node was root
-             * Update a new root
-             */            
-            ht->buckets[bucket_index] = delete_node_child;
-        }
-    } else if (ht->nil != delete_node->right) {
-        delete_node_child = delete_node->right;
+        scl_error_t err = SCL_OK;
 
-        /* Check if deletion will not make a double black exception */
-        if ((HASH_RED == delete_node_child->color) && (HASH_BLACK == delete_node->color)) {
-            need_fixing_tree = 0;
+        /* Push pointer to root node into qeuue */
+        err = queue_push(level_queue, &bucket);
 
-            /* Recolor red node into a red one */
-            delete_node_child->color = HASH_BLACK;
+        if (SCL_OK != err) {
+            return err;
         }
 
-        /* Update child with it's grandparent */
-        delete_node_child->parent = delete_node->parent;
-
-        /* Update grandparent with it's grandchild */
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = delete_node_child;
-            } else {
-                delete_node->parent->left = delete_node_child;
-            }
-        } else {
+        /* Traverse all nodes */
+        while (!is_queue_empty(level_queue)) {
 
-            /*
-             * Selected node was root
-             * Update a new root
-             */
-            ht->buckets[bucket_index] = delete_node_child;
-        }
-    } else {
+            /* Get front node from queue */
+            const hash_table_node_t * const front_node = *(const hash_table_node_t ** const)queue_front(level_queue);
 
-        /* Check if deletion will not make a double black exception */ 
-        if (HASH_RED == delete_node->color) {
-            need_fixing_tree = 0;
-        }
+            /* Remove front node from queue */
+            err = queue_pop(level_queue);
 
-        // Update parent's links to nil node
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = ht->nil;
-            } else {
-                delete_node->parent->left = ht->nil;
+            if (SCL_OK != err) {
+                return err;
             }
-        } else {
-
-            /*
-             * Selected node was root
-             * Update a new root
-             */
-            ht->buckets[bucket_index] = ht->nil;
-        }
-    }
 
-    hash_table_node_t *parent_delete_node = delete_node->parent;
+            /* Call action function on front node */
+            action(front_node->data);
 
-    /* Free node from hash table */
-    free_hash_table_node(ht, &delete_node);
+            /* Push on queue front left child if it exists */
+            if (ht->nil != front_node->left) {
+                err = queue_push(level_queue, &front_node->left);
 
-    /* Deacrease tree size  */
-    --(ht->size);
+                if (SCL_OK != err) {
+                    return err;
+                }
+            }
 
-    /* Check if fixing is needed */
-    if (0 != need_fixing_tree) {
-        return hash_table_delete_fix_node_up(ht, bucket_index, delete_node_child, parent_delete_node);
-    }
+            /* Push on queue front right child if it exists */
+            if (ht->nil != front_node->right) {
+                err = queue_push(level_queue, &front_node->right);
 
-    /* All good */
-    return SCL_OK;
-}
+                if (SCL_OK != err) {
+                    return err;
+                }
+            }
+        }
 
-/**
- * @brief Subroutine function for hash_table_bucket_traverse_inorder.
- * This method will recursively iterate through all nodes by
- * Left-Root-Right principle.
- * 
- * @param ht pointer to an allocated hash table memory location
- * @param bucket starting point of the red-black tree(bucket) traversal
- * @param action a pointer function to perform an action on one hash table node object
- */
-static void hash_table_bucket_traverse_inorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
-    /* Check if current working hash table node is not nil */
-    if (ht->nil == bucket) {
-        return;
+        /* Free queue object from heap */
+        return free_queue(level_queue);
     }
 
-    /* Traverse in the left sub-tree */
-    hash_table_bucket_traverse_inorder_helper(ht, bucket->left, action);
-    
-    /* Call action function */
-    action(bucket->data);
-
-    /* Traverse in the right sub-tree */
-    hash_table_bucket_traverse_inorder_helper(ht, bucket->right, action);
+    /* Queue could not be allocated */
+    return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
 }
 
 /**
@@ -1677,14 +3485,15 @@ static void hash_table_bucket_traverse_inorder_helper(const hash_table_t * const
  * to bucket_index. Usually action will be a printing function, however
  * you can define a map function to map every node data to another
  * node data (the mapping proccess has to be injective to preserve the
- * red black tree proprety).
+ * red black tree proprety). Bucket will be traversed as a red black tree
+ * by level.
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param bucket_index index of the working red black tree(bucket) from hash table
  * @param action a pointer function to perform an action on one hash table node object
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_bucket_traverse_inorder(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
+scl_error_t hash_table_bucket_traverse_level(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
     /* Check if hash table is allocated */
     if (NULL == ht) {
         return SCL_NULL_HASH_TABLE;
@@ -1701,7 +3510,7 @@ scl_error_t hash_table_bucket_traverse_inorder(const hash_table_t * const __rest
     }
 
     /* Make sure that bucket index does not exceed hash capacity */
-    bucket_index = bucket_index % ht->capacity;
+    bucket_index = bucket_index & (ht->capacity - 1);
 
     printf("(%ld): ", bucket_index);
 
@@ -1713,7 +3522,7 @@ scl_error_t hash_table_bucket_traverse_inorder(const hash_table_t * const __rest
     else {
 
         /* Call helper function and traverse all nodes */
-        hash_table_bucket_traverse_inorder_helper(ht, ht->buckets[bucket_index], action);
+        return hash_table_bucket_traverse_level_helper(ht, ht->buckets[bucket_index], action);
     }
 
     /* All good */
@@ -1725,13 +3534,15 @@ scl_error_t hash_table_bucket_traverse_inorder(const hash_table_t * const __rest
  * to bucket_index. Usually action will be a printing function, however
  * you can define a map function to map every node data to another
  * node data (the mapping proccess has to be injective to preserve the
- * red black tree proprety).
+ * red black tree proprety). Hash table will be traversed bucket by bucket
+ * from the first bucket to last bucket, and every bucket will be traversed as
+ * a red black tree by level.
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param action a pointer function to perform an action on one hash table node object
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_traverse_inorder(const hash_table_t * const __restrict__ ht, action_func action) {
+scl_error_t hash_table_traverse_level(const hash_table_t * const __restrict__ ht, action_func action) {
     /* Check if hash table is allocated */
     if (NULL == ht) {
         return SCL_NULL_HASH_TABLE;
@@ -1749,10 +3560,10 @@ scl_error_t hash_table_traverse_inorder(const hash_table_t * const __restrict__
 
     /* Traverse every bucket and perform actions */
     for (size_t iter = 0; iter < ht->capacity; ++iter) {
-        
+
         /* Perform action on one bucket */
-        scl_error_t err = hash_table_bucket_traverse_inorder(ht, iter, action);
-        
+        scl_error_t err = hash_table_bucket_traverse_level(ht, iter, action);
+
         printf("\n");
 
         /* Something went wrong exit the function */
@@ -1761,389 +3572,581 @@ scl_error_t hash_table_traverse_inorder(const hash_table_t * const __restrict__
         }
     }
 
+    /* Traverse the old buckets that were not moved yet */
+    if (NULL != ht->old_buckets) {
+        for (size_t iter = 0; iter < ht->old_capacity; ++iter) {
+            if (ht->nil != ht->old_buckets[iter]) {
+                printf("(old %ld): ", iter);
+
+                /* Perform action on one old bucket */
+                scl_error_t err = hash_table_bucket_traverse_level_helper(ht, ht->old_buckets[iter], action);
+
+                /* Something went wrong exit the function */
+                if (SCL_OK != err) {
+                    return err;
+                }
+
+                printf("\n");
+            }
+        }
+    }
+
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Subroutine function for hash_table_bucket_traverse_inorder.
- * This method will recursively iterate through all nodes by
- * Root-Left-Right principle.
+ * @brief Function to find the first node of a hash table cursor starting
+ * from a bucket, the empty buckets are skipped. Function MUST not be used
+ * outside this file.
+ * 
+ * @param iter pointer to a cursor of an allocated hash table
+ * @param bucket_index first bucket to look into
+ * @return const void* the key of the node or `NULL` after the last bucket
+ */
+static const void* hash_table_iter_seek_bucket(hash_table_iter_t * const __restrict__ iter, size_t bucket_index) {
+    const hash_table_t * const ht = iter->ht;
+
+    for (; bucket_index < ht->capacity; ++bucket_index) {
+        if (ht->nil != ht->buckets[bucket_index]) {
+            iter->node = hash_table_bucket_first(ht, ht->buckets[bucket_index]);
+            iter->bucket_index = bucket_index;
+
+            return iter->node->key;
+        }
+    }
+
+    iter->node = NULL;
+    iter->bucket_index = ht->capacity;
+
+    return NULL;
+}
+
+/**
+ * @brief Function to place a cursor on the first node of a hash table.
+ * The nodes can be visited without a callback and erased on the way:
+ * for (k = hash_table_iter_begin(ht, &iter); NULL != k; k = hash_table_iter_next(&iter)).
+ * A pending incremental rehash is finished first, so that every node is
+ * visited exactly once and can be erased from its bucket.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param bucket starting point of the red-black tree(bucket) traversal
- * @param action a pointer function to perform an action on one hash table node object
+ * @param iter pointer to the cursor to place
+ * @return const void* the key of the first node or `NULL` if the hash table is empty
  */
-static void hash_table_bucket_traverse_preorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
-    /* Check if current working hash table node is not nil */
-    if (ht->nil == bucket) {
-        return;
+const void* hash_table_iter_begin(hash_table_t * const __restrict__ ht, hash_table_iter_t * const __restrict__ iter) {
+    /* Check if input data is valid */
+    if (NULL == iter) {
+        return NULL;
     }
 
-    /* Call action function */
-    action(bucket->data);
+    iter->ht = ht;
+    iter->node = NULL;
+    iter->next = NULL;
+    iter->bucket_index = 0;
+
+    if ((NULL == ht) || (NULL == ht->buckets)) {
+        return NULL;
+    }
 
-    /* Traverse in the left sub-tree */
-    hash_table_bucket_traverse_preorder_helper(ht, bucket->left, action);
+    /* The old buckets are moved before the walk */
+    hash_table_finish_rehash(ht);
 
-    /* Traverse in the right sub-tree */
-    hash_table_bucket_traverse_preorder_helper(ht, bucket->right, action);
+    return hash_table_iter_seek_bucket(iter, 0);
 }
 
 /**
- * @brief Function to perform one action on one bucket, according
- * to bucket_index. Usually action will be a printing function, however
- * you can define a map function to map every node data to another
- * node data (the mapping proccess has to be injective to preserve the
- * red black tree proprety).
+ * @brief Function to move a cursor to the next node of its hash table.
+ * After an erase the cursor moves to the node that followed the erased one.
  * 
- * @param ht pointer to an allocated hash table memory location
- * @param bucket_index index of the working red black tree(bucket) from hash table
- * @param action a pointer function to perform an action on one hash table node object
- * @return scl_error_t enum object for handling errors
+ * @param iter pointer to a placed cursor
+ * @return const void* the key of the next node or `NULL` after the last one
  */
-scl_error_t hash_table_bucket_traverse_preorder(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
+const void* hash_table_iter_next(hash_table_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is placed */
+    if ((NULL == iter) || (NULL == iter->ht) || (NULL == iter->ht->buckets) || (iter->bucket_index >= iter->ht->capacity)) {
+        return NULL;
     }
 
-    /* Check if action function is valid */
-    if (NULL == action) {
-        return SCL_NULL_ACTION_FUNC;
+    const hash_table_t * const ht = iter->ht;
+
+    /* The current node was erased, its successor is already known */
+    if (NULL == iter->node) {
+        if (NULL == iter->next) {
+            return hash_table_iter_seek_bucket(iter, iter->bucket_index + 1);
+        }
+
+        iter->node = iter->next;
+        iter->next = NULL;
+
+        return iter->node->key;
+    }
+
+    const hash_table_node_t * const next_node = hash_table_bucket_next(ht, ht->buckets[iter->bucket_index], iter->node);
+
+    if (ht->nil == next_node) {
+        return hash_table_iter_seek_bucket(iter, iter->bucket_index + 1);
+    }
+
+    iter->node = next_node;
+
+    return next_node->key;
+}
+
+/**
+ * @brief Function to get the key of the current node of a cursor.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the key of the current node or `NULL` if the cursor is
+ * not on a node, user should not modify this pointer
+ */
+const void* hash_table_iter_key(const hash_table_iter_t * const __restrict__ iter) {
+    if ((NULL == iter) || (NULL == iter->node)) {
+        return NULL;
+    }
+
+    return iter->node->key;
+}
+
+/**
+ * @brief Function to get the data of the current node of a cursor.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the data of the current node or `NULL` if the cursor is
+ * not on a node, user should not modify this pointer
+ */
+const void* hash_table_iter_data(const hash_table_iter_t * const __restrict__ iter) {
+    if ((NULL == iter) || (NULL == iter->node)) {
+        return NULL;
     }
 
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
+    return iter->node->data;
+}
+
+/**
+ * @brief Function to erase the current node of a cursor from its hash
+ * table, the key and the data are freed. The node is removed from its
+ * bucket straight away, the key is not hashed and not searched again.
+ * The cursor is left before the next node, so the next call of
+ * hash_table_iter_next returns the node that followed the erased one.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_iter_erase_current(hash_table_iter_t * const __restrict__ iter) {
+    /* Check if input data is valid */
+    if ((NULL == iter) || (NULL == iter->ht)) {
+        return SCL_NULL_HASH_TABLE;
     }
 
-    /* Make sure that bucket index does not exceed hash capacity */
-    bucket_index = bucket_index % ht->capacity;
+    if (NULL == iter->node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
 
-    printf("(%ld): ", bucket_index);
+    hash_table_t * const ht = iter->ht;
 
-    if (ht->nil == ht->buckets[bucket_index]) {
+    /*
+     * The successor is found before the deletion, deletion relinks
+     * the nodes (it never moves the key and data to another node)
+     * and the rotations keep the order of the nodes of the bucket
+     */
+    const hash_table_node_t * const next_node = hash_table_bucket_next(ht, ht->buckets[iter->bucket_index], iter->node);
 
-        /* Tree(Bucket) is empty no node to traverse */
-        printf("(Null)");
-    }
-    else {
+    hash_table_node_t * const delete_node = (hash_table_node_t *)iter->node;
 
-        /* Call helper function and traverse all nodes */
-        hash_table_bucket_traverse_preorder_helper(ht, ht->buckets[bucket_index], action);
-    }
+    iter->node = NULL;
+    iter->next = (ht->nil == next_node) ? NULL : next_node;
 
-    /* All good */
-    return SCL_OK;
+    return hash_table_delete_node(ht, iter->bucket_index, delete_node);
 }
 
 /**
- * @brief Function to perform one action on entire hash table, according
- * to bucket_index. Usually action will be a printing function, however
- * you can define a map function to map every node data to another
- * node data (the mapping proccess has to be injective to preserve the
- * red black tree proprety).
+ * @brief Subroutine function to get a slot of a hash table image.
  * 
- * @param ht pointer to an allocated hash table memory location
- * @param action a pointer function to perform an action on one hash table node object
- * @return scl_error_t enum object for handling errors
+ * @param slots array of slots of the image
+ * @param slot_size length in bytes of one slot
+ * @param slot_index index of the slot
+ * @return hash_table_image_slot_t* pointer to the header of the slot
  */
-scl_error_t hash_table_traverse_preorder(const hash_table_t * const __restrict__ ht, action_func action) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
-    }
+static inline hash_table_image_slot_t* hash_table_image_slot(const uint8_t * const __restrict__ slots, size_t slot_size, size_t slot_index) {
+    return (hash_table_image_slot_t *)(slots + slot_index * slot_size);
+}
 
-    /* Check if action function is valid */
-    if (NULL == action) {
-        return SCL_NULL_ACTION_FUNC;
-    }
+/**
+ * @brief Subroutine function to place one slot into the slots of a hash
+ * table image being built, by Robin Hood probing: the carried slot takes
+ * the place of any slot closer to its home, which is carried further. The
+ * slots are never full and the keys are distinct, so the loop ends.
+ * 
+ * @param slots array of capacity slots of the image
+ * @param capacity number of slots, a power of two
+ * @param slot_size length in bytes of one slot
+ * @param carry scratch slot holding the slot to place (it is overwritten)
+ * @param swap_area scratch slot used to swap two slots
+ * @return size_t probe distance plus one of the last slot placed
+ */
+static size_t hash_table_image_place(uint8_t * const __restrict__ slots, size_t capacity, size_t slot_size, uint8_t * const __restrict__ carry, uint8_t * const __restrict__ swap_area) {
+    hash_table_image_slot_t * const carried = (hash_table_image_slot_t *)carry;
+    size_t slot_index = hash_mix((size_t)carried->hash) & (capacity - 1);
+    size_t max_dist = 0;
 
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
-    }
+    carried->dist = 1;
 
-    /* Traverse every bucket and perform actions */
-    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+    for (;;) {
+        hash_table_image_slot_t * const slot = hash_table_image_slot(slots, slot_size, slot_index);
 
-        /* Perform action on one bucket */
-        scl_error_t err = hash_table_bucket_traverse_preorder(ht, iter, action);
+        if (0 == slot->dist) {
+            memcpy(slot, carry, slot_size);
+            return (carried->dist > max_dist) ? carried->dist : max_dist;
+        }
 
-        printf("\n");
+        /* Take the place of a slot closer to its home and carry it further */
+        if (slot->dist < carried->dist) {
+            max_dist = (carried->dist > max_dist) ? carried->dist : max_dist;
 
-        /* Something went wrong exit the function */
-        if (SCL_OK != err) {
-            return err;
+            memcpy(swap_area, slot, slot_size);
+            memcpy(slot, carry, slot_size);
+            memcpy(carry, swap_area, slot_size);
         }
-    }
 
-    /* All good */
-    return SCL_OK;
+        ++carried->dist;
+        slot_index = (slot_index + 1) & (capacity - 1);
+    }
 }
 
 /**
- * @brief Subroutine function for hash_table_bucket_traverse_inorder.
- * This method will recursively iterate through all nodes by
- * Left-Right-Root principle.
+ * @brief Subroutine function to place all the nodes of one bucket into the
+ * slots of a hash table image being built. The bucket is walked in order
+ * through the parent links, without recursion.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param bucket starting point of the red-black tree(bucket) traversal
- * @param action a pointer function to perform an action on one hash table node object
+ * @param bucket root of the bucket
+ * @param header header of the image, its capacity and slot layout are used
+ * and its max_dist is updated
+ * @param slots array of slots of the image
+ * @param carry two scratch slots
  */
-static void hash_table_bucket_traverse_postorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
-    /* Check if current working hash table node is not nil */
-    if (ht->nil == bucket) {
-        return;
-    }
+static void hash_table_image_place_bucket(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, hash_table_file_header_t * const __restrict__ header, uint8_t * const __restrict__ slots, uint8_t * const __restrict__ carry) {
+    const size_t slot_size = (size_t)header->slot_size;
 
-    /* Traverse in the left sub-tree */
-    hash_table_bucket_traverse_postorder_helper(ht, bucket->left, action);
+    for (const hash_table_node_t *iterator = hash_table_bucket_first(ht, bucket); ht->nil != iterator; iterator = hash_table_bucket_next(ht, bucket, iterator)) {
 
-    /* Traverse in the right sub-tree */
-    hash_table_bucket_traverse_postorder_helper(ht, bucket->right, action);
+        /* Copy the node into the carried slot and place it */
+        memset(carry, 0, slot_size);
+        ((hash_table_image_slot_t *)carry)->hash = (uint64_t)iterator->hash;
+        memcpy(carry + sizeof(hash_table_image_slot_t), iterator->key, ht->key_size);
+        memcpy(carry + header->data_offset, iterator->data, ht->data_size);
 
-    /* Call action function */
-    action(bucket->data);
+        const size_t dist = hash_table_image_place(slots, (size_t)header->capacity, slot_size, carry, carry + slot_size);
+
+        if (dist > header->max_dist) {
+            header->max_dist = dist;
+        }
+    }
 }
 
 /**
- * @brief Function to perform one action on one bucket, according
- * to bucket_index. Usually action will be a printing function, however
- * you can define a map function to map every node data to another
- * node data (the mapping proccess has to be injective to preserve the
- * red black tree proprety).
+ * @brief Subroutine function to fill the layout of a hash table image from
+ * the sizes of the keys, of the data and the number of keys. Function fails
+ * if the image would not fit in the address space.
  * 
- * @param ht pointer to an allocated hash table memory location
- * @param bucket_index index of the working red black tree(bucket) from hash table
- * @param action a pointer function to perform an action on one hash table node object
+ * @param key_size length in bytes of one key
+ * @param data_size length in bytes of one data
+ * @param size number of keys
+ * @param header header to fill (slot_size, data_offset and capacity)
+ * @param image_bytes pointer to store the length in bytes of the whole image
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_bucket_traverse_postorder(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
-    }
-
-    /* Check if action function is valid */
-    if (NULL == action) {
-        return SCL_NULL_ACTION_FUNC;
-    }
+static scl_error_t hash_table_image_layout(uint64_t key_size, uint64_t data_size, uint64_t size, hash_table_file_header_t * const __restrict__ header, size_t * const __restrict__ image_bytes) {
+    const uint64_t limit = SIZE_MAX / 4;
 
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
+    if ((key_size >= limit) || (data_size >= limit) || (size >= limit)) {
+        return SCL_INVALID_INPUT;
     }
 
-    /* Make sure that bucket index does not exceed hash capacity */
-    bucket_index = bucket_index % ht->capacity;
-
-    printf("(%ld): ", bucket_index);
+    /* Keys and data start aligned as any type, as the slot headers */
+    header->data_offset = sizeof(hash_table_image_slot_t) + SCL_ALIGN_SIZE(key_size);
+    header->slot_size = header->data_offset + SCL_ALIGN_SIZE(data_size);
 
-    if (ht->nil == ht->buckets[bucket_index]) {
+    /* At most half of the slots are used, so the probes stay short */
+    header->capacity = 1;
 
-        /* Tree(Bucket) is empty no node to traverse */
-        printf("(Null)");
+    while (header->capacity < 2 * size) {
+        header->capacity <<= 1;
     }
-    else {
 
-        /* Call helper function and traverse all nodes */
-        hash_table_bucket_traverse_postorder_helper(ht, ht->buckets[bucket_index], action);
+    if (header->capacity > (limit - HASH_TABLE_FILE_HEADER_BYTES) / header->slot_size) {
+        return SCL_INVALID_INPUT;
     }
 
+    *image_bytes = HASH_TABLE_FILE_HEADER_BYTES + (size_t)(header->capacity * header->slot_size);
+
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function to perform one action on entire hash table, according
- * to bucket_index. Usually action will be a printing function, however
- * you can define a map function to map every node data to another
- * node data (the mapping proccess has to be injective to preserve the
- * red black tree proprety).
+ * @brief Function to write a hash table into a binary file as a frozen,
+ * read-only image: a header followed by an open-addressed array of slots
+ * {hash, probe distance, key, data} ordered by Robin Hood probing, with at
+ * most half of the slots used. The image has no pointers, so
+ * **hash_table_open_mmap** uses it straight from the mapping of the file.
+ * The keys and the data are copied byte by byte, they MUST not hold
+ * pointers. The hash function of the table MUST not depend on the process
+ * (no random seed, no addresses), it is called again by the readers.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param action a pointer function to perform an action on one hash table node object
+ * @param path path of the file to create or overwrite
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_traverse_postorder(const hash_table_t * const __restrict__ ht, action_func action) {
+scl_error_t hash_table_freeze_to_file(const hash_table_t * const __restrict__ ht, const char * const __restrict__ path) {
     /* Check if hash table is allocated */
     if (NULL == ht) {
         return SCL_NULL_HASH_TABLE;
     }
 
-    /* Check if action function is valid */
-    if (NULL == action) {
-        return SCL_NULL_ACTION_FUNC;
-    }
-
     /* Check if hash table roots are allocated */
     if (NULL == ht->buckets) {
         return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Traverse every bucket and perform actions */
+    /* Check if path is valid */
+    if (NULL == path) {
+        return SCL_INVALID_INPUT;
+    }
+
+    hash_table_file_header_t header;
+    size_t image_bytes = 0;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, HASH_TABLE_FILE_MAGIC, sizeof(header.magic));
+    header.version = HASH_TABLE_FILE_VERSION;
+    header.byte_order = 0x01020304;
+    header.key_size = ht->key_size;
+    header.data_size = ht->data_size;
+    header.size = ht->size;
+
+    if (SCL_OK != hash_table_image_layout(header.key_size, header.data_size, header.size, &header, &image_bytes)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Build the whole image in memory, the empty slots are zero */
+    uint8_t *image = scl_calloc(ht->allocator, 1, image_bytes);
+    uint8_t *carry = scl_malloc(ht->allocator, 2 * (size_t)header.slot_size);
+
+    if ((NULL == image) || (NULL == carry)) {
+        scl_free(ht->allocator, image);
+        scl_free(ht->allocator, carry);
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    uint8_t * const slots = image + HASH_TABLE_FILE_HEADER_BYTES;
+
+    /* During an incremental rehash every node is in exactly one of the two arrays */
     for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        hash_table_image_place_bucket(ht, ht->buckets[iter], &header, slots, carry);
+    }
 
-        /* Perform action on one bucket */
-        scl_error_t err = hash_table_bucket_traverse_postorder(ht, iter, action);
+    if (NULL != ht->old_buckets) {
+        for (size_t iter = 0; iter < ht->old_capacity; ++iter) {
+            hash_table_image_place_bucket(ht, ht->old_buckets[iter], &header, slots, carry);
+        }
+    }
 
-        printf("\n");
+    memcpy(image, &header, sizeof(header));
+    scl_free(ht->allocator, carry);
 
-        /* Something went wrong exit the function */
-        if (SCL_OK != err) {
-            return err;
+    scl_error_t err = SCL_OK;
+    FILE *file = fopen(path, "wb");
+
+    if (NULL == file) {
+        err = SCL_HASH_TABLE_FILE_IO_FAIL;
+    } else {
+        if (1 != fwrite(image, image_bytes, 1, file)) {
+            err = SCL_HASH_TABLE_FILE_IO_FAIL;
+        }
+
+        /* Closing flushes the buffered bytes, so it may fail too */
+        if ((0 != fclose(file)) && (SCL_OK == err)) {
+            err = SCL_HASH_TABLE_FILE_IO_FAIL;
         }
     }
 
-    /* All good */
-    return SCL_OK;
+    scl_free(ht->allocator, image);
+
+    return err;
 }
 
 /**
- * @brief Function to perform one action on one bucket, according
- * to bucket_index. Usually action will be a printing function, however
- * you can define a map function to map every node data to another
- * node data (the mapping proccess has to be injective to preserve the
- * red black tree proprety). Bucket will be traversed as a red black tree
- * by level.
+ * @brief Function to map a hash table image written by
+ * **hash_table_freeze_to_file**. The file is mapped read-only and shared,
+ * nothing is copied or parsed, so opening costs the same for any size, the
+ * pages are read from disk just when the lookups touch them and all the
+ * processes mapping the same file share the same physical pages. The hash
+ * function and the key compare function MUST be the ones of the frozen hash
+ * table. The header is checked, the slots are trusted.
  * 
- * @param ht pointer to an allocated hash table memory location
- * @param bucket_index index of the working red black tree(bucket) from hash table
- * @param action a pointer function to perform an action on one hash table node object
- * @return scl_error_t enum object for handling errors
+ * @param path path of the image file
+ * @param hash pointer to the hash function of the frozen hash table
+ * @param cmp_key pointer to the key compare function of the frozen hash table
+ * @return hash_table_image_t* a new hash table image or `NULL` if function fails
  */
-scl_error_t hash_table_bucket_traverse_level(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
+hash_table_image_t* hash_table_open_mmap(const char * const __restrict__ path, hash_func hash, compare_func cmp_key) {
+    /* Check if input data is valid */
+    if ((NULL == path) || (NULL == hash) || (NULL == cmp_key)) {
+        errno = EINVAL;
+        perror("Path, hash or compare function of the hash table image is NULL");
+        return NULL;
     }
 
-    /* Check if action function is valid */
-    if (NULL == action) {
-        return SCL_NULL_ACTION_FUNC;
-    }
+    int fd = open(path, O_RDONLY);
 
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
+    if (fd < 0) {
+        perror("Hash table image could not be opened");
+        return NULL;
     }
 
-    /* Make sure that bucket index does not exceed hash capacity */
-    bucket_index = bucket_index % ht->capacity;
-
-    printf("(%ld): ", bucket_index);
+    struct stat file_stat;
 
-    if (ht->nil == ht->buckets[bucket_index]) {
+    if ((0 != fstat(fd, &file_stat)) || ((uintmax_t)file_stat.st_size < HASH_TABLE_FILE_HEADER_BYTES) || ((uintmax_t)file_stat.st_size > SIZE_MAX)) {
+        close(fd);
 
-        /* Tree(Bucket) is empty no node to traverse */
-        printf("(Null)");
+        errno = EINVAL;
+        perror("Hash table image is too short");
+        return NULL;
     }
-    else {
-
-        /* Create a queue for bfs tree(bucket) traversal */
-        queue_t * const level_queue = create_queue(NULL, sizeof(ht->buckets[bucket_index]));
 
-        /* Check if queue was created successfully */
-        if (NULL != level_queue) {
+    const size_t mapping_size = (size_t)file_stat.st_size;
+    void *mapping = mmap(NULL, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
 
-            scl_error_t err = SCL_OK;
+    /* The mapping stays valid after the file is closed */
+    close(fd);
 
-            /* Push pointer to root node into qeuue */
-            err = queue_push(level_queue, &ht->buckets[bucket_index]);
-
-            if (SCL_OK != err) {
-                return err;
-            }
+    if (MAP_FAILED == mapping) {
+        perror("Hash table image could not be mapped");
+        return NULL;
+    }
 
-            /* Traverse all nodes */
-            while (!is_queue_empty(level_queue)) {
+    const hash_table_file_header_t *header = mapping;
+    hash_table_file_header_t layout;
+    size_t image_bytes = 0;
 
-                /* Get front node from queue */
-                const hash_table_node_t * const front_node = *(const hash_table_node_t ** const)queue_front(level_queue);
+    /* Check if the file was written by a compatible program and if the slots fit in it */
+    if ((0 != memcmp(header->magic, HASH_TABLE_FILE_MAGIC, sizeof(header->magic))) || (HASH_TABLE_FILE_VERSION != header->version)
+        || (0x01020304 != header->byte_order) || (0 == header->key_size)
+        || (SCL_OK != hash_table_image_layout(header->key_size, header->data_size, header->size, &layout, &image_bytes))
+        || (layout.capacity != header->capacity) || (layout.slot_size != header->slot_size) || (layout.data_offset != header->data_offset)
+        || (header->max_dist > header->capacity) || (image_bytes > mapping_size)) {
+        munmap(mapping, mapping_size);
 
-                /* Remove front node from queue */
-                err = queue_pop(level_queue);
+        errno = EINVAL;
+        perror("Hash table image is not valid");
+        return NULL;
+    }
 
-                if (SCL_OK != err) {
-                    return err;
-                }
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
 
-                /* Call action function on front node */
-                action(front_node->data);
+    /* Allocate a new hash table image object on heap */
+    hash_table_image_t *new_image = scl_malloc(allocator, sizeof(*new_image));
 
-                /* Push on queue front left child if it exists */
-                if (ht->nil != front_node->left) {
-                    err = queue_push(level_queue, &front_node->left);
+    if (NULL == new_image) {
+        munmap(mapping, mapping_size);
 
-                    if (SCL_OK != err) {
-                        return err;
-                    }
-                }
-                
-                /* Push on queue front right child if it exists */
-                if (ht->nil != front_node->right) {
-                    err = queue_push(level_queue, &front_node->right);
+        errno = ENOMEM;
+        perror("Not enough memory for hash table image allocation");
+        return NULL;
+    }
 
-                    if (SCL_OK != err) {
-                        return err;
-                    }
-                }
-            }
+    new_image->slots = (const uint8_t *)mapping + HASH_TABLE_FILE_HEADER_BYTES;
+    new_image->hash = hash;
+    new_image->cmp_key = cmp_key;
+    new_image->key_size = (size_t)header->key_size;
+    new_image->data_size = (size_t)header->data_size;
+    new_image->data_offset = (size_t)header->data_offset;
+    new_image->slot_size = (size_t)header->slot_size;
+    new_image->capacity = (size_t)header->capacity;
+    new_image->size = (size_t)header->size;
+    new_image->max_dist = (size_t)header->max_dist;
+    new_image->key_kind = scl_key_kind_of(cmp_key, new_image->key_size);
+    new_image->mapping = mapping;
+    new_image->mapping_size = mapping_size;
+    new_image->allocator = allocator;
+
+    /* Return the new hash table image */
+    return new_image;
+}
 
-            /* Free queue object from heap */
-            return free_queue(level_queue);
-        }
+/**
+ * @brief Function to unmap a hash table image and to free its object,
+ * the pointers returned by its lookups are not valid anymore.
+ * 
+ * @param image pointer to a hash table image
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_hash_table_image(hash_table_image_t * const __restrict__ image) {
+    /* Check if hash table image is valid */
+    if (NULL == image) {
+        return SCL_NULL_HASH_TABLE_IMAGE;
     }
 
+    munmap(image->mapping, image->mapping_size);
+    scl_free(image->allocator, image);
+
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function to perform one action on entire hash table, according
- * to bucket_index. Usually action will be a printing function, however
- * you can define a map function to map every node data to another
- * node data (the mapping proccess has to be injective to preserve the
- * red black tree proprety). Hash table will be traversed bucket by bucket
- * from the first bucket to last bucket, and every bucket will be traversed as
- * a red black tree by level.
+ * @brief Function to find the data of a key in a hash table image. The
+ * probe starts at the home slot of the key and stops at the first slot
+ * closer to its own home (Robin Hood invariant), so a missing key is
+ * found missing after a few slots too. Hash values are compared first and
+ * the keys just on equal hashes.
  * 
- * @param ht pointer to an allocated hash table memory location
- * @param action a pointer function to perform an action on one hash table node object
- * @return scl_error_t enum object for handling errors
+ * @param image pointer to a hash table image
+ * @param key pointer to a location of a value representing key of a node
+ * @return const void* pointer to the data of the key inside the mapping
+ * (read-only) or `NULL` if no such key exists in the image
  */
-scl_error_t hash_table_traverse_level(const hash_table_t * const __restrict__ ht, action_func action) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
+const void* hash_table_image_find_data(const hash_table_image_t * const __restrict__ image, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == image) || (NULL == key)) {
+        return NULL;
     }
 
-    /* Check if action function is valid */
-    if (NULL == action) {
-        return SCL_NULL_ACTION_FUNC;
-    }
+    const uint64_t key_hash = (uint64_t)image->hash(key);
+    const size_t mask = image->capacity - 1;
+    size_t slot_index = hash_mix((size_t)key_hash) & mask;
 
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
-    }
+    for (size_t dist = 1; dist <= image->max_dist; ++dist) {
+        const hash_table_image_slot_t * const slot = hash_table_image_slot(image->slots, image->slot_size, slot_index);
 
-    /* Traverse every bucket and perform actions */
-    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        if (slot->dist < dist) {
+            return NULL;
+        }
 
-        /* Perform action on one bucket */
-        scl_error_t err = hash_table_bucket_traverse_level(ht, iter, action);
+        /* Compare hash values first and keys just on equal hashes */
+        if ((slot->hash == key_hash) && (0 == scl_key_compare(image->key_kind, image->cmp_key, image->key_size, slot + 1, key))) {
+            return (const uint8_t *)slot + image->data_offset;
+        }
 
-        printf("\n");
+        slot_index = (slot_index + 1) & mask;
+    }
 
-        /* Something went wrong exit the function */
-        if (SCL_OK != err) {
-            return err;
-        }
+    /* Key was not found */
+    return NULL;
+}
+
+/**
+ * @brief Function to get the number of keys of a hash table image.
+ * 
+ * @param image pointer to a hash table image
+ * @return size_t number of keys or `SIZE_MAX` if image is not valid
+ */
+size_t get_hash_table_image_size(const hash_table_image_t * const __restrict__ image) {
+    if (NULL == image) {
+        return SIZE_MAX;
     }
 
-    /* All good */
-    return SCL_OK;
+    return image->size;
 }
@@ -0,0 +1,479 @@
+/**
+ * @file scl_iterator.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_iterator.h"
+
+/**
+ * @brief Function to set every field of an iterator stage to its
+ * empty value. Function MUST not be used outside this file.
+ * 
+ * @param iter iterator stage to reset
+ * @param next function of the stage
+ * @param source previous stage of the pipeline or `NULL`
+ */
+static void scl_iter_reset(scl_iter_t * const __restrict__ iter, iter_next_func next, scl_iter_t * const source) {
+    iter->next = next;
+    iter->source = source;
+    iter->position = NULL;
+    iter->end = NULL;
+    iter->elem_size = 0;
+    iter->left = 0;
+    iter->filter = NULL;
+    iter->map = NULL;
+    iter->generator = NULL;
+    iter->arg = NULL;
+}
+
+/**
+ * @brief Function to get the next element of a linked list source.
+ * The nodes without data are skipped. Function MUST not be used outside this file.
+ * 
+ * @param iter a list source
+ * @return const void* next element or `NULL` if no element is left
+ */
+static const void* scl_iter_list_next(scl_iter_t * const iter) {
+    const list_node_t *node = iter->position;
+
+    while ((NULL != node) && (NULL == node->data)) {
+        node = node->next;
+    }
+
+    if (NULL == node) {
+        iter->position = NULL;
+        return NULL;
+    }
+
+    iter->position = node->next;
+
+    return node->data;
+}
+
+/**
+ * @brief Function to get the next element of a double linked list source.
+ * The nodes without data are skipped. Function MUST not be used outside this file.
+ * 
+ * @param iter a double linked list source
+ * @return const void* next element or `NULL` if no element is left
+ */
+static const void* scl_iter_dlist_next(scl_iter_t * const iter) {
+    const dlist_node_t *node = iter->position;
+
+    while ((NULL != node) && (NULL == node->data)) {
+        node = node->next;
+    }
+
+    if (NULL == node) {
+        iter->position = NULL;
+        return NULL;
+    }
+
+    iter->position = node->next;
+
+    return node->data;
+}
+
+/**
+ * @brief Function to get the next element of an array source (a vector
+ * is also an array source). Function MUST not be used outside this file.
+ * 
+ * @param iter an array source
+ * @return const void* next element or `NULL` if no element is left
+ */
+static const void* scl_iter_array_next(scl_iter_t * const iter) {
+    const uint8_t * const elem = iter->position;
+
+    if (elem == iter->end) {
+        return NULL;
+    }
+
+    iter->position = elem + iter->elem_size;
+
+    return elem;
+}
+
+/**
+ * @brief Function to get the next element of a user defined source.
+ * Function MUST not be used outside this file.
+ * 
+ * @param iter a user defined source
+ * @return const void* next element or `NULL` if no element is left
+ */
+static const void* scl_iter_generator_next(scl_iter_t * const iter) {
+    return iter->generator(iter->arg);
+}
+
+/**
+ * @brief Function to get the next element of the source of a filter stage
+ * for which the filter function returns 1. Function MUST not be used outside this file.
+ * 
+ * @param iter a filter stage
+ * @return const void* next element or `NULL` if no element is left
+ */
+static const void* scl_iter_filter_next(scl_iter_t * const iter) {
+    const void *elem = NULL;
+
+    while (NULL != (elem = iter->source->next(iter->source))) {
+        if (1 == iter->filter(elem)) {
+            return elem;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to get the image of the next element of the source of
+ * a map stage, written into the buffer of the stage. Function MUST not be
+ * used outside this file.
+ * 
+ * @param iter a map stage
+ * @return const void* the buffer of the stage or `NULL` if no element is left
+ */
+static const void* scl_iter_map_next(scl_iter_t * const iter) {
+    const void * const elem = iter->source->next(iter->source);
+
+    if (NULL == elem) {
+        return NULL;
+    }
+
+    iter->map(elem, iter->arg);
+
+    return iter->arg;
+}
+
+/**
+ * @brief Function to get the next element of the source of a take stage,
+ * the source is not asked for more elements once the count is reached.
+ * Function MUST not be used outside this file.
+ * 
+ * @param iter a take stage
+ * @return const void* next element or `NULL` if no element is left
+ */
+static const void* scl_iter_take_next(scl_iter_t * const iter) {
+    if (0 == iter->left) {
+        return NULL;
+    }
+
+    const void * const elem = iter->source->next(iter->source);
+
+    if (NULL == elem) {
+        iter->left = 0;
+    } else {
+        --(iter->left);
+    }
+
+    return elem;
+}
+
+/**
+ * @brief Function to start a source over the elements of a linked list
+ * object, from head to tail.
+ * 
+ * @param iter an iterator object to start
+ * @param list a linked list object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_list(scl_iter_t * const __restrict__ iter, const list_t * const __restrict__ list) {
+    /* Check if input data is valid */
+    if (NULL == iter) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    if (NULL == list) {
+        return SCL_NULL_LIST;
+    }
+
+    scl_iter_reset(iter, &scl_iter_list_next, NULL);
+    iter->position = list->head;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a source over the elements of a double
+ * linked list object, from head to tail.
+ * 
+ * @param iter an iterator object to start
+ * @param list a double linked list object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_dlist(scl_iter_t * const __restrict__ iter, const dlist_t * const __restrict__ list) {
+    /* Check if input data is valid */
+    if (NULL == iter) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    if (NULL == list) {
+        return SCL_NULL_DLIST;
+    }
+
+    scl_iter_reset(iter, &scl_iter_dlist_next, NULL);
+    iter->position = list->head;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a source over the elements of a vector
+ * object, from the first to the last one.
+ * 
+ * @param iter an iterator object to start
+ * @param vec an allocated vector object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_vector(scl_iter_t * const __restrict__ iter, const vector_t * const __restrict__ vec) {
+    /* Check if input data is valid */
+    if (NULL == iter) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    scl_iter_reset(iter, &scl_iter_array_next, NULL);
+    iter->position = vec->data;
+    iter->end = (NULL == vec->data) ? NULL : vec->data + vec->size * vec->data_size;
+    iter->elem_size = vec->data_size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a source over the elements of an array.
+ * 
+ * @param iter an iterator object to start
+ * @param arr pointer to the first element of the array (may be `NULL` if
+ * the array has no elements)
+ * @param number_of_elem number of elements of the array
+ * @param elem_size length in bytes of one element
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_array(scl_iter_t * const __restrict__ iter, const void * const __restrict__ arr, size_t number_of_elem, size_t elem_size) {
+    /* Check if input data is valid */
+    if (NULL == iter) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    if ((NULL == arr) && (0 != number_of_elem)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    if (0 == elem_size) {
+        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    }
+
+    scl_iter_reset(iter, &scl_iter_array_next, NULL);
+    iter->position = arr;
+    iter->end = (NULL == arr) ? NULL : (const uint8_t *)arr + number_of_elem * elem_size;
+    iter->elem_size = elem_size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a user defined source, every element is
+ * given by a call of the generator function with the state, the source
+ * ends when the generator returns `NULL`. Any container with a cursor
+ * (as the trees of the library) becomes a source in this way.
+ * 
+ * @param iter an iterator object to start
+ * @param generator a pointer to a function to get the next element
+ * @param state state of the generator (may be `NULL`)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_generator(scl_iter_t * const __restrict__ iter, iter_generator_func generator, void * const state) {
+    /* Check if input data is valid */
+    if (NULL == iter) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    if (NULL == generator) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    scl_iter_reset(iter, &scl_iter_generator_next, NULL);
+    iter->generator = generator;
+    iter->arg = state;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a filter stage, it gives just the elements
+ * of its source for which the filter function returns 1.
+ * 
+ * @param iter an iterator object to start
+ * @param source an iterator object, the previous stage of the pipeline
+ * @param filter a pointer to a filter function
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_filter(scl_iter_t * const __restrict__ iter, scl_iter_t * const __restrict__ source, filter_func filter) {
+    /* Check if input data is valid */
+    if ((NULL == iter) || (NULL == source) || (NULL == source->next)) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    if (NULL == filter) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    scl_iter_reset(iter, &scl_iter_filter_next, source);
+    iter->filter = filter;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a map stage, it gives the image of every
+ * element of its source. The image is written into the buffer, so it is
+ * valid just until the next element is asked from the stage.
+ * 
+ * @param iter an iterator object to start
+ * @param source an iterator object, the previous stage of the pipeline
+ * @param map a pointer to a function to write the image of one element
+ * @param buffer memory for the image of one element
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_map(scl_iter_t * const __restrict__ iter, scl_iter_t * const __restrict__ source, map_func map, void * const buffer) {
+    /* Check if input data is valid */
+    if ((NULL == iter) || (NULL == source) || (NULL == source->next)) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    if (NULL == map) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    if (NULL == buffer) {
+        return SCL_INVALID_INPUT;
+    }
+
+    scl_iter_reset(iter, &scl_iter_map_next, source);
+    iter->map = map;
+    iter->arg = buffer;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to start a take stage, it gives at most count
+ * elements of its source and then stops asking the source for elements.
+ * 
+ * @param iter an iterator object to start
+ * @param source an iterator object, the previous stage of the pipeline
+ * @param count maximum number of elements to give
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_take(scl_iter_t * const __restrict__ iter, scl_iter_t * const __restrict__ source, size_t count) {
+    /* Check if input data is valid */
+    if ((NULL == iter) || (NULL == source) || (NULL == source->next)) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    scl_iter_reset(iter, &scl_iter_take_next, source);
+    iter->left = count;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the next element of an iterator object, every
+ * stage before it computes just what is needed for this element.
+ * 
+ * @param iter a started iterator object
+ * @return const void* next element or `NULL` if no element is left or if
+ * iterator is not started, user should not modify this pointer
+ */
+const void* scl_iter_next(scl_iter_t * const __restrict__ iter) {
+    /* Check if input data is valid */
+    if ((NULL == iter) || (NULL == iter->next)) {
+        return NULL;
+    }
+
+    return iter->next(iter);
+}
+
+/**
+ * @brief Function to count the elements left in an iterator object,
+ * the iterator is consumed. If iterator is not started than zero is returned.
+ * 
+ * @param iter a started iterator object
+ * @return size_t number of elements given by the iterator
+ */
+size_t scl_iter_count(scl_iter_t * const __restrict__ iter) {
+    /* Check if input data is valid */
+    if ((NULL == iter) || (NULL == iter->next)) {
+        return 0;
+    }
+
+    size_t count = 0;
+
+    while (NULL != iter->next(iter)) {
+        ++count;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to push every element left in an iterator object at
+ * the end of a vector object, the iterator is consumed. The elements
+ * are copied byte by byte, so they must have the data size of the vector.
+ * 
+ * @param iter a started iterator object
+ * @param vec an allocated vector object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t scl_iter_to_vector(scl_iter_t * const __restrict__ iter, vector_t * const __restrict__ vec) {
+    /* Check if input data is valid */
+    if ((NULL == iter) || (NULL == iter->next)) {
+        return SCL_NULL_ITERATOR;
+    }
+
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    const void *elem = NULL;
+
+    while (NULL != (elem = iter->next(iter))) {
+        scl_error_t err = vector_push_back(vec, elem);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
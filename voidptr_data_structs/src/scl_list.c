@@ -54,11 +54,15 @@ list_t* create_list(compare_func cmp, free_func frd, size_t data_size) {
         return NULL;
     }
 
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new list on heap */
-    list_t *new_list = malloc(sizeof(*new_list));
+    list_t *new_list = scl_malloc(allocator, sizeof(*new_list));
 
     /* Check if new list was allocated */
     if (NULL != new_list) {
+        new_list->allocator = allocator;
 
         /* Set pointer functions in linked list class */
         new_list->cmp = cmp;
@@ -94,30 +98,20 @@ static list_node_t* create_list_node(const list_t * const __restrict__ list, con
     }
 
     /* Allocate a new Node on heap */
-    list_node_t *new_node = malloc(sizeof(*new_node));
+    list_node_t *new_node = scl_malloc(list->allocator, SCL_ALIGN_SIZE(sizeof(*new_node)) + list->data_size);
 
     /* Check if new node was allocated */
     if (NULL != new_node) {
         new_node->next = NULL;
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(list->data_size);
-
-        /* Check if data pointer was allocated*/
-        if (NULL != new_node->data) {
+        /* The data is stored inline, right after the node, in the same block */
+        new_node->data = (uint8_t *)new_node + SCL_ALIGN_SIZE(sizeof(*new_node));
 
-            /*
-             * Copy all bytes from data pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->data, data, list->data_size);
-        } else {
-            free(new_node);
-            new_node = NULL;
-
-            errno = ENOMEM;
-            perror("Not enough memory for data node list allocation");
-        }
+        /*
+         * Copy all bytes from data pointer
+         * to memory allocated on heap
+         */
+        memcpy(new_node->data, data, list->data_size);
     } else {
         errno = ENOMEM;
         perror("Not enough memory for node list allocation");
@@ -127,6 +121,141 @@ static list_node_t* create_list_node(const list_t * const __restrict__ list, con
     return new_node;
 }
 
+/**
+ * @brief Function to free one node of a linked list. The nodes allocated
+ * inside a block by list_from_array keep their data after a pointer to the
+ * block, so they are told apart from the nodes allocated one by one in O(1)
+ * time. The block is freed with its last node.
+ * 
+ * @param list an allocated linked list object
+ * @param node a node that was removed from the list
+ */
+static void list_free_node(const list_t * const __restrict__ list, list_node_t * const __restrict__ node) {
+    uint8_t * const inline_data = (uint8_t *)node + SCL_ALIGN_SIZE(sizeof(*node));
+
+    if (inline_data == (uint8_t *)node->data) {
+        scl_free(list->allocator, node);
+        return;
+    }
+
+    list_slab_t * const slab = *(list_slab_t **)inline_data;
+
+    if (0 == --(slab->nodes)) {
+        scl_free(list->allocator, slab);
+    }
+}
+
+/**
+ * @brief Create a Linked List object from an array of elements. All the
+ * nodes (with their inline data) are allocated in one block and linked in a
+ * single pass, instead of one allocation per element. The elements are copied
+ * byte by byte, so the list takes the ownership of the memory they point to.
+ * The nodes from the block are not freed one by one when they are deleted,
+ * the block is freed when no list holds its nodes anymore.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free the content of data
+ * @param arr pointer to the first element of the array
+ * @param number_of_elem number of elements of the array
+ * @param data_size length in bytes of one element
+ * @return list_t* return a new list with the elements of the array
+ * (in the same order) or `NULL` if allocation went wrong
+ */
+list_t* list_from_array(compare_func cmp, free_func frd, const void * __restrict__ arr, size_t number_of_elem, size_t data_size) {
+    /* Check if input is valid */
+    if ((NULL == arr) && (0 != number_of_elem)) {
+        errno = EINVAL;
+        perror("Array to build the list from is not allocated");
+        return NULL;
+    }
+
+    list_t *new_list = create_list(cmp, frd, data_size);
+
+    if ((NULL == new_list) || (0 == number_of_elem)) {
+        return new_list;
+    }
+
+    const size_t header_size = SCL_ALIGN_SIZE(sizeof(list_slab_t));
+    const size_t slab_link_size = SCL_ALIGN_SIZE(sizeof(list_slab_t *));
+    const size_t node_size = SCL_ALIGN_SIZE(SCL_ALIGN_SIZE(sizeof(list_node_t)) + slab_link_size + data_size);
+
+    /* Check if the block size overflows */
+    if ((node_size < data_size) || (number_of_elem > (SIZE_MAX - header_size) / node_size)) {
+        free_list(new_list);
+        errno = ENOMEM;
+        perror("Not enough memory for node list allocation");
+        return NULL;
+    }
+
+    list_slab_t *slab = scl_malloc(new_list->allocator, header_size + number_of_elem * node_size);
+
+    if (NULL == slab) {
+        free_list(new_list);
+        errno = ENOMEM;
+        perror("Not enough memory for node list allocation");
+        return NULL;
+    }
+
+    slab->nodes = number_of_elem;
+    slab->bytes = header_size + number_of_elem * node_size;
+
+    /* Link all the nodes of the block in one pass */
+    uint8_t *block = (uint8_t *)slab + header_size;
+    const uint8_t *data = arr;
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        list_node_t *node = (list_node_t *)(block + iter * node_size);
+
+        uint8_t * const slab_link = (uint8_t *)node + SCL_ALIGN_SIZE(sizeof(*node));
+
+        /* The block is kept between the node and its data */
+        *(list_slab_t **)slab_link = slab;
+        node->data = slab_link + slab_link_size;
+        node->next = (iter + 1 < number_of_elem) ? (list_node_t *)(block + (iter + 1) * node_size) : NULL;
+
+        memcpy(node->data, data + iter * data_size, data_size);
+    }
+
+    new_list->head = (list_node_t *)block;
+    new_list->tail = (list_node_t *)(block + (number_of_elem - 1) * node_size);
+    new_list->size = number_of_elem;
+
+    /* Return the new list */
+    return new_list;
+}
+
+/**
+ * @brief Function to copy the elements of a list, in order, into an array
+ * provided by the user. At most number_of_elem elements are copied, the array
+ * must have room for min(number_of_elem, size of the list) elements.
+ * 
+ * @param list a linked list object
+ * @param arr pointer to the first element of the array
+ * @param number_of_elem number of elements the array can hold
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t list_to_array(const list_t * const __restrict__ list, void * __restrict__ arr, size_t number_of_elem) {
+    /* Check if input is valid */
+    if (NULL == list) {
+        return SCL_NULL_LIST;
+    }
+
+    if ((NULL == arr) && (0 != number_of_elem)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    uint8_t *dest = arr;
+
+    for (const list_node_t *iterator = list->head; (NULL != iterator) && (0 != number_of_elem); iterator = iterator->next) {
+        memcpy(dest, iterator->data, list->data_size);
+        dest += list->data_size;
+        --number_of_elem;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to free every byte of memory allocated for a specific
  * linked list object. The function will iterate through all nodes and will
@@ -153,17 +282,9 @@ scl_error_t free_list(list_t * const __restrict__ list) {
                 list->frd(iterator->data);
             }
 
-            /* Free data pointer */
-            if (NULL != iterator->data) {
-                free(iterator->data);
-            }
-
-            /* Set data pointer to `NULL` */
-            iterator->data = NULL;
-            
             /* Free node pointer */
             if (NULL != iterator) {
-                free(iterator);
+                list_free_node(list, iterator);
             }
 
             /* Set node pointer to `NULL` */
@@ -171,7 +292,7 @@ scl_error_t free_list(list_t * const __restrict__ list) {
         }
 
         /* Free list */
-        free(list);
+        scl_free(list->allocator, list);
 
         return SCL_OK;
     }
@@ -214,6 +335,58 @@ size_t get_list_size(const list_t * const __restrict__ list) {
     return list->size;
 }
 
+/**
+ * @brief Function to get the memory footprint of a linked list. Every node
+ * holds one element inline, so the node bytes are the per node overhead
+ * (links, the pointer to the block and padding) and the payload is
+ * size * data_size. The header and the freed nodes of a block built by
+ * list_from_array are counted as slack, divided equally between the nodes
+ * of the block that are still in a list. Function visits every node of the list.
+ * 
+ * @param list an allocated linked list object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t list_memory_usage(const list_t * const __restrict__ list, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == list) {
+        return SCL_NULL_LIST;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const size_t node_size = SCL_ALIGN_SIZE(sizeof(list_node_t));
+    const size_t slab_node_size = SCL_ALIGN_SIZE(node_size + SCL_ALIGN_SIZE(sizeof(list_slab_t *)) + list->data_size);
+
+    usage->object_bytes = sizeof(*list);
+    usage->node_bytes = 0;
+    usage->payload_bytes = list->size * list->data_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = 0;
+    usage->nodes = list->size;
+
+    /* Nodes allocated one by one or inside a block of list_from_array */
+    for (const list_node_t *iterator = list->head; NULL != iterator; iterator = iterator->next) {
+        const uint8_t * const inline_data = (const uint8_t *)iterator + node_size;
+
+        if (inline_data == (const uint8_t *)iterator->data) {
+            usage->node_bytes += node_size;
+        } else {
+            const list_slab_t * const slab = *(const list_slab_t * const *)inline_data;
+
+            usage->node_bytes += slab_node_size - list->data_size;
+
+            /* The header and the freed nodes of a block are shared by its nodes */
+            usage->slack_bytes += (slab->bytes - slab->nodes * slab_node_size) / slab->nodes;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Get the list head object
  * 
@@ -705,6 +878,11 @@ scl_error_t list_delete_data(list_t * const __restrict__ list, const void * cons
 
         /* Element is the head of the list */
         list->head = list->head->next;
+
+        /* List becomes empty */
+        if (NULL == list->head) {
+            list->tail = NULL;
+        }
     } else {
 
         /* Update link with next node */
@@ -721,16 +899,9 @@ scl_error_t list_delete_data(list_t * const __restrict__ list, const void * cons
         list->frd(iterator->data);
     }
 
-    /* Free data pointer and set to `NULL` */
-    if (NULL != iterator->data) {
-        free(iterator->data);
-    }
-
-    iterator->data = NULL;
-
     /* Free node pointer and set to `NULL` */
     if (NULL != iterator) {
-        free(iterator);
+        list_free_node(list, iterator);
     }
 
     iterator = NULL;
@@ -783,6 +954,11 @@ scl_error_t list_delete_index(list_t * const __restrict__ list, size_t data_inde
 
         /* Removing node is current head */
         list->head = list->head->next;
+
+        /* List becomes empty */
+        if (NULL == list->head) {
+            list->tail = NULL;
+        }
     } else {
 
         /* Update links within the nodes */
@@ -799,16 +975,9 @@ scl_error_t list_delete_index(list_t * const __restrict__ list, size_t data_inde
         list->frd(iterator->data);
     }
 
-    /* Free data pointer and set to `NULL` */
-    if (NULL != iterator->data) {
-        free(iterator->data);
-    }
-
-    iterator->data = NULL;
-
     /* Free node pointer and set to `NULL` */
     if (NULL != iterator) {
-        free(iterator);
+        list_free_node(list, iterator);
     }
 
     iterator = NULL;
@@ -886,6 +1055,11 @@ scl_error_t list_erase(list_t * const __restrict__ list, size_t left_index, size
 
             /* Check if removed node is head */
             list->head = list->head->next;
+
+            /* List becomes empty */
+            if (NULL == list->head) {
+                list->tail = NULL;
+            }
         } else {
 
             /* Update nodes links */
@@ -902,16 +1076,9 @@ scl_error_t list_erase(list_t * const __restrict__ list, size_t left_index, size
             list->frd(iterator->data);
         }
 
-        /* Free data pointer and set to `NULL` */
-        if (NULL != iterator->data) {
-            free(iterator->data);
-        }
-
-        iterator->data = NULL;
-
         /* Free node pointer and set to `NULL` */
         if (NULL != iterator) {
-            free(iterator);
+            list_free_node(list, iterator);
         }
 
         iterator = NULL;
@@ -928,6 +1095,259 @@ scl_error_t list_erase(list_t * const __restrict__ list, size_t left_index, size
     return SCL_OK;
 }
 
+/**
+ * @brief Function to cut a run of at most run_size nodes from the front
+ * of a chain of nodes.
+ * 
+ * @param run first node of the run
+ * @param run_size maximum number of nodes of the run
+ * @return list_node_t* first node after the run or `NULL`
+ */
+static list_node_t* list_sort_cut(list_node_t *run, size_t run_size) {
+    /* Walk to the last node of the run */
+    while ((NULL != run) && (run_size > 1)) {
+        run = run->next;
+        --run_size;
+    }
+
+    if (NULL == run) {
+        return NULL;
+    }
+
+    list_node_t * const rest = run->next;
+    run->next = NULL;
+
+    return rest;
+}
+
+/**
+ * @brief Function to merge two sorted runs of nodes and to append the
+ * result after a link. On equal data the node of the left run goes first,
+ * so the merge is stable.
+ * 
+ * @param list a linked list object
+ * @param left first sorted run
+ * @param right second sorted run (placed after left in the list)
+ * @param link pointer to the link to append the merged run to
+ * @return list_node_t** pointer to the next link of the last merged node
+ */
+static list_node_t** list_sort_merge(const list_t * const __restrict__ list, list_node_t *left, list_node_t *right, list_node_t **link) {
+    while ((NULL != left) && (NULL != right)) {
+        if (list->cmp(right->data, left->data) < 0) {
+            *link = right;
+            right = right->next;
+        } else {
+            *link = left;
+            left = left->next;
+        }
+
+        link = &(*link)->next;
+    }
+
+    /* Append the rest of the run that is left */
+    *link = (NULL != left) ? left : right;
+
+    while (NULL != *link) {
+        link = &(*link)->next;
+    }
+
+    return link;
+}
+
+/**
+ * @brief Function to sort a linked list by the compare function of the list.
+ * The nodes are relinked by a bottom-up merge sort (runs of doubling
+ * sizes are merged in place), so no node or data is allocated or copied,
+ * the sort is stable and takes O(NlogN) time and O(1) extra memory.
+ * 
+ * @param list a linked list object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t list_sort(list_t * const __restrict__ list) {
+    /* Check if list is allocated */
+    if (NULL == list) {
+        return SCL_NULL_LIST;
+    }
+
+    for (size_t run_size = 1; run_size < list->size; run_size <<= 1) {
+        list_node_t *rest = list->head;
+        list_node_t **link = &list->head;
+
+        /* Merge every pair of neighbour runs of the current size */
+        while (NULL != rest) {
+            list_node_t * const left = rest;
+            list_node_t * const right = list_sort_cut(left, run_size);
+
+            rest = list_sort_cut(right, run_size);
+            link = list_sort_merge(list, left, right, link);
+        }
+    }
+
+    /* Find the new tail of the list */
+    list->tail = list->head;
+
+    while ((NULL != list->tail) && (NULL != list->tail->next)) {
+        list->tail = list->tail->next;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move all the nodes of other list at the end of the
+ * list in O(1) time, the nodes are relinked, not copied, and other list
+ * remains empty. Both lists must have the same data size and allocator.
+ * 
+ * @param list a linked list object
+ * @param other a linked list object to take the nodes from
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t list_concat(list_t * const __restrict__ list, list_t * const __restrict__ other) {
+    /* Check if lists are allocated */
+    if ((NULL == list) || (NULL == other)) {
+        return SCL_NULL_LIST;
+    }
+
+    /* The nodes keep their data inline and are freed by the allocator of their list */
+    if ((list == other) || (list->data_size != other->data_size) || (list->allocator != other->allocator)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return list_splice(list, list->size, other);
+}
+
+/**
+ * @brief Function to move all the nodes of other list into the list, before
+ * the node from data_index (at the end if data_index is greater or equal than
+ * the size of the list). The nodes are relinked, not copied, other list remains
+ * empty. Takes O(data_index) time to find the position, O(1) at the front or at
+ * the end of the list. Both lists must have the same data size and allocator.
+ * 
+ * @param list a linked list object
+ * @param data_index index of the node to insert the other nodes before
+ * @param other a linked list object to take the nodes from
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t list_splice(list_t * const __restrict__ list, size_t data_index, list_t * const __restrict__ other) {
+    /* Check if lists are allocated */
+    if ((NULL == list) || (NULL == other)) {
+        return SCL_NULL_LIST;
+    }
+
+    /* The nodes keep their data inline and are freed by the allocator of their list */
+    if ((list == other) || (list->data_size != other->data_size) || (list->allocator != other->allocator)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Nothing to move */
+    if (NULL == other->head) {
+        return SCL_OK;
+    }
+
+    if (data_index > list->size) {
+        data_index = list->size;
+    }
+
+    if (0 == data_index) {
+        /* Insert in front of the list */
+        other->tail->next = list->head;
+        list->head = other->head;
+
+        if (0 == list->size) {
+            list->tail = other->tail;
+        }
+    } else if (list->size == data_index) {
+        /* Insert at the end of the list */
+        list->tail->next = other->head;
+        list->tail = other->tail;
+    } else {
+        /* Find the node before the insert position */
+        list_node_t *iterator = list->head;
+
+        for (size_t iter = 1; iter < data_index; ++iter) {
+            iterator = iterator->next;
+        }
+
+        other->tail->next = iterator->next;
+        iterator->next = other->head;
+    }
+
+    list->size += other->size;
+
+    other->head = other->tail = NULL;
+    other->size = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to split a list in two lists. The list keeps the nodes
+ * before data_index and the nodes from data_index to the end are moved into
+ * a new list (relinked, not copied) with the same functions, data size and
+ * allocator. Takes O(data_index) time to find the split point.
+ * 
+ * @param list a linked list object
+ * @param data_index index of the first node of the new list
+ * @return list_t* a new list with the nodes from data_index (empty if data_index
+ * is greater or equal than the size of the list) or `NULL` if function fails
+ */
+list_t* list_split_at(list_t * const __restrict__ list, size_t data_index) {
+    /* Check if list is allocated */
+    if (NULL == list) {
+        errno = EINVAL;
+        perror("List to split is not allocated");
+        return NULL;
+    }
+
+    /* The nodes of the new list must be freed by the allocator of the list */
+    list_t *new_list = scl_malloc(list->allocator, sizeof(*new_list));
+
+    if (NULL == new_list) {
+        errno = ENOMEM;
+        perror("Not enough memory for list allocation");
+        return NULL;
+    }
+
+    new_list->allocator = list->allocator;
+    new_list->cmp = list->cmp;
+    new_list->frd = list->frd;
+    new_list->data_size = list->data_size;
+    new_list->head = new_list->tail = NULL;
+    new_list->size = 0;
+
+    /* Nothing to move */
+    if (data_index >= list->size) {
+        return new_list;
+    }
+
+    new_list->tail = list->tail;
+    new_list->size = list->size - data_index;
+
+    if (0 == data_index) {
+        /* Move the whole list */
+        new_list->head = list->head;
+        list->head = list->tail = NULL;
+    } else {
+        /* Find the last node that stays in the list */
+        list_node_t *iterator = list->head;
+
+        for (size_t iter = 1; iter < data_index; ++iter) {
+            iterator = iterator->next;
+        }
+
+        new_list->head = iterator->next;
+        iterator->next = NULL;
+        list->tail = iterator;
+    }
+
+    list->size = data_index;
+
+    /* Return the new list */
+    return new_list;
+}
+
 /**
  * @brief Function to filter a given linked list object. User
  * has to provide a function that return true(1) or false(0). If
@@ -982,6 +1402,55 @@ list_t* list_filter(const list_t * const __restrict__ list, filter_func filter)
     return filter_list;
 }
 
+/**
+ * @brief Function to filter a linked list object in place. Every
+ * element for which the filter function does not return 1 is removed
+ * from the list and freed, in one pass over the nodes and without
+ * copying the elements that are kept, their order is not changed.
+ * 
+ * @param list a linked list object
+ * @param filter a pointer to a filter function
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t list_retain(list_t * const __restrict__ list, filter_func filter) {
+    /* Check if input is valid */
+    if (NULL == list) {
+        return SCL_NULL_LIST;
+    }
+
+    if (NULL == filter) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    list_node_t **link = &list->head;
+    list_node_t *last_kept = NULL;
+
+    /* Unlink the rejected nodes, link keeps the next pointer to update */
+    while (NULL != *link) {
+        list_node_t * const iterator = *link;
+
+        if ((NULL != iterator->data) && (1 == filter(iterator->data))) {
+            last_kept = iterator;
+            link = &iterator->next;
+        } else {
+            *link = iterator->next;
+
+            /* Free content of data */
+            if ((NULL != list->frd) && (NULL != iterator->data)) {
+                list->frd(iterator->data);
+            }
+
+            list_free_node(list, iterator);
+            --(list->size);
+        }
+    }
+
+    list->tail = last_kept;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to traverse all list and
  * do action on all data nodes.
@@ -0,0 +1,358 @@
+/**
+ * @file scl_mem_pool.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_mem_pool.h"
+
+#define DEFAULT_MEM_POOL_OBJECTS_PER_CHUNK 64
+
+/**
+ * @brief Create a memory pool object. Allocation may fail if there
+ * is not enough memory on heap or object size is zero. No chunk is
+ * allocated until the first object is requested.
+ *
+ * @param object_size length in bytes of one object
+ * @param objects_per_chunk number of objects from one chunk (0 for default)
+ * @return mem_pool_t* a new allocated memory pool object or `NULL` (if function fails)
+ */
+mem_pool_t* create_mem_pool(size_t object_size, size_t objects_per_chunk) {
+    /* Check if object size is valid */
+    if (0 == object_size) {
+        errno = EINVAL;
+        perror("Object size at creation is zero");
+        return NULL;
+    }
+
+    /* Check if objects per chunk is valid if not set it as default value */
+    if (0 == objects_per_chunk) {
+        objects_per_chunk = DEFAULT_MEM_POOL_OBJECTS_PER_CHUNK;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new memory pool object on heap */
+    mem_pool_t *new_pool = scl_malloc(allocator, sizeof(*new_pool));
+
+    /* Check if memory pool was allocated successfully */
+    if (NULL != new_pool) {
+        new_pool->allocator = allocator;
+
+        /* A released object must be able to hold the free list link */
+        if (object_size < sizeof(void *)) {
+            object_size = sizeof(void *);
+        }
+
+        new_pool->chunks = NULL;
+        new_pool->free_list = NULL;
+        new_pool->bump = new_pool->bump_end = NULL;
+        new_pool->object_size = MEM_POOL_ALIGN_SIZE(object_size);
+        new_pool->objects_per_chunk = objects_per_chunk;
+        new_pool->used = 0;
+        new_pool->capacity = 0;
+    } else {
+        errno = ENOMEM;
+        perror("Not enough memory for memory pool allocation");
+    }
+
+    /* Return a new allocated memory pool or `NULL` */
+    return new_pool;
+}
+
+/**
+ * @brief Function to free every chunk of a memory pool at once. All the
+ * objects handed out by the pool become invalid.
+ *
+ * @param pool pointer to an allocated memory pool
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_mem_pool(mem_pool_t * const __restrict__ pool) {
+    /* Check if memory pool needs to be freed */
+    if (NULL == pool) {
+        return SCL_NULL_MEM_POOL;
+    }
+
+    /* Free every chunk */
+    while (NULL != pool->chunks) {
+        mem_pool_chunk_t *next_chunk = pool->chunks->next;
+
+        scl_free(pool->allocator, pool->chunks);
+
+        pool->chunks = next_chunk;
+    }
+
+    /* Free the memory pool object */
+    scl_free(pool->allocator, pool);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get one object from the memory pool. Released objects
+ * are reused first, then the never used objects of the newest chunk, and
+ * just when both are exhausted a new chunk is allocated.
+ *
+ * @param pool pointer to an allocated memory pool
+ * @return void* pointer to an object of object_size bytes or `NULL`
+ * if there is not enough memory on heap
+ */
+void* mem_pool_alloc(mem_pool_t * const __restrict__ pool) {
+    /* Check if memory pool is allocated */
+    if (NULL == pool) {
+        return NULL;
+    }
+
+    void *object = NULL;
+
+    if (NULL != pool->free_list) {
+
+        /* Reuse the last released object */
+        object = pool->free_list;
+        memcpy(&pool->free_list, object, sizeof(pool->free_list));
+    } else {
+
+        /* Newest chunk is full, allocate a new one */
+        if (pool->bump == pool->bump_end) {
+            size_t header_size = MEM_POOL_ALIGN_SIZE(sizeof(mem_pool_chunk_t));
+            mem_pool_chunk_t *new_chunk = scl_malloc(pool->allocator, header_size + pool->object_size * pool->objects_per_chunk);
+
+            /* Check if chunk was allocated successfully */
+            if (NULL == new_chunk) {
+                errno = ENOMEM;
+                perror("Not enough memory for memory pool chunk allocation");
+                return NULL;
+            }
+
+            /* Link the new chunk */
+            new_chunk->next = pool->chunks;
+            pool->chunks = new_chunk;
+
+            pool->bump = (uint8_t *)new_chunk + header_size;
+            pool->bump_end = pool->bump + pool->object_size * pool->objects_per_chunk;
+            pool->capacity += pool->objects_per_chunk;
+        }
+
+        /* Hand out the next never used object */
+        object = pool->bump;
+        pool->bump += pool->object_size;
+    }
+
+    /* Increase the number of used objects */
+    ++(pool->used);
+
+    return object;
+}
+
+/**
+ * @brief Function to make sure that the next number_of_objects allocations
+ * from the memory pool do not allocate chunks. If the newest chunk has not
+ * enough never used objects, they are moved on the free list and one chunk
+ * of at least number_of_objects objects is allocated, so a known number of
+ * objects is taken with one call to the allocator.
+ *
+ * @param pool pointer to an allocated memory pool
+ * @param number_of_objects number of objects to have ready for allocation
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t mem_pool_reserve(mem_pool_t * const __restrict__ pool, size_t number_of_objects) {
+    /* Check if memory pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_MEM_POOL;
+    }
+
+    /* Newest chunk has enough never used objects */
+    if ((size_t)(pool->bump_end - pool->bump) / pool->object_size >= number_of_objects) {
+        return SCL_OK;
+    }
+
+    size_t header_size = MEM_POOL_ALIGN_SIZE(sizeof(mem_pool_chunk_t));
+
+    /* Check if the chunk length fits in size_t */
+    if (number_of_objects > (SIZE_MAX - header_size) / pool->object_size) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* Never allocate a chunk smaller than the usual ones */
+    if (number_of_objects < pool->objects_per_chunk) {
+        number_of_objects = pool->objects_per_chunk;
+    }
+
+    mem_pool_chunk_t *new_chunk = scl_malloc(pool->allocator, header_size + pool->object_size * number_of_objects);
+
+    /* Check if chunk was allocated successfully */
+    if (NULL == new_chunk) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* Keep the never used objects of the old chunk on the free list */
+    while (pool->bump != pool->bump_end) {
+        memcpy(pool->bump, &pool->free_list, sizeof(pool->free_list));
+        pool->free_list = pool->bump;
+        pool->bump += pool->object_size;
+    }
+
+    /* Link the new chunk */
+    new_chunk->next = pool->chunks;
+    pool->chunks = new_chunk;
+
+    pool->bump = (uint8_t *)new_chunk + header_size;
+    pool->bump_end = pool->bump + pool->object_size * number_of_objects;
+    pool->capacity += number_of_objects;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get number_of_objects contiguous objects from the
+ * memory pool, taken from the never used objects of the newest chunk (a
+ * new chunk is allocated if they are not enough, see mem_pool_reserve).
+ * The objects are given back one by one by mem_pool_free, like the objects
+ * of mem_pool_alloc.
+ *
+ * @param pool pointer to an allocated memory pool
+ * @param number_of_objects number of objects of the array
+ * @return void* pointer to the first object of the array or `NULL`
+ * if there is not enough memory on heap
+ */
+void* mem_pool_alloc_array(mem_pool_t * const __restrict__ pool, size_t number_of_objects) {
+    /* Check if input data is valid */
+    if ((NULL == pool) || (0 == number_of_objects)) {
+        return NULL;
+    }
+
+    /* Make the newest chunk hold all the objects */
+    if (SCL_OK != mem_pool_reserve(pool, number_of_objects)) {
+        errno = ENOMEM;
+        perror("Not enough memory for memory pool chunk allocation");
+        return NULL;
+    }
+
+    /* Hand out the next never used objects */
+    void *objects = pool->bump;
+
+    pool->bump += pool->object_size * number_of_objects;
+    pool->used += number_of_objects;
+
+    return objects;
+}
+
+/**
+ * @brief Function to give back one object to the memory pool in O(1). The
+ * object MUST have been handed out by the same pool, its memory is reused
+ * by the next allocations and is released to the heap just when the whole
+ * pool is freed.
+ *
+ * @param pool pointer to an allocated memory pool
+ * @param object pointer to an object handed out by the pool
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t mem_pool_free(mem_pool_t * const __restrict__ pool, void * const __restrict__ object) {
+    /* Check if memory pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_MEM_POOL;
+    }
+
+    /* Check if object is valid */
+    if (NULL == object) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Push the object in front of the free list */
+    memcpy(object, &pool->free_list, sizeof(pool->free_list));
+    pool->free_list = object;
+
+    /* Decrease the number of used objects */
+    --(pool->used);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the number of objects in use from a memory pool.
+ *
+ * @param pool pointer to an allocated memory pool
+ * @return size_t SIZE_MAX if memory pool is not allocated or
+ * number of objects in use.
+ */
+size_t get_mem_pool_used(const mem_pool_t * const __restrict__ pool) {
+    if (NULL == pool) {
+        return SIZE_MAX;
+    }
+
+    return pool->used;
+}
+
+/**
+ * @brief Get the length in bytes of one object from a memory pool,
+ * after it was rounded up to the pool alignment.
+ *
+ * @param pool pointer to an allocated memory pool
+ * @return size_t SIZE_MAX if memory pool is not allocated or
+ * length in bytes of one object.
+ */
+size_t get_mem_pool_object_size(const mem_pool_t * const __restrict__ pool) {
+    if (NULL == pool) {
+        return SIZE_MAX;
+    }
+
+    return pool->object_size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a memory pool. The objects
+ * in use are counted as payload and the released or never used objects
+ * as slack, the chunk headers are counted as node bytes.
+ *
+ * @param pool pointer to an allocated memory pool
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t mem_pool_memory_usage(const mem_pool_t * const __restrict__ pool, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if memory pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_MEM_POOL;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    size_t number_of_chunks = 0;
+
+    for (const mem_pool_chunk_t *chunk = pool->chunks; NULL != chunk; chunk = chunk->next) {
+        ++number_of_chunks;
+    }
+
+    usage->object_bytes = sizeof(*pool);
+    usage->node_bytes = number_of_chunks * MEM_POOL_ALIGN_SIZE(sizeof(mem_pool_chunk_t));
+    usage->payload_bytes = pool->used * pool->object_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = (pool->capacity - pool->used) * pool->object_size;
+    usage->nodes = pool->used;
+
+    /* All good */
+    return SCL_OK;
+}
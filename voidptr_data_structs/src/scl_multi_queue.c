@@ -0,0 +1,489 @@
+/**
+ * @file scl_multi_queue.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_multi_queue.h"
+#include "./include/scl_thread_pool.h"
+
+/* State of the generator of heap numbers, one for every thread */
+static _Thread_local uint64_t multi_queue_seed = 0;
+
+/**
+ * @brief Function to select one random heap of a multi queue. Every thread
+ * has its own xorshift generator, seeded by the address of its state.
+ * Function MUST not be used outside this file.
+ * 
+ * @param mqueue an allocated multi queue object
+ * @return multi_queue_heap_t* pointer to a random heap
+ */
+static multi_queue_heap_t* multi_queue_random_heap(const multi_queue_t * const __restrict__ mqueue) {
+    uint64_t bits = multi_queue_seed;
+
+    if (0 == bits) {
+        bits = (uint64_t)(uintptr_t)&multi_queue_seed ^ 0x9E3779B97F4A7C15ULL;
+    }
+
+    bits ^= bits << 13;
+    bits ^= bits >> 7;
+    bits ^= bits << 17;
+
+    multi_queue_seed = bits;
+
+    return &mqueue->heaps[bits % mqueue->number_of_heaps];
+}
+
+/**
+ * @brief Function to move the top element of a locked heap out of the multi
+ * queue. The priority and the data are copied into the output buffers, a part
+ * without buffer is freed by the free function of the multi queue.
+ * Function MUST not be used outside this file.
+ * 
+ * @param mqueue an allocated multi queue object
+ * @param heap a locked heap with at least one element
+ * @param priority buffer of pri_size bytes for the priority, can be `NULL`
+ * @param data buffer of data_size bytes for the data, can be `NULL`
+ */
+static void multi_queue_take_top(multi_queue_t * const __restrict__ mqueue, multi_queue_heap_t * const __restrict__ heap, void * const priority, void * const data) {
+    void * const top_pri = (void *)flat_pri_queue_top_pri(heap->heap);
+    void * const top_data = (void *)flat_pri_queue_top(heap->heap);
+
+    if (NULL != priority) {
+        memcpy(priority, top_pri, mqueue->pri_size);
+    } else if (NULL != mqueue->frd_pr) {
+        mqueue->frd_pr(top_pri);
+    }
+
+    if (NULL != top_data) {
+        if (NULL != data) {
+            memcpy(data, top_data, mqueue->data_size);
+        } else if (NULL != mqueue->frd_dt) {
+            mqueue->frd_dt(top_data);
+        }
+    }
+
+    /* The heap frees nothing, the element now belongs to the caller */
+    flat_pri_queue_pop(heap->heap);
+
+    atomic_fetch_sub_explicit(&heap->size, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&mqueue->size, 1, memory_order_relaxed);
+}
+
+/**
+ * @brief Function to free the content of every element of one heap and to
+ * remove them, the array of the heap is kept.
+ * Function MUST not be used outside this file.
+ * 
+ * @param mqueue an allocated multi queue object
+ * @param heap a locked heap (or a heap no other thread uses)
+ */
+static void multi_queue_clear_heap(multi_queue_t * const __restrict__ mqueue, multi_queue_heap_t * const __restrict__ heap) {
+    flat_priority_queue_t * const fpqueue = heap->heap;
+
+    for (size_t iter = 0; iter < fpqueue->slots.size; ++iter) {
+        uint8_t * const slot = fpqueue->slots.data + iter * fpqueue->slot_size;
+
+        if (NULL != mqueue->frd_pr) {
+            mqueue->frd_pr(slot);
+        }
+
+        if ((NULL != mqueue->frd_dt) && (0 != mqueue->data_size)) {
+            mqueue->frd_dt(slot + fpqueue->data_offset);
+        }
+    }
+
+    atomic_fetch_sub_explicit(&mqueue->size, fpqueue->slots.size, memory_order_relaxed);
+    atomic_store_explicit(&heap->size, 0, memory_order_relaxed);
+
+    vector_clear(&fpqueue->slots);
+}
+
+/**
+ * @brief Create a multi queue object, a relaxed priority queue for many
+ * threads made of number_of_heaps sequential heaps (flat priority queues),
+ * each one with its own lock. Allocation may fail if there is not enough
+ * memory on heap, the compare function is not valid or the locks of the
+ * heaps cannot be initialized.
+ * 
+ * @param number_of_heaps number of independently locked heaps, a few for every
+ * thread using the queue (0 for MULTI_QUEUE_HEAPS_PER_THREAD heaps for every online processor)
+ * @param cmp_pr pointer to a function to compare two sets of priority,
+ * the element with the greatest priority is popped first
+ * @param frd_pr pointer to a function to free memory allocated for the CONTENT of the priority pointer
+ * @param frd_dt pointer to a function to free memory allocated for the CONTENT of the data pointer
+ * @param pri_size length in bytes of the priority data type
+ * @param data_size length in bytes of the data data type (may be zero)
+ * @return multi_queue_t* a new allocated multi queue object or `NULL` (if function fails)
+ */
+multi_queue_t* create_multi_queue(size_t number_of_heaps, compare_func cmp_pr, free_func frd_pr, free_func frd_dt, size_t pri_size, size_t data_size) {
+    /* Check if compare function is valid */
+    if (NULL == cmp_pr) {
+        errno = EINVAL;
+        perror("Compare function undefined for multi queue");
+        return NULL;
+    }
+
+    /* Check if priority size is valid */
+    if (0 == pri_size) {
+        errno = EINVAL;
+        perror("Priority type size is zero");
+        return NULL;
+    }
+
+    if (0 == number_of_heaps) {
+        number_of_heaps = MULTI_QUEUE_HEAPS_PER_THREAD * get_online_processors();
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new multi queue object on heap */
+    multi_queue_t *new_mqueue = scl_malloc(allocator, sizeof(*new_mqueue));
+
+    /* Check if multi queue was allocated successfully */
+    if (NULL == new_mqueue) {
+        errno = ENOMEM;
+        perror("Not enough memory for multi queue allocation");
+        return NULL;
+    }
+
+    new_mqueue->allocator = allocator;
+    new_mqueue->cmp_pr = cmp_pr;
+    new_mqueue->frd_pr = frd_pr;
+    new_mqueue->frd_dt = frd_dt;
+    new_mqueue->number_of_heaps = number_of_heaps;
+    new_mqueue->pri_size = pri_size;
+    new_mqueue->data_size = data_size;
+    atomic_init(&new_mqueue->size, 0);
+
+    /*
+     * Allocate the heaps, the allocator guarantees just the malloc
+     * alignment so one more cache line is taken to align the array
+     */
+    new_mqueue->heaps_memory = (number_of_heaps <= (SIZE_MAX - MULTI_QUEUE_HEAP_ALIGN) / sizeof(*new_mqueue->heaps))
+        ? scl_malloc(allocator, sizeof(*new_mqueue->heaps) * number_of_heaps + MULTI_QUEUE_HEAP_ALIGN - 1) : NULL;
+
+    /* Check if heaps were allocated successfully */
+    if (NULL == new_mqueue->heaps_memory) {
+        scl_free(allocator, new_mqueue);
+
+        errno = ENOMEM;
+        perror("Not enough memory for multi queue heaps allocation");
+        return NULL;
+    }
+
+    /* Every heap starts on its own cache line */
+    new_mqueue->heaps = (multi_queue_heap_t *)(((uintptr_t)new_mqueue->heaps_memory + MULTI_QUEUE_HEAP_ALIGN - 1) & ~(uintptr_t)(MULTI_QUEUE_HEAP_ALIGN - 1));
+
+    /* Create the heap and the lock of every heap */
+    for (size_t iter = 0; iter < number_of_heaps; ++iter) {
+        multi_queue_heap_t * const heap = &new_mqueue->heaps[iter];
+
+        atomic_init(&heap->size, 0);
+
+        /* The multi queue frees the elements, the heaps just move them */
+        heap->heap = create_flat_priority_queue(0, 0, cmp_pr, NULL, NULL, pri_size, data_size);
+
+        if ((NULL == heap->heap) || (0 != pthread_mutex_init(&heap->lock, NULL))) {
+
+            /* Wipe the heaps created until now */
+            free_flat_priority_queue(heap->heap);
+
+            for (size_t destroy_iter = 0; destroy_iter < iter; ++destroy_iter) {
+                pthread_mutex_destroy(&new_mqueue->heaps[destroy_iter].lock);
+                free_flat_priority_queue(new_mqueue->heaps[destroy_iter].heap);
+            }
+
+            scl_free(allocator, new_mqueue->heaps_memory);
+            scl_free(allocator, new_mqueue);
+
+            errno = ENOMEM;
+            perror("Not enough memory for multi queue heap allocation");
+            return NULL;
+        }
+    }
+
+    /* Return a new allocated multi queue */
+    return new_mqueue;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * multi queue object, the content of every element is freed as well.
+ * No other thread may use the multi queue while it is freed.
+ * 
+ * @param mqueue pointer to an allocated multi queue memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_multi_queue(multi_queue_t * const __restrict__ mqueue) {
+    /* Check if multi queue needs to be freed */
+    if (NULL == mqueue) {
+        return SCL_NULL_MULTI_QUEUE;
+    }
+
+    /* Free every heap */
+    for (size_t iter = 0; iter < mqueue->number_of_heaps; ++iter) {
+        multi_queue_heap_t * const heap = &mqueue->heaps[iter];
+
+        multi_queue_clear_heap(mqueue, heap);
+
+        pthread_mutex_destroy(&heap->lock);
+        free_flat_priority_queue(heap->heap);
+    }
+
+    /* Free the heaps array and the object */
+    scl_free(mqueue->allocator, mqueue->heaps_memory);
+    scl_free(mqueue->allocator, mqueue);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to push one element into a random heap of the multi queue.
+ * The heaps are tried without waiting up to MULTI_QUEUE_ATTEMPTS times, so a
+ * thread waits for a lock just if all the tried heaps were busy. The priority
+ * and the data are copied into the heap.
+ * 
+ * @param mqueue pointer to an allocated multi queue
+ * @param priority pointer to the priority of the element
+ * @param data pointer to the data of the element (`NULL` if data size is zero)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t multi_queue_push(multi_queue_t * const __restrict__ mqueue, const void * const priority, const void * const data) {
+    /* Check if multi queue is allocated */
+    if (NULL == mqueue) {
+        return SCL_NULL_MULTI_QUEUE;
+    }
+
+    /* Check if input data is valid */
+    if ((NULL == priority) || ((0 != mqueue->data_size) && (NULL == data))) {
+        return SCL_INVALID_INPUT;
+    }
+
+    multi_queue_heap_t *heap = NULL;
+
+    /* Take the first random heap that is not locked */
+    for (size_t attempt = 0; (NULL == heap) && (attempt < MULTI_QUEUE_ATTEMPTS); ++attempt) {
+        multi_queue_heap_t * const try_heap = multi_queue_random_heap(mqueue);
+
+        if (0 == pthread_mutex_trylock(&try_heap->lock)) {
+            heap = try_heap;
+        }
+    }
+
+    /* Every tried heap was busy, wait for one */
+    if (NULL == heap) {
+        heap = multi_queue_random_heap(mqueue);
+
+        if (0 != pthread_mutex_lock(&heap->lock)) {
+            return SCL_MULTI_QUEUE_LOCK_FAILED;
+        }
+    }
+
+    scl_error_t err = flat_pri_queue_push(heap->heap, priority, data);
+
+    if (SCL_OK == err) {
+        atomic_fetch_add_explicit(&heap->size, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&mqueue->size, 1, memory_order_relaxed);
+    }
+
+    pthread_mutex_unlock(&heap->lock);
+
+    return err;
+}
+
+/**
+ * @brief Function to pop one of the best elements of the multi queue. Two random
+ * heaps are selected and the better one of their tops is popped (the power of two
+ * choices), heaps that look empty or are locked are skipped and other heaps are
+ * tried. If no element is found so, every heap is looked at in turn before the
+ * queue is reported empty. The popped element is copied into the buffers and it
+ * belongs to the caller, a part without buffer is freed.
+ * 
+ * @param mqueue pointer to an allocated multi queue
+ * @param priority buffer of pri_size bytes for the priority, can be `NULL`
+ * @param data buffer of data_size bytes for the data, can be `NULL`
+ * @return scl_error_t enum object for handling errors (SCL_DELETE_FROM_EMPTY_OBJECT
+ * if the multi queue is empty)
+ */
+scl_error_t multi_queue_pop(multi_queue_t * const __restrict__ mqueue, void * const priority, void * const data) {
+    /* Check if multi queue is allocated */
+    if (NULL == mqueue) {
+        return SCL_NULL_MULTI_QUEUE;
+    }
+
+    if (0 == atomic_load_explicit(&mqueue->size, memory_order_relaxed)) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    for (size_t attempt = 0; attempt < MULTI_QUEUE_ATTEMPTS; ++attempt) {
+        multi_queue_heap_t *first = multi_queue_random_heap(mqueue);
+        multi_queue_heap_t *second = multi_queue_random_heap(mqueue);
+
+        /* Heaps that look empty are not locked */
+        if (0 == atomic_load_explicit(&first->size, memory_order_relaxed)) {
+            first = second;
+            second = NULL;
+        }
+
+        if ((NULL != second) && ((first == second) || (0 == atomic_load_explicit(&second->size, memory_order_relaxed)))) {
+            second = NULL;
+        }
+
+        if ((0 == atomic_load_explicit(&first->size, memory_order_relaxed)) || (0 != pthread_mutex_trylock(&first->lock))) {
+            continue;
+        }
+
+        /* The second heap is just tried, so two threads never wait for each other */
+        if ((NULL != second) && (0 != pthread_mutex_trylock(&second->lock))) {
+            second = NULL;
+        }
+
+        multi_queue_heap_t *best = (0 != flat_pri_queue_size(first->heap)) ? first : NULL;
+
+        if ((NULL != second) && (0 != flat_pri_queue_size(second->heap))) {
+            if ((NULL == best) || (mqueue->cmp_pr(flat_pri_queue_top_pri(second->heap), flat_pri_queue_top_pri(first->heap)) > 0)) {
+                best = second;
+            }
+        }
+
+        if (NULL != best) {
+            multi_queue_take_top(mqueue, best, priority, data);
+        }
+
+        if (NULL != second) {
+            pthread_mutex_unlock(&second->lock);
+        }
+
+        pthread_mutex_unlock(&first->lock);
+
+        if (NULL != best) {
+            return SCL_OK;
+        }
+    }
+
+    /* No element was found by the random heaps, look at every heap in turn */
+    const size_t start = (size_t)(multi_queue_random_heap(mqueue) - mqueue->heaps);
+
+    for (size_t iter = 0; iter < mqueue->number_of_heaps; ++iter) {
+        multi_queue_heap_t * const heap = &mqueue->heaps[(start + iter) % mqueue->number_of_heaps];
+
+        if (0 == atomic_load_explicit(&heap->size, memory_order_relaxed)) {
+            continue;
+        }
+
+        if (0 != pthread_mutex_lock(&heap->lock)) {
+            return SCL_MULTI_QUEUE_LOCK_FAILED;
+        }
+
+        const uint8_t found = (0 != flat_pri_queue_size(heap->heap));
+
+        if (0 != found) {
+            multi_queue_take_top(mqueue, heap, priority, data);
+        }
+
+        pthread_mutex_unlock(&heap->lock);
+
+        if (0 != found) {
+            return SCL_OK;
+        }
+    }
+
+    /* Every heap was empty */
+    return SCL_DELETE_FROM_EMPTY_OBJECT;
+}
+
+/**
+ * @brief Function to remove every element of the multi queue, the content
+ * of every element is freed. Every heap is locked in turn, so elements pushed
+ * meanwhile into the heaps cleared before may stay in the queue.
+ * 
+ * @param mqueue pointer to an allocated multi queue
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t multi_queue_clear(multi_queue_t * const __restrict__ mqueue) {
+    /* Check if multi queue is allocated */
+    if (NULL == mqueue) {
+        return SCL_NULL_MULTI_QUEUE;
+    }
+
+    for (size_t iter = 0; iter < mqueue->number_of_heaps; ++iter) {
+        multi_queue_heap_t * const heap = &mqueue->heaps[iter];
+
+        if (0 != pthread_mutex_lock(&heap->lock)) {
+            return SCL_MULTI_QUEUE_LOCK_FAILED;
+        }
+
+        multi_queue_clear_heap(mqueue, heap);
+
+        pthread_mutex_unlock(&heap->lock);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the number of elements of the multi queue. The counter is
+ * changed by every push and pop without a lock held on all the heaps, so
+ * while other threads use the queue the value is just a snapshot.
+ * 
+ * @param mqueue pointer to an allocated multi queue
+ * @return size_t number of elements or SIZE_MAX if multi queue is not allocated
+ */
+size_t get_multi_queue_size(const multi_queue_t * const __restrict__ mqueue) {
+    if (NULL == mqueue) {
+        return SIZE_MAX;
+    }
+
+    return atomic_load_explicit(&mqueue->size, memory_order_relaxed);
+}
+
+/**
+ * @brief Get the number of heaps of the multi queue.
+ * 
+ * @param mqueue pointer to an allocated multi queue
+ * @return size_t number of heaps or 0 if multi queue is not allocated
+ */
+size_t get_multi_queue_heaps(const multi_queue_t * const __restrict__ mqueue) {
+    if (NULL == mqueue) {
+        return 0;
+    }
+
+    return mqueue->number_of_heaps;
+}
+
+/**
+ * @brief Function to check if the multi queue has no element, a snapshot
+ * as **get_multi_queue_size**.
+ * 
+ * @param mqueue pointer to an allocated multi queue
+ * @return uint8_t 1 if multi queue is empty (or not allocated) or 0 otherwise
+ */
+uint8_t is_multi_queue_empty(const multi_queue_t * const __restrict__ mqueue) {
+    if (NULL == mqueue) {
+        return 1;
+    }
+
+    return (0 == atomic_load_explicit(&mqueue->size, memory_order_relaxed));
+}
@@ -0,0 +1,1023 @@
+/**
+ * @file scl_persistent_rbk_tree.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_persistent_rbk_tree.h"
+#include <sched.h>
+
+/* Offset in bytes of the data inside its shared block, after the reference counter */
+#define PRBK_DATA_OFFSET SCL_ALIGN_SIZE(sizeof(atomic_size_t))
+
+/**
+ * @brief Function to get the reference counter of a data block, the
+ * counter is stored right before the data, in the same block.
+ *
+ * @param data pointer to the data of a node
+ * @return atomic_size_t* pointer to the reference counter of the data
+ */
+static inline atomic_size_t* prbk_data_refs(const void * const __restrict__ data) {
+    return (atomic_size_t *)((uint8_t *)data - PRBK_DATA_OFFSET);
+}
+
+/* Source of the stripe indexes of the threads */
+static atomic_size_t prbk_next_stripe = 0;
+
+/* Reader stripe index of the calling thread, SIZE_MAX until it is selected */
+static _Thread_local size_t prbk_thread_stripe = SIZE_MAX;
+
+/**
+ * @brief Function to get the reader stripe of the calling thread, the
+ * threads take the stripes round robin on their first acquire or release.
+ * Function MUST not be used outside this file.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @return prbk_reader_stripe_t* the reader stripe of the calling thread
+ */
+static prbk_reader_stripe_t* prbk_reader_stripe(const prbk_tree_t * const __restrict__ tree) {
+    if (SIZE_MAX == prbk_thread_stripe) {
+        prbk_thread_stripe = atomic_fetch_add_explicit(&prbk_next_stripe, 1, memory_order_relaxed) % PRBK_READER_STRIPES;
+    }
+
+    return &tree->stripes[prbk_thread_stripe];
+}
+
+/**
+ * @brief Function to create a persistent red-black tree object. The tree
+ * starts with an empty published snapshot, so the readers may acquire
+ * snapshots right after the creation. If the allocation fails an
+ * exception is thrown and `NULL` is returned.
+ *
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free the content of data
+ * @param data_size length in bytes of the data data type
+ * @return prbk_tree_t* a new allocated persistent red-black tree or `NULL`
+ */
+prbk_tree_t* create_prbk(compare_func cmp, free_func frd, size_t data_size) {
+    /* Check if compare function is valid */
+    if (NULL == cmp) {
+        errno = EINVAL;
+        perror("Compare function undefined for persistent red-black tree");
+        return NULL;
+    }
+
+    /* Check if the data size of one node is valid */
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new persistent red-black tree object and its first snapshot */
+    prbk_tree_t *new_tree = scl_malloc(allocator, sizeof(*new_tree));
+
+    if (NULL == new_tree) {
+        errno = ENOMEM;
+        perror("Not enough memory for persistent red-black allocation");
+        return NULL;
+    }
+
+    /*
+     * Allocate the reader stripes, the allocator guarantees just the malloc
+     * alignment so one more cache line is taken to align the array
+     */
+    new_tree->stripes_memory = scl_malloc(allocator, sizeof(*new_tree->stripes) * PRBK_READER_STRIPES + PRBK_READER_STRIPE_ALIGN - 1);
+
+    if (NULL == new_tree->stripes_memory) {
+        scl_free(allocator, new_tree);
+
+        errno = ENOMEM;
+        perror("Not enough memory for persistent red-black reader stripes allocation");
+        return NULL;
+    }
+
+    prbk_snapshot_t *empty_snapshot = scl_malloc(allocator, sizeof(*empty_snapshot));
+
+    if (NULL == empty_snapshot) {
+        scl_free(allocator, new_tree->stripes_memory);
+        scl_free(allocator, new_tree);
+
+        errno = ENOMEM;
+        perror("Not enough memory for persistent red-black snapshot allocation");
+        return NULL;
+    }
+
+    /* The tree holds the reference of its current snapshot */
+    empty_snapshot->root = NULL;
+    empty_snapshot->size = 0;
+    empty_snapshot->tree = new_tree;
+    atomic_init(&empty_snapshot->refs, 1);
+
+    atomic_init(&new_tree->current, empty_snapshot);
+    atomic_init(&new_tree->epoch, 0);
+
+    /* Every reader stripe starts on its own cache line */
+    new_tree->stripes = (prbk_reader_stripe_t *)(((uintptr_t)new_tree->stripes_memory + PRBK_READER_STRIPE_ALIGN - 1) & ~(uintptr_t)(PRBK_READER_STRIPE_ALIGN - 1));
+
+    for (size_t iter = 0; iter < PRBK_READER_STRIPES; ++iter) {
+        atomic_init(&new_tree->stripes[iter].acquiring[0], 0);
+        atomic_init(&new_tree->stripes[iter].acquiring[1], 0);
+        atomic_init(&new_tree->stripes[iter].readers, 0);
+    }
+
+    new_tree->root = NULL;
+    new_tree->spare = NULL;
+    new_tree->spare_count = 0;
+    new_tree->stamp = 1;
+    new_tree->cmp = cmp;
+    new_tree->frd = frd;
+    new_tree->data_size = data_size;
+    new_tree->size = 0;
+    new_tree->allocator = allocator;
+
+    /* Return a new allocated persistent red-black tree object */
+    return new_tree;
+}
+
+/**
+ * @brief Function to drop one reference of a data block. The last
+ * reference frees the content of the data and the block.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param data pointer to the data of a node
+ */
+static void prbk_release_data(const prbk_tree_t * const __restrict__ tree, void * const __restrict__ data) {
+    if (1 == atomic_fetch_sub_explicit(prbk_data_refs(data), 1, memory_order_acq_rel)) {
+        if (NULL != tree->frd) {
+            tree->frd(data);
+        }
+
+        scl_free(tree->allocator, (uint8_t *)data - PRBK_DATA_OFFSET);
+    }
+}
+
+/**
+ * @brief Function to drop one reference of a node. The last reference
+ * frees the node and drops the references the node holds to its children
+ * and to its data, so only the nodes that no version reaches are freed.
+ * The function may run on any thread that releases a snapshot.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param node a node of the tree or `NULL`
+ */
+static void prbk_release_node(const prbk_tree_t * const __restrict__ tree, prbk_tree_node_t * const __restrict__ node) {
+    if ((NULL == node) || (1 != atomic_fetch_sub_explicit(&node->refs, 1, memory_order_acq_rel))) {
+        return;
+    }
+
+    prbk_release_node(tree, node->left);
+    prbk_release_node(tree, node->right);
+    prbk_release_data(tree, node->data);
+
+    scl_free(tree->allocator, node);
+}
+
+/**
+ * @brief Function to add one reference to a node.
+ *
+ * @param node a node of the tree or `NULL`
+ */
+static inline void prbk_retain_node(prbk_tree_node_t * const __restrict__ node) {
+    if (NULL != node) {
+        atomic_fetch_add_explicit(&node->refs, 1, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Function to drop the reference of a snapshot. The last reference
+ * frees the snapshot and drops the reference of its root.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param snapshot a snapshot published by the tree
+ */
+static void prbk_snapshot_put(const prbk_tree_t * const __restrict__ tree, prbk_snapshot_t * const __restrict__ snapshot) {
+    if (1 == atomic_fetch_sub_explicit(&snapshot->refs, 1, memory_order_acq_rel)) {
+        prbk_release_node(tree, snapshot->root);
+        scl_free(tree->allocator, snapshot);
+    }
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * persistent red-black tree object. The nodes of the working version and
+ * of the current snapshot are freed, the content of data is freed by the
+ * frd function provided at creation. The function fails if any reader
+ * still holds a snapshot of the tree.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_prbk(prbk_tree_t * const __restrict__ tree) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        return SCL_NULL_PRBK;
+    }
+
+    /* A snapshot may be released by another thread, so just the sum of the stripes is exact */
+    size_t readers = 0;
+
+    for (size_t iter = 0; iter < PRBK_READER_STRIPES; ++iter) {
+        readers += atomic_load_explicit(&tree->stripes[iter].readers, memory_order_acquire);
+    }
+
+    if (0 != readers) {
+        return SCL_SNAPSHOTS_IN_USE;
+    }
+
+    prbk_release_node(tree, tree->root);
+    prbk_snapshot_put(tree, atomic_load_explicit(&tree->current, memory_order_relaxed));
+
+    /* Free the reserved nodes */
+    while (NULL != tree->spare) {
+        prbk_tree_node_t *next_spare = tree->spare->left;
+
+        scl_free(tree->allocator, tree->spare);
+        tree->spare = next_spare;
+    }
+
+    scl_free(tree->allocator, tree->stripes_memory);
+    scl_free(tree->allocator, tree);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to reserve the free nodes needed by one update. An
+ * update copies a bounded number of nodes on every level and the height
+ * of a left-leaning red-black tree is at most 2 * log(N + 1), so after the
+ * reservation the update cannot fail halfway and leave a broken version.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t prbk_reserve(prbk_tree_t * const __restrict__ tree) {
+    size_t levels = 2;
+
+    for (size_t nodes = tree->size + 1; nodes > 1; nodes >>= 1) {
+        levels += 2;
+    }
+
+    const size_t need = PRBK_COPIES_PER_LEVEL * levels + 1;
+
+    while (tree->spare_count < need) {
+        prbk_tree_node_t *new_node = scl_malloc(tree->allocator, sizeof(*new_node));
+
+        if (NULL == new_node) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        new_node->left = tree->spare;
+        tree->spare = new_node;
+        ++(tree->spare_count);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to take one reserved node, the node belongs to the
+ * working version.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @return prbk_tree_node_t* a free node
+ */
+static prbk_tree_node_t* prbk_take_node(prbk_tree_t * const __restrict__ tree) {
+    prbk_tree_node_t *new_node = tree->spare;
+
+    tree->spare = new_node->left;
+    --(tree->spare_count);
+
+    new_node->stamp = tree->stamp;
+    atomic_init(&new_node->refs, 1);
+
+    return new_node;
+}
+
+/**
+ * @brief Function to get a node that the writer may change. A node created
+ * after the last publish is reached only by the working version and is
+ * returned as it is, any other node is copied. The reference of the caller
+ * moves from the node to its copy, the copy shares the children and the
+ * data with the node.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param node a node of the working version
+ * @return prbk_tree_node_t* the node or its private copy
+ */
+static prbk_tree_node_t* prbk_own(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t * const __restrict__ node) {
+    if (tree->stamp == node->stamp) {
+        return node;
+    }
+
+    prbk_tree_node_t *copy_node = prbk_take_node(tree);
+
+    copy_node->data = node->data;
+    copy_node->left = node->left;
+    copy_node->right = node->right;
+    copy_node->count = node->count;
+    copy_node->color = node->color;
+
+    atomic_fetch_add_explicit(prbk_data_refs(node->data), 1, memory_order_relaxed);
+    prbk_retain_node(node->left);
+    prbk_retain_node(node->right);
+
+    prbk_release_node(tree, node);
+
+    return copy_node;
+}
+
+/**
+ * @brief Function to check if a node is red, `NULL` leaves are black.
+ *
+ * @param node a node of the tree or `NULL`
+ * @return uint8_t 1 if the node is red, 0 otherwise
+ */
+static inline uint8_t prbk_is_red(const prbk_tree_node_t * const __restrict__ node) {
+    return (NULL != node) && (RED == node->color);
+}
+
+/**
+ * @brief Function to rotate a private node to the left.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param node a private node with a red right child
+ * @return prbk_tree_node_t* the new (private) root of the subtree
+ */
+static prbk_tree_node_t* prbk_rotate_left(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t * const __restrict__ node) {
+    prbk_tree_node_t *right_node = prbk_own(tree, node->right);
+
+    node->right = right_node->left;
+    right_node->left = node;
+
+    right_node->color = node->color;
+    node->color = RED;
+
+    return right_node;
+}
+
+/**
+ * @brief Function to rotate a private node to the right.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param node a private node with a red left child
+ * @return prbk_tree_node_t* the new (private) root of the subtree
+ */
+static prbk_tree_node_t* prbk_rotate_right(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t * const __restrict__ node) {
+    prbk_tree_node_t *left_node = prbk_own(tree, node->left);
+
+    node->left = left_node->right;
+    left_node->right = node;
+
+    left_node->color = node->color;
+    node->color = RED;
+
+    return left_node;
+}
+
+/**
+ * @brief Function to flip the colors of a private node and of its
+ * two children.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param node a private node with two children
+ */
+static void prbk_flip_colors(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t * const __restrict__ node) {
+    node->left = prbk_own(tree, node->left);
+    node->right = prbk_own(tree, node->right);
+
+    node->color = (RED == node->color) ? BLACK : RED;
+    node->left->color = (RED == node->left->color) ? BLACK : RED;
+    node->right->color = (RED == node->right->color) ? BLACK : RED;
+}
+
+/**
+ * @brief Function to restore the left-leaning red-black rules of
+ * a private node on the way back from an update.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param node a private node
+ * @return prbk_tree_node_t* the new (private) root of the subtree
+ */
+static prbk_tree_node_t* prbk_balance(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t *node) {
+    if (prbk_is_red(node->right) && !prbk_is_red(node->left)) {
+        node = prbk_rotate_left(tree, node);
+    }
+
+    if (prbk_is_red(node->left) && prbk_is_red(node->left->left)) {
+        node = prbk_rotate_right(tree, node);
+    }
+
+    if (prbk_is_red(node->left) && prbk_is_red(node->right)) {
+        prbk_flip_colors(tree, node);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Helper function to insert one data into a subtree, the nodes
+ * of the path are copied (unless private) and the rest is shared.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param root root of the subtree or `NULL`
+ * @param data pointer to the data to insert
+ * @param new_data shared data block of the new node (`NULL` if data exists)
+ * @return prbk_tree_node_t* the new (private) root of the subtree
+ */
+static prbk_tree_node_t* prbk_insert_helper(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t *root, const void * const __restrict__ data, void * const __restrict__ new_data) {
+    if (NULL == root) {
+        prbk_tree_node_t *new_node = prbk_take_node(tree);
+
+        new_node->data = new_data;
+        new_node->left = new_node->right = NULL;
+        new_node->count = 1;
+        new_node->color = RED;
+
+        return new_node;
+    }
+
+    root = prbk_own(tree, root);
+
+    const int32_t compare = tree->cmp(data, root->data);
+
+    if (compare < 0) {
+        root->left = prbk_insert_helper(tree, root->left, data, new_data);
+    } else if (compare > 0) {
+        root->right = prbk_insert_helper(tree, root->right, data, new_data);
+    } else {
+        ++(root->count);
+    }
+
+    return prbk_balance(tree, root);
+}
+
+/**
+ * @brief Function to insert one generic data into the working version of
+ * a persistent red-black tree, inserting an existing data increments its
+ * count. The published snapshots do not change, the insertion becomes
+ * visible to the readers after prbk_publish. Only the writer thread may
+ * call the function.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param data pointer to an address of a generic data type
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t prbk_insert(prbk_tree_t * const __restrict__ tree, const void * __restrict__ data) {
+    /* Check if tree and data are valid */
+    if (NULL == tree) {
+        return SCL_NULL_PRBK;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    scl_error_t err = prbk_reserve(tree);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    /* A new data gets its own block, shared later by all the copies of its node */
+    void *new_data = NULL;
+
+    if (NULL == prbk_find_data(tree, data)) {
+        uint8_t *data_block = scl_malloc(tree->allocator, PRBK_DATA_OFFSET + tree->data_size);
+
+        if (NULL == data_block) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        atomic_init((atomic_size_t *)data_block, 1);
+
+        new_data = data_block + PRBK_DATA_OFFSET;
+        memcpy(new_data, data, tree->data_size);
+
+        ++(tree->size);
+    }
+
+    tree->root = prbk_insert_helper(tree, tree->root, data, new_data);
+    tree->root->color = BLACK;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move a red link to the left child of a private node.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param node a private node
+ * @return prbk_tree_node_t* the new (private) root of the subtree
+ */
+static prbk_tree_node_t* prbk_move_red_left(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t *node) {
+    prbk_flip_colors(tree, node);
+
+    if (prbk_is_red(node->right->left)) {
+        node->right = prbk_rotate_right(tree, node->right);
+        node = prbk_rotate_left(tree, node);
+        prbk_flip_colors(tree, node);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Function to move a red link to the right child of a private node.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param node a private node
+ * @return prbk_tree_node_t* the new (private) root of the subtree
+ */
+static prbk_tree_node_t* prbk_move_red_right(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t *node) {
+    prbk_flip_colors(tree, node);
+
+    if (prbk_is_red(node->left->left)) {
+        node = prbk_rotate_right(tree, node);
+        prbk_flip_colors(tree, node);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Helper function to delete the minimum node of a subtree.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param root root of a non-empty subtree
+ * @return prbk_tree_node_t* the new (private) root of the subtree or `NULL`
+ */
+static prbk_tree_node_t* prbk_delete_min_helper(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t *root) {
+    /* A node without left child has no right child either */
+    if (NULL == root->left) {
+        prbk_release_node(tree, root);
+        return NULL;
+    }
+
+    root = prbk_own(tree, root);
+
+    if (!prbk_is_red(root->left) && !prbk_is_red(root->left->left)) {
+        root = prbk_move_red_left(tree, root);
+    }
+
+    root->left = prbk_delete_min_helper(tree, root->left);
+
+    return prbk_balance(tree, root);
+}
+
+/**
+ * @brief Helper function to delete one data from a subtree, the data
+ * must exist in the subtree.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param root root of a non-empty subtree
+ * @param data pointer to the data to delete
+ * @return prbk_tree_node_t* the new (private) root of the subtree or `NULL`
+ */
+static prbk_tree_node_t* prbk_delete_helper(prbk_tree_t * const __restrict__ tree, prbk_tree_node_t *root, const void * const __restrict__ data) {
+    root = prbk_own(tree, root);
+
+    if (tree->cmp(data, root->data) < 0) {
+        if (!prbk_is_red(root->left) && !prbk_is_red(root->left->left)) {
+            root = prbk_move_red_left(tree, root);
+        }
+
+        root->left = prbk_delete_helper(tree, root->left, data);
+    } else {
+        if (prbk_is_red(root->left)) {
+            root = prbk_rotate_right(tree, root);
+        }
+
+        if ((0 == tree->cmp(data, root->data)) && (NULL == root->right)) {
+            prbk_release_node(tree, root);
+            return NULL;
+        }
+
+        if (!prbk_is_red(root->right) && !prbk_is_red(root->right->left)) {
+            root = prbk_move_red_right(tree, root);
+        }
+
+        if (0 == tree->cmp(data, root->data)) {
+            /* Replace the data with the data of the successor and delete the successor */
+            const prbk_tree_node_t *successor = root->right;
+
+            while (NULL != successor->left) {
+                successor = successor->left;
+            }
+
+            atomic_fetch_add_explicit(prbk_data_refs(successor->data), 1, memory_order_relaxed);
+            prbk_release_data(tree, root->data);
+
+            root->data = successor->data;
+            root->count = successor->count;
+            root->right = prbk_delete_min_helper(tree, root->right);
+        } else {
+            root->right = prbk_delete_helper(tree, root->right, data);
+        }
+    }
+
+    return prbk_balance(tree, root);
+}
+
+/**
+ * @brief Function to delete one data (with all its copies) from the
+ * working version of a persistent red-black tree. The nodes are freed
+ * when no published snapshot reaches them anymore. Only the writer
+ * thread may call the function.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param data pointer to an address of a generic data type
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t prbk_delete(prbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if tree and data are valid */
+    if (NULL == tree) {
+        return SCL_NULL_PRBK;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* A missing data must not copy the path */
+    if (NULL == prbk_find_data(tree, data)) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    scl_error_t err = prbk_reserve(tree);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    if (!prbk_is_red(tree->root->left) && !prbk_is_red(tree->root->right)) {
+        tree->root = prbk_own(tree, tree->root);
+        tree->root->color = RED;
+    }
+
+    tree->root = prbk_delete_helper(tree, tree->root, data);
+
+    if (NULL != tree->root) {
+        tree->root->color = BLACK;
+    }
+
+    --(tree->size);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search a data in a subtree O(log N).
+ *
+ * @param cmp function to compare two elements
+ * @param root root of the subtree or `NULL`
+ * @param data pointer to the data to search
+ * @return const void* the data of the tree equal to data or `NULL`
+ */
+static const void* prbk_find_helper(compare_func cmp, const prbk_tree_node_t *root, const void * const __restrict__ data) {
+    while (NULL != root) {
+        const int32_t compare = cmp(data, root->data);
+
+        if (0 == compare) {
+            return root->data;
+        }
+
+        root = (compare < 0) ? root->left : root->right;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to search data in the working version of a persistent
+ * red-black tree O(log N). Only the writer thread may call the function,
+ * the readers search their snapshots.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param data pointer to an address of a generic data type
+ * @return const void* the data of the tree equal to data or `NULL`
+ */
+const void* prbk_find_data(const prbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    return prbk_find_helper(tree->cmp, tree->root, data);
+}
+
+/**
+ * @brief Function to check if the working version of a persistent
+ * red-black tree is empty.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @return uint8_t 1 if the tree is empty or not allocated, 0 otherwise
+ */
+uint8_t is_prbk_empty(const prbk_tree_t * const __restrict__ tree) {
+    if ((NULL == tree) || (NULL == tree->root)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Function to get the number of nodes of the working version
+ * of a persistent red-black tree.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @return size_t the number of nodes or SIZE_MAX if tree is not allocated
+ */
+size_t get_prbk_size(const prbk_tree_t * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SIZE_MAX;
+    }
+
+    return tree->size;
+}
+
+/**
+ * @brief Function to publish the working version of a persistent red-black
+ * tree. The new snapshot replaces the current one with a single atomic
+ * store, the readers that hold the old snapshot keep reading it and the
+ * nodes reached only by the old snapshot are freed by its last release.
+ * Several updates may be published at once, they become visible together.
+ * The function blocks until the readers that were in prbk_acquire_snapshot
+ * when it started have referenced their snapshot, the later readers and the
+ * readers holding snapshots are not waited for.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t prbk_publish(prbk_tree_t * const __restrict__ tree) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        return SCL_NULL_PRBK;
+    }
+
+    prbk_snapshot_t *old_snapshot = atomic_load_explicit(&tree->current, memory_order_relaxed);
+
+    /* Every update copies the root, so an unchanged root means nothing to publish */
+    if (old_snapshot->root == tree->root) {
+        return SCL_OK;
+    }
+
+    prbk_snapshot_t *new_snapshot = scl_malloc(tree->allocator, sizeof(*new_snapshot));
+
+    if (NULL == new_snapshot) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    prbk_retain_node(tree->root);
+
+    new_snapshot->root = tree->root;
+    new_snapshot->size = tree->size;
+    new_snapshot->tree = tree;
+    atomic_init(&new_snapshot->refs, 1);
+
+    atomic_exchange(&tree->current, new_snapshot);
+
+    /*
+     * A reader that loaded the old snapshot has not referenced it yet
+     * until it leaves the acquiring section. The readers that start after
+     * the epoch changes count in the other parity and load the new snapshot,
+     * so just the readers already acquiring are waited for
+     */
+    const size_t parity = atomic_fetch_add(&tree->epoch, 1) & 1;
+
+    for (size_t iter = 0; iter < PRBK_READER_STRIPES; ++iter) {
+        while (0 != atomic_load(&tree->stripes[iter].acquiring[parity])) {
+            sched_yield();
+        }
+    }
+
+    prbk_snapshot_put(tree, old_snapshot);
+
+    /* The published nodes are shared from now on */
+    ++(tree->stamp);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to acquire the current snapshot of a persistent red-black
+ * tree. Any thread may call the function, the snapshot stays valid (and
+ * unchanged) until the thread releases it with prbk_release_snapshot. The
+ * function never waits for the writer, the threads count themselves on
+ * PRBK_READER_STRIPES cache lines of counters and share just the reference
+ * counter of the current snapshot.
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @return const prbk_snapshot_t* the current snapshot or `NULL` if tree is not allocated
+ */
+const prbk_snapshot_t* prbk_acquire_snapshot(prbk_tree_t * const __restrict__ tree) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        return NULL;
+    }
+
+    prbk_reader_stripe_t * const stripe = prbk_reader_stripe(tree);
+    const size_t parity = atomic_load(&tree->epoch) & 1;
+
+    atomic_fetch_add_explicit(&stripe->readers, 1, memory_order_relaxed);
+    atomic_fetch_add(&stripe->acquiring[parity], 1);
+
+    prbk_snapshot_t *snapshot = atomic_load(&tree->current);
+    atomic_fetch_add_explicit(&snapshot->refs, 1, memory_order_relaxed);
+
+    atomic_fetch_sub_explicit(&stripe->acquiring[parity], 1, memory_order_release);
+
+    return snapshot;
+}
+
+/**
+ * @brief Function to release a snapshot acquired from a persistent red-black
+ * tree. If the snapshot is not current anymore and this was its last
+ * reference, the nodes reached only by it are freed on the calling thread
+ * (the frd function and the allocator must be thread safe).
+ *
+ * @param tree an allocated persistent red-black tree object
+ * @param snapshot a snapshot acquired from the tree
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t prbk_release_snapshot(prbk_tree_t * const __restrict__ tree, const prbk_snapshot_t * const __restrict__ snapshot) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        return SCL_NULL_PRBK;
+    }
+
+    if ((NULL == snapshot) || (tree != snapshot->tree)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    prbk_snapshot_put(tree, (prbk_snapshot_t *)snapshot);
+    atomic_fetch_sub_explicit(&prbk_reader_stripe(tree)->readers, 1, memory_order_release);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search data in a snapshot of a persistent red-black
+ * tree O(log N).
+ *
+ * @param snapshot an acquired snapshot
+ * @param data pointer to an address of a generic data type
+ * @return const void* the data of the snapshot equal to data or `NULL`
+ */
+const void* prbk_snapshot_find_data(const prbk_snapshot_t * const __restrict__ snapshot, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == snapshot) || (NULL == data)) {
+        return NULL;
+    }
+
+    return prbk_find_helper(snapshot->tree->cmp, snapshot->root, data);
+}
+
+/**
+ * @brief Function to find the first data of a snapshot that is not
+ * smaller than data O(log N).
+ *
+ * @param snapshot an acquired snapshot
+ * @param data pointer to an address of a generic data type
+ * @return const void* the first data greater than or equal to data or `NULL`
+ */
+const void* prbk_snapshot_lower_bound(const prbk_snapshot_t * const __restrict__ snapshot, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == snapshot) || (NULL == data)) {
+        return NULL;
+    }
+
+    const prbk_tree_node_t *iterator = snapshot->root;
+    const void *bound = NULL;
+
+    while (NULL != iterator) {
+        if (snapshot->tree->cmp(iterator->data, data) >= 0) {
+            bound = iterator->data;
+            iterator = iterator->left;
+        } else {
+            iterator = iterator->right;
+        }
+    }
+
+    return bound;
+}
+
+/**
+ * @brief Function to get the number of nodes of a snapshot.
+ *
+ * @param snapshot an acquired snapshot
+ * @return size_t the number of nodes or SIZE_MAX if snapshot is `NULL`
+ */
+size_t get_prbk_snapshot_size(const prbk_snapshot_t * const __restrict__ snapshot) {
+    if (NULL == snapshot) {
+        return SIZE_MAX;
+    }
+
+    return snapshot->size;
+}
+
+/**
+ * @brief Helper function to call action for the data of a subtree from
+ * [lo, hi) in ascending order, `NULL` bounds are not checked.
+ *
+ * @param cmp function to compare two elements
+ * @param root root of the subtree or `NULL`
+ * @param lo first data of the range or `NULL`
+ * @param hi data after the range or `NULL`
+ * @param action a pointer function to perform an action on one data
+ */
+static void prbk_range_helper(compare_func cmp, const prbk_tree_node_t * const __restrict__ root, const void * const lo, const void * const hi, action_func action) {
+    if (NULL == root) {
+        return;
+    }
+
+    const uint8_t above_lo = (NULL == lo) || (cmp(root->data, lo) >= 0);
+    const uint8_t below_hi = (NULL == hi) || (cmp(root->data, hi) < 0);
+
+    if (above_lo) {
+        prbk_range_helper(cmp, root->left, lo, hi, action);
+    }
+
+    if (above_lo && below_hi) {
+        action(root->data);
+    }
+
+    if (below_hi) {
+        prbk_range_helper(cmp, root->right, lo, hi, action);
+    }
+}
+
+/**
+ * @brief Function to call action for every data of a snapshot from [lo, hi)
+ * in ascending order. The data of a snapshot is shared with other versions,
+ * the action MUST NOT change it.
+ *
+ * @param snapshot an acquired snapshot
+ * @param lo first data of the range
+ * @param hi data after the range
+ * @param action a pointer function to perform an action on one data
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t prbk_snapshot_range(const prbk_snapshot_t * const __restrict__ snapshot, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == snapshot) {
+        return SCL_NULL_PRBK;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    prbk_range_helper(snapshot->tree->cmp, snapshot->root, lo, hi, action);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to call action for every data of a snapshot in
+ * ascending order. The data of a snapshot is shared with other versions,
+ * the action MUST NOT change it.
+ *
+ * @param snapshot an acquired snapshot
+ * @param action a pointer function to perform an action on one data
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t prbk_snapshot_traverse_inorder(const prbk_snapshot_t * const __restrict__ snapshot, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == snapshot) {
+        return SCL_NULL_PRBK;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    prbk_range_helper(snapshot->tree->cmp, snapshot->root, NULL, NULL, action);
+
+    return SCL_OK;
+}
@@ -32,6 +32,21 @@
 #define DEFAULT_CAPACITY 10
 #define DEFAULT_REALLOC_RATIO 2
 
+/**
+ * @brief Function to compare two priorities of a priority queue and
+ * count the comparison. MUST not be used outside this file.
+ * 
+ * @param pqueue an allocated priority queue object
+ * @param pri1 pointer to the first priority
+ * @param pri2 pointer to the second priority
+ * @return int32_t result of the compare function of the priorities
+ */
+static inline int32_t pri_queue_compare(const priority_queue_t * const __restrict__ pqueue, const void * const pri1, const void * const pri2) {
+    SCL_STATS_ADD(pqueue, comparisons, 1);
+
+    return pqueue->cmp_pr(pri1, pri2);
+}
+
 /**
  * @brief Create a priority queue object. Function will create
  * a new priority queue object . Function may fail if `cmp_pr`
@@ -67,11 +82,15 @@ priority_queue_t* create_priority_queue(size_t init_capacity, compare_func cmp_p
         init_capacity = DEFAULT_CAPACITY;
     }
 
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new priority queue object on heap memory */
-    priority_queue_t *new_pri_queue = malloc(sizeof(*new_pri_queue));
+    priority_queue_t *new_pri_queue = scl_malloc(allocator, sizeof(*new_pri_queue));
 
     /* Check if priority queue was allocated successfully */
     if (NULL != new_pri_queue) {
+        new_pri_queue->allocator = allocator;
 
         /* Set priority queue default functions */
         new_pri_queue->cmp_pr = cmp_pr;
@@ -84,13 +103,14 @@ priority_queue_t* create_priority_queue(size_t init_capacity, compare_func cmp_p
         new_pri_queue->data_size = data_size;
         new_pri_queue->capacity = init_capacity;
         new_pri_queue->size = 0;
+        (void)SCL_STATS_RESET(new_pri_queue);
 
         /* Allocate memory for heap nodes */
-        new_pri_queue->nodes = malloc(sizeof(*new_pri_queue->nodes) * init_capacity);
+        new_pri_queue->nodes = scl_malloc(allocator, sizeof(*new_pri_queue->nodes) * init_capacity);
 
         /* Check if heap nodes were allocated successfully */
         if (NULL == new_pri_queue->nodes) {
-            free(new_pri_queue);
+            scl_free(allocator, new_pri_queue);
             return NULL;
         }
 
@@ -121,11 +141,6 @@ static void free_priority_queue_node(const priority_queue_t * const __restrict__
             pqueue->frd_dt((*free_node)->data);
         }
 
-        /* Free data pointer */
-        if (NULL != (*free_node)->data) {
-            free((*free_node)->data);
-        }
-
         /* Set data pointer to default value */
         (*free_node)->data = NULL;
 
@@ -134,16 +149,11 @@ static void free_priority_queue_node(const priority_queue_t * const __restrict__
             pqueue->frd_pr((*free_node)->pri);
         }
 
-        /* Free priority pointer */
-        if (NULL != (*free_node)->pri) {
-            free((*free_node)->pri);
-        }
-
         /* Set priority pointer to default value */
         (*free_node)->pri = NULL;
 
         /* Free node pointer */
-        free((*free_node));
+        scl_free(pqueue->allocator, (*free_node));
 
         /* Set node pointer to default value */
         (*free_node) = NULL;
@@ -170,12 +180,12 @@ scl_error_t free_priority_queue(priority_queue_t * const __restrict__ pqueue) {
             }
 
             /* Free heap nodes pointer and set to default value */
-            free(pqueue->nodes);
+            scl_free(pqueue->allocator, pqueue->nodes);
             pqueue->nodes = NULL;  
         }
 
         /* Free priority queue pointer and set to default value */
-        free(pqueue);
+        scl_free(pqueue->allocator, pqueue);
 
         return SCL_OK;
     }
@@ -249,7 +259,7 @@ static scl_error_t sift_node_up(const priority_queue_t * const __restrict__ pque
     scl_error_t err = SCL_OK;
 
     /* Sift heap node up until it reaches its position according to its priority */
-    while ((start_index > 0) && (pqueue->cmp_pr(pqueue->nodes[start_index]->pri, pqueue->nodes[get_node_parent_pos(start_index)]->pri) >= 1)) {
+    while ((start_index > 0) && (pri_queue_compare(pqueue, pqueue->nodes[start_index]->pri, pqueue->nodes[get_node_parent_pos(start_index)]->pri) >= 1)) {
         /* Swap nodes */
         err = swap_pri_queue_nodes(&pqueue->nodes[start_index], &pqueue->nodes[get_node_parent_pos(start_index)]);
         
@@ -258,6 +268,7 @@ static scl_error_t sift_node_up(const priority_queue_t * const __restrict__ pque
         }
 
         /* Check new position of the current heap node */
+        SCL_STATS_ADD(pqueue, sift_steps, 1);
         start_index = get_node_parent_pos(start_index);
     }
 
@@ -296,7 +307,7 @@ static scl_error_t sift_node_down(const priority_queue_t * const __restrict__ pq
     size_t check_index = get_node_left_child_pos(start_index);
 
     /* Check if left child has a bigger/smaller priority than current heap node */
-    if ((check_index < pqueue->size) && (pqueue->cmp_pr(pqueue->nodes[check_index]->pri, pqueue->nodes[swap_index]->pri) >= 1)) {
+    if ((check_index < pqueue->size) && (pri_queue_compare(pqueue, pqueue->nodes[check_index]->pri, pqueue->nodes[swap_index]->pri) >= 1)) {
         swap_index = check_index;
     }
 
@@ -304,7 +315,7 @@ static scl_error_t sift_node_down(const priority_queue_t * const __restrict__ pq
     check_index = get_node_right_child_pos(start_index);
 
     /* Check if right child has a bigge/smaller priority than current heap node or brother node */
-    if ((check_index < pqueue->size) && (pqueue->cmp_pr(pqueue->nodes[check_index]->pri, pqueue->nodes[swap_index]->pri) >= 1)) {
+    if ((check_index < pqueue->size) && (pri_queue_compare(pqueue, pqueue->nodes[check_index]->pri, pqueue->nodes[swap_index]->pri) >= 1)) {
         swap_index = check_index;
     }
 
@@ -320,6 +331,7 @@ static scl_error_t sift_node_down(const priority_queue_t * const __restrict__ pq
         }
 
         /* Sift down the new position of the current heap node */
+        SCL_STATS_ADD(pqueue, sift_steps, 1);
         return sift_node_down(pqueue, swap_index); 
     }
 
@@ -343,27 +355,28 @@ static pri_node_t* create_priority_queue_node(const priority_queue_t * const __r
         return NULL;
     }
 
+    /* The priority and the data are stored inline, right after the node, in the same block */
+    size_t node_size = SCL_ALIGN_SIZE(sizeof(pri_node_t)) + SCL_ALIGN_SIZE(pqueue->pri_size);
+
+    /* A node without data does not need room for it */
+    if (NULL != data) {
+        node_size += pqueue->data_size;
+    }
+
     /* Allocate a new priority queue node on heap memory */
-    pri_node_t *new_pri_queue_node = malloc(sizeof(*new_pri_queue_node));
+    pri_node_t *new_pri_queue_node = scl_malloc(pqueue->allocator, node_size);
 
     /* Check if new priority queue node was allocated successfully */
     if (NULL != new_pri_queue_node) {
+        SCL_STATS_ADD(pqueue, allocations, 1);
+        new_pri_queue_node->pri = (uint8_t *)new_pri_queue_node + SCL_ALIGN_SIZE(sizeof(*new_pri_queue_node));
+
+        /* Copy all bytes from priority to priority node pointer */
+        memcpy(new_pri_queue_node->pri, priority, pqueue->pri_size);
 
         /* Check if new node will have a valid data pointer */
         if (NULL != data) {
-
-            /* Allcoate memory for data content */
-            new_pri_queue_node->data = malloc(pqueue->data_size);
-
-            /* Check if data content was allocated */
-            if (NULL == new_pri_queue_node->data) {
-                free(new_pri_queue_node);
-            
-                errno = ENOMEM;
-                perror("Not enough memory for data value allocation");
-            
-                return NULL;
-            }
+            new_pri_queue_node->data = (uint8_t *)new_pri_queue_node->pri + SCL_ALIGN_SIZE(pqueue->pri_size);
 
             /* Copy all bytes from data to data node pointer */
             memcpy(new_pri_queue_node->data, data, pqueue->data_size);
@@ -372,26 +385,6 @@ static pri_node_t* create_priority_queue_node(const priority_queue_t * const __r
             /* New node does not have data so set it to default value */
             new_pri_queue_node->data = NULL;
         }
-
-        /* Allocate memory for priority content */
-        new_pri_queue_node->pri = malloc(pqueue->pri_size);
-
-        /* Check if priority content was allocated */
-        if (NULL == new_pri_queue_node->pri) {
-            if (NULL != new_pri_queue_node->data) {
-                free(new_pri_queue_node->data);
-            }
-
-            free(new_pri_queue_node);
-            
-            errno = ENOMEM;
-            perror("Not enough memory for priority value allocation");
-            
-            return NULL;
-        }
-
-        /* Copy all bytes from priority to priority node pointer */
-        memcpy(new_pri_queue_node->pri, priority, pqueue->pri_size);
     } else {
         errno = ENOMEM;
         perror("Not enough memory for priority queue node allocation");
@@ -414,42 +407,167 @@ static pri_node_t* create_priority_queue_node(const priority_queue_t * const __r
  * @return scl_error_t enum object for handling errors
  */
 scl_error_t heapify(priority_queue_t * const __restrict__ empty_pqueue, const void *priority, const void *data) {
+    if (NULL == empty_pqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
     if (0 == is_priq_empty(empty_pqueue)) {
         return SCL_NOT_EMPTY_PRIORITY_QUEUE;
     }
 
-    /* Fill up heap nodes pointers with real content without following heap rules */
-    for (size_t iter = 0; iter < empty_pqueue->capacity; ++iter) {
+    /* Fill up the whole capacity and build the heap bottom-up */
+    return pri_queue_build(empty_pqueue, priority, data, empty_pqueue->capacity);
+}
 
-        /* Initialize a new priority queue node as default values */
-        pri_node_t *new_pqueue_node = NULL;
+/**
+ * @brief Function to append one batch of nodes at the end of the heap
+ * nodes without following heap rules. The nodes array is reallocated
+ * at most once for the whole batch. If one node cannot be allocated the
+ * nodes created so far are kept in the priority queue.
+ * 
+ * @param pqueue an allocated priority queue object
+ * @param priorities an array of count priorities
+ * @param datas an array of count data elements or `NULL`
+ * @param count number of elements to append
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t pri_queue_append_nodes(priority_queue_t * const __restrict__ pqueue, const void *priorities, const void *datas, size_t count) {
+    /* Make room for the whole batch with one reallocation */
+    if (pqueue->size + count > pqueue->capacity) {
+        size_t new_capacity = pqueue->capacity * DEFAULT_REALLOC_RATIO;
 
-        /* Create a new priority queue node depending by data pointer */
-        if ((NULL != data) && (0 != empty_pqueue->data_size)) {
-            new_pqueue_node = create_priority_queue_node(empty_pqueue, (const uint8_t *)priority + iter * empty_pqueue->pri_size, (const uint8_t *)data + iter * empty_pqueue->data_size);
-        } else {
-            new_pqueue_node = create_priority_queue_node(empty_pqueue, (const uint8_t *)priority + iter * empty_pqueue->pri_size, NULL);
+        if (new_capacity < pqueue->size + count) {
+            new_capacity = pqueue->size + count;
+        }
+
+        pri_node_t **try_realloc = scl_realloc(pqueue->allocator, pqueue->nodes, sizeof(*(pqueue->nodes)) * new_capacity);
+
+        if (NULL == try_realloc) {
+            errno = ENOMEM;
+            perror("Not enough memory to reallocate new nodes");
+
+            return SCL_REALLOC_PQNODES_FAIL;
         }
 
-        /* Check if new priority queue node was created successfully */
+        SCL_STATS_ADD(pqueue, allocations, 1);
+        pqueue->nodes = try_realloc;
+        pqueue->capacity = new_capacity;
+    }
+
+    /* Copy the priorities and the data in one pass */
+    for (size_t iter = 0; iter < count; ++iter) {
+        const void *data = NULL;
+
+        if ((NULL != datas) && (0 != pqueue->data_size)) {
+            data = (const uint8_t *)datas + iter * pqueue->data_size;
+        }
+
+        pri_node_t *new_pqueue_node = create_priority_queue_node(pqueue, (const uint8_t *)priorities + iter * pqueue->pri_size, data);
+
         if (NULL == new_pqueue_node) {
             return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
         }
-        
-        /* Link new created priority queue node to heap nodes */
-        empty_pqueue->nodes[iter] = new_pqueue_node;
 
-        /* Increase priority queue's size */
-        ++(empty_pqueue->size);
+        pqueue->nodes[pqueue->size] = new_pqueue_node;
+        ++(pqueue->size);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to rebuild the binary-heap of a priority queue
+ * bottom-up (Floyd's method) in O(N), by sifting down every node
+ * that is not a leaf, starting from the last one.
+ * 
+ * @param pqueue an allocated priority queue object
+ */
+static void pri_queue_build_heap(const priority_queue_t * const __restrict__ pqueue) {
+    for (size_t iter = pqueue->size / 2; iter > 0; --iter) {
+        sift_node_down(pqueue, iter - 1);
+    }
+}
+
+/**
+ * @brief Function to fill an empty priority queue from an array of
+ * priorities and an array of data in O(N). The elements are copied
+ * in one pass and the heap is built bottom-up, instead of pushing them
+ * one by one in O(NlogN). Function grows the nodes array if count is
+ * greater than the capacity of the priority queue.
+ * 
+ * @param pqueue an allocated EMPTY priority queue object
+ * @param priorities an array of count priorities
+ * @param datas an array of count data elements or `NULL` for no data
+ * @param count number of elements to insert into the priority queue
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t pri_queue_build(priority_queue_t * const __restrict__ pqueue, const void *priorities, const void *datas, size_t count) {
+    /* Check if input data is valid */
+    if (NULL == pqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
     }
 
-    /* Sift down every node that is not a leaf in binary-heap */
-    for (int64_t iter = (int64_t)((empty_pqueue->size / 2) - 1); iter >= 0; --iter) {
-        sift_node_down(empty_pqueue, (size_t)iter);
+    if (NULL == pqueue->nodes) {
+        return SCL_NULL_PQUEUE_NODES;
     }
 
-    /* Return a new allocated priority queue or NULL */
-    return SCL_OK;
+    if (0 != pqueue->size) {
+        return SCL_NOT_EMPTY_PRIORITY_QUEUE;
+    }
+
+    if ((NULL == priorities) && (0 != count)) {
+        return SCL_INVALID_PRIORITY;
+    }
+
+    scl_error_t err = pri_queue_append_nodes(pqueue, priorities, datas, count);
+
+    /* Keep the heap valid even if just a part of the nodes were created */
+    pri_queue_build_heap(pqueue);
+
+    return err;
+}
+
+/**
+ * @brief Function to push a batch of elements into a priority queue.
+ * The nodes array is reallocated at most once. A small batch is sifted
+ * up node by node in O(KlogN), while a batch comparable with the size of
+ * the queue is appended and the whole heap is rebuilt in O(N + K).
+ * 
+ * @param pqueue an allocated priority queue object
+ * @param priorities an array of count priorities
+ * @param datas an array of count data elements or `NULL` for no data
+ * @param count number of elements to insert into the priority queue
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t pri_queue_push_bulk(priority_queue_t * const __restrict__ pqueue, const void *priorities, const void *datas, size_t count) {
+    /* Check if input data is valid */
+    if (NULL == pqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == pqueue->nodes) {
+        return SCL_NULL_PQUEUE_NODES;
+    }
+
+    if ((NULL == priorities) && (0 != count)) {
+        return SCL_INVALID_PRIORITY;
+    }
+
+    const size_t old_size = pqueue->size;
+
+    scl_error_t err = pri_queue_append_nodes(pqueue, priorities, datas, count);
+
+    /* Restore the heap over the appended nodes */
+    if (pqueue->size - old_size >= old_size / 2) {
+        pri_queue_build_heap(pqueue);
+    } else {
+        for (size_t iter = old_size; iter < pqueue->size; ++iter) {
+            sift_node_up(pqueue, iter);
+        }
+    }
+
+    return err;
 }
 
 /**
@@ -501,7 +619,7 @@ scl_error_t change_node_priority(const priority_queue_t * const __restrict__ pqu
      * Sift selected node down if new priority has a smaller rank 
      * than old priority according to compare function
      */
-    if (pqueue->cmp_pr(pqueue->nodes[node_index]->pri, new_pri) >= 1) {
+    if (pri_queue_compare(pqueue, pqueue->nodes[node_index]->pri, new_pri) >= 1) {
 
         /* Copy new priority into old priority */
         memcpy(pqueue->nodes[node_index]->pri, new_pri, pqueue->pri_size);
@@ -514,7 +632,7 @@ scl_error_t change_node_priority(const priority_queue_t * const __restrict__ pqu
      * Sift selected node up if new priority has a bigger rank 
      * than old priority according to compare function
      */
-    if (pqueue->cmp_pr(pqueue->nodes[node_index]->pri, new_pri) <= -1) {
+    if (pri_queue_compare(pqueue, pqueue->nodes[node_index]->pri, new_pri) <= -1) {
 
         /* Copy new priority into old priority */
         memmove(pqueue->nodes[node_index]->pri, new_pri, pqueue->pri_size);
@@ -617,7 +735,7 @@ size_t pri_find_pri_index(const priority_queue_t * const __restrict__ pqueue, co
     /* Find desired priority index according to compare function */
     for (size_t iter = 0; iter < pqueue->size; ++iter) {
         if (NULL != pqueue->nodes[iter]) {
-            if (0 == pqueue->cmp_pr(pqueue->nodes[iter]->pri, priority)) {
+            if (0 == pri_queue_compare(pqueue, pqueue->nodes[iter]->pri, priority)) {
                 return iter;
             }
         }
@@ -665,7 +783,7 @@ scl_error_t pri_queue_push(priority_queue_t * const __restrict__ pqueue, const v
         pqueue->capacity *= DEFAULT_REALLOC_RATIO;
         
         /* Try to realloc heap nodes */
-        pri_node_t **try_realloc = realloc(pqueue->nodes, sizeof(*(pqueue->nodes)) * pqueue->capacity);
+        pri_node_t **try_realloc = scl_realloc(pqueue->allocator, pqueue->nodes, sizeof(*(pqueue->nodes)) * pqueue->capacity);
 
         /*
          * If reallocation went wrong exit pushing function
@@ -681,6 +799,7 @@ scl_error_t pri_queue_push(priority_queue_t * const __restrict__ pqueue, const v
         }
 
         /* Set heap nodes pointer to the new memory location */
+        SCL_STATS_ADD(pqueue, allocations, 1);
         pqueue->nodes = try_realloc;
     }
 
@@ -783,6 +902,105 @@ scl_error_t pri_queue_pop(priority_queue_t * const __restrict__ pqueue) {
     return sift_node_down(pqueue, 0);
 }
 
+/**
+ * @brief Function to replace the highest rank node of a priority queue
+ * with a new priority and data in O(logN). The old content of the top is
+ * freed and the node is reused in place (it is reallocated just if one of
+ * the old or new data is `NULL`), then it is sifted down once, so it costs
+ * half of a pop followed by a push.
+ * 
+ * @param pqueue an allocated priority queue object
+ * @param priority pointer to the new priority element
+ * @param data pointer to the new data element or `NULL`
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t pri_queue_replace_top(priority_queue_t * const __restrict__ pqueue, const void *priority, const void *data) {
+    /* Check if input data is valid */
+    if (NULL == pqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == pqueue->nodes) {
+        return SCL_NULL_PQUEUE_NODES;
+    }
+
+    if (NULL == priority) {
+        return SCL_INVALID_PRIORITY;
+    }
+
+    if (0 == pqueue->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    pri_node_t *top_node = pqueue->nodes[0];
+
+    /* The top node has room for data just if it was created with data */
+    if ((NULL == data) != (NULL == top_node->data)) {
+        pri_node_t *new_node = create_priority_queue_node(pqueue, priority, data);
+
+        if (NULL == new_node) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        free_priority_queue_node(pqueue, &pqueue->nodes[0]);
+        pqueue->nodes[0] = new_node;
+    } else {
+
+        /* Free the old content of the top node and overwrite it */
+        if ((NULL != pqueue->frd_pr) && (NULL != top_node->pri)) {
+            pqueue->frd_pr(top_node->pri);
+        }
+
+        memcpy(top_node->pri, priority, pqueue->pri_size);
+
+        if (NULL != data) {
+            if (NULL != pqueue->frd_dt) {
+                pqueue->frd_dt(top_node->data);
+            }
+
+            memcpy(top_node->data, data, pqueue->data_size);
+        }
+    }
+
+    /* Sift the new top node down */
+    return sift_node_down(pqueue, 0);
+}
+
+/**
+ * @brief Function to push a new element and to pop the highest rank
+ * element right after, with at most one sift-down. If the new element
+ * ranks at least as high as the top (or the queue is empty) it would be
+ * popped right away, so it is not inserted and the queue is not changed
+ * (its content still belongs to the caller), otherwise the top is replaced
+ * by the new element as in **pri_queue_replace_top**.
+ * 
+ * @param pqueue an allocated priority queue object
+ * @param priority pointer to the new priority element
+ * @param data pointer to the new data element or `NULL`
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t pri_queue_pushpop(priority_queue_t * const __restrict__ pqueue, const void *priority, const void *data) {
+    /* Check if input data is valid */
+    if (NULL == pqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == pqueue->nodes) {
+        return SCL_NULL_PQUEUE_NODES;
+    }
+
+    if (NULL == priority) {
+        return SCL_INVALID_PRIORITY;
+    }
+
+    /* Check if the top ranks higher than the new element */
+    if ((0 == pqueue->size) || (pri_queue_compare(pqueue, pqueue->nodes[0]->pri, priority) < 1)) {
+        return SCL_OK;
+    }
+
+    return pri_queue_replace_top(pqueue, priority, data);
+}
+
 /**
  * @brief Function that will traverse all nodes in priority queue
  * and will perform any action according to "action" function.
@@ -840,6 +1058,82 @@ size_t pri_queue_size(const priority_queue_t * const __restrict__ pqueue) {
     return pqueue->size;
 }
 
+/**
+ * @brief Function to get the memory footprint of a priority queue. Every
+ * node holds its priority and its data inline, the used part of the heap
+ * array is counted as array bytes and its free capacity as slack.
+ * Function visits every node of the priority queue.
+ * 
+ * @param pqueue an allocated priority queue object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t pri_queue_memory_usage(const priority_queue_t * const __restrict__ pqueue, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == pqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*pqueue);
+    usage->node_bytes = pqueue->size * (SCL_ALIGN_SIZE(sizeof(pri_node_t)) + SCL_ALIGN_SIZE(pqueue->pri_size) - pqueue->pri_size);
+    usage->payload_bytes = pqueue->size * pqueue->pri_size;
+    usage->array_bytes = pqueue->size * sizeof(*pqueue->nodes);
+    usage->slack_bytes = (pqueue->capacity - pqueue->size) * sizeof(*pqueue->nodes);
+    usage->nodes = pqueue->size;
+
+    /* Nodes without data have no room for it */
+    for (size_t iter = 0; iter < pqueue->size; ++iter) {
+        if (NULL != pqueue->nodes[iter]->data) {
+            usage->payload_bytes += pqueue->data_size;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the operation counters of a priority queue, priority comparisons, node allocations and sift steps.
+ * The counters are kept only when the library is built with SCL_STATS.
+ * 
+ * @param pqueue an allocated priority queue object
+ * @param stats pointer to the counters to fill (set to zero without SCL_STATS)
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t pri_queue_get_stats(const priority_queue_t * const __restrict__ pqueue, scl_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == pqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return SCL_STATS_GET(pqueue, stats);
+}
+
+/**
+ * @brief Function to set the operation counters of a priority queue to zero.
+ * 
+ * @param pqueue an allocated priority queue object
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t pri_queue_reset_stats(priority_queue_t * const __restrict__ pqueue) {
+    /* Check if input data is valid */
+    if (NULL == pqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    return SCL_STATS_RESET(pqueue);
+}
+
 /**
  * @brief Function to check if a priority queue object is
  * empty or not. A not allocated object is also an empty object
@@ -858,10 +1152,98 @@ uint8_t is_priq_empty(const priority_queue_t * const __restrict__ pqueue) {
     return 0;
 }
 
+/**
+ * @brief Function to swap two elements of an array through a small
+ * buffer on the stack. MUST not be used outside this file.
+ * 
+ * @param first pointer to the first element
+ * @param second pointer to the second element
+ * @param arr_elem_size size of one element from the array
+ */
+static void heap_sort_swap(uint8_t * __restrict__ first, uint8_t * __restrict__ second, size_t arr_elem_size) {
+    uint8_t block[64];
+
+    while (arr_elem_size > 0) {
+        size_t length = (arr_elem_size < sizeof(block)) ? arr_elem_size : sizeof(block);
+
+        memcpy(block, first, length);
+        memcpy(first, second, length);
+        memcpy(second, block, length);
+
+        first += length;
+        second += length;
+        arr_elem_size -= length;
+    }
+}
+
+/**
+ * @brief Function to sift one element down a heap stored inside the
+ * array to sort. The lowest element is on top of the heap, so moving the
+ * top after the heap leaves the array in descending order. MUST not be
+ * used outside this file.
+ * 
+ * @param arr array holding the heap from its first element
+ * @param root index of the element to sift down
+ * @param number_of_elem number of elements of the heap
+ * @param arr_elem_size size of one element from the array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements, a constant in every dispatched copy
+ */
+static SCL_ALWAYS_INLINE void heap_sort_sift_down_kind(uint8_t *arr, size_t root, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind) {
+    for (;;) {
+        size_t child = 2 * root + 1;
+
+        if (child >= number_of_elem) {
+            break;
+        }
+
+        /* Select the lower child */
+        if ((child + 1 < number_of_elem) && (scl_key_compare(kind, cmp, arr_elem_size, arr + (child + 1) * arr_elem_size, arr + child * arr_elem_size) <= -1)) {
+            ++child;
+        }
+
+        /* The element is not greater than its children, the heap is repaired */
+        if (scl_key_compare(kind, cmp, arr_elem_size, arr + child * arr_elem_size, arr + root * arr_elem_size) >= 0) {
+            break;
+        }
+
+        heap_sort_swap(arr + root * arr_elem_size, arr + child * arr_elem_size, arr_elem_size);
+        root = child;
+    }
+}
+
+/**
+ * @brief Function to sort an array by heap sort in place, with a constant
+ * kind of the elements. MUST not be used outside this file.
+ * 
+ * @param arr array to sort
+ * @param number_of_elem number of elements within the array
+ * @param arr_elem_size size of one element from the array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements, a constant in every dispatched copy
+ */
+static SCL_ALWAYS_INLINE void heap_sort_kind(uint8_t *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind) {
+    /* Build the heap bottom-up (Floyd's method) in O(N) */
+    for (size_t iter = number_of_elem / 2; iter > 0; --iter) {
+        heap_sort_sift_down_kind(arr, iter - 1, number_of_elem, arr_elem_size, cmp, kind);
+    }
+
+    /* Move the lowest element right after the shrinking heap in O(logN) */
+    for (size_t last = number_of_elem - 1; last > 0; --last) {
+        heap_sort_swap(arr, arr + last * arr_elem_size, arr_elem_size);
+        heap_sort_sift_down_kind(arr, 0, last, arr_elem_size, cmp, kind);
+    }
+}
+
+/* Sorts the array with a constant kind of the elements */
+#define HEAP_SORT_KIND(kind) heap_sort_kind(typed_arr, number_of_elem, arr_elem_size, cmp, (kind))
+
 /**
  * @brief Function to sort elements of an array by heap sort
- * method. Function will call heapify function to make a priority queue
- * where array elements will be priorities and data will be set as `NULL`.
+ * method in descending order (the first element ranks the highest
+ * according to cmp, as the top of a priority queue). The heap is built
+ * inside the array, so the sort allocates no memory and moves every
+ * element by swaps, in O(NlogN) time for any input.
  * 
  * @param arr an array of any type to sort its elements
  * @param number_of_elem number of elements within the selected array
@@ -887,27 +1269,1362 @@ scl_error_t heap_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, co
         return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
     }
 
-    /* Heapify the input array in O(N) complexity */
-    priority_queue_t *heap = create_priority_queue(number_of_elem, cmp, NULL, NULL, NULL, arr_elem_size, 0);
-    
-    scl_error_t err = heapify(heap, arr, NULL);
+    uint8_t *typed_arr = arr;
 
-    if (SCL_OK != err) {
-        return err;
-    }
+    /* Compare functions of the library with a known kind are done inline */
+    SCL_KEY_KIND_DISPATCH(scl_key_kind_of(cmp, arr_elem_size), HEAP_SORT_KIND)
 
-    /* Rearrange input array data from heap structure in O(NlogN) complexity */
-    for (size_t iter = 0; iter < number_of_elem; ++iter) {
-        memcpy((uint8_t *)arr + iter * arr_elem_size, pri_queue_top_pri(heap), arr_elem_size);
-        err = pri_queue_pop(heap);
+    /* All good */
+    return SCL_OK;
+}
+
+#undef HEAP_SORT_KIND
+
+/**
+ * @brief MACRO to get the priority of one id from an indexed priority queue
+ * 
+ */
+#define get_indexed_pri(ipqueue, id) ((ipqueue)->priorities + (id) * (ipqueue)->pri_size)
+
+/**
+ * @brief Create an indexed priority queue object. The ids of the
+ * elements are numbers from [0, capacity), every id can be at most once
+ * in the queue and the priority of every id is stored inline by the queue.
+ * Function may fail if compare function is `NULL`, if capacity or size of
+ * the priority are zero or if not enough heap memory is left.
+ * 
+ * @param capacity number of ids, maximum number of elements of the queue
+ * @param cmp_pr a pointer to a function to compare two sets of priorities
+ * @param frd_pr a pointer to a function to free memory of one priority set
+ * @param pri_size length in bytes of the pri data type
+ * @return indexed_priority_queue_t* a new allocated indexed priority queue object or `NULL` if function fails
+ */
+indexed_priority_queue_t* create_indexed_priority_queue(size_t capacity, compare_func cmp_pr, free_func frd_pr, size_t pri_size) {
+    /* Check if input data is valid */
+    if (NULL == cmp_pr) {
+        errno = EINVAL;
+        perror("Compare function undefined for indexed priority queue");
+        return NULL;
+    }
+
+    if ((0 == capacity) || (0 == pri_size)) {
+        errno = EINVAL;
+        perror("Capacity or priority type size are zero");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new indexed priority queue object on heap memory */
+    indexed_priority_queue_t *new_ipqueue = scl_malloc(allocator, sizeof(*new_ipqueue));
+
+    /* Check if indexed priority queue was allocated successfully */
+    if (NULL == new_ipqueue) {
+        errno = ENOMEM;
+        perror("Not enough memory for indexed priority queue allocation");
+        return NULL;
+    }
+
+    new_ipqueue->allocator = allocator;
+    new_ipqueue->cmp_pr = cmp_pr;
+    new_ipqueue->frd_pr = frd_pr;
+    new_ipqueue->capacity = capacity;
+    new_ipqueue->pri_size = pri_size;
+    new_ipqueue->size = 0;
+
+    /* Allocate the heap, the position map and the priorities */
+    new_ipqueue->heap = scl_malloc(allocator, sizeof(*new_ipqueue->heap) * capacity);
+    new_ipqueue->positions = scl_malloc(allocator, sizeof(*new_ipqueue->positions) * capacity);
+    new_ipqueue->priorities = scl_malloc(allocator, pri_size * capacity);
+
+    if ((NULL == new_ipqueue->heap) || (NULL == new_ipqueue->positions) || (NULL == new_ipqueue->priorities)) {
+        scl_free(allocator, new_ipqueue->heap);
+        scl_free(allocator, new_ipqueue->positions);
+        scl_free(allocator, new_ipqueue->priorities);
+        scl_free(allocator, new_ipqueue);
+
+        errno = ENOMEM;
+        perror("Not enough memory for indexed priority queue arrays allocation");
+        return NULL;
+    }
+
+    /* No id is in the queue */
+    for (size_t iter = 0; iter < capacity; ++iter) {
+        new_ipqueue->positions[iter] = SIZE_MAX;
+    }
+
+    /* Return a new allocated indexed priority queue */
+    return new_ipqueue;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a
+ * specific indexed priority queue object. The priorities of the
+ * ids still in the queue are freed with frd_pr function.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_indexed_priority_queue(indexed_priority_queue_t * const __restrict__ ipqueue) {
+    /* Check if indexed priority queue needs to be freed */
+    if (NULL == ipqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    /* Free the content of the priorities still in queue */
+    if (NULL != ipqueue->frd_pr) {
+        for (size_t iter = 0; iter < ipqueue->size; ++iter) {
+            ipqueue->frd_pr(get_indexed_pri(ipqueue, ipqueue->heap[iter]));
+        }
+    }
+
+    scl_free(ipqueue->allocator, ipqueue->heap);
+    scl_free(ipqueue->allocator, ipqueue->positions);
+    scl_free(ipqueue->allocator, ipqueue->priorities);
+    scl_free(ipqueue->allocator, ipqueue);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to sift one id up to repair the proprieties of the
+ * heap of an indexed priority queue, updating the position map.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @param heap_index starting slot from the heap
+ */
+static void indexed_sift_node_up(indexed_priority_queue_t * const __restrict__ ipqueue, size_t heap_index) {
+    const size_t id = ipqueue->heap[heap_index];
+
+    /* Move the parents down until the slot of the id is found */
+    while (heap_index > 0) {
+        const size_t parent_index = get_node_parent_pos(heap_index);
+
+        if (ipqueue->cmp_pr(get_indexed_pri(ipqueue, id), get_indexed_pri(ipqueue, ipqueue->heap[parent_index])) < 1) {
+            break;
+        }
+
+        ipqueue->heap[heap_index] = ipqueue->heap[parent_index];
+        ipqueue->positions[ipqueue->heap[heap_index]] = heap_index;
+
+        heap_index = parent_index;
+    }
+
+    ipqueue->heap[heap_index] = id;
+    ipqueue->positions[id] = heap_index;
+}
+
+/**
+ * @brief Function to sift one id down to repair the proprieties of the
+ * heap of an indexed priority queue, updating the position map.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @param heap_index starting slot from the heap
+ */
+static void indexed_sift_node_down(indexed_priority_queue_t * const __restrict__ ipqueue, size_t heap_index) {
+    const size_t id = ipqueue->heap[heap_index];
+
+    /* Move the children up until the slot of the id is found */
+    for (;;) {
+        size_t child_index = get_node_left_child_pos(heap_index);
+
+        if (child_index >= ipqueue->size) {
+            break;
+        }
+
+        /* Select the child with the highest rank */
+        if ((child_index + 1 < ipqueue->size) &&
+            (ipqueue->cmp_pr(get_indexed_pri(ipqueue, ipqueue->heap[child_index + 1]), get_indexed_pri(ipqueue, ipqueue->heap[child_index])) >= 1)) {
+            ++child_index;
+        }
+
+        if (ipqueue->cmp_pr(get_indexed_pri(ipqueue, ipqueue->heap[child_index]), get_indexed_pri(ipqueue, id)) < 1) {
+            break;
+        }
+
+        ipqueue->heap[heap_index] = ipqueue->heap[child_index];
+        ipqueue->positions[ipqueue->heap[heap_index]] = heap_index;
+
+        heap_index = child_index;
+    }
+
+    ipqueue->heap[heap_index] = id;
+    ipqueue->positions[id] = heap_index;
+}
+
+/**
+ * @brief Function to insert one id with its priority into an indexed
+ * priority queue in O(log n). Function may fail if the id is out of
+ * the capacity of the queue or if the id is already in the queue.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @param id id of the element from [0, capacity)
+ * @param priority pointer to the priority of the element
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t indexed_pri_queue_push(indexed_priority_queue_t * const __restrict__ ipqueue, size_t id, const void * const __restrict__ priority) {
+    /* Check if input data is valid */
+    if (NULL == ipqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == priority) {
+        return SCL_INVALID_PRIORITY;
+    }
+
+    if (id >= ipqueue->capacity) {
+        return SCL_INDEX_OVERFLOWS_SIZE;
+    }
+
+    if (SIZE_MAX != ipqueue->positions[id]) {
+        return SCL_ID_ALREADY_IN_PQUEUE;
+    }
+
+    /* Copy the priority and put the id in the last slot of the heap */
+    memcpy(get_indexed_pri(ipqueue, id), priority, ipqueue->pri_size);
+
+    ipqueue->heap[ipqueue->size] = id;
+    ipqueue->positions[id] = ipqueue->size;
+
+    ++(ipqueue->size);
+
+    /* Sift the new id up to reestablish heap propreties */
+    indexed_sift_node_up(ipqueue, ipqueue->size - 1);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to change the priority of one id from an indexed
+ * priority queue in O(log n). The new priority may rank higher or lower
+ * than the old one. Function may fail if id is not in the queue.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @param id id of the element to change
+ * @param new_pri pointer to the new priority of the element
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t indexed_pri_queue_change_priority(indexed_priority_queue_t * const __restrict__ ipqueue, size_t id, const void * const __restrict__ new_pri) {
+    /* Check if input data is valid */
+    if (NULL == ipqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == new_pri) {
+        return SCL_CHANGE_PRIORITY_TO_NULL;
+    }
+
+    if ((id >= ipqueue->capacity) || (SIZE_MAX == ipqueue->positions[id])) {
+        return SCL_DATA_NOT_FOUND;
+    }
+
+    /* Overwrite the priority and move the id to its new slot */
+    memmove(get_indexed_pri(ipqueue, id), new_pri, ipqueue->pri_size);
+
+    indexed_sift_node_up(ipqueue, ipqueue->positions[id]);
+    indexed_sift_node_down(ipqueue, ipqueue->positions[id]);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if one id is in an indexed priority queue, O(1).
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @param id id of the element to check
+ * @return uint8_t 1 if id is in the queue, 0 otherwise
+ */
+uint8_t indexed_pri_queue_contains(const indexed_priority_queue_t * const __restrict__ ipqueue, size_t id) {
+    if ((NULL == ipqueue) || (id >= ipqueue->capacity)) {
+        return 0;
+    }
+
+    return (SIZE_MAX != ipqueue->positions[id]);
+}
+
+/**
+ * @brief Function to get the priority of one id from an indexed priority queue, O(1).
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @param id id of the element
+ * @return const void* pointer to the priority of the id, user should not
+ * modify this pointer, or `NULL` if id is not in the queue
+ */
+const void* indexed_pri_queue_get_priority(const indexed_priority_queue_t * const __restrict__ ipqueue, size_t id) {
+    if (0 == indexed_pri_queue_contains(ipqueue, id)) {
+        return NULL;
+    }
+
+    return get_indexed_pri(ipqueue, id);
+}
+
+/**
+ * @brief Function to get the id with the highest rank from an indexed priority queue.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @return size_t id with the highest rank or SIZE_MAX if queue is empty or not allocated
+ */
+size_t indexed_pri_queue_top(const indexed_priority_queue_t * const __restrict__ ipqueue) {
+    if ((NULL == ipqueue) || (0 == ipqueue->size)) {
+        return SIZE_MAX;
+    }
+
+    return ipqueue->heap[0];
+}
+
+/**
+ * @brief Function to get the highest ranking priority from an indexed priority queue.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @return const void* pointer to the highest ranking priority, user should not
+ * modify this pointer, or `NULL` if queue is empty or not allocated
+ */
+const void* indexed_pri_queue_top_pri(const indexed_priority_queue_t * const __restrict__ ipqueue) {
+    if ((NULL == ipqueue) || (0 == ipqueue->size)) {
+        return NULL;
+    }
+
+    return get_indexed_pri(ipqueue, ipqueue->heap[0]);
+}
+
+/**
+ * @brief Function to remove one id from an indexed priority queue in O(log n).
+ * Function may fail if id is not in the queue.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @param id id of the element to remove
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t indexed_pri_queue_delete(indexed_priority_queue_t * const __restrict__ ipqueue, size_t id) {
+    /* Check if input data is valid */
+    if (NULL == ipqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (0 == ipqueue->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if ((id >= ipqueue->capacity) || (SIZE_MAX == ipqueue->positions[id])) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    const size_t heap_index = ipqueue->positions[id];
+
+    /* Free the content of the removed priority */
+    if (NULL != ipqueue->frd_pr) {
+        ipqueue->frd_pr(get_indexed_pri(ipqueue, id));
+    }
+
+    ipqueue->positions[id] = SIZE_MAX;
+
+    --(ipqueue->size);
+
+    /* Move the last id into the free slot and repair the heap */
+    if (heap_index != ipqueue->size) {
+        const size_t moved_id = ipqueue->heap[ipqueue->size];
+
+        ipqueue->heap[heap_index] = moved_id;
+        ipqueue->positions[moved_id] = heap_index;
+
+        indexed_sift_node_up(ipqueue, heap_index);
+        indexed_sift_node_down(ipqueue, ipqueue->positions[moved_id]);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove the id with the highest rank
+ * from an indexed priority queue in O(log n).
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t indexed_pri_queue_pop(indexed_priority_queue_t * const __restrict__ ipqueue) {
+    /* Check if input data is valid */
+    if (NULL == ipqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (0 == ipqueue->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    return indexed_pri_queue_delete(ipqueue, ipqueue->heap[0]);
+}
+
+/**
+ * @brief Get the current size of an indexed priority queue.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @return size_t SIZE_MAX if queue is not allocated or number of ids in queue
+ */
+size_t indexed_pri_queue_size(const indexed_priority_queue_t * const __restrict__ ipqueue) {
+    if (NULL == ipqueue) {
+        return SIZE_MAX;
+    }
+
+    return ipqueue->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of an indexed priority queue.
+ * The priorities of the ids in queue are the payload, the priorities of
+ * the other ids are slack and the heap and positions arrays are array bytes.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t indexed_pri_queue_memory_usage(const indexed_priority_queue_t * const __restrict__ ipqueue, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == ipqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*ipqueue);
+    usage->node_bytes = 0;
+    usage->payload_bytes = ipqueue->size * ipqueue->pri_size;
+    usage->array_bytes = ipqueue->capacity * (sizeof(*ipqueue->heap) + sizeof(*ipqueue->positions));
+    usage->slack_bytes = (ipqueue->capacity - ipqueue->size) * ipqueue->pri_size;
+    usage->nodes = ipqueue->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if an indexed priority queue is empty.
+ * 
+ * @param ipqueue an allocated indexed priority queue object
+ * @return uint8_t 1 if queue is empty or not allocated, 0 otherwise
+ */
+uint8_t is_indexed_priq_empty(const indexed_priority_queue_t * const __restrict__ ipqueue) {
+    if ((NULL == ipqueue) || (0 == ipqueue->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Default arity of the heap of a flat priority queue, four
+ * children of 16 bytes or less fit in the same cache line
+ * 
+ */
+#define DEFAULT_FLAT_PQUEUE_ARITY 4
+
+/**
+ * @brief MACRO to get the slot at one index from a flat priority queue
+ * 
+ */
+#define get_flat_pri_slot(fpqueue, slot_index) ((fpqueue)->slots.data + (slot_index) * (fpqueue)->slot_size)
+
+/**
+ * @brief Function to compute the alignment of a value from its size,
+ * as the largest power of two dividing the size (the alignment of any
+ * type divides its size), but not greater than the malloc alignment.
+ * 
+ * @param size length in bytes of the value
+ * @return size_t alignment in bytes of the value
+ */
+static size_t flat_pri_queue_value_align(size_t size) {
+    size_t align = 1;
+
+    /* Double the alignment while it divides the size */
+    while ((align < SCL_ALIGN) && (0 == (size & align))) {
+        align <<= 1;
+    }
+
+    return align;
+}
+
+/**
+ * @brief Create a flat priority queue object. The heap of the object
+ * has arity children for every node (a 4-ary or 8-ary heap halves the
+ * depth of a binary heap and the children of a node are compared from
+ * the same cache line). Function may fail if `cmp_pr` is not specified,
+ * if the arity is one or the priority size is zero or if not enough heap
+ * memory is left. Data size may be zero to keep just the priorities.
+ * 
+ * @param init_capacity initial number of slots of the flat priority queue
+ * @param arity number of children of every heap node (0 for 4-ary heap)
+ * @param cmp_pr a pointer to a function to compare two sets of priorities
+ * @param frd_pr a pointer to a function to free memory of one priority set
+ * @param frd_dt a pointer to a function to free memory of one data set
+ * @param pri_size length in bytes of the pri data type
+ * @param data_size length in bytes of the data data type
+ * @return flat_priority_queue_t* a new allocated flat priority queue object or `NULL` if function fails
+ */
+flat_priority_queue_t* create_flat_priority_queue(size_t init_capacity, size_t arity, compare_func cmp_pr, free_func frd_pr, free_func frd_dt, size_t pri_size, size_t data_size) {
+    /* Check if input data is valid */
+    if (NULL == cmp_pr) {
+        errno = EINVAL;
+        perror("Compare function undefined for flat priority queue");
+        return NULL;
+    }
+
+    if ((1 == arity) || (0 == pri_size)) {
+        errno = EINVAL;
+        perror("Arity is one or priority type size is zero");
+        return NULL;
+    }
+
+    /* Set default capacity and arity if necessary */
+    if (0 == init_capacity) {
+        init_capacity = DEFAULT_CAPACITY;
+    }
+
+    if (0 == arity) {
+        arity = DEFAULT_FLAT_PQUEUE_ARITY;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new flat priority queue object on heap memory */
+    flat_priority_queue_t *new_fpqueue = scl_malloc(allocator, sizeof(*new_fpqueue));
+
+    /* Check if flat priority queue was allocated successfully */
+    if (NULL == new_fpqueue) {
+        errno = ENOMEM;
+        perror("Not enough memory for flat priority queue allocation");
+        return NULL;
+    }
+
+    new_fpqueue->allocator = allocator;
+    new_fpqueue->cmp_pr = cmp_pr;
+    new_fpqueue->frd_pr = frd_pr;
+    new_fpqueue->frd_dt = frd_dt;
+    new_fpqueue->arity = arity;
+    new_fpqueue->pri_size = pri_size;
+    new_fpqueue->data_size = data_size;
+    (void)SCL_STATS_RESET(new_fpqueue);
+
+    /* Compute the layout of one slot {priority, data} without padding more than the types need */
+    const size_t pri_align = flat_pri_queue_value_align(pri_size);
+    const size_t data_align = (0 == data_size) ? 1 : flat_pri_queue_value_align(data_size);
+    const size_t slot_align = (pri_align > data_align) ? pri_align : data_align;
+
+    new_fpqueue->data_offset = (pri_size + data_align - 1) & ~(data_align - 1);
+    new_fpqueue->slot_size = (new_fpqueue->data_offset + data_size + slot_align - 1) & ~(slot_align - 1);
+
+    /* Allocate the slots and the scratch slot */
+    vector_init(&new_fpqueue->slots, NULL, new_fpqueue->slot_size, allocator);
+    vector_reserve(&new_fpqueue->slots, init_capacity);
+
+    new_fpqueue->swap_area = scl_malloc(allocator, new_fpqueue->slot_size);
+
+    if ((NULL == new_fpqueue->slots.data) || (NULL == new_fpqueue->swap_area)) {
+        vector_release(&new_fpqueue->slots);
+        scl_free(allocator, new_fpqueue->swap_area);
+        scl_free(allocator, new_fpqueue);
+
+        errno = ENOMEM;
+        perror("Not enough memory for flat priority queue slots allocation");
+        return NULL;
+    }
+
+    /* Return a new allocated flat priority queue */
+    return new_fpqueue;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a
+ * specific flat priority queue object. The priority and the data
+ * of every slot are freed with frd_pr and frd_dt functions.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_flat_priority_queue(flat_priority_queue_t * const __restrict__ fpqueue) {
+    /* Check if flat priority queue needs to be freed */
+    if (NULL == fpqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    /* Free the content of the slots still in queue */
+    for (size_t iter = 0; iter < fpqueue->slots.size; ++iter) {
+        uint8_t *slot = get_flat_pri_slot(fpqueue, iter);
+
+        if (NULL != fpqueue->frd_pr) {
+            fpqueue->frd_pr(slot);
+        }
+
+        if ((NULL != fpqueue->frd_dt) && (0 != fpqueue->data_size)) {
+            fpqueue->frd_dt(slot + fpqueue->data_offset);
+        }
+    }
+
+    vector_release(&fpqueue->slots);
+    scl_free(fpqueue->allocator, fpqueue->swap_area);
+    scl_free(fpqueue->allocator, fpqueue);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to compare two slots of a flat priority queue by
+ * their priorities and count the comparison. MUST not be used outside this file.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @param slot1 pointer to the first slot
+ * @param slot2 pointer to the second slot
+ * @return int32_t result of the compare function of the priorities
+ */
+static inline int32_t flat_pri_queue_compare(const flat_priority_queue_t * const __restrict__ fpqueue, const void * const slot1, const void * const slot2) {
+    SCL_STATS_ADD(fpqueue, comparisons, 1);
+
+    return fpqueue->cmp_pr(slot1, slot2);
+}
+
+/**
+ * @brief Function to sift the slot from the swap area up, starting
+ * from an empty slot of the heap. The parents are moved down into the
+ * empty slot, so every level costs one copy instead of a swap.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @param slot_index index of the empty slot from the heap
+ */
+static void flat_sift_slot_up(flat_priority_queue_t * const __restrict__ fpqueue, size_t slot_index) {
+    /* Move the parents down until the slot of the element is found */
+    while (slot_index > 0) {
+        const size_t parent_index = (slot_index - 1) / fpqueue->arity;
+        const uint8_t *parent = get_flat_pri_slot(fpqueue, parent_index);
+
+        if (flat_pri_queue_compare(fpqueue, fpqueue->swap_area, parent) < 1) {
+            break;
+        }
+
+        memcpy(get_flat_pri_slot(fpqueue, slot_index), parent, fpqueue->slot_size);
+        SCL_STATS_ADD(fpqueue, sift_steps, 1);
+
+        slot_index = parent_index;
+    }
+
+    memcpy(get_flat_pri_slot(fpqueue, slot_index), fpqueue->swap_area, fpqueue->slot_size);
+}
+
+/**
+ * @brief Function to sift the slot from the swap area down, starting
+ * from an empty slot of the heap. The children of one node are stored
+ * one after another, so finding the highest ranking child scans just
+ * one contiguous block of arity slots.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @param slot_index index of the empty slot from the heap
+ */
+static void flat_sift_slot_down(flat_priority_queue_t * const __restrict__ fpqueue, size_t slot_index) {
+    /* Move the children up until the slot of the element is found */
+    for (;;) {
+        const size_t first_child = fpqueue->arity * slot_index + 1;
+
+        if (first_child >= fpqueue->slots.size) {
+            break;
+        }
+
+        size_t last_child = first_child + fpqueue->arity;
+
+        if (last_child > fpqueue->slots.size) {
+            last_child = fpqueue->slots.size;
+        }
+
+        /* Select the child with the highest rank */
+        size_t best_child = first_child;
+        const uint8_t *best = get_flat_pri_slot(fpqueue, first_child);
+
+        for (size_t child_index = first_child + 1; child_index < last_child; ++child_index) {
+            const uint8_t *child = get_flat_pri_slot(fpqueue, child_index);
+
+            if (flat_pri_queue_compare(fpqueue, child, best) >= 1) {
+                best_child = child_index;
+                best = child;
+            }
+        }
+
+        if (flat_pri_queue_compare(fpqueue, best, fpqueue->swap_area) < 1) {
+            break;
+        }
+
+        memcpy(get_flat_pri_slot(fpqueue, slot_index), best, fpqueue->slot_size);
+        SCL_STATS_ADD(fpqueue, sift_steps, 1);
+
+        slot_index = best_child;
+    }
+
+    memcpy(get_flat_pri_slot(fpqueue, slot_index), fpqueue->swap_area, fpqueue->slot_size);
+}
+
+/**
+ * @brief Function to insert one element into a flat priority queue in
+ * O(log n) with base arity. The priority and the data are copied inline
+ * into the slots array, which grows when it is full. Function may fail
+ * if the priority is not valid or if the data is not valid while the
+ * data size is not zero.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @param priority pointer to one priority element
+ * @param data pointer to one data element (ignored if data size is zero)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_pri_queue_push(flat_priority_queue_t * const __restrict__ fpqueue, const void *priority, const void *data) {
+    /* Check if input data is valid */
+    if (NULL == fpqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == fpqueue->slots.data) {
+        return SCL_NULL_PQUEUE_NODES;
+    }
+
+    if (NULL == priority) {
+        return SCL_INVALID_PRIORITY;
+    }
+
+    if ((NULL == data) && (0 != fpqueue->data_size)) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Check if flat priority queue is full, if true allocate more slots */
+    if (fpqueue->slots.size >= fpqueue->slots.capacity) {
+        if (SCL_OK != vector_reserve(&fpqueue->slots, fpqueue->slots.capacity * DEFAULT_REALLOC_RATIO)) {
+            errno = ENOMEM;
+            perror("Not enough memory to reallocate new slots");
+
+            return SCL_REALLOC_PQNODES_FAIL;
+        }
+    }
+
+    /* Build the new slot into the swap area */
+    memcpy(fpqueue->swap_area, priority, fpqueue->pri_size);
+
+    if (0 != fpqueue->data_size) {
+        memcpy(fpqueue->swap_area + fpqueue->data_offset, data, fpqueue->data_size);
+    }
+
+    /* Sift the new slot up from the end of the heap */
+    ++(fpqueue->slots.size);
+    flat_sift_slot_up(fpqueue, fpqueue->slots.size - 1);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the data element with the highest
+ * rank from a flat priority queue object. The pointer is valid
+ * just until the next push or pop, because slots are moved.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @return const void* pointer to first data element or `NULL` if
+ * queue is empty or has no data, user should not modify this pointer.
+ */
+const void* flat_pri_queue_top(const flat_priority_queue_t * const __restrict__ fpqueue) {
+    /* Check if input data is valid */
+    if ((NULL == fpqueue) || (NULL == fpqueue->slots.data) || (0 == fpqueue->slots.size) || (0 == fpqueue->data_size)) {
+        return NULL;
+    }
+
+    /* Return the peek data pointer */
+    return fpqueue->slots.data + fpqueue->data_offset;
+}
+
+/**
+ * @brief Function to get the priority element with the highest
+ * rank from a flat priority queue object. The pointer is valid
+ * just until the next push or pop, because slots are moved.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @return const void* pointer to first priority element or `NULL` if
+ * queue is empty, user should not modify this pointer.
+ */
+const void* flat_pri_queue_top_pri(const flat_priority_queue_t * const __restrict__ fpqueue) {
+    /* Check if input data is valid */
+    if ((NULL == fpqueue) || (NULL == fpqueue->slots.data) || (0 == fpqueue->slots.size)) {
+        return NULL;
+    }
+
+    /* Return the highest ranking priority */
+    return fpqueue->slots.data;
+}
+
+/**
+ * @brief Function to remove the highest rank element from a flat
+ * priority queue object. Function may fail if flat priority queue
+ * is empty or not allocated.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_pri_queue_pop(flat_priority_queue_t * const __restrict__ fpqueue) {
+    /* Check if input data is valid and if there are slots to pop from flat priority queue */
+    if (NULL == fpqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == fpqueue->slots.data) {
+        return SCL_NULL_PQUEUE_NODES;
+    }
+
+    if (0 == fpqueue->slots.size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
 
-        if (SCL_OK != err) {
-            return err;
+    /* Free the content of the top slot */
+    if (NULL != fpqueue->frd_pr) {
+        fpqueue->frd_pr(fpqueue->slots.data);
+    }
+
+    if ((NULL != fpqueue->frd_dt) && (0 != fpqueue->data_size)) {
+        fpqueue->frd_dt(fpqueue->slots.data + fpqueue->data_offset);
+    }
+
+    /* Decrease flat priority queue size */
+    --(fpqueue->slots.size);
+
+    /* Sift the last slot down from the top of the heap */
+    if (0 != fpqueue->slots.size) {
+        memcpy(fpqueue->swap_area, get_flat_pri_slot(fpqueue, fpqueue->slots.size), fpqueue->slot_size);
+        flat_sift_slot_down(fpqueue, 0);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function that will traverse all slots of a flat priority queue
+ * in heap order and will call the action function for every data element
+ * (or for every priority if the data size is zero). The action must not
+ * change the ranks of the elements.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @param action a pointer to a function that will perform an action
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_pri_queue_traverse(const flat_priority_queue_t * const __restrict__ fpqueue, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == fpqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == fpqueue->slots.data) {
+        return SCL_NULL_PQUEUE_NODES;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    const size_t offset = (0 == fpqueue->data_size) ? 0 : fpqueue->data_offset;
+
+    /* Scan the slots array linearly */
+    for (size_t iter = 0; iter < fpqueue->slots.size; ++iter) {
+        action(get_flat_pri_slot(fpqueue, iter) + offset);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function will return the size of the flat priority queue
+ * object. If flat priority queue is not allocated than `SIZE_MAX`
+ * will be returned as an warning.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @return size_t current size of the flat priority queue object
+ */
+size_t flat_pri_queue_size(const flat_priority_queue_t * const __restrict__ fpqueue) {
+    /* Check if flat priority queue is valid */
+    if (NULL == fpqueue) {
+        return SIZE_MAX;
+    }
+
+    /* Return flat priority queue size */
+    return fpqueue->slots.size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a flat priority queue.
+ * The priorities and the data of the used slots are the payload, their
+ * padding is counted as node bytes and the free slots as slack.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_pri_queue_memory_usage(const flat_priority_queue_t * const __restrict__ fpqueue, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == fpqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const size_t size = fpqueue->slots.size;
+
+    /* The object and its scratch slot */
+    usage->object_bytes = sizeof(*fpqueue) + fpqueue->slot_size;
+    usage->payload_bytes = size * (fpqueue->pri_size + fpqueue->data_size);
+    usage->node_bytes = size * fpqueue->slot_size - usage->payload_bytes;
+    usage->array_bytes = 0;
+    usage->slack_bytes = (fpqueue->slots.capacity - size) * fpqueue->slot_size;
+    usage->nodes = size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the operation counters of a flat priority queue, priority comparisons and sift steps.
+ * The counters are kept only when the library is built with SCL_STATS.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @param stats pointer to the counters to fill (set to zero without SCL_STATS)
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t flat_pri_queue_get_stats(const flat_priority_queue_t * const __restrict__ fpqueue, scl_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == fpqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return SCL_STATS_GET(fpqueue, stats);
+}
+
+/**
+ * @brief Function to set the operation counters of a flat priority queue to zero.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t flat_pri_queue_reset_stats(flat_priority_queue_t * const __restrict__ fpqueue) {
+    /* Check if input data is valid */
+    if (NULL == fpqueue) {
+        return SCL_NULL_PRIORITY_QUEUE;
+    }
+
+    return SCL_STATS_RESET(fpqueue);
+}
+
+/**
+ * @brief Function to check if a flat priority queue object is
+ * empty or not. A not allocated object is also an empty object.
+ * 
+ * @param fpqueue an allocated flat priority queue object
+ * @return uint8_t 1 if flat priority queue is not allocated or empty, 0 otherwise
+ */
+uint8_t is_flat_priq_empty(const flat_priority_queue_t * const __restrict__ fpqueue) {
+    /* Check if flat priority queue is valid and if it is empty */
+    if ((NULL == fpqueue) || (NULL == fpqueue->slots.data) || (0 == fpqueue->slots.size)) {
+        return 1;
+    }
+
+    /* Flat priority queue is not empty */
+    return 0;
+}
+
+/**
+ * @brief MACRO to get one slot {key, data} from a bucket of a radix heap
+ * 
+ */
+#define get_radix_slot(rheap, bucket, slot_index) ((rheap)->buckets[(bucket)].data + (slot_index) * (rheap)->slot_size)
+
+/**
+ * @brief Create a radix heap object, a monotone min priority queue
+ * with `uint64_t` keys. The keys pushed into the heap must not be lower
+ * than the last popped key (as the distances of the Dijkstra algorithm),
+ * in exchange push is O(1) and pop is amortized O(log C), where C is the
+ * largest difference between a pushed key and the last popped key.
+ * The buckets are allocated at their first push.
+ * 
+ * @param frd_dt a pointer to a function to free memory of one data set
+ * @param data_size length in bytes of the data data type (may be zero)
+ * @return radix_heap_t* a new allocated radix heap object or `NULL` if function fails
+ */
+radix_heap_t* create_radix_heap(free_func frd_dt, size_t data_size) {
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new radix heap object on heap memory */
+    radix_heap_t *new_rheap = scl_malloc(allocator, sizeof(*new_rheap));
+
+    /* Check if radix heap was allocated successfully */
+    if (NULL == new_rheap) {
+        errno = ENOMEM;
+        perror("Not enough memory for radix heap allocation");
+        return NULL;
+    }
+
+    new_rheap->allocator = allocator;
+    new_rheap->frd_dt = frd_dt;
+    new_rheap->data_size = data_size;
+    new_rheap->used_buckets = 0;
+    new_rheap->last = 0;
+    new_rheap->size = 0;
+
+    /* Every slot starts with its key, the data follows it inline */
+    new_rheap->slot_size = (sizeof(uint64_t) + data_size + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+
+    for (size_t iter = 0; iter < RADIX_HEAP_BUCKETS; ++iter) {
+        vector_init(&new_rheap->buckets[iter], NULL, new_rheap->slot_size, allocator);
+    }
+
+    /* Return a new allocated radix heap */
+    return new_rheap;
+}
+
+/**
+ * @brief Function to free the data of every element of one bucket
+ * of a radix heap and to empty the bucket, its capacity is kept.
+ * MUST not be used outside this file.
+ * 
+ * @param rheap an allocated radix heap object
+ * @param bucket index of the bucket to empty
+ */
+static void radix_heap_clear_bucket(radix_heap_t * const __restrict__ rheap, size_t bucket) {
+    if ((NULL != rheap->frd_dt) && (0 != rheap->data_size)) {
+        for (size_t iter = 0; iter < rheap->buckets[bucket].size; ++iter) {
+            rheap->frd_dt(get_radix_slot(rheap, bucket, iter) + sizeof(uint64_t));
+        }
+    }
+
+    rheap->buckets[bucket].size = 0;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a
+ * specific radix heap object. The data of every element still in
+ * heap is freed with frd_dt function.
+ * 
+ * @param rheap an allocated radix heap object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_radix_heap(radix_heap_t * const __restrict__ rheap) {
+    /* Check if radix heap needs to be freed */
+    if (NULL == rheap) {
+        return SCL_NULL_RADIX_HEAP;
+    }
+
+    for (size_t iter = 0; iter < RADIX_HEAP_BUCKETS; ++iter) {
+        radix_heap_clear_bucket(rheap, iter);
+        vector_release(&rheap->buckets[iter]);
+    }
+
+    scl_free(rheap->allocator, rheap);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the bucket of one key of a radix heap, the
+ * position of the highest bit where the key differs from the last popped
+ * key plus one, or zero if the keys are equal. MUST not be used outside this file.
+ * 
+ * @param last last popped key of a radix heap
+ * @param key key to find its bucket
+ * @return size_t index of the bucket of the key
+ */
+static inline size_t radix_heap_bucket(uint64_t last, uint64_t key) {
+    return (last == key) ? 0 : (size_t)(64 - __builtin_clzll(last ^ key));
+}
+
+/**
+ * @brief Function to insert one element into a radix heap in O(1).
+ * The key must not be lower than the last popped key, the data is
+ * copied into the heap. Function may fail if the key is too low or if
+ * no heap memory is left.
+ * 
+ * @param rheap an allocated radix heap object
+ * @param key key of the new element
+ * @param data pointer to the data of the new element (ignored if data size is zero)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t radix_heap_push(radix_heap_t * const __restrict__ rheap, uint64_t key, const void * __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == rheap) {
+        return SCL_NULL_RADIX_HEAP;
+    }
+
+    if ((NULL == data) && (0 != rheap->data_size)) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (key < rheap->last) {
+        return SCL_RADIX_HEAP_KEY_TOO_LOW;
+    }
+
+    const size_t bucket = radix_heap_bucket(rheap->last, key);
+    vector_t * const slots = &rheap->buckets[bucket];
+
+    /* Make room for one more slot */
+    if (slots->size >= slots->capacity) {
+        if (SCL_OK != vector_reserve(slots, (0 == slots->capacity) ? DEFAULT_CAPACITY : slots->capacity * DEFAULT_REALLOC_RATIO)) {
+            errno = ENOMEM;
+            perror("Not enough memory to reallocate radix heap bucket");
+
+            return SCL_REALLOC_PQNODES_FAIL;
+        }
+    }
+
+    uint8_t * const slot = slots->data + (slots->size++) * rheap->slot_size;
+
+    memcpy(slot, &key, sizeof(key));
+
+    if (0 != rheap->data_size) {
+        memcpy(slot + sizeof(key), data, rheap->data_size);
+    }
+
+    if (0 != bucket) {
+        rheap->used_buckets |= (uint64_t)1 << (bucket - 1);
+    }
+
+    ++(rheap->size);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove the element with the lowest key from a
+ * radix heap. If bucket 0 is empty the first not empty bucket is split,
+ * its lowest key becomes the last key and every of its elements moves
+ * into a lower bucket. The key and the data of the element are copied
+ * into the key and data buffers, if the data buffer is `NULL` the data
+ * is freed with frd_dt instead. Function may fail if radix heap is empty.
+ * 
+ * @param rheap an allocated radix heap object
+ * @param key pointer to the buffer for the key (may be `NULL`)
+ * @param data pointer to the buffer for the data (may be `NULL`)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t radix_heap_pop(radix_heap_t * const __restrict__ rheap, uint64_t * const __restrict__ key, void * __restrict__ data) {
+    /* Check if input data is valid and if there are elements to pop from radix heap */
+    if (NULL == rheap) {
+        return SCL_NULL_RADIX_HEAP;
+    }
+
+    if (0 == rheap->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* Split the first not empty bucket around its lowest key */
+    if (0 == rheap->buckets[0].size) {
+        size_t bucket = 0;
+
+        while (0 == bucket) {
+            const size_t candidate = 1 + (size_t)__builtin_ctzll(rheap->used_buckets);
+
+            if (0 == rheap->buckets[candidate].size) {
+                rheap->used_buckets &= ~((uint64_t)1 << (candidate - 1));
+            } else {
+                bucket = candidate;
+            }
+        }
+
+        vector_t * const slots = &rheap->buckets[bucket];
+        uint64_t new_last = UINT64_MAX;
+
+        for (size_t iter = 0; iter < slots->size; ++iter) {
+            uint64_t slot_key = 0;
+
+            memcpy(&slot_key, get_radix_slot(rheap, bucket, iter), sizeof(slot_key));
+
+            if (slot_key < new_last) {
+                new_last = slot_key;
+            }
+        }
+
+        rheap->last = new_last;
+
+        /* Every element differs from the new last key on a lower bit */
+        for (size_t iter = 0; iter < slots->size; ++iter) {
+            const uint8_t * const slot = get_radix_slot(rheap, bucket, iter);
+            uint64_t slot_key = 0;
+
+            memcpy(&slot_key, slot, sizeof(slot_key));
+
+            const size_t new_bucket = radix_heap_bucket(new_last, slot_key);
+            vector_t * const new_slots = &rheap->buckets[new_bucket];
+
+            if (new_slots->size >= new_slots->capacity) {
+                if (SCL_OK != vector_reserve(new_slots, (0 == new_slots->capacity) ? DEFAULT_CAPACITY : new_slots->capacity * DEFAULT_REALLOC_RATIO)) {
+                    /* Keep the elements not moved yet into their bucket */
+                    memmove(slots->data, slot, (slots->size - iter) * rheap->slot_size);
+                    slots->size -= iter;
+
+                    errno = ENOMEM;
+                    perror("Not enough memory to reallocate radix heap bucket");
+
+                    return SCL_REALLOC_PQNODES_FAIL;
+                }
+            }
+
+            memcpy(new_slots->data + (new_slots->size++) * rheap->slot_size, slot, rheap->slot_size);
+
+            if (0 != new_bucket) {
+                rheap->used_buckets |= (uint64_t)1 << (new_bucket - 1);
+            }
+        }
+
+        slots->size = 0;
+        rheap->used_buckets &= ~((uint64_t)1 << (bucket - 1));
+    }
+
+    /* Every element of bucket 0 has the lowest key */
+    vector_t * const slots = &rheap->buckets[0];
+    uint8_t * const slot = get_radix_slot(rheap, 0, slots->size - 1);
+
+    if (NULL != key) {
+        memcpy(key, slot, sizeof(*key));
+    }
+
+    if (0 != rheap->data_size) {
+        if (NULL != data) {
+            memcpy(data, slot + sizeof(uint64_t), rheap->data_size);
+        } else if (NULL != rheap->frd_dt) {
+            rheap->frd_dt(slot + sizeof(uint64_t));
         }
     }
 
-    /* Free heap memory in O(N) complexity */
-    return free_priority_queue(heap);
+    --(slots->size);
+    --(rheap->size);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove every element from a radix heap, the data
+ * of the elements is freed with frd_dt function. The buckets keep their
+ * capacity and the last key is set back to zero.
+ * 
+ * @param rheap an allocated radix heap object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t radix_heap_clear(radix_heap_t * const __restrict__ rheap) {
+    /* Check if input data is valid */
+    if (NULL == rheap) {
+        return SCL_NULL_RADIX_HEAP;
+    }
+
+    for (size_t iter = 0; iter < RADIX_HEAP_BUCKETS; ++iter) {
+        radix_heap_clear_bucket(rheap, iter);
+    }
+
+    rheap->used_buckets = 0;
+    rheap->last = 0;
+    rheap->size = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the last key popped from a radix heap, the
+ * lowest key that can still be pushed. If radix heap is not allocated
+ * than `UINT64_MAX` will be returned as an warning.
+ * 
+ * @param rheap an allocated radix heap object
+ * @return uint64_t last popped key or zero if nothing was popped
+ */
+uint64_t radix_heap_last_key(const radix_heap_t * const __restrict__ rheap) {
+    /* Check if radix heap is valid */
+    if (NULL == rheap) {
+        return UINT64_MAX;
+    }
+
+    return rheap->last;
+}
+
+/**
+ * @brief Function will return the size of the radix heap
+ * object. If radix heap is not allocated than `SIZE_MAX`
+ * will be returned as an warning.
+ * 
+ * @param rheap an allocated radix heap object
+ * @return size_t current size of the radix heap object
+ */
+size_t radix_heap_size(const radix_heap_t * const __restrict__ rheap) {
+    /* Check if radix heap is valid */
+    if (NULL == rheap) {
+        return SIZE_MAX;
+    }
+
+    /* Return radix heap size */
+    return rheap->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a radix heap. The
+ * keys and the data of the elements are the payload, the padding of
+ * their slots is counted as node bytes and the free slots of every
+ * bucket as slack.
+ * 
+ * @param rheap an allocated radix heap object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t radix_heap_memory_usage(const radix_heap_t * const __restrict__ rheap, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == rheap) {
+        return SCL_NULL_RADIX_HEAP;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    size_t capacity = 0;
+
+    for (size_t iter = 0; iter < RADIX_HEAP_BUCKETS; ++iter) {
+        capacity += rheap->buckets[iter].capacity;
+    }
+
+    usage->object_bytes = sizeof(*rheap);
+    usage->payload_bytes = rheap->size * (sizeof(uint64_t) + rheap->data_size);
+    usage->node_bytes = rheap->size * rheap->slot_size - usage->payload_bytes;
+    usage->array_bytes = 0;
+    usage->slack_bytes = (capacity - rheap->size) * rheap->slot_size;
+    usage->nodes = rheap->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if a radix heap object is
+ * empty or not. A not allocated object is also an empty object.
+ * 
+ * @param rheap an allocated radix heap object
+ * @return uint8_t 1 if radix heap is not allocated or empty, 0 otherwise
+ */
+uint8_t is_radix_heap_empty(const radix_heap_t * const __restrict__ rheap) {
+    /* Check if radix heap is valid and if it is empty */
+    if ((NULL == rheap) || (0 == rheap->size)) {
+        return 1;
+    }
 
-    /* Overall complexity O(NlogN) */
+    /* Radix heap is not empty */
+    return 0;
 }
@@ -38,11 +38,15 @@ queue_t* create_queue(free_func frd, size_t data_size) {
         return NULL;
     }
 
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new queue on the heap */
-    queue_t *new_queue = malloc(sizeof(*new_queue));
+    queue_t *new_queue = scl_malloc(allocator, sizeof(*new_queue));
 
     /* Check if queue allocation went right */
     if (NULL != new_queue) {
+        new_queue->allocator = allocator;
 
         /* Set function pointers */
         new_queue->frd = frd;
@@ -51,6 +55,11 @@ queue_t* create_queue(free_func frd, size_t data_size) {
         new_queue->front = new_queue->back = NULL;
         new_queue->data_size = data_size;
         new_queue->size = 0;
+
+        /* Queue starts in the linked mode */
+        new_queue->ring = NULL;
+        new_queue->capacity = 0;
+        new_queue->head = 0;
     } else {
         errno = ENOMEM;
         perror("Not enough memory for queue allocation");
@@ -60,6 +69,56 @@ queue_t* create_queue(free_func frd, size_t data_size) {
     return new_queue;
 }
 
+/**
+ * @brief Subroutine function to get the element of the ring mode that is
+ * `index` positions after the front, the capacity is a power of two so the
+ * position wraps around by a mask.
+ * 
+ * @param queue a queue object in the ring mode
+ * @param index number of elements after the front
+ * @return void* pointer to the element
+ */
+static inline void* queue_ring_elem(const queue_t * const __restrict__ queue, size_t index) {
+    return queue->ring + ((queue->head + index) & (queue->capacity - 1)) * queue->data_size;
+}
+
+/**
+ * @brief Subroutine function to move the elements of the ring mode into a
+ * new ring of new_capacity elements, the front element goes at index 0.
+ * 
+ * @param queue a queue object in the ring mode
+ * @param new_capacity number of elements of the new ring (a power of two)
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t queue_ring_resize(queue_t * const __restrict__ queue, size_t new_capacity) {
+    uint8_t *new_ring = scl_malloc(queue->allocator, new_capacity * queue->data_size);
+
+    if (NULL == new_ring) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    /* Elements from the head to the end of the ring, then the wrapped ones */
+    size_t first_part = queue->capacity - queue->head;
+
+    if (first_part > queue->size) {
+        first_part = queue->size;
+    }
+
+    if (0 != queue->size) {
+        memcpy(new_ring, queue->ring + queue->head * queue->data_size, first_part * queue->data_size);
+        memcpy(new_ring + first_part * queue->data_size, queue->ring, (queue->size - first_part) * queue->data_size);
+    }
+
+    scl_free(queue->allocator, queue->ring);
+
+    queue->ring = new_ring;
+    queue->capacity = new_capacity;
+    queue->head = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Create a queue node object. Allocation of a new node
  * may fail if address of data is not valid or if not enough
@@ -77,7 +136,7 @@ static queue_node_t* create_queue_node(const queue_t * const __restrict__ queue,
     }
 
     /* Allocate a new node on the heap */
-    queue_node_t *new_node = malloc(sizeof(*new_node));
+    queue_node_t *new_node = scl_malloc(queue->allocator, SCL_ALIGN_SIZE(sizeof(*new_node)) + queue->data_size);
 
     /* Check if node allocation went successfully */
     if (NULL != new_node) {
@@ -85,21 +144,11 @@ static queue_node_t* create_queue_node(const queue_t * const __restrict__ queue,
         /* Set default next pointer */
         new_node->next = NULL;
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(queue->data_size);
+        /* The data is stored inline, right after the node, in the same block */
+        new_node->data = (uint8_t *)new_node + SCL_ALIGN_SIZE(sizeof(*new_node));
 
-        /* Check if memory allocation went right */
-        if (new_node->data) {
-
-            /* Copy all bytes from data address to new node's data */
-            memcpy(new_node->data, data, queue->data_size);
-        } else {
-            free(new_node);
-            new_node = NULL;
-
-            errno = ENOMEM;
-            perror("Not enough memory for node queue allocation");
-        }
+        /* Copy all bytes from data address to new node's data */
+        memcpy(new_node->data, data, queue->data_size);
     } else {
         errno = ENOMEM;
         perror("Not enough memory for node queue allocation");
@@ -123,6 +172,18 @@ scl_error_t free_queue(queue_t * const __restrict__ queue) {
     /* Check if queue needs to be freed */
     if (NULL != queue) {
 
+        /* Free content of every element of the ring mode */
+        if (NULL != queue->ring) {
+            if (NULL != queue->frd) {
+                for (size_t iter = 0; iter < queue->size; ++iter) {
+                    queue->frd(queue_ring_elem(queue, iter));
+                }
+            }
+
+            scl_free(queue->allocator, queue->ring);
+            queue->ring = NULL;
+        }
+
         /* Iterate through every node from queue */
         while (NULL != queue->front) {
             queue_node_t *iterator = queue->front;
@@ -135,17 +196,12 @@ scl_error_t free_queue(queue_t * const __restrict__ queue) {
                 queue->frd(iterator->data);
             }
 
-            /* Free node pointer to data */
-            if (NULL != iterator->data) {
-                free(iterator->data);
-            }
-
             /* Set node pointer to data as `NULL` */
             iterator->data = NULL;
 
             /* Free node pointer */
             if (NULL != iterator) {
-                free(iterator);
+                scl_free(queue->allocator, iterator);
             }
 
             /* Set node pointer as `NULL` */
@@ -153,7 +209,7 @@ scl_error_t free_queue(queue_t * const __restrict__ queue) {
         }
 
         /* Free queue object */
-        free(queue);
+        scl_free(queue->allocator, queue);
 
         return SCL_OK;
     }
@@ -183,8 +239,14 @@ scl_error_t print_queue(const queue_t * const __restrict__ queue, action_func pr
     } 
 
     /* Queue is empty, print [] */
-    if (NULL == queue->front) {
+    if (0 == queue->size) {
         printf("[ ]");
+    } else if (NULL != queue->ring) {
+
+        /* Print the ring from the front to the back */
+        for (size_t iter = 0; iter < queue->size; ++iter) {
+            print(queue_ring_elem(queue, iter));
+        }
     } else {
         const queue_node_t *iterator = queue->front;
 
@@ -201,6 +263,74 @@ scl_error_t print_queue(const queue_t * const __restrict__ queue, action_func pr
     return SCL_OK;
 }
 
+/**
+ * @brief Function to switch a queue into the ring mode. The elements are
+ * kept inline in a circular buffer whose capacity is a power of two and
+ * doubles when it is full, so push and pop do not call the allocator
+ * (except when the ring grows). The elements already in the queue are moved
+ * into the ring. A pointer returned by queue_front or queue_back is valid
+ * just until the next push or pop.
+ * 
+ * @param queue an allocated queue object
+ * @param initial_capacity number of elements of the first ring, rounded up
+ * to a power of two (at least QUEUE_RING_MIN_CAPACITY)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t queue_use_ring(queue_t * const __restrict__ queue, size_t initial_capacity) {
+    /* Check if queue is allocated */
+    if (NULL == queue) {
+        return SCL_NULL_QUEUE;
+    }
+
+    /* Queue already uses a ring */
+    if (NULL != queue->ring) {
+        return SCL_OK;
+    }
+
+    if (initial_capacity < queue->size) {
+        initial_capacity = queue->size;
+    }
+
+    /* Round the capacity up to a power of two */
+    size_t capacity = QUEUE_RING_MIN_CAPACITY;
+
+    while (capacity < initial_capacity) {
+        if (capacity > SIZE_MAX / 2 / queue->data_size) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        capacity *= 2;
+    }
+
+    if (capacity > SIZE_MAX / queue->data_size) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    uint8_t *new_ring = scl_malloc(queue->allocator, capacity * queue->data_size);
+
+    if (NULL == new_ring) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* Move the nodes into the ring, the front node goes at index 0 */
+    for (size_t iter = 0; iter < queue->size; ++iter) {
+        queue_node_t *delete_node = queue->front;
+
+        queue->front = queue->front->next;
+
+        memcpy(new_ring + iter * queue->data_size, delete_node->data, queue->data_size);
+        scl_free(queue->allocator, delete_node);
+    }
+
+    queue->front = queue->back = NULL;
+    queue->ring = new_ring;
+    queue->capacity = capacity;
+    queue->head = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to check if a queue object
  * is empty or not. The function tests if front of queue
@@ -212,7 +342,7 @@ scl_error_t print_queue(const queue_t * const __restrict__ queue, action_func pr
  * @return uint8_t 1(True) if queue is not allocated or empty and 0(False) otherwise
  */
 uint8_t is_queue_empty(const queue_t * const __restrict__ queue) {
-    if ((NULL == queue) || (NULL == queue->front)) {
+    if ((NULL == queue) || (0 == queue->size)) {
         return 1;
     }
     
@@ -235,6 +365,42 @@ size_t get_queue_size(const queue_t * const __restrict__ queue) {
     return queue->size;
 }
 
+/**
+ * @brief Function to get the memory footprint of a queue. In the linked
+ * mode every node holds one element inline and its link is the node
+ * overhead, in the ring mode the free capacity of the ring is slack.
+ * 
+ * @param queue an allocated queue object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t queue_memory_usage(const queue_t * const __restrict__ queue, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == queue) {
+        return SCL_NULL_QUEUE;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*queue);
+    usage->node_bytes = 0;
+    usage->payload_bytes = queue->size * queue->data_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = 0;
+    usage->nodes = queue->size;
+
+    if (NULL != queue->ring) {
+        usage->slack_bytes = (queue->capacity - queue->size) * queue->data_size;
+    } else {
+        usage->node_bytes = queue->size * SCL_ALIGN_SIZE(sizeof(*queue->front));
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to return the real data of the
  * front node. If queue is not allocated or queue is empty
@@ -245,10 +411,15 @@ size_t get_queue_size(const queue_t * const __restrict__ queue) {
  * @return const void* a pointer to front element data
  */
 const void* queue_front(const queue_t * const __restrict__ queue) {
-    if ((NULL == queue) || (NULL == queue->front)) {
+    if ((NULL == queue) || (0 == queue->size)) {
         return NULL;
     }
 
+    /* Front of the ring mode is at the head index */
+    if (NULL != queue->ring) {
+        return queue_ring_elem(queue, 0);
+    }
+
     return queue->front->data;
 }
 
@@ -262,10 +433,15 @@ const void* queue_front(const queue_t * const __restrict__ queue) {
  * @return const void* a pointer to front element data
  */
 const void* queue_back(const queue_t * const __restrict__ queue) {
-    if ((NULL == queue) || (NULL == queue->back)) {
+    if ((NULL == queue) || (0 == queue->size)) {
         return NULL;
     }
 
+    /* Back of the ring mode is the last element after the head */
+    if (NULL != queue->ring) {
+        return queue_ring_elem(queue, queue->size - 1);
+    }
+
     return queue->back->data;
 }
 
@@ -288,6 +464,28 @@ scl_error_t queue_push(queue_t * const __restrict__ queue, const void * __restri
         return SCL_INVALID_DATA;
     }
 
+    /* Ring mode copies the data after the back element */
+    if (NULL != queue->ring) {
+
+        /* Ring is full, double it */
+        if (queue->size == queue->capacity) {
+            if (queue->capacity > SIZE_MAX / 2 / queue->data_size) {
+                return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+            }
+
+            scl_error_t err = queue_ring_resize(queue, 2 * queue->capacity);
+
+            if (SCL_OK != err) {
+                return err;
+            }
+        }
+
+        memcpy(queue_ring_elem(queue, queue->size), data, queue->data_size);
+        ++(queue->size);
+
+        return SCL_OK;
+    }
+
     /* Create a new queue node */
     queue_node_t *new_node = create_queue_node(queue, data);
 
@@ -332,10 +530,21 @@ scl_error_t queue_pop(queue_t * const __restrict__ queue) {
         return SCL_NULL_QUEUE;
     }
 
-    if ((NULL == queue->front) || (0 == queue->size)) {
+    if (0 == queue->size) {
         return SCL_DELETE_FROM_EMPTY_OBJECT;
     }
 
+    /* Ring mode just moves the head to the next element */
+    if (NULL != queue->ring) {
+        if (NULL != queue->frd) {
+            queue->frd(queue_ring_elem(queue, 0));
+        }
+
+        queue->head = (queue->head + 1) & (queue->capacity - 1);
+        --(queue->size);
+
+        return SCL_OK;
+    }
 
     /* Pointer to current wipe node */
     queue_node_t *delete_node = queue->front;
@@ -343,6 +552,11 @@ scl_error_t queue_pop(queue_t * const __restrict__ queue) {
     /* Update the front pointer of the queue */
     queue->front = queue->front->next;
 
+    /* Queue became empty, the back node is deleted too */
+    if (NULL == queue->front) {
+        queue->back = NULL;
+    }
+
     /* Decrease queue size */
     --(queue->size);
 
@@ -351,17 +565,12 @@ scl_error_t queue_pop(queue_t * const __restrict__ queue) {
         queue->frd(delete_node->data);
     }
 
-    /* Free pointer to data memory location */
-    if (NULL != delete_node->data) {
-        free(delete_node->data);
-    }
-
     /* Set data pointer to default value */
     delete_node->data = NULL;
 
     /* Free node memory */
     if (NULL != delete_node) {
-        free(delete_node);
+        scl_free(queue->allocator, delete_node);
     }
 
     /* Set node poiner to default value */
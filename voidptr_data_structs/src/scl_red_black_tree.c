@@ -25,6 +25,8 @@
 #include "./include/scl_red_black_tree.h"
 #include "./include/scl_queue.h"
 
+#include <assert.h>
+
 /**
  * @brief Create a red-black tree object. Allocation may fail if there
  * is not enough memory on heap or cmp function is not valid
@@ -50,24 +52,29 @@ rbk_tree_t* create_rbk(compare_func cmp, free_func frd, size_t data_size) {
         return NULL;
     }
 
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new red-black tree object on heap */
-    rbk_tree_t *new_tree = malloc(sizeof(*new_tree));
+    rbk_tree_t *new_tree = scl_malloc(allocator, sizeof(*new_tree));
 
     /* Check if red-black tree object was allocated */
     if (NULL != new_tree) {
+        new_tree->allocator = allocator;
 
         /* Set function pointers */
         new_tree->cmp = cmp;
         new_tree->frd = frd;
 
         /* Create `nil` node */
-        new_tree->nil = malloc(sizeof(*new_tree->nil));
+        new_tree->nil = scl_malloc(allocator, sizeof(*new_tree->nil));
 
         /* Set default values for a `nil` cell*/
         if (NULL != new_tree->nil) {
             new_tree->nil->data = NULL;
             new_tree->nil->color = BLACK;
             new_tree->nil->count = 1;
+            new_tree->nil->weight = 0;
             new_tree->nil->left = new_tree->nil->right = new_tree->nil;
             new_tree->nil->parent = new_tree->nil;
         } else {
@@ -79,6 +86,14 @@ rbk_tree_t* create_rbk(compare_func cmp, free_func frd, size_t data_size) {
         new_tree->root = new_tree->nil;
         new_tree->data_size = data_size;
         new_tree->size = 0;
+        new_tree->node_pool = NULL;
+        new_tree->filter = NULL;
+        new_tree->filter_hash = NULL;
+        new_tree->order_stats = 0;
+        (void)SCL_STATS_RESET(new_tree);
+
+        /* Known compare functions of the library are done inline */
+        new_tree->key_kind = scl_key_kind_of(cmp, data_size);
     } else {
         errno = ENOMEM;
         perror("Not enough memory for red-black allocation");
@@ -104,36 +119,34 @@ static rbk_tree_node_t* create_rbk_node(const rbk_tree_t * const __restrict__ tr
         return tree->nil;
     }
 
-    /* Allocate a new node on the heap */
-    rbk_tree_node_t *new_node = malloc(sizeof(*new_node));
+    /* Allocate a new node from the node pool or on the heap */
+    rbk_tree_node_t *new_node = NULL;
+
+    if (NULL != tree->node_pool) {
+        new_node = mem_pool_alloc(tree->node_pool);
+    } else {
+        new_node = scl_malloc(tree->allocator, SCL_ALIGN_SIZE(sizeof(*new_node)) + tree->data_size);
+    }
 
     /* Check if allocation went successfully */
     if (NULL != new_node) {
+        SCL_STATS_ADD(tree, allocations, 1);
 
         /* Set default node data */
         new_node->right = new_node->left = tree->nil;
         new_node->parent = tree->nil;
         new_node->count = 1;
+        new_node->weight = 1;
         new_node->color = RED;
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(tree->data_size);
-
-        /* Check if memory allocation went right */
-        if (NULL != new_node->data) {
-
-            /*
-             * Copy all bytes from data pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->data, data, tree->data_size);
-        } else {
-            free(new_node);
-            new_node = tree->nil;
+        /* The data is stored inline, right after the node, in the same block */
+        new_node->data = (uint8_t *)new_node + SCL_ALIGN_SIZE(sizeof(*new_node));
 
-            errno = ENOMEM;
-            perror("Not enough memory for node red-black data allocation");
-        }
+        /*
+         * Copy all bytes from data pointer
+         * to memory allocated on heap
+         */
+        memcpy(new_node->data, data, tree->data_size);
     } else {
         new_node = tree->nil;
         errno = ENOMEM;
@@ -145,42 +158,51 @@ static rbk_tree_node_t* create_rbk_node(const rbk_tree_t * const __restrict__ tr
 }
 
 /**
- * @brief A helper function for free_rbk function.
- * Function will iterate through all nodes recursively
- * by Left-Right-Root principle.
+ * @brief A helper function for free_rbk function. The nodes of the
+ * tree are freed without recursion, by rotating the left child of
+ * the current node up until it has no left child and then freeing
+ * it and moving to its right child. Colors and parent links are not
+ * fixed by the rotations, so the walk is just pointer updates, O(N)
+ * in total.
  * 
  * @param tree an allocated red-black tree object
- * @param root pointer to pointer of current red-black node object
+ * @param root pointer to pointer of the root rbk node object
  */
 static void free_rbk_helper(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t ** const __restrict__ root) {
-    /* Check if current node is valid */
-    if (tree->nil == *root) {
-        return;
-    }
+    rbk_tree_node_t *iterator = *root;
+
+    while (tree->nil != iterator) {
+        if (tree->nil != iterator->left) {
 
-    /* Recursive calls */
-    free_rbk_helper(tree, &(*root)->left);
-    free_rbk_helper(tree, &(*root)->right);
+            /* Rotate the left child up, the tree becomes a right chain */
+            rbk_tree_node_t *left_node = iterator->left;
 
-    /* Free content of the data pointer */
-    if ((NULL != tree->frd) && (NULL != (*root)->data)) {
-        tree->frd((*root)->data);
-    }
+            iterator->left = left_node->right;
+            left_node->right = iterator;
+            iterator = left_node;
+        } else {
+            rbk_tree_node_t *right_node = iterator->right;
 
-    /* Free data pointer */
-    if (NULL != (*root)->data) {
-        free((*root)->data);
-    }
+            /* Free content of the data pointer */
+            if ((NULL != tree->frd) && (NULL != iterator->data)) {
+                tree->frd(iterator->data);
+            }
 
-    /* Set data pointer as `NULL` */
-    (*root)->data = NULL;
+            /* Set data pointer as `NULL` */
+            iterator->data = NULL;
 
-    /* Free red-black node pointer */
-    if (tree->nil != *root) {
-        free(*root);
+            /* Free rbk node pointer */
+            if (NULL != tree->node_pool) {
+                mem_pool_free(tree->node_pool, iterator);
+            } else {
+                scl_free(tree->allocator, iterator);
+            }
 
-        *root = tree->nil;
+            iterator = right_node;
+        }
     }
+
+    *root = tree->nil;
 }
 
 /**
@@ -199,15 +221,29 @@ scl_error_t free_rbk(rbk_tree_t * const __restrict__ tree) {
     if (NULL != tree) {
 
         /* Free every node from red-black tree */
-        free_rbk_helper(tree, &tree->root);
+        if ((NULL == tree->node_pool) || (NULL != tree->frd)) {
+            free_rbk_helper(tree, &tree->root);
+        }
+
+        /* Free all chunks of the node pool at once */
+        if (NULL != tree->node_pool) {
+            free_mem_pool(tree->node_pool);
+            tree->node_pool = NULL;
+        }
         
+        /* Free the filter of the elements */
+        if (NULL != tree->filter) {
+            free_bloom_filter(tree->filter);
+            tree->filter = NULL;
+        }
+
         /* Free `nil` cell*/
-        free(tree->nil);
+        scl_free(tree->allocator, tree->nil);
 
         tree->nil = NULL;
 
         /* Free red-black tree object */
-        free(tree);
+        scl_free(tree->allocator, tree);
 
         return SCL_OK;
     }
@@ -215,6 +251,334 @@ scl_error_t free_rbk(rbk_tree_t * const __restrict__ tree) {
     return SCL_NULL_RBK;
 }
 
+/**
+ * @brief Function to make the red-black tree allocate its nodes from a node pool.
+ * Every node and its data are stored in one object of the pool, the objects
+ * are taken from contiguous chunks and are reused through a free list, and
+ * free_rbk releases whole chunks (without visiting the nodes if no free
+ * function was provided). The red-black tree must be empty.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param nodes_per_chunk number of nodes from one chunk of the pool (0 for default)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_use_node_pool(rbk_tree_t * const __restrict__ tree, size_t nodes_per_chunk) {
+    /* Check if tree is allocated */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    /* Nodes allocated on the heap cannot be moved into a pool */
+    if (0 != tree->size) {
+        return SCL_NOT_EMPTY_OBJECT_FOR_POOL;
+    }
+
+    /* Tree already uses a node pool */
+    if (NULL != tree->node_pool) {
+        return SCL_OK;
+    }
+
+    /* The pool takes its chunks from the allocator of the object */
+    const scl_allocator_t *thread_allocator = scl_get_allocator();
+
+    scl_set_allocator(tree->allocator);
+
+    /* One object of the pool holds the node and its data */
+    tree->node_pool = create_mem_pool(SCL_ALIGN_SIZE(sizeof(*tree->root)) + tree->data_size, nodes_per_chunk);
+    scl_set_allocator(thread_allocator);
+
+    /* Check if node pool was allocated successfully */
+    if (NULL == tree->node_pool) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Helper function for rbk_use_order_stats function. Function will
+ * set the weight of every node by Left-Right-Root principle.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root starting point of the red-black tree subtree
+ * @return size_t the weight of the subtree
+ */
+static size_t rbk_order_stats_helper(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const __restrict__ root) {
+    /* The `nil` node has no elements */
+    if (tree->nil == root) {
+        return 0;
+    }
+
+    root->weight = rbk_order_stats_helper(tree, root->left) + rbk_order_stats_helper(tree, root->right) + root->count;
+
+    return root->weight;
+}
+
+/**
+ * @brief Function to make every node of a red-black tree keep the number of
+ * elements from its subtree (its weight, equal elements are counted separately),
+ * so that rbk_select and rbk_rank work in O(logN) time. The weights are
+ * updated by every insertion, deletion and rotation. If the tree is not empty
+ * the weights are computed in O(N) time.
+ * 
+ * @param tree an allocated red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_use_order_stats(rbk_tree_t * const __restrict__ tree) {
+    /* Check if tree is allocated */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    /* Tree already keeps the weights */
+    if (0 != tree->order_stats) {
+        return SCL_OK;
+    }
+
+    rbk_order_stats_helper(tree, tree->root);
+    tree->order_stats = 1;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to select the kind of the elements of a red-black tree, so
+ * that searches compare the elements inline instead of calling the compare
+ * function. The kind MUST order the elements as the compare function of the tree
+ * does. Trees created with a compare function of the library already
+ * know the kind of their elements.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param kind kind of the elements or SCL_KEY_GENERIC to call the compare function
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_use_key_kind(rbk_tree_t * const __restrict__ tree, scl_key_kind_t kind) {
+    /* Check if tree is allocated */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    /* Elements must be wide enough for the kind */
+    if (0 == scl_key_kind_fits(kind, tree->data_size)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    tree->key_kind = kind;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Helper function to add the hash of every element of a subtree
+ * to a bloom filter. Function MUST not be used outside this file.
+ * 
+ * @param tree an allocated red-black tree object with a filter hash function
+ * @param root starting point of the red-black tree subtree
+ * @param filter pointer to an allocated bloom filter
+ */
+static void rbk_fill_bloom_filter(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, bloom_filter_t * const __restrict__ filter) {
+    /* The `nil` node has no elements */
+    if (tree->nil == root) {
+        return;
+    }
+
+    rbk_fill_bloom_filter(tree, root->left, filter);
+    bloom_filter_add_hash(filter, tree->filter_hash(root->data));
+    rbk_fill_bloom_filter(tree, root->right, filter);
+}
+
+/**
+ * @brief Function to create a new bloom filter of a red-black tree sized for
+ * twice its nodes, filled with all its elements. Function MUST not be used outside this file.
+ * 
+ * @param tree an allocated red-black tree object with a filter hash function
+ * @param bits_per_key number of bits of the filter for every element
+ * @return bloom_filter_t* new filter or `NULL` if allocation failed
+ */
+static bloom_filter_t* rbk_build_bloom_filter(const rbk_tree_t * const __restrict__ tree, size_t bits_per_key) {
+    /* The filter takes its blocks from the allocator of the object */
+    const scl_allocator_t *thread_allocator = scl_get_allocator();
+
+    scl_set_allocator(tree->allocator);
+
+    bloom_filter_t * const filter = create_bloom_filter(2 * tree->size, bits_per_key);
+    scl_set_allocator(thread_allocator);
+
+    if (NULL != filter) {
+        rbk_fill_bloom_filter(tree, tree->root, filter);
+    }
+
+    return filter;
+}
+
+/**
+ * @brief Function to rebuild the bloom filter of a red-black tree if too
+ * many elements were removed or added since it was built (see
+ * bloom_filter_needs_rebuild). If the new filter cannot be allocated the old
+ * one is kept, it still holds every element. Function MUST not be used outside this file.
+ * 
+ * @param tree an allocated red-black tree object
+ */
+static void rbk_refresh_bloom_filter(rbk_tree_t * const __restrict__ tree) {
+    if (0 == bloom_filter_needs_rebuild(tree->filter, tree->size)) {
+        return;
+    }
+
+    bloom_filter_t * const filter = rbk_build_bloom_filter(tree, tree->filter->bits_per_key);
+
+    if (NULL != filter) {
+        free_bloom_filter(tree->filter);
+        tree->filter = filter;
+    }
+}
+
+/**
+ * @brief Function to put a blocked bloom filter of the element hashes in
+ * front of the searches of a red-black tree. Every inserted element is added
+ * to the filter and **rbk_find_data** or **rbk_find_batch** of an element
+ * rejected by the filter return at once, after reading one cache line, without
+ * walking the tree. The hash function MUST give the same value for the elements
+ * the compare function of the tree finds equal. Removed elements stay in the
+ * filter until it is rebuilt, which is done by itself when more than half of
+ * its elements were removed or when it holds more elements than it was sized for.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param hash pointer to a function to hash the elements
+ * @param bits_per_key number of bits of the filter for every element (10 give
+ * about 1% false positives), 0 to remove the filter
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_use_bloom_filter(rbk_tree_t * const __restrict__ tree, hash_func hash, size_t bits_per_key) {
+    /* Check if tree is allocated */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    bloom_filter_t *filter = NULL;
+
+    if (0 != bits_per_key) {
+
+        /* A filter needs a hash function */
+        if (NULL == hash) {
+            return SCL_INVALID_INPUT;
+        }
+
+        const hash_func old_hash = tree->filter_hash;
+
+        tree->filter_hash = hash;
+        filter = rbk_build_bloom_filter(tree, bits_per_key);
+
+        /* Check if bloom filter was allocated successfully */
+        if (NULL == filter) {
+            tree->filter_hash = old_hash;
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+    } else {
+        tree->filter_hash = NULL;
+    }
+
+    if (NULL != tree->filter) {
+        free_bloom_filter(tree->filter);
+    }
+
+    tree->filter = filter;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to rebuild the bloom filter of a red-black tree from its
+ * elements now, so the removed elements stop passing the filter.
+ * 
+ * @param tree an allocated red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_rebuild_bloom_filter(rbk_tree_t * const __restrict__ tree) {
+    /* Check if tree is allocated */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    /* Check if tree uses a bloom filter */
+    if (NULL == tree->filter) {
+        return SCL_NULL_BLOOM_FILTER;
+    }
+
+    return rbk_use_bloom_filter(tree, tree->filter_hash, tree->filter->bits_per_key);
+}
+
+/**
+ * @brief Function to compare two elements of a red-black tree
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data1 pointer to the first element
+ * @param data2 pointer to the second element
+ * @return int32_t positive if data1 is greater than data2, negative
+ * if data1 is less than data2, 0 if they are equal
+ */
+static inline int32_t rbk_compare(const rbk_tree_t * const __restrict__ tree, const void * const data1, const void * const data2) {
+    SCL_STATS_ADD(tree, comparisons, 1);
+
+    return scl_key_compare(tree->key_kind, tree->cmp, tree->data_size, data1, data2);
+}
+
+/**
+ * @brief Function to search one element in a red-black tree with a constant
+ * kind, so that the compare of the elements is inlined in the loop.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to the searched element
+ * @param kind kind of the elements of the tree
+ * @param parent pointer to store the last visited node (`nil` for an empty tree)
+ * @param side pointer to store the compare of the last visited node with data
+ * @return rbk_tree_node_t* node containing data or `nil` if not found
+ */
+static SCL_ALWAYS_INLINE rbk_tree_node_t* rbk_search_kind(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data, scl_key_kind_t kind, rbk_tree_node_t ** const __restrict__ parent, int32_t * const __restrict__ side) {
+    rbk_tree_node_t *iterator = tree->root;
+    int32_t cmp = 0;
+
+    *parent = tree->nil;
+
+    while (tree->nil != iterator) {
+        cmp = scl_key_compare(kind, tree->cmp, tree->data_size, iterator->data, data);
+        SCL_STATS_ADD(tree, comparisons, 1);
+
+        if (0 == cmp) {
+            break;
+        }
+
+        *parent = iterator;
+        iterator = (cmp > 0) ? iterator->left : iterator->right;
+    }
+
+    *side = cmp;
+
+    return iterator;
+}
+
+/* Searches with a constant kind of the elements */
+#define RBK_SEARCH_KIND(kind) return rbk_search_kind(tree, data, (kind), parent, side)
+
+/**
+ * @brief Function to search one element in a red-black tree, the
+ * kind of the elements is dispatched once for the whole search.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to the searched element
+ * @param parent pointer to store the last visited node (`nil` for an empty tree)
+ * @param side pointer to store the compare of the last visited node with data
+ * @return rbk_tree_node_t* node containing data or `nil` if not found
+ */
+static rbk_tree_node_t* rbk_search(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data, rbk_tree_node_t ** const __restrict__ parent, int32_t * const __restrict__ side) {
+    SCL_KEY_KIND_DISPATCH(tree->key_kind, RBK_SEARCH_KIND)
+}
+
+#undef RBK_SEARCH_KIND
+
 /**
  * @brief Function to rotate to left a subtree starting 
  * from fix_node red-black tree node object. Function may fail
@@ -235,6 +599,8 @@ static void rbk_rotate_left(rbk_tree_t * const __restrict__ tree, rbk_tree_node_
         return;
     }
 
+    SCL_STATS_ADD(tree, rotations, 1);
+
     /* Set new rotated sub-root */
     rbk_tree_node_t * const rotate_node = fix_node->right;
 
@@ -257,14 +623,20 @@ static void rbk_rotate_left(rbk_tree_t * const __restrict__ tree, rbk_tree_node_
 
     /* Update new sub-root links to the rest of tree */
     if (tree->nil != rotate_node->parent) {
-        if (tree->cmp(rotate_node->data, rotate_node->parent->data) >= 1) {
-            rotate_node->parent->right = rotate_node;
-        } else {
+        if (rotate_node->parent->left == fix_node) {
             rotate_node->parent->left = rotate_node;
+        } else {
+            rotate_node->parent->right = rotate_node;
         }
     } else {
         tree->root = rotate_node;
     }
+
+    /* The new sub-root takes the weight of the subtree, fix_node loses a child subtree */
+    if (0 != tree->order_stats) {
+        rotate_node->weight = fix_node->weight;
+        fix_node->weight = fix_node->left->weight + fix_node->right->weight + fix_node->count;
+    }
 }
 
 /**
@@ -287,6 +659,8 @@ static void rbk_rotate_right(rbk_tree_t * const __restrict__ tree, rbk_tree_node
         return;
     }
 
+    SCL_STATS_ADD(tree, rotations, 1);
+
     /* Set new rotated sub-root */
     rbk_tree_node_t * const rotate_node = fix_node->left;
 
@@ -309,14 +683,20 @@ static void rbk_rotate_right(rbk_tree_t * const __restrict__ tree, rbk_tree_node
 
     /* Update new sub-root links to the rest of tree */
     if (tree->nil != rotate_node->parent) {
-        if (tree->cmp(rotate_node->data, rotate_node->parent->data) >= 1) {
-            rotate_node->parent->right = rotate_node;
-        } else {
+        if (rotate_node->parent->left == fix_node) {
             rotate_node->parent->left = rotate_node;
+        } else {
+            rotate_node->parent->right = rotate_node;
         }
     } else {
         tree->root = rotate_node;
     }
+
+    /* The new sub-root takes the weight of the subtree, fix_node loses a child subtree */
+    if (0 != tree->order_stats) {
+        rotate_node->weight = fix_node->weight;
+        fix_node->weight = fix_node->left->weight + fix_node->right->weight + fix_node->count;
+    }
 }
 
 /**
@@ -459,27 +839,27 @@ scl_error_t rbk_insert(rbk_tree_t * const __restrict__ tree, const void * __rest
         return SCL_INVALID_DATA;
     }
 
-    /* Set iterator pointers */
-    rbk_tree_node_t *iterator = tree->root;
+    /* Find a valid position for insertion */
     rbk_tree_node_t *parent_iterator = tree->nil;
+    int32_t side = 0;
+    rbk_tree_node_t *iterator = rbk_search(tree, data, &parent_iterator, &side);
 
-    /* Find a valid position for insertion */
-    while (tree->nil != iterator) {
-        parent_iterator = iterator;
+    if (tree->nil != iterator) {
 
-        if (tree->cmp(iterator->data, data) >= 1) {
-            iterator = iterator->left;
-        } else if (tree->cmp(iterator->data, data) <= -1) {
-            iterator = iterator->right;
-        } else {
+        /*
+         * Node already exists in current red-black tree
+         * increment count value of node
+         */
+        ++(iterator->count);
 
-            /*
-             * Node already exists in current red-black tree
-             * increment count value of node
-             */
-            ++(iterator->count);
-            return 0;
+        /* The node and its ancestors hold one more element */
+        if (0 != tree->order_stats) {
+            for (rbk_tree_node_t *weight_iterator = iterator; tree->nil != weight_iterator; weight_iterator = weight_iterator->parent) {
+                ++(weight_iterator->weight);
+            }
         }
+
+        return 0;
     }
 
     /* Create a new red-black node object */
@@ -498,12 +878,19 @@ scl_error_t rbk_insert(rbk_tree_t * const __restrict__ tree, const void * __rest
         new_node->parent = parent_iterator;
 
         /* Update children links */
-        if (tree->cmp(parent_iterator->data, new_node->data) >= 1) {
+        if (side > 0) {
             parent_iterator->left = new_node;
         } else {
             parent_iterator->right = new_node;
         }
 
+        /* Every ancestor of the node holds one more element */
+        if (0 != tree->order_stats) {
+            for (rbk_tree_node_t *weight_iterator = parent_iterator; tree->nil != weight_iterator; weight_iterator = weight_iterator->parent) {
+                ++(weight_iterator->weight);
+            }
+        }
+
         /* Fix the red black tree*/
         err = rbk_insert_fix_node_up(tree, new_node);
     } else {
@@ -516,47 +903,193 @@ scl_error_t rbk_insert(rbk_tree_t * const __restrict__ tree, const void * __rest
     /* Increase red-black tree size */
     ++(tree->size);
 
+    /* Searches of the new element must pass the filter */
+    if (NULL != tree->filter) {
+        bloom_filter_add_hash(tree->filter, tree->filter_hash(new_node->data));
+        rbk_refresh_bloom_filter(tree);
+    }
+
     /* Insertion in red-black went successfully */
     return err;
 }
 
 /**
- * @brief Function to search node in red-black tree O(log N).
- * Function will start searching from red-black tree root and will
- * search the data value in all tree.
+ * @brief Function to link a chain of red-black tree nodes, kept in order
+ * through their right links, into a perfectly balanced subtree. The first half
+ * of the nodes goes into the left subtree, the next node becomes the root and
+ * the rest of the nodes go into the right subtree.
  * 
  * @param tree an allocated red-black tree object
- * @param data pointer to an address of a generic data type
- * @return rbk_tree_node_t* red-black tree node object containing
- * data value or `nil` in case no such node exists
+ * @param chain pointer to the first node of the chain, moved after the used nodes
+ * @param number_of_nodes number of nodes of the subtree
+ * @param depth depth of the root of the subtree
+ * @param red_depth depth of the nodes colored in red
+ * @return rbk_tree_node_t* the root of the subtree or `nil`
  */
-static rbk_tree_node_t* rbk_find_node(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
-    /* Check if input data is valid */
-    if ((NULL == tree) || (tree->nil == tree->root)) {
+static rbk_tree_node_t* rbk_build_sorted_helper(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t ** const __restrict__ chain, size_t number_of_nodes, size_t depth, size_t red_depth) {
+    /* Empty subtree */
+    if (0 == number_of_nodes) {
         return tree->nil;
     }
 
-    /* Set iterator pointer */
-    rbk_tree_node_t *iterator = tree->root;
+    rbk_tree_node_t *left_node = rbk_build_sorted_helper(tree, chain, number_of_nodes / 2, depth + 1, red_depth);
 
-    /* Search for imput data (void *data) in all tree */
-    while (tree->nil != iterator) {
-        if (tree->cmp(iterator->data, data) <= -1) {
-            iterator = iterator->right;
-        } else if (tree->cmp(iterator->data, data) >= 1) {
-            iterator = iterator->left;
-        } else {
-            return iterator;
-        }
+    /* The next node of the chain is the root of the subtree */
+    rbk_tree_node_t *root = *chain;
+    *chain = root->right;
+
+    rbk_tree_node_t *right_node = rbk_build_sorted_helper(tree, chain, number_of_nodes - number_of_nodes / 2 - 1, depth + 1, red_depth);
+
+    /* Update the links of the root */
+    root->left = left_node;
+    root->right = right_node;
+    root->parent = tree->nil;
+
+    if (tree->nil != left_node) {
+        left_node->parent = root;
     }
 
-    /* Data was not found */
-    return tree->nil;
+    if (tree->nil != right_node) {
+        right_node->parent = root;
+    }
+
+    /* Every path from the root has the same number of black nodes */
+    root->color = ((0 != depth) && (red_depth == depth)) ? RED : BLACK;
+    root->weight = left_node->weight + right_node->weight + root->count;
+
+    return root;
 }
 
 /**
- * @brief Function to search data in red-black tree O(log N).
- * Function will start searching from red-black tree root and will
+ * @brief Function to build a red-black tree from an array sorted in ascending
+ * order (according to the compare function) in O(N) time, instead of N
+ * insertions. The nodes are allocated in one pass and linked into a perfectly
+ * balanced tree, the nodes from the deepest level are colored in red and all
+ * the others in black. Equal neighbour elements are merged into one node, as
+ * rbk_insert does. The tree must be empty.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param arr pointer to the first element of the sorted array
+ * @param number_of_elem number of elements of the array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_build_sorted(rbk_tree_t * const __restrict__ tree, const void * __restrict__ arr, size_t number_of_elem) {
+    /* Check if input is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (((NULL == arr) && (0 != number_of_elem)) || (0 != tree->size)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const uint8_t * const data = arr;
+    size_t number_of_nodes = 0;
+
+    /* Check the order of the array and count the distinct elements */
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        int32_t cmp = (0 == iter) ? -1 : rbk_compare(tree, data + (iter - 1) * tree->data_size, data + iter * tree->data_size);
+
+        if (cmp >= 1) {
+            return SCL_INVALID_INPUT;
+        }
+
+        if (cmp <= -1) {
+            ++number_of_nodes;
+        }
+    }
+
+    /* All the nodes are taken from one chunk of the node pool */
+    if ((NULL != tree->node_pool) && (SCL_OK != mem_pool_reserve(tree->node_pool, number_of_nodes))) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    /* Create the nodes in order, chained through their right links */
+    rbk_tree_node_t *chain = tree->nil;
+    rbk_tree_node_t *last_node = tree->nil;
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        if ((tree->nil != last_node) && (0 == rbk_compare(tree, last_node->data, data + iter * tree->data_size))) {
+            ++(last_node->count);
+            continue;
+        }
+
+        rbk_tree_node_t *new_node = create_rbk_node(tree, data + iter * tree->data_size);
+
+        if (tree->nil == new_node) {
+
+            /* Free the created nodes, their data belongs to the array */
+            while (tree->nil != chain) {
+                rbk_tree_node_t *next_node = chain->right;
+
+                if (NULL != tree->node_pool) {
+                    mem_pool_free(tree->node_pool, chain);
+                } else {
+                    scl_free(tree->allocator, chain);
+                }
+
+                chain = next_node;
+            }
+
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        if (tree->nil == last_node) {
+            chain = new_node;
+        } else {
+            last_node->right = new_node;
+        }
+
+        last_node = new_node;
+    }
+
+    /* The nodes from the deepest level are red (except the root), all the others are black */
+    size_t red_depth = 0;
+
+    while ((number_of_nodes >> (red_depth + 1)) != 0) {
+        ++red_depth;
+    }
+
+    /* Link the nodes into a perfectly balanced tree */
+    tree->root = rbk_build_sorted_helper(tree, &chain, number_of_nodes, 0, red_depth);
+    tree->size = number_of_nodes;
+
+    /* The built elements must pass the filter */
+    if (NULL != tree->filter) {
+        rbk_fill_bloom_filter(tree, tree->root, tree->filter);
+        rbk_refresh_bloom_filter(tree);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search node in red-black tree O(log N).
+ * Function will start searching from red-black tree root and will
+ * search the data value in all tree.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to an address of a generic data type
+ * @return rbk_tree_node_t* red-black tree node object containing
+ * data value or `nil` in case no such node exists
+ */
+static rbk_tree_node_t* rbk_find_node(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (tree->nil == tree->root)) {
+        return tree->nil;
+    }
+
+    /* Search for imput data (void *data) in all tree */
+    rbk_tree_node_t *parent = tree->nil;
+    int32_t side = 0;
+
+    return rbk_search(tree, data, &parent, &side);
+}
+
+/**
+ * @brief Function to search data in red-black tree O(log N).
+ * Function will start searching from red-black tree root and will
  * search the data value in all tree.
  * 
  * @param tree an allocated red-black tree object
@@ -570,10 +1103,173 @@ const void* rbk_find_data(const rbk_tree_t * const __restrict__ tree, const void
         return NULL;
     }
 
+    /* An element rejected by the filter is surely missing */
+    if ((NULL != tree->filter) && (0 == bloom_filter_may_contain_hash(tree->filter, tree->filter_hash(data)))) {
+        return NULL;
+    }
+
     /* Get the nide data or `NULL` if node is `nil` */
     return rbk_find_node(tree, data)->data;
 }
 
+/* Number of elements searched together by rbk_find_batch */
+#define RBK_BATCH_KEYS 16
+
+/**
+ * @brief Function to search a group of elements with a constant kind,
+ * all the searches of the group go down one level per round and the next
+ * node of every search is prefetched, so their cache misses overlap.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data array of group_keys elements to search
+ * @param group_keys number of elements of the group (at most RBK_BATCH_KEYS)
+ * @param results array of group_keys pointers to the data found or `NULL`
+ * @param kind kind of the elements of the tree
+ */
+static SCL_ALWAYS_INLINE void rbk_find_group_kind(const rbk_tree_t * const __restrict__ tree, const uint8_t * const __restrict__ data, size_t group_keys, const void ** const __restrict__ results, scl_key_kind_t kind) {
+    rbk_tree_node_t *iterators[RBK_BATCH_KEYS];
+
+    for (size_t iter = 0; iter < group_keys; ++iter) {
+        iterators[iter] = tree->root;
+
+        /* An element rejected by the filter is surely missing */
+        if ((NULL != tree->filter) && (0 == bloom_filter_may_contain_hash(tree->filter, tree->filter_hash(data + iter * tree->data_size)))) {
+            iterators[iter] = tree->nil;
+        }
+    }
+
+    /* `NULL` marks a finished search */
+    size_t pending_keys = group_keys;
+
+    while (pending_keys > 0) {
+        pending_keys = 0;
+
+        for (size_t iter = 0; iter < group_keys; ++iter) {
+            rbk_tree_node_t *iterator = iterators[iter];
+
+            if (NULL == iterator) {
+                continue;
+            }
+
+            /* Data was not found */
+            if (tree->nil == iterator) {
+                results[iter] = NULL;
+                iterators[iter] = NULL;
+                continue;
+            }
+
+            int32_t cmp = scl_key_compare(kind, tree->cmp, tree->data_size, iterator->data, data + iter * tree->data_size);
+            SCL_STATS_ADD(tree, comparisons, 1);
+
+            if (0 == cmp) {
+                results[iter] = iterator->data;
+                iterators[iter] = NULL;
+                continue;
+            }
+
+            iterator = (cmp > 0) ? iterator->left : iterator->right;
+
+            SCL_PREFETCH(iterator);
+
+            iterators[iter] = iterator;
+            ++pending_keys;
+        }
+    }
+}
+
+/* Searches a group with a constant kind of the elements */
+#define RBK_FIND_GROUP_KIND(kind) rbk_find_group_kind(tree, group_data, group_keys, results + group, (kind))
+
+/**
+ * @brief Function to search many elements in a red-black tree at once.
+ * The elements are searched in groups of RBK_BATCH_KEYS that walk the tree
+ * together, one level per round, prefetching the next node of every search,
+ * so the cache misses of a group overlap instead of adding up. The results
+ * are the same as calling **rbk_find_data** for every element.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data array of count elements to search, every one has data_size bytes
+ * @param count number of elements to search
+ * @param results array of count pointers, filled with the data of every node
+ * found or `NULL` if the element is not in the tree
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_find_batch(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data, size_t count, const void ** const __restrict__ results) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if ((NULL == data) || (NULL == results)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const uint8_t * const typed_data = data;
+
+    for (size_t group = 0; group < count; group += RBK_BATCH_KEYS) {
+        const size_t group_keys = (count - group < RBK_BATCH_KEYS) ? (count - group) : RBK_BATCH_KEYS;
+        const uint8_t * const group_data = typed_data + group * tree->data_size;
+
+        SCL_KEY_KIND_DISPATCH(tree->key_kind, RBK_FIND_GROUP_KIND)
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+#undef RBK_FIND_GROUP_KIND
+
+/**
+ * @brief Function to search the node of a red-black tree whose data matches
+ * a key O(log N). key_cmp(key, data) must order the keys exactly like the
+ * compare function of the tree orders the data, so only the key has to be
+ * built for the search.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param key pointer to the key to search for
+ * @param key_cmp function to compare a key with the data of a node
+ * @return rbk_tree_node_t* the node matching the key or `nil` if no such node exists
+ */
+static rbk_tree_node_t* rbk_find_key_node(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    rbk_tree_node_t *iterator = tree->root;
+
+    /* Search for the key in all tree */
+    while (tree->nil != iterator) {
+        int32_t cmp = key_cmp(key, iterator->data);
+        SCL_STATS_ADD(tree, comparisons, 1);
+
+        if (cmp < 0) {
+            iterator = iterator->left;
+        } else if (cmp > 0) {
+            iterator = iterator->right;
+        } else {
+            return iterator;
+        }
+    }
+
+    /* Key was not found */
+    return tree->nil;
+}
+
+/**
+ * @brief Function to search data in a red-black tree by a key O(log N),
+ * without building a whole data object to compare against.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param key pointer to the key to search for
+ * @param key_cmp function to compare a key with the data of a node,
+ * negative if key is before the data, zero if it matches and positive if it is after
+ * @return const void* the data matching the key or `NULL` if it is not found
+ */
+const void* rbk_find_key(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == key) || (NULL == key_cmp)) {
+        return NULL;
+    }
+
+    return rbk_find_key_node(tree, key, key_cmp)->data;
+}
+
 /**
  * @brief Function to swap two nodes from a red black tree.
  * This function is a subroutine of the delete function to 
@@ -594,6 +1290,11 @@ static scl_error_t rbk_swap_nodes(rbk_tree_t * const __restrict__ tree, rbk_tree
     dest_node->color = src_node->color;
     src_node->color = temp_color;
 
+    /* The weights belong to the positions of the nodes */
+    size_t temp_weight = dest_node->weight;
+    dest_node->weight = src_node->weight;
+    src_node->weight = temp_weight;
+
     /* Interchange the right child */
 
     rbk_tree_node_t *temp = dest_node->right;
@@ -748,6 +1449,88 @@ size_t get_rbk_size(const rbk_tree_t * const __restrict__ tree) {
     return tree->size;
 }
 
+/**
+ * @brief Function to get the memory footprint of a red-black tree. Every node
+ * holds one element inline, so the node bytes are the per node overhead
+ * (links, counters and padding) and the payload is size * data_size.
+ * With a node pool the chunk headers are counted as node bytes and the
+ * free objects of the pool as slack.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_memory_usage(const rbk_tree_t * const __restrict__ tree, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* The tree object and its `nil` node */
+    usage->object_bytes = sizeof(*tree) + sizeof(*tree->nil);
+    usage->payload_bytes = tree->size * tree->data_size;
+    usage->array_bytes = 0;
+    usage->nodes = tree->size;
+
+    if (NULL != tree->node_pool) {
+        scl_memory_usage_t pool_usage;
+        mem_pool_memory_usage(tree->node_pool, &pool_usage);
+
+        /* Every node fills one object of the pool, the rest of the object is overhead */
+        usage->object_bytes += pool_usage.object_bytes;
+        usage->node_bytes = pool_usage.node_bytes + pool_usage.payload_bytes - usage->payload_bytes;
+        usage->slack_bytes = pool_usage.slack_bytes;
+    } else {
+        usage->node_bytes = tree->size * SCL_ALIGN_SIZE(sizeof(*tree->nil));
+        usage->slack_bytes = 0;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the operation counters of a red-black tree, comparisons, node allocations and rotations.
+ * The counters are kept only when the library is built with SCL_STATS.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param stats pointer to the counters to fill (set to zero without SCL_STATS)
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t rbk_get_stats(const rbk_tree_t * const __restrict__ tree, scl_stats_t * const __restrict__ stats) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    return SCL_STATS_GET(tree, stats);
+}
+
+/**
+ * @brief Function to set the operation counters of a red-black tree to zero.
+ * 
+ * @param tree an allocated red-black tree object
+ * @return scl_error_t enum object for handling errors (SCL_STATS_DISABLED
+ * if the library is built without SCL_STATS)
+ */
+scl_error_t rbk_reset_stats(rbk_tree_t * const __restrict__ tree) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    return SCL_STATS_RESET(tree);
+}
+
 /**
  * @brief Function to get node with maximum data value.
  * Function will search the maximum considering root node
@@ -882,6 +1665,7 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
 
                 /* Propagate the double black problem in higher hierarchy */
                 fix_node = parent_fix_node;
+                parent_fix_node = fix_node->parent;
             } else {
                 if (BLACK == brother_node->right->color) {
 
@@ -942,6 +1726,7 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
 
                 /* Propagate the double black problem in higher hierarchy */
                 fix_node = parent_fix_node;
+                parent_fix_node = fix_node->parent;
             } else {
                 if (BLACK == brother_node->left->color) {
 
@@ -981,37 +1766,15 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
 }
 
 /**
- * @brief Function to delete one generic data from a red-black.
- * Function may fail if input data is not valid or if
- * changing the data fails. You can delete one data at a time
- * and MUST specify a valid red-black tree and a valid data pointer
+ * @brief Helper function to unlink and free a found node of a red-black tree
+ * and to rebalance the tree after it. Used by the delete by data and
+ * the delete by key functions.
  * 
  * @param tree an allocated red-black tree object
- * @param data pointer to an address of a generic data to be deleted
+ * @param delete_node the node to delete, not `nil`
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
-    /* Check if input data is valid */
-    if (NULL == tree) {
-        return SCL_NULL_RBK;
-    }
-
-    if (tree->nil == tree->root) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
-    }
-
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
-    }
-
-    /* Find node to delete */
-    rbk_tree_node_t *delete_node = rbk_find_node(tree, data);
-
-    /* Delete node is not in the current working tree */
-    if (tree->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
-
+static scl_error_t rbk_delete_node(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t *delete_node) {
     /* Node has two children swap with it's inorder successor and delete successor */
     if ((tree->nil != delete_node->left) && (tree->nil != delete_node->right)) {
 
@@ -1024,6 +1787,13 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
         if (SCL_OK != err) {
             return err;
         }
+
+        /* The nodes on the path between the two positions hold the elements of the other node */
+        if (0 != tree->order_stats) {
+            for (rbk_tree_node_t *weight_iterator = delete_node; delete_successor != weight_iterator; weight_iterator = weight_iterator->parent) {
+                weight_iterator->weight = weight_iterator->weight + delete_node->count - delete_successor->count;
+            }
+        }
     }
 
     /* Variable to check if fixing is needed */
@@ -1117,22 +1887,28 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
 
     rbk_tree_node_t *parent_delete_node = delete_node->parent;
 
+    /* Every ancestor of the node loses the elements of the node */
+    if (0 != tree->order_stats) {
+        for (rbk_tree_node_t *weight_iterator = parent_delete_node; tree->nil != weight_iterator; weight_iterator = weight_iterator->parent) {
+            weight_iterator->weight -= delete_node->count;
+        }
+    }
+
     /* Free content of the data pointer */
     if ((NULL != tree->frd) && (NULL != delete_node->data)) {
         tree->frd(delete_node->data);
     }
 
-    /* Free data pointer of selected node */
-    if (NULL != delete_node->data) {
-        free(delete_node->data);
-    }
-
     /* Set data pointer as `NULL` */
     delete_node->data = NULL;
 
     /* Free selected red-black node pointer */
     if (tree->nil != delete_node) {
-        free(delete_node);
+        if (NULL != tree->node_pool) {
+            mem_pool_free(tree->node_pool, delete_node);
+        } else {
+            scl_free(tree->allocator, delete_node);
+        }
     }
 
     /* Set selected red-black node as `NULL` */
@@ -1141,31 +1917,105 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
     /* Deacrease tree size  */
     --(tree->size);
 
+    scl_error_t err = SCL_OK;
+
     /* Check if fixing is needed */
     if ((0 != need_fixing_tree) && (tree->nil != parent_delete_node)) {
-        return rbk_delete_fix_node_up(tree, delete_node_child, parent_delete_node);
+        err = rbk_delete_fix_node_up(tree, delete_node_child, parent_delete_node);
     }
 
-    /* Deletion went successfully */
-    return SCL_OK;
+    /* Rebuild the filter once half of its elements are removed */
+    rbk_refresh_bloom_filter(tree);
+
+    /* Deletion went successfully, or not */
+    return err;
 }
 
 /**
- * @brief Function to search the inorder predecessor for
- * a specified data type value. Function may fail if
- * red-black tree is not allocated, if it is empty or if data
- * type pointer is not valid. Also function may fail if
- * the red-black tree does not contain specified data pointer
+ * @brief Function to delete one generic data from a red-black.
+ * Function may fail if input data is not valid or if
+ * changing the data fails. You can delete one data at a time
+ * and MUST specify a valid red-black tree and a valid data pointer
  * 
  * @param tree an allocated red-black tree object
- * @param data pointer to an address of a generic data type
- * @return rbk_tree_node_t* `nil` or inorder predecessor of the
- * node containing (void *data) value.
+ * @param data pointer to an address of a generic data to be deleted
+ * @return scl_error_t enum object for handling errors
  */
-static rbk_tree_node_t* rbk_predecessor_node(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
     /* Check if input data is valid */
-    if ((NULL == tree) || (tree->nil == tree->root) || (NULL == data)) {
-        return tree->nil;
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Find node to delete */
+    rbk_tree_node_t *delete_node = rbk_find_node(tree, data);
+
+    /* Delete node is not in the current working tree */
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return rbk_delete_node(tree, delete_node);
+}
+
+/**
+ * @brief Function to delete the data of a red-black tree that matches a key,
+ * without building a whole data object to compare against. Function may
+ * fail if the tree is empty or if no data matches the key.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param key pointer to the key of the data to be deleted
+ * @param key_cmp function to compare a key with the data of a node,
+ * negative if key is before the data, zero if it matches and positive if it is after
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_delete_key(rbk_tree_t * const __restrict__ tree, const void * const __restrict__ key, key_compare_func key_cmp) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if ((NULL == key) || (NULL == key_cmp)) {
+        return SCL_INVALID_DATA;
+    }
+
+    rbk_tree_node_t *delete_node = rbk_find_key_node(tree, key, key_cmp);
+
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return rbk_delete_node(tree, delete_node);
+}
+
+/**
+ * @brief Function to search the inorder predecessor for
+ * a specified data type value. Function may fail if
+ * red-black tree is not allocated, if it is empty or if data
+ * type pointer is not valid. Also function may fail if
+ * the red-black tree does not contain specified data pointer
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to an address of a generic data type
+ * @return rbk_tree_node_t* `nil` or inorder predecessor of the
+ * node containing (void *data) value.
+ */
+static rbk_tree_node_t* rbk_predecessor_node(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (tree->nil == tree->root) || (NULL == data)) {
+        return tree->nil;
     }
 
     /* Find node containing the data value */
@@ -1318,9 +2168,9 @@ static rbk_tree_node_t* rbk_lowest_common_ancestor_node(const rbk_tree_t * const
 
     /* Find the lowest common ancestor */
     while (tree->nil != iterator) {
-        if ((tree->cmp(iterator->data, data1) >= 1) && (tree->cmp(iterator->data, data2) >= 1)) {
+        if ((rbk_compare(tree, iterator->data, data1) >= 1) && (rbk_compare(tree, iterator->data, data2) >= 1)) {
             iterator = iterator->left;
-        } else if ((tree->cmp(iterator->data, data1) <= -1) && (tree->cmp(iterator->data, data2) <= -1)) {
+        } else if ((rbk_compare(tree, iterator->data, data1) <= -1) && (rbk_compare(tree, iterator->data, data2) <= -1)) {
             iterator = iterator->right;
         } else {
 
@@ -1359,27 +2209,49 @@ const void* rbk_lowest_common_ancestor_data(const rbk_tree_t * const __restrict_
 
 /**
  * @brief Helper function for rbk_traverse_inorder function.
- * This method will recursively iterate through all nodes by
- * Left-Root-Right principle.
+ * This method will iterate through all nodes by Left-Root-Right
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated red-black tree object
  * @param root starting point of the red-black tree traversal
  * @param action a pointer function to perform an action on one red-black node object
  */
 static void rbk_traverse_inorder_helper(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working red-black node is not `nil` */
+    /* Check if current working node is not `nil` */
     if (tree->nil == root) {
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    rbk_traverse_inorder_helper(tree, root->left, action);
-    
-    /* Call action function */
-    action(root->data);
+    const rbk_tree_node_t *iterator = root;
+
+    while (tree->nil != iterator->left) {
+        iterator = iterator->left;
+    }
+
+    while (tree->nil != iterator) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (tree->nil != iterator->right) {
+
+            /* The next node is the leftmost node of the right sub-tree */
+            iterator = iterator->right;
+
+            while (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            }
+        } else {
+
+            /* The next node is the first ancestor reached from its left sub-tree */
+            while ((root != iterator) && (iterator->parent->right == iterator)) {
+                iterator = iterator->parent;
+            }
 
-    /* Traverse in the right sub-tree */
-    rbk_traverse_inorder_helper(tree, root->right, action);
+            iterator = (root == iterator) ? tree->nil : iterator->parent;
+        }
+    }
 }
 
 /**
@@ -1421,27 +2293,36 @@ scl_error_t rbk_traverse_inorder(const rbk_tree_t * const __restrict__ tree, act
 
 /**
  * @brief Helper function for rbk_traverse_preorder function.
- * This method will recursively iterate through all nodes by
- * Root-Left-Right principle.
+ * This method will iterate through all nodes by Root-Left-Right
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated red-black tree object
  * @param root starting point of the red-black tree traversal
  * @param action a pointer function to perform an action on one red-black node object
  */
 static void rbk_traverse_preorder_helper(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working red-black node is not `nil` */
-    if (tree->nil == root) {
-        return;
-    }
+    const rbk_tree_node_t *iterator = root;
+
+    while (tree->nil != iterator) {
+
+        /* Call action function */
+        action(iterator->data);
 
-    /* Call action function */
-    action(root->data);
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
 
-    /* Traverse in the left sub-tree */
-    rbk_traverse_preorder_helper(tree, root->left, action);
+            /* Climb to the first ancestor with a right sub-tree not visited yet */
+            while ((root != iterator) && ((iterator->parent->right == iterator) || (tree->nil == iterator->parent->right))) {
+                iterator = iterator->parent;
+            }
 
-    /* Traverse in the right sub-tree */
-    rbk_traverse_preorder_helper(tree, root->right, action);
+            iterator = (root == iterator) ? tree->nil : iterator->parent->right;
+        }
+    }
 }
 
 /**
@@ -1480,29 +2361,62 @@ scl_error_t rbk_traverse_preorder(const rbk_tree_t * const __restrict__ tree, ac
     return SCL_OK;
 }
 
+/**
+ * @brief Helper function to find the first node of a subtree in
+ * postorder (the deepest node reached by going left whenever possible).
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root root of a subtree
+ * @return const rbk_tree_node_t* the first node of the subtree in postorder
+ */
+static const rbk_tree_node_t* rbk_traverse_postorder_first(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t *root) {
+    while (1) {
+        if (tree->nil != root->left) {
+            root = root->left;
+        } else if (tree->nil != root->right) {
+            root = root->right;
+        } else {
+            return root;
+        }
+    }
+}
+
 /**
  * @brief Helper function for rbk_traverse_postorder function.
- * This method will recursively iterate through all nodes by
- * Left-Right-Root principle.
+ * This method will iterate through all nodes by Left-Right-Root
+ * principle without recursion, it climbs through the parent links
+ * and never above the starting node.
  * 
  * @param tree an allocated red-black tree object
  * @param root starting point of the red-black tree traversal
  * @param action a pointer function to perform an action on one red-black node object
  */
 static void rbk_traverse_postorder_helper(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, action_func action) {
-    /* Check if current working red-black node is not `nil` */
+    /* Check if current working node is not `nil` */
     if (tree->nil == root) {
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    rbk_traverse_postorder_helper(tree, root->left, action);
+    const rbk_tree_node_t *iterator = rbk_traverse_postorder_first(tree, root);
+
+    while (1) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (root == iterator) {
+            break;
+        }
 
-    /* Traverse in the right sub-tree */
-    rbk_traverse_postorder_helper(tree, root->right, action);
+        /* After a left child comes the right sub-tree of the parent, then the parent */
+        const rbk_tree_node_t *parent = iterator->parent;
 
-    /* Call action function */
-    action(root->data);
+        if ((parent->left == iterator) && (tree->nil != parent->right)) {
+            iterator = rbk_traverse_postorder_first(tree, parent->right);
+        } else {
+            iterator = parent;
+        }
+    }
 }
 
 /**
@@ -1576,6 +2490,9 @@ scl_error_t rbk_traverse_level(const rbk_tree_t * const __restrict__ tree, actio
         /* Check if queue was created successfully */
         if (NULL != level_queue) {
 
+            /* Nodes go through a ring buffer, if it cannot be allocated the queue stays linked */
+            queue_use_ring(level_queue, 0);
+
             scl_error_t err = SCL_OK;
 
             /* Push pointer to root node into qeuue */
@@ -1627,3 +2544,1296 @@ scl_error_t rbk_traverse_level(const rbk_tree_t * const __restrict__ tree, actio
 
     return SCL_NULL_QUEUE;
 }
+
+/**
+ * @brief Helper function to find the first node of a red-black tree that is
+ * not smaller than data (strict is 0) or that is greater than data (strict is 1).
+ * Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to the data to search for
+ * @param strict 1 to skip the node equal to data, 0 otherwise
+ * @return rbk_tree_node_t* the found node or `nil` if no node is
+ * after data
+ */
+static rbk_tree_node_t* rbk_bound_node(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data, uint8_t strict) {
+    rbk_tree_node_t *iterator = tree->root;
+    rbk_tree_node_t *bound = tree->nil;
+
+    /* Remember the last node after data on the search path */
+    while (tree->nil != iterator) {
+        int32_t cmp = rbk_compare(tree, iterator->data, data);
+
+        if ((cmp > 0) || ((0 == cmp) && (0 == strict))) {
+            bound = iterator;
+
+            if (0 == cmp) {
+                break;
+            }
+
+            iterator = iterator->left;
+        } else {
+            iterator = iterator->right;
+        }
+    }
+
+    return bound;
+}
+
+/**
+ * @brief Function to place a cursor on the smallest element of a red-black tree.
+ * The elements of the tree can be visited in ascending order without a callback:
+ * for (d = rbk_iter_begin(tree, &iter); NULL != d; d = rbk_iter_next(&iter)).
+ * 
+ * @param tree an allocated red-black tree object
+ * @param iter pointer to the cursor to place
+ * @return const void* the smallest element or `NULL` if the tree is empty
+ */
+const void* rbk_iter_begin(const rbk_tree_t * const __restrict__ tree, rbk_tree_iter_t * const __restrict__ iter) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if (NULL == tree) {
+        return NULL;
+    }
+
+    iter->node = rbk_min_node(tree, tree->root);
+
+    return rbk_iter_data(iter);
+}
+
+/**
+ * @brief Function to place a cursor on the greatest element of a
+ * red-black tree, in order to visit the elements in descending order with rbk_iter_prev.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param iter pointer to the cursor to place
+ * @return const void* the greatest element or `NULL` if the tree is empty
+ */
+const void* rbk_iter_rbegin(const rbk_tree_t * const __restrict__ tree, rbk_tree_iter_t * const __restrict__ iter) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if (NULL == tree) {
+        return NULL;
+    }
+
+    iter->node = rbk_max_node(tree, tree->root);
+
+    return rbk_iter_data(iter);
+}
+
+/**
+ * @brief Function to place a cursor on the first element of a red-black tree
+ * that is not smaller than data (the lower bound of data). Takes O(logN) time
+ * for a balanced tree.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param iter pointer to the cursor to place
+ * @param data pointer to the data to search for
+ * @return const void* the first element not smaller than data or `NULL`
+ * if all the elements are smaller
+ */
+const void* rbk_iter_seek(const rbk_tree_t * const __restrict__ tree, rbk_tree_iter_t * const __restrict__ iter, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if (NULL == iter) {
+        return NULL;
+    }
+
+    iter->tree = tree;
+    iter->node = NULL;
+
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    iter->node = rbk_bound_node(tree, data, 0);
+
+    return rbk_iter_data(iter);
+}
+
+/**
+ * @brief Function to move a cursor to the next element in ascending
+ * order. Visiting all the elements takes O(N) time, O(1) amortized for
+ * one step. A cursor after the end of the tree stays there.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the next element or `NULL` if the cursor passed
+ * the greatest element
+ */
+const void* rbk_iter_next(rbk_tree_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is on a node */
+    if (NULL == rbk_iter_data(iter)) {
+        return NULL;
+    }
+
+    const rbk_tree_t * const tree = iter->tree;
+    rbk_tree_node_t *iterator = iter->node;
+
+    if (tree->nil != iterator->right) {
+
+        /* The next node is the smallest node of the right subtree */
+        iterator = rbk_min_node(tree, iterator->right);
+    } else {
+
+        /* Go up until the node is in a left subtree */
+        rbk_tree_node_t *parent_iterator = iterator->parent;
+
+        while ((tree->nil != parent_iterator) && (parent_iterator->right == iterator)) {
+            iterator = parent_iterator;
+            parent_iterator = parent_iterator->parent;
+        }
+
+        iterator = parent_iterator;
+    }
+
+    iter->node = iterator;
+
+    return rbk_iter_data(iter);
+}
+
+/**
+ * @brief Function to move a cursor to the previous element in ascending
+ * order. A cursor after the end of the tree stays there.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the previous element or `NULL` if the cursor passed
+ * the smallest element
+ */
+const void* rbk_iter_prev(rbk_tree_iter_t * const __restrict__ iter) {
+    /* Check if the cursor is on a node */
+    if (NULL == rbk_iter_data(iter)) {
+        return NULL;
+    }
+
+    const rbk_tree_t * const tree = iter->tree;
+    rbk_tree_node_t *iterator = iter->node;
+
+    if (tree->nil != iterator->left) {
+
+        /* The previous node is the greatest node of the left subtree */
+        iterator = rbk_max_node(tree, iterator->left);
+    } else {
+
+        /* Go up until the node is in a right subtree */
+        rbk_tree_node_t *parent_iterator = iterator->parent;
+
+        while ((tree->nil != parent_iterator) && (parent_iterator->left == iterator)) {
+            iterator = parent_iterator;
+            parent_iterator = parent_iterator->parent;
+        }
+
+        iterator = parent_iterator;
+    }
+
+    iter->node = iterator;
+
+    return rbk_iter_data(iter);
+}
+
+/**
+ * @brief Function to get the element under a cursor.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return const void* the element under the cursor or `NULL` if the
+ * cursor is after the end of the tree
+ */
+const void* rbk_iter_data(const rbk_tree_iter_t * const __restrict__ iter) {
+    if ((NULL == iter) || (NULL == iter->tree) || (NULL == iter->node) || (iter->tree->nil == iter->node)) {
+        return NULL;
+    }
+
+    return iter->node->data;
+}
+
+/**
+ * @brief Function to get how many equal elements were inserted into
+ * the node under a cursor.
+ * 
+ * @param iter pointer to a placed cursor
+ * @return uint32_t the count of the node or 0 if the cursor is after
+ * the end of the tree
+ */
+uint32_t rbk_iter_count(const rbk_tree_iter_t * const __restrict__ iter) {
+    if (NULL == rbk_iter_data(iter)) {
+        return 0;
+    }
+
+    return iter->node->count;
+}
+
+/**
+ * @brief Function to find the first element of a red-black tree that is not
+ * smaller than data. Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to the data to search for
+ * @return const void* the first element not smaller than data or `NULL`
+ * if all the elements are smaller
+ */
+const void* rbk_lower_bound(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    rbk_tree_node_t *bound = rbk_bound_node(tree, data, 0);
+
+    if (tree->nil == bound) {
+        return NULL;
+    }
+
+    return bound->data;
+}
+
+/**
+ * @brief Function to find the first element of a red-black tree that is
+ * greater than data. Takes O(logN) time for a balanced tree.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to the data to search for
+ * @return const void* the first element greater than data or `NULL`
+ * if no element is greater
+ */
+const void* rbk_upper_bound(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    rbk_tree_node_t *bound = rbk_bound_node(tree, data, 1);
+
+    if (tree->nil == bound) {
+        return NULL;
+    }
+
+    return bound->data;
+}
+
+/**
+ * @brief Function to call action on every element of a red-black tree from the
+ * half-open interval [lo, hi) in ascending order. The first element is found
+ * once and the others are reached through the parent links, so the
+ * scan takes O(logN + K) time for a balanced tree, where K is the
+ * number of visited elements.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param lo pointer to the lower bound of the interval (inclusive)
+ * @param hi pointer to the upper bound of the interval (exclusive)
+ * @param action a pointer to a function that will perform an action
+ * on every element of the interval
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_range(const rbk_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    rbk_tree_iter_t iter;
+
+    iter.tree = tree;
+    iter.node = rbk_bound_node(tree, lo, 0);
+
+    /* Stop at the end of the tree or at the first element not smaller than hi */
+    while ((tree->nil != iter.node) && (rbk_compare(tree, iter.node->data, hi) < 0)) {
+        action(iter.node->data);
+        rbk_iter_next(&iter);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the number of elements of a red-black tree,
+ * counting every equal element separately (get_rbk_size counts the nodes).
+ * The tree must keep the weights of its nodes (see rbk_use_order_stats).
+ * 
+ * @param tree an allocated red-black tree object
+ * @return size_t the number of elements or 0 if the tree does not keep the weights
+ */
+size_t rbk_total_count(const rbk_tree_t * const __restrict__ tree) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (0 == tree->order_stats)) {
+        return 0;
+    }
+
+    return tree->root->weight;
+}
+
+/**
+ * @brief Function to find the k-th smallest element of a red-black tree
+ * (counting from 0), an element inserted several times fills several
+ * positions. Takes O(logN) time, the tree must keep the weights of its
+ * nodes (see rbk_use_order_stats).
+ * 
+ * @param tree an allocated red-black tree object
+ * @param k position of the element in ascending order, counted from 0
+ * @return const void* the k-th smallest element or `NULL` if k is not less
+ * than the number of elements or the tree does not keep the weights
+ */
+const void* rbk_select(const rbk_tree_t * const __restrict__ tree, size_t k) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (0 == tree->order_stats)) {
+        return NULL;
+    }
+
+    rbk_tree_node_t *iterator = tree->root;
+
+    while (tree->nil != iterator) {
+        if (k < iterator->left->weight) {
+            iterator = iterator->left;
+        } else if (k < iterator->left->weight + iterator->count) {
+            return iterator->data;
+        } else {
+            k -= iterator->left->weight + iterator->count;
+            iterator = iterator->right;
+        }
+    }
+
+    /* Position is after the last element */
+    return NULL;
+}
+
+/**
+ * @brief Function to count the elements of a red-black tree that are smaller
+ * than data, which is the position of the first occurrence of data in
+ * ascending order. The data does not have to be in the tree. Takes O(logN)
+ * time, the tree must keep the weights of its nodes (see rbk_use_order_stats).
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to the data to rank
+ * @return size_t the number of smaller elements or `SIZE_MAX` if input is not
+ * valid or the tree does not keep the weights
+ */
+size_t rbk_rank(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input is valid */
+    if ((NULL == tree) || (NULL == data) || (0 == tree->order_stats)) {
+        return SIZE_MAX;
+    }
+
+    const rbk_tree_node_t *iterator = tree->root;
+    size_t rank = 0;
+
+    while (tree->nil != iterator) {
+        int32_t cmp = rbk_compare(tree, iterator->data, data);
+
+        if (cmp >= 1) {
+            iterator = iterator->left;
+        } else {
+
+            /* The left subtree is smaller, the node is smaller if it is not equal */
+            rank += iterator->left->weight;
+
+            if (0 == cmp) {
+                break;
+            }
+
+            rank += iterator->count;
+            iterator = iterator->right;
+        }
+    }
+
+    return rank;
+}
+
+/**
+ * @brief Helper function to move a detached subtree from the `nil` node
+ * of one tree to the `nil` node of another tree, the links of the leaves
+ * are changed by Root-Left-Right principle.
+ * 
+ * @param old_nil the `nil` node of the subtree
+ * @param new_nil the new `nil` node of the subtree
+ * @param root starting point of the subtree
+ */
+static void rbk_set_move_helper(const rbk_tree_node_t * const __restrict__ old_nil, rbk_tree_node_t * const __restrict__ new_nil, rbk_tree_node_t * const __restrict__ root) {
+    if (old_nil == root) {
+        return;
+    }
+
+    if (old_nil == root->left) {
+        root->left = new_nil;
+    } else {
+        rbk_set_move_helper(old_nil, new_nil, root->left);
+    }
+
+    if (old_nil == root->right) {
+        root->right = new_nil;
+    } else {
+        rbk_set_move_helper(old_nil, new_nil, root->right);
+    }
+}
+
+/**
+ * @brief Helper function to count the nodes of a subtree, the count
+ * stops at limit nodes, so it takes O(min(N, limit)) time.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root starting point of the subtree
+ * @param limit maximum number of nodes to count
+ * @return size_t the number of nodes of the subtree or limit
+ */
+static size_t rbk_set_count_helper(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, size_t limit) {
+    if ((tree->nil == root) || (0 == limit)) {
+        return 0;
+    }
+
+    size_t count = 1 + rbk_set_count_helper(tree, root->left, limit - 1);
+
+    if (count < limit) {
+        count += rbk_set_count_helper(tree, root->right, limit - count);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to free one detached node of a red-black tree and the content
+ * of its data, the size of the tree is decreased.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param free_node a detached red-black tree node object
+ */
+static void rbk_set_free_node(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const __restrict__ free_node) {
+    if ((NULL != tree->frd) && (NULL != free_node->data)) {
+        tree->frd(free_node->data);
+    }
+
+    free_node->data = NULL;
+    scl_free(tree->allocator, free_node);
+
+    --(tree->size);
+}
+
+/**
+ * @brief Function to free every node of a detached subtree
+ * by Left-Right-Root principle.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root starting point of the subtree
+ */
+static void rbk_set_free_subtree(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const __restrict__ root) {
+    if (tree->nil == root) {
+        return;
+    }
+
+    rbk_set_free_subtree(tree, root->left);
+    rbk_set_free_subtree(tree, root->right);
+    rbk_set_free_node(tree, root);
+}
+
+/**
+ * @brief Function to get the black height of a detached subtree, the number
+ * of black nodes from the root (included) to a leaf, by walking its left spine.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root starting point of the subtree
+ * @return size_t the black height of the subtree
+ */
+static size_t rbk_set_black_height(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * __restrict__ root) {
+    size_t black_height = 0;
+
+    while (tree->nil != root) {
+        if (BLACK == root->color) {
+            ++black_height;
+        }
+
+        root = root->left;
+    }
+
+    return black_height;
+}
+
+#ifndef NDEBUG
+/**
+ * @brief Debug check that the left and the right spines of a red-black
+ * tree have the same black height, the joins walk the spines by the height
+ * of rbk_set_black_height. Takes O(logN) time.
+ * 
+ * @param tree an allocated red-black tree object
+ * @return uint8_t 1 if the spines have the same black height, 0 otherwise
+ */
+static uint8_t rbk_set_spines_balanced(const rbk_tree_t * const __restrict__ tree) {
+    const rbk_tree_node_t *root = tree->root;
+    size_t black_height = 0;
+
+    while (tree->nil != root) {
+        if (BLACK == root->color) {
+            ++black_height;
+        }
+
+        root = root->right;
+    }
+
+    return (rbk_set_black_height(tree, tree->root) == black_height);
+}
+#endif
+
+/**
+ * @brief Function to link a node between two detached subtrees, the
+ * node becomes the root of a detached subtree with the given color.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param left left subtree of the node
+ * @param link_node node to link
+ * @param right right subtree of the node
+ * @param color new color of the node
+ * @return rbk_tree_node_t* the linked node
+ */
+static rbk_tree_node_t* rbk_set_link(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const left, rbk_tree_node_t * const __restrict__ link_node, rbk_tree_node_t * const right, rbk_tree_node_color_t color) {
+    link_node->left = left;
+    link_node->right = right;
+    link_node->parent = tree->nil;
+    link_node->color = color;
+
+    if (tree->nil != left) {
+        left->parent = link_node;
+    }
+
+    if (tree->nil != right) {
+        right->parent = link_node;
+    }
+
+    if (0 != tree->order_stats) {
+        link_node->weight = left->weight + right->weight + link_node->count;
+    }
+
+    return link_node;
+}
+
+/**
+ * @brief Function to rotate to left a detached subtree, the colors
+ * of the nodes are kept.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root root of the subtree, with a right child
+ * @return rbk_tree_node_t* the new root of the subtree
+ */
+static rbk_tree_node_t* rbk_set_rotate_left(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const __restrict__ root) {
+    rbk_tree_node_t * const new_root = root->right;
+
+    rbk_set_link(tree, root->left, root, new_root->left, root->color);
+
+    return rbk_set_link(tree, root, new_root, new_root->right, new_root->color);
+}
+
+/**
+ * @brief Function to rotate to right a detached subtree, the colors
+ * of the nodes are kept.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root root of the subtree, with a left child
+ * @return rbk_tree_node_t* the new root of the subtree
+ */
+static rbk_tree_node_t* rbk_set_rotate_right(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const __restrict__ root) {
+    rbk_tree_node_t * const new_root = root->left;
+
+    rbk_set_link(tree, new_root->right, root, root->right, root->color);
+
+    return rbk_set_link(tree, new_root->left, new_root, root, new_root->color);
+}
+
+/**
+ * @brief Helper function for rbk_set_join when the left subtree has a
+ * greater black height. The node is linked in red with the right subtree
+ * at the first black node of the right spine with the same black height,
+ * a red node with a red child is fixed by a rotation on the way back.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param left the left subtree
+ * @param left_height black height of the left subtree
+ * @param join_node node to link between the subtrees
+ * @param right the right subtree
+ * @param right_height black height of the right subtree
+ * @return rbk_tree_node_t* the root of the joined subtree
+ */
+static rbk_tree_node_t* rbk_set_join_right(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const left, size_t left_height, rbk_tree_node_t * const __restrict__ join_node, rbk_tree_node_t * const right, size_t right_height) {
+    if ((BLACK == left->color) && (left_height == right_height)) {
+        return rbk_set_link(tree, left, join_node, right, RED);
+    }
+
+    size_t child_height = left_height - ((BLACK == left->color) ? 1 : 0);
+    rbk_tree_node_t * const joined = rbk_set_join_right(tree, left->right, child_height, join_node, right, right_height);
+
+    rbk_set_link(tree, left->left, left, joined, left->color);
+
+    /* Two red nodes in a row under a black node */
+    if ((BLACK == left->color) && (RED == joined->color) && (RED == joined->right->color)) {
+        joined->right->color = BLACK;
+        return rbk_set_rotate_left(tree, left);
+    }
+
+    return left;
+}
+
+/**
+ * @brief Helper function for rbk_set_join when the right subtree has a
+ * greater black height, symmetric to rbk_set_join_right.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param left the left subtree
+ * @param left_height black height of the left subtree
+ * @param join_node node to link between the subtrees
+ * @param right the right subtree
+ * @param right_height black height of the right subtree
+ * @return rbk_tree_node_t* the root of the joined subtree
+ */
+static rbk_tree_node_t* rbk_set_join_left(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const left, size_t left_height, rbk_tree_node_t * const __restrict__ join_node, rbk_tree_node_t * const right, size_t right_height) {
+    if ((BLACK == right->color) && (left_height == right_height)) {
+        return rbk_set_link(tree, left, join_node, right, RED);
+    }
+
+    size_t child_height = right_height - ((BLACK == right->color) ? 1 : 0);
+    rbk_tree_node_t * const joined = rbk_set_join_left(tree, left, left_height, join_node, right->left, child_height);
+
+    rbk_set_link(tree, joined, right, right->right, right->color);
+
+    /* Two red nodes in a row under a black node */
+    if ((BLACK == right->color) && (RED == joined->color) && (RED == joined->left->color)) {
+        joined->left->color = BLACK;
+        return rbk_set_rotate_right(tree, right);
+    }
+
+    return right;
+}
+
+/**
+ * @brief Function to join two detached subtrees and a node, every element
+ * of the left subtree must be smaller than the node and every element of
+ * the right subtree must be greater. The root of the result may be red.
+ * Takes O(|bh(left) - bh(right)| + 1) time.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param left the left subtree
+ * @param left_height black height of the left subtree
+ * @param join_node node to link between the subtrees
+ * @param right the right subtree
+ * @param right_height black height of the right subtree
+ * @param height pointer to save the black height of the result
+ * @return rbk_tree_node_t* the root of the joined subtree
+ */
+static rbk_tree_node_t* rbk_set_join(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const left, size_t left_height, rbk_tree_node_t * const __restrict__ join_node, rbk_tree_node_t * const right, size_t right_height, size_t * const __restrict__ height) {
+    rbk_tree_node_t *joined = NULL;
+
+    if (left_height > right_height) {
+        joined = rbk_set_join_right(tree, left, left_height, join_node, right, right_height);
+        *height = left_height;
+
+        if ((RED == joined->color) && (RED == joined->right->color)) {
+            joined->color = BLACK;
+            ++(*height);
+        }
+    } else if (right_height > left_height) {
+        joined = rbk_set_join_left(tree, left, left_height, join_node, right, right_height);
+        *height = right_height;
+
+        if ((RED == joined->color) && (RED == joined->left->color)) {
+            joined->color = BLACK;
+            ++(*height);
+        }
+    } else if ((BLACK == left->color) && (BLACK == right->color)) {
+        joined = rbk_set_link(tree, left, join_node, right, RED);
+        *height = left_height;
+    } else {
+        joined = rbk_set_link(tree, left, join_node, right, BLACK);
+        *height = left_height + 1;
+    }
+
+    joined->parent = tree->nil;
+
+    return joined;
+}
+
+/**
+ * @brief Function to split a detached subtree by data into the subtree
+ * of the smaller elements, the node equal to data (or `nil`) and the
+ * subtree of the greater elements. Takes O(logN) time.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root starting point of the subtree
+ * @param height black height of the subtree
+ * @param data pointer to the data to split by
+ * @param left pointer to save the subtree of the smaller elements
+ * @param left_height pointer to save the black height of the smaller elements
+ * @param found pointer to save the node equal to data or `nil`
+ * @param right pointer to save the subtree of the greater elements
+ * @param right_height pointer to save the black height of the greater elements
+ */
+static void rbk_set_split(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const root, size_t height, const void * const __restrict__ data,
+                          rbk_tree_node_t ** const __restrict__ left, size_t * const __restrict__ left_height, rbk_tree_node_t ** const __restrict__ found,
+                          rbk_tree_node_t ** const __restrict__ right, size_t * const __restrict__ right_height) {
+    if (tree->nil == root) {
+        *left = *found = *right = tree->nil;
+        *left_height = *right_height = 0;
+        return;
+    }
+
+    rbk_tree_node_t * const root_left = root->left;
+    rbk_tree_node_t * const root_right = root->right;
+    size_t child_height = height - ((BLACK == root->color) ? 1 : 0);
+
+    root_left->parent = root_right->parent = tree->nil;
+
+    int32_t cmp = rbk_compare(tree, root->data, data);
+
+    if (0 == cmp) {
+        *left = root_left;
+        *right = root_right;
+        *left_height = *right_height = child_height;
+        *found = rbk_set_link(tree, tree->nil, root, tree->nil, RED);
+    } else if (cmp >= 1) {
+        rbk_set_split(tree, root_left, child_height, data, left, left_height, found, right, right_height);
+        *right = rbk_set_join(tree, *right, *right_height, root, root_right, child_height, right_height);
+    } else {
+        rbk_set_split(tree, root_right, child_height, data, left, left_height, found, right, right_height);
+        *left = rbk_set_join(tree, root_left, child_height, root, *left, *left_height, left_height);
+    }
+}
+
+/**
+ * @brief Function to remove the greatest node of a detached subtree.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root starting point of a non-empty subtree
+ * @param height black height of the subtree
+ * @param last pointer to save the greatest node
+ * @param rest_height pointer to save the black height of the result
+ * @return rbk_tree_node_t* the subtree without its greatest node
+ */
+static rbk_tree_node_t* rbk_set_split_last(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const root, size_t height, rbk_tree_node_t ** const __restrict__ last, size_t * const __restrict__ rest_height) {
+    rbk_tree_node_t * const root_left = root->left;
+    size_t child_height = height - ((BLACK == root->color) ? 1 : 0);
+
+    root_left->parent = tree->nil;
+
+    if (tree->nil == root->right) {
+        *last = root;
+        *rest_height = child_height;
+        return root_left;
+    }
+
+    size_t right_height = 0;
+    rbk_tree_node_t * const rest = rbk_set_split_last(tree, root->right, child_height, last, &right_height);
+
+    return rbk_set_join(tree, root_left, child_height, root, rest, right_height, rest_height);
+}
+
+/**
+ * @brief Function to join two detached subtrees without a middle node,
+ * every element of the left subtree must be smaller than every element
+ * of the right subtree.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param left the left subtree
+ * @param left_height black height of the left subtree
+ * @param right the right subtree
+ * @param right_height black height of the right subtree
+ * @param height pointer to save the black height of the result
+ * @return rbk_tree_node_t* the root of the joined subtree
+ */
+static rbk_tree_node_t* rbk_set_join2(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const left, size_t left_height, rbk_tree_node_t * const right, size_t right_height, size_t * const __restrict__ height) {
+    if (tree->nil == left) {
+        *height = right_height;
+        return right;
+    }
+
+    rbk_tree_node_t *last = tree->nil;
+    size_t rest_height = 0;
+    rbk_tree_node_t * const rest = rbk_set_split_last(tree, left, left_height, &last, &rest_height);
+
+    return rbk_set_join(tree, rest, rest_height, last, right, right_height, height);
+}
+
+/**
+ * @brief Helper function for rbk_union function. The second subtree is
+ * split by the root of the first one and the halves are merged recursively,
+ * the two recursive calls are independent of each other.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param first a detached subtree
+ * @param first_height black height of the first subtree
+ * @param second a detached subtree
+ * @param second_height black height of the second subtree
+ * @param height pointer to save the black height of the result
+ * @return rbk_tree_node_t* the root of the union
+ */
+static rbk_tree_node_t* rbk_union_helper(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const first, size_t first_height, rbk_tree_node_t * const second, size_t second_height, size_t * const __restrict__ height) {
+    if (tree->nil == first) {
+        *height = second_height;
+        return second;
+    }
+
+    if (tree->nil == second) {
+        *height = first_height;
+        return first;
+    }
+
+    rbk_tree_node_t * const first_left = first->left;
+    rbk_tree_node_t * const first_right = first->right;
+    size_t child_height = first_height - ((BLACK == first->color) ? 1 : 0);
+    rbk_tree_node_t *second_left = tree->nil, *found = tree->nil, *second_right = tree->nil;
+    size_t second_left_height = 0, second_right_height = 0, left_height = 0, right_height = 0;
+
+    first_left->parent = first_right->parent = tree->nil;
+    rbk_set_split(tree, second, second_height, first->data, &second_left, &second_left_height, &found, &second_right, &second_right_height);
+
+    rbk_tree_node_t * const left = rbk_union_helper(tree, first_left, child_height, second_left, second_left_height, &left_height);
+    rbk_tree_node_t * const right = rbk_union_helper(tree, first_right, child_height, second_right, second_right_height, &right_height);
+
+    /* Equal elements are merged into one node */
+    if (tree->nil != found) {
+        first->count += found->count;
+        rbk_set_free_node(tree, found);
+    }
+
+    return rbk_set_join(tree, left, left_height, first, right, right_height, height);
+}
+
+/**
+ * @brief Helper function for rbk_intersection function, works like
+ * rbk_union_helper and frees the nodes that are not in both subtrees.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param first a detached subtree
+ * @param first_height black height of the first subtree
+ * @param second a detached subtree
+ * @param second_height black height of the second subtree
+ * @param height pointer to save the black height of the result
+ * @return rbk_tree_node_t* the root of the intersection
+ */
+static rbk_tree_node_t* rbk_intersection_helper(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const first, size_t first_height, rbk_tree_node_t * const second, size_t second_height, size_t * const __restrict__ height) {
+    if ((tree->nil == first) || (tree->nil == second)) {
+        rbk_set_free_subtree(tree, first);
+        rbk_set_free_subtree(tree, second);
+
+        *height = 0;
+        return tree->nil;
+    }
+
+    rbk_tree_node_t * const first_left = first->left;
+    rbk_tree_node_t * const first_right = first->right;
+    size_t child_height = first_height - ((BLACK == first->color) ? 1 : 0);
+    rbk_tree_node_t *second_left = tree->nil, *found = tree->nil, *second_right = tree->nil;
+    size_t second_left_height = 0, second_right_height = 0, left_height = 0, right_height = 0;
+
+    first_left->parent = first_right->parent = tree->nil;
+    rbk_set_split(tree, second, second_height, first->data, &second_left, &second_left_height, &found, &second_right, &second_right_height);
+
+    rbk_tree_node_t * const left = rbk_intersection_helper(tree, first_left, child_height, second_left, second_left_height, &left_height);
+    rbk_tree_node_t * const right = rbk_intersection_helper(tree, first_right, child_height, second_right, second_right_height, &right_height);
+
+    if (tree->nil == found) {
+        rbk_set_free_node(tree, first);
+
+        return rbk_set_join2(tree, left, left_height, right, right_height, height);
+    }
+
+    /* The element is kept as many times as in both trees */
+    if (found->count < first->count) {
+        first->count = found->count;
+    }
+
+    rbk_set_free_node(tree, found);
+
+    return rbk_set_join(tree, left, left_height, first, right, right_height, height);
+}
+
+/**
+ * @brief Helper function for rbk_difference function. The first subtree
+ * is split by the root of the second one and the halves are subtracted
+ * recursively, the nodes of the second subtree are freed.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param first a detached subtree
+ * @param first_height black height of the first subtree
+ * @param second a detached subtree
+ * @param second_height black height of the second subtree
+ * @param height pointer to save the black height of the result
+ * @return rbk_tree_node_t* the root of the difference
+ */
+static rbk_tree_node_t* rbk_difference_helper(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const first, size_t first_height, rbk_tree_node_t * const second, size_t second_height, size_t * const __restrict__ height) {
+    if ((tree->nil == first) || (tree->nil == second)) {
+        rbk_set_free_subtree(tree, second);
+
+        *height = first_height;
+        return first;
+    }
+
+    rbk_tree_node_t * const second_left = second->left;
+    rbk_tree_node_t * const second_right = second->right;
+    size_t child_height = second_height - ((BLACK == second->color) ? 1 : 0);
+    rbk_tree_node_t *first_left = tree->nil, *found = tree->nil, *first_right = tree->nil;
+    size_t first_left_height = 0, first_right_height = 0, left_height = 0, right_height = 0;
+
+    second_left->parent = second_right->parent = tree->nil;
+    rbk_set_split(tree, first, first_height, second->data, &first_left, &first_left_height, &found, &first_right, &first_right_height);
+
+    rbk_tree_node_t * const left = rbk_difference_helper(tree, first_left, first_left_height, second_left, child_height, &left_height);
+    rbk_tree_node_t * const right = rbk_difference_helper(tree, first_right, first_right_height, second_right, child_height, &right_height);
+
+    if (tree->nil != found) {
+        rbk_set_free_node(tree, found);
+    }
+
+    rbk_set_free_node(tree, second);
+
+    return rbk_set_join2(tree, left, left_height, right, right_height, height);
+}
+
+/**
+ * @brief Function to check that two red-black trees can exchange their nodes.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param other an allocated red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t rbk_set_check(rbk_tree_t * const tree, rbk_tree_t * const other) {
+    if ((NULL == tree) || (NULL == other)) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree == other) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if ((tree->cmp != other->cmp) || (tree->key_kind != other->key_kind) || (tree->data_size != other->data_size) || (tree->allocator != other->allocator) ||
+        (NULL != tree->node_pool) || (NULL != other->node_pool)) {
+        return SCL_INCOMPATIBLE_TREES;
+    }
+
+    /* The joins read the color of the `nil` node, which must be black */
+    tree->nil->color = other->nil->color = BLACK;
+
+    /* A broken red-black invariant is a bug of the tree, not an input error */
+    assert(rbk_set_spines_balanced(tree) && rbk_set_spines_balanced(other));
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move all the nodes of other into tree, the nodes of
+ * the smaller tree are moved to the `nil` node of the bigger tree (the two
+ * trees exchange their `nil` nodes if tree is smaller), so the move takes
+ * O(min(N, M)) time. The other tree becomes empty.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param other an allocated red-black tree object
+ * @return rbk_tree_node_t* the root of the moved nodes, a detached subtree of tree
+ */
+static rbk_tree_node_t* rbk_set_take(rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other) {
+    rbk_tree_node_t * const other_root = other->root;
+
+    if (other->nil == other_root) {
+        return tree->nil;
+    }
+
+    if (other->size <= tree->size) {
+        rbk_set_move_helper(other->nil, tree->nil, other_root);
+        other_root->parent = tree->nil;
+    } else {
+        rbk_tree_node_t * const tree_nil = tree->nil;
+
+        if (tree_nil != tree->root) {
+            rbk_set_move_helper(tree_nil, other->nil, tree->root);
+            tree->root->parent = other->nil;
+        } else {
+            tree->root = other->nil;
+        }
+
+        tree->nil = other->nil;
+        other->nil = tree_nil;
+    }
+
+    /* The weights of the moved nodes are needed by tree */
+    if ((0 != tree->order_stats) && (0 == other->order_stats)) {
+        rbk_order_stats_helper(tree, other_root);
+    }
+
+    tree->size += other->size;
+
+    other->root = other->nil;
+    other->size = 0;
+
+    return other_root;
+}
+
+/**
+ * @brief Function to update the bloom filters after the nodes of other were
+ * moved into tree by rbk_set_take: the moved elements are added to the filter
+ * of tree and the filter of other is cleared.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param other an allocated red-black tree object, now empty
+ * @param moved_root root of the moved nodes, a detached subtree of tree
+ */
+static void rbk_set_move_bloom_filter(rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other, const rbk_tree_node_t * const __restrict__ moved_root) {
+    if (NULL != tree->filter) {
+        rbk_fill_bloom_filter(tree, moved_root, tree->filter);
+    }
+
+    if (NULL != other->filter) {
+        bloom_filter_clear(other->filter);
+    }
+}
+
+/**
+ * @brief Function to append all the elements of other to tree, every
+ * element of tree must be smaller than every element of other. Takes
+ * O(logN + min(N, M)) time (see rbk_set_take), the other tree becomes empty.
+ * Both trees must have the same compare function, data size and allocator,
+ * and must not use node pools.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param other an allocated red-black tree object with greater elements
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_join(rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other) {
+    scl_error_t err = rbk_set_check(tree, other);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    if (other->nil == other->root) {
+        return SCL_OK;
+    }
+
+    /* The trees must not overlap */
+    if ((tree->nil != tree->root) && (rbk_compare(tree, rbk_max_node(tree, tree->root)->data, rbk_min_node(other, other->root)->data) >= 0)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    rbk_tree_node_t * const other_root = rbk_set_take(tree, other);
+
+    rbk_set_move_bloom_filter(tree, other, other_root);
+
+    size_t height = 0;
+
+    tree->root = rbk_set_join2(tree, tree->root, rbk_set_black_height(tree, tree->root), other_root, rbk_set_black_height(tree, other_root), &height);
+    tree->root->color = BLACK;
+
+    rbk_refresh_bloom_filter(tree);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move the elements of tree that are greater than or
+ * equal to data into the empty tree greater. Takes O(logN + min(K, N - K))
+ * time, where K is the number of moved nodes. Both trees must have the same
+ * compare function, data size and allocator, and must not use node pools.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to the data to split by
+ * @param greater an allocated empty red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_split(rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data, rbk_tree_t * const __restrict__ greater) {
+    scl_error_t err = rbk_set_check(tree, greater);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (greater->nil != greater->root) {
+        return SCL_INVALID_INPUT;
+    }
+
+    rbk_tree_node_t *left = tree->nil, *found = tree->nil, *right = tree->nil;
+
+    size_t left_height = 0, right_height = 0;
+
+    rbk_set_split(tree, tree->root, rbk_set_black_height(tree, tree->root), data, &left, &left_height, &found, &right, &right_height);
+
+    /* The element equal to data goes with the greater elements */
+    if (tree->nil != found) {
+        right = rbk_set_join(tree, tree->nil, 0, found, right, right_height, &right_height);
+    }
+
+    /* Count the smaller part, doubling the limit on both parts */
+    size_t left_size = 0, right_size = 0;
+
+    for (size_t limit = 1; ; limit *= 2) {
+        left_size = rbk_set_count_helper(tree, left, limit);
+
+        if (left_size < limit) {
+            right_size = tree->size - left_size;
+            break;
+        }
+
+        right_size = rbk_set_count_helper(tree, right, limit);
+
+        if (right_size < limit) {
+            left_size = tree->size - right_size;
+            break;
+        }
+    }
+
+    /* The smaller part is moved to the `nil` node of greater */
+    rbk_tree_node_t * const tree_nil = tree->nil;
+    rbk_tree_node_t * const greater_nil = greater->nil;
+
+    if (left_size < right_size) {
+        rbk_set_move_helper(tree_nil, greater_nil, left);
+
+        tree->nil = greater_nil;
+        greater->nil = tree_nil;
+    } else {
+        rbk_set_move_helper(tree_nil, greater_nil, right);
+    }
+
+    /* Empty parts get the `nil` node of their tree */
+    left = (tree_nil == left) ? tree->nil : left;
+    right = (tree_nil == right) ? greater->nil : right;
+
+    /* The roots of the parts may be red */
+    left->parent = tree->nil;
+    right->parent = greater->nil;
+
+    left->color = right->color = BLACK;
+
+    if ((0 != greater->order_stats) && (0 == tree->order_stats)) {
+        rbk_order_stats_helper(greater, right);
+    }
+
+    tree->root = left;
+    tree->size = left_size;
+
+    greater->root = right;
+    greater->size = right_size;
+
+    /* Tree keeps a subset of its elements, the moved elements must pass the filter of greater */
+    rbk_refresh_bloom_filter(tree);
+
+    if (NULL != greater->filter) {
+        rbk_fill_bloom_filter(greater, greater->root, greater->filter);
+        rbk_refresh_bloom_filter(greater);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to merge all the elements of other into tree by the
+ * join-based union algorithm, in O(M * log(N / M + 1)) time for M <= N
+ * (plus the move of rbk_set_take). The count of an element found in both
+ * trees is the sum of its counts. The other tree becomes empty. Both trees
+ * must have the same compare function, data size and allocator, and must
+ * not use node pools.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param other an allocated red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_union(rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other) {
+    scl_error_t err = rbk_set_check(tree, other);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    rbk_tree_node_t * const other_root = rbk_set_take(tree, other);
+
+    rbk_set_move_bloom_filter(tree, other, other_root);
+
+    size_t height = 0;
+
+    tree->root = rbk_union_helper(tree, tree->root, rbk_set_black_height(tree, tree->root), other_root, rbk_set_black_height(tree, other_root), &height);
+    tree->root->color = BLACK;
+
+    rbk_refresh_bloom_filter(tree);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to keep in tree only the elements that are also in
+ * other, by the join-based intersection algorithm. The count of a kept
+ * element is the smaller of its counts. All the nodes of other are freed
+ * and the other tree becomes empty. Both trees must have the same compare
+ * function, data size and allocator, and must not use node pools.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param other an allocated red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_intersection(rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other) {
+    scl_error_t err = rbk_set_check(tree, other);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    rbk_tree_node_t * const other_root = rbk_set_take(tree, other);
+
+    /* Tree keeps a subset of its elements, other becomes empty */
+    if (NULL != other->filter) {
+        bloom_filter_clear(other->filter);
+    }
+
+    size_t height = 0;
+
+    tree->root = rbk_intersection_helper(tree, tree->root, rbk_set_black_height(tree, tree->root), other_root, rbk_set_black_height(tree, other_root), &height);
+    tree->root->color = BLACK;
+
+    rbk_refresh_bloom_filter(tree);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove from tree the elements that are in other
+ * (the whole node, as rbk_delete does), by the join-based difference
+ * algorithm. All the nodes of other are freed and the other tree becomes
+ * empty. Both trees must have the same compare function, data size and
+ * allocator, and must not use node pools.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param other an allocated red-black tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_difference(rbk_tree_t * const __restrict__ tree, rbk_tree_t * const __restrict__ other) {
+    scl_error_t err = rbk_set_check(tree, other);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    rbk_tree_node_t * const other_root = rbk_set_take(tree, other);
+
+    /* Tree keeps a subset of its elements, other becomes empty */
+    if (NULL != other->filter) {
+        bloom_filter_clear(other->filter);
+    }
+
+    size_t height = 0;
+
+    tree->root = rbk_difference_helper(tree, tree->root, rbk_set_black_height(tree, tree->root), other_root, rbk_set_black_height(tree, other_root), &height);
+    tree->root->color = BLACK;
+
+    rbk_refresh_bloom_filter(tree);
+
+    return SCL_OK;
+}
@@ -0,0 +1,641 @@
+/**
+ * @file scl_skip_list.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_skip_list.h"
+
+/**
+ * @brief Create a Skip List object. Allocation may fail if user
+ * does not provide a compare function, also in case if heap memory
+ * is full function will return a `NULL` pointer
+ *
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free the content of data
+ * basic types like int, float, double, etc... do not need a free function
+ * so you can pass a NULL pointer
+ * @param data_size length in bytes of the data data type
+ * @return skip_list_t* return a new dynamically allocated list or `NULL` if
+ * allocation went wrong
+ */
+skip_list_t* create_skip_list(compare_func cmp, free_func frd, size_t data_size) {
+    /*
+     * It is required for every skip list to have a compare function
+     * The free function is optional
+     */
+    if (NULL == cmp) {
+        errno = EINVAL;
+        perror("Compare function undefined for skip list");
+        return NULL;
+    }
+
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new list on heap */
+    skip_list_t *new_list = scl_malloc(allocator, sizeof(*new_list));
+
+    if (NULL == new_list) {
+        errno = ENOMEM;
+        perror("Not enough memory for skip list allocation");
+        return NULL;
+    }
+
+    /* The sentinel node has every level and no data */
+    new_list->head = scl_calloc(allocator, 1, sizeof(*new_list->head) + SKIP_LIST_MAX_LEVEL * sizeof(new_list->head->links[0]));
+
+    if (NULL == new_list->head) {
+        scl_free(allocator, new_list);
+
+        errno = ENOMEM;
+        perror("Not enough memory for skip list allocation");
+        return NULL;
+    }
+
+    new_list->head->data = NULL;
+    new_list->head->level = SKIP_LIST_MAX_LEVEL;
+
+    new_list->allocator = allocator;
+
+    /* Set pointer functions in skip list class */
+    new_list->cmp = cmp;
+    new_list->frd = frd;
+
+    /* Initialize tail, size and levels of new list */
+    new_list->tail = NULL;
+    new_list->data_size = data_size;
+    new_list->size = 0;
+    new_list->level = 1;
+    new_list->seed = (uint64_t)(uintptr_t)new_list ^ 0x9E3779B97F4A7C15ULL;
+
+    /* Return new allocated list */
+    return new_list;
+}
+
+/**
+ * @brief Function to draw the number of levels of a new node, every
+ * level above the first one is taken with probability 1/4.
+ *
+ * @param list an allocated skip list object
+ * @return size_t number of levels of the new node
+ */
+static size_t skip_list_random_level(skip_list_t * const __restrict__ list) {
+    /* Xorshift generator, two bits are spent for every level */
+    uint64_t bits = list->seed;
+
+    bits ^= bits << 13;
+    bits ^= bits >> 7;
+    bits ^= bits << 17;
+
+    list->seed = bits;
+
+    size_t level = 1;
+
+    while ((level < SKIP_LIST_MAX_LEVEL) && (0 == (bits & 3))) {
+        ++level;
+        bits >>= 2;
+    }
+
+    return level;
+}
+
+/**
+ * @brief Create a Skip List Node object. Creation of a node will
+ * fail if heap memory is full, in this case function will return
+ * a `NULL` pointer
+ *
+ * @param list an allocated skip list object
+ * @param data pointer to address of a generic data
+ * @param level number of links of the new node
+ * @return skip_list_node_t* return a new allocated node object
+ */
+static skip_list_node_t* create_skip_list_node(const skip_list_t * const __restrict__ list, const void * __restrict__ data, size_t level) {
+    const size_t links_size = SCL_ALIGN_SIZE(sizeof(skip_list_node_t) + level * sizeof(skip_list_link_t));
+
+    /* Allocate a new Node on heap */
+    skip_list_node_t *new_node = scl_malloc(list->allocator, links_size + list->data_size);
+
+    if (NULL == new_node) {
+        return NULL;
+    }
+
+    new_node->level = level;
+
+    /* The data is stored inline, right after the links, in the same block */
+    new_node->data = (uint8_t *)new_node + links_size;
+    memcpy(new_node->data, data, list->data_size);
+
+    return new_node;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * skip list object. The function will iterate through all nodes and will
+ * free the data content according to frd function provided by user at
+ * creation of skip list.
+ *
+ * @param list an allocated skip list object. If list is not allocated
+ * no operation will be needed
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_skip_list(skip_list_t * const __restrict__ list) {
+    /* Check if list needs to be deallocated */
+    if (NULL == list) {
+        return SCL_NULL_SKIP_LIST;
+    }
+
+    skip_list_node_t *iterator = list->head->links[0].next;
+
+    /* Iterate through every node on the bottom level */
+    while (NULL != iterator) {
+        skip_list_node_t *next = iterator->links[0].next;
+
+        /* Erase content of an element */
+        if (NULL != list->frd) {
+            list->frd(iterator->data);
+        }
+
+        scl_free(list->allocator, iterator);
+        iterator = next;
+    }
+
+    /* Free sentinel and list */
+    scl_free(list->allocator, list->head);
+    scl_free(list->allocator, list);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if a skip list object is empty or not.
+ * A `NULL` list is also considered as an empty list
+ *
+ * @param list a skip list object
+ * @return uint8_t true(1) if list is empty and false(0) if list is not
+ * empty
+ */
+uint8_t is_skip_list_empty(const skip_list_t * const __restrict__ list) {
+    if ((NULL == list) || (0 == list->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the skip list size object. If list is not
+ * allocated then function will return SIZE_MAX value.
+ *
+ * @param list a skip list object
+ * @return size_t SIZE_MAX if list is not allocated or
+ * list size
+ */
+size_t get_skip_list_size(const skip_list_t * const __restrict__ list) {
+    if (NULL == list) {
+        return SIZE_MAX;
+    }
+
+    return list->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a skip list. The links of
+ * every node (one per level, with their spans) are the node overhead, the
+ * sentinel head with all the levels is counted with the list object.
+ * Function visits every node of the list.
+ *
+ * @param list a skip list object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t skip_list_memory_usage(const skip_list_t * const __restrict__ list, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == list) {
+        return SCL_NULL_SKIP_LIST;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*list) + sizeof(*list->head) + SKIP_LIST_MAX_LEVEL * sizeof(list->head->links[0]);
+    usage->node_bytes = 0;
+    usage->payload_bytes = list->size * list->data_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = 0;
+    usage->nodes = list->size;
+
+    for (const skip_list_node_t *iterator = list->head->links[0].next; NULL != iterator; iterator = iterator->links[0].next) {
+        usage->node_bytes += SCL_ALIGN_SIZE(sizeof(*iterator) + iterator->level * sizeof(iterator->links[0]));
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the skip list head object (the smallest element)
+ *
+ * @param list a skip list object
+ * @return const void* `NULL` if list is not allocated
+ * or actual head data of the list
+ */
+const void* get_skip_list_head(const skip_list_t * const __restrict__ list) {
+    if ((NULL == list) || (NULL == list->head->links[0].next)) {
+        return NULL;
+    }
+
+    return list->head->links[0].next->data;
+}
+
+/**
+ * @brief Get the skip list tail object (the biggest element)
+ *
+ * @param list a skip list object
+ * @return const void* `NULL` if list is not allocated
+ * or actual tail data of the list
+ */
+const void* get_skip_list_tail(const skip_list_t * const __restrict__ list) {
+    if ((NULL == list) || (NULL == list->tail)) {
+        return NULL;
+    }
+
+    return list->tail->data;
+}
+
+/**
+ * @brief Function to insert an element in order in the skip list. The
+ * position is found according to cmp function provided at the creation
+ * of the list, an element equal to other elements is inserted after them.
+ *
+ * @param list a skip list object
+ * @param data a pointer for data to insert in list
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t skip_list_insert(skip_list_t * const __restrict__ list, const void * __restrict__ data) {
+    /* Check if list and data are valid */
+    if (NULL == list) {
+        return SCL_NULL_SKIP_LIST;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    skip_list_node_t *update[SKIP_LIST_MAX_LEVEL];
+    size_t rank[SKIP_LIST_MAX_LEVEL];
+
+    skip_list_node_t *iterator = list->head;
+
+    /* Find the last node not bigger than data on every level */
+    for (size_t iter = list->level; iter-- > 0; ) {
+        rank[iter] = (iter == list->level - 1) ? 0 : rank[iter + 1];
+
+        while ((NULL != iterator->links[iter].next) && (list->cmp(iterator->links[iter].next->data, data) <= 0)) {
+            rank[iter] += iterator->links[iter].span;
+            iterator = iterator->links[iter].next;
+        }
+
+        update[iter] = iterator;
+    }
+
+    const size_t level = skip_list_random_level(list);
+
+    /* New levels start from the sentinel and jump over the whole list */
+    for (size_t iter = list->level; iter < level; ++iter) {
+        rank[iter] = 0;
+        update[iter] = list->head;
+        update[iter]->links[iter].next = NULL;
+        update[iter]->links[iter].span = list->size;
+    }
+
+    skip_list_node_t *new_node = create_skip_list_node(list, data, level);
+
+    /* Check if node was allocated */
+    if (NULL == new_node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    if (level > list->level) {
+        list->level = level;
+    }
+
+    /* Link the new node and split the spans of the links it is inserted in */
+    for (size_t iter = 0; iter < level; ++iter) {
+        new_node->links[iter].next = update[iter]->links[iter].next;
+        update[iter]->links[iter].next = new_node;
+
+        new_node->links[iter].span = update[iter]->links[iter].span - (rank[0] - rank[iter]);
+        update[iter]->links[iter].span = rank[0] - rank[iter] + 1;
+    }
+
+    /* Higher links jump over one more element */
+    for (size_t iter = level; iter < list->level; ++iter) {
+        ++(update[iter]->links[iter].span);
+    }
+
+    if (NULL == new_node->links[0].next) {
+        list->tail = new_node;
+    }
+
+    /* Increase size of the list */
+    ++(list->size);
+
+    /* Insertion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find the last node smaller than data on every level
+ * (the nodes before the first element not smaller than data).
+ *
+ * @param list an allocated skip list object
+ * @param data pointer to a typed data
+ * @param update array of SKIP_LIST_MAX_LEVEL nodes to store the nodes or `NULL`
+ * @param rank pointer to store the number of elements smaller than data or `NULL`
+ * @return skip_list_node_t* last node smaller than data on the bottom level
+ */
+static skip_list_node_t* skip_list_lower_bound(const skip_list_t * const __restrict__ list, const void * const __restrict__ data, skip_list_node_t ** const __restrict__ update, size_t * const __restrict__ rank) {
+    skip_list_node_t *iterator = list->head;
+    size_t traversed = 0;
+
+    for (size_t iter = list->level; iter-- > 0; ) {
+        while ((NULL != iterator->links[iter].next) && (list->cmp(iterator->links[iter].next->data, data) < 0)) {
+            traversed += iterator->links[iter].span;
+            iterator = iterator->links[iter].next;
+        }
+
+        if (NULL != update) {
+            update[iter] = iterator;
+        }
+    }
+
+    if (NULL != rank) {
+        *rank = traversed;
+    }
+
+    return iterator;
+}
+
+/**
+ * @brief Function to find the node before an index on every level,
+ * the links are followed while their spans do not pass the index.
+ *
+ * @param list an allocated skip list object
+ * @param data_index index of the element, smaller than list size
+ * @param update array of SKIP_LIST_MAX_LEVEL nodes to store the nodes or `NULL`
+ * @return skip_list_node_t* node before the index on the bottom level
+ */
+static skip_list_node_t* skip_list_before_index(const skip_list_t * const __restrict__ list, size_t data_index, skip_list_node_t ** const __restrict__ update) {
+    skip_list_node_t *iterator = list->head;
+    size_t traversed = 0;
+
+    for (size_t iter = list->level; iter-- > 0; ) {
+        while ((NULL != iterator->links[iter].next) && (traversed + iterator->links[iter].span <= data_index)) {
+            traversed += iterator->links[iter].span;
+            iterator = iterator->links[iter].next;
+        }
+
+        if (NULL != update) {
+            update[iter] = iterator;
+        }
+    }
+
+    return iterator;
+}
+
+/**
+ * @brief Function to find an element of the list from a given index (its
+ * rank in the order of the list) in expected O(log n). Function will fail
+ * if index is bigger than current size of list or list is not allocated
+ *
+ * @param list a skip list object
+ * @param data_index index to pick element from
+ * @return const void* skip list data from list at specified index
+ */
+const void* skip_list_find_index(const skip_list_t * const __restrict__ list, size_t data_index) {
+    /* Check if list and index are valid */
+    if ((NULL == list) || (data_index >= list->size)) {
+        return NULL;
+    }
+
+    return skip_list_before_index(list, data_index, NULL)->links[0].next->data;
+}
+
+/**
+ * @brief Function to find the first element equal to specific data
+ * provided by user in expected O(log n). It uses cmp function provided
+ * by user at the creation of the skip list.
+ *
+ * @param list a skip list object
+ * @param data pointer to a typed data
+ * @return const void* `NULL` if data is not found or a pointer
+ * to a skip list node data containing given data
+ */
+const void* skip_list_find_data(const skip_list_t * const __restrict__ list, const void * const __restrict__ data) {
+    /* Check if list and data are valid */
+    if ((NULL == list) || (NULL == data)) {
+        return NULL;
+    }
+
+    const skip_list_node_t * const found = skip_list_lower_bound(list, data, NULL, NULL)->links[0].next;
+
+    /* Return a pointer to node data or `NULL` */
+    if ((NULL != found) && (0 == list->cmp(found->data, data))) {
+        return found->data;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to compute the rank of a data, the number of elements
+ * of the list smaller than data. If data is in the list the rank is the
+ * index of its first occurrence, otherwise it is the index where data
+ * would be inserted.
+ *
+ * @param list a skip list object
+ * @param data pointer to a typed data
+ * @return size_t rank of the data or SIZE_MAX if input is not valid
+ */
+size_t skip_list_rank(const skip_list_t * const __restrict__ list, const void * const __restrict__ data) {
+    /* Check if list and data are valid */
+    if ((NULL == list) || (NULL == data)) {
+        return SIZE_MAX;
+    }
+
+    size_t rank = 0;
+    skip_list_lower_bound(list, data, NULL, &rank);
+
+    return rank;
+}
+
+/**
+ * @brief Function to unlink a node and free it. The spans of the links
+ * that jumped over the node are decreased.
+ *
+ * @param list an allocated skip list object
+ * @param node node to delete
+ * @param update nodes before the node on every level in use
+ */
+static void skip_list_delete_node(skip_list_t * const __restrict__ list, skip_list_node_t * const __restrict__ node, skip_list_node_t ** const __restrict__ update) {
+    for (size_t iter = 0; iter < list->level; ++iter) {
+        if (update[iter]->links[iter].next == node) {
+            update[iter]->links[iter].span += node->links[iter].span - 1;
+            update[iter]->links[iter].next = node->links[iter].next;
+        } else {
+            --(update[iter]->links[iter].span);
+        }
+    }
+
+    if (list->tail == node) {
+        list->tail = (update[0] == list->head) ? NULL : update[0];
+    }
+
+    /* Drop the empty levels */
+    while ((list->level > 1) && (NULL == list->head->links[list->level - 1].next)) {
+        --(list->level);
+    }
+
+    /* Free content of data */
+    if (NULL != list->frd) {
+        list->frd(node->data);
+    }
+
+    scl_free(list->allocator, node);
+
+    /* Decrease list size */
+    --(list->size);
+}
+
+/**
+ * @brief Function to delete the first element equal to a data in
+ * expected O(log n). Data pointer has to be valid and to exist in the
+ * current list.
+ *
+ * @param list a skip list object
+ * @param data a pointer to a typed data to be removed
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t skip_list_delete_data(skip_list_t * const __restrict__ list, const void * const __restrict__ data) {
+    /* Check if list is allocated and it is not empty */
+    if (NULL == list) {
+        return SCL_NULL_SKIP_LIST;
+    }
+
+    if (0 == list->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    skip_list_node_t *update[SKIP_LIST_MAX_LEVEL];
+    skip_list_node_t * const found = skip_list_lower_bound(list, data, update, NULL)->links[0].next;
+
+    /* List does not contain such element */
+    if ((NULL == found) || (0 != list->cmp(found->data, data))) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    skip_list_delete_node(list, found, update);
+
+    /* Deletion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to delete an element based on an index (its rank) in
+ * expected O(log n). If data_index is bigger than actual size of the list
+ * then function will fail its execution and will return an error.
+ *
+ * @param list a skip list object
+ * @param data_index element index in the list to be removed starts from 0
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t skip_list_delete_index(skip_list_t * const __restrict__ list, size_t data_index) {
+    /* Check if list is allocated and it is not empty */
+    if (NULL == list) {
+        return SCL_NULL_SKIP_LIST;
+    }
+
+    if (0 == list->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (data_index >= list->size) {
+        return SCL_INDEX_OVERFLOWS_SIZE;
+    }
+
+    skip_list_node_t *update[SKIP_LIST_MAX_LEVEL];
+    skip_list_node_t * const found = skip_list_before_index(list, data_index, update)->links[0].next;
+
+    skip_list_delete_node(list, found, update);
+
+    /* Deletion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to traverse all list in order and do action on
+ * all data nodes.
+ *
+ * @param list a skip list object
+ * @param action a pointer to an action function(can be also a mapping func)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t skip_list_traverse(const skip_list_t * const __restrict__ list, action_func action) {
+    /*
+     * Check if list is allocated
+     * Check if user provided a valid map function
+     */
+    if (NULL == list) {
+        return SCL_NULL_SKIP_LIST;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    if (0 == list->size) {
+        printf("[ ]\n");
+    } else {
+        const skip_list_node_t *iterator = list->head->links[0].next;
+
+        while (NULL != iterator) {
+
+            /* Call the action function */
+            action(iterator->data);
+
+            iterator = iterator->links[0].next;
+        }
+    }
+
+    return SCL_OK;
+}
@@ -23,7 +23,6 @@
  */
 
 #include "./include/scl_sort_algo.h"
-#include "./include/scl_queue.h"
 
 /**
  * @brief Function to swap bytes between two
@@ -52,86 +51,242 @@ static void swap_array_nodes(void * __restrict__ first_node, void * __restrict__
 }
 
 /**
- * @brief Function to arrange elements less and greater than selected
- * pivot to its left and right and then to return pointer to the new
- * location of the pivot.
+ * @brief Ranges with at most this number of elements are sorted
+ * by insertion sort (by quick sort and merge sort), and ranges with
+ * at least the ninther number of elements select the quick sort pivot
+ * as a median of three medians.
  * 
- * @param arr_left pointer to the most left element from an array
- * @param arr_right pointer to the most right element from an array
+ */
+#define QUICK_SORT_INSERTION_CUTOFF 16
+#define QUICK_SORT_NINTHER_CUTOFF 128
+
+/**
+ * @brief Function to sort a small range of an array by insertion
+ * sort, swapping every element to the left until its place is found.
+ * Equal elements are never swapped, so the sort is stable.
+ * 
+ * @param arr_left pointer to the first element of the range
+ * @param number_of_elem number of elements of the range
  * @param arr_elem_size size of one element from selected array
  * @param cmp pointer to a function to compare two sets of data from array
- * @return void* pointer to the pivot element after reshaping array
+ * @param kind kind of the elements, a constant in every dispatched copy
  */
-static void* quick_sort_partition(void *arr_left, void *arr_right, size_t arr_elem_size, compare_func cmp) {
-    /* Set swap pointer and pivot pointer*/
-    uint8_t *next_pivot_ptr = arr_left;
-    uint8_t *pivot_ptr = arr_right;
+static SCL_ALWAYS_INLINE void sort_range_insertion_kind(uint8_t *arr_left, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind) {
+    uint8_t *arr_end = arr_left + number_of_elem * arr_elem_size;
 
-    /* Flag to check if two data were swapped */
-    uint8_t was_first_swap = 0;
+    for (uint8_t *iter_i = arr_left + arr_elem_size; iter_i < arr_end; iter_i += arr_elem_size) {
+        for (uint8_t *iter_j = iter_i; (iter_j > arr_left) && (scl_key_compare(kind, cmp, arr_elem_size, iter_j - arr_elem_size, iter_j) >= 1); iter_j -= arr_elem_size) {
+            swap_array_nodes(iter_j - arr_elem_size, iter_j, arr_elem_size);
+        }
+    }
+}
 
-    /* Reshape array */
-    for (uint8_t *iter = next_pivot_ptr; iter < pivot_ptr; iter = iter + arr_elem_size) {
-        if (cmp(iter, pivot_ptr) <= -1) {
-            if (0 == was_first_swap) {
-                was_first_swap = 1;
-            } else {
-                next_pivot_ptr = next_pivot_ptr + arr_elem_size;
-            }
-            
-            /* Swap next swap memory location with iterator pointer's location */
-            swap_array_nodes(next_pivot_ptr, iter, arr_elem_size);
+/* Sorts a small range with a constant kind of the elements */
+#define SORT_RANGE_INSERTION_KIND(kind) sort_range_insertion_kind(arr_left, number_of_elem, arr_elem_size, cmp, (kind))
+
+/**
+ * @brief Function to sort a small range of an array by insertion
+ * sort, the kind of the elements is dispatched once for the range.
+ * 
+ * @param arr_left pointer to the first element of the range
+ * @param number_of_elem number of elements of the range
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements (SCL_KEY_GENERIC calls cmp)
+ */
+static void sort_range_insertion(uint8_t *arr_left, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind) {
+    SCL_KEY_KIND_DISPATCH(kind, SORT_RANGE_INSERTION_KIND)
+}
+
+#undef SORT_RANGE_INSERTION_KIND
+
+/* Compares two elements of an array of a constant kind */
+#define SORT_CMP(first, second) scl_key_compare(kind, cmp, arr_elem_size, (first), (second))
+
+/**
+ * @brief Function to select the median of three elements.
+ * 
+ * @param first pointer to the first element
+ * @param second pointer to the second element
+ * @param third pointer to the third element
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements
+ * @return uint8_t* pointer to the median element
+ */
+static SCL_ALWAYS_INLINE uint8_t* quick_sort_median(uint8_t *first, uint8_t *second, uint8_t *third, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind) {
+    if (SORT_CMP(first, second) <= -1) {
+        if (SORT_CMP(second, third) <= -1) {
+            return second;
         }
+
+        return (SORT_CMP(first, third) <= -1) ? third : first;
+    }
+
+    if (SORT_CMP(first, third) <= -1) {
+        return first;
+    }
+
+    return (SORT_CMP(second, third) <= -1) ? third : second;
+}
+
+/**
+ * @brief Function to select a pivot from a range (median of three or
+ * ninther for big ranges), to copy it into the pivot buffer and to
+ * arrange the elements less and greater than the pivot to the left and
+ * right of a split point. Both scans stop on elements equal with the
+ * pivot, so arrays with many duplicates are split in balanced halves
+ * and the pivot is not moved, so sorted or reversed orders are kept
+ * and do not produce unbalanced splits later.
+ * 
+ * @param arr_left pointer to the first element of the range
+ * @param number_of_elem number of elements of the range
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements, a constant in every dispatched copy
+ * @param pivot buffer of one element for the pivot value
+ * @return uint8_t* pointer to the last element of the left part
+ */
+static SCL_ALWAYS_INLINE uint8_t* quick_sort_partition_kind(uint8_t *arr_left, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind, uint8_t *pivot) {
+    uint8_t *arr_right = arr_left + (number_of_elem - 1) * arr_elem_size;
+    uint8_t *arr_middle = arr_left + (number_of_elem / 2) * arr_elem_size;
+
+    /* Select the pivot, at least one more element ranks as high as it so both parts are not empty */
+    if (number_of_elem >= QUICK_SORT_NINTHER_CUTOFF) {
+        const size_t step = (number_of_elem / 8) * arr_elem_size;
+
+        memcpy(pivot, quick_sort_median(
+            quick_sort_median(arr_left, arr_left + step, arr_left + 2 * step, arr_elem_size, cmp, kind),
+            quick_sort_median(arr_middle - step, arr_middle, arr_middle + step, arr_elem_size, cmp, kind),
+            quick_sort_median(arr_right - 2 * step, arr_right - step, arr_right, arr_elem_size, cmp, kind),
+            arr_elem_size, cmp, kind
+        ), arr_elem_size);
+    } else {
+        memcpy(pivot, quick_sort_median(arr_left, arr_middle, arr_right, arr_elem_size, cmp, kind), arr_elem_size);
     }
 
-    /* Swap pivot to it's position and return pointer to pivot location */
-    if (0 == was_first_swap) {
-        swap_array_nodes(next_pivot_ptr, pivot_ptr, arr_elem_size);
+    /* Reshape range around the pivot value, the scans cannot pass the ends of the range */
+    uint8_t *iter_i = arr_left;
+    uint8_t *iter_j = arr_right;
+
+    for (;;) {
+        while (SORT_CMP(iter_i, pivot) <= -1) {
+            iter_i += arr_elem_size;
+        }
+
+        while (SORT_CMP(iter_j, pivot) >= 1) {
+            iter_j -= arr_elem_size;
+        }
+
+        if (iter_i >= iter_j) {
+            return iter_j;
+        }
+
+        swap_array_nodes(iter_i, iter_j, arr_elem_size);
 
-        return next_pivot_ptr;
+        iter_i += arr_elem_size;
+        iter_j -= arr_elem_size;
     }
-        
-    swap_array_nodes(next_pivot_ptr + arr_elem_size, pivot_ptr, arr_elem_size);
-    
-    return next_pivot_ptr + arr_elem_size;
 }
 
+#undef SORT_CMP
+
+/* Partitions a range with a constant kind of the elements */
+#define QUICK_SORT_PARTITION_KIND(kind) return quick_sort_partition_kind(arr_left, number_of_elem, arr_elem_size, cmp, (kind), pivot)
+
 /**
- * @brief Helper function for quick_sort procedure to sort recursevily,
- * the elements of the array. 
+ * @brief Function to partition a range around a pivot value, the
+ * kind of the elements is dispatched once for the whole partition.
  * 
- * @param arr_left pointer to the most left element from an array
- * @param arr_right pointer to the most right element from an array
+ * @param arr_left pointer to the first element of the range
+ * @param number_of_elem number of elements of the range
  * @param arr_elem_size size of one element from selected array
  * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements (SCL_KEY_GENERIC calls cmp)
+ * @param pivot buffer of one element for the pivot value
+ * @return uint8_t* pointer to the last element of the left part
  */
-static void quick_sort_helper(void *arr_left, void *arr_right, size_t arr_elem_size, compare_func cmp) {
-    /* Set left and right pointers */
-    uint8_t *left_ptr = arr_left;
-    uint8_t *right_ptr = arr_right;
+static uint8_t* quick_sort_partition(uint8_t *arr_left, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind, uint8_t *pivot) {
+    SCL_KEY_KIND_DISPATCH(kind, QUICK_SORT_PARTITION_KIND)
+}
+
+#undef QUICK_SORT_PARTITION_KIND
+
+/**
+ * @brief Function to compute the number of partitions allowed before
+ * quick sort or selection fall back to heap sort, 2 * log2(N).
+ * 
+ * @param number_of_elem number of elements within the array
+ * @return size_t the depth limit of the partitions
+ */
+static size_t quick_sort_depth_limit(size_t number_of_elem) {
+    size_t depth_limit = 0;
 
-    /* Check if sorting may happen */
-    if (left_ptr < right_ptr) {
+    for (size_t iter = number_of_elem; iter > 1; iter >>= 1) {
+        depth_limit += 2;
+    }
 
-        /* Get pivot pointer */
-        uint8_t *partition_ptr = quick_sort_partition(left_ptr, right_ptr, arr_elem_size, cmp);
+    return depth_limit;
+}
 
-        /* Sort left part (smaller than pivot) */
-        if (partition_ptr > left_ptr) {
-            quick_sort_helper(left_ptr, partition_ptr - arr_elem_size, arr_elem_size, cmp); 
+/**
+ * @brief Helper function for quick_sort procedure (introsort). The
+ * smaller part of every partition is sorted recursively and the bigger
+ * one in a loop, so the stack depth is O(logN). Small ranges are sorted
+ * by insertion sort and if the depth limit is reached the range is sorted
+ * by heap sort, so the worst case is O(NlogN).
+ * 
+ * @param arr_left pointer to the first element of the range
+ * @param number_of_elem number of elements of the range
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements (SCL_KEY_GENERIC calls cmp)
+ * @param depth_limit number of partitions left before falling back to heap sort
+ * @param pivot buffer of one element for the pivot value
+ */
+static void quick_sort_helper(uint8_t *arr_left, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind, size_t depth_limit, uint8_t *pivot) {
+    while (number_of_elem > QUICK_SORT_INSERTION_CUTOFF) {
+
+        /* Too many bad pivots, heap_sort sorts descending (in place) so reverse its output */
+        if (0 == depth_limit) {
+            heap_sort(arr_left, number_of_elem, arr_elem_size, cmp);
+            reverse_array(arr_left, number_of_elem, arr_elem_size);
+            return;
         }
-        
-        /* Sort right part (greater than pivot) */
-        if (partition_ptr < right_ptr) {
-            quick_sort_helper(partition_ptr + arr_elem_size, right_ptr, arr_elem_size, cmp); 
+
+        --depth_limit;
+
+        /* Get the split point */
+        uint8_t *partition_ptr = quick_sort_partition(arr_left, number_of_elem, arr_elem_size, cmp, kind, pivot);
+
+        const size_t left_elems = (size_t)(partition_ptr - arr_left) / arr_elem_size + 1;
+        const size_t right_elems = number_of_elem - left_elems;
+
+        /* Recurse on the smaller part and loop on the bigger one */
+        if (left_elems < right_elems) {
+            quick_sort_helper(arr_left, left_elems, arr_elem_size, cmp, kind, depth_limit, pivot);
+
+            arr_left = partition_ptr + arr_elem_size;
+            number_of_elem = right_elems;
+        } else {
+            quick_sort_helper(partition_ptr + arr_elem_size, right_elems, arr_elem_size, cmp, kind, depth_limit, pivot);
+
+            number_of_elem = left_elems;
         }
     }
+
+    /* Sort the small range left */
+    sort_range_insertion(arr_left, number_of_elem, arr_elem_size, cmp, kind);
 }
 
 /**
  * @brief Function to sort a continuous memory location
  * represented as an array statically or dynamically allocated
- * by quick sorting algorithm.
+ * by quick sorting algorithm (introsort: median of three or ninther
+ * pivots, insertion sort for small ranges and heap sort if the
+ * partitions are too unbalanced, so O(NlogN) in the worst case).
+ * If cmp is a compare function of the library for integers or strings
+ * the elements are compared inline, without calling cmp.
  * 
  * @param arr an array of any type to sort its elements
  * @param number_of_elem number of elements within the selected array
@@ -160,148 +315,118 @@ scl_error_t quick_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, c
         return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
     }
 
-    /* Call helper function */
-    quick_sort_helper(arr, (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size, arr_elem_size, cmp);
+    /* Allocate the buffer of the pivot value once for the whole sort */
+    uint8_t *pivot = scl_malloc(scl_get_allocator(), arr_elem_size);
+
+    if (NULL == pivot) {
+        errno = ENOMEM;
+        perror("Not enough memory for quick sort pivot");
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* Compare functions of the library with a known kind are done inline */
+    quick_sort_helper(arr, number_of_elem, arr_elem_size, cmp, scl_key_kind_of(cmp, arr_elem_size), quick_sort_depth_limit(number_of_elem), pivot);
+
+    scl_free(scl_get_allocator(), pivot);
 
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function two merge two subarrays into one big sorted array.
+ * @brief Function to merge two sorted ranges into the destination
+ * array. If two elements are equal the one from the left range is
+ * taken first (stable merge).
  * 
- * @param arr_left pointer to the most left element from an array
- * @param arr_middle pointer to the middle element from an array
- * @param arr_right pointer to the most right element from an array
+ * @param left pointer to the first element of the left range
+ * @param left_elems number of elements of the left range
+ * @param right pointer to the first element of the right range
+ * @param right_elems number of elements of the right range
+ * @param dst pointer to the destination of the merged ranges
  * @param arr_elem_size size of one element from selected array
  * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements, a constant in every dispatched copy
  */
-static void merge(void *arr_left, void *arr_middle, void *arr_right, size_t arr_elem_size, compare_func cmp) {
-    /* Compute sizes of first and second subarray */
-    size_t left_subarray_size = ((uint8_t *)arr_middle - (uint8_t *)arr_left) + arr_elem_size;
-    size_t right_subarray_size = ((uint8_t *)arr_right - (uint8_t *)arr_middle);
-
-    /* Allocate on heap left and right subarray */
-    uint8_t *left_subarray = malloc(left_subarray_size);
-    uint8_t *right_subarray = malloc(right_subarray_size);
-
-    /* Check if subarrays were allocated successfully */
-    if (NULL != left_subarray) {
-        uint8_t *temp_left_subarray = left_subarray;
-
-        if (NULL != right_subarray) {
-            uint8_t *temp_right_subarray = right_subarray;
-
-            /* Set the elements of the subarrays */
-            memcpy(left_subarray, arr_left, left_subarray_size);
-            memcpy(right_subarray, (uint8_t *)arr_middle + arr_elem_size, right_subarray_size);
-
-            /* Compute the numbers of the elements from each subarray */
-            left_subarray_size /= arr_elem_size;
-            right_subarray_size /= arr_elem_size;
-
-            size_t iter_i = 0;
-            size_t iter_j = 0;
-
-            /* Merge data from both subarrays into one array */
-            while ((iter_i < left_subarray_size) && (iter_j < right_subarray_size)) {
-
-                /* Check if left element should be added into big array or the right element */
-                if (cmp(left_subarray, right_subarray) <= 0) {
-
-                    /* Copy data to big array */
-                    memcpy(arr_left, left_subarray, arr_elem_size);
-                    
-                    /* Increment to the next position */
-                    arr_left = (uint8_t *)arr_left + arr_elem_size;
-                    left_subarray = left_subarray + arr_elem_size;
-                    
-                    ++iter_i;
-                } else {
-
-                    /* Copy data to big array */
-                    memcpy(arr_left, right_subarray, arr_elem_size);
-                    
-                    /* Increment to the next position */
-                    arr_left = (uint8_t *)arr_left + arr_elem_size;
-                    right_subarray = right_subarray + arr_elem_size;
-                    
-                    ++iter_j;
-                }
-            }
-
-            /* Copy rest of elements from first subarray to big sorted array */
-            while (iter_i < left_subarray_size) {
-
-                /* Copy data to big array */
-                memcpy(arr_left, left_subarray, arr_elem_size);
-                
-                /* Increment to the next position */
-                arr_left = (uint8_t *)arr_left + arr_elem_size;
-                left_subarray = left_subarray + arr_elem_size;
-                
-                ++iter_i;
-            }
-
-            /* Copy rest of the elements from second subarrat to big sorted array */
-            while (iter_j < right_subarray_size) {
-
-                /* Copy data to big array */
-                memcpy(arr_left, right_subarray, arr_elem_size);
-                
-                /* Increment to the next position */
-                arr_left = (uint8_t *)arr_left + arr_elem_size;
-                right_subarray = right_subarray + arr_elem_size;
-                
-                ++iter_j;
-            }
-
-            /* Free right subarray from memory */
-            free(temp_right_subarray); 
+static SCL_ALWAYS_INLINE void merge_kind(const uint8_t *left, size_t left_elems, const uint8_t *right, size_t right_elems, uint8_t *dst, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind) {
+    const uint8_t *left_end = left + left_elems * arr_elem_size;
+    const uint8_t *right_end = right + right_elems * arr_elem_size;
+
+    /* Merge data from both ranges */
+    while ((left < left_end) && (right < right_end)) {
+        if (scl_key_compare(kind, cmp, arr_elem_size, left, right) <= 0) {
+            memcpy(dst, left, arr_elem_size);
+            left += arr_elem_size;
+        } else {
+            memcpy(dst, right, arr_elem_size);
+            right += arr_elem_size;
         }
 
-        /* Free left subarray from memory */
-        free(temp_left_subarray);
+        dst += arr_elem_size;
     }
+
+    /* Copy the rest of the elements of the range that is not finished */
+    memcpy(dst, left, (size_t)(left_end - left));
+    dst += left_end - left;
+
+    memcpy(dst, right, (size_t)(right_end - right));
 }
 
+/* Merges two ranges with a constant kind of the elements */
+#define MERGE_KIND(kind) merge_kind(left, left_elems, right, right_elems, dst, arr_elem_size, cmp, (kind))
+
 /**
- * @brief Helper function for merge_sort procedure to sort recursevily,
- * the elements of the array. 
+ * @brief Function to merge two sorted ranges into the destination
+ * array, the kind of the elements is dispatched once for the merge.
  * 
- * @param arr_left pointer to the most left element from an array
- * @param arr_right pointer to the most right element from an array
+ * @param left pointer to the first element of the left range
+ * @param left_elems number of elements of the left range
+ * @param right pointer to the first element of the right range
+ * @param right_elems number of elements of the right range
+ * @param dst pointer to the destination of the merged ranges
  * @param arr_elem_size size of one element from selected array
  * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements (SCL_KEY_GENERIC calls cmp)
  */
-static void merge_sort_helper(void *arr_left, void *arr_right, size_t arr_elem_size, compare_func cmp) {
-    /* Set left and right pointers */
-    uint8_t *left_ptr = arr_left;
-    uint8_t *right_ptr = arr_right;
+static void merge(const uint8_t *left, size_t left_elems, const uint8_t *right, size_t right_elems, uint8_t *dst, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind) {
+    SCL_KEY_KIND_DISPATCH(kind, MERGE_KIND)
+}
 
-    /* Check if sorting may happen */
-    if (left_ptr < right_ptr) {
+#undef MERGE_KIND
 
-        /* Compute middle pointer */
-        uint8_t *middle_ptr = left_ptr + arr_elem_size * ((right_ptr - left_ptr) / (2 * arr_elem_size));
+/**
+ * @brief Helper function for merge_sort procedure to sort recursevily,
+ * the elements of the array. The source and the destination hold the
+ * same elements, the halves are sorted from the destination into the
+ * source and then merged back into the destination, so the roles of the
+ * two arrays alternate between levels and no half is copied out.
+ * 
+ * @param src pointer to the range holding the same elements as dst
+ * @param dst pointer to the range that will hold the sorted elements
+ * @param number_of_elem number of elements of the range
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements (SCL_KEY_GENERIC calls cmp)
+ */
+static void merge_sort_helper(uint8_t *src, uint8_t *dst, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind) {
+    /* Sort small ranges in place */
+    if (number_of_elem <= QUICK_SORT_INSERTION_CUTOFF) {
+        sort_range_insertion(dst, number_of_elem, arr_elem_size, cmp, kind);
+        return;
+    }
 
-        /* Sort left subarray */
-        merge_sort_helper(left_ptr, middle_ptr, arr_elem_size, cmp);
+    const size_t left_elems = number_of_elem / 2;
+    const size_t offset = left_elems * arr_elem_size;
 
-        /* Sort right subarray */
-        if (middle_ptr < right_ptr) {
-            merge_sort_helper(middle_ptr + arr_elem_size, right_ptr, arr_elem_size, cmp);
-        }
+    /* Sort both halves into the source */
+    merge_sort_helper(dst, src, left_elems, arr_elem_size, cmp, kind);
+    merge_sort_helper(dst + offset, src + offset, number_of_elem - left_elems, arr_elem_size, cmp, kind);
 
-        /* Merge all subarrays recursively until get while array */
-        merge(left_ptr, middle_ptr, right_ptr, arr_elem_size, cmp);
-    }
+    /* Merge the halves back into the destination */
+    merge(src, left_elems, src + offset, number_of_elem - left_elems, dst, arr_elem_size, cmp, kind);
 }
 
 /**
- * @brief Function to sort a continuous memory location
- * represented as an array statically or dynamically allocated
- * by merge sorting algorithm. 
+ * @brief Function to check the input of the merge sorting functions.
  * 
  * @param arr an array of any type to sort its elements
  * @param number_of_elem number of elements within the selected array
@@ -309,9 +434,9 @@ static void merge_sort_helper(void *arr_left, void *arr_right, size_t arr_elem_s
  * @param cmp pointer to a function to compare two sets of data from array
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t merge_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
-    /* Check if most left pointer and most right pointer of the array are valid */
-    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
+static scl_error_t merge_sort_check(const void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    /* Check if array is valid */
+    if (NULL == arr) {
         return SCL_NULL_SIMPLE_ARRAY;
     }
 
@@ -330,9 +455,6 @@ scl_error_t merge_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, c
         return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
     }
 
-    /* Call helper function */
-    merge_sort_helper(arr, (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size, arr_elem_size, cmp);
-
     /* All good */
     return SCL_OK;
 }
@@ -340,7 +462,8 @@ scl_error_t merge_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, c
 /**
  * @brief Function to sort a continuous memory location
  * represented as an array statically or dynamically allocated
- * by bubble sorting algorithm.
+ * by merge sorting algorithm (stable). The function allocates
+ * one scratch buffer of the size of the array for the whole sort.
  * 
  * @param arr an array of any type to sort its elements
  * @param number_of_elem number of elements within the selected array
@@ -348,57 +471,138 @@ scl_error_t merge_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, c
  * @param cmp pointer to a function to compare two sets of data from array
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t bubble_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
-    /* Check if most left pointer and most right pointer of the array are valid */
-    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
-        return SCL_NULL_SIMPLE_ARRAY;
+scl_error_t merge_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    return merge_sort_buffered(arr, number_of_elem, arr_elem_size, cmp, NULL);
+}
+
+/**
+ * @brief Function to sort an array by the top-down merge sorting
+ * algorithm (stable) using a workspace supplied by the caller, so
+ * sorting many arrays does not call the allocator at all. The
+ * workspace must hold at least number_of_elem elements and must not
+ * overlap the array, if it is `NULL` one buffer is allocated for the
+ * whole sort.
+ * 
+ * @param arr an array of any type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param workspace scratch memory of number_of_elem elements or `NULL`
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t merge_sort_buffered(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, void *workspace) {
+    scl_error_t err = merge_sort_check(arr, number_of_elem, arr_elem_size, cmp);
+
+    if (SCL_OK != err) {
+        return err;
     }
 
-    /* Check if there are elements to sort */
-    if (0 == number_of_elem) {
-        return SCL_NUMBER_OF_ELEMS_ZERO;
+    /* Allocate the scratch buffer just if the caller did not supply one */
+    uint8_t *buffer = workspace;
+
+    if (NULL == buffer) {
+        buffer = scl_malloc(scl_get_allocator(), number_of_elem * arr_elem_size);
+
+        if (NULL == buffer) {
+            errno = ENOMEM;
+            perror("Not enough memory for merge sort buffer");
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
     }
 
-    /* Check if the size of one element is valid */
-    if (0 == arr_elem_size) {
-        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    /* Both arrays start with the same elements */
+    memcpy(buffer, arr, number_of_elem * arr_elem_size);
+
+    /* Call helper function */
+    merge_sort_helper(buffer, arr, number_of_elem, arr_elem_size, cmp, scl_key_kind_of(cmp, arr_elem_size));
+
+    if (NULL == workspace) {
+        scl_free(scl_get_allocator(), buffer);
     }
 
-    /* Check if comparision function is valid */
-    if (NULL == cmp) {
-        return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to sort an array by the bottom-up merge sorting
+ * algorithm (stable). Runs of 16 elements are sorted by insertion sort
+ * and then merged by doubling widths, alternating the array and the
+ * workspace as source and destination, so the function never recurses.
+ * The workspace must hold at least number_of_elem elements and must not
+ * overlap the array, if it is `NULL` one buffer is allocated for the
+ * whole sort.
+ * 
+ * @param arr an array of any type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param workspace scratch memory of number_of_elem elements or `NULL`
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t merge_sort_bottom_up(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, void *workspace) {
+    scl_error_t err = merge_sort_check(arr, number_of_elem, arr_elem_size, cmp);
+
+    if (SCL_OK != err) {
+        return err;
     }
 
-    /* Set pointer to the last array element */
-    uint8_t *arr_end = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
+    /* Compare functions of the library with a known kind are done inline */
+    const scl_key_kind_t kind = scl_key_kind_of(cmp, arr_elem_size);
 
-    /* Set flag to check if data swapping occured */
-    uint8_t swap_flag = 0;
+    /* Sort the first runs in place */
+    for (size_t iter = 0; iter < number_of_elem; iter += QUICK_SORT_INSERTION_CUTOFF) {
+        const size_t run_elems = (number_of_elem - iter < QUICK_SORT_INSERTION_CUTOFF) ? (number_of_elem - iter) : QUICK_SORT_INSERTION_CUTOFF;
 
-    /* Sort array */
-    for (uint8_t *iter_i = arr; iter_i < arr_end; iter_i = iter_i + arr_elem_size) {
-        
-        /* Set swap flag as false */
-        swap_flag = 0;
+        sort_range_insertion((uint8_t *)arr + iter * arr_elem_size, run_elems, arr_elem_size, cmp, kind);
+    }
 
-        /* Compute new last element pointer form array */
-        uint8_t *second_arr_end = (uint8_t *)arr + (arr_end - iter_i);
-        
-        /* Check bubbles */
-        for (uint8_t *iter_j = arr; iter_j < second_arr_end; iter_j = iter_j + arr_elem_size) {
-            if (cmp(iter_j, iter_j + arr_elem_size) >= 1) {
+    /* One run is already sorted */
+    if (number_of_elem <= QUICK_SORT_INSERTION_CUTOFF) {
+        return SCL_OK;
+    }
 
-                /* Swap bubbles */
-                swap_array_nodes(iter_j, iter_j + arr_elem_size, arr_elem_size);
+    /* Allocate the scratch buffer just if the caller did not supply one */
+    uint8_t *buffer = workspace;
 
-                swap_flag = 1;
-            }
+    if (NULL == buffer) {
+        buffer = scl_malloc(scl_get_allocator(), number_of_elem * arr_elem_size);
+
+        if (NULL == buffer) {
+            errno = ENOMEM;
+            perror("Not enough memory for merge sort buffer");
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
         }
+    }
 
-        /* No swap occured so array is already sorted */
-        if (0 == swap_flag) {
-            break;
+    uint8_t *src = arr;
+    uint8_t *dst = buffer;
+
+    /* Merge pairs of runs, doubling the width at every pass */
+    for (size_t width = QUICK_SORT_INSERTION_CUTOFF; width < number_of_elem; width *= 2) {
+        for (size_t iter = 0; iter < number_of_elem; iter += 2 * width) {
+            const size_t left_elems = (number_of_elem - iter < width) ? (number_of_elem - iter) : width;
+            const size_t rest_elems = number_of_elem - iter - left_elems;
+            const size_t right_elems = (rest_elems < width) ? rest_elems : width;
+
+            uint8_t *left = src + iter * arr_elem_size;
+
+            merge(left, left_elems, left + left_elems * arr_elem_size, right_elems, dst + iter * arr_elem_size, arr_elem_size, cmp, kind);
         }
+
+        /* The destination of this pass is the source of the next one */
+        uint8_t *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    /* Copy the sorted elements back if the last pass merged into the buffer */
+    if (src != arr) {
+        memcpy(arr, src, number_of_elem * arr_elem_size);
+    }
+
+    if (NULL == workspace) {
+        scl_free(scl_get_allocator(), buffer);
     }
 
     /* All good */
@@ -406,335 +610,2494 @@ scl_error_t bubble_sort(void *arr, size_t number_of_elem, size_t arr_elem_size,
 }
 
 /**
- * @brief 
+ * @brief Runs shorter than the minimum run computed from this value are
+ * extended by insertion sort, the galloping mode starts after this
+ * number of consecutive elements taken from the same run and the stack
+ * of pending runs cannot grow past the maximum (enough for 2^64 elements).
  * 
- * @param arr 
- * @param number_of_elem 
- * @return uint64_t 
  */
-static uint64_t maximum_array_element(uint64_t *arr, size_t number_of_elem){
-	uint64_t max_elem = arr[0];
-
-	for (size_t iter_i = 1; iter_i < number_of_elem; ++iter_i) {
-		if(arr[iter_i] > max_elem) {
-			max_elem = arr[iter_i];
-        }
-	}
-
-	return max_elem;
-}
+#define TIM_SORT_MIN_MERGE 32
+#define TIM_SORT_MIN_GALLOP 7
+#define TIM_SORT_MAX_RUNS 85
 
 /**
- * @brief Get the count of the digits from a whole number
+ * @brief One sorted run of the array waiting to be merged
  * 
- * @param number whole number to count its digits
- * @return size_t count of digits from selected number
  */
-static size_t get_whole_number_digits(uint64_t number) {
-    /* Initialize digits count */
-    size_t number_digits = 0;
+typedef struct tim_sort_run_s {
+    uint8_t *base;                                              /* First element of the run */
+    size_t length;                                              /* Number of elements of the run */
+} tim_sort_run_t;
 
-    /* Compute digits count */
-	while (0 != number) {
-		number /= 10;
-		++number_digits;
-	}
-
-    /* Return digits count */
-	return number_digits;
-}
+/**
+ * @brief State of one tim sort, shared by all the merges
+ * 
+ */
+typedef struct tim_sort_state_s {
+    uint8_t *buffer;                                            /* Scratch buffer holding the smaller run of a merge */
+    size_t arr_elem_size;                                       /* Size of one element of the sorted array */
+    compare_func cmp;                                           /* Function to compare two elements */
+    scl_key_kind_t kind;                                        /* Kind of the elements (SCL_KEY_GENERIC calls cmp) */
+    size_t min_gallop;                                          /* Current threshold of the galloping mode */
+    size_t number_of_runs;                                      /* Number of pending runs */
+    tim_sort_run_t runs[TIM_SORT_MAX_RUNS];                     /* Stack of pending runs */
+} tim_sort_state_t;
+
+/* Checks if the first element ranks strictly lower than the second one, kind is a constant */
+#define TIM_SORT_LESS(first, second) (scl_key_compare(kind, state->cmp, state->arr_elem_size, (first), (second)) <= -1)
+
+/* Returns the address of one element of a range */
+#define TIM_SORT_AT(base, index) ((base) + (index) * state->arr_elem_size)
 
 /**
- * @brief Function to get the digit from a number
- * at a specified position in the input data
+ * @brief Function to compute the minimum length of a run, so that the
+ * number of runs is a power of two or a bit less and the merges stay
+ * balanced. MUST not be used outside this file.
  * 
- * @param number whole number to extract one digit
- * @param digit_pos position of the digit from the number
- * @return uint64_t extracted digit from the number
+ * @param number_of_elem number of elements within the array
+ * @return size_t minimum length of a run
  */
-static uint64_t get_whole_number_digit(uint64_t number, size_t digit_pos) {
-    /* Initialize digit from number as 0 */
-	int number_digit = 0;
+static size_t tim_sort_min_run(size_t number_of_elem) {
+    size_t rest = 0;
 
-    /* Extract digit from number */
-	while(digit_pos-- > 0){
-		number_digit = number % 10;
-		number /= 10;
-	}
+    while (number_of_elem >= TIM_SORT_MIN_MERGE) {
+        rest |= number_of_elem & 1;
+        number_of_elem >>= 1;
+    }
 
-    /* Return extracted digit */
-	return number_digit;
+    return number_of_elem + rest;
 }
 
 /**
- * @brief Function to sort a continuous memory location
- * represented as an array statically or dynamically allocated
- * by radix sorting algorithm.
+ * @brief Function to find the length of the run starting at the first
+ * element of a range. A strictly descending run is reversed in place (so
+ * equal elements never change their order) and then both kinds of runs
+ * are ascending. MUST not be used outside this file.
  * 
- * @param arr an array of uint64_t type to sort its elements
- * @param number_of_elem number of elements within the selected array
- * @return scl_error_t enum object for handling errors
+ * @param state state of the tim sort
+ * @param arr_left pointer to the first element of the range
+ * @param number_of_elem number of elements of the range, at least 2
+ * @param kind kind of the elements, a constant in every dispatched copy
+ * @return size_t number of elements of the run
  */
-scl_error_t radix_sort(uint64_t *arr, size_t number_of_elem) {
-    /* Check if most left pointer and most right pointer of the array are valid */
-    if ((NULL == arr) || (NULL == arr + number_of_elem - 1)) {
-        return SCL_NULL_SIMPLE_ARRAY;
-    }
+static SCL_ALWAYS_INLINE size_t tim_sort_count_run_kind(const tim_sort_state_t * const state, uint8_t *arr_left, size_t number_of_elem, scl_key_kind_t kind) {
+    size_t run_elems = 2;
 
-    /* Check if there are elements to sort */
-    if (0 == number_of_elem) {
-        return SCL_NUMBER_OF_ELEMS_ZERO;
+    if (TIM_SORT_LESS(TIM_SORT_AT(arr_left, 1), arr_left)) {
+        while ((run_elems < number_of_elem) && TIM_SORT_LESS(TIM_SORT_AT(arr_left, run_elems), TIM_SORT_AT(arr_left, run_elems - 1))) {
+            ++run_elems;
+        }
+
+        reverse_array(arr_left, run_elems, state->arr_elem_size);
+    } else {
+        while ((run_elems < number_of_elem) && !TIM_SORT_LESS(TIM_SORT_AT(arr_left, run_elems), TIM_SORT_AT(arr_left, run_elems - 1))) {
+            ++run_elems;
+        }
     }
 
-    /* Allocate ten queues for sorting */
-    queue_t **queues = malloc(sizeof(*queues) * 10);
+    return run_elems;
+}
 
-    /* Check if queues pointer was allocated */
-    if (NULL != queues) {
+/* Counts a run with a constant kind of the elements */
+#define TIM_SORT_COUNT_RUN_KIND(kind) return tim_sort_count_run_kind(state, arr_left, number_of_elem, (kind))
 
-        /* Create 10 queues */
-        for (size_t iter_i = 0; iter_i < 10; ++iter_i) {
-            
-            /* Create one queue from scl_queue.h */
-            queues[iter_i] = create_queue(NULL, sizeof(*arr));
+/**
+ * @brief Function to find the length of the run starting at the first
+ * element of a range, the kind of the elements is dispatched once for
+ * the run. MUST not be used outside this file.
+ * 
+ * @param state state of the tim sort
+ * @param arr_left pointer to the first element of the range
+ * @param number_of_elem number of elements of the range, at least 2
+ * @return size_t number of elements of the run
+ */
+static size_t tim_sort_count_run(const tim_sort_state_t * const state, uint8_t *arr_left, size_t number_of_elem) {
+    SCL_KEY_KIND_DISPATCH(state->kind, TIM_SORT_COUNT_RUN_KIND)
+    return number_of_elem;
+}
 
-            /* Check if current queue was created successully */
-            if (NULL == queues[iter_i]) {
-                return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+#undef TIM_SORT_COUNT_RUN_KIND
+
+/**
+ * @brief Function to extend a run to a longer range by binary insertion
+ * sort, every element is inserted after its equals so the sort stays
+ * stable. The buffer of the sort holds the inserted element while the
+ * greater ones are moved. MUST not be used outside this file.
+ * 
+ * @param state state of the tim sort
+ * @param arr_left pointer to the first element of the run
+ * @param sorted_elems number of elements of the run, already sorted
+ * @param number_of_elem number of elements of the extended run
+ * @param kind kind of the elements, a constant in every dispatched copy
+ */
+static SCL_ALWAYS_INLINE void tim_sort_extend_run_kind(const tim_sort_state_t * const state, uint8_t *arr_left, size_t sorted_elems, size_t number_of_elem, scl_key_kind_t kind) {
+    for (size_t iter = sorted_elems; iter < number_of_elem; ++iter) {
+        uint8_t *elem = TIM_SORT_AT(arr_left, iter);
+        size_t left = 0;
+        size_t right = iter;
+
+        /* Find the first element greater than the inserted one */
+        while (left < right) {
+            const size_t middle = left + ((right - left) >> 1);
+
+            if (TIM_SORT_LESS(elem, TIM_SORT_AT(arr_left, middle))) {
+                right = middle;
+            } else {
+                left = middle + 1;
             }
         }
+
+        if (right == iter) {
+            continue;
+        }
+
+        memcpy(state->buffer, elem, state->arr_elem_size);
+        memmove(TIM_SORT_AT(arr_left, right + 1), TIM_SORT_AT(arr_left, right), (iter - right) * state->arr_elem_size);
+        memcpy(TIM_SORT_AT(arr_left, right), state->buffer, state->arr_elem_size);
     }
+}
+
+/* Extends a run with a constant kind of the elements */
+#define TIM_SORT_EXTEND_RUN_KIND(kind) tim_sort_extend_run_kind(state, arr_left, sorted_elems, number_of_elem, (kind))
 
-    /* Find maximum element from current working array */
-    uint64_t max_elem = maximum_array_element(arr, number_of_elem);
+/**
+ * @brief Function to extend a run to a longer range by binary insertion
+ * sort, the kind of the elements is dispatched once for the run. MUST not
+ * be used outside this file.
+ * 
+ * @param state state of the tim sort
+ * @param arr_left pointer to the first element of the run
+ * @param sorted_elems number of elements of the run, already sorted
+ * @param number_of_elem number of elements of the extended run
+ */
+static void tim_sort_extend_run(const tim_sort_state_t * const state, uint8_t *arr_left, size_t sorted_elems, size_t number_of_elem) {
+    SCL_KEY_KIND_DISPATCH(state->kind, TIM_SORT_EXTEND_RUN_KIND)
+}
 
-    /* Compute number of digits of the maximum number */
-    size_t digits_count = get_whole_number_digits(max_elem);
+#undef TIM_SORT_EXTEND_RUN_KIND
 
-    /* Sort numbers*/
-    for (size_t iter_i = 1; iter_i <= digits_count; ++iter_i) {
+/**
+ * @brief Function to find the position of the first element of a sorted
+ * range that is not lower than a key (the key goes before its equals).
+ * The search gallops from a hint by offsets 1, 3, 7, ... and then
+ * finishes by binary search, so it takes O(log d) comparisons where d is
+ * the distance from the hint. MUST not be used outside this file.
+ * 
+ * @param state state of the tim sort
+ * @param key pointer to the key to place
+ * @param base pointer to the first element of the sorted range
+ * @param number_of_elem number of elements of the range, at least 1
+ * @param hint index of the element where the search starts
+ * @param kind kind of the elements, a constant in every dispatched copy
+ * @return size_t number of elements lower than the key
+ */
+static SCL_ALWAYS_INLINE size_t tim_sort_gallop_left_kind(const tim_sort_state_t * const state, const uint8_t *key, const uint8_t *base, size_t number_of_elem, size_t hint, scl_key_kind_t kind) {
+    size_t last_offset = 0;
+    size_t offset = 1;
+    size_t left = 0;
+    size_t right = 0;
 
-        /* Push numbers into queues */
-        for (size_t iter_j = 0; iter_j < number_of_elem; ++iter_j) {
+    if (TIM_SORT_LESS(TIM_SORT_AT(base, hint), key)) {
 
-            /* Get digit from number at the iter_i position */
-            uint64_t number_digit = get_whole_number_digit(arr[iter_j], iter_i);
+        /* Gallop to the right until base[hint + offset] is not lower than the key */
+        const size_t max_offset = number_of_elem - hint;
 
-            /* Push array element to queue */
-            queue_push(queues[number_digit], &arr[iter_j]);
+        while ((offset < max_offset) && TIM_SORT_LESS(TIM_SORT_AT(base, hint + offset), key)) {
+            last_offset = offset;
+            offset = (offset << 1) + 1;
         }
 
-        size_t iter_k = 0;
+        if (offset > max_offset) {
+            offset = max_offset;
+        }
 
-        /* Extract numbers from the queues */
-        for (size_t iter_j = 0; iter_j < 10; ++iter_j) {
-            while (0 == is_queue_empty(queues[iter_j])) {
+        left = hint + last_offset + 1;
+        right = hint + offset;
+    } else {
 
-                /* Get first element from queue */
-                arr[iter_k++] = *(uint64_t *)queue_front(queues[iter_j]);
+        /* Gallop to the left until base[hint - offset] is lower than the key */
+        const size_t max_offset = hint + 1;
 
-                /* Get error from popping */
-                scl_error_t err = queue_pop(queues[iter_j]);
+        while ((offset < max_offset) && !TIM_SORT_LESS(TIM_SORT_AT(base, hint - offset), key)) {
+            last_offset = offset;
+            offset = (offset << 1) + 1;
+        }
 
-                /* If popping generated an error return it */
-                if (SCL_OK != err) {
-                    return err;
-                }
-            }
+        if (offset > max_offset) {
+            offset = max_offset;
         }
+
+        left = hint + 1 - offset;
+        right = hint - last_offset;
     }
 
-    /* Free memory allocated by the queues */
-    for (size_t iter_i = 0; iter_i < 10; ++iter_i) {
+    /* The position is in [left, right], finish by binary search */
+    while (left < right) {
+        const size_t middle = left + ((right - left) >> 1);
 
-        /* Free queue if it is not NULL */
-        if (NULL != queues[iter_i]) {
-            free_queue(queues[iter_i]);
+        if (TIM_SORT_LESS(TIM_SORT_AT(base, middle), key)) {
+            left = middle + 1;
+        } else {
+            right = middle;
         }
     }
 
-    /* Free queues pointer and set to NULL*/
-    if (NULL != queues) {
-        free(queues);
-        queues = NULL;
-    }
-
-    /* All good */
-    return SCL_OK;
+    return right;
 }
 
 /**
- * @brief Function to sort a continuous memory location
- * represented as an array statically or dynamically allocated
- * by insertion sorting algorithm.
+ * @brief Function to find the position of the first element of a sorted
+ * range that is greater than a key (the key goes after its equals), it
+ * gallops from a hint as **tim_sort_gallop_left_kind**. MUST not be used
+ * outside this file.
  * 
- * @param arr an array of any type to sort its elements
- * @param number_of_elem number of elements within the selected array
- * @param arr_elem_size size of one element from selected array
- * @param cmp pointer to a function to compare two sets of data from array
- * @return scl_error_t enum object for handling errors
+ * @param state state of the tim sort
+ * @param key pointer to the key to place
+ * @param base pointer to the first element of the sorted range
+ * @param number_of_elem number of elements of the range, at least 1
+ * @param hint index of the element where the search starts
+ * @param kind kind of the elements, a constant in every dispatched copy
+ * @return size_t number of elements not greater than the key
  */
-scl_error_t insertion_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
-    /* Check if most left pointer and most right pointer of the array are valid */
-    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
-        return SCL_NULL_SIMPLE_ARRAY;
-    }
+static SCL_ALWAYS_INLINE size_t tim_sort_gallop_right_kind(const tim_sort_state_t * const state, const uint8_t *key, const uint8_t *base, size_t number_of_elem, size_t hint, scl_key_kind_t kind) {
+    size_t last_offset = 0;
+    size_t offset = 1;
+    size_t left = 0;
+    size_t right = 0;
+
+    if (TIM_SORT_LESS(key, TIM_SORT_AT(base, hint))) {
+
+        /* Gallop to the left until base[hint - offset] is not greater than the key */
+        const size_t max_offset = hint + 1;
+
+        while ((offset < max_offset) && TIM_SORT_LESS(key, TIM_SORT_AT(base, hint - offset))) {
+            last_offset = offset;
+            offset = (offset << 1) + 1;
+        }
+
+        if (offset > max_offset) {
+            offset = max_offset;
+        }
+
+        left = hint + 1 - offset;
+        right = hint - last_offset;
+    } else {
+
+        /* Gallop to the right until base[hint + offset] is greater than the key */
+        const size_t max_offset = number_of_elem - hint;
+
+        while ((offset < max_offset) && !TIM_SORT_LESS(key, TIM_SORT_AT(base, hint + offset))) {
+            last_offset = offset;
+            offset = (offset << 1) + 1;
+        }
+
+        if (offset > max_offset) {
+            offset = max_offset;
+        }
+
+        left = hint + last_offset + 1;
+        right = hint + offset;
+    }
+
+    /* The position is in [left, right], finish by binary search */
+    while (left < right) {
+        const size_t middle = left + ((right - left) >> 1);
+
+        if (TIM_SORT_LESS(key, TIM_SORT_AT(base, middle))) {
+            right = middle;
+        } else {
+            left = middle + 1;
+        }
+    }
+
+    return right;
+}
+
+/**
+ * @brief Function to merge two adjacent runs when the left one is not
+ * longer: the left run is copied into the buffer and merged forward into
+ * the array. The first element of the right run is lower than the first
+ * element of the left run and the last element of the left run is greater
+ * than every element of the right run. After min_gallop consecutive
+ * elements taken from the same run the merge gallops, moving whole blocks
+ * at once. MUST not be used outside this file.
+ * 
+ * @param state state of the tim sort
+ * @param left pointer to the first element of the left run
+ * @param left_elems number of elements of the left run, at least 1
+ * @param right pointer to the first element of the right run, right after the left run
+ * @param right_elems number of elements of the right run, at least 1
+ * @param kind kind of the elements, a constant in every dispatched copy
+ */
+static SCL_ALWAYS_INLINE void tim_sort_merge_low_kind(tim_sort_state_t * const state, uint8_t *left, size_t left_elems, uint8_t *right, size_t right_elems, scl_key_kind_t kind) {
+    const size_t arr_elem_size = state->arr_elem_size;
+    uint8_t *dst = left;
+    uint8_t *iter_left = state->buffer;
+    uint8_t *iter_right = right;
+    size_t min_gallop = state->min_gallop;
+
+    memcpy(state->buffer, left, left_elems * arr_elem_size);
+
+    /* The first element of the right run goes first */
+    memcpy(dst, iter_right, arr_elem_size);
+    dst += arr_elem_size;
+    iter_right += arr_elem_size;
+
+    if (0 == --right_elems) {
+        goto copy_left;
+    }
+
+    if (1 == left_elems) {
+        goto copy_right;
+    }
+
+    for (;;) {
+        size_t left_count = 0;
+        size_t right_count = 0;
+
+        /* Take one element at a time until one run wins min_gallop times in a row */
+        for (;;) {
+            if (TIM_SORT_LESS(iter_right, iter_left)) {
+                memcpy(dst, iter_right, arr_elem_size);
+                dst += arr_elem_size;
+                iter_right += arr_elem_size;
+                ++right_count;
+                left_count = 0;
+
+                if (0 == --right_elems) {
+                    goto copy_left;
+                }
+
+                if (right_count >= min_gallop) {
+                    break;
+                }
+            } else {
+                memcpy(dst, iter_left, arr_elem_size);
+                dst += arr_elem_size;
+                iter_left += arr_elem_size;
+                ++left_count;
+                right_count = 0;
+
+                if (1 == --left_elems) {
+                    goto copy_right;
+                }
+
+                if (left_count >= min_gallop) {
+                    break;
+                }
+            }
+        }
+
+        /* Gallop while the blocks are long, every round lowers the threshold */
+        ++min_gallop;
+
+        do {
+            min_gallop -= (min_gallop > 1);
+
+            left_count = tim_sort_gallop_right_kind(state, iter_right, iter_left, left_elems, 0, kind);
+
+            if (0 != left_count) {
+                memcpy(dst, iter_left, left_count * arr_elem_size);
+                dst += left_count * arr_elem_size;
+                iter_left += left_count * arr_elem_size;
+                left_elems -= left_count;
+
+                if (left_elems <= 1) {
+                    goto copy_right;
+                }
+            }
+
+            memcpy(dst, iter_right, arr_elem_size);
+            dst += arr_elem_size;
+            iter_right += arr_elem_size;
+
+            if (0 == --right_elems) {
+                goto copy_left;
+            }
+
+            right_count = tim_sort_gallop_left_kind(state, iter_left, iter_right, right_elems, 0, kind);
+
+            if (0 != right_count) {
+                memmove(dst, iter_right, right_count * arr_elem_size);
+                dst += right_count * arr_elem_size;
+                iter_right += right_count * arr_elem_size;
+                right_elems -= right_count;
+
+                if (0 == right_elems) {
+                    goto copy_left;
+                }
+            }
+
+            memcpy(dst, iter_left, arr_elem_size);
+            dst += arr_elem_size;
+            iter_left += arr_elem_size;
+
+            if (1 == --left_elems) {
+                goto copy_right;
+            }
+        } while ((left_count >= TIM_SORT_MIN_GALLOP) || (right_count >= TIM_SORT_MIN_GALLOP));
+
+        /* Galloping did not pay off, make it harder to start again */
+        ++min_gallop;
+    }
+
+copy_right:
+    /* The last element of the left run is the greatest one */
+    memmove(dst, iter_right, right_elems * arr_elem_size);
+    memcpy(dst + right_elems * arr_elem_size, iter_left, left_elems * arr_elem_size);
+    state->min_gallop = min_gallop;
+    return;
+
+copy_left:
+    memcpy(dst, iter_left, left_elems * arr_elem_size);
+    state->min_gallop = min_gallop;
+}
+
+/**
+ * @brief Function to merge two adjacent runs when the right one is
+ * shorter: the right run is copied into the buffer and merged backward
+ * into the array, with the same conditions and galloping as
+ * **tim_sort_merge_low_kind**. MUST not be used outside this file.
+ * 
+ * @param state state of the tim sort
+ * @param left pointer to the first element of the left run
+ * @param left_elems number of elements of the left run, at least 1
+ * @param right pointer to the first element of the right run, right after the left run
+ * @param right_elems number of elements of the right run, at least 1
+ * @param kind kind of the elements, a constant in every dispatched copy
+ */
+static SCL_ALWAYS_INLINE void tim_sort_merge_high_kind(tim_sort_state_t * const state, uint8_t *left, size_t left_elems, uint8_t *right, size_t right_elems, scl_key_kind_t kind) {
+    const size_t arr_elem_size = state->arr_elem_size;
+    uint8_t *dst = TIM_SORT_AT(right, right_elems - 1);
+    uint8_t *iter_left = TIM_SORT_AT(left, left_elems - 1);
+    uint8_t *iter_right = TIM_SORT_AT(state->buffer, right_elems - 1);
+    size_t min_gallop = state->min_gallop;
+
+    memcpy(state->buffer, right, right_elems * arr_elem_size);
+
+    /* The last element of the left run goes last */
+    memcpy(dst, iter_left, arr_elem_size);
+    dst -= arr_elem_size;
+    iter_left -= arr_elem_size;
+
+    if (0 == --left_elems) {
+        goto copy_right;
+    }
+
+    if (1 == right_elems) {
+        goto copy_left;
+    }
+
+    for (;;) {
+        size_t left_count = 0;
+        size_t right_count = 0;
+
+        /* Take one element at a time until one run wins min_gallop times in a row */
+        for (;;) {
+            if (TIM_SORT_LESS(iter_right, iter_left)) {
+                memcpy(dst, iter_left, arr_elem_size);
+                dst -= arr_elem_size;
+                iter_left -= arr_elem_size;
+                ++left_count;
+                right_count = 0;
+
+                if (0 == --left_elems) {
+                    goto copy_right;
+                }
+
+                if (left_count >= min_gallop) {
+                    break;
+                }
+            } else {
+                memcpy(dst, iter_right, arr_elem_size);
+                dst -= arr_elem_size;
+                iter_right -= arr_elem_size;
+                ++right_count;
+                left_count = 0;
+
+                if (1 == --right_elems) {
+                    goto copy_left;
+                }
+
+                if (right_count >= min_gallop) {
+                    break;
+                }
+            }
+        }
+
+        /* Gallop while the blocks are long, every round lowers the threshold */
+        ++min_gallop;
+
+        do {
+            min_gallop -= (min_gallop > 1);
+
+            left_count = left_elems - tim_sort_gallop_right_kind(state, iter_right, left, left_elems, left_elems - 1, kind);
+
+            if (0 != left_count) {
+                dst -= left_count * arr_elem_size;
+                iter_left -= left_count * arr_elem_size;
+                memmove(dst + arr_elem_size, iter_left + arr_elem_size, left_count * arr_elem_size);
+                left_elems -= left_count;
+
+                if (0 == left_elems) {
+                    goto copy_right;
+                }
+            }
+
+            memcpy(dst, iter_right, arr_elem_size);
+            dst -= arr_elem_size;
+            iter_right -= arr_elem_size;
+
+            if (1 == --right_elems) {
+                goto copy_left;
+            }
+
+            right_count = right_elems - tim_sort_gallop_left_kind(state, iter_left, state->buffer, right_elems, right_elems - 1, kind);
+
+            if (0 != right_count) {
+                dst -= right_count * arr_elem_size;
+                iter_right -= right_count * arr_elem_size;
+                memcpy(dst + arr_elem_size, iter_right + arr_elem_size, right_count * arr_elem_size);
+                right_elems -= right_count;
+
+                if (right_elems <= 1) {
+                    goto copy_left;
+                }
+            }
+
+            memcpy(dst, iter_left, arr_elem_size);
+            dst -= arr_elem_size;
+            iter_left -= arr_elem_size;
+
+            if (0 == --left_elems) {
+                goto copy_right;
+            }
+        } while ((left_count >= TIM_SORT_MIN_GALLOP) || (right_count >= TIM_SORT_MIN_GALLOP));
+
+        /* Galloping did not pay off, make it harder to start again */
+        ++min_gallop;
+    }
+
+copy_left:
+    /* The first element of the right run is the lowest one */
+    dst -= left_elems * arr_elem_size;
+    iter_left -= left_elems * arr_elem_size;
+    memmove(dst + arr_elem_size, iter_left + arr_elem_size, left_elems * arr_elem_size);
+    memcpy(dst, state->buffer, right_elems * arr_elem_size);
+    state->min_gallop = min_gallop;
+    return;
+
+copy_right:
+    memcpy(dst - (right_elems - 1) * arr_elem_size, state->buffer, right_elems * arr_elem_size);
+    state->min_gallop = min_gallop;
+}
+
+/**
+ * @brief Function to merge the pending runs at positions run and run + 1
+ * of the stack. The elements of the left run not greater than the first
+ * element of the right run and the elements of the right run not lower
+ * than the last element of the left run are already in place and are
+ * skipped by galloping, so merging runs in order costs O(logN) comparisons.
+ * MUST not be used outside this file.
+ * 
+ * @param state state of the tim sort
+ * @param run index of the left run inside the stack
+ * @param kind kind of the elements, a constant in every dispatched copy
+ */
+static SCL_ALWAYS_INLINE void tim_sort_merge_at_kind(tim_sort_state_t * const state, size_t run, scl_key_kind_t kind) {
+    uint8_t *left = state->runs[run].base;
+    size_t left_elems = state->runs[run].length;
+    uint8_t *right = state->runs[run + 1].base;
+    size_t right_elems = state->runs[run + 1].length;
+
+    /* Record the merged run and drop the right one from the stack */
+    state->runs[run].length += right_elems;
+
+    if (run + 3 == state->number_of_runs) {
+        state->runs[run + 1] = state->runs[run + 2];
+    }
+
+    --state->number_of_runs;
+
+    /* Skip the beginning of the left run that is already in place */
+    const size_t skip = tim_sort_gallop_right_kind(state, right, left, left_elems, 0, kind);
+
+    left += skip * state->arr_elem_size;
+    left_elems -= skip;
+
+    if (0 == left_elems) {
+        return;
+    }
+
+    /* Skip the end of the right run that is already in place */
+    right_elems = tim_sort_gallop_left_kind(state, TIM_SORT_AT(left, left_elems - 1), right, right_elems, right_elems - 1, kind);
+
+    if (0 == right_elems) {
+        return;
+    }
+
+    /* Copy the shorter run into the buffer */
+    if (left_elems <= right_elems) {
+        tim_sort_merge_low_kind(state, left, left_elems, right, right_elems, kind);
+    } else {
+        tim_sort_merge_high_kind(state, left, left_elems, right, right_elems, kind);
+    }
+}
+
+/* Merges two pending runs with a constant kind of the elements */
+#define TIM_SORT_MERGE_AT_KIND(kind) tim_sort_merge_at_kind(state, run, (kind))
+
+/**
+ * @brief Function to merge the pending runs at positions run and run + 1
+ * of the stack, the kind of the elements is dispatched once for the
+ * merge. MUST not be used outside this file.
+ * 
+ * @param state state of the tim sort
+ * @param run index of the left run inside the stack
+ */
+static void tim_sort_merge_at(tim_sort_state_t * const state, size_t run) {
+    SCL_KEY_KIND_DISPATCH(state->kind, TIM_SORT_MERGE_AT_KIND)
+}
+
+#undef TIM_SORT_MERGE_AT_KIND
+#undef TIM_SORT_AT
+#undef TIM_SORT_LESS
+
+/**
+ * @brief Function to merge pending runs until the lengths of the runs
+ * on the stack decrease faster than the Fibonacci numbers, so the merges
+ * stay balanced and the stack holds O(logN) runs. MUST not be used
+ * outside this file.
+ * 
+ * @param state state of the tim sort
+ */
+static void tim_sort_merge_collapse(tim_sort_state_t * const state) {
+    tim_sort_run_t *runs = state->runs;
+
+    while (state->number_of_runs > 1) {
+        size_t run = state->number_of_runs - 2;
+
+        if (((run > 0) && (runs[run - 1].length <= runs[run].length + runs[run + 1].length)) ||
+            ((run > 1) && (runs[run - 2].length <= runs[run - 1].length + runs[run].length))) {
+            if (runs[run - 1].length < runs[run + 1].length) {
+                --run;
+            }
+        } else if (runs[run].length > runs[run + 1].length) {
+            break;
+        }
+
+        tim_sort_merge_at(state, run);
+    }
+}
+
+/**
+ * @brief Function to sort an array by an adaptive, stable merge sort
+ * (tim sort). The array is split into natural runs (descending runs are
+ * reversed), runs shorter than a minimum length are extended by binary
+ * insertion sort and the runs are merged with galloping, so sorted,
+ * reversed or nearly sorted inputs are sorted in close to O(N) time and
+ * random inputs in O(NlogN). Every merge copies the shorter run into the workspace, so it
+ * must hold at least number_of_elem / 2 elements (a workspace for
+ * **merge_sort_buffered** fits) and must not overlap the array. If it is
+ * `NULL` one buffer is allocated for the whole sort, just if the array is
+ * not already one run.
+ * 
+ * @param arr an array of any type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param workspace scratch memory of number_of_elem / 2 elements or `NULL`
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t tim_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, void *workspace) {
+    scl_error_t err = merge_sort_check(arr, number_of_elem, arr_elem_size, cmp);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    /* One element is already sorted */
+    if (1 == number_of_elem) {
+        return SCL_OK;
+    }
+
+    tim_sort_state_t state;
+
+    state.buffer = workspace;
+    state.arr_elem_size = arr_elem_size;
+    state.cmp = cmp;
+    state.kind = scl_key_kind_of(cmp, arr_elem_size);
+    state.min_gallop = TIM_SORT_MIN_GALLOP;
+    state.number_of_runs = 0;
+
+    const size_t min_run = tim_sort_min_run(number_of_elem);
+    uint8_t *arr_left = arr;
+    size_t elems_left = number_of_elem;
+
+    while (elems_left > 0) {
+        size_t run_elems = (1 == elems_left) ? 1 : tim_sort_count_run(&state, arr_left, elems_left);
+
+        /* The whole array is one run, nothing to merge */
+        if (run_elems == number_of_elem) {
+            return SCL_OK;
+        }
+
+        /* Allocate the scratch buffer once the array is known to need merges */
+        if (NULL == state.buffer) {
+            state.buffer = scl_malloc(scl_get_allocator(), (number_of_elem / 2) * arr_elem_size);
+
+            if (NULL == state.buffer) {
+                errno = ENOMEM;
+                perror("Not enough memory for tim sort buffer");
+                return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+            }
+        }
+
+        /* Extend a short run, its sorted prefix is kept */
+        if (run_elems < min_run) {
+            const size_t sorted_elems = run_elems;
+
+            run_elems = (elems_left < min_run) ? elems_left : min_run;
+            tim_sort_extend_run(&state, arr_left, sorted_elems, run_elems);
+        }
+
+        state.runs[state.number_of_runs].base = arr_left;
+        state.runs[state.number_of_runs].length = run_elems;
+        ++state.number_of_runs;
+
+        tim_sort_merge_collapse(&state);
+
+        arr_left += run_elems * arr_elem_size;
+        elems_left -= run_elems;
+    }
+
+    /* Merge the runs left, the shorter neighbour of the second run from the top first */
+    while (state.number_of_runs > 1) {
+        size_t run = state.number_of_runs - 2;
+
+        if ((run > 0) && (state.runs[run - 1].length < state.runs[run + 1].length)) {
+            --run;
+        }
+
+        tim_sort_merge_at(&state, run);
+    }
+
+    if (NULL == workspace) {
+        scl_free(scl_get_allocator(), state.buffer);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Helper function for nth_element procedure (introselect). Every
+ * partition keeps just the part holding the nth position, so the loop
+ * runs in O(N) time on average. If the depth limit is reached the range
+ * left is sorted by heap sort, so the worst case is O(NlogN).
+ * 
+ * @param arr_left pointer to the first element of the range
+ * @param number_of_elem number of elements of the range
+ * @param nth index of the selected position inside the range
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @param kind kind of the elements (SCL_KEY_GENERIC calls cmp)
+ * @param pivot buffer of one element for the pivot value
+ */
+static void nth_element_helper(uint8_t *arr_left, size_t number_of_elem, size_t nth, size_t arr_elem_size, compare_func cmp, scl_key_kind_t kind, uint8_t *pivot) {
+    size_t depth_limit = quick_sort_depth_limit(number_of_elem);
+
+    while (number_of_elem > QUICK_SORT_INSERTION_CUTOFF) {
+
+        /* Too many bad pivots, sort the range left in place */
+        if (0 == depth_limit) {
+            heap_sort(arr_left, number_of_elem, arr_elem_size, cmp);
+            reverse_array(arr_left, number_of_elem, arr_elem_size);
+            return;
+        }
+
+        --depth_limit;
+
+        /* Get the split point, no element from the left part is greater than one from the right part */
+        uint8_t *partition_ptr = quick_sort_partition(arr_left, number_of_elem, arr_elem_size, cmp, kind, pivot);
+
+        const size_t left_elems = (size_t)(partition_ptr - arr_left) / arr_elem_size + 1;
+
+        /* Keep just the part holding the nth position */
+        if (nth < left_elems) {
+            number_of_elem = left_elems;
+        } else {
+            arr_left = partition_ptr + arr_elem_size;
+            number_of_elem -= left_elems;
+            nth -= left_elems;
+        }
+    }
+
+    /* Sort the small range left */
+    sort_range_insertion(arr_left, number_of_elem, arr_elem_size, cmp, kind);
+}
+
+/**
+ * @brief Function to rearrange an array so that the element at the nth
+ * position is the one that would be there if the array was sorted, no
+ * element before it is greater and no element after it is lower (as
+ * std::nth_element). The selection is done by introselect in O(N) time
+ * on average and O(NlogN) in the worst case. The function allocates one
+ * element as a pivot buffer, so the median of an array is selected by
+ * **nth_element(arr, number_of_elem, number_of_elem / 2, ...)**.
+ * 
+ * @param arr an array of any type to rearrange its elements
+ * @param number_of_elem number of elements within the selected array
+ * @param nth index of the position to select, less than number_of_elem
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t nth_element(void *arr, size_t number_of_elem, size_t nth, size_t arr_elem_size, compare_func cmp) {
+    /* Check if input data is valid */
+    scl_error_t err = merge_sort_check(arr, number_of_elem, arr_elem_size, cmp);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    /* Check if the selected position is inside the array */
+    if (nth >= number_of_elem) {
+        return SCL_INDEX_OVERFLOWS_SIZE;
+    }
+
+    /* Allocate the buffer of the pivot value once for the whole selection */
+    uint8_t *pivot = scl_malloc(scl_get_allocator(), arr_elem_size);
+
+    if (NULL == pivot) {
+        errno = ENOMEM;
+        perror("Not enough memory for nth element pivot");
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    nth_element_helper(arr, number_of_elem, nth, arr_elem_size, cmp, scl_key_kind_of(cmp, arr_elem_size), pivot);
+
+    scl_free(scl_get_allocator(), pivot);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to sort just the lowest k elements of an array, they
+ * are moved in ascending order to the first k positions and the other
+ * elements are left after them in an unspecified order. The kth element
+ * is selected first (introselect), so the function runs in O(N + KlogK)
+ * time on average instead of O(NlogN). The function allocates one element
+ * as a pivot buffer.
+ * 
+ * @param arr an array of any type to sort its lowest elements
+ * @param number_of_elem number of elements within the selected array
+ * @param k number of lowest elements to sort, at most number_of_elem
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t partial_sort(void *arr, size_t number_of_elem, size_t k, size_t arr_elem_size, compare_func cmp) {
+    /* Check if input data is valid */
+    scl_error_t err = merge_sort_check(arr, number_of_elem, arr_elem_size, cmp);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    /* Check if there are elements to sort */
+    if (0 == k) {
+        return SCL_NUMBER_OF_ELEMS_ZERO;
+    }
+
+    if (k > number_of_elem) {
+        return SCL_INDEX_OVERFLOWS_SIZE;
+    }
+
+    /* Allocate the buffer of the pivot value once for the selection and the sort */
+    uint8_t *pivot = scl_malloc(scl_get_allocator(), arr_elem_size);
+
+    if (NULL == pivot) {
+        errno = ENOMEM;
+        perror("Not enough memory for partial sort pivot");
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    const scl_key_kind_t kind = scl_key_kind_of(cmp, arr_elem_size);
+
+    /* Move the k lowest elements in front, the kth one is already in place */
+    if (k < number_of_elem) {
+        nth_element_helper(arr, number_of_elem, k - 1, arr_elem_size, cmp, kind, pivot);
+        --k;
+    }
+
+    if (k > 1) {
+        quick_sort_helper(arr, k, arr_elem_size, cmp, kind, quick_sort_depth_limit(k), pivot);
+    }
+
+    scl_free(scl_get_allocator(), pivot);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Create a top-k object. The object keeps the k lowest elements
+ * (according to cmp) of an unbounded stream of elements in a priority
+ * queue ordered by cmp, so the top is the greatest element kept. A new
+ * element is dropped after one comparison if it is not lower than the
+ * top, otherwise it replaces the top in place (pri_queue_pushpop), so a
+ * full object does not allocate anymore and every element costs O(logK)
+ * in the worst case. To keep the k greatest elements pass a compare
+ * function with the reversed order.
+ * 
+ * @param k maximum number of elements kept
+ * @param elem_size length in bytes of one element
+ * @param cmp pointer to a function to compare two elements
+ * @return topk_t* a new allocated top-k object or `NULL` if function fails
+ */
+topk_t* create_topk(size_t k, size_t elem_size, compare_func cmp) {
+    /* Check if input data is valid */
+    if (0 == k) {
+        errno = EINVAL;
+        perror("Top-k object must keep at least one element");
+        return NULL;
+    }
+
+    if (NULL == cmp) {
+        errno = EINVAL;
+        perror("Compare function undefined for top-k object");
+        return NULL;
+    }
+
+    if (0 == elem_size) {
+        errno = EINVAL;
+        perror("Top-k element size is zero");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new top-k object on heap memory */
+    topk_t *new_topk = scl_malloc(allocator, sizeof(*new_topk));
+
+    /* Check if top-k object was allocated successfully */
+    if (NULL == new_topk) {
+        errno = ENOMEM;
+        perror("Not enough memory for top-k allocation");
+        return NULL;
+    }
+
+    /* The priority queue holds every element as a priority without data */
+    new_topk->heap = create_priority_queue(k, cmp, NULL, NULL, NULL, elem_size, 0);
+
+    if (NULL == new_topk->heap) {
+        scl_free(allocator, new_topk);
+        return NULL;
+    }
+
+    new_topk->cmp = cmp;
+    new_topk->k = k;
+    new_topk->elem_size = elem_size;
+    new_topk->seen = 0;
+    new_topk->allocator = allocator;
+
+    /* Return a new allocated top-k object */
+    return new_topk;
+}
+
+/**
+ * @brief Function to free a top-k object and all the elements kept.
+ * 
+ * @param topk an allocated top-k object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_topk(topk_t * const __restrict__ topk) {
+    /* Check if top-k object is valid */
+    if (NULL == topk) {
+        return SCL_NULL_TOPK;
+    }
+
+    free_priority_queue(topk->heap);
+    scl_free(topk->allocator, topk);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to offer one element of the stream to a top-k object.
+ * Until k elements are kept the element is pushed, after that it replaces
+ * the greatest element kept just if it is lower.
+ * 
+ * @param topk an allocated top-k object
+ * @param elem pointer to the element of the stream
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t topk_push(topk_t * const __restrict__ topk, const void * const __restrict__ elem) {
+    /* Check if input data is valid */
+    if (NULL == topk) {
+        return SCL_NULL_TOPK;
+    }
+
+    if (NULL == elem) {
+        return SCL_INVALID_INPUT;
+    }
+
+    ++topk->seen;
+
+    /* Fill the object first, then replace the top in place */
+    if (topk->heap->size < topk->k) {
+        return pri_queue_push(topk->heap, elem, NULL);
+    }
+
+    return pri_queue_pushpop(topk->heap, elem, NULL);
+}
+
+/**
+ * @brief Function to offer a block of elements of the stream to a top-k
+ * object, as calling **topk_push** for every element.
+ * 
+ * @param topk an allocated top-k object
+ * @param elems array of number_of_elem elements of the stream
+ * @param number_of_elem number of elements within the array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t topk_push_array(topk_t * const __restrict__ topk, const void * const __restrict__ elems, size_t number_of_elem) {
+    /* Check if input data is valid */
+    if (NULL == topk) {
+        return SCL_NULL_TOPK;
+    }
+
+    if ((NULL == elems) && (number_of_elem > 0)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    const uint8_t *typed_elems = elems;
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        scl_error_t err = topk_push(topk, typed_elems + iter * topk->elem_size);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the greatest element kept by a top-k object,
+ * once the object is full a new element is kept just if it is lower.
+ * 
+ * @param topk an allocated top-k object
+ * @return const void* pointer to the greatest element kept or `NULL`
+ * if the object is not allocated or is empty
+ */
+const void* topk_threshold(const topk_t * const __restrict__ topk) {
+    /* Check if top-k object is valid */
+    if (NULL == topk) {
+        return NULL;
+    }
+
+    return pri_queue_top_pri(topk->heap);
+}
+
+/**
+ * @brief Function to get the number of elements kept by a top-k
+ * object, at most k. If the object is not allocated `__SIZE_MAX__`
+ * is returned.
+ * 
+ * @param topk an allocated top-k object
+ * @return size_t number of elements kept
+ */
+size_t topk_size(const topk_t * const __restrict__ topk) {
+    /* Check if top-k object is valid */
+    if (NULL == topk) {
+        return __SIZE_MAX__;
+    }
+
+    return topk->heap->size;
+}
+
+/**
+ * @brief Function to get the number of elements offered to a top-k
+ * object since its creation. If the object is not allocated
+ * `__SIZE_MAX__` is returned.
+ * 
+ * @param topk an allocated top-k object
+ * @return size_t number of elements offered
+ */
+size_t topk_seen(const topk_t * const __restrict__ topk) {
+    /* Check if top-k object is valid */
+    if (NULL == topk) {
+        return __SIZE_MAX__;
+    }
+
+    return topk->seen;
+}
+
+/**
+ * @brief Function to copy the elements kept by a top-k object into an
+ * array in ascending order, the object is not changed. The array must
+ * have room for **topk_size(topk)** elements.
+ * 
+ * @param topk an allocated top-k object
+ * @param out array to write the elements kept
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t topk_extract(const topk_t * const __restrict__ topk, void * const __restrict__ out) {
+    /* Check if input data is valid */
+    if (NULL == topk) {
+        return SCL_NULL_TOPK;
+    }
+
+    if (NULL == out) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    const size_t size = topk->heap->size;
+    uint8_t *typed_out = out;
+
+    /* Nothing was kept yet */
+    if (0 == size) {
+        return SCL_OK;
+    }
+
+    for (size_t iter = 0; iter < size; ++iter) {
+        memcpy(typed_out + iter * topk->elem_size, topk->heap->nodes[iter]->pri, topk->elem_size);
+    }
+
+    return quick_sort(typed_out, size, topk->elem_size, topk->cmp);
+}
+
+/**
+ * @brief Function to sort a continuous memory location
+ * represented as an array statically or dynamically allocated
+ * by bubble sorting algorithm.
+ * 
+ * @param arr an array of any type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bubble_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    /* Check if most left pointer and most right pointer of the array are valid */
+    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    /* Check if there are elements to sort */
+    if (0 == number_of_elem) {
+        return SCL_NUMBER_OF_ELEMS_ZERO;
+    }
+
+    /* Check if the size of one element is valid */
+    if (0 == arr_elem_size) {
+        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    }
+
+    /* Check if comparision function is valid */
+    if (NULL == cmp) {
+        return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
+    }
+
+    /* Set pointer to the last array element */
+    uint8_t *arr_end = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
+
+    /* Set flag to check if data swapping occured */
+    uint8_t swap_flag = 0;
+
+    /* Sort array */
+    for (uint8_t *iter_i = arr; iter_i < arr_end; iter_i = iter_i + arr_elem_size) {
+        
+        /* Set swap flag as false */
+        swap_flag = 0;
+
+        /* Compute new last element pointer form array */
+        uint8_t *second_arr_end = (uint8_t *)arr + (arr_end - iter_i);
+        
+        /* Check bubbles */
+        for (uint8_t *iter_j = arr; iter_j < second_arr_end; iter_j = iter_j + arr_elem_size) {
+            if (cmp(iter_j, iter_j + arr_elem_size) >= 1) {
+
+                /* Swap bubbles */
+                swap_array_nodes(iter_j, iter_j + arr_elem_size, arr_elem_size);
+
+                swap_flag = 1;
+            }
+        }
+
+        /* No swap occured so array is already sorted */
+        if (0 == swap_flag) {
+            break;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Number of bits of one digit of the radix sort and number
+ * of passes needed to sort a 64-bit key.
+ * 
+ */
+#define RADIX_SORT_DIGIT_BITS 8
+#define RADIX_SORT_BUCKETS (1 << RADIX_SORT_DIGIT_BITS)
+#define RADIX_SORT_PASSES (64 / RADIX_SORT_DIGIT_BITS)
+
+/**
+ * @brief Function to count the digits of every pass of the radix sort
+ * in a single scan of the keys.
+ * 
+ * @param keys array of keys
+ * @param number_of_elem number of keys
+ * @param histograms count of every digit value for every pass
+ */
+static void radix_sort_histograms(const uint64_t *keys, size_t number_of_elem, size_t histograms[RADIX_SORT_PASSES][RADIX_SORT_BUCKETS]) {
+    memset(histograms, 0, sizeof(size_t) * RADIX_SORT_PASSES * RADIX_SORT_BUCKETS);
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        for (size_t pass = 0; pass < RADIX_SORT_PASSES; ++pass) {
+            ++histograms[pass][(keys[iter] >> (pass * RADIX_SORT_DIGIT_BITS)) & (RADIX_SORT_BUCKETS - 1)];
+        }
+    }
+}
+
+/**
+ * @brief Function to turn the histogram of one pass into the starting
+ * offsets of every bucket. The pass can be skipped if all the keys have
+ * the same digit, because it would not move any key.
+ * 
+ * @param histogram count of every digit value of the pass
+ * @param number_of_elem number of keys
+ * @return uint8_t 1 if the pass must be done, 0 if it can be skipped
+ */
+static uint8_t radix_sort_offsets(size_t histogram[RADIX_SORT_BUCKETS], size_t number_of_elem) {
+    size_t offset = 0;
+
+    for (size_t bucket = 0; bucket < RADIX_SORT_BUCKETS; ++bucket) {
+        if (histogram[bucket] == number_of_elem) {
+            return 0;
+        }
+
+        const size_t count = histogram[bucket];
+        histogram[bucket] = offset;
+        offset += count;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Function to sort 64-bit unsigned keys by the least significant
+ * digit radix sort, moving the keys between the array and the scratch
+ * array at every pass that is not skipped.
+ * 
+ * @param arr array of keys to sort
+ * @param scratch array of number_of_elem keys
+ * @param number_of_elem number of keys
+ */
+static void radix_sort_keys(uint64_t *arr, uint64_t *scratch, size_t number_of_elem) {
+    size_t histograms[RADIX_SORT_PASSES][RADIX_SORT_BUCKETS];
+
+    radix_sort_histograms(arr, number_of_elem, histograms);
+
+    uint64_t *src = arr;
+    uint64_t *dst = scratch;
+
+    for (size_t pass = 0; pass < RADIX_SORT_PASSES; ++pass) {
+        if (0 == radix_sort_offsets(histograms[pass], number_of_elem)) {
+            continue;
+        }
+
+        const size_t shift = pass * RADIX_SORT_DIGIT_BITS;
+
+        /* Scatter the keys by their digit, the order of equal digits is kept */
+        for (size_t iter = 0; iter < number_of_elem; ++iter) {
+            dst[histograms[pass][(src[iter] >> shift) & (RADIX_SORT_BUCKETS - 1)]++] = src[iter];
+        }
+
+        uint64_t *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    /* Copy the sorted keys back if the last pass scattered into the scratch array */
+    if (src != arr) {
+        memcpy(arr, src, sizeof(*arr) * number_of_elem);
+    }
+}
+
+/**
+ * @brief Function to sort a continuous memory location
+ * represented as an array statically or dynamically allocated
+ * by radix sorting algorithm (least significant digit first, with
+ * 8-bit digits). The digits of all passes are counted in one scan,
+ * the passes where all the keys have the same digit are skipped and
+ * the function allocates one scratch array.
+ * 
+ * @param arr an array of uint64_t type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t radix_sort(uint64_t *arr, size_t number_of_elem) {
+    /* Check if array is valid */
+    if (NULL == arr) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    /* Check if there are elements to sort */
+    if (0 == number_of_elem) {
+        return SCL_NUMBER_OF_ELEMS_ZERO;
+    }
+
+    /* Allocate the scratch array */
+    uint64_t *scratch = scl_malloc(scl_get_allocator(), sizeof(*scratch) * number_of_elem);
+
+    if (NULL == scratch) {
+        errno = ENOMEM;
+        perror("Not enough memory for radix sort scratch array");
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    radix_sort_keys(arr, scratch, number_of_elem);
+
+    scl_free(scl_get_allocator(), scratch);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to sort an array of signed 64-bit integers by radix
+ * sort. Flipping the sign bit maps the signed order onto the unsigned
+ * order, so the keys are flipped, sorted by **radix_sort** and flipped back.
+ * 
+ * @param arr an array of int64_t type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t radix_sort_int64(int64_t *arr, size_t number_of_elem) {
+    /* Check if array is valid */
+    if (NULL == arr) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    uint64_t *keys = (uint64_t *)arr;
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        keys[iter] ^= UINT64_C(1) << 63;
+    }
+
+    scl_error_t err = radix_sort(keys, number_of_elem);
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        keys[iter] ^= UINT64_C(1) << 63;
+    }
+
+    return err;
+}
+
+/**
+ * @brief Function to map the bits of a double onto an unsigned key with
+ * the same order (negative numbers have all bits flipped and positive
+ * numbers just the sign bit), and back.
+ * 
+ * @param bits bits of the double or of the key
+ * @param to_key 1 to map a double to a key, 0 to map a key back
+ * @return uint64_t the mapped bits
+ */
+static uint64_t radix_sort_double_key(uint64_t bits, uint8_t to_key) {
+    const uint64_t sign = UINT64_C(1) << 63;
+    const uint8_t negative = (to_key) ? (0 != (bits & sign)) : (0 == (bits & sign));
+
+    return (negative) ? ~bits : (bits ^ sign);
+}
+
+/**
+ * @brief Function to sort an array of doubles by radix sort. The bits of
+ * every double are mapped onto an unsigned key with the same order, the
+ * keys are sorted and mapped back into the array. Negative zero is
+ * placed before positive zero and NaN values are placed at the ends
+ * (by the sign bit of the NaN).
+ * 
+ * @param arr an array of double type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t radix_sort_double(double *arr, size_t number_of_elem) {
+    /* Check if array is valid */
+    if (NULL == arr) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    /* Check if there are elements to sort */
+    if (0 == number_of_elem) {
+        return SCL_NUMBER_OF_ELEMS_ZERO;
+    }
+
+    /* Allocate the keys and the scratch keys in one block */
+    uint64_t *keys = scl_malloc(scl_get_allocator(), 2 * sizeof(*keys) * number_of_elem);
+
+    if (NULL == keys) {
+        errno = ENOMEM;
+        perror("Not enough memory for radix sort scratch arrays");
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* Map the doubles onto keys, memcpy keeps the access well defined */
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        memcpy(&keys[iter], &arr[iter], sizeof(*keys));
+        keys[iter] = radix_sort_double_key(keys[iter], 1);
+    }
+
+    radix_sort_keys(keys, keys + number_of_elem, number_of_elem);
+
+    /* Map the sorted keys back */
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        keys[iter] = radix_sort_double_key(keys[iter], 0);
+        memcpy(&arr[iter], &keys[iter], sizeof(*keys));
+    }
+
+    scl_free(scl_get_allocator(), keys);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to sort an array of records of any size by the 64-bit
+ * unsigned key returned by the key function (stable radix sort). The key
+ * of every record is computed once, then the keys and the records are
+ * moved together at every pass. For signed or floating keys the key
+ * function must map them onto an unsigned order (as **radix_sort_int64**
+ * and **radix_sort_double** do).
+ * 
+ * @param arr an array of records to sort
+ * @param number_of_elem number of records within the selected array
+ * @param arr_elem_size size of one record from selected array
+ * @param key pointer to a function returning the key of one record
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t radix_sort_records(void *arr, size_t number_of_elem, size_t arr_elem_size, radix_key_func key) {
+    /* Check if input data is valid */
+    if (NULL == arr) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    if (0 == number_of_elem) {
+        return SCL_NUMBER_OF_ELEMS_ZERO;
+    }
+
+    if (0 == arr_elem_size) {
+        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    }
+
+    if (NULL == key) {
+        return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
+    }
+
+    /* Allocate the keys, the scratch keys and the scratch records in one block */
+    uint8_t *memory = scl_malloc(scl_get_allocator(), number_of_elem * (2 * sizeof(uint64_t) + arr_elem_size));
+
+    if (NULL == memory) {
+        errno = ENOMEM;
+        perror("Not enough memory for radix sort scratch arrays");
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    uint64_t *src_keys = (uint64_t *)(void *)memory;
+    uint64_t *dst_keys = src_keys + number_of_elem;
+    uint8_t *src = arr;
+    uint8_t *dst = (uint8_t *)(dst_keys + number_of_elem);
+
+    for (size_t iter = 0; iter < number_of_elem; ++iter) {
+        src_keys[iter] = key(src + iter * arr_elem_size);
+    }
+
+    size_t histograms[RADIX_SORT_PASSES][RADIX_SORT_BUCKETS];
+
+    radix_sort_histograms(src_keys, number_of_elem, histograms);
+
+    for (size_t pass = 0; pass < RADIX_SORT_PASSES; ++pass) {
+        if (0 == radix_sort_offsets(histograms[pass], number_of_elem)) {
+            continue;
+        }
+
+        const size_t shift = pass * RADIX_SORT_DIGIT_BITS;
+
+        /* Scatter the keys and the records by their digit */
+        for (size_t iter = 0; iter < number_of_elem; ++iter) {
+            const size_t position = histograms[pass][(src_keys[iter] >> shift) & (RADIX_SORT_BUCKETS - 1)]++;
+
+            dst_keys[position] = src_keys[iter];
+            memcpy(dst + position * arr_elem_size, src + iter * arr_elem_size, arr_elem_size);
+        }
+
+        uint64_t *temp_keys = src_keys;
+        src_keys = dst_keys;
+        dst_keys = temp_keys;
+
+        uint8_t *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    /* Copy the sorted records back if the last pass scattered into the scratch records */
+    if (src != arr) {
+        memcpy(arr, src, number_of_elem * arr_elem_size);
+    }
+
+    scl_free(scl_get_allocator(), memory);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to sort a continuous memory location
+ * represented as an array statically or dynamically allocated
+ * by insertion sorting algorithm.
+ * 
+ * @param arr an array of any type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t insertion_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    /* Check if most left pointer and most right pointer of the array are valid */
+    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    /* Check if there are elements to sort */
+    if (0 == number_of_elem) {
+        return SCL_NUMBER_OF_ELEMS_ZERO;
+    }
+
+    /* Check if the size of one element is valid */
+    if (0 == arr_elem_size) {
+        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    }
+
+    /* Check if comparision function is valid */
+    if (NULL == cmp) {
+        return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
+    }
+
+    /* Cast void pointers to uint8_t and initialize main loop iterator */
+    uint8_t *arr_start = (uint8_t *)arr;
+    uint8_t *arr_end = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
+    uint8_t *iter_i = arr_start + arr_elem_size;
+    uint8_t iter_out_of_bound = 0;
+
+    /* Sort data */
+    for (;;) {
+
+        /* Set a key to compare entire array */
+        uint8_t *cmp_key = scl_malloc(scl_get_allocator(), arr_elem_size);
+
+        /* Copy value of main iterator over the key */
+        memcpy(cmp_key, iter_i, arr_elem_size);
+
+        /* Set second iterator */
+        uint8_t *iter_j = iter_i - arr_elem_size;
+
+        /* Permute data to right */
+        while ((iter_j > arr_start) && (cmp(iter_j, cmp_key) >= 1)) {
+            memcpy(iter_j + arr_elem_size, iter_j, arr_elem_size);
+            
+            iter_j = iter_j - arr_elem_size;
+        }
+
+        /* 
+         * Permute data to right but do not decrease iter_j iterator
+         * because it may cause a segmentation fault accessing wrong
+         * memory adresses
+         */
+        if ((iter_j == arr_start) && (cmp(iter_j, cmp_key) >= 1)) {
+            memcpy(iter_j + arr_elem_size, iter_j, arr_elem_size);
+
+            /* Set a flag to see if iter_j is out of range */
+            iter_out_of_bound = 1;
+        }
+
+        /* Set key value to its right position in the array */
+        if (1 == iter_out_of_bound) {
+            memcpy(arr_start, cmp_key, arr_elem_size);
+        } else {
+            memcpy(iter_j + arr_elem_size, cmp_key, arr_elem_size);
+        }
+
+        /* Set flag to default value */
+        iter_out_of_bound = 0;
+
+        /* Free memory allocated for key */
+        scl_free(scl_get_allocator(), cmp_key);
+
+        /* Begin a new iteration or break the loop and array is sorted */
+        if (iter_i == arr_end) {
+            break;
+        } else {
+            iter_i = iter_i + arr_elem_size;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to sort a continuous memory location
+ * represented as an array statically or dynamically allocated
+ * by selection sorting algorithm.
+ * 
+ * @param arr an array of any type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t selection_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    /* Check if most left pointer and most right pointer of the array are valid */
+    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    /* Check if there are elements to sort */
+    if (0 == number_of_elem) {
+        return SCL_NUMBER_OF_ELEMS_ZERO;
+    }
+
+    /* Check if the size of one element is valid */
+    if (0 == arr_elem_size) {
+        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    }
+
+    /* Check if comparision function is valid */
+    if (NULL == cmp) {
+        return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
+    }
+
+    /* Cast void pointers to uint8_t */
+    uint8_t *arr_start = (uint8_t *)arr;
+    uint8_t *arr_end = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
+
+    /* Sort data */
+    for (uint8_t *iter_i = arr_start; iter_i < arr_end; iter_i = iter_i + arr_elem_size) {
+        
+        /* Set a min pointer to point on minimum data value */
+        uint8_t *min_ptr = iter_i;
+
+        /* Set an iterator to find minimum value */
+        uint8_t *iter_j = iter_i + arr_elem_size;
+
+        for (;;) {
+            if (cmp(iter_j, min_ptr) <= -1) {
+                min_ptr = iter_j;
+            }
+
+            /* Begin a new iteration or break the loop */
+            if (iter_j == arr_end) {
+                break;
+            } else {
+                iter_j = iter_j + arr_elem_size;
+            }
+        }
+
+        /* Swap minimum array node with current working  array node*/
+        swap_array_nodes(min_ptr, iter_i, arr_elem_size);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to reverse a continous memory location
+ * represented as an array statically or dynamically allocated.
+ * 
+ * @param arr an array of any type to sort its elements
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t reverse_array(void *arr, size_t number_of_elem, size_t arr_elem_size) {
+    /* Check if most left pointer and most right pointer of the array are valid */
+    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    /* Check if there are elements to sort */
+    if (0 == number_of_elem) {
+        return SCL_NUMBER_OF_ELEMS_ZERO;
+    }
+
+    /* Check if the size of one element is valid */
+    if (0 == arr_elem_size) {
+        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    }
+
+    /* Set left and right element pointers */
+    uint8_t *left_iter = arr;
+    uint8_t *right_iter = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
+
+    /* Swap elements */
+    while (left_iter < right_iter) {
+
+        /* Swap left with right */
+        swap_array_nodes(left_iter, right_iter, arr_elem_size);
+
+        /* Increment left pointer */
+        left_iter = left_iter + arr_elem_size;
+        
+        /* Decrement right pointer */
+        right_iter = right_iter - arr_elem_size;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find location of the data pointer in
+ * a SORTED array. If data was not found than NULL pointer is
+ * returned so user has to check for NULL than to cast to 
+ * desired type.
+ * 
+ * @param arr an array of any type to sort its elements
+ * @param data pointer to data to find from array
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return void* pointer to data memory location from array or NULL if
+ * data was not found in the array
+ */
+void* binary_search(void *arr, void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    /* Check if most left pointer and most right pointer of the array are valid */
+    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
+        return NULL;
+    }
+
+    /* Check if data is valid */
+    if (NULL == data) {
+        return NULL;
+    }
 
     /* Check if there are elements to sort */
+    if (0 == number_of_elem) {
+        return NULL;
+    }
+
+    /* Check if the size of one element is valid */
+    if (0 == arr_elem_size) {
+        return NULL;
+    }
+
+    /* Check if comparision function is valid */
+    if (NULL == cmp) {
+        return NULL;
+    }
+
+    /* Find the first element not less than data, it is the only candidate */
+    size_t idx = lower_bound(arr, data, number_of_elem, arr_elem_size, cmp);
+
+    if ((idx < number_of_elem) && (0 == cmp((uint8_t *)arr + idx * arr_elem_size, data))) {
+        return (uint8_t *)arr + idx * arr_elem_size;
+    }
+
+    /* Data was not found in the array */
+    return NULL;
+}
+
+/**
+ * @brief Number of keys searched together by the batched lookups,
+ * the loads of the keys of one group are independent so the processor
+ * waits for all of them at once instead of one after another.
+ * 
+ */
+#define SEARCH_BATCH_KEYS 16
+
+/**
+ * @brief Function to find the index of the first element of a SORTED array
+ * that is not less than data. Every step halves the range without branching
+ * on the result of the comparison, so the loop does not mispredict and it takes
+ * exactly ceil(log2(N)) + 1 comparisons.
+ * 
+ * @param arr an array of any type sorted by cmp
+ * @param data pointer to data to find from array
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return size_t index of the first element not less than data, number_of_elem
+ * if there is no such element or SIZE_MAX if the input is not valid
+ */
+size_t lower_bound(const void *arr, const void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    /* Check if input is valid */
+    if ((NULL == arr) || (NULL == data) || (0 == arr_elem_size) || (NULL == cmp)) {
+        return SIZE_MAX;
+    }
+
+    if (0 == number_of_elem) {
+        return 0;
+    }
+
+    const uint8_t *base = arr;
+
+    while (number_of_elem > 1) {
+        const size_t half = number_of_elem / 2;
+
+        base += (size_t)(cmp(base + (half - 1) * arr_elem_size, data) <= -1) * half * arr_elem_size;
+        number_of_elem -= half;
+    }
+
+    return (size_t)(base - (const uint8_t *)arr) / arr_elem_size + (cmp(base, data) <= -1);
+}
+
+/**
+ * @brief Function to find the index of the first element of a SORTED array
+ * that is greater than data, the branchless pair of **lower_bound**.
+ * 
+ * @param arr an array of any type sorted by cmp
+ * @param data pointer to data to find from array
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return size_t index of the first element greater than data, number_of_elem
+ * if there is no such element or SIZE_MAX if the input is not valid
+ */
+size_t upper_bound(const void *arr, const void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    /* Check if input is valid */
+    if ((NULL == arr) || (NULL == data) || (0 == arr_elem_size) || (NULL == cmp)) {
+        return SIZE_MAX;
+    }
+
+    if (0 == number_of_elem) {
+        return 0;
+    }
+
+    const uint8_t *base = arr;
+
+    while (number_of_elem > 1) {
+        const size_t half = number_of_elem / 2;
+
+        base += (size_t)(cmp(base + (half - 1) * arr_elem_size, data) <= 0) * half * arr_elem_size;
+        number_of_elem -= half;
+    }
+
+    return (size_t)(base - (const uint8_t *)arr) / arr_elem_size + (cmp(base, data) <= 0);
+}
+
+/**
+ * @brief Function to find the index of the first key of a SORTED array of
+ * uint64_t that is not less than the searched key. The comparison is inlined
+ * and turned into a conditional move, and both elements that the next step may
+ * read are prefetched, so the search waits for about one memory load per step.
+ * 
+ * @param arr an array of uint64_t sorted in ascending order
+ * @param number_of_elem number of elements within the selected array
+ * @param key key to search
+ * @return size_t index of the first key not less than key, number_of_elem if
+ * there is no such key (or if the array is `NULL`)
+ */
+size_t lower_bound_uint64(const uint64_t *arr, size_t number_of_elem, uint64_t key) {
+    if ((NULL == arr) || (0 == number_of_elem)) {
+        return number_of_elem;
+    }
+
+    const uint64_t *base = arr;
+
+    while (number_of_elem > 1) {
+        const size_t half = number_of_elem / 2;
+        const size_t next_half = (number_of_elem - half) / 2;
+
+        SCL_PREFETCH(base + next_half);
+        SCL_PREFETCH(base + half + next_half);
+
+        base += (base[half - 1] < key) * half;
+        number_of_elem -= half;
+    }
+
+    return (size_t)(base - arr) + (*base < key);
+}
+
+/**
+ * @brief Function to find the lower bound of many keys in a SORTED array of
+ * uint64_t. The keys are searched in groups of SEARCH_BATCH_KEYS, all the keys
+ * of one group do the same step together, so the cache misses of a group
+ * overlap instead of adding up. The keys do not need to be sorted.
+ * 
+ * @param arr an array of uint64_t sorted in ascending order
+ * @param number_of_elem number of elements within the selected array
+ * @param keys array of keys to search
+ * @param number_of_keys number of keys to search
+ * @param results array of number_of_keys indexes, filled as by **lower_bound_uint64**
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t lower_bound_uint64_batch(const uint64_t *arr, size_t number_of_elem, const uint64_t *keys, size_t number_of_keys, size_t *results) {
+    /* Check if input is valid */
+    if ((NULL == arr) || (NULL == keys) || (NULL == results)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    for (size_t group = 0; group < number_of_keys; group += SEARCH_BATCH_KEYS) {
+        const size_t group_keys = (number_of_keys - group < SEARCH_BATCH_KEYS) ? (number_of_keys - group) : SEARCH_BATCH_KEYS;
+        const uint64_t *group_key = keys + group;
+        size_t *base = results + group;
+
+        for (size_t iter = 0; iter < group_keys; ++iter) {
+            base[iter] = 0;
+        }
+
+        if (0 == number_of_elem) {
+            continue;
+        }
+
+        /* The length of the range is the same for all the keys */
+        size_t length = number_of_elem;
+
+        while (length > 1) {
+            const size_t half = length / 2;
+            const size_t next_half = (length - half) / 2;
+
+            for (size_t iter = 0; iter < group_keys; ++iter) {
+                base[iter] += (arr[base[iter] + half - 1] < group_key[iter]) * half;
+
+                SCL_PREFETCH(arr + base[iter] + next_half);
+            }
+
+            length -= half;
+        }
+
+        for (size_t iter = 0; iter < group_keys; ++iter) {
+            base[iter] += (arr[base[iter]] < group_key[iter]);
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Helper function to copy a sorted array into Eytzinger order,
+ * the elements are taken in order while the implicit tree is visited in order.
+ * 
+ * @param sorted array of sorted elements
+ * @param eytzinger array of the Eytzinger order
+ * @param sorted_idx index of the next element to take from the sorted array
+ * @param node number of the visited node (from 1)
+ * @param number_of_elem number of elements within the arrays
+ * @param arr_elem_size size of one element from the arrays
+ * @return size_t index of the next element to take after the subtree of the node
+ */
+static size_t eytzinger_fill(const uint8_t *sorted, uint8_t *eytzinger, size_t sorted_idx, size_t node, size_t number_of_elem, size_t arr_elem_size) {
+    if (node <= number_of_elem) {
+        sorted_idx = eytzinger_fill(sorted, eytzinger, sorted_idx, 2 * node, number_of_elem, arr_elem_size);
+
+        memcpy(eytzinger + (node - 1) * arr_elem_size, sorted + sorted_idx * arr_elem_size, arr_elem_size);
+        ++sorted_idx;
+
+        sorted_idx = eytzinger_fill(sorted, eytzinger, sorted_idx, 2 * node + 1, number_of_elem, arr_elem_size);
+    }
+
+    return sorted_idx;
+}
+
+/**
+ * @brief Helper function to turn the last node reached by an Eytzinger
+ * search into the index of the found element. The search went right after
+ * every trailing one bit of the node and left before them, so the found
+ * element is the node where the search went left for the last time.
+ * 
+ * @param node the node number reached by the search (greater than number_of_elem)
+ * @param number_of_elem number of elements within the array
+ * @return size_t index of the found element or number_of_elem if there is none
+ */
+static inline size_t eytzinger_found(size_t node, size_t number_of_elem) {
+    node >>= __builtin_ffsll((long long)~node);
+
+    return (0 == node) ? number_of_elem : (node - 1);
+}
+
+/**
+ * @brief Function to copy a SORTED array into the Eytzinger (breadth first)
+ * order of an implicit binary search tree: the root is the first element and
+ * the children of the element on index i are on the indexes 2i+1 and 2i+2. The
+ * first levels of the tree share a few cache lines and every step of a search
+ * goes forward in memory, so the next levels can be prefetched.
+ * 
+ * @param sorted an array of any type sorted in ascending order
+ * @param eytzinger an array of number_of_elem elements, not overlapping sorted
+ * @param number_of_elem number of elements within the arrays
+ * @param arr_elem_size size of one element from the arrays
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t eytzinger_layout(const void *sorted, void *eytzinger, size_t number_of_elem, size_t arr_elem_size) {
+    /* Check if arrays are valid */
+    if ((NULL == sorted) || (NULL == eytzinger)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    /* Check if there are elements to copy */
     if (0 == number_of_elem) {
         return SCL_NUMBER_OF_ELEMS_ZERO;
     }
 
-    /* Check if the size of one element is valid */
-    if (0 == arr_elem_size) {
-        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    /* Check if the size of one element is valid */
+    if (0 == arr_elem_size) {
+        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    }
+
+    eytzinger_fill(sorted, eytzinger, 0, 1, number_of_elem, arr_elem_size);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find the first element not less than data in an array
+ * in Eytzinger order (see **eytzinger_layout**).
+ * 
+ * @param eytzinger an array of any type in Eytzinger order
+ * @param data pointer to data to find from array
+ * @param number_of_elem number of elements within the selected array
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return size_t index (in the Eytzinger array) of the first element not less than
+ * data, number_of_elem if there is no such element or SIZE_MAX if the input is not valid
+ */
+size_t eytzinger_lower_bound(const void *eytzinger, const void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
+    /* Check if input is valid */
+    if ((NULL == eytzinger) || (NULL == data) || (0 == arr_elem_size) || (NULL == cmp)) {
+        return SIZE_MAX;
+    }
+
+    const uint8_t *arr = eytzinger;
+    size_t node = 1;
+
+    while (node <= number_of_elem) {
+        node = 2 * node + (size_t)(cmp(arr + (node - 1) * arr_elem_size, data) <= -1);
+    }
+
+    return eytzinger_found(node, number_of_elem);
+}
+
+/**
+ * @brief Function to find the first key not less than the searched key in an
+ * array of uint64_t in Eytzinger order (see **eytzinger_layout**). The sixteen
+ * descendants four levels below the current node are two cache lines, they are
+ * prefetched at every step, so the memory latency of four levels overlaps.
+ * 
+ * @param eytzinger an array of uint64_t in Eytzinger order
+ * @param number_of_elem number of elements within the selected array
+ * @param key key to search
+ * @return size_t index (in the Eytzinger array) of the first key not less than
+ * key, number_of_elem if there is no such key (or if the array is `NULL`)
+ */
+size_t eytzinger_lower_bound_uint64(const uint64_t *eytzinger, size_t number_of_elem, uint64_t key) {
+    if (NULL == eytzinger) {
+        return number_of_elem;
+    }
+
+    size_t node = 1;
+
+    while (node <= number_of_elem) {
+        SCL_PREFETCH(eytzinger + 16 * node - 1);
+        SCL_PREFETCH(eytzinger + 16 * node + 7);
+
+        node = 2 * node + (eytzinger[node - 1] < key);
+    }
+
+    return eytzinger_found(node, number_of_elem);
+}
+
+/**
+ * @brief Function to find the lower bound of many keys in an array of
+ * uint64_t in Eytzinger order. The keys are searched in groups of
+ * SEARCH_BATCH_KEYS that go down the tree together, so the loads of a group
+ * overlap. The results are indexes in the Eytzinger array as returned by
+ * **eytzinger_lower_bound_uint64**.
+ * 
+ * @param eytzinger an array of uint64_t in Eytzinger order
+ * @param number_of_elem number of elements within the selected array
+ * @param keys array of keys to search
+ * @param number_of_keys number of keys to search
+ * @param results array of number_of_keys indexes
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t eytzinger_lower_bound_uint64_batch(const uint64_t *eytzinger, size_t number_of_elem, const uint64_t *keys, size_t number_of_keys, size_t *results) {
+    /* Check if input is valid */
+    if ((NULL == eytzinger) || (NULL == keys) || (NULL == results)) {
+        return SCL_NULL_SIMPLE_ARRAY;
+    }
+
+    /* Every search takes one step more than the number of complete levels */
+    size_t levels = 0;
+
+    for (size_t iter = number_of_elem; iter > 0; iter >>= 1) {
+        ++levels;
+    }
+
+    for (size_t group = 0; group < number_of_keys; group += SEARCH_BATCH_KEYS) {
+        const size_t group_keys = (number_of_keys - group < SEARCH_BATCH_KEYS) ? (number_of_keys - group) : SEARCH_BATCH_KEYS;
+        const uint64_t *group_key = keys + group;
+        size_t *node = results + group;
+
+        for (size_t iter = 0; iter < group_keys; ++iter) {
+            node[iter] = 1;
+        }
+
+        for (size_t level = 0; level < levels; ++level) {
+            for (size_t iter = 0; iter < group_keys; ++iter) {
+                if (node[iter] <= number_of_elem) {
+                    node[iter] = 2 * node[iter] + (eytzinger[node[iter] - 1] < group_key[iter]);
+
+                    SCL_PREFETCH(eytzinger + 4 * node[iter] - 1);
+                }
+            }
+        }
+
+        for (size_t iter = 0; iter < group_keys; ++iter) {
+            node[iter] = eytzinger_found(node[iter], number_of_elem);
+        }
     }
 
-    /* Check if comparision function is valid */
-    if (NULL == cmp) {
-        return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
-    }
+    /* All good */
+    return SCL_OK;
+}
 
-    /* Cast void pointers to uint8_t and initialize main loop iterator */
-    uint8_t *arr_start = (uint8_t *)arr;
-    uint8_t *arr_end = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
-    uint8_t *iter_i = arr_start + arr_elem_size;
-    uint8_t iter_out_of_bound = 0;
+/**
+ * @brief Minimum number of elements sorted by one thread of the
+ * parallel sorting functions, smaller arrays use fewer threads.
+ * 
+ */
+#define PARALLEL_SORT_MIN_CHUNK 16384
 
-    /* Sort data */
-    for (;;) {
+struct sort_batch_s;
 
-        /* Set a key to compare entire array */
-        uint8_t *cmp_key = malloc(arr_elem_size);
+/**
+ * @brief One task run by a thread of the sorting thread pool
+ * 
+ */
+typedef struct sort_task_s {
+    void (*run)(const struct sort_batch_s *batch, struct sort_task_s *task); /* Function doing the task */
+    uint8_t *left;                                              /* First range of the task */
+    size_t left_elems;                                          /* Number of elements of the first range */
+    uint8_t *right;                                             /* Second range of the task (merge tasks) */
+    size_t right_elems;                                         /* Number of elements of the second range */
+    uint8_t *dst;                                               /* Destination of the task */
+    size_t *counts;                                             /* Digit counts or offsets (radix tasks) */
+    size_t shift;                                               /* Shift of the digit (radix tasks) */
+} sort_task_t;
 
-        /* Copy value of main iterator over the key */
-        memcpy(cmp_key, iter_i, arr_elem_size);
+/**
+ * @brief Tasks of one phase of a parallel sort, every phase is
+ * one batch handed to the thread pool of the sort.
+ * 
+ */
+typedef struct sort_batch_s {
+    sort_task_t *tasks;                                         /* Tasks of the phase */
+    size_t arr_elem_size;                                       /* Size of one element of the sorted array */
+    compare_func cmp;                                           /* Function to compare two elements */
+} sort_batch_t;
 
-        /* Set second iterator */
-        uint8_t *iter_j = iter_i - arr_elem_size;
+/**
+ * @brief Thread pool task of the parallel sorts, runs one task of a batch.
+ * 
+ * @param arg pointer to the batch of the phase
+ * @param task index of the task inside the batch
+ */
+static void sort_batch_task(void * const arg, size_t task) {
+    const sort_batch_t *batch = arg;
 
-        /* Permute data to right */
-        while ((iter_j > arr_start) && (cmp(iter_j, cmp_key) >= 1)) {
-            memcpy(iter_j + arr_elem_size, iter_j, arr_elem_size);
-            
-            iter_j = iter_j - arr_elem_size;
-        }
+    batch->tasks[task].run(batch, &batch->tasks[task]);
+}
 
-        /* 
-         * Permute data to right but do not decrease iter_j iterator
-         * because it may cause a segmentation fault accessing wrong
-         * memory adresses
-         */
-        if ((iter_j == arr_start) && (cmp(iter_j, cmp_key) >= 1)) {
-            memcpy(iter_j + arr_elem_size, iter_j, arr_elem_size);
+/**
+ * @brief Function to compute the number of threads of a parallel sort,
+ * 0 threads means one thread for every online processor and every thread
+ * gets at least PARALLEL_SORT_MIN_CHUNK elements.
+ * 
+ * @param number_of_elem number of elements to sort
+ * @param number_of_threads number of threads asked by the caller
+ * @return size_t number of threads to use (at least one)
+ */
+static size_t parallel_sort_threads(size_t number_of_elem, size_t number_of_threads) {
+    if (0 == number_of_threads) {
+        number_of_threads = get_online_processors();
+    }
 
-            /* Set a flag to see if iter_j is out of range */
-            iter_out_of_bound = 1;
-        }
+    if (number_of_threads > number_of_elem / PARALLEL_SORT_MIN_CHUNK) {
+        number_of_threads = number_of_elem / PARALLEL_SORT_MIN_CHUNK;
+    }
 
-        /* Set key value to its right position in the array */
-        if (1 == iter_out_of_bound) {
-            memcpy(arr_start, cmp_key, arr_elem_size);
-        } else {
-            memcpy(iter_j + arr_elem_size, cmp_key, arr_elem_size);
-        }
+    return (0 == number_of_threads) ? 1 : number_of_threads;
+}
 
-        /* Set flag to default value */
-        iter_out_of_bound = 0;
+/**
+ * @brief Task sorting one chunk of the array by quick sort.
+ * 
+ * @param batch batch of the task
+ * @param task task to run
+ */
+static void parallel_sort_chunk_task(const sort_batch_t *batch, sort_task_t *task) {
+    quick_sort(task->left, task->left_elems, batch->arr_elem_size, batch->cmp);
+}
 
-        /* Free memory allocated for key */
-        free(cmp_key);
+/**
+ * @brief Task merging one piece of two sorted runs into the destination.
+ * 
+ * @param batch batch of the task
+ * @param task task to run
+ */
+static void parallel_sort_merge_task(const sort_batch_t *batch, sort_task_t *task) {
+    merge(task->left, task->left_elems, task->right, task->right_elems, task->dst, batch->arr_elem_size, batch->cmp, scl_key_kind_of(batch->cmp, batch->arr_elem_size));
+}
 
-        /* Begin a new iteration or break the loop and array is sorted */
-        if (iter_i == arr_end) {
-            break;
+/**
+ * @brief Function to find the first element of a sorted range that
+ * is not less than the key element.
+ * 
+ * @param arr pointer to the first element of the sorted range
+ * @param number_of_elem number of elements of the range
+ * @param key pointer to the key element
+ * @param arr_elem_size size of one element from selected array
+ * @param cmp pointer to a function to compare two sets of data from array
+ * @return size_t index of the first element not less than the key
+ */
+static size_t parallel_sort_lower_bound(const uint8_t *arr, size_t number_of_elem, const uint8_t *key, size_t arr_elem_size, compare_func cmp) {
+    size_t low = 0;
+    size_t high = number_of_elem;
+
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+
+        if (cmp(arr + middle * arr_elem_size, key) <= -1) {
+            low = middle + 1;
         } else {
-            iter_i = iter_i + arr_elem_size;
+            high = middle;
         }
     }
 
-    /* All good */
-    return SCL_OK;
+    return low;
 }
 
 /**
  * @brief Function to sort a continuous memory location
  * represented as an array statically or dynamically allocated
- * by selection sorting algorithm.
+ * on many threads. Every thread sorts one chunk by quick sort (introsort)
+ * and then the sorted runs are merged pairwise into a scratch buffer and
+ * back, every merge of two runs being split between the threads by binary
+ * searches, so all the threads keep working until the last merge.
  * 
  * @param arr an array of any type to sort its elements
  * @param number_of_elem number of elements within the selected array
  * @param arr_elem_size size of one element from selected array
- * @param cmp pointer to a function to compare two sets of data from array
+ * @param cmp pointer to a function to compare two sets of data from array (called from many threads)
+ * @param number_of_threads number of threads to use (0 for one thread per online processor)
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t selection_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
-    /* Check if most left pointer and most right pointer of the array are valid */
-    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
-        return SCL_NULL_SIMPLE_ARRAY;
+scl_error_t parallel_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, compare_func cmp, size_t number_of_threads) {
+    scl_error_t err = merge_sort_check(arr, number_of_elem, arr_elem_size, cmp);
+
+    if (SCL_OK != err) {
+        return err;
     }
 
-    /* Check if there are elements to sort */
-    if (0 == number_of_elem) {
-        return SCL_NUMBER_OF_ELEMS_ZERO;
+    number_of_threads = parallel_sort_threads(number_of_elem, number_of_threads);
+
+    /* Small arrays are sorted by the calling thread */
+    if (1 == number_of_threads) {
+        return quick_sort(arr, number_of_elem, arr_elem_size, cmp);
     }
 
-    /* Check if the size of one element is valid */
-    if (0 == arr_elem_size) {
-        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    /* Allocate the scratch buffer, the tasks and the bounds of the runs */
+    uint8_t *buffer = scl_malloc(scl_get_allocator(), number_of_elem * arr_elem_size);
+    sort_task_t *tasks = scl_malloc(scl_get_allocator(), sizeof(*tasks) * (number_of_threads + 1));
+    size_t *bounds = scl_malloc(scl_get_allocator(), sizeof(*bounds) * (number_of_threads + 1));
+
+    thread_pool_t *pool = create_thread_pool(number_of_threads);
+    sort_batch_t batch = { tasks, arr_elem_size, cmp };
+
+    if ((NULL == buffer) || (NULL == tasks) || (NULL == bounds) || (NULL == pool)) {
+        free_thread_pool(pool);
+        scl_free(scl_get_allocator(), buffer);
+        scl_free(scl_get_allocator(), tasks);
+        scl_free(scl_get_allocator(), bounds);
+
+        errno = ENOMEM;
+        perror("Not enough memory for parallel sort");
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
     }
 
-    /* Check if comparision function is valid */
-    if (NULL == cmp) {
-        return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
+    memset(tasks, 0, sizeof(*tasks) * (number_of_threads + 1));
+
+    /* Sort one chunk on every thread */
+    for (size_t iter = 0; iter <= number_of_threads; ++iter) {
+        bounds[iter] = number_of_elem / number_of_threads * iter + ((iter == number_of_threads) ? number_of_elem % number_of_threads : 0);
     }
 
-    /* Cast void pointers to uint8_t */
-    uint8_t *arr_start = (uint8_t *)arr;
-    uint8_t *arr_end = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
+    for (size_t iter = 0; iter < number_of_threads; ++iter) {
+        tasks[iter].run = &parallel_sort_chunk_task;
+        tasks[iter].left = (uint8_t *)arr + bounds[iter] * arr_elem_size;
+        tasks[iter].left_elems = bounds[iter + 1] - bounds[iter];
+    }
 
-    /* Sort data */
-    for (uint8_t *iter_i = arr_start; iter_i < arr_end; iter_i = iter_i + arr_elem_size) {
-        
-        /* Set a min pointer to point on minimum data value */
-        uint8_t *min_ptr = iter_i;
+    thread_pool_run(pool, &sort_batch_task, &batch, number_of_threads);
 
-        /* Set an iterator to find minimum value */
-        uint8_t *iter_j = iter_i + arr_elem_size;
+    uint8_t *src = arr;
+    uint8_t *dst = buffer;
+    size_t number_of_runs = number_of_threads;
 
-        for (;;) {
-            if (cmp(iter_j, min_ptr) <= -1) {
-                min_ptr = iter_j;
-            }
+    /* Merge pairs of runs until one run is left */
+    while (number_of_runs > 1) {
+        const size_t number_of_pairs = number_of_runs / 2;
+        const size_t pieces = (number_of_threads / number_of_pairs > 0) ? (number_of_threads / number_of_pairs) : 1;
+        size_t number_of_tasks = 0;
 
-            /* Begin a new iteration or break the loop */
-            if (iter_j == arr_end) {
-                break;
-            } else {
-                iter_j = iter_j + arr_elem_size;
+        for (size_t pair = 0; pair < number_of_pairs; ++pair) {
+            uint8_t *left = src + bounds[2 * pair] * arr_elem_size;
+            uint8_t *right = src + bounds[2 * pair + 1] * arr_elem_size;
+            const size_t left_elems = bounds[2 * pair + 1] - bounds[2 * pair];
+            const size_t right_elems = bounds[2 * pair + 2] - bounds[2 * pair + 1];
+            uint8_t *pair_dst = dst + bounds[2 * pair] * arr_elem_size;
+
+            /* Split the left run evenly and the right run at the same keys */
+            size_t left_start = 0;
+            size_t right_start = 0;
+
+            for (size_t piece = 1; piece <= pieces; ++piece) {
+                size_t left_end = left_elems;
+                size_t right_end = right_elems;
+
+                if (piece < pieces) {
+                    left_end = left_elems / pieces * piece;
+                    right_end = parallel_sort_lower_bound(right, right_elems, left + left_end * arr_elem_size, arr_elem_size, cmp);
+
+                    if (right_end < right_start) {
+                        right_end = right_start;
+                    }
+                }
+
+                sort_task_t *task = &tasks[number_of_tasks++];
+
+                task->run = &parallel_sort_merge_task;
+                task->left = left + left_start * arr_elem_size;
+                task->left_elems = left_end - left_start;
+                task->right = right + right_start * arr_elem_size;
+                task->right_elems = right_end - right_start;
+                task->dst = pair_dst + (left_start + right_start) * arr_elem_size;
+
+                left_start = left_end;
+                right_start = right_end;
             }
+
+            bounds[pair] = bounds[2 * pair];
         }
 
-        /* Swap minimum array node with current working  array node*/
-        swap_array_nodes(min_ptr, iter_i, arr_elem_size);
+        /* The last run without pair is just copied */
+        if (1 == (number_of_runs & 1)) {
+            sort_task_t *task = &tasks[number_of_tasks++];
+
+            task->run = &parallel_sort_merge_task;
+            task->left = src + bounds[number_of_runs - 1] * arr_elem_size;
+            task->left_elems = number_of_elem - bounds[number_of_runs - 1];
+            task->right = task->left + task->left_elems * arr_elem_size;
+            task->right_elems = 0;
+            task->dst = dst + bounds[number_of_runs - 1] * arr_elem_size;
+
+            bounds[number_of_pairs] = bounds[number_of_runs - 1];
+        }
+
+        number_of_runs = number_of_pairs + (number_of_runs & 1);
+        bounds[number_of_runs] = number_of_elem;
+
+        thread_pool_run(pool, &sort_batch_task, &batch, number_of_tasks);
+
+        uint8_t *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    free_thread_pool(pool);
+
+    /* Copy the sorted elements back if the last merge was done into the buffer */
+    if (src != arr) {
+        memcpy(arr, src, number_of_elem * arr_elem_size);
     }
 
+    scl_free(scl_get_allocator(), buffer);
+    scl_free(scl_get_allocator(), tasks);
+    scl_free(scl_get_allocator(), bounds);
+
     /* All good */
     return SCL_OK;
 }
 
 /**
- * @brief Function to reverse a continous memory location
- * represented as an array statically or dynamically allocated.
+ * @brief Task counting the digits of all radix passes of one chunk.
  * 
- * @param arr an array of any type to sort its elements
+ * @param batch batch of the task
+ * @param task task to run
+ */
+static void parallel_radix_histogram_task(const sort_batch_t *batch, sort_task_t *task) {
+    radix_sort_histograms((const uint64_t *)(void *)task->left, task->left_elems, (size_t (*)[RADIX_SORT_BUCKETS])task->counts);
+}
+
+/**
+ * @brief Task counting the digit of one radix pass of one chunk.
+ * 
+ * @param batch batch of the task
+ * @param task task to run
+ */
+static void parallel_radix_count_task(const sort_batch_t *batch, sort_task_t *task) {
+    const uint64_t *keys = (const uint64_t *)(void *)task->left;
+
+    memset(task->counts, 0, sizeof(*task->counts) * RADIX_SORT_BUCKETS);
+
+    for (size_t iter = 0; iter < task->left_elems; ++iter) {
+        ++task->counts[(keys[iter] >> task->shift) & (RADIX_SORT_BUCKETS - 1)];
+    }
+}
+
+/**
+ * @brief Task scattering the keys of one chunk for one radix pass,
+ * starting from the offsets of the chunk in every bucket.
+ * 
+ * @param batch batch of the task
+ * @param task task to run
+ */
+static void parallel_radix_scatter_task(const sort_batch_t *batch, sort_task_t *task) {
+    const uint64_t *keys = (const uint64_t *)(void *)task->left;
+    uint64_t *dst = (uint64_t *)(void *)task->dst;
+
+    for (size_t iter = 0; iter < task->left_elems; ++iter) {
+        dst[task->counts[(keys[iter] >> task->shift) & (RADIX_SORT_BUCKETS - 1)]++] = keys[iter];
+    }
+}
+
+/**
+ * @brief Function to sort an array of uint64_t on many threads by radix
+ * sort. Every pass counts the digits of every chunk in parallel, computes
+ * the offset of every chunk inside every bucket and scatters the chunks in
+ * parallel, so the result is the same as for **radix_sort**. The passes
+ * where all the keys have the same digit are skipped.
+ * 
+ * @param arr an array of uint64_t type to sort its elements
  * @param number_of_elem number of elements within the selected array
- * @param arr_elem_size size of one element from selected array
+ * @param number_of_threads number of threads to use (0 for one thread per online processor)
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t reverse_array(void *arr, size_t number_of_elem, size_t arr_elem_size) {
-    /* Check if most left pointer and most right pointer of the array are valid */
-    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
+scl_error_t parallel_radix_sort(uint64_t *arr, size_t number_of_elem, size_t number_of_threads) {
+    /* Check if array is valid */
+    if (NULL == arr) {
         return SCL_NULL_SIMPLE_ARRAY;
     }
 
@@ -743,108 +3106,118 @@ scl_error_t reverse_array(void *arr, size_t number_of_elem, size_t arr_elem_size
         return SCL_NUMBER_OF_ELEMS_ZERO;
     }
 
-    /* Check if the size of one element is valid */
-    if (0 == arr_elem_size) {
-        return SCL_SIMPLE_ELEM_ARRAY_SIZE_ZERO;
+    number_of_threads = parallel_sort_threads(number_of_elem, number_of_threads);
+
+    /* Small arrays are sorted by the calling thread */
+    if (1 == number_of_threads) {
+        return radix_sort(arr, number_of_elem);
     }
 
-    /* Set left and right element pointers */
-    uint8_t *left_iter = arr;
-    uint8_t *right_iter = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
+    /* Allocate the scratch array, the tasks and the counts of every chunk */
+    uint64_t *scratch = scl_malloc(scl_get_allocator(), sizeof(*scratch) * number_of_elem);
+    sort_task_t *tasks = scl_malloc(scl_get_allocator(), sizeof(*tasks) * number_of_threads);
+    size_t *counts = scl_malloc(scl_get_allocator(), sizeof(*counts) * number_of_threads * RADIX_SORT_PASSES * RADIX_SORT_BUCKETS);
 
-    /* Swap elements */
-    while (left_iter < right_iter) {
+    thread_pool_t *pool = create_thread_pool(number_of_threads);
+    sort_batch_t batch = { tasks, sizeof(*arr), NULL };
 
-        /* Swap left with right */
-        swap_array_nodes(left_iter, right_iter, arr_elem_size);
+    if ((NULL == scratch) || (NULL == tasks) || (NULL == counts) || (NULL == pool)) {
+        free_thread_pool(pool);
+        scl_free(scl_get_allocator(), scratch);
+        scl_free(scl_get_allocator(), tasks);
+        scl_free(scl_get_allocator(), counts);
 
-        /* Increment left pointer */
-        left_iter = left_iter + arr_elem_size;
-        
-        /* Decrement right pointer */
-        right_iter = right_iter - arr_elem_size;
+        errno = ENOMEM;
+        perror("Not enough memory for parallel radix sort");
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
     }
 
-    /* All good */
-    return SCL_OK;
-}
+    const size_t chunk_elems = number_of_elem / number_of_threads;
 
-/**
- * @brief Function to find location of the data pointer in
- * a SORTED array. If data was not found than NULL pointer is
- * returned so user has to check for NULL than to cast to 
- * desired type.
- * 
- * @param arr an array of any type to sort its elements
- * @param data pointer to data to find from array
- * @param number_of_elem number of elements within the selected array
- * @param arr_elem_size size of one element from selected array
- * @param cmp pointer to a function to compare two sets of data from array
- * @return void* pointer to data memory location from array or NULL if
- * data was not found in the array
- */
-void* binary_search(void *arr, void *data, size_t number_of_elem, size_t arr_elem_size, compare_func cmp) {
-    /* Check if most left pointer and most right pointer of the array are valid */
-    if ((NULL == arr) || (NULL == (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size)) {
-        return NULL;
+    /* Count the digits of all passes, the totals tell which passes are skipped */
+    for (size_t iter = 0; iter < number_of_threads; ++iter) {
+        tasks[iter].run = &parallel_radix_histogram_task;
+        tasks[iter].left = (uint8_t *)(arr + iter * chunk_elems);
+        tasks[iter].left_elems = (iter + 1 == number_of_threads) ? (number_of_elem - iter * chunk_elems) : chunk_elems;
+        tasks[iter].counts = counts + iter * RADIX_SORT_PASSES * RADIX_SORT_BUCKETS;
     }
 
-    /* Check if data is valid */
-    if (NULL == data) {
-        return NULL;
-    }
+    thread_pool_run(pool, &sort_batch_task, &batch, number_of_threads);
 
-    /* Check if there are elements to sort */
-    if (0 == number_of_elem) {
-        return NULL;
-    }
+    uint64_t *src = arr;
+    uint64_t *dst = scratch;
+    uint8_t first_pass = 1;
 
-    /* Check if the size of one element is valid */
-    if (0 == arr_elem_size) {
-        return NULL;
-    }
+    for (size_t pass = 0; pass < RADIX_SORT_PASSES; ++pass) {
+        uint8_t skip_pass = 0;
 
-    /* Check if comparision function is valid */
-    if (NULL == cmp) {
-        return NULL;
-    }
+        for (size_t bucket = 0; (bucket < RADIX_SORT_BUCKETS) && (0 == skip_pass); ++bucket) {
+            size_t total = 0;
 
-    /* Set left and right element pointers */
-    uint8_t *left_ptr = arr;
-    uint8_t *right_ptr = (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size;
-
-    /*
-     * Find data in the array 
-     * Left and right pointer should not be equal
-     * becase it may access a location that we should
-     * not access so will check later for equality
-     */
-    while (left_ptr < right_ptr) {
-
-        /* Compute the middle element pointer */
-        size_t elems_to_pass = ((right_ptr - left_ptr) / arr_elem_size) / 2;
-        uint8_t *middle_ptr = left_ptr + arr_elem_size * elems_to_pass;
-
-        /* Compare middle data with input data */
-        int32_t compare_data = cmp(middle_ptr, data);
-
-        /* Check the result of the above comparision */
-        if (compare_data <= -1) {
-            left_ptr = middle_ptr + arr_elem_size;
-        } else if (compare_data >= 1) {
-            right_ptr = middle_ptr - arr_elem_size;
-        } else {
+            for (size_t iter = 0; iter < number_of_threads; ++iter) {
+                total += counts[(iter * RADIX_SORT_PASSES + pass) * RADIX_SORT_BUCKETS + bucket];
+            }
+
+            skip_pass = (total == number_of_elem);
+        }
+
+        if (1 == skip_pass) {
+            continue;
+        }
+
+        /* The chunks of the source changed since the first count, so count this digit again */
+        if (0 == first_pass) {
+            for (size_t iter = 0; iter < number_of_threads; ++iter) {
+                tasks[iter].run = &parallel_radix_count_task;
+                tasks[iter].left = (uint8_t *)(src + iter * chunk_elems);
+                tasks[iter].counts = counts + (iter * RADIX_SORT_PASSES + pass) * RADIX_SORT_BUCKETS;
+                tasks[iter].shift = pass * RADIX_SORT_DIGIT_BITS;
+            }
 
-            /* Data was found return pointer to memory location */
-            return middle_ptr;
+            thread_pool_run(pool, &sort_batch_task, &batch, number_of_threads);
         }
+
+        first_pass = 0;
+
+        /* Turn the counts into offsets, bucket by bucket and chunk by chunk */
+        size_t offset = 0;
+
+        for (size_t bucket = 0; bucket < RADIX_SORT_BUCKETS; ++bucket) {
+            for (size_t iter = 0; iter < number_of_threads; ++iter) {
+                size_t *count = &counts[(iter * RADIX_SORT_PASSES + pass) * RADIX_SORT_BUCKETS + bucket];
+                const size_t chunk_count = *count;
+
+                *count = offset;
+                offset += chunk_count;
+            }
+        }
+
+        for (size_t iter = 0; iter < number_of_threads; ++iter) {
+            tasks[iter].run = &parallel_radix_scatter_task;
+            tasks[iter].left = (uint8_t *)(src + iter * chunk_elems);
+            tasks[iter].dst = (uint8_t *)dst;
+            tasks[iter].counts = counts + (iter * RADIX_SORT_PASSES + pass) * RADIX_SORT_BUCKETS;
+            tasks[iter].shift = pass * RADIX_SORT_DIGIT_BITS;
+        }
+
+        thread_pool_run(pool, &sort_batch_task, &batch, number_of_threads);
+
+        uint64_t *temp = src;
+        src = dst;
+        dst = temp;
     }
 
-    /* Check if data is in array for the last time (Last chance :) ) */
-    if ((left_ptr == right_ptr) && (0 == cmp(left_ptr, data))) {
-        return left_ptr;
+    free_thread_pool(pool);
+
+    /* Copy the sorted keys back if the last pass scattered into the scratch array */
+    if (src != arr) {
+        memcpy(arr, src, sizeof(*arr) * number_of_elem);
     }
 
-    /* Data was not found in the array */
-    return NULL;
+    scl_free(scl_get_allocator(), scratch);
+    scl_free(scl_get_allocator(), tasks);
+    scl_free(scl_get_allocator(), counts);
+
+    /* All good */
+    return SCL_OK;
 }
@@ -38,11 +38,15 @@ sstack_t* create_stack(free_func frd, size_t data_size) {
         return NULL;
     }
 
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
     /* Allocate a new stack on the heap */
-    sstack_t *new_stack = malloc(sizeof(*new_stack));
+    sstack_t *new_stack = scl_malloc(allocator, sizeof(*new_stack));
 
     /* Check if stack allocation went right */
     if (NULL != new_stack) {
+        new_stack->allocator = allocator;
 
         /* Set function pointers */
         new_stack->frd = frd;
@@ -51,6 +55,10 @@ sstack_t* create_stack(free_func frd, size_t data_size) {
         new_stack->top = NULL;
         new_stack->data_size = data_size;
         new_stack->size = 0;
+
+        /* Stack starts in the linked mode */
+        vector_init(&new_stack->array, frd, data_size, allocator);
+        new_stack->shrink_ratio = 0;
     } else {
         errno = ENOMEM;
         perror("Not enough memory for stack allocation");
@@ -77,7 +85,7 @@ static stack_node_t* create_stack_node(const sstack_t * const __restrict__ stack
     }
 
     /* Allocate a new node on the heap */
-    stack_node_t *new_node = malloc(sizeof(*new_node));
+    stack_node_t *new_node = scl_malloc(stack->allocator, SCL_ALIGN_SIZE(sizeof(*new_node)) + stack->data_size);
 
     /* Check if node allocation went successfully */
     if (NULL != new_node) {
@@ -85,21 +93,11 @@ static stack_node_t* create_stack_node(const sstack_t * const __restrict__ stack
         /* Set default next pointer */
         new_node->next = NULL;
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(stack->data_size);
-
-        /* Check if memory allocation went right */
-        if (NULL != new_node->data) {
+        /* The data is stored inline, right after the node, in the same block */
+        new_node->data = (uint8_t *)new_node + SCL_ALIGN_SIZE(sizeof(*new_node));
 
-            /* Copy all bytes from data address to new node's data */
-            memcpy(new_node->data, data, stack->data_size);
-        } else {
-            free(new_node);
-            new_node = NULL;
-
-            errno = ENOMEM;
-            perror("Not enough memory for data node stack allocation");
-        }
+        /* Copy all bytes from data address to new node's data */
+        memcpy(new_node->data, data, stack->data_size);
     } else {
         errno = ENOMEM;
         perror("Not enough memory for stack node allocation");
@@ -123,6 +121,9 @@ scl_error_t free_stack(sstack_t * const __restrict__ stack) {
     /* Check if stack needs to be freed */
     if (NULL != stack) {
 
+        /* Free content of every element of the array mode */
+        vector_release(&stack->array);
+
         /* Iterate through every node from stack */
         while (NULL != stack->top) {
             stack_node_t *iterator = stack->top;
@@ -135,17 +136,12 @@ scl_error_t free_stack(sstack_t * const __restrict__ stack) {
                 stack->frd(iterator->data);
             }
 
-            /* Free node pointer to data */
-            if (NULL != iterator->data) {
-                free(iterator->data);
-            }
-
             /* Set node pointer to data as `NULL` */
             iterator->data = NULL;
 
             /* Free node pointer */
             if (NULL != iterator) {
-                free(iterator);
+                scl_free(stack->allocator, iterator);
             }
 
             /* Set node pointer as `NULL` */
@@ -153,7 +149,7 @@ scl_error_t free_stack(sstack_t * const __restrict__ stack) {
         }
 
         /* Free stack object */
-        free(stack);
+        scl_free(stack->allocator, stack);
 
         return SCL_OK;
     }
@@ -183,8 +179,14 @@ scl_error_t print_stack(const sstack_t * const __restrict__ stack, action_func p
     } 
 
     /* Stack is empty, print [] */
-    if (NULL == stack->top) {
+    if (0 == stack->size) {
         printf("[ ]");
+    } else if (NULL != stack->array.data) {
+
+        /* Print the array from the top to the bottom */
+        for (size_t iter = stack->size; iter > 0; --iter) {
+            print(vector_at(&stack->array, iter - 1));
+        }
     } else {
         const stack_node_t *iterator = stack->top;
 
@@ -201,6 +203,67 @@ scl_error_t print_stack(const sstack_t * const __restrict__ stack, action_func p
     return SCL_OK;
 }
 
+/**
+ * @brief Function to switch a stack into the array mode. The elements are
+ * kept inline one after another in one array that doubles when it is full,
+ * so push and pop do not call the allocator (except when the array grows or
+ * shrinks). The elements already in the stack are moved into the array. A
+ * pointer returned by stack_top is valid just until the next push or pop.
+ * 
+ * @param stack an allocated stack object
+ * @param initial_capacity number of elements of the first array (at least STACK_ARRAY_MIN_CAPACITY)
+ * @param shrink_ratio the array halves when at most capacity / shrink_ratio
+ * elements are left (0 to never shrink, otherwise at least 4)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t stack_use_array(sstack_t * const __restrict__ stack, size_t initial_capacity, size_t shrink_ratio) {
+    /* Check if stack is allocated */
+    if (NULL == stack) {
+        return SCL_NULL_STACK;
+    }
+
+    /* A shrinked array must stay at most half full, or push and pop would resize it back and forth */
+    if ((0 != shrink_ratio) && (shrink_ratio < 4)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Stack already uses an array */
+    if (NULL != stack->array.data) {
+        stack->shrink_ratio = shrink_ratio;
+        return SCL_OK;
+    }
+
+    if (initial_capacity < STACK_ARRAY_MIN_CAPACITY) {
+        initial_capacity = STACK_ARRAY_MIN_CAPACITY;
+    }
+
+    if (initial_capacity < stack->size) {
+        initial_capacity = stack->size;
+    }
+
+    scl_error_t err = vector_reserve(&stack->array, initial_capacity);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    /* Move the nodes into the array, the top node becomes the last element */
+    for (size_t iter = stack->size; iter > 0; --iter) {
+        stack_node_t *delete_node = stack->top;
+
+        stack->top = stack->top->next;
+
+        memcpy(stack->array.data + (iter - 1) * stack->data_size, delete_node->data, stack->data_size);
+        scl_free(stack->allocator, delete_node);
+    }
+
+    stack->array.size = stack->size;
+    stack->shrink_ratio = shrink_ratio;
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to check if a stack object
  * is empty or not. The function tests if top of stack
@@ -212,7 +275,7 @@ scl_error_t print_stack(const sstack_t * const __restrict__ stack, action_func p
  * @return uint8_t 1(True) if stack is not allocated or empty and 0(False) otherwise
  */
 uint8_t is_stack_empty(const sstack_t * const __restrict__ stack) {
-    if ((NULL == stack) || (NULL == stack->top)) {
+    if ((NULL == stack) || (0 == stack->size)) {
         return 1;
     }
     
@@ -235,6 +298,42 @@ size_t get_stack_size(const sstack_t * const __restrict__ stack) {
     return stack->size;
 }
 
+/**
+ * @brief Function to get the memory footprint of a stack. In the linked
+ * mode every node holds one element inline and its link is the node
+ * overhead, in the array mode the free capacity of the array is slack.
+ * 
+ * @param stack an allocated stack object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t stack_memory_usage(const sstack_t * const __restrict__ stack, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == stack) {
+        return SCL_NULL_STACK;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*stack);
+    usage->node_bytes = 0;
+    usage->payload_bytes = stack->size * stack->data_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = 0;
+    usage->nodes = stack->size;
+
+    if (NULL != stack->array.data) {
+        usage->slack_bytes = (stack->array.capacity - stack->size) * stack->data_size;
+    } else {
+        usage->node_bytes = stack->size * SCL_ALIGN_SIZE(sizeof(*stack->top));
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to return a pointer to data of the
  * top node. If stack is not allocated or stack is empty
@@ -245,10 +344,15 @@ size_t get_stack_size(const sstack_t * const __restrict__ stack) {
  * @return const void* a pointer to top element data
  */
 const void* stack_top(const sstack_t * const __restrict__ stack) {
-    if ((NULL == stack) || (NULL == stack->top)) {
+    if ((NULL == stack) || (0 == stack->size)) {
         return NULL;
     }
 
+    /* Top of the array mode is the last element */
+    if (NULL != stack->array.data) {
+        return vector_back(&stack->array);
+    }
+
     return stack->top->data;
 }
 
@@ -271,6 +375,17 @@ scl_error_t stack_push(sstack_t * const __restrict__ stack, const void * __restr
         return SCL_INVALID_DATA;
     }
 
+    /* Array mode copies the data after the last element, a full array doubles */
+    if (NULL != stack->array.data) {
+        if (SCL_OK != vector_push_back(&stack->array, data)) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        ++(stack->size);
+
+        return SCL_OK;
+    }
+
     /* Create a new stack node */
     stack_node_t *new_node = create_stack_node(stack, data);
 
@@ -314,10 +429,24 @@ scl_error_t stack_pop(sstack_t * const __restrict__ stack) {
         return SCL_NULL_STACK;
     }
 
-    if ((NULL == stack->top) || (0 == stack->size)) {
+    if (0 == stack->size) {
         return SCL_DELETE_FROM_EMPTY_OBJECT;
     }
 
+    /* Array mode just forgets the last element */
+    if (NULL != stack->array.data) {
+        vector_pop_back(&stack->array);
+        --(stack->size);
+
+        /* Give back half of the array if it is mostly empty, a failed shrink keeps the bigger array */
+        if ((0 != stack->shrink_ratio) && (stack->array.capacity > STACK_ARRAY_MIN_CAPACITY)
+            && (stack->size <= stack->array.capacity / stack->shrink_ratio)) {
+            vector_shrink(&stack->array, stack->array.capacity / 2);
+        }
+
+        return SCL_OK;
+    }
+
     /* Pointer to current wipe node */
     stack_node_t *delete_node = stack->top;
 
@@ -332,17 +461,12 @@ scl_error_t stack_pop(sstack_t * const __restrict__ stack) {
         stack->frd(delete_node->data);
     }
 
-    /* Free pointer to data memory location */
-    if (NULL != delete_node->data) {
-        free(delete_node->data);
-    }
-
     /* Set data pointer to default value */
     delete_node->data = NULL;
 
     /* Free node memory */
     if (NULL != delete_node) {
-        free(delete_node);
+        scl_free(stack->allocator, delete_node);
     }
 
     /* Set node poiner to default value */
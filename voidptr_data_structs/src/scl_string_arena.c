@@ -0,0 +1,492 @@
+/**
+ * @file scl_string_arena.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_string_arena.h"
+#include "./include/scl_func_types.h"
+
+/**
+ * @brief Function to get the number of bytes taken by one interned string
+ * inside a chunk, rounded up so that the next string stays aligned.
+ * Function MUST not be used outside this file.
+ * 
+ * @param len number of bytes of the string
+ * @return size_t length in bytes of the interned string or zero if it overflows
+ */
+static size_t string_arena_entry_bytes(size_t len) {
+    if (len > SIZE_MAX - sizeof(scl_string_t) - 2 * sizeof(size_t)) {
+        return 0;
+    }
+
+    return (sizeof(scl_string_t) + len + 1 + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1);
+}
+
+/**
+ * @brief Create a string arena object. The arena interns strings, every
+ * distinct string is stored once, with its hash and its length, and is
+ * identified by a handle (a `const scl_string_t *`). Containers keep the
+ * handles as keys of `sizeof(const scl_string_t *)` bytes, compared by
+ * compare_string_handle and hashed by hash_string_handle.
+ * 
+ * @param chunk_bytes length in bytes of one chunk of strings (0 for
+ * STRING_ARENA_CHUNK_BYTES), a longer string gets a chunk of its own
+ * @return string_arena_t* a new allocated string arena object or `NULL` if function fails
+ */
+string_arena_t* create_string_arena(size_t chunk_bytes) {
+    /* Set default chunk length if necessary */
+    if (0 == chunk_bytes) {
+        chunk_bytes = STRING_ARENA_CHUNK_BYTES;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new string arena object on heap memory */
+    string_arena_t *new_arena = scl_malloc(allocator, sizeof(*new_arena));
+
+    /* Check if string arena was allocated successfully */
+    if (NULL == new_arena) {
+        errno = ENOMEM;
+        perror("Not enough memory for string arena allocation");
+        return NULL;
+    }
+
+    new_arena->slots = scl_calloc(allocator, STRING_ARENA_MIN_SLOTS, sizeof(*new_arena->slots));
+
+    if (NULL == new_arena->slots) {
+        scl_free(allocator, new_arena);
+
+        errno = ENOMEM;
+        perror("Not enough memory for string arena index allocation");
+        return NULL;
+    }
+
+    new_arena->allocator = allocator;
+    new_arena->chunks = NULL;
+    new_arena->number_of_slots = STRING_ARENA_MIN_SLOTS;
+    new_arena->chunk_bytes = chunk_bytes;
+    new_arena->size = 0;
+    new_arena->string_bytes = 0;
+
+    /* Return a new allocated string arena */
+    return new_arena;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a
+ * specific string arena object. Every handle of the arena becomes invalid,
+ * so the containers keeping them must not be used anymore.
+ * 
+ * @param arena an allocated string arena object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_string_arena(string_arena_t * const __restrict__ arena) {
+    /* Check if string arena needs to be freed */
+    if (NULL == arena) {
+        return SCL_NULL_STRING_ARENA;
+    }
+
+    string_arena_chunk_t *chunk = arena->chunks;
+
+    while (NULL != chunk) {
+        string_arena_chunk_t * const next_chunk = chunk->next;
+
+        scl_free(arena->allocator, chunk);
+        chunk = next_chunk;
+    }
+
+    scl_free(arena->allocator, arena->slots);
+    scl_free(arena->allocator, arena);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find the index slot of a string, the slot holding its
+ * handle or the empty slot where its handle would be placed. The hash and
+ * the length reject almost every other string before the bytes are compared.
+ * Function MUST not be used outside this file.
+ * 
+ * @param arena an allocated string arena object
+ * @param key_hash hash of the bytes of the string
+ * @param bytes pointer to the bytes of the string
+ * @param len number of bytes of the string
+ * @return size_t index of the slot of the string
+ */
+static size_t string_arena_slot(const string_arena_t * const __restrict__ arena, size_t key_hash, const void * const __restrict__ bytes, size_t len) {
+    const size_t mask = arena->number_of_slots - 1;
+    size_t slot = key_hash & mask;
+
+    for (;;) {
+        const scl_string_t * const string = arena->slots[slot];
+
+        if ((NULL == string) || ((key_hash == string->hash) && (len == string->len) && (0 == memcmp(string->bytes, bytes, len)))) {
+            return slot;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+/**
+ * @brief Function to double the number of index slots of a string arena,
+ * the handles are placed again by their kept hashes. Function MUST not be
+ * used outside this file.
+ * 
+ * @param arena an allocated string arena object
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t string_arena_grow_index(string_arena_t * const __restrict__ arena) {
+    const size_t new_number_of_slots = 2 * arena->number_of_slots;
+    const scl_string_t **new_slots = scl_calloc(arena->allocator, new_number_of_slots, sizeof(*new_slots));
+
+    if (NULL == new_slots) {
+        errno = ENOMEM;
+        perror("Not enough memory to grow the string arena index");
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    const size_t mask = new_number_of_slots - 1;
+
+    for (size_t iter = 0; iter < arena->number_of_slots; ++iter) {
+        const scl_string_t * const string = arena->slots[iter];
+
+        if (NULL != string) {
+            size_t slot = string->hash & mask;
+
+            while (NULL != new_slots[slot]) {
+                slot = (slot + 1) & mask;
+            }
+
+            new_slots[slot] = string;
+        }
+    }
+
+    scl_free(arena->allocator, arena->slots);
+
+    arena->slots = new_slots;
+    arena->number_of_slots = new_number_of_slots;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get memory for one more string from the chunks of a
+ * string arena. A string longer than a quarter of a chunk gets a chunk of
+ * its own, linked after the chunk being filled, so it does not waste the
+ * end of the current chunk. Function MUST not be used outside this file.
+ * 
+ * @param arena an allocated string arena object
+ * @param entry_bytes length in bytes of the interned string
+ * @return scl_string_t* memory for the string or `NULL` if no heap memory is left
+ */
+static scl_string_t* string_arena_alloc(string_arena_t * const __restrict__ arena, size_t entry_bytes) {
+    string_arena_chunk_t *chunk = arena->chunks;
+
+    /* The string fits into the chunk being filled */
+    if ((NULL != chunk) && (chunk->capacity - chunk->used >= entry_bytes)) {
+        scl_string_t * const string = (scl_string_t *)((uint8_t *)(chunk + 1) + chunk->used);
+
+        chunk->used += entry_bytes;
+
+        return string;
+    }
+
+    const uint8_t own_chunk = (entry_bytes > arena->chunk_bytes / 4);
+    const size_t capacity = own_chunk ? entry_bytes : arena->chunk_bytes;
+
+    string_arena_chunk_t * const new_chunk = scl_malloc(arena->allocator, sizeof(*new_chunk) + capacity);
+
+    if (NULL == new_chunk) {
+        errno = ENOMEM;
+        perror("Not enough memory for string arena chunk allocation");
+        return NULL;
+    }
+
+    new_chunk->used = entry_bytes;
+    new_chunk->capacity = capacity;
+
+    if (own_chunk && (NULL != chunk)) {
+        new_chunk->next = chunk->next;
+        chunk->next = new_chunk;
+    } else {
+        new_chunk->next = chunk;
+        arena->chunks = new_chunk;
+    }
+
+    return (scl_string_t *)(new_chunk + 1);
+}
+
+/**
+ * @brief Function to intern a sequence of bytes into a string arena. If
+ * an equal string was interned before its handle is returned, otherwise
+ * the bytes are copied into the arena (followed by a null terminator) with
+ * their hash and their length. Function may fail if no heap memory is left.
+ * 
+ * @param arena an allocated string arena object
+ * @param bytes pointer to the bytes of the string (may be `NULL` if len is zero)
+ * @param len number of bytes of the string
+ * @return const scl_string_t* handle of the string or `NULL` if function fails
+ */
+const scl_string_t* string_arena_intern_bytes(string_arena_t * const __restrict__ arena, const void * const __restrict__ bytes, size_t len) {
+    /* Check if input data is valid */
+    if ((NULL == arena) || ((NULL == bytes) && (0 != len))) {
+        return NULL;
+    }
+
+    const size_t entry_bytes = string_arena_entry_bytes(len);
+
+    if (0 == entry_bytes) {
+        return NULL;
+    }
+
+    const size_t key_hash = hash_bytes(bytes, len);
+    size_t slot = string_arena_slot(arena, key_hash, bytes, len);
+
+    /* The string was interned before */
+    if (NULL != arena->slots[slot]) {
+        return arena->slots[slot];
+    }
+
+    /* Keep the index at most half full */
+    if (2 * (arena->size + 1) > arena->number_of_slots) {
+        if (SCL_OK != string_arena_grow_index(arena)) {
+            return NULL;
+        }
+
+        slot = string_arena_slot(arena, key_hash, bytes, len);
+    }
+
+    scl_string_t * const string = string_arena_alloc(arena, entry_bytes);
+
+    if (NULL == string) {
+        return NULL;
+    }
+
+    string->hash = key_hash;
+    string->len = len;
+
+    if (0 != len) {
+        memcpy(string->bytes, bytes, len);
+    }
+
+    string->bytes[len] = '\0';
+
+    arena->slots[slot] = string;
+    ++(arena->size);
+    arena->string_bytes += len;
+
+    return string;
+}
+
+/**
+ * @brief Function to intern a null terminated string into a string
+ * arena, see string_arena_intern_bytes function.
+ * 
+ * @param arena an allocated string arena object
+ * @param str a null terminated string
+ * @return const scl_string_t* handle of the string or `NULL` if function fails
+ */
+const scl_string_t* string_arena_intern(string_arena_t * const __restrict__ arena, const char * const __restrict__ str) {
+    /* Check if input data is valid */
+    if (NULL == str) {
+        return NULL;
+    }
+
+    return string_arena_intern_bytes(arena, str, strlen(str));
+}
+
+/**
+ * @brief Function to find the handle of a string interned into a string
+ * arena, nothing is interned. A string that was never interned is not a key
+ * of any container using the handles of the arena, so the containers need
+ * not be searched.
+ * 
+ * @param arena an allocated string arena object
+ * @param bytes pointer to the bytes of the string (may be `NULL` if len is zero)
+ * @param len number of bytes of the string
+ * @return const scl_string_t* handle of the string or `NULL` if it was never interned
+ */
+const scl_string_t* string_arena_find(const string_arena_t * const __restrict__ arena, const void * const __restrict__ bytes, size_t len) {
+    /* Check if input data is valid */
+    if ((NULL == arena) || ((NULL == bytes) && (0 != len))) {
+        return NULL;
+    }
+
+    return arena->slots[string_arena_slot(arena, hash_bytes(bytes, len), bytes, len)];
+}
+
+/**
+ * @brief Function to get the number of distinct strings interned into a
+ * string arena. If string arena is not allocated than `SIZE_MAX` will be
+ * returned as an warning.
+ * 
+ * @param arena an allocated string arena object
+ * @return size_t number of interned strings
+ */
+size_t get_string_arena_size(const string_arena_t * const __restrict__ arena) {
+    /* Check if string arena is valid */
+    if (NULL == arena) {
+        return SIZE_MAX;
+    }
+
+    return arena->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a string arena. The bytes
+ * of the strings are the payload, their hashes, lengths, terminators and
+ * padding are node bytes, the chunk headers are object bytes and the unused
+ * ends of the chunks are slack. Function visits every chunk.
+ * 
+ * @param arena an allocated string arena object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t string_arena_memory_usage(const string_arena_t * const __restrict__ arena, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == arena) {
+        return SCL_NULL_STRING_ARENA;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    size_t used_bytes = 0;
+
+    usage->object_bytes = sizeof(*arena);
+    usage->slack_bytes = 0;
+
+    for (const string_arena_chunk_t *chunk = arena->chunks; NULL != chunk; chunk = chunk->next) {
+        usage->object_bytes += sizeof(*chunk);
+        usage->slack_bytes += chunk->capacity - chunk->used;
+        used_bytes += chunk->used;
+    }
+
+    usage->payload_bytes = arena->string_bytes;
+    usage->node_bytes = used_bytes - arena->string_bytes;
+    usage->array_bytes = arena->number_of_slots * sizeof(*arena->slots);
+    usage->nodes = arena->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the handles of two string keys, the keys of a
+ * container are the handles. Function MUST not be used outside this file.
+ * 
+ * @param data pointer to a handle
+ * @return const scl_string_t* the handle
+ */
+static inline const scl_string_t* string_handle_of(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    const scl_string_t *string = NULL;
+
+    memcpy(&string, data, sizeof(string));
+
+    return string;
+}
+
+/**
+ * @brief Function to compare two string handles. Equal handles are
+ * equal strings, otherwise the strings are ordered by their hash, then by
+ * their length and just then by their bytes, so two different strings are
+ * almost always told apart without reading their bytes. The order is total
+ * but not lexicographic, use it for hash tables and for trees whose order
+ * does not matter (see compare_string_handle_lexi).
+ * 
+ * @param data1 pointer to the first handle
+ * @param data2 pointer to the second handle
+ * @return int32_t 1 if data1 is greater than data2, -1 if data1 is less
+ * than data2, 0 if they are equal
+ */
+int32_t compare_string_handle(const void * const data1, const void * const data2) {
+    const scl_string_t * const string1 = string_handle_of(data1);
+    const scl_string_t * const string2 = string_handle_of(data2);
+
+    if (string1 == string2) {
+        return 0;
+    }
+
+    if (string1->hash != string2->hash) {
+        return (string1->hash > string2->hash) ? 1 : -1;
+    }
+
+    if (string1->len != string2->len) {
+        return (string1->len > string2->len) ? 1 : -1;
+    }
+
+    const int result = memcmp(string1->bytes, string2->bytes, string1->len);
+
+    return (result > 0) - (result < 0);
+}
+
+/**
+ * @brief Function to compare two string handles in lexicographic order of
+ * their bytes (a string is less than its extensions). Equal handles are
+ * equal strings and are not read.
+ * 
+ * @param data1 pointer to the first handle
+ * @param data2 pointer to the second handle
+ * @return int32_t 1 if data1 is greater than data2, -1 if data1 is less
+ * than data2, 0 if they are equal
+ */
+int32_t compare_string_handle_lexi(const void * const data1, const void * const data2) {
+    const scl_string_t * const string1 = string_handle_of(data1);
+    const scl_string_t * const string2 = string_handle_of(data2);
+
+    if (string1 == string2) {
+        return 0;
+    }
+
+    const size_t len = (string1->len < string2->len) ? string1->len : string2->len;
+    const int result = memcmp(string1->bytes, string2->bytes, len);
+
+    if (0 != result) {
+        return (result > 0) - (result < 0);
+    }
+
+    return (string1->len > string2->len) - (string1->len < string2->len);
+}
+
+/**
+ * @brief Function to hash a string handle, the hash computed when the
+ * string was interned is returned, the bytes are not read.
+ * 
+ * @param data pointer to a handle
+ * @return size_t hash of the string
+ */
+size_t hash_string_handle(const void * const data) {
+    return string_handle_of(data)->hash;
+}
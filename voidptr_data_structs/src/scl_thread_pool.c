@@ -0,0 +1,443 @@
+/**
+ * @file scl_thread_pool.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "./include/scl_thread_pool.h"
+
+#include <sched.h>
+
+/**
+ * @brief One task spawned by **thread_pool_spawn**, kept in the deque of
+ * the spawning thread until it is run by that thread or by a thief.
+ * 
+ */
+typedef struct thread_pool_job_s {
+    thread_pool_task_func task;                                 /* Function running the task */
+    void *arg;                                                  /* Argument of the task */
+    size_t index;                                               /* Index passed to the task */
+} thread_pool_job_t;
+
+/* Pool whose batch is run by the current thread, `NULL` outside of a batch */
+static _Thread_local thread_pool_t *current_pool = NULL;
+
+/* Index of the deque of the current thread inside its pool */
+static _Thread_local size_t current_thread = 0;
+
+/**
+ * @brief Function to run one spawned task and to free its job.
+ * 
+ * @param pool pointer to an allocated thread pool
+ * @param job job popped or stolen from a deque
+ */
+static void thread_pool_run_job(thread_pool_t * const __restrict__ pool, thread_pool_job_t * const job) {
+    const thread_pool_task_func task = job->task;
+    void * const arg = job->arg;
+    const size_t index = job->index;
+
+    scl_free(pool->allocator, job);
+
+    task(arg, index);
+
+    atomic_fetch_sub_explicit(&pool->pending_tasks, 1, memory_order_acq_rel);
+}
+
+/**
+ * @brief Function to run the tasks of the current batch until none is
+ * left. A thread runs first the tasks spawned on its own deque (the last
+ * spawned first), then the next task of the batch and when both are
+ * empty it steals the oldest spawned task of another thread. The pool
+ * lock MUST be held and it is held again at return.
+ * 
+ * @param pool pointer to an allocated thread pool
+ * @param self index of the deque of the current thread
+ */
+static void thread_pool_drain(thread_pool_t * const __restrict__ pool, size_t self) {
+    const size_t number_of_threads = pool->number_of_workers + 1;
+
+    thread_pool_t * const outer_pool = current_pool;
+    const size_t outer_thread = current_thread;
+
+    current_pool = pool;
+    current_thread = self;
+
+    pthread_mutex_unlock(&pool->lock);
+
+    for (;;) {
+        void *job = NULL;
+
+        if (SCL_OK == work_deque_pop(pool->deques[self], &job)) {
+            thread_pool_run_job(pool, job);
+            continue;
+        }
+
+        /* Tasks of the batch are handed out in order of their indexes */
+        if (atomic_load_explicit(&pool->next_task, memory_order_relaxed) < pool->number_of_tasks) {
+            const size_t task = atomic_fetch_add_explicit(&pool->next_task, 1, memory_order_relaxed);
+
+            if (task < pool->number_of_tasks) {
+                pool->task(pool->task_arg, task);
+                atomic_fetch_sub_explicit(&pool->pending_tasks, 1, memory_order_acq_rel);
+                continue;
+            }
+        }
+
+        uint8_t stolen = 0;
+
+        for (size_t iter = 1; (iter < number_of_threads) && (0 == stolen); ++iter) {
+            if (SCL_OK == work_deque_steal(pool->deques[(self + iter) % number_of_threads], &job)) {
+                stolen = 1;
+            }
+        }
+
+        if (0 != stolen) {
+            thread_pool_run_job(pool, job);
+            continue;
+        }
+
+        if (0 == atomic_load_explicit(&pool->pending_tasks, memory_order_acquire)) {
+            break;
+        }
+
+        /* Some tasks are still running and may spawn more */
+        sched_yield();
+    }
+
+    current_pool = outer_pool;
+    current_thread = outer_thread;
+
+    pthread_mutex_lock(&pool->lock);
+}
+
+/**
+ * @brief Routine of one worker thread, waits for a batch, helps
+ * running it and reports when it is done, until the pool is freed.
+ * 
+ * @param arg pointer to the thread pool
+ * @return void* always `NULL`
+ */
+static void* thread_pool_worker(void *arg) {
+    thread_pool_t *pool = arg;
+    size_t seen_generation = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    /* Workers take the deques in the order they start */
+    const size_t self = pool->started_workers++;
+
+    for (;;) {
+        while ((0 == pool->stop) && (seen_generation == pool->generation)) {
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        }
+
+        if (0 != pool->stop) {
+            break;
+        }
+
+        seen_generation = pool->generation;
+
+        thread_pool_drain(pool, self);
+
+        /* The last worker of the batch wakes the calling thread */
+        if (0 == --(pool->busy_workers)) {
+            pthread_cond_signal(&pool->done_cond);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Get the number of online processors, at least one.
+ * 
+ * @return size_t number of online processors
+ */
+size_t get_online_processors(void) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (online > 0) ? (size_t)online : 1;
+}
+
+/**
+ * @brief Create a thread pool object. The calling thread of **thread_pool_run**
+ * counts as one of the threads, so number_of_threads - 1 workers are created
+ * (0 means one thread per online processor). If some workers can not be created
+ * the pool works with fewer threads, in the worst case just with the calling
+ * thread. Allocation may fail if there is not enough memory on heap.
+ * 
+ * @param number_of_threads number of threads running every batch (0 for default)
+ * @return thread_pool_t* a new allocated thread pool object or `NULL` (if function fails)
+ */
+thread_pool_t* create_thread_pool(size_t number_of_threads) {
+    if (0 == number_of_threads) {
+        number_of_threads = get_online_processors();
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new thread pool object on heap */
+    thread_pool_t *new_pool = scl_malloc(allocator, sizeof(*new_pool));
+
+    if (NULL == new_pool) {
+        errno = ENOMEM;
+        perror("Not enough memory for thread pool allocation");
+        return NULL;
+    }
+
+    memset(new_pool, 0, sizeof(*new_pool));
+    new_pool->allocator = allocator;
+
+    new_pool->threads = scl_malloc(allocator, sizeof(*new_pool->threads) * number_of_threads);
+
+    if ((NULL == new_pool->threads) || (0 != pthread_mutex_init(&new_pool->lock, NULL))) {
+        scl_free(allocator, new_pool->threads);
+        scl_free(allocator, new_pool);
+
+        errno = ENOMEM;
+        perror("Not enough memory for thread pool allocation");
+        return NULL;
+    }
+
+    if (0 != pthread_cond_init(&new_pool->work_cond, NULL)) {
+        pthread_mutex_destroy(&new_pool->lock);
+        scl_free(allocator, new_pool->threads);
+        scl_free(allocator, new_pool);
+
+        errno = ENOMEM;
+        perror("Not enough memory for thread pool allocation");
+        return NULL;
+    }
+
+    if (0 != pthread_cond_init(&new_pool->done_cond, NULL)) {
+        pthread_cond_destroy(&new_pool->work_cond);
+        pthread_mutex_destroy(&new_pool->lock);
+        scl_free(allocator, new_pool->threads);
+        scl_free(allocator, new_pool);
+
+        errno = ENOMEM;
+        perror("Not enough memory for thread pool allocation");
+        return NULL;
+    }
+
+    /* Every thread owns one deque, so a thread that cannot be started leaves an unused deque */
+    new_pool->deques = scl_calloc(allocator, number_of_threads, sizeof(*new_pool->deques));
+
+    for (size_t iter = 0; (NULL != new_pool->deques) && (iter < number_of_threads); ++iter) {
+        new_pool->deques[iter] = create_work_deque(0);
+
+        if (NULL == new_pool->deques[iter]) {
+            for (size_t free_iter = 0; free_iter < iter; ++free_iter) {
+                free_work_deque(new_pool->deques[free_iter]);
+            }
+
+            scl_free(allocator, new_pool->deques);
+            new_pool->deques = NULL;
+        }
+    }
+
+    if (NULL == new_pool->deques) {
+        pthread_cond_destroy(&new_pool->done_cond);
+        pthread_cond_destroy(&new_pool->work_cond);
+        pthread_mutex_destroy(&new_pool->lock);
+        scl_free(allocator, new_pool->threads);
+        scl_free(allocator, new_pool);
+
+        errno = ENOMEM;
+        perror("Not enough memory for thread pool deques allocation");
+        return NULL;
+    }
+
+    new_pool->number_of_deques = number_of_threads;
+    atomic_init(&new_pool->next_task, 0);
+    atomic_init(&new_pool->pending_tasks, 0);
+
+    /* Start the workers, the calling thread is the last thread */
+    for (size_t iter = 1; iter < number_of_threads; ++iter) {
+        if (0 != pthread_create(&new_pool->threads[new_pool->number_of_workers], NULL, &thread_pool_worker, new_pool)) {
+            break;
+        }
+
+        ++(new_pool->number_of_workers);
+    }
+
+    /* Return the new thread pool */
+    return new_pool;
+}
+
+/**
+ * @brief Function to stop and join all the workers of a thread pool
+ * and to free the pool. No batch may run while the pool is freed.
+ * 
+ * @param pool pointer to an allocated thread pool
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_thread_pool(thread_pool_t * const __restrict__ pool) {
+    /* Check if thread pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_THREAD_POOL;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t iter = 0; iter < pool->number_of_workers; ++iter) {
+        pthread_join(pool->threads[iter], NULL);
+    }
+
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->lock);
+
+    for (size_t iter = 0; iter < pool->number_of_deques; ++iter) {
+        free_work_deque(pool->deques[iter]);
+    }
+
+    scl_free(pool->allocator, pool->deques);
+    scl_free(pool->allocator, pool->threads);
+    scl_free(pool->allocator, pool);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to run one batch of tasks on all threads of the pool,
+ * the calling thread included. The tasks are handed out in order of their
+ * indexes, every task runs exactly once and the function returns when all
+ * tasks are done (the tasks spawned by them included), so the writes of
+ * the tasks are visible to the caller.
+ * 
+ * @param pool pointer to an allocated thread pool
+ * @param task function to run every task
+ * @param arg argument of the batch passed to every task
+ * @param number_of_tasks number of tasks of the batch
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t thread_pool_run(thread_pool_t * const __restrict__ pool, thread_pool_task_func task, void * const arg, size_t number_of_tasks) {
+    /* Check if thread pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_THREAD_POOL;
+    }
+
+    /* Check if the task function is valid */
+    if (NULL == task) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+
+    pool->task = task;
+    pool->task_arg = arg;
+    pool->number_of_tasks = number_of_tasks;
+    atomic_store_explicit(&pool->next_task, 0, memory_order_relaxed);
+    atomic_store_explicit(&pool->pending_tasks, number_of_tasks, memory_order_relaxed);
+    pool->busy_workers = pool->number_of_workers;
+    ++(pool->generation);
+
+    pthread_cond_broadcast(&pool->work_cond);
+
+    /* Help the workers and wait for all of them */
+    thread_pool_drain(pool, pool->number_of_workers);
+
+    while (0 != pool->busy_workers) {
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to spawn one more task from a task of the batch that the
+ * pool is running. The task is pushed on the deque of the current thread,
+ * idle threads steal it, and **thread_pool_run** returns after it is done.
+ * This is how recursive algorithms split their work while they run. If the
+ * job cannot be allocated the task is run by the current thread at once.
+ * 
+ * @param pool pointer to the thread pool running the current task
+ * @param task function to run the task
+ * @param arg argument passed to the task
+ * @param task_index index passed to the task
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t thread_pool_spawn(thread_pool_t * const __restrict__ pool, thread_pool_task_func task, void * const arg, size_t task_index) {
+    /* Check if thread pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_THREAD_POOL;
+    }
+
+    /* Check if the task function is valid */
+    if (NULL == task) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    /* Tasks may be spawned just from the tasks of a running batch */
+    if (pool != current_pool) {
+        return SCL_INVALID_INPUT;
+    }
+
+    thread_pool_job_t *job = scl_malloc(pool->allocator, sizeof(*job));
+
+    if (NULL != job) {
+        job->task = task;
+        job->arg = arg;
+        job->index = task_index;
+
+        atomic_fetch_add_explicit(&pool->pending_tasks, 1, memory_order_relaxed);
+
+        if (SCL_OK == work_deque_push(pool->deques[current_thread], job)) {
+            return SCL_OK;
+        }
+
+        atomic_fetch_sub_explicit(&pool->pending_tasks, 1, memory_order_relaxed);
+        scl_free(pool->allocator, job);
+    }
+
+    /* Not enough memory to defer the task */
+    task(arg, task_index);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the number of threads running every batch of a thread pool,
+ * the calling thread included.
+ * 
+ * @param pool pointer to an allocated thread pool
+ * @return size_t 0 if the pool is not allocated or the number of threads
+ */
+size_t get_thread_pool_threads(const thread_pool_t * const __restrict__ pool) {
+    if (NULL == pool) {
+        return 0;
+    }
+
+    return pool->number_of_workers + 1;
+}
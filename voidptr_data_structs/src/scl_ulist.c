@@ -0,0 +1,1025 @@
+/**
+ * @file scl_ulist.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_ulist.h"
+
+/**
+ * @brief Create an Unrolled Linked List object. Allocation may fail if user
+ * does not provide a compare function, also in case if heap memory is full
+ * function will return a `NULL` pointer
+ *
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free the content of data
+ * basic types like int, float, double, etc... do not need a free function
+ * so you can pass a NULL pointer
+ * @param data_size length in bytes of the data data type
+ * @return ulist_t* return a new dynamically allocated list or `NULL` if
+ * allocation went wrong
+ */
+ulist_t* create_ulist(compare_func cmp, free_func frd, size_t data_size) {
+    /*
+     * It is required for every unrolled list to have a compare function
+     * The free function is optional
+     */
+    if (NULL == cmp) {
+        errno = EINVAL;
+        perror("Compare function undefined for unrolled list");
+        return NULL;
+    }
+
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    if (data_size > (SIZE_MAX / 2) / ULIST_MIN_CHUNK_ELEMS) {
+        errno = ENOMEM;
+        perror("Data size at creation is too big");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new list on heap */
+    ulist_t *new_list = scl_malloc(allocator, sizeof(*new_list));
+
+    /* Check if new list was allocated */
+    if (NULL != new_list) {
+        new_list->allocator = allocator;
+
+        /* Set pointer functions in unrolled list class */
+        new_list->cmp = cmp;
+        new_list->frd = frd;
+
+        /* Initialize head, tail and size of new list */
+        new_list->head = new_list->tail = NULL;
+        new_list->data_size = data_size;
+        new_list->size = 0;
+
+        /* One chunk spans ULIST_CHUNK_BYTES bytes of elements */
+        new_list->chunk_capacity = ULIST_CHUNK_BYTES / data_size;
+
+        if (new_list->chunk_capacity < ULIST_MIN_CHUNK_ELEMS) {
+            new_list->chunk_capacity = ULIST_MIN_CHUNK_ELEMS;
+        }
+    } else {
+        errno = ENOMEM;
+        perror("Not enough memory for unrolled list allocation");
+    }
+
+    /* Return new allocated list or `NULL` */
+    return new_list;
+}
+
+/**
+ * @brief Get a pointer to an element of a chunk, the elements are
+ * stored right after the chunk, in the same block.
+ *
+ * @param list an allocated unrolled list object
+ * @param chunk a chunk of the list
+ * @param offset index of the element inside the chunk
+ * @return uint8_t* pointer to the element
+ */
+static inline uint8_t* ulist_chunk_elem(const ulist_t * const __restrict__ list, const ulist_chunk_t * const __restrict__ chunk, size_t offset) {
+    return (uint8_t *)chunk + SCL_ALIGN_SIZE(sizeof(*chunk)) + offset * list->data_size;
+}
+
+/**
+ * @brief Create an empty chunk and link it after a chunk of the list.
+ *
+ * @param list an allocated unrolled list object
+ * @param chunk chunk to link after or `NULL` to link the new chunk as head
+ * @return ulist_chunk_t* a new linked chunk or `NULL` if allocation failed
+ */
+static ulist_chunk_t* ulist_link_new_chunk(ulist_t * const __restrict__ list, ulist_chunk_t * const __restrict__ chunk) {
+    /* Allocate the chunk and its elements in one block */
+    ulist_chunk_t *new_chunk = scl_malloc(list->allocator, SCL_ALIGN_SIZE(sizeof(*new_chunk)) + list->chunk_capacity * list->data_size);
+
+    if (NULL == new_chunk) {
+        return NULL;
+    }
+
+    new_chunk->count = 0;
+    new_chunk->prev = chunk;
+
+    if (NULL == chunk) {
+        new_chunk->next = list->head;
+        list->head = new_chunk;
+    } else {
+        new_chunk->next = chunk->next;
+        chunk->next = new_chunk;
+    }
+
+    if (NULL == new_chunk->next) {
+        list->tail = new_chunk;
+    } else {
+        new_chunk->next->prev = new_chunk;
+    }
+
+    return new_chunk;
+}
+
+/**
+ * @brief Unlink a chunk from the list and free it, the elements
+ * of the chunk must be freed or moved before.
+ *
+ * @param list an allocated unrolled list object
+ * @param chunk chunk of the list to free
+ */
+static void ulist_unlink_chunk(ulist_t * const __restrict__ list, ulist_chunk_t * const __restrict__ chunk) {
+    if (NULL == chunk->prev) {
+        list->head = chunk->next;
+    } else {
+        chunk->prev->next = chunk->next;
+    }
+
+    if (NULL == chunk->next) {
+        list->tail = chunk->prev;
+    } else {
+        chunk->next->prev = chunk->prev;
+    }
+
+    scl_free(list->allocator, chunk);
+}
+
+/**
+ * @brief Function to free the content of a run of elements of a chunk.
+ *
+ * @param list an allocated unrolled list object
+ * @param chunk a chunk of the list
+ * @param offset index of the first element of the run
+ * @param number number of elements of the run
+ */
+static void ulist_free_elems(const ulist_t * const __restrict__ list, const ulist_chunk_t * const __restrict__ chunk, size_t offset, size_t number) {
+    if (NULL == list->frd) {
+        return;
+    }
+
+    while (number--) {
+        list->frd(ulist_chunk_elem(list, chunk, offset++));
+    }
+}
+
+/**
+ * @brief Function to find the chunk holding the element at an index,
+ * the chunks are walked from the closer end of the list.
+ *
+ * @param list an allocated unrolled list object
+ * @param data_index index of the element, smaller than list size
+ * @param offset pointer to store the index of the element inside the chunk
+ * @return ulist_chunk_t* the chunk holding the element
+ */
+static ulist_chunk_t* ulist_locate(const ulist_t * const __restrict__ list, size_t data_index, size_t * const __restrict__ offset) {
+    ulist_chunk_t *iterator = NULL;
+
+    if (data_index < list->size / 2) {
+        iterator = list->head;
+
+        /* Skip whole chunks from the beginning */
+        while (data_index >= iterator->count) {
+            data_index -= iterator->count;
+            iterator = iterator->next;
+        }
+
+        *offset = data_index;
+    } else {
+        size_t back_index = list->size - 1 - data_index;
+
+        iterator = list->tail;
+
+        /* Skip whole chunks from the end */
+        while (back_index >= iterator->count) {
+            back_index -= iterator->count;
+            iterator = iterator->prev;
+        }
+
+        *offset = iterator->count - 1 - back_index;
+    }
+
+    return iterator;
+}
+
+/**
+ * @brief Function to find the chunk holding an element equal to
+ * the data provided by user. It uses cmp function provided by user
+ * at the creation of the unrolled list.
+ *
+ * @param list an allocated unrolled list object
+ * @param data pointer to a typed data
+ * @param offset pointer to store the index of the element inside the chunk
+ * @return ulist_chunk_t* `NULL` if data is not found or the chunk
+ * holding the element
+ */
+static ulist_chunk_t* ulist_find_chunk(const ulist_t * const __restrict__ list, const void * const __restrict__ data, size_t * const __restrict__ offset) {
+    for (ulist_chunk_t *iterator = list->head; NULL != iterator; iterator = iterator->next) {
+        for (size_t iter = 0; iter < iterator->count; ++iter) {
+            if (0 == list->cmp(ulist_chunk_elem(list, iterator, iter), data)) {
+                *offset = iter;
+                return iterator;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to insert an element inside a chunk. If the chunk
+ * is full its upper half is moved into a new chunk linked after it.
+ *
+ * @param list an allocated unrolled list object
+ * @param chunk chunk to insert the element into
+ * @param offset index of the new element inside the chunk
+ * @param data a pointer for data to insert in list
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t ulist_chunk_insert(ulist_t * const __restrict__ list, ulist_chunk_t *chunk, size_t offset, const void * __restrict__ data) {
+    if (chunk->count == list->chunk_capacity) {
+        ulist_chunk_t *new_chunk = ulist_link_new_chunk(list, chunk);
+
+        if (NULL == new_chunk) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        /* Split the full chunk in two halves */
+        const size_t half = chunk->count / 2;
+
+        new_chunk->count = chunk->count - half;
+        chunk->count = half;
+
+        memcpy(ulist_chunk_elem(list, new_chunk, 0), ulist_chunk_elem(list, chunk, half), new_chunk->count * list->data_size);
+
+        if (offset > half) {
+            chunk = new_chunk;
+            offset -= half;
+        }
+    }
+
+    uint8_t * const elem = ulist_chunk_elem(list, chunk, offset);
+
+    /* Make room for the new element */
+    memmove(elem + list->data_size, elem, (chunk->count - offset) * list->data_size);
+    memcpy(elem, data, list->data_size);
+
+    ++(chunk->count);
+    ++(list->size);
+
+    /* Insertion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to keep a chunk dense after a deletion. An empty chunk
+ * is freed, a chunk under a quarter full is merged with a neighbour chunk
+ * if they fit in one chunk, otherwise it takes elements from the neighbour.
+ *
+ * @param list an allocated unrolled list object
+ * @param chunk chunk of the list that lost elements
+ */
+static void ulist_rebalance(ulist_t * const __restrict__ list, ulist_chunk_t * const __restrict__ chunk) {
+    if (0 == chunk->count) {
+        ulist_unlink_chunk(list, chunk);
+        return;
+    }
+
+    if (chunk->count >= list->chunk_capacity / 4) {
+        return;
+    }
+
+    const size_t data_size = list->data_size;
+
+    if (NULL != chunk->next) {
+        ulist_chunk_t * const next = chunk->next;
+
+        if (chunk->count + next->count <= list->chunk_capacity) {
+
+            /* Merge the next chunk into this one */
+            memcpy(ulist_chunk_elem(list, chunk, chunk->count), ulist_chunk_elem(list, next, 0), next->count * data_size);
+            chunk->count += next->count;
+
+            ulist_unlink_chunk(list, next);
+        } else {
+
+            /* Take the first elements of the next chunk */
+            const size_t moved = (next->count - chunk->count) / 2;
+
+            memcpy(ulist_chunk_elem(list, chunk, chunk->count), ulist_chunk_elem(list, next, 0), moved * data_size);
+            memmove(ulist_chunk_elem(list, next, 0), ulist_chunk_elem(list, next, moved), (next->count - moved) * data_size);
+
+            chunk->count += moved;
+            next->count -= moved;
+        }
+    } else if (NULL != chunk->prev) {
+        ulist_chunk_t * const prev = chunk->prev;
+
+        if (prev->count + chunk->count <= list->chunk_capacity) {
+
+            /* Merge this chunk into the previous one */
+            memcpy(ulist_chunk_elem(list, prev, prev->count), ulist_chunk_elem(list, chunk, 0), chunk->count * data_size);
+            prev->count += chunk->count;
+
+            ulist_unlink_chunk(list, chunk);
+        } else {
+
+            /* Take the last elements of the previous chunk */
+            const size_t moved = (prev->count - chunk->count) / 2;
+
+            memmove(ulist_chunk_elem(list, chunk, moved), ulist_chunk_elem(list, chunk, 0), chunk->count * data_size);
+            memcpy(ulist_chunk_elem(list, chunk, 0), ulist_chunk_elem(list, prev, prev->count - moved), moved * data_size);
+
+            chunk->count += moved;
+            prev->count -= moved;
+        }
+    }
+}
+
+/**
+ * @brief Function to remove a run of elements from a chunk, the content
+ * of the elements is freed and the chunk is not rebalanced.
+ *
+ * @param list an allocated unrolled list object
+ * @param chunk a chunk of the list
+ * @param offset index of the first element of the run
+ * @param number number of elements of the run
+ */
+static void ulist_chunk_remove(ulist_t * const __restrict__ list, ulist_chunk_t * const __restrict__ chunk, size_t offset, size_t number) {
+    ulist_free_elems(list, chunk, offset, number);
+
+    /* Close the gap left by the run */
+    memmove(ulist_chunk_elem(list, chunk, offset), ulist_chunk_elem(list, chunk, offset + number), (chunk->count - offset - number) * list->data_size);
+
+    chunk->count -= number;
+    list->size -= number;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * unrolled list object. The function will iterate through all chunks and will
+ * free the data content according to frd function provided by user at
+ * creation of unrolled list, however if no free function was provided it means
+ * that data pointer does not contain any dinamically allocated elements.
+ *
+ * @param list an allocated unrolled list object. If list is not allocated
+ * no operation will be needed
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_ulist(ulist_t * const __restrict__ list) {
+    /* Check if list needs to be deallocated */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    /* Iterate through every chunk */
+    while (NULL != list->head) {
+        ulist_chunk_t *iterator = list->head;
+
+        list->head = list->head->next;
+
+        /* Erase content of the elements */
+        ulist_free_elems(list, iterator, 0, iterator->count);
+
+        scl_free(list->allocator, iterator);
+    }
+
+    /* Free list */
+    scl_free(list->allocator, list);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if an unrolled list object is empty or not.
+ * A `NULL` list is also considered as an empty list
+ *
+ * @param list an unrolled list object
+ * @return uint8_t true(1) if list is empty and false(0) if list is not
+ * empty
+ */
+uint8_t is_ulist_empty(const ulist_t * const __restrict__ list) {
+    if ((NULL == list) || (NULL == list->head)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the unrolled list size object. If list is not
+ * allocated then function will return SIZE_MAX value.
+ *
+ * @param list an unrolled list object
+ * @return size_t SIZE_MAX if list is not allocated or
+ * list size
+ */
+size_t get_ulist_size(const ulist_t * const __restrict__ list) {
+    if (NULL == list) {
+        return SIZE_MAX;
+    }
+
+    return list->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of an unrolled list. The
+ * chunk headers are counted as node bytes and the free element slots of
+ * the chunks as slack. Function visits every chunk of the list.
+ *
+ * @param list an unrolled list object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_memory_usage(const ulist_t * const __restrict__ list, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    size_t number_of_chunks = 0;
+
+    for (const ulist_chunk_t *chunk = list->head; NULL != chunk; chunk = chunk->next) {
+        ++number_of_chunks;
+    }
+
+    usage->object_bytes = sizeof(*list);
+    usage->node_bytes = number_of_chunks * SCL_ALIGN_SIZE(sizeof(ulist_chunk_t));
+    usage->payload_bytes = list->size * list->data_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = (number_of_chunks * list->chunk_capacity - list->size) * list->data_size;
+    usage->nodes = list->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the unrolled list head object
+ *
+ * @param list an unrolled list object
+ * @return const void* `NULL` if list is not allocated
+ * or actual head data of the list
+ */
+const void* get_ulist_head(const ulist_t * const __restrict__ list) {
+    if ((NULL == list) || (NULL == list->head)) {
+        return NULL;
+    }
+
+    return ulist_chunk_elem(list, list->head, 0);
+}
+
+/**
+ * @brief Get the unrolled list tail object
+ *
+ * @param list an unrolled list object
+ * @return const void* `NULL` if list is not allocated
+ * or actual tail data of the list
+ */
+const void* get_ulist_tail(const ulist_t * const __restrict__ list) {
+    if ((NULL == list) || (NULL == list->tail)) {
+        return NULL;
+    }
+
+    return ulist_chunk_elem(list, list->tail, list->tail->count - 1);
+}
+
+/**
+ * @brief Function to swap data between two elements of the list. If
+ * elements are the same then no operation will be executed. Function
+ * may fail if list is not allocated or the data is not found
+ *
+ * @param list an allocated unrolled list object
+ * @param first_data pointer to value of the first data
+ * @param second_data pointer to value of the second data
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_swap_data(const ulist_t * const __restrict__ list, const void * const __restrict__ first_data, const void * const __restrict__ second_data) {
+    /* Check if list and input data are allocated */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if ((NULL == first_data) || (NULL == second_data)) {
+        return SCL_CANNOT_SWAP_DATA;
+    }
+
+    size_t first_offset = 0;
+    size_t second_offset = 0;
+
+    const ulist_chunk_t * const first_chunk = ulist_find_chunk(list, first_data, &first_offset);
+    const ulist_chunk_t * const second_chunk = ulist_find_chunk(list, second_data, &second_offset);
+
+    if ((NULL == first_chunk) || (NULL == second_chunk)) {
+        return SCL_DATA_NOT_FOUND;
+    }
+
+    /* If elements are the same then no swap is nedeed */
+    if ((first_chunk == second_chunk) && (first_offset == second_offset)) {
+        return SCL_SWAP_SAME_DATA;
+    }
+
+    uint8_t *list_first_data = ulist_chunk_elem(list, first_chunk, first_offset);
+    uint8_t *list_second_data = ulist_chunk_elem(list, second_chunk, second_offset);
+
+    size_t data_size = list->data_size;
+
+    /* Interchange the bytes of the elements */
+    while (data_size-- > 0) {
+        uint8_t temp = *list_first_data;
+        *list_first_data++ = *list_second_data;
+        *list_second_data++ = temp;
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to change data of a specific unrolled list element.
+ *
+ * @param list an allocated unrolled list object
+ * @param base_data pointer to value of the base data
+ * @param new_data a pointer to value of the new data to replace
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_change_data(const ulist_t * const __restrict__ list, const void * const __restrict__ base_data, const void * __restrict__ new_data) {
+    /* Check if input is valid */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if ((NULL == base_data) || (NULL == new_data)) {
+        return SCL_CANNOT_CHANGE_DATA;
+    }
+
+    size_t offset = 0;
+    const ulist_chunk_t * const chunk = ulist_find_chunk(list, base_data, &offset);
+
+    if (NULL == chunk) {
+        return SCL_DATA_NOT_FOUND;
+    }
+
+    /* Copy all bytes from new data to current data */
+    memcpy(ulist_chunk_elem(list, chunk, offset), new_data, list->data_size);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to insert an element to the end of the list. A new
+ * chunk is linked just when the last chunk is full.
+ *
+ * @param list an unrolled list object
+ * @param data a pointer for data to insert in list
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_insert(ulist_t * const __restrict__ list, const void * __restrict__ data) {
+    /* Check if list and data are valid */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    ulist_chunk_t *chunk = list->tail;
+
+    /* Start a new chunk at the end of the list */
+    if ((NULL == chunk) || (chunk->count == list->chunk_capacity)) {
+        chunk = ulist_link_new_chunk(list, chunk);
+
+        if (NULL == chunk) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+    }
+
+    return ulist_chunk_insert(list, chunk, chunk->count, data);
+}
+
+/**
+ * @brief Function to insert an element in order in the list.
+ * Function will find the position of the new elements according
+ * to cmp function provided at the creation of the list, the chunks
+ * whose last element is smaller than the data are skipped whole
+ *
+ * @param list an unrolled list object
+ * @param data a pointer for data to insert in list
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_insert_order(ulist_t * const __restrict__ list, const void * __restrict__ data) {
+    /* Check if list and data are valid */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    ulist_chunk_t *iterator = list->head;
+
+    /* Find the chunk of the new element */
+    while ((NULL != iterator) && (list->cmp(data, ulist_chunk_elem(list, iterator, iterator->count - 1)) > 0)) {
+        iterator = iterator->next;
+    }
+
+    /* Every element is smaller, insert the data at the end */
+    if (NULL == iterator) {
+        return ulist_insert(list, data);
+    }
+
+    size_t offset = 0;
+
+    /* Find the position for the new element inside the chunk */
+    while (list->cmp(data, ulist_chunk_elem(list, iterator, offset)) > 0) {
+        ++offset;
+    }
+
+    return ulist_chunk_insert(list, iterator, offset, data);
+}
+
+/**
+ * @brief Function to insert an element in front of the list. A new
+ * chunk is linked just when the first chunk is full.
+ *
+ * @param list an unrolled list object
+ * @param data a pointer for data to insert in list
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_insert_front(ulist_t * const __restrict__ list, const void * __restrict__ data) {
+    /* Check if list and data are valid */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    ulist_chunk_t *chunk = list->head;
+
+    /* Start a new chunk at the beginning of the list */
+    if ((NULL == chunk) || (chunk->count == list->chunk_capacity)) {
+        chunk = ulist_link_new_chunk(list, NULL);
+
+        if (NULL == chunk) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+    }
+
+    return ulist_chunk_insert(list, chunk, 0, data);
+}
+
+/**
+ * @brief Function to insert an element at a specified index in the list.
+ * If index is bigger than current list size than element will be inserted
+ * at the end of the list. A full chunk is split in two halves.
+ *
+ * @param list an unrolled list object
+ * @param data a pointer for data to insert in list
+ * @param data_index the index to insert an element into unrolled list
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_insert_index(ulist_t * const __restrict__ list, const void * __restrict__ data, size_t data_index) {
+    /* Check if list and data are valid */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Insert element at the end of the list */
+    if (data_index >= list->size) {
+        return ulist_insert(list, data);
+    }
+
+    /* Insert element at the beginning of the list */
+    if (0 == data_index) {
+        return ulist_insert_front(list, data);
+    }
+
+    size_t offset = 0;
+    ulist_chunk_t * const chunk = ulist_locate(list, data_index, &offset);
+
+    return ulist_chunk_insert(list, chunk, offset, data);
+}
+
+/**
+ * @brief Function to find an element of the list from a given index.
+ * Function will fail if index is bigger than current size of list or
+ * list is not allocated. Whole chunks are skipped from the closer end
+ * of the list.
+ *
+ * @param list an unrolled list object
+ * @param data_index index to pick element from
+ * @return const void* unrolled list data from list at specified
+ * index
+ */
+const void* ulist_find_index(const ulist_t * const __restrict__ list, size_t data_index) {
+    /* Check if list and index are valid */
+    if ((NULL == list) || (data_index >= list->size)) {
+        return NULL;
+    }
+
+    size_t offset = 0;
+    const ulist_chunk_t * const chunk = ulist_locate(list, data_index, &offset);
+
+    return ulist_chunk_elem(list, chunk, offset);
+}
+
+/**
+ * @brief Function to find an element that is equal to specific data
+ * provided by user. It uses cmp function provided by user at the
+ * creation of the unrolled list.
+ *
+ * @param list an unrolled list object
+ * @param data pointer to a typed data
+ * @return const void* `NULL` if data is not found or a pointer
+ * to an unrolled list data equal to given data
+ */
+const void* ulist_find_data(const ulist_t * const __restrict__ list, const void * const __restrict__ data) {
+    /* Check if list and data are valid */
+    if ((NULL == list) || (NULL == data)) {
+        return NULL;
+    }
+
+    size_t offset = 0;
+    const ulist_chunk_t * const chunk = ulist_find_chunk(list, data, &offset);
+
+    /* Return a pointer to data or `NULL` */
+    if (NULL != chunk) {
+        return ulist_chunk_elem(list, chunk, offset);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to delete an element based on a value. The first element
+ * equal to data is removed, the data has to exist in the current list.
+ *
+ * @param list an unrolled list object
+ * @param data a pointer to a typed data to be removed
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_delete_data(ulist_t * const __restrict__ list, const void * const __restrict__ data) {
+    /* Check if list is allocated and it is not empty */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == list->head) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    size_t offset = 0;
+    ulist_chunk_t * const chunk = ulist_find_chunk(list, data, &offset);
+
+    /* List does not contain such element */
+    if (NULL == chunk) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    ulist_chunk_remove(list, chunk, offset, 1);
+    ulist_rebalance(list, chunk);
+
+    /* Deletion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to delete an element based on an index. If data_index
+ * is bigger than actual size of the list then function will fail its
+ * execution and will return an error.
+ *
+ * @param list an unrolled list object
+ * @param data_index element index in the list to be removed starts from 0
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_delete_index(ulist_t * const __restrict__ list, size_t data_index) {
+    /* Check if list is allocated and it is not empty */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == list->head) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (data_index >= list->size) {
+        return SCL_INDEX_OVERFLOWS_SIZE;
+    }
+
+    size_t offset = 0;
+    ulist_chunk_t * const chunk = ulist_locate(list, data_index, &offset);
+
+    ulist_chunk_remove(list, chunk, offset, 1);
+    ulist_rebalance(list, chunk);
+
+    /* Deletion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to erase a set of elements from range [left_index; right_index]
+ * If left_index is greater than right_index that they will be swapped. If right_index
+ * is bigger than actual size of the list right_index will be updated to the end of
+ * the list. If both left and right index are bigger than actual list size than
+ * the last element from unrolled object will be removed. The chunks inside the
+ * range are freed whole.
+ *
+ * @param list an unrolled list object
+ * @param left_index left index to start deletion
+ * @param right_index right index to finish deletion
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_erase(ulist_t * const __restrict__ list, size_t left_index, size_t right_index) {
+    /* Check if list is allocated and it is not empty */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == list->head) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* Check if boundaries are set right, swap if necessary */
+    if (left_index > right_index) {
+        size_t temp = left_index;
+        left_index = right_index;
+        right_index = temp;
+    }
+
+    /* Recalibrate left index if needed */
+    if (left_index >= list->size) {
+        left_index = list->size - 1;
+    }
+
+    /* Recalibrate right index if needed */
+    if (right_index >= list->size) {
+        right_index = list->size - 1;
+    }
+
+    /* Compute number of elements from range */
+    size_t delete_num = right_index - left_index + 1;
+
+    size_t offset = 0;
+    ulist_chunk_t * const first = ulist_locate(list, left_index, &offset);
+
+    /* Remove the front of the range from the first chunk */
+    size_t removed = first->count - offset;
+
+    if (removed > delete_num) {
+        removed = delete_num;
+    }
+
+    ulist_chunk_remove(list, first, offset, removed);
+    delete_num -= removed;
+
+    ulist_chunk_t *last = first->next;
+
+    /* Free the chunks covered by the range */
+    while ((0 != delete_num) && (delete_num >= last->count)) {
+        ulist_chunk_t * const next = last->next;
+
+        delete_num -= last->count;
+        list->size -= last->count;
+
+        ulist_free_elems(list, last, 0, last->count);
+        ulist_unlink_chunk(list, last);
+
+        last = next;
+    }
+
+    /* Remove the back of the range from the last chunk */
+    if (0 != delete_num) {
+        ulist_chunk_remove(list, last, 0, delete_num);
+        ulist_rebalance(list, last);
+    }
+
+    /* The first chunk may merge with the chunk after the range */
+    ulist_rebalance(list, first);
+
+    /* Deletion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to filter an unrolled list object. User provides a
+ * filter function that return true(1) or false(0). If filter function
+ * return 1 for an item then it will be added in a new unrolled list,
+ * otherwise item will not be inserted. If no element was inserted in the
+ * new unrolled list than the list will be automatically erased from memory
+ *
+ * @param list an unrolled list object
+ * @param filter a pointer to a filter function
+ * @return ulist_t* a filtered unrolled list object with smaller
+ * or equal size of the original unrolled list object
+ */
+ulist_t* ulist_filter(const ulist_t * const __restrict__ list, filter_func filter) {
+    /*
+     * Check if input is valid
+     * Filter function has to be different from NULL pointer
+     */
+    if ((NULL == list) || (NULL == list->head) || (NULL == filter)) {
+        return NULL;
+    }
+
+    /* Create a new unrolled list object */
+    ulist_t *filter_list = create_ulist(list->cmp, list->frd, list->data_size);
+
+    /* Check if list was created */
+    if (NULL != filter_list) {
+
+        /* Iterate through all list elements */
+        for (const ulist_chunk_t *iterator = list->head; NULL != iterator; iterator = iterator->next) {
+            for (size_t iter = 0; iter < iterator->count; ++iter) {
+                const void * const elem = ulist_chunk_elem(list, iterator, iter);
+
+                /* Check if item is filtered or not */
+                if (1 == filter(elem)) {
+                    ulist_insert(filter_list, elem);
+                }
+            }
+        }
+
+        /*
+         * If no element was added to list than free
+         * space of the new unrolled list and return NULL
+         */
+        if (NULL == filter_list->head) {
+            free_ulist(filter_list);
+            filter_list = NULL;
+        }
+    }
+
+    /* Return filtered list or `NULL` */
+    return filter_list;
+}
+
+/**
+ * @brief Function to traverse all list and do action on all elements,
+ * the elements of one chunk are visited one after another in memory.
+ *
+ * @param list an unrolled list object
+ * @param action a pointer to an action function(can be also a mapping func)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t ulist_traverse(const ulist_t * const __restrict__ list, action_func action) {
+    /*
+     * Check if list is allocated
+     * Check if user provided a valid map function
+     */
+    if (NULL == list) {
+        return SCL_NULL_ULIST;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    if (NULL == list->head) {
+        printf("[ ]\n");
+    } else {
+        for (const ulist_chunk_t *iterator = list->head; NULL != iterator; iterator = iterator->next) {
+            for (size_t iter = 0; iter < iterator->count; ++iter) {
+
+                /* Call the action function */
+                action(ulist_chunk_elem(list, iterator, iter));
+            }
+        }
+    }
+
+    return SCL_OK;
+}
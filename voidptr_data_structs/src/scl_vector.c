@@ -0,0 +1,644 @@
+/**
+ * @file scl_vector.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_vector.h"
+
+/**
+ * @brief Function to initialize a vector embedded inside another object.
+ * No memory is allocated until the first element is pushed (or the array
+ * is reserved), the array is allocated with the given allocator.
+ *
+ * @param vec pointer to the vector to initialize
+ * @param frd pointer to a function to free the content of one element or `NULL`
+ * @param data_size length in bytes of the data data type
+ * @param allocator allocator of the array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_init(vector_t * const __restrict__ vec, free_func frd, size_t data_size, const scl_allocator_t * const __restrict__ allocator) {
+    /* Check if input is valid */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if ((0 == data_size) || (NULL == allocator)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    vec->data = NULL;
+    vec->frd = frd;
+    vec->data_size = data_size;
+    vec->size = 0;
+    vec->capacity = 0;
+    vec->allocator = allocator;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to free the elements and the array of a vector embedded
+ * inside another object, the vector object itself is not freed. The vector
+ * is left empty and may be used again.
+ *
+ * @param vec an initialized vector
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_release(vector_t * const __restrict__ vec) {
+    /* Check if vector is valid */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    vector_clear(vec);
+
+    scl_free(vec->allocator, vec->data);
+
+    vec->data = NULL;
+    vec->capacity = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Create a vector object. Allocation may fail if the data size
+ * is zero or heap memory is full, in this case function will return
+ * a `NULL` pointer. No array is allocated until the first push.
+ *
+ * @param frd pointer to a function to free the content of data
+ * basic types like int, float, double, etc... do not need a free function
+ * so you can pass a NULL pointer
+ * @param data_size length in bytes of the data data type
+ * @return vector_t* a new allocated vector or `NULL` if the function fails
+ */
+vector_t* create_vector(free_func frd, size_t data_size) {
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* Allocate a new vector on heap */
+    vector_t *new_vector = scl_malloc(allocator, sizeof(*new_vector));
+
+    if (NULL == new_vector) {
+        errno = ENOMEM;
+        perror("Not enough memory for vector allocation");
+        return NULL;
+    }
+
+    vector_init(new_vector, frd, data_size, allocator);
+
+    /* Return a new allocated vector */
+    return new_vector;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * vector object. The content of every element is freed according to frd
+ * function provided by user at creation of the vector.
+ *
+ * @param vec an allocated vector object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_vector(vector_t * const __restrict__ vec) {
+    /* Check if vector needs to be freed */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    vector_release(vec);
+
+    scl_free(vec->allocator, vec);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if a vector object is empty or not.
+ * A `NULL` vector is also considered as an empty vector
+ *
+ * @param vec a vector object
+ * @return uint8_t true(1) if vector is empty and false(0) otherwise
+ */
+uint8_t is_vector_empty(const vector_t * const __restrict__ vec) {
+    if ((NULL == vec) || (0 == vec->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the vector size object. If vector is not
+ * allocated then function will return SIZE_MAX value.
+ *
+ * @param vec a vector object
+ * @return size_t SIZE_MAX if vector is not allocated or
+ * number of elements of the vector
+ */
+size_t get_vector_size(const vector_t * const __restrict__ vec) {
+    if (NULL == vec) {
+        return SIZE_MAX;
+    }
+
+    return vec->size;
+}
+
+/**
+ * @brief Function to get the memory footprint of a vector. The elements
+ * are the payload and the free capacity of the array is slack.
+ *
+ * @param vec a vector object
+ * @param usage pointer to the memory footprint to fill
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_memory_usage(const vector_t * const __restrict__ vec, scl_memory_usage_t * const __restrict__ usage) {
+    /* Check if input data is valid */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (NULL == usage) {
+        return SCL_INVALID_INPUT;
+    }
+
+    usage->object_bytes = sizeof(*vec);
+    usage->node_bytes = 0;
+    usage->payload_bytes = vec->size * vec->data_size;
+    usage->array_bytes = 0;
+    usage->slack_bytes = (vec->capacity - vec->size) * vec->data_size;
+    usage->nodes = vec->size;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Get the vector capacity object, the number of elements
+ * that fit in the array before it grows. If vector is not allocated
+ * then function will return SIZE_MAX value.
+ *
+ * @param vec a vector object
+ * @return size_t SIZE_MAX if vector is not allocated or its capacity
+ */
+size_t get_vector_capacity(const vector_t * const __restrict__ vec) {
+    if (NULL == vec) {
+        return SIZE_MAX;
+    }
+
+    return vec->capacity;
+}
+
+/**
+ * @brief Get a pointer to the array of the vector, the elements are
+ * contiguous, so the array may be passed as it is to quick_sort or
+ * binary_search (with get_vector_size elements of data_size bytes).
+ * The pointer is valid just until the array grows or shrinks.
+ *
+ * @param vec a vector object
+ * @return void* array of the vector or `NULL` if nothing is allocated
+ */
+void* vector_data(const vector_t * const __restrict__ vec) {
+    if (NULL == vec) {
+        return NULL;
+    }
+
+    return vec->data;
+}
+
+/**
+ * @brief Get a pointer to the element from an index in O(1). The
+ * pointer is valid just until the array grows or shrinks.
+ *
+ * @param vec a vector object
+ * @param data_index index of the element
+ * @return void* pointer to the element or `NULL` if index is not valid
+ */
+void* vector_at(const vector_t * const __restrict__ vec, size_t data_index) {
+    if ((NULL == vec) || (data_index >= vec->size)) {
+        return NULL;
+    }
+
+    return vec->data + data_index * vec->data_size;
+}
+
+/**
+ * @brief Get a pointer to the last element of the vector.
+ *
+ * @param vec a vector object
+ * @return void* pointer to the last element or `NULL` if vector is empty
+ */
+void* vector_back(const vector_t * const __restrict__ vec) {
+    if ((NULL == vec) || (0 == vec->size)) {
+        return NULL;
+    }
+
+    return vec->data + (vec->size - 1) * vec->data_size;
+}
+
+/**
+ * @brief Function to reallocate the array of a vector to an exact capacity
+ * (not smaller than the size). A capacity of zero frees the array.
+ *
+ * @param vec an allocated vector object
+ * @param capacity new number of elements of the array
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t vector_set_capacity(vector_t * const __restrict__ vec, size_t capacity) {
+    if (0 == capacity) {
+        scl_free(vec->allocator, vec->data);
+
+        vec->data = NULL;
+        vec->capacity = 0;
+
+        return SCL_OK;
+    }
+
+    if (capacity > SIZE_MAX / vec->data_size) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    uint8_t *try_realloc = scl_realloc(vec->allocator, vec->data, capacity * vec->data_size);
+
+    if (NULL == try_realloc) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    vec->data = try_realloc;
+    vec->capacity = capacity;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to make room for more elements. The capacity is
+ * doubled (at least VECTOR_MIN_CAPACITY) until the elements fit, so
+ * many pushes take amortized O(1) each.
+ *
+ * @param vec an allocated vector object
+ * @param number_of_elem number of elements to add after the last one
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t vector_grow(vector_t * const __restrict__ vec, size_t number_of_elem) {
+    if (number_of_elem > SIZE_MAX - vec->size) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    const size_t needed = vec->size + number_of_elem;
+
+    if (needed <= vec->capacity) {
+        return SCL_OK;
+    }
+
+    size_t new_capacity = (vec->capacity < VECTOR_MIN_CAPACITY) ? VECTOR_MIN_CAPACITY : vec->capacity;
+
+    while (new_capacity < needed) {
+        if (new_capacity > SIZE_MAX / 2) {
+            new_capacity = needed;
+            break;
+        }
+
+        new_capacity <<= 1;
+    }
+
+    return vector_set_capacity(vec, new_capacity);
+}
+
+/**
+ * @brief Function to preallocate the array for at least capacity
+ * elements, so the next pushes do not reallocate the array. The
+ * capacity never decreases.
+ *
+ * @param vec an allocated vector object
+ * @param capacity number of elements the array must hold
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_reserve(vector_t * const __restrict__ vec, size_t capacity) {
+    /* Check if vector is allocated */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (capacity <= vec->capacity) {
+        return SCL_OK;
+    }
+
+    return vector_set_capacity(vec, capacity);
+}
+
+/**
+ * @brief Function to give back memory of a vector, the capacity
+ * decreases to capacity (but not below the size of the vector). If
+ * the reallocation fails the vector keeps its bigger array.
+ *
+ * @param vec an allocated vector object
+ * @param capacity number of elements the array should hold
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_shrink(vector_t * const __restrict__ vec, size_t capacity) {
+    /* Check if vector is allocated */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (capacity < vec->size) {
+        capacity = vec->size;
+    }
+
+    if (capacity >= vec->capacity) {
+        return SCL_OK;
+    }
+
+    return vector_set_capacity(vec, capacity);
+}
+
+/**
+ * @brief Function to shrink the array to the size of the vector, an
+ * empty vector frees its array.
+ *
+ * @param vec an allocated vector object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_shrink_to_fit(vector_t * const __restrict__ vec) {
+    /* Check if vector is allocated */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    return vector_shrink(vec, vec->size);
+}
+
+/**
+ * @brief Function to insert an element at the end of the vector in
+ * amortized O(1).
+ *
+ * @param vec an allocated vector object
+ * @param data a pointer for data to insert in vector
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_push_back(vector_t * const __restrict__ vec, const void * __restrict__ data) {
+    /* Check if vector and data are valid */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (vec->size == vec->capacity) {
+        scl_error_t err = vector_grow(vec, 1);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    memcpy(vec->data + vec->size * vec->data_size, data, vec->data_size);
+    ++(vec->size);
+
+    /* Insertion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove the last element of the vector, the content
+ * of the element is freed with frd function. The array is not shrinked.
+ *
+ * @param vec an allocated vector object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_pop_back(vector_t * const __restrict__ vec) {
+    /* Check if vector is allocated and not empty */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (0 == vec->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    --(vec->size);
+
+    if (NULL != vec->frd) {
+        vec->frd(vec->data + vec->size * vec->data_size);
+    }
+
+    /* Deletion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to insert an element at a specified index in the vector,
+ * the next elements are moved one position to the right. If index is bigger
+ * than current vector size than element will be inserted at the end.
+ *
+ * @param vec an allocated vector object
+ * @param data a pointer for data to insert in vector
+ * @param data_index the index to insert the element into vector
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_insert(vector_t * const __restrict__ vec, const void * __restrict__ data, size_t data_index) {
+    /* Check if vector and data are valid */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (data_index >= vec->size) {
+        return vector_push_back(vec, data);
+    }
+
+    if (vec->size == vec->capacity) {
+        scl_error_t err = vector_grow(vec, 1);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    uint8_t * const elem = vec->data + data_index * vec->data_size;
+
+    /* Make room for the new element */
+    memmove(elem + vec->data_size, elem, (vec->size - data_index) * vec->data_size);
+    memcpy(elem, data, vec->data_size);
+
+    ++(vec->size);
+
+    /* Insertion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to copy an array of elements at the end of the vector,
+ * the array grows at most once.
+ *
+ * @param vec an allocated vector object
+ * @param arr array of number_of_elem elements of data_size bytes
+ * @param number_of_elem number of elements of the array
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_append(vector_t * const __restrict__ vec, const void * __restrict__ arr, size_t number_of_elem) {
+    /* Check if vector and array are valid */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (0 == number_of_elem) {
+        return SCL_OK;
+    }
+
+    if (NULL == arr) {
+        return SCL_INVALID_DATA;
+    }
+
+    scl_error_t err = vector_grow(vec, number_of_elem);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    memcpy(vec->data + vec->size * vec->data_size, arr, number_of_elem * vec->data_size);
+    vec->size += number_of_elem;
+
+    /* Insertion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to erase a set of elements from range [left_index; right_index]
+ * If left_index is greater than right_index that they will be swapped. If right_index
+ * is bigger than actual size of the vector right_index will be updated to the end of
+ * the vector. If both left and right index are bigger than actual vector size than
+ * the last element will be removed. The next elements are moved with one copy.
+ *
+ * @param vec an allocated vector object
+ * @param left_index left index to start deletion
+ * @param right_index right index to finish deletion
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_erase(vector_t * const __restrict__ vec, size_t left_index, size_t right_index) {
+    /* Check if vector is allocated and it is not empty */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (0 == vec->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* Check if boundaries are set right, swap if necessary */
+    if (left_index > right_index) {
+        size_t temp = left_index;
+        left_index = right_index;
+        right_index = temp;
+    }
+
+    /* Recalibrate indexes if needed */
+    if (left_index >= vec->size) {
+        left_index = vec->size - 1;
+    }
+
+    if (right_index >= vec->size) {
+        right_index = vec->size - 1;
+    }
+
+    /* Free content of the erased elements */
+    if (NULL != vec->frd) {
+        for (size_t iter = left_index; iter <= right_index; ++iter) {
+            vec->frd(vec->data + iter * vec->data_size);
+        }
+    }
+
+    /* Close the gap left by the range */
+    memmove(vec->data + left_index * vec->data_size, vec->data + (right_index + 1) * vec->data_size, (vec->size - right_index - 1) * vec->data_size);
+
+    vec->size -= right_index - left_index + 1;
+
+    /* Deletion went successfully */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to remove every element of the vector, the array is
+ * kept for the next pushes.
+ *
+ * @param vec an allocated vector object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_clear(vector_t * const __restrict__ vec) {
+    /* Check if vector is allocated */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    /* Free content of every element */
+    if (NULL != vec->frd) {
+        for (size_t iter = 0; iter < vec->size; ++iter) {
+            vec->frd(vec->data + iter * vec->data_size);
+        }
+    }
+
+    vec->size = 0;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to traverse the vector from the first element to
+ * the last one and do action on every element.
+ *
+ * @param vec an allocated vector object
+ * @param action a pointer to an action function(can be also a mapping func)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t vector_traverse(const vector_t * const __restrict__ vec, action_func action) {
+    /* Check if input is valid */
+    if (NULL == vec) {
+        return SCL_NULL_VECTOR;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    if (0 == vec->size) {
+        printf("[ ]\n");
+    } else {
+        for (size_t iter = 0; iter < vec->size; ++iter) {
+            action(vec->data + iter * vec->data_size);
+        }
+    }
+
+    return SCL_OK;
+}
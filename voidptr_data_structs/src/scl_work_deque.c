@@ -0,0 +1,297 @@
+/**
+ * @file scl_work_deque.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_work_deque.h"
+
+/**
+ * @brief Function to allocate a circular array of items.
+ *
+ * @param allocator allocator of the deque
+ * @param capacity number of items, a power of two
+ * @return work_deque_array_t* a new array or `NULL` if allocation failed
+ */
+static work_deque_array_t* create_work_deque_array(const scl_allocator_t * const __restrict__ allocator, int64_t capacity) {
+    work_deque_array_t *array = scl_malloc(allocator, sizeof(*array) + sizeof(array->items[0]) * (size_t)capacity);
+
+    if (NULL == array) {
+        return NULL;
+    }
+
+    array->previous = NULL;
+    array->capacity = capacity;
+
+    return array;
+}
+
+/**
+ * @brief Create a work-stealing deque object. Allocation may fail if there
+ * is not enough memory on heap.
+ *
+ * @param initial_capacity number of items of the first array, rounded up to
+ * a power of two (at least WORK_DEQUE_MIN_CAPACITY), the array grows when
+ * it is full
+ * @return work_deque_t* a new allocated deque object or `NULL` (if function fails)
+ */
+work_deque_t* create_work_deque(size_t initial_capacity) {
+    int64_t capacity = WORK_DEQUE_MIN_CAPACITY;
+
+    /* Round the capacity up to a power of two */
+    while ((size_t)capacity < initial_capacity) {
+        if (capacity > (INT64_MAX / 2) / (int64_t)sizeof(void *)) {
+            errno = ENOMEM;
+            perror("Capacity of the work deque is too big");
+            return NULL;
+        }
+
+        capacity <<= 1;
+    }
+
+    /* Objects keep the allocator selected at their creation */
+    const scl_allocator_t *allocator = scl_get_allocator();
+
+    /* The owner end and the thieves end start on their own cache lines */
+    void *memory = scl_malloc(allocator, sizeof(work_deque_t) + WORK_DEQUE_ALIGN - 1);
+
+    if (NULL == memory) {
+        errno = ENOMEM;
+        perror("Not enough memory for work deque allocation");
+        return NULL;
+    }
+
+    work_deque_t *new_deque = (work_deque_t *)(((uintptr_t)memory + WORK_DEQUE_ALIGN - 1) & ~(uintptr_t)(WORK_DEQUE_ALIGN - 1));
+
+    work_deque_array_t *array = create_work_deque_array(allocator, capacity);
+
+    if (NULL == array) {
+        scl_free(allocator, memory);
+
+        errno = ENOMEM;
+        perror("Not enough memory for work deque array allocation");
+        return NULL;
+    }
+
+    /* Set default values of the deque */
+    atomic_init(&new_deque->top, 0);
+    atomic_init(&new_deque->bottom, 0);
+    atomic_init(&new_deque->array, array);
+    new_deque->memory = memory;
+    new_deque->allocator = allocator;
+
+    /* Return a new allocated deque object */
+    return new_deque;
+}
+
+/**
+ * @brief Function to free every byte of memory allocated for a specific
+ * work-stealing deque, the items themselves are not freed. No other thread
+ * may use the deque while it is freed.
+ *
+ * @param deque an allocated work-stealing deque
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_work_deque(work_deque_t * const __restrict__ deque) {
+    /* Check if deque needs to be freed */
+    if (NULL == deque) {
+        return SCL_NULL_WORK_DEQUE;
+    }
+
+    const scl_allocator_t *allocator = deque->allocator;
+    work_deque_array_t *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    /* Free the current array and all the arrays it replaced */
+    while (NULL != array) {
+        work_deque_array_t *previous = array->previous;
+
+        scl_free(allocator, array);
+        array = previous;
+    }
+
+    scl_free(allocator, deque->memory);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to push an item on the bottom end of the deque. Just the
+ * owner thread may call this function. If the array is full it is doubled,
+ * so the push may fail just if there is not enough memory on heap.
+ *
+ * @param deque an allocated work-stealing deque
+ * @param item item to push
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t work_deque_push(work_deque_t * const __restrict__ deque, void * const item) {
+    /* Check if deque is allocated */
+    if (NULL == deque) {
+        return SCL_NULL_WORK_DEQUE;
+    }
+
+    const int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    const int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    work_deque_array_t *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    /* Grow the array, the thieves keep reading the old one until they see the new one */
+    if (bottom - top > array->capacity - 1) {
+        if (array->capacity > (INT64_MAX / 2) / (int64_t)sizeof(void *)) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        work_deque_array_t *new_array = create_work_deque_array(deque->allocator, array->capacity << 1);
+
+        if (NULL == new_array) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        for (int64_t iter = top; iter < bottom; ++iter) {
+            atomic_store_explicit(&new_array->items[iter & (new_array->capacity - 1)], atomic_load_explicit(&array->items[iter & (array->capacity - 1)], memory_order_relaxed), memory_order_relaxed);
+        }
+
+        new_array->previous = array;
+        atomic_store_explicit(&deque->array, new_array, memory_order_release);
+
+        array = new_array;
+    }
+
+    atomic_store_explicit(&array->items[bottom & (array->capacity - 1)], item, memory_order_relaxed);
+
+    /* Publish the item to the thieves */
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to pop the last pushed item from the bottom end of the
+ * deque. Just the owner thread may call this function, it races with the
+ * thieves just for the last item of the deque.
+ *
+ * @param deque an allocated work-stealing deque
+ * @param item pointer to store the popped item
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t work_deque_pop(work_deque_t * const __restrict__ deque, void ** const __restrict__ item) {
+    /* Check if deque is allocated */
+    if (NULL == deque) {
+        return SCL_NULL_WORK_DEQUE;
+    }
+
+    /* Check if item pointer is valid */
+    if (NULL == item) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    work_deque_array_t * const array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    /* Reserve the bottom item before looking at the thieves end */
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        /* Deque was empty */
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    *item = atomic_load_explicit(&array->items[bottom & (array->capacity - 1)], memory_order_relaxed);
+
+    if (top == bottom) {
+        /* Last item, the owner and the thieves race for it on the top end */
+        const uint8_t won = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+        if (0 == won) {
+            return SCL_DELETE_FROM_EMPTY_OBJECT;
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to steal the oldest item from the top end of the deque.
+ * Any thread may call this function. If another thief (or the owner) takes
+ * the item first the steal is retried until the deque is seen empty.
+ *
+ * @param deque an allocated work-stealing deque
+ * @param item pointer to store the stolen item
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t work_deque_steal(work_deque_t * const __restrict__ deque, void ** const __restrict__ item) {
+    /* Check if deque is allocated */
+    if (NULL == deque) {
+        return SCL_NULL_WORK_DEQUE;
+    }
+
+    /* Check if item pointer is valid */
+    if (NULL == item) {
+        return SCL_INVALID_INPUT;
+    }
+
+    for (;;) {
+        int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        const int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+        if (top >= bottom) {
+            return SCL_DELETE_FROM_EMPTY_OBJECT;
+        }
+
+        work_deque_array_t * const array = atomic_load_explicit(&deque->array, memory_order_acquire);
+        void * const stolen = atomic_load_explicit(&array->items[top & (array->capacity - 1)], memory_order_relaxed);
+
+        if (atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)) {
+            *item = stolen;
+
+            /* All good */
+            return SCL_OK;
+        }
+    }
+}
+
+/**
+ * @brief Get the number of items of the deque. If other threads use the
+ * deque the value may be old when it is returned.
+ *
+ * @param deque an allocated work-stealing deque
+ * @return size_t number of items or SIZE_MAX if deque is not allocated
+ */
+size_t get_work_deque_size(const work_deque_t * const __restrict__ deque) {
+    /* Check if deque is allocated */
+    if (NULL == deque) {
+        return SIZE_MAX;
+    }
+
+    const int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    const int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    return (bottom > top) ? (size_t)(bottom - top) : 0;
+}
@@ -0,0 +1,608 @@
+/**
+ * @file units.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2023-06-26
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of c-language-data-structures.
+ *
+ * c-language-data-structures is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * c-language-data-structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with c-language-data-structures.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "scl_datastruc.h"
+
+/**
+ * @brief Number of failed checks, the exit status of the tests.
+ * 
+ */
+static int failed_checks = 0;
+
+/**
+ * @brief Prints the header of the test.
+ * 
+ * @param msg the header title.
+ */
+void print_header(const char *const msg) {
+  size_t msg_len = strlen(msg);
+  size_t dots = (44 - msg_len) / 2;
+
+  for (size_t dot = 0; dot < dots; ++dot) {
+    fprintf(stderr, ".");
+  }
+
+  fprintf(stderr, " \033[0;32m%s\033[0m ", msg);
+
+  for (size_t dot = 0; dot < dots; ++dot) {
+    fprintf(stderr, ".");
+  }
+
+  if (msg_len & 1) {
+    fprintf(stderr, ".");
+  }
+
+  fprintf(stderr, "\n");
+}
+
+/**
+ * @brief Print the footer of a test.
+ * 
+ */
+void print_footer(void) {
+  for (size_t dot = 0; dot < 46; ++dot) {
+    fprintf(stderr, ".");
+  }
+
+  fprintf(stderr, "\n\n");
+}
+
+/**
+ * @brief Checks if the condition is true and prints passed
+ * or failed on the `stderr`.
+ * 
+ * @param msg 
+ * @param cond 
+ */
+void assert_test(const char *const msg, int cond) {
+  size_t msg_len = strlen(msg);
+  size_t dots = 38 - msg_len;
+
+  fprintf(stderr, "%s ", msg);
+  for (size_t dot = 0; dot < dots; ++dot) {
+    fprintf(stderr, ".");
+  }
+  fprintf(stderr,
+          " %s\n",
+          cond ? "\033[0;32mpassed\033[0m" : "\033[0;31mfailed\033[0m"
+  );
+
+  if (!cond) {
+    ++failed_checks;
+  }
+}
+
+/**
+ * @brief Checks the red-black properties of a subtree: the parent links,
+ * the order of the keys, no red node with a red child and the same black
+ * height on every path.
+ * 
+ * @param tree the red-black tree of the subtree.
+ * @param root the root of the subtree.
+ * @param parent the expected parent of the root.
+ * @param nodes counter of the visited nodes.
+ * @return int the black height of the subtree or -1 if it is invalid.
+ */
+int rbk_check_subtree(const rbk_tree_t *const tree, const rbk_tree_node_t *const root,
+                      const rbk_tree_node_t *const parent, size_t *const nodes) {
+  if (tree->nil == root) {
+    return 1;
+  }
+
+  ++(*nodes);
+
+  if (root->parent != parent) {
+    return -1;
+  }
+
+  if ((RED == root->color) && ((RED == root->left->color) || (RED == root->right->color))) {
+    return -1;
+  }
+
+  if ((tree->nil != root->left) && (*(const int *)root->left->data >= *(const int *)root->data)) {
+    return -1;
+  }
+
+  if ((tree->nil != root->right) && (*(const int *)root->right->data <= *(const int *)root->data)) {
+    return -1;
+  }
+
+  int left_height = rbk_check_subtree(tree, root->left, root, nodes);
+  int right_height = rbk_check_subtree(tree, root->right, root, nodes);
+
+  if ((-1 == left_height) || (left_height != right_height)) {
+    return -1;
+  }
+
+  return left_height + ((BLACK == root->color) ? 1 : 0);
+}
+
+/**
+ * @brief Checks every red-black property of a tree and its size.
+ * 
+ * @param tree the red-black tree to check.
+ * @return int 1 if the tree is valid, 0 otherwise.
+ */
+int rbk_is_valid(const rbk_tree_t *const tree) {
+  size_t nodes = 0;
+
+  if ((tree->nil != tree->root) && (BLACK != tree->root->color)) {
+    return 0;
+  }
+
+  return (-1 != rbk_check_subtree(tree, tree->root, tree->nil, &nodes)) && (nodes == tree->size);
+}
+
+/**
+ * @brief Test `rbk_delete` keeps the red-black properties.
+ * 
+ */
+void test_rbk_delete(void) {
+  print_header("rbk_delete");
+
+  int valid = 1;
+
+  srand(46);
+
+  for (int round = 0; round < 100; ++round) {
+    rbk_tree_t *tree = create_rbk(compare_int, NULL, sizeof(int));
+
+    for (int key = 0; key < 500; ++key) {
+      int value = rand() % 10000;
+      rbk_insert(tree, &value);
+    }
+
+    for (int step = 0; step < 250; ++step) {
+      int value = rand() % 10000;
+      rbk_delete(tree, &value);
+    }
+
+    valid = valid && rbk_is_valid(tree);
+
+    free_rbk(tree);
+  }
+
+  assert_test("random deletes keep the tree valid", valid);
+
+  print_footer();
+}
+
+/**
+ * @brief Test `rbk_union` after `rbk_split` and `rbk_delete`.
+ * 
+ */
+void test_rbk_split_delete_union(void) {
+  print_header("rbk_split delete union");
+
+  int valid = 1;
+  int merged = 1;
+
+  srand(460);
+
+  for (int round = 0; round < 100; ++round) {
+    rbk_tree_t *tree = create_rbk(compare_int, NULL, sizeof(int));
+    rbk_tree_t *greater = create_rbk(compare_int, NULL, sizeof(int));
+
+    for (int key = 0; key < 1000; ++key) {
+      rbk_insert(tree, &key);
+    }
+
+    int pivot = rand() % 1000;
+
+    merged = merged && (SCL_OK == rbk_split(tree, &pivot, greater));
+    valid = valid && rbk_is_valid(tree) && rbk_is_valid(greater);
+
+    for (int step = 0; step < 300; ++step) {
+      int value = rand() % 1000;
+
+      rbk_delete(tree, &value);
+      rbk_delete(greater, &value);
+    }
+
+    valid = valid && rbk_is_valid(tree) && rbk_is_valid(greater);
+
+    size_t size = tree->size + greater->size;
+
+    merged = merged && (SCL_OK == rbk_union(tree, greater));
+    merged = merged && (size == tree->size) && (0 == greater->size);
+    valid = valid && rbk_is_valid(tree);
+
+    free_rbk(tree);
+    free_rbk(greater);
+  }
+
+  assert_test("split and deletes keep trees valid", valid);
+  assert_test("union keeps every element", merged);
+
+  print_footer();
+}
+
+/**
+ * @brief Test `list_concat` after the deletes leave the list empty.
+ * 
+ */
+void test_list_concat_after_delete(void) {
+  print_header("list_concat after delete");
+
+  int value = 1;
+  int other_value = 5;
+
+  list_t *list = create_list(compare_int, NULL, sizeof(int));
+  list_t *other = create_list(compare_int, NULL, sizeof(int));
+
+  list_insert(list, &value);
+  list_delete_index(list, 0);
+  assert_test("delete index clears the tail", NULL == get_list_tail(list));
+
+  list_insert(other, &other_value);
+  list_concat(list, other);
+  assert_test("concat sets the tail", 5 == *(const int *)get_list_tail(list));
+  assert_test("concat sets the head", 5 == *(const int *)get_list_head(list));
+
+  list_delete_data(list, &other_value);
+  assert_test("delete data clears the tail", NULL == get_list_tail(list));
+
+  list_insert(list, &value);
+  list_insert(list, &other_value);
+  list_erase(list, 0, 1);
+  assert_test("erase clears the tail", NULL == get_list_tail(list));
+
+  list_insert(other, &value);
+  list_splice(list, 0, other);
+  assert_test("splice sets the tail", 1 == *(const int *)get_list_tail(list));
+
+  free_list(list);
+  free_list(other);
+
+  print_footer();
+}
+
+/**
+ * @brief Test the nodes of `list_from_array` moved by `list_split_at`
+ * and `list_concat` and freed one by one.
+ * 
+ */
+void test_list_from_array_moves(void) {
+  print_header("list_from_array moves");
+
+  int arr[1000];
+
+  for (int iter = 0; iter < 1000; ++iter) {
+    arr[iter] = iter;
+  }
+
+  list_t *list = list_from_array(compare_int, NULL, arr, 1000, sizeof(int));
+  list_t *heap_list = create_list(compare_int, NULL, sizeof(int));
+
+  for (int iter = 0; iter < 1000; ++iter) {
+    list_insert(heap_list, &arr[iter]);
+  }
+
+  list_concat(list, heap_list);
+
+  scl_memory_usage_t whole_usage;
+  scl_memory_usage_t first_usage;
+  scl_memory_usage_t second_usage;
+
+  list_memory_usage(list, &whole_usage);
+
+  int moved = 1;
+  int shared = 1;
+
+  srand(40);
+
+  for (int round = 0; round < 1000; ++round) {
+    list_t *rest = list_split_at(list, (size_t)(rand() % 2000));
+
+    list_memory_usage(list, &first_usage);
+    list_memory_usage(rest, &second_usage);
+
+    shared = shared && (first_usage.node_bytes + second_usage.node_bytes == whole_usage.node_bytes);
+    shared = shared && (first_usage.slack_bytes + second_usage.slack_bytes == whole_usage.slack_bytes);
+
+    list_concat(list, rest);
+    free_list(rest);
+  }
+
+  for (int iter = 0; iter < 2000; ++iter) {
+    moved = moved && (iter % 1000 == *(const int *)list_find_index(list, (size_t)iter));
+  }
+
+  assert_test("split and concat keep the order", moved);
+  assert_test("split lists share the blocks", shared);
+
+  for (int iter = 0; iter < 1500; ++iter) {
+    list_delete_index(list, (size_t)(rand() % (2000 - iter)));
+  }
+
+  list_memory_usage(list, &whole_usage);
+  assert_test("freed block nodes are slack", (500 == whole_usage.nodes) && (0 != whole_usage.slack_bytes));
+
+  free_list(list);
+  free_list(heap_list);
+
+  print_footer();
+}
+
+/**
+ * @brief Test the nodes of `dlist_from_array` moved by `dlist_split_at`
+ * and `dlist_concat` and freed one by one.
+ * 
+ */
+void test_dlist_from_array_moves(void) {
+  print_header("dlist_from_array moves");
+
+  int arr[1000];
+
+  for (int iter = 0; iter < 1000; ++iter) {
+    arr[iter] = iter;
+  }
+
+  dlist_t *list = dlist_from_array(compare_int, NULL, arr, 1000, sizeof(int));
+  dlist_t *heap_list = create_dlist(compare_int, NULL, sizeof(int));
+
+  for (int iter = 0; iter < 1000; ++iter) {
+    dlist_insert(heap_list, &arr[iter]);
+  }
+
+  dlist_concat(list, heap_list);
+
+  scl_memory_usage_t whole_usage;
+  scl_memory_usage_t first_usage;
+  scl_memory_usage_t second_usage;
+
+  dlist_memory_usage(list, &whole_usage);
+
+  int moved = 1;
+  int shared = 1;
+
+  srand(40);
+
+  for (int round = 0; round < 1000; ++round) {
+    dlist_t *rest = dlist_split_at(list, (size_t)(rand() % 2000));
+
+    dlist_memory_usage(list, &first_usage);
+    dlist_memory_usage(rest, &second_usage);
+
+    shared = shared && (first_usage.node_bytes + second_usage.node_bytes == whole_usage.node_bytes);
+    shared = shared && (first_usage.slack_bytes + second_usage.slack_bytes == whole_usage.slack_bytes);
+
+    dlist_concat(list, rest);
+    free_dlist(rest);
+  }
+
+  for (int iter = 0; iter < 2000; ++iter) {
+    moved = moved && (iter % 1000 == *(const int *)dlist_find_index(list, (size_t)iter));
+  }
+
+  assert_test("split and concat keep the order", moved);
+  assert_test("split lists share the blocks", shared);
+
+  for (int iter = 0; iter < 1500; ++iter) {
+    dlist_delete_index(list, (size_t)(rand() % (2000 - iter)));
+  }
+
+  dlist_memory_usage(list, &whole_usage);
+  assert_test("freed block nodes are slack", (500 == whole_usage.nodes) && (0 != whole_usage.slack_bytes));
+
+  free_dlist(list);
+  free_dlist(heap_list);
+
+  print_footer();
+}
+
+/**
+ * @brief Finds every key of the concurrent hash table test.
+ * 
+ * @param arg the concurrent hash table.
+ * @return void* `NULL`, or the table if a key was not found.
+ */
+void *find_concurrent_keys(void *arg) {
+  concurrent_hash_table_t *cht = arg;
+  int found = 1;
+
+  for (int round = 0; round < 20; ++round) {
+    for (int key = 0; key < 1000; ++key) {
+      int data = 0;
+
+      found = found && (SCL_OK == concurrent_hash_table_find_data(cht, &key, &data)) && (data == 2 * key);
+      found = found && concurrent_hash_table_contains_key(cht, &key);
+    }
+  }
+
+  return found ? NULL : arg;
+}
+
+/**
+ * @brief Test the finds of many threads and `concurrent_hash_table_delete_key_data`.
+ * 
+ */
+void test_concurrent_hash_table(void) {
+  print_header("concurrent_hash_table");
+
+  concurrent_hash_table_t *cht = create_concurrent_hash_table(8, 16, hash_int, compare_int, compare_int,
+                                                              NULL, NULL, sizeof(int), sizeof(int));
+
+  for (int key = 0; key < 1000; ++key) {
+    int data = 2 * key;
+    concurrent_hash_table_insert(cht, &key, &data);
+  }
+
+  pthread_t readers[4];
+  int found = 1;
+
+  for (int iter = 0; iter < 4; ++iter) {
+    pthread_create(&readers[iter], NULL, find_concurrent_keys, cht);
+  }
+
+  for (int iter = 0; iter < 4; ++iter) {
+    void *result = NULL;
+
+    pthread_join(readers[iter], &result);
+    found = found && (NULL == result);
+  }
+
+  assert_test("readers find every key", found);
+
+  int deleted = 1;
+
+  for (int key = 0; key < 1000; key += 2) {
+    int data = 2 * key;
+    int wrong_data = data + 1;
+
+    deleted = deleted && (SCL_DATA_NOT_FOUND_FOR_DELETE == concurrent_hash_table_delete_key_data(cht, &key, &wrong_data));
+    deleted = deleted && (SCL_OK == concurrent_hash_table_delete_key_data(cht, &key, &data));
+  }
+
+  deleted = deleted && (500 == get_concurrent_hash_table_size(cht));
+
+  for (int key = 0; key < 1000; ++key) {
+    deleted = deleted && ((key & 1) == concurrent_hash_table_contains_key(cht, &key));
+  }
+
+  assert_test("delete key data removes the pairs", deleted);
+
+  free_concurrent_hash_table(cht);
+
+  print_footer();
+}
+
+/**
+ * @brief Stop flag of the persistent red-black tree readers.
+ * 
+ */
+static atomic_int prbk_readers_stop = 0;
+
+/**
+ * @brief Acquires and releases snapshots until the writer is done, every
+ * snapshot must hold a prefix of the keys.
+ * 
+ * @param arg the persistent red-black tree.
+ * @return void* `NULL`, or the tree if a snapshot was wrong.
+ */
+void *read_prbk_snapshots(void *arg) {
+  prbk_tree_t *tree = arg;
+  int valid = 1;
+
+  while (0 == atomic_load(&prbk_readers_stop)) {
+    const prbk_snapshot_t *snapshot = prbk_acquire_snapshot(tree);
+    int size = (int)get_prbk_snapshot_size(snapshot);
+
+    if (0 != size) {
+      int last = size - 1;
+      valid = valid && (NULL != prbk_snapshot_find_data(snapshot, &last));
+      valid = valid && (NULL == prbk_snapshot_find_data(snapshot, &size));
+    }
+
+    prbk_release_snapshot(tree, snapshot);
+  }
+
+  return valid ? NULL : arg;
+}
+
+/**
+ * @brief Test `prbk_publish` while many readers acquire snapshots.
+ * 
+ */
+void test_prbk_publish_readers(void) {
+  print_header("prbk_publish readers");
+
+  prbk_tree_t *tree = create_prbk(compare_int, NULL, sizeof(int));
+  pthread_t readers[4];
+
+  atomic_store(&prbk_readers_stop, 0);
+
+  for (int iter = 0; iter < 4; ++iter) {
+    pthread_create(&readers[iter], NULL, read_prbk_snapshots, tree);
+  }
+
+  int published = 1;
+
+  for (int key = 0; key < 2000; ++key) {
+    published = published && (SCL_OK == prbk_insert(tree, &key)) && (SCL_OK == prbk_publish(tree));
+  }
+
+  atomic_store(&prbk_readers_stop, 1);
+
+  int valid = 1;
+
+  for (int iter = 0; iter < 4; ++iter) {
+    void *result = NULL;
+
+    pthread_join(readers[iter], &result);
+    valid = valid && (NULL == result);
+  }
+
+  assert_test("writer publishes among readers", published);
+  assert_test("readers see published prefixes", valid);
+  assert_test("free after the readers are done", SCL_OK == free_prbk(tree));
+
+  print_footer();
+}
+
+/**
+ * @brief Test the deletes of an empty `flat_hash_table`.
+ * 
+ */
+void test_flat_hash_table_delete_empty(void) {
+  print_header("flat_hash_table delete empty");
+
+  flat_hash_table_t *ht = create_flat_hash_table(16, hash_int, compare_int, compare_int, NULL, NULL, sizeof(int), sizeof(int));
+  int key = 7;
+  int data = 14;
+
+  assert_test("delete key from empty table", SCL_DELETE_FROM_EMPTY_OBJECT == flat_hash_table_delete_key(ht, &key));
+  assert_test("delete pair from empty table", SCL_DELETE_FROM_EMPTY_OBJECT == flat_hash_table_delete_key_data(ht, &key, &data));
+
+  flat_hash_table_insert(ht, &key, &data);
+  key = 8;
+  assert_test("delete missing key", SCL_DATA_NOT_FOUND_FOR_DELETE == flat_hash_table_delete_key(ht, &key));
+  key = 7;
+  assert_test("delete present key", SCL_OK == flat_hash_table_delete_key(ht, &key));
+
+  free_flat_hash_table(ht);
+
+  print_footer();
+}
+
+int main(void) {
+  print_header("DSTRUC UNIT TESTS");
+
+  test_rbk_delete();
+  test_rbk_split_delete_union();
+
+  test_list_concat_after_delete();
+  test_list_from_array_moves();
+  test_dlist_from_array_moves();
+
+  test_flat_hash_table_delete_empty();
+  test_concurrent_hash_table();
+  test_prbk_publish_readers();
+
+  return (0 == failed_checks) ? EXIT_SUCCESS : EXIT_FAILURE;
+}